@@ -51,6 +51,18 @@
 //              u_k := 3*u_{k-1} - 3*u_{k-2}) + u_{k-3}
 // Defaults to 2.
 //
+// --time-predict <history> <order> [expo|lsq]
+// Specifies that the initial guess u_k for the non-linear solver in each time step is to be
+// computed by a solution history predictor instead of the fixed extrapolation formulae of the
+// --time-expo option, where:
+//   <history> is the number of previous solutions that are kept by the predictor
+//   <order>   is the degree of the polynomial in time that is used for the prediction
+//   expo      uses polynomial extrapolation through the <order>+1 most recent solutions
+//   lsq       fits a polynomial of degree <order> to all <history> solutions in the
+//             least-squares sense; this is less sensitive to oscillations in the history
+// The predictor takes the actual time stamps into account, so it also handles restarts
+// with a changed time step size. Defaults to 'expo'.
+//
 // --steady-tol <tol>
 // Specifies the velocity time-derivative tolerance for steady-state detection.
 // The time-stepping loop will be terminated before reaching T-max if the L2-norm
@@ -128,6 +140,7 @@
 #define APPLICATIONS_CCND_UNSTEADY_APPBASE_HPP 1
 
 #include "ccnd_steady_appbase.hpp"
+#include <control/time/solution_predictor.hpp>
 
 namespace CCND
 {
@@ -163,6 +176,12 @@ namespace CCND
     /// time extrapolation order: 0, 1 or 2
     IndexType time_expo = Index(2);
 
+    /// specifies whether to use the solution history predictor instead of the time extrapolation
+    bool use_predictor = false;
+
+    /// the solution history predictor
+    Control::Time::SolutionPredictor<GlobalSystemVector> predictor;
+
     /// current velocity derivative norm
     DataType velo_deriv_norm = DataType(0);
 
@@ -209,6 +228,7 @@ namespace CCND
       args.support("time-max");
       args.support("time-steps");
       args.support("time-expo");
+      args.support("time-predict");
       args.support("steady-tol");
       args.support("checkpoint");
       args.support("restart");
@@ -232,6 +252,16 @@ namespace CCND
       args.parse("time-expo", time_expo);
       args.parse("steady-tol", steady_tol);
 
+      if(args.check("time-predict") > 0)
+      {
+        Index predict_history(3), predict_order(2);
+        Control::Time::PredictorType predict_type(Control::Time::PredictorType::extrapolation);
+        args.parse("time-predict", predict_history, predict_order, predict_type);
+        XASSERTM(predict_history > Index(0), "invalid solution history size for --time-predict");
+        predictor.configure(predict_history, predict_order, predict_type);
+        use_predictor = true;
+      }
+
       delta_t = time_max / DataType(max_time_steps);
 
       args.parse("checkpoint", checkpoint_filename, checkpoint_step, checkpoint_mod);
@@ -253,7 +283,13 @@ namespace CCND
       comm.print(String("Number of Time Steps").pad_back(pad_len, pad_char) + ": " + stringify(max_time_steps));
       comm.print(String("Main Stepping").pad_back(pad_len, pad_char) + ": " + stringify(main_step));
       comm.print(String("Time Step Length").pad_back(pad_len, pad_char) + ": " + stringify(delta_t));
-      comm.print(String("Time Extrapolation Order").pad_back(pad_len, pad_char) + ": " + stringify(time_expo));
+      if(use_predictor)
+      {
+        comm.print(String("Time Predictor").pad_back(pad_len, pad_char) + ": " + stringify(predictor.get_type())
+          + " : history " + stringify(predictor.get_max_history()) + " : order " + stringify(predictor.get_order()));
+      }
+      else
+        comm.print(String("Time Extrapolation Order").pad_back(pad_len, pad_char) + ": " + stringify(time_expo));
       comm.print(String("Steady State Derivative Tol").pad_back(pad_len, pad_char) + ": " + stringify_fp_sci(steady_tol));
 
       if(!checkpoint_filename.empty())
@@ -325,6 +361,14 @@ namespace CCND
       cur_step = (restart_step <= Index(0) ? cp_time_step : restart_step - Index(1));
       cur_time = (restart_time <= DataType(0) ? cp_cur_time : restart_time - delta_t);
 
+      // seed the predictor with the restored history; u[k-0] is added in the first time step
+      if(use_predictor)
+      {
+        predictor.clear();
+        predictor.push(vec_sol_2, cur_time - DataType(2) * cp_delta_t);
+        predictor.push(vec_sol_1, cur_time - cp_delta_t);
+      }
+
       // same timestep size?
       const bool same_dt = Math::abs(cp_delta_t - delta_t) < delta_t*DataType(1E-10);
 
@@ -495,8 +539,22 @@ namespace CCND
       // get a temporary vector
       GlobalSystemVector& vec_sol_3 = vec_tmp;
 
+      // add the previous solution u_{k-1} to the predictor history
+      if(use_predictor)
+        predictor.push(vec_sol, cur_time - delta_t);
+
       // extrapolate initial u_{k} from u_{k-1}, u_{k-2} and u_{k-3} for this time-step
-      if(cur_step > Index(1))
+      if(use_predictor && (cur_step > Index(1)))
+      {
+        // shift solution vectors
+        vec_sol_2.copy(vec_sol_1); // u_{k-2}
+        vec_sol_1.copy(vec_sol);   // u_{k-1}
+
+        // predict solution from history; fall back to constant extrapolation if that fails
+        if(!predictor.predict(vec_sol, cur_time))
+          vec_sol.copy(vec_sol_1);
+      }
+      else if(cur_step > Index(1))
       {
         // shift solution vectors
         vec_sol_3.copy(vec_sol_2); // u_{k-3}
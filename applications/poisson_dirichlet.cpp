@@ -135,6 +135,16 @@ namespace PoissonDirichlet
     the_system_level.filter_sys.filter_sol(vec_sol);
     the_system_level.filter_sys.filter_rhs(vec_rhs);
 
+    // release the redundant index sets of the finest mesh if desired; the remaining steps only
+    // require the vertices-at-element index set, which is used by the trafo and the Lagrange-1 space
+    if (args.check("compact-mesh") >= 0)
+    {
+      const std::size_t bytes_full = the_domain_level.bytes();
+      the_domain_level.release_mesh_index_sets(false);
+      comm.print("Released finest mesh index sets: " + stringify(bytes_full) + " -> " +
+        stringify(the_domain_level.bytes()) + " bytes");
+    }
+
     /* ***************************************************************************************** */
     /* ***************************************************************************************** */
     /* ***************************************************************************************** */
@@ -284,6 +294,7 @@ namespace PoissonDirichlet
     args.support("vtk");
     args.support("statistics");
     args.support("test-iter");
+    args.support("compact-mesh");
 
     // check for unsupported options
     auto unsupported = args.query_unsupported();
@@ -419,7 +419,7 @@ namespace Stokes3Field
     virtual Solver::Status _apply_intern(VectorType& vec_sol, const VectorType& vec_rhs)
     {
       Solver::IterationStats pre_iter(*this);
-      Statistics::add_solver_expression(std::make_shared<Solver::ExpressionStartSolve>(this->name()));
+      Statistics::add_solver_expression<Solver::ExpressionStartSolve>(*this);
 
       VectorType& vec_def(this->_vec_def);
       VectorType& vec_cor(this->_vec_cor);
@@ -439,7 +439,7 @@ namespace Stokes3Field
         // apply preconditioner
         if(!this->_apply_precond(vec_cor, vec_def, filter))
         {
-          Statistics::add_solver_expression(std::make_shared<Solver::ExpressionEndSolve>(this->name(), Solver::Status::aborted, this->get_num_iter()));
+          Statistics::add_solver_expression<Solver::ExpressionEndSolve>(*this, Solver::Status::aborted, this->get_num_iter());
           return Solver::Status::aborted;
         }
         //filter.filter_cor(vec_cor);
@@ -471,7 +471,7 @@ namespace Stokes3Field
       }
 
       // return our status
-      Statistics::add_solver_expression(std::make_shared<Solver::ExpressionEndSolve>(this->name(), status, this->get_num_iter()));
+      Statistics::add_solver_expression<Solver::ExpressionEndSolve>(*this, status, this->get_num_iter());
       return status;
     }
   };
@@ -145,6 +145,8 @@ void run_xml(SimpleArgParser& args, Geometry::MeshFileReader& mesh_reader, const
     strat = Geometry::PermutationStrategy::lexicographic;
   else if((sperm == "color") || (sperm == "colored"))
     strat = Geometry::PermutationStrategy::colored;
+  else if((sperm == "pcolor") || (sperm == "colored-parallel"))
+    strat = Geometry::PermutationStrategy::colored_parallel;
   else if((sperm == "cmk") || (sperm == "acmk"))
     strat = Geometry::PermutationStrategy::cuthill_mckee;
   else if((sperm == "rcmk") || (sperm == "racmk"))
@@ -153,6 +155,8 @@ void run_xml(SimpleArgParser& args, Geometry::MeshFileReader& mesh_reader, const
     strat = Geometry::PermutationStrategy::geometric_cuthill_mckee;
   else if((sperm == "rgcmk"))
     strat = Geometry::PermutationStrategy::geometric_cuthill_mckee_reversed;
+  else if((sperm == "sfc") || (sperm == "hilbert"))
+    strat = Geometry::PermutationStrategy::hilbert;
   else
   {
     std::cout << "ERROR: unknown permutation strategy '" << sperm << "'" << std::endl;
@@ -174,6 +178,9 @@ void run_xml(SimpleArgParser& args, Geometry::MeshFileReader& mesh_reader, const
   case Geometry::PermutationStrategy::colored:
     std::cout << "colored" << std::endl;
     break;
+  case Geometry::PermutationStrategy::colored_parallel:
+    std::cout << "colored (parallel)" << std::endl;
+    break;
   case Geometry::PermutationStrategy::lexicographic:
     std::cout << "lexicographic" << std::endl;
     break;
@@ -189,6 +196,9 @@ void run_xml(SimpleArgParser& args, Geometry::MeshFileReader& mesh_reader, const
   case Geometry::PermutationStrategy::geometric_cuthill_mckee_reversed:
     std::cout << "geometric Cuthill-McKee reversed" << std::endl;
     break;
+  case Geometry::PermutationStrategy::hilbert:
+    std::cout << "Hilbert space-filling curve" << std::endl;
+    break;
   default:
     // make picky compilers STFU
     break;
@@ -331,6 +331,8 @@ namespace StokesMultigridBench
     args.support("steps", "<n>\nSpecifies the number of Jacobi smoothing steps; default: 5");
     args.support("no-shrink", "\nDon't shrink grid transfer matrices (not recommended).");
     args.support("ext-stats", "\nPrint extended solver and MPI statistics.");
+    args.support("perf", "\nEnables the hardware performance counter regions and prints them\n"
+      "along with the extended statistics.");
     args.support("test","\nRuns the benchmark in regression test mode.");
     args.support("backend", "<generic|cuda|mkl>\n"
       "Specifies which backend to use for the actual PCG-GMG solution process; default: generic");
@@ -387,6 +389,10 @@ namespace StokesMultigridBench
     args.parse("iters", multigrid_iters);
     args.parse("steps", smooth_steps);
     bool no_shrink = (args.check("no-shrink") >= 0);
+    bool ext_stats = (args.check("ext-stats") >= 0) || (args.check("perf") >= 0);
+
+    if(args.check("perf") >= 0)
+      PerfCounters::enable();
 
     // choose backend
     args.parse("backend", backend);
@@ -866,7 +872,7 @@ namespace StokesMultigridBench
 
     comm.print(stats.format());
 
-    if(args.check("ext-stats") >= 0)
+    if(ext_stats)
     {
       FEAT::Control::Statistics::report(solver_toe, 0, MeshType::ShapeType::dimension, system, domain);
       comm.print(FEAT::Statistics::get_formatted_solver_internals());
@@ -55,6 +55,23 @@ namespace FEAT
           return _mesh_node->bytes();
         }
 
+        /**
+         * \brief Switches the mesh of this level into compact mode
+         *
+         * This function releases all mesh index sets that are not required for the assembly anymore,
+         * see ConformalMesh::release_index_sets() for details. It is meant to be called for the finest
+         * level after the gates, transfers, matrices and filters have been assembled, because the
+         * mesh cannot be refined or permuted and its boundary cannot be computed anymore afterwards.
+         *
+         * \param[in] keep_faces_at_elem
+         * Specifies whether the faces-at-element index sets are to be kept; these are required by
+         * all spaces which have DOFs on edges or faces.
+         */
+        void release_mesh_index_sets(bool keep_faces_at_elem)
+        {
+          get_mesh().release_index_sets(keep_faces_at_elem);
+        }
+
         int get_level_index() const
         {
           return _level_index;
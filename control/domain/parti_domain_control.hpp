@@ -21,12 +21,15 @@
 #include <kernel/geometry/parti_2lvl.hpp>
 #include <kernel/geometry/parti_iterative.hpp>
 #include <kernel/geometry/parti_parmetis.hpp>
+#include <kernel/geometry/parti_sfc.hpp>
 #include <kernel/geometry/parti_zoltan.hpp>
 #include <kernel/geometry/boundary_factory.hpp>
 #include <kernel/geometry/common_factories.hpp>
 
 #include <control/domain/domain_control.hpp>
 
+#include <functional>
+
 namespace FEAT
 {
   namespace Control
@@ -47,7 +50,8 @@ namespace FEAT
         args.support("parti-type", "<types...>\n"
           "Specifies which partitioner types are allowed to be used.\n"
           "May contain the following types:\n"
-          "2level extern genetic metis naive zoltan"
+          "2level extern genetic metis naive sfc zoltan\n"
+          "The sfc partitioner is only used if it is explicitly listed."
         );
         args.support("parti-extern-name", "<names...>\n"
           "Specifies the names of the allowed extern partitions."
@@ -58,6 +62,9 @@ namespace FEAT
         args.support("parti-genetic-time", "<time-init> <time-mutate>\n"
           "Specifies the time for initial distribution and mutation for the genetic partitioner."
         );
+        args.support("parti-sfc-refine", "<passes>\n"
+          "Specifies the maximum number of interface refinement passes for the SFC partitioner."
+        );
       }
 
       /**
@@ -153,6 +160,8 @@ namespace FEAT
         bool _allow_parti_genetic;
         /// allow naive partitioner?
         bool _allow_parti_naive;
+        /// allow space-filling curve partitioner?
+        bool _allow_parti_sfc;
         /// allow Zoltan partitioner?
         bool _allow_parti_zoltan;
 
@@ -173,6 +182,10 @@ namespace FEAT
         double _genetic_time_init;
         /// time for genetic partitioner mutation
         double _genetic_time_mutate;
+        /// maximum number of interface refinement passes for SFC partitioner
+        int _sfc_refine_passes;
+        /// element weight function for the SFC partitioner; may be empty
+        std::function<Real(const typename MeshType::VertexType&)> _sfc_weight_func;
 
         /// the partition ancestry deque
         std::deque<Ancestor> _ancestry;
@@ -197,6 +210,7 @@ namespace FEAT
           _allow_parti_metis(false),
           _allow_parti_genetic(false), // this one is exotic
           _allow_parti_naive(true),
+          _allow_parti_sfc(false), // opt-in via --parti-type sfc
           _allow_parti_zoltan(false),
           _support_multi_layered(support_multi_layered),
           _desired_levels(),
@@ -204,6 +218,8 @@ namespace FEAT
           _required_elems_per_rank(1),
           _genetic_time_init(5),
           _genetic_time_mutate(5),
+          _sfc_refine_passes(0),
+          _sfc_weight_func(),
           _ancestry()
         {
         }
@@ -237,6 +253,7 @@ namespace FEAT
               _allow_parti_extern = _allow_parti_2level = false;
               _allow_parti_metis = _allow_parti_naive = false;
               _allow_parti_genetic = _allow_parti_zoltan = false;
+              _allow_parti_sfc = false;
 
               // loop over all allowed strategies
               for(const auto& t : it->second)
@@ -251,6 +268,8 @@ namespace FEAT
                   _allow_parti_genetic = true;
                 else if(t.compare_no_case("naive") == 0)
                   _allow_parti_naive = true;
+                else if(t.compare_no_case("sfc") == 0)
+                  _allow_parti_sfc = true;
                 else if(t.compare_no_case("zoltan") == 0)
                   _allow_parti_zoltan = true;
                 else
@@ -275,6 +294,9 @@ namespace FEAT
           // parse --parti-genetic-time <time-init> <time-mutate>
           args.parse("parti-genetic-time", _genetic_time_init, _genetic_time_mutate);
 
+          // parse --parti-sfc-refine <passes>
+          args.parse("parti-sfc-refine", _sfc_refine_passes);
+
           // okay
           return true;
         }
@@ -299,6 +321,7 @@ namespace FEAT
             _allow_parti_extern = _allow_parti_2level = false;
             _allow_parti_metis = _allow_parti_naive = false;
             _allow_parti_genetic = _allow_parti_zoltan = false;
+            _allow_parti_sfc = false;
 
             std::deque<String> allowed_partitioners = parti_type_p.first.split_by_whitespaces();
 
@@ -314,6 +337,8 @@ namespace FEAT
                 _allow_parti_metis = true;
               else if(t == "naive")
                 _allow_parti_naive = true;
+              else if(t == "sfc")
+                _allow_parti_sfc = true;
               else if(t == "zoltan")
                 _allow_parti_zoltan = true;
               else
@@ -360,6 +385,16 @@ namespace FEAT
             }
           }
 
+          auto sfc_refine_p = pmap.query("parti-sfc-refine");
+          if(sfc_refine_p.second)
+          {
+            if(!sfc_refine_p.first.parse(_sfc_refine_passes))
+            {
+              this->_comm.print("ERROR: Failed to parse 'parti-sfc-refine'");
+              return false;
+            }
+          }
+
           return true;
         }
 
@@ -386,6 +421,32 @@ namespace FEAT
           return _adapt_mode;
         }
 
+        /**
+         * \brief Sets the element weight function for the SFC partitioner.
+         *
+         * The SFC partitioner splits the elements into chunks of approximately equal total weight,
+         * where the weight of each element is given by the weight function evaluated in its barycenter.
+         * This can be used to balance the load after a local refinement of the partitioned patches,
+         * e.g. by the Geometry::HangingNodeRefinery: if the weight function returns the number of
+         * fine elements, which each element is going to be refined into, then the patches contain
+         * approximately the same number of elements after the local refinement. A locally refined
+         * domain can thus be repartitioned by creating a new domain control with the corresponding
+         * weight function and refining its patches once again.
+         *
+         * \note
+         * The weight function is ignored by all other partitioners, so the SFC partitioner has to be
+         * selected by the 'parti-type' option.
+         *
+         * \param[in] weight_func
+         * The weight function, which is called with the barycenter of each element of the mesh
+         * that is to be partitioned and which has to return a positive element weight.
+         */
+        void set_sfc_weight_function(std::function<Real(const typename MeshType::VertexType&)> weight_func)
+        {
+          XASSERTM(!_was_created, "This function has to be called before domain control creation!");
+          _sfc_weight_func = std::move(weight_func);
+        }
+
         /**
          * \brief Sets the permutation strategy for mesh permutation.
          *
@@ -1914,6 +1975,8 @@ namespace FEAT
             return true;
           if(this->_apply_parti_genetic(ancestor, base_mesh_node))
             return true;
+          if(this->_apply_parti_sfc(ancestor, base_mesh_node))
+            return true;
           if(this->_apply_parti_naive(ancestor, base_mesh_node))
             return true;
 
@@ -2109,6 +2172,65 @@ namespace FEAT
           return true;
         }
 
+        /**
+         * \brief Applies the space-filling curve partitioner onto the base-mesh.
+         *
+         * \param[inout] ancestor
+         * The ancestor object for this layer.
+         *
+         * \param[in] base_mesh_node
+         * The base-mesh node that is to be partitioned.
+         *
+         * \returns
+         * \c true, if the SFC partitioner was applied successfully, otherwise \c false.
+         */
+        bool _apply_parti_sfc(Ancestor& ancestor, const MeshNodeType& base_mesh_node)
+        {
+          // is this even allowed?
+          if(!this->_allow_parti_sfc)
+            return false;
+
+          // we need at least one element per rank; otherwise let the next partitioner try
+          if(Index(ancestor.num_parts) > base_mesh_node.get_mesh()->get_num_elements())
+            return false;
+
+          // compute the element weights in the element barycenters, if desired
+          const MeshType& mesh = *base_mesh_node.get_mesh();
+          std::vector<Real> weights;
+          if(this->_sfc_weight_func)
+          {
+            static constexpr int num_corners = Shape::FaceTraits<typename MeshType::ShapeType, 0>::count;
+            const auto& vtx = mesh.get_vertex_set();
+            const auto& idx = mesh.template get_index_set<MeshType::shape_dim, 0>();
+            weights.resize(mesh.get_num_elements());
+            for(Index i(0); i < mesh.get_num_elements(); ++i)
+            {
+              typename MeshType::VertexType v;
+              v.format();
+              for(int j(0); j < num_corners; ++j)
+                v += vtx[idx(i, j)];
+              v *= typename MeshType::CoordType(1) / typename MeshType::CoordType(num_corners);
+              weights[i] = this->_sfc_weight_func(v);
+            }
+          }
+
+          // create a SFC partitioner; all processes compute the same partitioning
+          Geometry::PartiSFC<MeshType> partitioner(mesh, Index(ancestor.num_parts), weights);
+
+          // apply interface refinement passes if desired
+          if(this->_sfc_refine_passes > 0)
+            partitioner.refine(Index(this->_sfc_refine_passes));
+
+          // create elems-at-rank graph
+          ancestor.parti_graph = partitioner.build_elems_at_rank();
+
+          // set info string
+          ancestor.parti_info = String("Applied SFC partitioner");
+
+          // okay
+          return true;
+        }
+
         /**
          * \brief Applies the naive partitioner onto the base-mesh.
          *
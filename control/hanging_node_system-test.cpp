@@ -0,0 +1,239 @@
+// FEAT3: Finite Element Analysis Toolbox, Version 3
+// Copyright (C) 2010 - 2023 by Stefan Turek & the FEAT group
+// FEAT3 is released under the GNU General Public License version 3,
+// see the file 'copyright.txt' in the top level directory for details.
+
+#include <test_system/test_system.hpp>
+#include <kernel/analytic/lambda_function.hpp>
+#include <kernel/assembly/bilinear_operator_assembler.hpp>
+#include <kernel/assembly/common_functionals.hpp>
+#include <kernel/assembly/common_operators.hpp>
+#include <kernel/assembly/hanging_node_filter_assembler.hpp>
+#include <kernel/assembly/interpolator.hpp>
+#include <kernel/assembly/linear_functional_assembler.hpp>
+#include <kernel/assembly/mirror_assembler.hpp>
+#include <kernel/assembly/symbolic_assembler.hpp>
+#include <kernel/assembly/unit_filter_assembler.hpp>
+#include <kernel/geometry/conformal_mesh.hpp>
+#include <kernel/geometry/hanging_node_refinery.hpp>
+#include <kernel/global/filter.hpp>
+#include <kernel/global/gate.hpp>
+#include <kernel/global/hanging_node_filter.hpp>
+#include <kernel/global/matrix.hpp>
+#include <kernel/global/vector.hpp>
+#include <kernel/lafem/filter_chain.hpp>
+#include <kernel/lafem/sparse_matrix_csr.hpp>
+#include <kernel/lafem/unit_filter.hpp>
+#include <kernel/lafem/vector_mirror.hpp>
+#include <kernel/solver/jacobi_precond.hpp>
+#include <kernel/solver/pcg.hpp>
+#include <kernel/space/lagrange1/element.hpp>
+#include <kernel/space/lagrange2/element.hpp>
+#include <kernel/trafo/standard/mapping.hpp>
+#include <control/domain/parti_domain_control.hpp>
+
+using namespace FEAT;
+using namespace FEAT::TestSystem;
+
+/**
+ * \brief Test class for locally refined partitioned domains.
+ *
+ * \test Partitions a domain by the SFC partitioner weighted by the number of fine elements of
+ * a local refinement, refines the patches locally by the Geometry::HangingNodeRefinery and solves
+ * Poisson problems, whose linear or quadratic solutions are contained in the conforming Lagrange-1
+ * or Lagrange-2 spaces, by a gate-synchronized PCG-Jacobi solver with a Global::HangingNodeFilter.
+ */
+template<typename DataType_, typename IndexType_>
+class HangingNodeSystemTest :
+  public UnitTest
+{
+  typedef Geometry::ConformalMesh<Shape::Quadrilateral, 2, DataType_> MeshType;
+  typedef Geometry::RootMeshNode<MeshType> MeshNodeType;
+  typedef Geometry::HangingNodeRefinery<MeshType> RefineryType;
+  typedef Trafo::Standard::Mapping<MeshType> TrafoType;
+  typedef Space::Lagrange1::Element<TrafoType> SpaceType;
+  typedef Control::Domain::SimpleDomainLevel<MeshType, TrafoType, SpaceType> DomainLevelType;
+  typedef Control::Domain::PartiDomainControl<DomainLevelType> DomainControlType;
+
+  typedef LAFEM::DenseVector<DataType_, IndexType_> LocalVectorType;
+  typedef LAFEM::SparseMatrixCSR<DataType_, IndexType_> LocalMatrixType;
+  typedef LAFEM::VectorMirror<DataType_, IndexType_> MirrorType;
+  typedef LAFEM::UnitFilter<DataType_, IndexType_> UnitFilterType;
+  typedef Global::HangingNodeFilter<DataType_, IndexType_> HangingFilterType;
+  typedef LAFEM::FilterChain<UnitFilterType, HangingFilterType> LocalFilterType;
+  typedef Global::Gate<LocalVectorType, MirrorType> GateType;
+  typedef Global::Vector<LocalVectorType, MirrorType> GlobalVectorType;
+  typedef Global::Matrix<LocalMatrixType, MirrorType, MirrorType> GlobalMatrixType;
+  typedef Global::Filter<LocalFilterType, MirrorType> GlobalFilterType;
+
+public:
+  HangingNodeSystemTest() :
+    UnitTest("HangingNodeSystemTest", Type::Traits<DataType_>::name(), Type::Traits<IndexType_>::name())
+  {
+  }
+
+  virtual ~HangingNodeSystemTest()
+  {
+  }
+
+  /// the refinement region of the i-th local refinement step
+  static bool refine_region(const typename MeshType::VertexType& p, int step)
+  {
+    return p.norm_euclid() < (step == 0 ? DataType_(0.5) : DataType_(0.3));
+  }
+
+  /// the SFC partitioner weight, i.e. the approximate number of fine elements of each element
+  static Real parti_weight(const typename MeshType::VertexType& p)
+  {
+    return refine_region(p, 0) ? (refine_region(p, 1) ? Real(16) : Real(4)) : Real(1);
+  }
+
+  template<typename Space_, typename Function_>
+  void test_system(const Dist::Comm& comm, MeshNodeType& mesh_node, const Adjacency::Graph& hanging,
+    const Function_& function) const
+  {
+    const DataType_ tol = Math::pow(Math::eps<DataType_>(), DataType_(0.6));
+    TrafoType trafo(*mesh_node.get_mesh());
+    Space_ space(trafo);
+
+    // assemble the gate on the refined halos
+    GateType gate(comm);
+    for(const auto& halo : mesh_node.get_halo_map())
+    {
+      MirrorType mirror;
+      Assembly::MirrorAssembler::assemble_mirror(mirror, space, *halo.second);
+      gate.push(halo.first, std::move(mirror));
+    }
+    gate.compile(LocalVectorType(space.get_num_dofs()));
+
+    // assemble the type-0 Laplace matrix and the type-1 right-hand side -laplace(u)
+    GlobalMatrixType matrix(&gate, &gate);
+    Assembly::SymbolicAssembler::assemble_matrix_std1(matrix.local(), space);
+    matrix.local().format();
+    Assembly::Common::LaplaceOperator laplace;
+    Assembly::BilinearOperatorAssembler::assemble_matrix1(matrix.local(), laplace, space, Cubature::DynamicFactory("gauss-legendre:3"));
+    GlobalVectorType vec_rhs = matrix.create_vector_r();
+    vec_rhs.format();
+    Assembly::Common::LaplaceFunctional<Function_> functional(function);
+    Assembly::LinearFunctionalAssembler::assemble_vector(vec_rhs.local(), functional, space, Cubature::DynamicFactory("gauss-legendre:3"));
+    vec_rhs.sync_0();
+
+    GlobalVectorType vec_exact = matrix.create_vector_r();
+    Assembly::Interpolator::project(vec_exact.local(), function, space);
+
+    // assemble the Dirichlet filter on the refined boundary and the hanging-node filter
+    UnitFilterType unit_filter;
+    Assembly::UnitFilterAssembler<MeshType> unit_asm;
+    if(mesh_node.find_mesh_part("bnd") != nullptr)
+      unit_asm.add_mesh_part(*mesh_node.find_mesh_part("bnd"));
+    unit_asm.assemble(unit_filter, space, vec_exact.local());
+    LAFEM::HangingNodeFilter<DataType_, IndexType_> local_hanging_filter;
+    Assembly::HangingNodeFilterAssembler::assemble(local_hanging_filter, space, hanging, unit_filter);
+    GlobalFilterType filter(std::move(unit_filter), HangingFilterType(std::move(local_hanging_filter), &gate));
+
+    // the hanging vertices near the origin are constrained by masters shared with other patches
+    if(comm.size() > 1)
+    {
+      TEST_CHECK(filter.local().template at<1>().get_sync());
+    }
+
+    // the interpolant of the solution is a fix-point of the solution filter
+    {
+      GlobalVectorType vec_tmp = vec_exact.clone();
+      filter.filter_sol(vec_tmp);
+      vec_tmp.axpy(vec_exact, vec_tmp, -DataType_(1));
+      TEST_CHECK_EQUAL_WITHIN_EPS(vec_tmp.max_abs_element(), DataType_(0), tol);
+    }
+
+    // precondition by the diagonal of the filtered matrix
+    GlobalMatrixType matrix_filtered(&gate, &gate, matrix.local().clone());
+    filter.local().filter_mat(matrix_filtered.local());
+
+    GlobalVectorType vec_sol = matrix.create_vector_r();
+    vec_sol.format();
+    filter.filter_sol(vec_sol);
+    filter.filter_rhs(vec_rhs);
+
+    auto solver = Solver::new_pcg(matrix, filter, Solver::new_jacobi_precond(matrix_filtered, filter));
+    solver->set_tol_rel(tol);
+    solver->set_max_iter(1000);
+    solver->init();
+    TEST_CHECK(Solver::status_success(Solver::solve(*solver, vec_sol, vec_rhs, matrix, filter)));
+    solver->done();
+
+    // the solution is contained in the conforming space, so it must be reproduced exactly
+    vec_sol.axpy(vec_exact, vec_sol, -DataType_(1));
+    TEST_CHECK_EQUAL_WITHIN_EPS(vec_sol.max_abs_element(), DataType_(0), DataType_(100) * tol);
+  }
+
+  virtual void run() const override
+  {
+    Dist::Comm comm = Dist::Comm::world();
+
+    // partition the unit square by the weighted SFC partitioner
+    PropertyMap pmap;
+    pmap.add_entry("parti-type", "sfc");
+    DomainControlType domain(comm, true);
+    TEST_CHECK(domain.parse_property_map(pmap));
+    domain.set_sfc_weight_function(parti_weight);
+    domain.set_desired_levels(1, 0);
+    domain.create_rectilinear(4, 4);
+
+    // the total weights of all patches on the partitioning level are balanced
+    {
+      const MeshType& mesh = domain.back()->get_mesh();
+      const auto& vtx = mesh.get_vertex_set();
+      const auto& idx = mesh.template get_index_set<2, 0>();
+      Real weights[2] = {Real(0), Real(0)};
+      for(Index i(0); i < mesh.get_num_elements(); ++i)
+      {
+        typename MeshType::VertexType v = DataType_(0.25) * (vtx[idx(i,0)] + vtx[idx(i,1)] + vtx[idx(i,2)] + vtx[idx(i,3)]);
+        weights[0] += parti_weight(v);
+      }
+      weights[1] = weights[0];
+      comm.allreduce(&weights[0], &weights[0], std::size_t(1), Dist::op_sum);
+      comm.allreduce(&weights[1], &weights[1], std::size_t(1), Dist::op_max);
+      TEST_CHECK(weights[1] <= weights[0] / Real(comm.size()) + Real(16));
+    }
+
+    // refine the finest patch locally twice; the halos are refined consistently
+    const Dist::Comm& layer_comm = domain.front().layer().comm();
+    MeshNodeType* coarse_node = domain.front()->get_mesh_node();
+    std::unique_ptr<MeshNodeType> mesh_node;
+    Adjacency::Graph parents;
+    for(int step(0); step < 2; ++step)
+    {
+      std::vector<int> marker = RefineryType::mark_elements(*coarse_node->get_mesh(),
+        [step](const typename MeshType::VertexType& p) {return refine_region(p, step);});
+      RefineryType refinery(layer_comm, *coarse_node, marker, parents);
+      std::unique_ptr<MeshNodeType> fine_node = refinery.refine_node(*coarse_node);
+      parents = refinery.get_vertex_parents();
+      mesh_node = std::move(fine_node);
+      coarse_node = mesh_node.get();
+    }
+    TEST_CHECK_EQUAL(mesh_node->get_halo_map().size(), domain.front()->get_mesh_node()->get_halo_map().size());
+    Adjacency::Graph hanging = RefineryType::compute_hanging_vertices(*mesh_node->get_mesh(), parents);
+
+    // solve a linear problem in the Q1 space
+    auto linear = Analytic::create_lambda_function_scalar_2d(
+      [](DataType_ x, DataType_ y) {return DataType_(1) + x + DataType_(2) * y;},
+      [](DataType_, DataType_) {return DataType_(1);},
+      [](DataType_, DataType_) {return DataType_(2);},
+      [](DataType_, DataType_) {return DataType_(0);},
+      [](DataType_, DataType_) {return DataType_(0);},
+      [](DataType_, DataType_) {return DataType_(0);});
+    test_system<Space::Lagrange1::Element<TrafoType>>(layer_comm, *mesh_node, hanging, linear);
+
+    // solve a quadratic problem in the Q2 space
+    auto quadratic = Analytic::create_lambda_function_scalar_2d(
+      [](DataType_ x, DataType_ y) {return x*x + x*y + DataType_(2)*y*y - x;},
+      [](DataType_ x, DataType_ y) {return DataType_(2)*x + y - DataType_(1);},
+      [](DataType_ x, DataType_ y) {return x + DataType_(4)*y;},
+      [](DataType_, DataType_) {return DataType_(2);},
+      [](DataType_, DataType_) {return DataType_(4);},
+      [](DataType_, DataType_) {return DataType_(1);});
+    test_system<Space::Lagrange2::Element<TrafoType>>(layer_comm, *mesh_node, hanging, quadratic);
+  }
+};
+
+HangingNodeSystemTest<double, Index> hanging_node_system_test_double_index;
@@ -0,0 +1,174 @@
+// FEAT3: Finite Element Analysis Toolbox, Version 3
+// Copyright (C) 2010 - 2023 by Stefan Turek & the FEAT group
+// FEAT3 is released under the GNU General Public License version 3,
+// see the file 'copyright.txt' in the top level directory for details.
+
+#include <test_system/test_system.hpp>
+#include <kernel/assembly/macro_structured_assembler.hpp>
+#include <kernel/assembly/common_operators.hpp>
+#include <kernel/geometry/conformal_mesh.hpp>
+#include <kernel/trafo/standard/mapping.hpp>
+#include <kernel/space/lagrange1/element.hpp>
+#include <kernel/lafem/none_filter.hpp>
+#include <kernel/global/filter.hpp>
+#include <kernel/solver/pcg.hpp>
+#include <kernel/solver/jacobi_precond.hpp>
+#include <kernel/solver/richardson.hpp>
+#include <kernel/solver/multigrid.hpp>
+#include <control/domain/parti_domain_control.hpp>
+#include <control/scalar_basic.hpp>
+
+using namespace FEAT;
+using namespace FEAT::TestSystem;
+
+/**
+ * \brief Test class for the macro-structured system levels.
+ *
+ * \test Assembles a hierarchy of macro-structured system levels on the patch of a
+ * partitioned domain, whose gates and transfers are assembled by the
+ * ScalarBasicSystemLevel::assemble_macro_structured_gate() and
+ * ScalarBasicSystemLevel::assemble_macro_structured_transfer() functions, and solves
+ * a system by a gate-synchronized PCG-Jacobi solver and by multigrid.
+ */
+template<typename DataType_, typename IndexType_>
+class MacroStructuredSystemTest :
+  public UnitTest
+{
+  typedef Geometry::ConformalMesh<Shape::Quadrilateral, 2, DataType_> MeshType;
+  typedef Trafo::Standard::Mapping<MeshType> TrafoType;
+  typedef Space::Lagrange1::Element<TrafoType> SpaceType;
+  typedef Control::Domain::SimpleDomainLevel<MeshType, TrafoType, SpaceType> DomainLevelType;
+  typedef Control::Domain::PartiDomainControl<DomainLevelType> DomainControlType;
+
+  typedef LAFEM::MacroStructuredMatrix<DataType_, IndexType_> MacroMatrixType;
+  typedef Control::ScalarBasicSystemLevel<DataType_, IndexType_, MacroMatrixType> SystemLevelType;
+  typedef typename SystemLevelType::GlobalSystemVector GlobalVectorType;
+  typedef typename SystemLevelType::GlobalSystemMatrix GlobalMatrixType;
+  typedef typename SystemLevelType::GlobalSystemTransfer GlobalTransferType;
+  typedef Global::Filter<LAFEM::NoneFilter<DataType_, IndexType_>, typename SystemLevelType::SystemMirror> GlobalFilterType;
+
+public:
+  MacroStructuredSystemTest() :
+    UnitTest("MacroStructuredSystemTest", Type::Traits<DataType_>::name(), Type::Traits<IndexType_>::name())
+  {
+  }
+
+  virtual ~MacroStructuredSystemTest()
+  {
+  }
+
+  static DataType_ func(const Tiny::Vector<DataType_, 2>& x)
+  {
+    return Math::sin(DataType_(3) * x[0]) + Math::cos(DataType_(2) * x[1]);
+  }
+
+  virtual void run() const override
+  {
+    const DataType_ tol = Math::pow(Math::eps<DataType_>(), DataType_(0.4));
+    const Index num_levels(3);
+
+    // partition a refined unit square; all macro-structured levels share the local patch as base mesh
+    Dist::Comm comm = Dist::Comm::world();
+    DomainControlType domain(comm, true);
+    domain.set_desired_levels(1, 0);
+    domain.create_rectilinear(4, 4);
+    const auto& virt_lvl = domain.front();
+    const MeshType& patch_mesh = virt_lvl->get_mesh();
+
+    // assemble Laplace + mass matrices, gates and transfers on all levels, finest level first
+    Assembly::Common::LaplaceOperator laplace;
+    Assembly::Common::IdentityOperator identity;
+    std::deque<std::shared_ptr<SystemLevelType>> system;
+    for(Index lvl(0); lvl < num_levels; ++lvl)
+    {
+      system.push_back(std::make_shared<SystemLevelType>());
+      MacroMatrixType& mat = system.back()->matrix_sys.local();
+      Assembly::MacroStructuredAssembler::assemble_structure(mat, patch_mesh, Index(1) << (num_levels + 1u - lvl));
+      Assembly::MacroStructuredAssembler::assemble_bilinear_operator(mat, laplace, patch_mesh, "gauss-legendre:2");
+      Assembly::MacroStructuredAssembler::assemble_bilinear_operator(mat, identity, patch_mesh, "gauss-legendre:2", DataType_(0.1));
+      system.back()->assemble_macro_structured_gate(virt_lvl);
+    }
+    for(Index lvl(0); lvl + 1u < num_levels; ++lvl)
+      system.at(lvl)->assemble_macro_structured_transfer(*system.at(lvl+1u));
+
+    // the global prolongation must reproduce the bilinear coordinate functions
+    for(Index lvl(0); lvl + 1u < num_levels; ++lvl)
+    {
+      std::vector<Tiny::Vector<DataType_, 2>> coords_f, coords_c;
+      Assembly::MacroStructuredAssembler::compute_dof_coords(coords_f, system.at(lvl)->matrix_sys.local(), patch_mesh);
+      Assembly::MacroStructuredAssembler::compute_dof_coords(coords_c, system.at(lvl+1u)->matrix_sys.local(), patch_mesh);
+      GlobalVectorType vec_f = system.at(lvl)->matrix_sys.create_vector_r();
+      GlobalVectorType vec_c = system.at(lvl+1u)->matrix_sys.create_vector_r();
+      for(int k(0); k < 2; ++k)
+      {
+        for(Index i(0); i < vec_c.local().size(); ++i)
+          vec_c.local()(i, coords_c[i][k]);
+        system.at(lvl)->transfer_sys.prol(vec_f, vec_c);
+        for(Index i(0); i < vec_f.local().size(); ++i)
+        {
+          TEST_CHECK_EQUAL_WITHIN_EPS(vec_f.local()(i), coords_f[i][k], tol);
+        }
+      }
+    }
+
+    // create the reference solution and the corresponding type-1 right-hand side
+    const GlobalMatrixType& matrix = system.front()->matrix_sys;
+    GlobalFilterType filter;
+    std::vector<Tiny::Vector<DataType_, 2>> coords;
+    Assembly::MacroStructuredAssembler::compute_dof_coords(coords, matrix.local(), patch_mesh);
+    GlobalVectorType vec_ref = matrix.create_vector_r();
+    GlobalVectorType vec_rhs = matrix.create_vector_r();
+    GlobalVectorType vec_sol = matrix.create_vector_r();
+    for(Index i(0); i < vec_ref.local().size(); ++i)
+      vec_ref.local()(i, func(coords[i]));
+    matrix.apply(vec_rhs, vec_ref);
+
+    // solve by gate-synchronized PCG-Jacobi
+    {
+      auto solver = Solver::new_pcg(matrix, filter, Solver::new_jacobi_precond(matrix, filter));
+      solver->set_tol_rel(Math::pow(Math::eps<DataType_>(), DataType_(0.7)));
+      solver->set_max_iter(1000);
+      solver->init();
+      vec_sol.format();
+      TEST_CHECK(Solver::status_success(solver->correct(vec_sol, vec_rhs)));
+      solver->done();
+      vec_sol.axpy(vec_ref, vec_sol, -DataType_(1));
+      TEST_CHECK_EQUAL_WITHIN_EPS(vec_sol.max_abs_element(), DataType_(0), tol);
+    }
+
+    // solve by multigrid with Richardson-Jacobi smoothers and a PCG coarse grid solver
+    {
+      auto hierarchy = std::make_shared<Solver::MultiGridHierarchy<GlobalMatrixType, GlobalFilterType, GlobalTransferType>>(num_levels);
+      for(Index lvl(0); lvl + 1u < num_levels; ++lvl)
+      {
+        const SystemLevelType& sys_lvl = *system.at(lvl);
+        auto smoother = Solver::new_richardson(sys_lvl.matrix_sys, filter, DataType_(0.7),
+          Solver::new_jacobi_precond(sys_lvl.matrix_sys, filter));
+        smoother->set_min_iter(4);
+        smoother->set_max_iter(4);
+        hierarchy->push_level(sys_lvl.matrix_sys, filter, sys_lvl.transfer_sys, smoother, smoother, smoother);
+      }
+      auto coarse_solver = Solver::new_pcg(system.back()->matrix_sys, filter);
+      coarse_solver->set_tol_rel(Math::pow(Math::eps<DataType_>(), DataType_(0.8)));
+      coarse_solver->set_max_iter(1000);
+      hierarchy->push_level(system.back()->matrix_sys, filter, coarse_solver);
+
+      auto multigrid = Solver::new_multigrid(hierarchy, Solver::MultiGridCycle::V);
+      auto solver = Solver::new_richardson(matrix, filter, DataType_(1), multigrid);
+      solver->set_tol_rel(Math::pow(Math::eps<DataType_>(), DataType_(0.7)));
+      solver->set_max_iter(30);
+
+      hierarchy->init();
+      solver->init();
+      vec_sol.format();
+      TEST_CHECK(Solver::status_success(solver->correct(vec_sol, vec_rhs)));
+      TEST_CHECK(solver->get_num_iter() < Index(20));
+      solver->done();
+      hierarchy->done();
+      vec_sol.axpy(vec_ref, vec_sol, -DataType_(1));
+      TEST_CHECK_EQUAL_WITHIN_EPS(vec_sol.max_abs_element(), DataType_(0), tol);
+    }
+  }
+};
+
+MacroStructuredSystemTest<double, Index> macro_structured_system_test_double_index;
@@ -33,6 +33,7 @@
 #include <kernel/assembly/mirror_assembler.hpp>
 #include <kernel/assembly/mean_filter_assembler.hpp>
 #include <kernel/assembly/unit_filter_assembler.hpp>
+#include <kernel/assembly/macro_structured_assembler.hpp>
 #include <kernel/solver/base.hpp>
 #include <kernel/solver/iterative.hpp>
 #include <kernel/util/property_map.hpp>
@@ -180,6 +181,38 @@ namespace FEAT
         assemble_gate(virt_dom_lvl, virt_dom_lvl->space);
       }
 
+      /// assembles the gate of a macro-structured system matrix, whose base mesh is given by the domain level
+      template<typename DomainLevel_>
+      void assemble_macro_structured_gate(const Domain::VirtualLevel<DomainLevel_>& virt_dom_lvl)
+      {
+        const auto& dom_level = virt_dom_lvl.level();
+        const auto& dom_layer = virt_dom_lvl.layer();
+        const LocalSystemMatrix& loc_matrix = this->matrix_sys.local();
+
+        // set the gate comm
+        this->gate_sys.set_comm(dom_layer.comm_ptr());
+
+        // loop over all ranks
+        for(Index i(0); i < dom_layer.neighbor_count(); ++i)
+        {
+          int rank = dom_layer.neighbor_rank(i);
+
+          // try to find our halo
+          auto* halo = dom_level.find_halo_part(rank);
+          XASSERT(halo != nullptr);
+
+          // assemble the mirror of the base mesh halo
+          SystemMirror mirror_sys;
+          Assembly::MacroStructuredAssembler::assemble_mirror(mirror_sys, loc_matrix, dom_level.get_mesh(), *halo);
+
+          // push mirror into gate
+          this->gate_sys.push(rank, std::move(mirror_sys));
+        }
+
+        // compile gate
+        this->gate_sys.compile(loc_matrix.create_vector_l());
+      }
+
       template<typename DomainLevel_>
       void assemble_coarse_muxer(const Domain::VirtualLevel<DomainLevel_>& virt_lvl_coarse)
       {
@@ -330,6 +363,41 @@ namespace FEAT
         transfer_sys.compile();
       }
 
+      /// assembles the transfer between two macro-structured system matrices over the same base mesh; requires the gate of this level
+      void assemble_macro_structured_transfer(const ScalarBasicSystemLevel& sys_lvl_coarse)
+      {
+        // get local transfer operator
+        LocalSystemTransfer& loc_trans = this->transfer_sys.local();
+
+        // get local transfer matrices
+        LocalSystemTransferMatrix& loc_prol = loc_trans.get_mat_prol();
+        LocalSystemTransferMatrix& loc_rest = loc_trans.get_mat_rest();
+
+        // assemble prolongation matrix
+        Assembly::MacroStructuredAssembler::assemble_prolongation(loc_prol,
+          this->matrix_sys.local(), sys_lvl_coarse.matrix_sys.local());
+
+        // the global prolongation sums up the prolongated shared DOFs, so each process has to
+        // scale its rows by the inverse number of processes which share the corresponding DOF
+        LocalSystemVector loc_vec_weight = loc_prol.create_vector_l();
+        loc_vec_weight.format(DataType(1));
+
+        // synchronize weight vector using the gate
+        this->gate_sys.sync_0(loc_vec_weight);
+
+        // invert components
+        loc_vec_weight.component_invert(loc_vec_weight);
+
+        // scale prolongation matrix
+        loc_prol.scale_rows(loc_prol, loc_vec_weight);
+
+        // copy and transpose
+        loc_rest = loc_prol.transpose();
+
+        // compile global transfer
+        transfer_sys.compile();
+      }
+
       template<typename DomainLevel_, typename Cubature_>
       void assemble_truncation(
         const Domain::VirtualLevel<DomainLevel_>& virt_lvl_fine,
@@ -0,0 +1,238 @@
+// FEAT3: Finite Element Analysis Toolbox, Version 3
+// Copyright (C) 2010 - 2023 by Stefan Turek & the FEAT group
+// FEAT3 is released under the GNU General Public License version 3,
+// see the file 'copyright.txt' in the top level directory for details.
+
+#include <kernel/base_header.hpp>
+#include <control/time/solution_predictor.hpp>
+#include <kernel/lafem/dense_vector.hpp>
+#include <kernel/lafem/sparse_matrix_csr.hpp>
+#include <kernel/lafem/pointstar_factory.hpp>
+#include <kernel/lafem/vector_mirror.hpp>
+#include <kernel/global/gate.hpp>
+#include <kernel/global/matrix.hpp>
+#include <kernel/global/vector.hpp>
+#include <test_system/test_system.hpp>
+
+using namespace FEAT;
+using namespace FEAT::TestSystem;
+
+/**
+ * \brief Test class for the solution predictor class.
+ *
+ * \test Tests the extrapolation, least-squares and projection predictions of the
+ * Control::Time::SolutionPredictor class template for polynomial solution trajectories.
+ */
+template<typename DT_, typename IT_>
+class SolutionPredictorTest
+  : public UnitTest
+{
+public:
+  typedef LAFEM::DenseVector<DT_, IT_> VectorType;
+  typedef Control::Time::SolutionPredictor<VectorType> PredictorType;
+
+  SolutionPredictorTest(PreferredBackend backend)
+    : UnitTest("SolutionPredictorTest", Type::Traits<DT_>::name(), Type::Traits<IT_>::name(), backend)
+  {
+  }
+
+  virtual ~SolutionPredictorTest()
+  {
+  }
+
+  /// evaluates the quadratic trajectory u_i(t) := a_i + b_i*t + c_i*t^2
+  static void eval_sol(VectorType& vec, DT_ t)
+  {
+    for(Index i(0); i < vec.size(); ++i)
+    {
+      const DT_ x = DT_(i+1) / DT_(vec.size());
+      vec(i, DT_(1) + x + Math::sin(DT_(3)*x) * t - x*x * t*t);
+    }
+  }
+
+  DT_ compute_error(const VectorType& vec, DT_ t) const
+  {
+    VectorType vec_ref(vec.size());
+    eval_sol(vec_ref, t);
+    vec_ref.axpy(vec, vec_ref, -DT_(1));
+    return vec_ref.max_abs_element();
+  }
+
+  virtual void run() const override
+  {
+    const DT_ tol = Math::pow(Math::eps<DT_>(), DT_(0.6));
+    const Index n(49);
+
+    VectorType vec_sol(n), vec_pred(n, DT_(0));
+
+    // non-equidistant time stamps
+    const DT_ times[] = {DT_(0), DT_(0.1), DT_(0.25), DT_(0.35), DT_(0.5), DT_(0.6), DT_(0.72)};
+
+    // quadratic extrapolation must be exact once three solutions are available
+    PredictorType predictor(Index(3), Index(2));
+    TEST_CHECK(predictor.empty());
+    TEST_CHECK(!predictor.predict(vec_pred, times[0]));
+    for(int k(0); k+1 < 7; ++k)
+    {
+      eval_sol(vec_sol, times[k]);
+      predictor.push(vec_sol, times[k]);
+      TEST_CHECK(predictor.predict(vec_pred, times[k+1]));
+      if(k >= 2)
+      {
+        TEST_CHECK_EQUAL_WITHIN_EPS(compute_error(vec_pred, times[k+1]), DT_(0), tol);
+      }
+    }
+    TEST_CHECK_EQUAL(predictor.size(), Index(3));
+    TEST_CHECK_EQUAL_WITHIN_EPS(predictor.get_time(Index(0)), times[5], tol);
+    TEST_CHECK_EQUAL_WITHIN_EPS(predictor.get_time(Index(2)), times[3], tol);
+
+    // check the classic equidistant weights 3, -3, 1
+    std::vector<DT_> coeffs;
+    predictor.clear();
+    for(int k(0); k < 3; ++k)
+      predictor.push(vec_sol, DT_(k));
+    TEST_CHECK(predictor.compute_coeffs(coeffs, DT_(3)));
+    TEST_CHECK_EQUAL(coeffs.size(), std::size_t(3));
+    TEST_CHECK_EQUAL_WITHIN_EPS(coeffs[0], DT_(3), tol);
+    TEST_CHECK_EQUAL_WITHIN_EPS(coeffs[1], -DT_(3), tol);
+    TEST_CHECK_EQUAL_WITHIN_EPS(coeffs[2], DT_(1), tol);
+
+    // quadratic least-squares fit over five solutions is also exact for a quadratic trajectory
+    predictor.configure(Index(5), Index(2), Control::Time::PredictorType::least_squares);
+    TEST_CHECK(predictor.empty());
+    for(int k(0); k+1 < 7; ++k)
+    {
+      eval_sol(vec_sol, times[k]);
+      predictor.push(vec_sol, times[k]);
+    }
+    TEST_CHECK_EQUAL(predictor.size(), Index(5));
+    TEST_CHECK(predictor.compute_coeffs(coeffs, times[6]));
+    TEST_CHECK_EQUAL(coeffs.size(), std::size_t(5));
+    TEST_CHECK(predictor.predict(vec_pred, times[6]));
+    TEST_CHECK_EQUAL_WITHIN_EPS(compute_error(vec_pred, times[6]), DT_(0), tol);
+
+    // linear least-squares fit: the coefficients must reproduce constant and linear functions
+    predictor.configure(Index(5), Index(1), Control::Time::PredictorType::least_squares);
+    TEST_CHECK(predictor.compute_coeffs(coeffs, times[6]));
+    DT_ sum_c(0), sum_ct(0);
+    for(Index i(0); i < predictor.size(); ++i)
+    {
+      sum_c += coeffs[i];
+      sum_ct += coeffs[i] * predictor.get_time(i);
+    }
+    TEST_CHECK_EQUAL_WITHIN_EPS(sum_c, DT_(1), tol);
+    TEST_CHECK_EQUAL_WITHIN_EPS(sum_ct, times[6], tol);
+
+    // projection: if the right-hand-side is given by a solution in the span of the history,
+    // then the minimal residual projection must recover that solution
+    LAFEM::PointstarFactoryFD<DT_, IT_> psf(Index(7), Index(2));
+    LAFEM::SparseMatrixCSR<DT_, IT_> matrix = psf.matrix_csr();
+    VectorType vec_rhs(n);
+    eval_sol(vec_sol, times[6]);
+    matrix.apply(vec_rhs, vec_sol);
+    predictor.configure(Index(5), Index(2), Control::Time::PredictorType::extrapolation);
+    TEST_CHECK(predictor.predict_projected(vec_pred, matrix, vec_rhs, times[6]));
+    TEST_CHECK_EQUAL_WITHIN_EPS(compute_error(vec_pred, times[6]), DT_(0), Math::sqrt(tol));
+
+    // linearly dependent history must fall back to the polynomial prediction
+    predictor.clear();
+    predictor.push(vec_sol, DT_(1));
+    predictor.push(vec_sol, DT_(2));
+    TEST_CHECK(predictor.predict_projected(vec_pred, matrix, vec_rhs, DT_(3)));
+    TEST_CHECK_EQUAL_WITHIN_EPS(compute_error(vec_pred, times[6]), DT_(0), tol);
+  }
+};
+
+SolutionPredictorTest<float, unsigned int> solution_predictor_test_float_uint(PreferredBackend::generic);
+SolutionPredictorTest<double, unsigned long> solution_predictor_test_double_ulong(PreferredBackend::generic);
+
+/**
+ * \brief Test class for the solution predictor class with global vectors.
+ *
+ * \test Tests the projection prediction of the Control::Time::SolutionPredictor class template
+ * with a type-0 right-hand-side on a chain of processes, which share one dof with each neighbor.
+ */
+template<typename DT_, typename IT_>
+class SolutionPredictorGlobalTest
+  : public UnitTest
+{
+public:
+  typedef LAFEM::DenseVector<DT_, IT_> LocalVectorType;
+  typedef LAFEM::SparseMatrixCSR<DT_, IT_> LocalMatrixType;
+  typedef LAFEM::VectorMirror<DT_, IT_> MirrorType;
+  typedef Global::Gate<LocalVectorType, MirrorType> GateType;
+  typedef Global::Vector<LocalVectorType, MirrorType> VectorType;
+  typedef Global::Matrix<LocalMatrixType, MirrorType, MirrorType> MatrixType;
+  typedef Control::Time::SolutionPredictor<VectorType> PredictorType;
+
+  SolutionPredictorGlobalTest(PreferredBackend backend)
+    : UnitTest("SolutionPredictorGlobalTest", Type::Traits<DT_>::name(), Type::Traits<IT_>::name(), backend)
+  {
+  }
+
+  virtual ~SolutionPredictorGlobalTest()
+  {
+  }
+
+  static MirrorType create_mirror(const Index n, const Index k)
+  {
+    MirrorType mirror(n, Index(1));
+    mirror.indices()[0] = IT_(k);
+    return mirror;
+  }
+
+  /// evaluates the quadratic trajectory u(x,t) := 1 + x + sin(3x)*t - x^2*t^2 in the global dofs
+  static void eval_sol(VectorType& vec, DT_ t)
+  {
+    const Dist::Comm& comm = *vec.get_comm();
+    LocalVectorType& loc = vec.local();
+    const Index n = loc.size();
+    const DT_ h = DT_(1) / DT_(Index(comm.size()) * (n - 1u));
+    for(Index i(0); i < n; ++i)
+    {
+      const DT_ x = h * DT_(Index(comm.rank()) * (n - 1u) + i);
+      loc(i, DT_(1) + x + Math::sin(DT_(3)*x) * t - x*x * t*t);
+    }
+  }
+
+  virtual void run() const override
+  {
+    const DT_ tol = Math::pow(Math::eps<DT_>(), DT_(0.3));
+    const Dist::Comm comm = Dist::Comm::world();
+    const Index n(17);
+
+    // create a gate for a chain of processes
+    GateType gate(comm);
+    if(comm.rank() > 0)
+      gate.push(comm.rank() - 1, create_mirror(n, Index(0)));
+    if(comm.rank() + 1 < comm.size())
+      gate.push(comm.rank() + 1, create_mirror(n, n - 1u));
+    gate.compile(LocalVectorType(n));
+
+    // the global matrix is the sum of the local 1D Laplace matrices
+    LAFEM::PointstarFactoryFD<DT_, IT_> psf(n, Index(1));
+    MatrixType matrix(&gate, &gate, psf.matrix_csr());
+
+    VectorType vec_sol(&gate, n), vec_pred(&gate, n, DT_(0)), vec_rhs(&gate, n);
+
+    const DT_ times[] = {DT_(0), DT_(0.1), DT_(0.25), DT_(0.35)};
+
+    PredictorType predictor(Index(3), Index(2));
+    for(int k(0); k < 3; ++k)
+    {
+      eval_sol(vec_sol, times[k]);
+      predictor.push(vec_sol, times[k]);
+    }
+
+    // assemble a type-0 rhs b := A*u(t) by a local matrix-vector product without synchronization
+    eval_sol(vec_sol, times[3]);
+    matrix.local().apply(vec_rhs.local(), vec_sol.local());
+
+    // u(t) lies in the span of the history, so the projection must recover it
+    TEST_CHECK(predictor.predict_projected(vec_pred, matrix, vec_rhs, times[3]));
+    vec_pred.axpy(vec_sol, vec_pred, -DT_(1));
+    TEST_CHECK_EQUAL_WITHIN_EPS(vec_pred.max_abs_element(), DT_(0), tol);
+  }
+};
+
+SolutionPredictorGlobalTest<double, unsigned long> solution_predictor_global_test_double_ulong(PreferredBackend::generic);
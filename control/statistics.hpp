@@ -11,6 +11,7 @@
 #include <kernel/util/dist.hpp>
 #include <kernel/util/statistics.hpp>
 #include <kernel/util/memory_usage.hpp>
+#include <kernel/util/perf_counters.hpp>
 
 namespace FEAT
 {
@@ -23,6 +24,11 @@ namespace FEAT
         /**
          * \brief Create a detailed report about the application execution
          *
+         * If the performance counters are enabled, the table of the PerfCounters regions is
+         * reported along with the solver tree.
+         *
+         * \attention This function is a collective operation and must be called by all processes.
+         *
          * \param solver_toe The execution time of the complete linear solver in seconds
          * \param statistics_check The result of args.check("statistics"), i.e. the detail level(0 = some details, 1 = many details and log file output)
          * \param shape_dimension The maximum dimension of the used shapes
@@ -51,6 +57,11 @@ namespace FEAT
 
           String op_timings = FEAT::Statistics::get_formatted_times(solver_toe);
 
+          // the performance counter regions are aggregated over all processes
+          String perf_regions;
+          if(PerfCounters::enabled())
+            perf_regions = PerfCounters::get_formatted_regions(comm);
+
           Index cells_coarse_local = domain.back()->get_mesh().get_num_elements();
           Index cells_coarse_max;
           Index cells_coarse_min;
@@ -91,6 +102,8 @@ namespace FEAT
             std::cout << String("TOE assembly:").pad_back(20) << FEAT::Statistics::toe_assembly << std::endl;
             std::cout << String("TOE solve:").pad_back(20) << FEAT::Statistics::toe_solve << std::endl;
             std::cout << std::endl << FEAT::Statistics::get_formatted_solver_tree().trim() <<std::endl;
+            if(!perf_regions.empty())
+              std::cout << std::endl << perf_regions.trim() << std::endl;
 
             String flops = FEAT::Statistics::get_formatted_flops(solver_toe, nranks);
             std::cout<<flops<<std::endl<<std::endl;
@@ -752,10 +752,13 @@ namespace FEAT
           Assembly::assemble_bilinear_operator_matrix_2(dom_asm, mat_loc_bi, deri, space_velo, space_pres, cubature, -DataType(1));
         }
 
-        // assemble velocity divergence matrices
-        /// \todo share matrix structures of D_i
+        // assemble velocity divergence matrices; the D_i share the matrix structure of D_1
         for(int i(0); i < mat_loc_b.num_row_blocks; ++i)
+        {
           mat_loc_d.get(0,i) = mat_loc_b.get(i,0).transpose();
+          if(i > 0)
+            mat_loc_d.get(0,i).share_indices(mat_loc_d.get(0,0));
+        }
       }
     }; // struct StokesPowerSystemLevel<...>
 
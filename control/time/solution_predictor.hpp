@@ -0,0 +1,505 @@
+// FEAT3: Finite Element Analysis Toolbox, Version 3
+// Copyright (C) 2010 - 2023 by Stefan Turek & the FEAT group
+// FEAT3 is released under the GNU General Public License version 3,
+// see the file 'copyright.txt' in the top level directory for details.
+
+#pragma once
+#ifndef FEAT_CONTROL_TIME_SOLUTION_PREDICTOR_HPP
+#define FEAT_CONTROL_TIME_SOLUTION_PREDICTOR_HPP 1
+#include <kernel/base_header.hpp>
+#include <kernel/lafem/base.hpp>
+#include <kernel/util/assertion.hpp>
+#include <kernel/util/math.hpp>
+#include <kernel/util/string.hpp>
+
+#include <iostream>
+#include <vector>
+
+namespace FEAT
+{
+  namespace Control
+  {
+    namespace Time
+    {
+      /**
+       * \brief Solution predictor type enumeration
+       */
+      enum class PredictorType
+      {
+        /// polynomial extrapolation through the most recent solutions
+        extrapolation = 0,
+        /// least-squares polynomial fit over the whole solution history
+        least_squares
+      };
+
+      /// \cond internal
+      inline std::ostream& operator<<(std::ostream& os, PredictorType predictor_type)
+      {
+        switch(predictor_type)
+        {
+          case PredictorType::extrapolation:
+            return os << "expo";
+          case PredictorType::least_squares:
+            return os << "lsq";
+          default:
+            return os << "-unknown-";
+        }
+      }
+
+      inline std::istream& operator>>(std::istream& is, PredictorType& predictor_type)
+      {
+        String predictor_type_name;
+
+        if( (is >> predictor_type_name).fail() )
+        {
+          return is;
+        }
+
+        if(predictor_type_name == "expo")
+        {
+          predictor_type = PredictorType::extrapolation;
+        }
+        else if(predictor_type_name == "lsq")
+        {
+          predictor_type = PredictorType::least_squares;
+        }
+        else
+        {
+          is.setstate(std::ios_base::failbit);
+        }
+
+        return is;
+      }
+      /// \endcond
+
+      /**
+       * \brief Solution history predictor for time stepping schemes
+       *
+       * This class keeps a bounded ring buffer of the most recent accepted solution vectors along
+       * with their time stamps and computes an initial guess for the solution of the next time step
+       * from this history, which is then used as a starting point for the (non)linear solver.
+       *
+       * The prediction is a linear combination of the stored solutions, whose coefficients are
+       * determined by fitting a polynomial of degree q in time:
+       * - PredictorType::extrapolation uses the q+1 most recent solutions and evaluates the
+       *   interpolating polynomial in the new time, i.e. for equidistant steps and q = 2 this yields
+       *   the well-known formula u_k := 3*u_{k-1} - 3*u_{k-2} + u_{k-3}
+       * - PredictorType::least_squares fits a polynomial of degree q to all stored solutions in the
+       *   least-squares sense, which damps the amplification of oscillations and errors in the history
+       *   that a high-order extrapolation would suffer from
+       *
+       * Since the coefficients are computed from the actual time stamps, the predictor also works
+       * for variable time step sizes. If fewer solutions than required are available, the degree
+       * is reduced accordingly.
+       *
+       * Furthermore, the predict_projected() function computes the linear combination of the stored
+       * solutions, which minimizes the residual norm of a given linear system, i.e. it projects the
+       * solution onto the subspace spanned by the history.
+       *
+       * The vectors in the ring buffer are allocated once by cloning the first pushed vector and
+       * are reused afterwards, so an accepted step only costs a single vector copy.
+       *
+       * \tparam VectorType_
+       * The type of the solution vector. Can be a LAFEM or a Global vector type.
+       */
+      template<typename VectorType_>
+      class SolutionPredictor
+      {
+      public:
+        /// the vector type
+        typedef VectorType_ VectorType;
+        /// the data type
+        typedef typename VectorType::DataType DataType;
+
+      protected:
+        /// the predictor type
+        PredictorType _type;
+        /// the polynomial degree
+        Index _order;
+        /// the maximum number of stored solutions
+        Index _max_history;
+        /// the ring buffer of stored solutions
+        std::vector<VectorType> _vecs;
+        /// the time stamps of the stored solutions
+        std::vector<DataType> _times;
+        /// the ring buffer slot for the next solution
+        Index _next;
+        /// the number of stored solutions
+        Index _count;
+        /// temporary vectors for the projection: type-1 rhs copy followed by A*u_i
+        std::vector<VectorType> _vec_tmp;
+
+      public:
+        /**
+         * \brief Constructor
+         *
+         * \param[in] max_history
+         * The maximum number of solutions to be stored. Must be > 0.
+         *
+         * \param[in] order
+         * The degree of the polynomial that is to be used for the prediction.
+         *
+         * \param[in] type
+         * The predictor type.
+         */
+        explicit SolutionPredictor(Index max_history = Index(3), Index order = Index(2),
+          PredictorType type = PredictorType::extrapolation) :
+          _type(type),
+          _order(order),
+          _max_history(max_history),
+          _next(0),
+          _count(0)
+        {
+          XASSERTM(max_history > Index(0), "solution history must not be empty");
+        }
+
+        /// no copies
+        SolutionPredictor(const SolutionPredictor&) = delete;
+        /// no copies
+        SolutionPredictor& operator=(const SolutionPredictor&) = delete;
+
+        /// \returns The maximum number of stored solutions
+        Index get_max_history() const
+        {
+          return _max_history;
+        }
+
+        /// \returns The polynomial degree
+        Index get_order() const
+        {
+          return _order;
+        }
+
+        /// \returns The predictor type
+        PredictorType get_type() const
+        {
+          return _type;
+        }
+
+        /**
+         * \brief Sets the predictor configuration
+         *
+         * \note Changing the maximum history size discards all stored solutions.
+         *
+         * \param[in] max_history
+         * The maximum number of solutions to be stored. Must be > 0.
+         *
+         * \param[in] order
+         * The degree of the polynomial that is to be used for the prediction.
+         *
+         * \param[in] type
+         * The predictor type.
+         */
+        void configure(Index max_history, Index order, PredictorType type)
+        {
+          XASSERTM(max_history > Index(0), "solution history must not be empty");
+          if(max_history != _max_history)
+          {
+            clear();
+            _vecs.clear();
+            _vec_tmp.clear();
+          }
+          _max_history = max_history;
+          _order = order;
+          _type = type;
+        }
+
+        /// \returns The number of currently stored solutions
+        Index size() const
+        {
+          return _count;
+        }
+
+        /// \returns \c true, if no solutions are stored, otherwise \c false
+        bool empty() const
+        {
+          return _count == Index(0);
+        }
+
+        /**
+         * \brief Discards all stored solutions
+         *
+         * \note The allocated vectors are kept for reuse.
+         */
+        void clear()
+        {
+          _next = _count = Index(0);
+        }
+
+        /**
+         * \brief Returns a stored solution
+         *
+         * \param[in] i
+         * The age of the solution, i.e. 0 for the most recent one. Must be < size().
+         *
+         * \returns A reference to the stored solution.
+         */
+        const VectorType& get_vector(Index i) const
+        {
+          XASSERT(i < _count);
+          return _vecs.at(_slot(i));
+        }
+
+        /**
+         * \brief Returns the time stamp of a stored solution
+         *
+         * \param[in] i
+         * The age of the solution, i.e. 0 for the most recent one. Must be < size().
+         *
+         * \returns The time stamp of the stored solution.
+         */
+        DataType get_time(Index i) const
+        {
+          XASSERT(i < _count);
+          return _times.at(_slot(i));
+        }
+
+        /**
+         * \brief Adds an accepted solution to the history
+         *
+         * If the history is full, the oldest solution is overwritten.
+         *
+         * \param[in] vec_sol
+         * The \transient solution vector that is to be stored.
+         *
+         * \param[in] time
+         * The time stamp of the solution. Must be greater than the time stamp of the previous solution.
+         */
+        void push(const VectorType& vec_sol, DataType time)
+        {
+          XASSERTM((_count == Index(0)) || (time > get_time(Index(0))), "solution time stamps must be increasing");
+
+          if(_vecs.size() < std::size_t(_max_history))
+          {
+            _vecs.reserve(std::size_t(_max_history));
+            _times.resize(std::size_t(_max_history));
+          }
+
+          // allocate a new vector or reuse the one in the slot
+          if(std::size_t(_next) < _vecs.size())
+            _vecs.at(_next).copy(vec_sol);
+          else
+            _vecs.push_back(vec_sol.clone(LAFEM::CloneMode::Deep));
+          _times.at(_next) = time;
+
+          _next = (_next + Index(1)) % _max_history;
+          if(_count < _max_history)
+            ++_count;
+        }
+
+        /**
+         * \brief Computes the coefficients of the prediction
+         *
+         * \param[out] coeffs
+         * Receives the coefficients of the stored solutions, ordered by age.
+         *
+         * \param[in] time
+         * The time for which the solution is to be predicted.
+         *
+         * \returns
+         * \c true, if the coefficients have been computed or \c false, if the history is empty.
+         */
+        bool compute_coeffs(std::vector<DataType>& coeffs, DataType time) const
+        {
+          coeffs.clear();
+          if(_count == Index(0))
+            return false;
+
+          // choose the polynomial degree and the number of used solutions
+          const Index q = Math::min(_order, _count - Index(1));
+          const Index m = (_type == PredictorType::least_squares ? _count : q + Index(1));
+          coeffs.resize(m, DataType(0));
+
+          if(q == Index(0))
+          {
+            // constant prediction: the mean over all used solutions
+            for(auto& c : coeffs)
+              c = DataType(1) / DataType(m);
+            return true;
+          }
+
+          // normalize the time stamps to avoid ill-conditioning: tau_i := (t_i - t_0) / h,
+          // where h is the mean time step size over the used solutions
+          const DataType t0 = get_time(Index(0));
+          const DataType h = (t0 - get_time(m - Index(1))) / DataType(m - Index(1));
+          std::vector<DataType> tau(m);
+          for(Index i(0); i < m; ++i)
+            tau[i] = (get_time(i) - t0) / h;
+          const DataType tau_new = (time - t0) / h;
+
+          if(m == q + Index(1))
+          {
+            // Lagrange interpolation polynomials evaluated in the new time
+            for(Index i(0); i < m; ++i)
+            {
+              DataType c(1);
+              for(Index j(0); j < m; ++j)
+              {
+                if(j != i)
+                  c *= (tau_new - tau[j]) / (tau[i] - tau[j]);
+              }
+              coeffs[i] = c;
+            }
+            return true;
+          }
+
+          // least-squares fit: with the Vandermonde matrix V_ij := tau_i^j, the coefficients are
+          // given by c := V * (V^T*V)^{-1} * p, where p_j := tau_new^j
+          const Index n = q + Index(1);
+          std::vector<DataType> gram(n*n, DataType(0)), rhs(n);
+          std::vector<DataType> vrow(n);
+          for(Index i(0); i < m; ++i)
+          {
+            vrow[0] = DataType(1);
+            for(Index j(1); j < n; ++j)
+              vrow[j] = vrow[j-1] * tau[i];
+            for(Index j(0); j < n; ++j)
+              for(Index k(0); k <= j; ++k)
+                gram[j*n + k] += vrow[j] * vrow[k];
+          }
+          rhs[0] = DataType(1);
+          for(Index j(1); j < n; ++j)
+            rhs[j] = rhs[j-1] * tau_new;
+
+          if(!Math::factorize_cholesky(n, n, gram.data()))
+            return false;
+          Math::solve_cholesky(n, n, gram.data(), Index(1), rhs.data(), Index(1));
+
+          for(Index i(0); i < m; ++i)
+          {
+            DataType c(0), v(1);
+            for(Index j(0); j < n; ++j, v *= tau[i])
+              c += v * rhs[j];
+            coeffs[i] = c;
+          }
+          return true;
+        }
+
+        /**
+         * \brief Predicts the solution for a new time
+         *
+         * \param[out] vec_sol
+         * The \transient vector that receives the predicted solution. Must have been allocated.
+         *
+         * \param[in] time
+         * The time for which the solution is to be predicted.
+         *
+         * \returns
+         * \c true, if a prediction has been computed or \c false, if the history is empty, in which
+         * case \p vec_sol remains unchanged.
+         */
+        bool predict(VectorType& vec_sol, DataType time) const
+        {
+          std::vector<DataType> coeffs;
+          if(!compute_coeffs(coeffs, time))
+            return false;
+
+          vec_sol.scale(get_vector(Index(0)), coeffs.front());
+          for(Index i(1); i < Index(coeffs.size()); ++i)
+            vec_sol.axpy(get_vector(i), vec_sol, coeffs[i]);
+          return true;
+        }
+
+        /**
+         * \brief Predicts the solution by a projection onto the solution history
+         *
+         * This function computes the linear combination x := sum_i c_i*u_i of the stored solutions
+         * u_i, which minimizes the residual norm |b - A*x|, i.e. it solves the normal equations of
+         * the reduced system. This requires one matrix-vector product per stored solution.
+         *
+         * If the stored solutions are (numerically) linearly dependent, this function falls back
+         * to the polynomial prediction for the given time.
+         *
+         * \param[out] vec_sol
+         * The \transient vector that receives the predicted solution. Must have been allocated.
+         *
+         * \param[in] matrix
+         * The \transient system matrix A of the new time step.
+         *
+         * \param[in] vec_rhs
+         * The \transient right-hand-side vector b of the new time step. As usual for right-hand-side
+         * vectors, this is expected to be a type-0 vector and it is converted to a type-1 copy before
+         * any dot products are computed. The matrix is expected to return type-1 vectors, which is
+         * the case for Global::Matrix::apply().
+         *
+         * \param[in] time
+         * The time for which the solution is to be predicted in case of a fallback.
+         *
+         * \returns
+         * \c true, if a prediction has been computed or \c false, if the history is empty, in which
+         * case \p vec_sol remains unchanged.
+         */
+        template<typename MatrixType_>
+        bool predict_projected(VectorType& vec_sol, const MatrixType_& matrix, const VectorType& vec_rhs, DataType time)
+        {
+          if(_count == Index(0))
+            return false;
+
+          const Index m = _count;
+
+          // allocate temporary vectors
+          while(_vec_tmp.size() < std::size_t(m+1))
+            _vec_tmp.push_back(vec_rhs.clone(LAFEM::CloneMode::Layout));
+
+          // convert the type-0 rhs to type-1, since the dot products of global vectors are only
+          // correct if both operands are type-1 vectors
+          VectorType& vec_b = _vec_tmp.front();
+          vec_b.copy(vec_rhs);
+          _sync_0(vec_b, 0);
+
+          // apply the matrix to all stored solutions
+          for(Index i(0); i < m; ++i)
+            matrix.apply(_vec_tmp[i+1], get_vector(i));
+
+          // assemble the normal equations G*c = g with G_ij := <A*u_i, A*u_j> and g_i := <A*u_i, b>
+          std::vector<DataType> gram(m*m, DataType(0)), coeffs(m);
+          for(Index i(0); i < m; ++i)
+          {
+            for(Index j(0); j <= i; ++j)
+              gram[i*m + j] = _vec_tmp[i+1].dot(_vec_tmp[j+1]);
+            coeffs[i] = _vec_tmp[i+1].dot(vec_b);
+          }
+
+          // reject the projection if the Gram matrix is not numerically positive definite
+          DataType gmax(0);
+          for(Index i(0); i < m; ++i)
+            gmax = Math::max(gmax, gram[i*m + i]);
+          const DataType tol = Math::sqrt(Math::eps<DataType>()) * gmax;
+          bool okay = (gmax > DataType(0)) && Math::factorize_cholesky(m, m, gram.data());
+          for(Index i(0); okay && (i < m); ++i)
+            okay = (gram[i*m + i] * gram[i*m + i] > tol);
+          if(!okay)
+            return predict(vec_sol, time);
+
+          Math::solve_cholesky(m, m, gram.data(), Index(1), coeffs.data(), Index(1));
+
+          vec_sol.scale(get_vector(Index(0)), coeffs.front());
+          for(Index i(1); i < m; ++i)
+            vec_sol.axpy(get_vector(i), vec_sol, coeffs[i]);
+          return true;
+        }
+
+      protected:
+        /// synchronizes a type-0 vector to a type-1 vector; chosen for vectors with a gate
+        template<typename Vector_>
+        static auto _sync_0(Vector_& vec, int) -> decltype(vec.sync_0(), void())
+        {
+          vec.sync_0();
+        }
+
+        /// synchronizes a type-0 vector to a type-1 vector; no-op for local vectors
+        template<typename Vector_>
+        static void _sync_0(Vector_&, long)
+        {
+        }
+
+        /// \returns The ring buffer slot of the i-th most recent solution
+        std::size_t _slot(Index i) const
+        {
+          return std::size_t((_next + _max_history - Index(1) - i) % _max_history);
+        }
+      }; // class SolutionPredictor<...>
+    } // namespace Time
+  } // namespace Control
+} // namespace FEAT
+#endif // FEAT_CONTROL_TIME_SOLUTION_PREDICTOR_HPP
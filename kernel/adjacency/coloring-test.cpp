@@ -6,6 +6,9 @@
 #include <test_system/test_system.hpp>
 #include <kernel/adjacency/graph.hpp>
 #include <kernel/adjacency/coloring.hpp>
+#include <kernel/util/math.hpp>
+
+#include <vector>
 
 using namespace FEAT;
 using namespace FEAT::TestSystem;
@@ -115,6 +118,64 @@ public:
     // validate
     TEST_CHECK(test_c_ordered(co));
 
+    // Jones-Plassmann coloring
+    test_jones_plassmann(g);
+
+    // create the 9-point stencil graph of a 100x100 grid
+    const Index m = 100;
+    std::vector<Index> h_ptr(1u, Index(0)), h_idx;
+    for(Index i(0); i < m; ++i)
+    {
+      for(Index j(0); j < m; ++j)
+      {
+        for(Index k(i > 0 ? i-1 : i); k <= Math::min(i+1, m-1); ++k)
+          for(Index l(j > 0 ? j-1 : j); l <= Math::min(j+1, m-1); ++l)
+            h_idx.push_back(k*m + l);
+        h_ptr.push_back(Index(h_idx.size()));
+      }
+    }
+    Graph h(m*m, h_ptr, h_idx);
+    test_jones_plassmann(h);
+  }
+
+  void test_jones_plassmann(const Graph& g) const
+  {
+    Coloring c = Coloring::create_jones_plassmann(g);
+    TEST_CHECK_EQUAL(c.get_num_nodes(), g.get_num_nodes_domain());
+
+    // at most degree+1 colors must be used
+    const Index num_colors = c.get_max_color() + 1;
+    TEST_CHECK(num_colors <= g.degree() + 1);
+
+    // adjacent nodes must have different colors
+    const Index* ptr = g.get_domain_ptr();
+    const Index* idx = g.get_image_idx();
+    const Index* col = c.get_coloring();
+    for(Index i(0); i < g.get_num_nodes_domain(); ++i)
+    {
+      TEST_CHECK(col[i] < num_colors);
+      for(Index j(ptr[i]); j < ptr[i+1]; ++j)
+      {
+        if(idx[j] != i)
+        {
+          TEST_CHECK_NOT_EQUAL(col[i], col[idx[j]]);
+        }
+      }
+    }
+
+    // each color must be used
+    Graph parti = c.create_partition_graph();
+    for(Index k(0); k < num_colors; ++k)
+    {
+      TEST_CHECK(parti.degree(k) > Index(0));
+    }
+
+    // the coloring must be deterministic
+    Coloring c2 = Coloring::create_jones_plassmann(g);
+    for(Index i(0); i < g.get_num_nodes_domain(); ++i)
+    {
+      TEST_CHECK_EQUAL(c2.get_coloring()[i], col[i]);
+    }
   }
 };
 
@@ -12,6 +12,7 @@
 #include <vector>
 #include <utility>
 #include <unordered_set>
+#include <cstdint>
 
 namespace FEAT
 {
@@ -260,6 +261,144 @@ namespace FEAT
       }
     }
 
+    // Jones-Plassmann coloring
+    Coloring Coloring::create_jones_plassmann(const Graph& graph)
+    {
+      Coloring coloring;
+
+      // get the graph's data
+      const Index num_nodes = graph.get_num_nodes_domain();
+      const Index* domain_ptr = graph.get_domain_ptr();
+      const Index* image_idx = graph.get_image_idx();
+
+      if(num_nodes == Index(0))
+        return coloring;
+
+      // highest possible number of colors
+      const Index mnc = graph.degree() + 1;
+
+      // all nodes are uncolored at the beginning
+      const Index no_color = ~Index(0);
+      coloring._coloring.resize(num_nodes, no_color);
+      Index* colors = coloring._coloring.data();
+
+      // compute the node weights by hashing the node indices (splitmix64 finalizer)
+      std::vector<std::uint64_t> weights(num_nodes);
+      FEAT_PRAGMA_OMP(parallel for schedule(static))
+      for(Index i = 0; i < num_nodes; ++i)
+      {
+        std::uint64_t z = std::uint64_t(i) + 0x9E3779B97F4A7C15ull;
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        weights[i] = z ^ (z >> 31);
+      }
+
+      // list of all nodes which have not been colored yet
+      std::vector<Index> work(num_nodes);
+      for(Index i(0); i < num_nodes; ++i)
+        work[i] = i;
+
+      // selection flags for the nodes in the work list
+      std::vector<char> selected(num_nodes, 0);
+
+      // auxiliary vector storing the number of color uses
+      std::vector<Index> col_num(mnc, Index(0));
+
+      // number of used colors
+      Index num_colors(0);
+
+      while(!work.empty())
+      {
+        const Index num_work = Index(work.size());
+
+        // select all nodes whose weight is a local maximum among all of their uncolored neighbors;
+        // ties are broken by the node index, so the selected nodes form an independent set
+        FEAT_PRAGMA_OMP(parallel for schedule(static))
+        for(Index k = 0; k < num_work; ++k)
+        {
+          const Index i = work[k];
+          char is_max = 1;
+          for(Index j(domain_ptr[i]); j < domain_ptr[i+1]; ++j)
+          {
+            const Index n = image_idx[j];
+            if((n == i) || (colors[n] != no_color))
+              continue;
+            if((weights[n] > weights[i]) || ((weights[n] == weights[i]) && (n > i)))
+            {
+              is_max = 0;
+              break;
+            }
+          }
+          selected[k] = is_max;
+        }
+
+        // color all selected nodes
+        FEAT_PRAGMA_OMP(parallel)
+        {
+          // auxiliary vector storing temporary information about used colors
+          std::vector<char> col_aux(mnc, 0);
+
+          FEAT_PRAGMA_OMP(for schedule(static))
+          for(Index k = 0; k < num_work; ++k)
+          {
+            if(selected[k] == 0)
+              continue;
+
+            const Index i = work[k];
+
+            // mark the colors of all neighbors, which have been colored in previous rounds
+            for(Index j(domain_ptr[i]); j < domain_ptr[i+1]; ++j)
+            {
+              if((image_idx[j] != i) && (colors[image_idx[j]] < num_colors))
+                col_aux[colors[image_idx[j]]] = 1;
+            }
+
+            // choose the least used admissible color or a new color if no admissible color exists
+            Index min_color_uses = num_nodes + 1;
+            Index min_color_index = num_colors;
+            for(Index l(0); l < num_colors; ++l)
+            {
+              if((col_aux[l] == 0) && (col_num[l] < min_color_uses))
+              {
+                min_color_uses = col_num[l];
+                min_color_index = l;
+              }
+            }
+
+            // reset the auxiliary vector
+            for(Index j(domain_ptr[i]); j < domain_ptr[i+1]; ++j)
+            {
+              if((image_idx[j] != i) && (colors[image_idx[j]] < num_colors))
+                col_aux[colors[image_idx[j]]] = 0;
+            }
+
+            colors[i] = min_color_index;
+          }
+        }
+
+        // update color uses and remove all colored nodes from the work list
+        bool new_color = false;
+        Index num_left(0);
+        for(Index k(0); k < num_work; ++k)
+        {
+          const Index i = work[k];
+          if(selected[k] != 0)
+          {
+            new_color = new_color || (colors[i] == num_colors);
+            ++col_num[colors[i]];
+          }
+          else
+            work[num_left++] = i;
+        }
+        work.resize(num_left);
+        if(new_color)
+          ++num_colors;
+      }
+
+      coloring._num_colors = num_colors;
+      return coloring;
+    }
+
     // move ctor
     Coloring::Coloring(Coloring&& other) :
       _num_colors(other._num_colors),
@@ -132,6 +132,30 @@ namespace FEAT
        */
       explicit Coloring(const Graph& graph, const Index* order);
 
+      /**
+       * \brief Creates a coloring by the parallel Jones-Plassmann algorithm
+       *
+       * This function creates a coloring object out of a graph by the Jones-Plassmann algorithm,
+       * which can be executed in parallel by multiple OpenMP threads. Each node is assigned a
+       * pseudo-random weight, which is computed by hashing the node index, and in each round, all
+       * uncolored nodes whose weight is greater than the weights of all of their uncolored neighbors
+       * are colored simultaneously. Since these nodes form an independent set, each of them can pick
+       * its color independently of the others: as in the serial greedy algorithm, each node picks
+       * the least used color among all colors that are not used by its neighbors, so that the color
+       * classes are approximately balanced.
+       *
+       * The resulting coloring is deterministic, i.e. it does not depend on the number of threads,
+       * and it uses at most <c>graph.degree() + 1</c> colors, but it is in general not identical to
+       * the coloring computed by the serial greedy algorithm.
+       *
+       * \param[in] graph
+       * The \transient graph to create the coloring from. Must be symmetric.
+       *
+       * \returns
+       * The Jones-Plassmann coloring of the graph.
+       */
+      static Coloring create_jones_plassmann(const Graph& graph);
+
       /// move ctor
       Coloring(Coloring&& other);
 
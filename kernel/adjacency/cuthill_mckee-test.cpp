@@ -334,5 +334,63 @@ public:
     TEST_CHECK(test_max_root(g));
     TEST_CHECK(test_default_root(g));
     TEST_CHECK(test_reverse(g));
+
+    // test parallel Cuthill McKee algorithm
+    test_parallel(g);
+
+    // create the 5-point stencil graph of a 100x100 grid, which consists of two disconnected
+    // grids of 100x60 and 100x40 nodes, to test the parallel algorithm with large levels
+    const Index m = 100;
+    std::vector<Index> h_ptr(1u, Index(0)), h_idx;
+    for(Index i(0); i < m; ++i)
+    {
+      for(Index j(0); j < m; ++j)
+      {
+        if(i > 0 && i != 60)
+          h_idx.push_back((i-1)*m + j);
+        if(j > 0)
+          h_idx.push_back(i*m + j - 1);
+        h_idx.push_back(i*m + j);
+        if(j+1 < m)
+          h_idx.push_back(i*m + j + 1);
+        if(i+1 < m && i+1 != 60)
+          h_idx.push_back((i+1)*m + j);
+        h_ptr.push_back(Index(h_idx.size()));
+      }
+    }
+    Graph h(m*m, h_ptr, h_idx);
+    test_parallel(h);
+  }
+
+  void test_parallel(const Graph& g) const
+  {
+    const CuthillMcKee::RootType root_types[] =
+    {
+      CuthillMcKee::root_default, CuthillMcKee::root_minimum_degree, CuthillMcKee::root_maximum_degree
+    };
+    const CuthillMcKee::SortType sort_types[] =
+    {
+      CuthillMcKee::sort_default, CuthillMcKee::sort_asc, CuthillMcKee::sort_desc
+    };
+
+    // the parallel algorithm must yield the same permutation and layering as the serial one
+    for(int rev(0); rev < 2; ++rev)
+    {
+      for(auto root_type : root_types)
+      {
+        for(auto sort_type : sort_types)
+        {
+          std::vector<Index> layers_s, layers_p;
+          Permutation perm_s = CuthillMcKee::compute(layers_s, g, rev != 0, root_type, sort_type);
+          Permutation perm_p = CuthillMcKee::compute_parallel(layers_p, g, rev != 0, root_type, sort_type);
+          TEST_CHECK_EQUAL(perm_p.size(), perm_s.size());
+          for(Index i(0); i < perm_s.size(); ++i)
+          {
+            TEST_CHECK_EQUAL(perm_p.get_perm_pos()[i], perm_s.get_perm_pos()[i]);
+          }
+          TEST_CHECK(layers_p == layers_s);
+        }
+      }
+    }
   }
 } cuthill_mckee_test;
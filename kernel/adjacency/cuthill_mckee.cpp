@@ -8,10 +8,89 @@
 #include <kernel/adjacency/graph.hpp>
 #include <kernel/util/assertion.hpp>
 
+// includes, system
+#include <algorithm>
+#include <atomic>
+
 namespace FEAT
 {
   namespace Adjacency
   {
+    namespace Intern
+    {
+      /**
+       * \brief Expands a single Cuthill-McKee level in parallel
+       *
+       * Each unprocessed neighbor of a node in the current level is claimed by the adjacent node
+       * with the minimal position, i.e. the new level is ordered by the positions of the claiming
+       * nodes and, for each claiming node, by its adjacency order, which is exactly the order
+       * produced by the serial algorithm.
+       *
+       * \returns The end of the new level within the permutation array.
+       */
+      static Index cmk_expand_level_parallel(Index* permutation, const Index* domain_ptr, const Index* image_idx,
+        const Index first, const Index last, std::atomic<Index>* node_owner, char* node_claimed, std::vector<Index>& level_ptr)
+      {
+        // claim all unprocessed neighbors; nodes of previous levels have been claimed by nodes
+        // with smaller positions, so they are never claimed again
+        FEAT_PRAGMA_OMP(parallel for schedule(dynamic, 256))
+        for(Index i = first; i < last; ++i)
+        {
+          const Index n = permutation[i];
+          for(Index j(domain_ptr[n]); j < domain_ptr[n+1]; ++j)
+          {
+            std::atomic<Index>& owner = node_owner[image_idx[j]];
+            Index cur = owner.load(std::memory_order_relaxed);
+            while((i < cur) && !owner.compare_exchange_weak(cur, i, std::memory_order_relaxed)) {}
+          }
+        }
+
+        // count the number of claimed neighbors of each node; the claimed flag of each node is
+        // only accessed by the thread processing its owner
+        level_ptr.resize(last - first + 1u);
+        FEAT_PRAGMA_OMP(parallel for schedule(dynamic, 256))
+        for(Index i = first; i < last; ++i)
+        {
+          const Index n = permutation[i];
+          Index count(0);
+          for(Index j(domain_ptr[n]); j < domain_ptr[n+1]; ++j)
+          {
+            const Index k = image_idx[j];
+            if((node_owner[k].load(std::memory_order_relaxed) == i) && (node_claimed[k] == 0))
+            {
+              node_claimed[k] = 1;
+              ++count;
+            }
+          }
+          level_ptr[i - first + 1u] = count;
+        }
+
+        // compute the level offsets
+        level_ptr[0] = last;
+        for(Index i(first); i < last; ++i)
+          level_ptr[i - first + 1u] += level_ptr[i - first];
+
+        // insert the claimed neighbors into the permutation
+        FEAT_PRAGMA_OMP(parallel for schedule(dynamic, 256))
+        for(Index i = first; i < last; ++i)
+        {
+          const Index n = permutation[i];
+          Index pos = level_ptr[i - first];
+          for(Index j(domain_ptr[n]); j < domain_ptr[n+1]; ++j)
+          {
+            const Index k = image_idx[j];
+            if((node_owner[k].load(std::memory_order_relaxed) == i) && (node_claimed[k] == 1))
+            {
+              node_claimed[k] = 2;
+              permutation[pos++] = k;
+            }
+          }
+        }
+
+        return level_ptr.back();
+      }
+    } // namespace Intern
+
     Permutation CuthillMcKee::compute(
       const Graph& graph,
       bool reverse,
@@ -28,6 +107,37 @@ namespace FEAT
       bool reverse,
       CuthillMcKee::RootType root_type,
       CuthillMcKee::SortType sort_type)
+    {
+      return _compute(layers, graph, reverse, root_type, sort_type, false);
+    }
+
+    Permutation CuthillMcKee::compute_parallel(
+      const Graph& graph,
+      bool reverse,
+      CuthillMcKee::RootType root_type,
+      CuthillMcKee::SortType sort_type)
+    {
+      std::vector<Index> layers;
+      return _compute(layers, graph, reverse, root_type, sort_type, true);
+    }
+
+    Permutation CuthillMcKee::compute_parallel(
+      std::vector<Index>& layers,
+      const Graph& graph,
+      bool reverse,
+      CuthillMcKee::RootType root_type,
+      CuthillMcKee::SortType sort_type)
+    {
+      return _compute(layers, graph, reverse, root_type, sort_type, true);
+    }
+
+    Permutation CuthillMcKee::_compute(
+      std::vector<Index>& layers,
+      const Graph& graph,
+      bool reverse,
+      CuthillMcKee::RootType root_type,
+      CuthillMcKee::SortType sort_type,
+      bool parallel)
     {
       layers.reserve(graph.get_num_nodes_domain() + Index(1));
 
@@ -43,11 +153,24 @@ namespace FEAT
 
       // a vector storing the degree of each node
       std::vector<Index> node_degree(num_nodes);
-      for(Index j(0); j < num_nodes; ++j)
+      FEAT_PRAGMA_OMP(parallel for schedule(static) if(parallel))
+      for(Index j = 0; j < num_nodes; ++j)
       {
         node_degree[j] = graph.degree(j);
       }
 
+      // auxiliary vectors for the parallel level expansion:
+      // node_owner stores the position of the node that has claimed the node (num_nodes = none),
+      // node_claimed is only written by the owner of the node and prevents duplicate insertions
+      std::vector<std::atomic<Index>> node_owner(parallel ? num_nodes : Index(0));
+      std::vector<char> node_claimed(parallel ? num_nodes : Index(0), 0);
+      std::vector<Index> level_ptr;
+      FEAT_PRAGMA_OMP(parallel for schedule(static) if(parallel))
+      for(Index j = 0; j < Index(node_owner.size()); ++j)
+      {
+        node_owner[j].store(num_nodes, std::memory_order_relaxed);
+      }
+
       // auxiliary variables
       Index lvl1 = 0;
       Index lvl2 = 0;
@@ -129,6 +252,11 @@ namespace FEAT
         const Index lvl_root = lvl1;
         permutation[lvl1 - 1] = root;
         node_mask[root] = 1;
+        if(parallel)
+        {
+          node_owner[root].store(lvl1 - 1, std::memory_order_relaxed);
+          node_claimed[root] = 2;
+        }
 
         // push the root into the next layer
         const Index lay_root_pos = Index(layers.size());
@@ -137,27 +265,40 @@ namespace FEAT
         // loop through the adjacency levels of the root
         while(lvl2 < num_nodes)
         {
-          // loop through all nodes in the current level
-          for(Index i(lvl1 - 1); i < lvl2 ; ++i)
+          if(parallel)
           {
-            // get the node's index
-            Index n = permutation[i];
-
-            // Go through all nodes which are adjacent to node n
-            for(Index j(domain_ptr[n]); j < domain_ptr[n+1] ; ++j)
+            // expand the current level in parallel
+            lvl3 = Intern::cmk_expand_level_parallel(permutation, domain_ptr, image_idx, lvl1 - 1, lvl2,
+              node_owner.data(), node_claimed.data(), level_ptr);
+            for(Index i(lvl2); i < lvl3; ++i)
             {
-              // Get the index of the adjacent node
-              Index k = image_idx[j];
+              node_mask[permutation[i]] = true;
+            }
+          }
+          else
+          {
+            // loop through all nodes in the current level
+            for(Index i(lvl1 - 1); i < lvl2 ; ++i)
+            {
+              // get the node's index
+              Index n = permutation[i];
 
-              // has this node been processed?
-              if(!node_mask[k])
+              // Go through all nodes which are adjacent to node n
+              for(Index j(domain_ptr[n]); j < domain_ptr[n+1] ; ++j)
               {
-                ++lvl3;
-                permutation[lvl3 - 1] = k;
-                node_mask[k] = true;
-              }
-            } //j loop
-          } // i loop
+                // Get the index of the adjacent node
+                Index k = image_idx[j];
+
+                // has this node been processed?
+                if(!node_mask[k])
+                {
+                  ++lvl3;
+                  permutation[lvl3 - 1] = k;
+                  node_mask[k] = true;
+                }
+              } //j loop
+            } // i loop
+          }
 
           if(lvl3 <= lvl2)
           {
@@ -180,6 +321,14 @@ namespace FEAT
               break;
             }
 
+            // parallel mode: use a stable merge sort, which yields the same order as linear insertion
+            if(parallel)
+            {
+              std::stable_sort(&permutation[lvl2], &permutation[lvl3],
+                [&node_degree](Index a, Index b) {return node_degree[a] > node_degree[b];});
+              break;
+            }
+
             // sorting algorithm: linear insertion
             for(Index i(lvl2); i < lvl3; ++i)
             {
@@ -203,6 +352,14 @@ namespace FEAT
               break;
             }
 
+            // parallel mode: use a stable merge sort, which yields the same order as linear insertion
+            if(parallel)
+            {
+              std::stable_sort(&permutation[lvl2], &permutation[lvl3],
+                [&node_degree](Index a, Index b) {return node_degree[a] < node_degree[b];});
+              break;
+            }
+
             // sorting algorithm: linear insertion
             for(Index i(lvl2); i < lvl3; ++i)
             {
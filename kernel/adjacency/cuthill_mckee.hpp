@@ -141,6 +141,62 @@ namespace FEAT
         bool reverse = false,
         CuthillMcKee::RootType root_type = root_default,
         CuthillMcKee::SortType sort_type = sort_default);
+
+      /**
+       * \brief Parallel Cuthill-McKee permutation computation function
+       *
+       * This function creates a Cuthill-McKee permutation of the given graph by a level-synchronous
+       * breadth-first search, in which each level is expanded in parallel by multiple OpenMP threads:
+       * each unprocessed neighbor of the current level is claimed by its adjacent node of minimal
+       * position within the current level, so the resulting permutation and layering are identical
+       * to the ones computed by the serial compute() function with the same parameters.
+       *
+       * \param[out] layers
+       * A \transient reference to a vector that receives the layer offsets.
+       *
+       * \param[in] graph
+       * The \transient graph that the permutation is calculated for.
+       *
+       * \param[in] reverse
+       * This bool determines, if the reverse Cuthill-McKee permutation should be calculated.
+       * If \c true, then the reversed permutation is used.
+       *
+       * \param[in] root_type
+       * This parameter determines the way, the root nodes are chosen.
+       *
+       * \param[in] sort_type
+       * This parameter determines, which sorting is used in each level of the Cuthill-McKee algorithm.
+       *
+       * \returns
+       * The Cuthill-McKee permutation.
+       */
+      static Permutation compute_parallel(
+        std::vector<Index>& layers,
+        const Graph& graph,
+        bool reverse = false,
+        CuthillMcKee::RootType root_type = root_default,
+        CuthillMcKee::SortType sort_type = sort_default);
+
+      /**
+       * \brief Parallel Cuthill-McKee permutation computation function
+       *
+       * \see compute_parallel(std::vector<Index>&, const Graph&, bool, CuthillMcKee::RootType, CuthillMcKee::SortType)
+       */
+      static Permutation compute_parallel(
+        const Graph& graph,
+        bool reverse = false,
+        CuthillMcKee::RootType root_type = root_default,
+        CuthillMcKee::SortType sort_type = sort_default);
+
+    protected:
+      /// auxiliary function for compute() and compute_parallel()
+      static Permutation _compute(
+        std::vector<Index>& layers,
+        const Graph& graph,
+        bool reverse,
+        CuthillMcKee::RootType root_type,
+        CuthillMcKee::SortType sort_type,
+        bool parallel);
     }; // class CuthillMcKee
   } // namespace Adjacency
 } // namespace FEAT
@@ -8,6 +8,8 @@
 #include <kernel/adjacency/coloring.hpp>
 #include <kernel/adjacency/permutation.hpp>
 
+#include <algorithm>
+
 using namespace FEAT;
 using namespace FEAT::TestSystem;
 using namespace FEAT::Adjacency;
@@ -749,6 +751,87 @@ public:
     check_graph(g, f);
   }
 
+  void check_graph_rows(const Graph& graph, const std::vector<std::vector<Index>>& rows) const
+  {
+    TEST_CHECK_EQUAL(graph.get_num_nodes_domain(), Index(rows.size()));
+    const Index* ptr = graph.get_domain_ptr();
+    const Index* idx = graph.get_image_idx();
+    for(Index i(0); i < Index(rows.size()); ++i)
+    {
+      TEST_CHECK_EQUAL(ptr[i+1] - ptr[i], Index(rows[i].size()));
+      for(Index j(0); j < Index(rows[i].size()); ++j)
+      {
+        TEST_CHECK_EQUAL(idx[ptr[i] + j], rows[i][j]);
+      }
+    }
+  }
+
+  void test_render_parallel() const
+  {
+    // create a vertices-at-element graph of a 128x128 quad mesh; this is large enough to
+    // render the graphs by multiple threads
+    const Index n = 128;
+    const Index num_elems = n*n;
+    const Index num_verts = (n+1)*(n+1);
+    Graph verts_at_elem(num_elems, num_verts, 4*num_elems);
+    Index* ptr = verts_at_elem.get_domain_ptr();
+    Index* idx = verts_at_elem.get_image_idx();
+    for(Index i(0); i < n; ++i)
+    {
+      for(Index j(0); j < n; ++j)
+      {
+        const Index e = i*n + j;
+        ptr[e] = 4*e;
+        idx[4*e + 0] = (i+0)*(n+1) + j + 0;
+        idx[4*e + 1] = (i+0)*(n+1) + j + 1;
+        idx[4*e + 2] = (i+1)*(n+1) + j + 0;
+        idx[4*e + 3] = (i+1)*(n+1) + j + 1;
+      }
+    }
+    ptr[num_elems] = 4*num_elems;
+    Random rng;
+    shuffle_indices(verts_at_elem, rng);
+
+    // compute reference elements-at-vertex and elements-at-element adjacencies
+    std::vector<std::vector<Index>> elems_at_vert_ref(num_verts), elems_at_elem_ref(num_elems);
+    for(Index e(0); e < num_elems; ++e)
+    {
+      for(Index k(ptr[e]); k < ptr[e+1]; ++k)
+        elems_at_vert_ref[idx[k]].push_back(e);
+    }
+    for(Index e(0); e < num_elems; ++e)
+    {
+      for(Index k(ptr[e]); k < ptr[e+1]; ++k)
+      {
+        for(Index f : elems_at_vert_ref[idx[k]])
+        {
+          if(std::find(elems_at_elem_ref[e].begin(), elems_at_elem_ref[e].end(), f) == elems_at_elem_ref[e].end())
+            elems_at_elem_ref[e].push_back(f);
+        }
+      }
+    }
+
+    // test transpose
+    Graph elems_at_vert(RenderType::transpose, verts_at_elem);
+    check_graph_rows(elems_at_vert, elems_at_vert_ref);
+
+    // test injectify_transpose; all vertices of an element are distinct
+    check_graph_rows(Graph(RenderType::injectify_transpose, verts_at_elem), elems_at_vert_ref);
+
+    // test composite injectify (unsorted, i.e. in order of first occurrence)
+    check_graph_rows(Graph(RenderType::injectify, verts_at_elem, elems_at_vert), elems_at_elem_ref);
+
+    // test composite injectify_transpose (auto-sorted); the elements-at-element graph is symmetric
+    for(auto& row : elems_at_elem_ref)
+      std::sort(row.begin(), row.end());
+    check_graph_rows(Graph(RenderType::injectify_transpose, verts_at_elem, elems_at_vert), elems_at_elem_ref);
+
+    // test composite transpose (auto-sorted): contains duplicates for each shared vertex
+    Graph elem_elem_trans(RenderType::transpose, verts_at_elem, elems_at_vert);
+    Graph elem_elem_as_is(RenderType::as_is_sorted, verts_at_elem, elems_at_vert);
+    check_graph(elem_elem_trans, elem_elem_as_is);
+  }
+
   virtual void run() const override
   {
     // perform basic
@@ -771,6 +854,9 @@ public:
 
     // test serialization
     test_serialize();
+
+    // test multi-threaded rendering
+    test_render_parallel();
   }
 
 } graph_test;
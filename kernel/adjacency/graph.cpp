@@ -62,6 +62,17 @@ namespace FEAT
 
     {}
 
+    // "Move-Vector" Constructor
+    Graph::Graph(
+      Index num_nodes_image,
+      IndexVector&& domain_ptr,
+      IndexVector&& image_idx)
+      :
+      _num_nodes_image(num_nodes_image),
+      _domain_ptr(std::move(domain_ptr)),
+      _image_idx(std::move(image_idx))
+    {}
+
 
     // move ctor
     Graph::Graph(Graph&& other) :
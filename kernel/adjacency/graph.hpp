@@ -14,6 +14,7 @@
 #include <kernel/util/exception.hpp>
 
 // includes, system
+#include <algorithm>
 #include <vector>
 
 namespace FEAT
@@ -65,6 +66,9 @@ namespace FEAT
        */
       IndexVector _image_idx;
 
+      /// minimum number of domain nodes for multi-threaded rendering
+      static constexpr Index _min_parallel_nodes = Index(4096);
+
 
     public:
 
@@ -143,6 +147,25 @@ namespace FEAT
         const IndexVector& domain_ptr,
         const IndexVector& image_idx);
 
+      /**
+       * \brief "Move-Vector" Constructor
+       *
+       * This constructor creates a new graph by taking over the vectors passed to this function.
+       *
+       * \param[in] num_nodes_image
+       * The total number of image nodes for the graph.
+       *
+       * \param[in] domain_ptr
+       * The domain pointer vector for the graph.
+       *
+       * \param[in] image_idx
+       * The image node index vector for the graph.
+       */
+      explicit Graph(
+        Index num_nodes_image,
+        IndexVector&& domain_ptr,
+        IndexVector&& image_idx);
+
       /**
        * \brief Render constructor
        *
@@ -444,164 +467,36 @@ namespace FEAT
       template<typename Adjactor_>
       void _render_injectify(const Adjactor_& adj)
       {
-        // get counts
-        _num_nodes_image = adj.get_num_nodes_image();
-        Index num_indices_image = 0;
-
-        // allocate pointer vector
-        _domain_ptr = IndexVector(adj.get_num_nodes_domain() + 1);
-
-        // allocate auxiliary mask vector
-        std::vector<char> vidx_mask(adj.get_num_nodes_image(),0);
-        char* idx_mask = vidx_mask.data();
-
-        // count number of adjacencies and build pointer vector
-        for(Index i(0); i < adj.get_num_nodes_domain(); ++i)
-        {
-          _domain_ptr[i] = num_indices_image;
-          for(auto it = adj.image_begin(i); it != adj.image_end(i); ++it)
+        _render_injectify_impl(adj.get_num_nodes_domain(), adj.get_num_nodes_image(),
+          [&adj](Index i, auto&& func)
           {
-            if(idx_mask[*it] == 0)
-            {
-              ++num_indices_image;
-              idx_mask[*it] = 1;
-            }
-          }
-          for(auto it = adj.image_begin(i); it != adj.image_end(i); ++it)
-            idx_mask[*it] = 0;
-        }
-        _domain_ptr[adj.get_num_nodes_domain()] = num_indices_image;
-
-        // allocate and build index vector
-        _image_idx = IndexVector(num_indices_image);
-        for(Index i(0); i < adj.get_num_nodes_domain(); ++i)
-        {
-          Index k = _domain_ptr[i];
-          for(auto it = adj.image_begin(i); it != adj.image_end(i); ++it)
-          {
-            if(idx_mask[*it] == 0)
-            {
-              _image_idx[k] = *it;
-              ++k;
-              idx_mask[*it] = 1;
-            }
-          }
-          for(auto it = adj.image_begin(i); it != adj.image_end(i); ++it)
-            idx_mask[*it] = 0;
-        }
+            for(auto it = adj.image_begin(i); it != adj.image_end(i); ++it)
+              func(Index(*it));
+          });
       }
 
       /// renders transposed adjactor
       template<typename Adjactor_>
       void _render_transpose(const Adjactor_& adj)
       {
-        typedef typename Adjactor_::ImageIterator AImIt;
-
-        // get counts
-        _num_nodes_image = adj.get_num_nodes_domain();
-        Index num_indices_image = 0;
-
-        // allocate and format pointer vector
-        _domain_ptr = IndexVector(adj.get_num_nodes_image() + 1,Index(0));
-
-        // count number of adjacencies
-        for(Index j(0); j < adj.get_num_nodes_domain(); ++j)
-        {
-          AImIt cur(adj.image_begin(j));
-          AImIt end(adj.image_end(j));
-          for(; cur != end; ++cur)
-          {
-            ++_domain_ptr[(*cur) + 1];
-          }
-        }
-
-        // build pointer vector
-        for(Index i(0); i < adj.get_num_nodes_image(); ++i)
-        {
-          _domain_ptr[i+1] += _domain_ptr[i];
-        }
-        num_indices_image = _domain_ptr[adj.get_num_nodes_image()];
-
-        // allocate and build index vector
-        _image_idx = IndexVector(num_indices_image);
-        std::vector<Index*> vimg_ptr(adj.get_num_nodes_image(), nullptr);
-        Index** image_ptr = vimg_ptr.data();
-        Index* image_idx = _image_idx.data();
-        for(Index i(0); i < adj.get_num_nodes_image(); ++i)
-        {
-          image_ptr[i] = &image_idx[_domain_ptr[i]];
-        }
-
-        for(Index j(0); j < adj.get_num_nodes_domain(); ++j)
-        {
-          AImIt cur(adj.image_begin(j));
-          AImIt end(adj.image_end(j));
-          for(; cur != end; ++cur)
+        _render_transpose_impl<false>(adj.get_num_nodes_domain(), adj.get_num_nodes_image(),
+          [&adj](Index i, auto&& func)
           {
-            Index*& idx = image_ptr[*cur];
-            *idx = j;
-            ++idx;
-          }
-        }
+            for(auto it = adj.image_begin(i); it != adj.image_end(i); ++it)
+              func(Index(*it));
+          });
       }
 
       /// renders transposed injectified adjactor
       template<typename Adjactor_>
       void _render_injectify_transpose(const Adjactor_& adj)
       {
-        // get counts
-        _num_nodes_image = adj.get_num_nodes_domain();
-        Index num_indices_image = 0;
-
-        // allocate pointer vector
-        _domain_ptr =IndexVector(adj.get_num_nodes_image() + 1,0);
-        // allocate auxiliary mask vector
-        std::vector<char> vidx_mask(adj.get_num_nodes_image(), 0);
-        char* idx_mask = vidx_mask.data();
-
-        // loop over all image nodes
-        for(Index j(0); j < adj.get_num_nodes_domain(); ++j)
-        {
-          for(auto it = adj.image_begin(j); it != adj.image_end(j); ++it)
+        _render_transpose_impl<true>(adj.get_num_nodes_domain(), adj.get_num_nodes_image(),
+          [&adj](Index i, auto&& func)
           {
-            if(idx_mask[*it] == 0)
-            {
-              ++num_indices_image;
-              ++_domain_ptr[(*it)+1];
-              idx_mask[*it] = 1;
-            }
-          }
-          for(auto it = adj.image_begin(j); it != adj.image_end(j); ++it)
-            idx_mask[*it] = 0;
-        }
-
-        _image_idx = IndexVector(num_indices_image);
-        std::vector<Index*> vimg_ptr(adj.get_num_nodes_image(), nullptr);
-        Index** image_ptr = vimg_ptr.data();
-        Index* image_idx = _image_idx.data();
-        // build pointer vectors
-        for(Index i(0); i <adj.get_num_nodes_image(); ++i)
-        {
-          _domain_ptr[i+1] += _domain_ptr[i];
-          image_ptr[i] = &image_idx[_domain_ptr[i]];
-        }
-
-        // build image index vector
-        for(Index j(0); j < adj.get_num_nodes_domain(); ++j)
-        {
-          for(auto it = adj.image_begin(j); it != adj.image_end(j); ++it)
-          {
-            if(idx_mask[*it] == 0)
-            {
-              Index*& idx = image_ptr[*it];
-              *idx = j;
-              ++idx;
-              idx_mask[*it] = 1;
-            }
-          }
-          for(auto it = adj.image_begin(j); it != adj.image_end(j); ++it)
-            idx_mask[*it] = 0;
-        }
+            for(auto it = adj.image_begin(i); it != adj.image_end(i); ++it)
+              func(Index(*it));
+          });
       }
 
       /// renders adjactor composition
@@ -673,61 +568,13 @@ namespace FEAT
         // validate adjactor dimensions
         XASSERTM(adj1.get_num_nodes_image() == adj2.get_num_nodes_domain(), "Adjactor dimension mismatch!");
 
-        // get counts
-        _num_nodes_image = adj2.get_num_nodes_image();
-        Index num_indices_image = 0;
-
-        // allocate pointer vector
-        _domain_ptr =IndexVector(adj1.get_num_nodes_domain() + 1);
-
-        // allocate auxiliary mask vector
-        std::vector<char> vidx_mask(adj2.get_num_nodes_image(), 0);
-        char* idx_mask = vidx_mask.data();
-
-        // count number of adjacencies and build pointer vector
-        for(Index i(0); i < adj1.get_num_nodes_domain(); ++i)
-        {
-          _domain_ptr[i] = num_indices_image;
-          for(auto it = adj1.image_begin(i); it != adj1.image_end(i); ++it)
-          {
-            for(auto jt = adj2.image_begin(*it); jt != adj2.image_end(*it); ++jt)
-            {
-              if(idx_mask[*jt] == 0)
-              {
-                ++num_indices_image;
-                idx_mask[*jt] = 1;
-              }
-            }
-          }
-          // reset mask
-          for(auto it = adj1.image_begin(i); it != adj1.image_end(i); ++it)
-            for(auto jt = adj2.image_begin(*it); jt != adj2.image_end(*it); ++jt)
-              idx_mask[*jt] = 0;
-        }
-        _domain_ptr[adj1.get_num_nodes_domain()] = num_indices_image;
-
-        // allocate and build index vector
-        _image_idx = IndexVector(num_indices_image);
-        for(Index i(0); i < adj1.get_num_nodes_domain(); ++i)
-        {
-          Index k = _domain_ptr[i];
-          for(auto it = adj1.image_begin(i); it != adj1.image_end(i); ++it)
+        _render_injectify_impl(adj1.get_num_nodes_domain(), adj2.get_num_nodes_image(),
+          [&adj1, &adj2](Index i, auto&& func)
           {
-            for(auto jt = adj2.image_begin(*it); jt != adj2.image_end(*it); ++jt)
-            {
-              if(idx_mask[*jt] == 0)
-              {
-                _image_idx[k] = *jt;
-                ++k;
-                idx_mask[*jt] = 1;
-              }
-            }
-          }
-          // reset mask
-          for(auto it = adj1.image_begin(i); it != adj1.image_end(i); ++it)
-            for(auto jt = adj2.image_begin(*it); jt != adj2.image_end(*it); ++jt)
-              idx_mask[*jt] = 0;
-        }
+            for(auto it = adj1.image_begin(i); it != adj1.image_end(i); ++it)
+              for(auto jt = adj2.image_begin(*it); jt != adj2.image_end(*it); ++jt)
+                func(Index(*jt));
+          });
       }
 
       /// renders transposed adjactor composition
@@ -741,66 +588,13 @@ namespace FEAT
         // validate adjactor dimensions
         XASSERTM(adj1.get_num_nodes_image() == adj2.get_num_nodes_domain(), "Adjactor dimension mismatch!");
 
-        typedef typename Adjactor1_::ImageIterator AImIt1;
-        typedef typename Adjactor2_::ImageIterator AImIt2;
-
-        // get counts
-        _num_nodes_image = adj1.get_num_nodes_domain();
-        Index num_indices_image = 0;
-
-        // allocate and format pointer vector
-        _domain_ptr =IndexVector(adj2.get_num_nodes_image() + 1,Index(0));
-
-        // count number of adjacencies
-        for(Index j(0); j < adj1.get_num_nodes_domain(); ++j)
-        {
-          AImIt1 cur1(adj1.image_begin(j));
-          AImIt1 end1(adj1.image_end(j));
-          for(; cur1 != end1; ++cur1)
+        _render_transpose_impl<false>(adj1.get_num_nodes_domain(), adj2.get_num_nodes_image(),
+          [&adj1, &adj2](Index i, auto&& func)
           {
-            AImIt2 cur2(adj2.image_begin(*cur1));
-            AImIt2 end2(adj2.image_end(*cur1));
-            for(; cur2 != end2; ++cur2)
-            {
-              ++_domain_ptr[(*cur2) + 1];
-            }
-          }
-        }
-
-        // build pointer vector
-        for(Index i(0); i < adj2.get_num_nodes_image(); ++i)
-        {
-          _domain_ptr[i+1] += _domain_ptr[i];
-        }
-        num_indices_image = _domain_ptr[adj2.get_num_nodes_image()];
-
-        // allocate and build index vector
-        _image_idx =IndexVector(num_indices_image);
-        std::vector<Index*> vimg_ptr(adj2.get_num_nodes_image(), nullptr);
-        Index** image_ptr = vimg_ptr.data();
-        Index* image_idx = _image_idx.data();
-
-        for(Index i(0); i < adj2.get_num_nodes_image(); ++i)
-        {
-          image_ptr[i] = &image_idx[_domain_ptr[i]];
-        }
-
-        for(Index j(0); j < adj1.get_num_nodes_domain(); ++j)
-        {
-          AImIt1 cur1(adj1.image_begin(j));
-          AImIt1 end1(adj1.image_end(j));
-          for(; cur1 != end1; ++cur1)
-          {
-            AImIt2 cur2(adj2.image_begin(*cur1));
-            AImIt2 end2(adj2.image_end(*cur1));
-            for(; cur2 != end2; ++cur2)
-            {
-              Index*& idx = image_ptr[*cur2];
-              *idx = j;
-              ++idx;
-            }
-          }
-        }
+            for(auto it = adj1.image_begin(i); it != adj1.image_end(i); ++it)
+              for(auto jt = adj2.image_begin(*it); jt != adj2.image_end(*it); ++jt)
+                func(Index(*jt));
+          });
       }
 
       /// renders transposed injectified adjactor composition
@@ -814,71 +608,171 @@ namespace FEAT
         // validate adjactor dimensions
         XASSERTM(adj1.get_num_nodes_image() == adj2.get_num_nodes_domain(), "Adjactor dimension mismatch!");
 
+        _render_transpose_impl<true>(adj1.get_num_nodes_domain(), adj2.get_num_nodes_image(),
+          [&adj1, &adj2](Index i, auto&& func)
+          {
+            for(auto it = adj1.image_begin(i); it != adj1.image_end(i); ++it)
+              for(auto jt = adj2.image_begin(*it); jt != adj2.image_end(*it); ++jt)
+                func(Index(*jt));
+          });
+      }
+
+      /**
+       * \brief Renders an injectified adjacency in parallel
+       *
+       * The domain nodes are distributed over all OpenMP threads and each thread uses its own
+       * image node mask, so the resulting graph is identical to the one rendered by a single thread,
+       * i.e. the image nodes of each domain node are stored in the order of their first occurrence.
+       *
+       * \param[in] num_nodes_domain, num_nodes_image
+       * The dimensions of the adjacency to be rendered.
+       *
+       * \param[in] image_func
+       * A functor which, when called as <c>image_func(i, func)</c>, calls <c>func(j)</c> for each
+       * (possibly duplicate) image node \e j adjacent to the domain node \e i.
+       */
+      template<typename ImageFunc_>
+      void _render_injectify_impl(const Index num_nodes_domain, const Index num_nodes_image, const ImageFunc_& image_func)
+      {
         // get counts
-        _num_nodes_image = adj1.get_num_nodes_domain();
-        Index num_indices_image = 0;
+        _num_nodes_image = num_nodes_image;
 
         // allocate pointer vector
+        _domain_ptr = IndexVector(num_nodes_domain + 1, Index(0));
+        Index* domain_ptr = _domain_ptr.data();
+
+        FEAT_PRAGMA_OMP(parallel if(num_nodes_domain >= _min_parallel_nodes))
+        {
+          // allocate auxiliary mask vector
+          std::vector<char> vidx_mask(num_nodes_image, 0);
+          char* idx_mask = vidx_mask.data();
 
-        _domain_ptr = IndexVector(adj2.get_num_nodes_image() +1,Index(0));
+          // count number of adjacencies
+          FEAT_PRAGMA_OMP(for schedule(dynamic, 1024))
+          for(Index i = 0; i < num_nodes_domain; ++i)
+          {
+            Index count(0);
+            image_func(i, [&](Index j) {if(idx_mask[j] == 0) {++count; idx_mask[j] = 1;}});
+            image_func(i, [&](Index j) {idx_mask[j] = 0;});
+            domain_ptr[i+1] = count;
+          }
 
-        // allocate auxiliary mask vector
-        std::vector<char> vidx_mask(adj2.get_num_nodes_image(), 0);
-        char* idx_mask = vidx_mask.data();
+          // build pointer vector and allocate index vector
+          FEAT_PRAGMA_OMP(single)
+          {
+            for(Index i(0); i < num_nodes_domain; ++i)
+              domain_ptr[i+1] += domain_ptr[i];
+            _image_idx = IndexVector(domain_ptr[num_nodes_domain]);
+          }
 
-        // loop over all image nodes
-        for(Index j(0); j < adj1.get_num_nodes_domain(); ++j)
-        {
-          for(auto it = adj1.image_begin(j); it != adj1.image_end(j); ++it)
+          // build index vector
+          Index* image_idx = _image_idx.data();
+          FEAT_PRAGMA_OMP(for schedule(dynamic, 1024))
+          for(Index i = 0; i < num_nodes_domain; ++i)
           {
-            for(auto jt = adj2.image_begin(*it); jt != adj2.image_end(*it); ++jt)
-            {
-              if(idx_mask[*jt] == 0)
-              {
-                ++num_indices_image;
-                ++_domain_ptr[(*jt)+1];
-                idx_mask[*jt] = 1;
-              }
-            }
+            Index k = domain_ptr[i];
+            image_func(i, [&](Index j) {if(idx_mask[j] == 0) {image_idx[k++] = j; idx_mask[j] = 1;}});
+            image_func(i, [&](Index j) {idx_mask[j] = 0;});
           }
-          // reset mask
-          for(auto it = adj1.image_begin(j); it != adj1.image_end(j); ++it)
-            for(auto jt = adj2.image_begin(*it); jt != adj2.image_end(*it); ++jt)
-              idx_mask[*jt] = 0;
         }
+      }
 
-        _image_idx = IndexVector(num_indices_image);
-        std::vector<Index*> vimg_ptr(adj2.get_num_nodes_image(), nullptr);
-        Index** image_ptr = vimg_ptr.data();
-        Index* image_idx = _image_idx.data();
+      /**
+       * \brief Renders a (injectified) transposed adjacency in parallel
+       *
+       * The adjacencies are counted and inserted by atomic operations, so the image nodes of each
+       * domain node may be inserted in arbitrary order; those rows, which are not sorted afterwards,
+       * are sorted, so the resulting graph is identical to the one rendered by a single thread.
+       *
+       * \tparam injectify_
+       * Specifies whether the adjacency is to be injectified.
+       *
+       * \param[in] num_nodes_domain, num_nodes_image
+       * The dimensions of the adjacency to be transposed.
+       *
+       * \param[in] image_func
+       * A functor which, when called as <c>image_func(i, func)</c>, calls <c>func(j)</c> for each
+       * (possibly duplicate) image node \e j adjacent to the domain node \e i.
+       */
+      template<bool injectify_, typename ImageFunc_>
+      void _render_transpose_impl(const Index num_nodes_domain, const Index num_nodes_image, const ImageFunc_& image_func)
+      {
+        // get counts
+        _num_nodes_image = num_nodes_domain;
 
-        // build pointer vector
-        for(Index i(0); i < adj2.get_num_nodes_image(); ++i)
-        {
-          _domain_ptr[i+1] += _domain_ptr[i];
-          image_ptr[i] = &image_idx[_domain_ptr[i]];
-        }
+        // allocate and format pointer vector
+        _domain_ptr = IndexVector(num_nodes_image + 1, Index(0));
+        Index* domain_ptr = _domain_ptr.data();
 
-        // build image index vector
-        for(Index j(0); j < adj1.get_num_nodes_domain(); ++j)
+        // next insertion position for each image node
+        IndexVector vimg_pos(num_nodes_image, Index(0));
+        Index* image_pos = vimg_pos.data();
+
+        FEAT_PRAGMA_OMP(parallel if(num_nodes_domain >= _min_parallel_nodes))
         {
-          for(auto it = adj1.image_begin(j); it != adj1.image_end(j); ++it)
+          // allocate auxiliary mask vector
+          std::vector<char> vidx_mask(injectify_ ? num_nodes_image : Index(0), 0);
+          char* idx_mask = vidx_mask.data();
+
+          // count number of adjacencies
+          FEAT_PRAGMA_OMP(for schedule(dynamic, 1024))
+          for(Index i = 0; i < num_nodes_domain; ++i)
           {
-            for(auto jt = adj2.image_begin(*it); jt != adj2.image_end(*it); ++jt)
+            image_func(i, [&](Index j)
             {
-              if(idx_mask[*jt] == 0)
+              if constexpr(injectify_)
               {
-                Index*& idx = image_ptr[*jt];
-                *idx = j;
-                ++idx;
-                idx_mask[*jt] = 1;
+                if(idx_mask[j] != 0)
+                  return;
+                idx_mask[j] = 1;
               }
+              FEAT_PRAGMA_OMP(atomic)
+              ++domain_ptr[j+1];
+            });
+            if constexpr(injectify_)
+              image_func(i, [&](Index j) {idx_mask[j] = 0;});
+          }
+
+          // build pointer vector and allocate index vector
+          FEAT_PRAGMA_OMP(single)
+          {
+            for(Index j(0); j < num_nodes_image; ++j)
+            {
+              domain_ptr[j+1] += domain_ptr[j];
+              image_pos[j] = domain_ptr[j];
             }
+            _image_idx = IndexVector(domain_ptr[num_nodes_image]);
+          }
+
+          // build index vector
+          Index* image_idx = _image_idx.data();
+          FEAT_PRAGMA_OMP(for schedule(dynamic, 1024))
+          for(Index i = 0; i < num_nodes_domain; ++i)
+          {
+            image_func(i, [&](Index j)
+            {
+              if constexpr(injectify_)
+              {
+                if(idx_mask[j] != 0)
+                  return;
+                idx_mask[j] = 1;
+              }
+              Index pos;
+              FEAT_PRAGMA_OMP(atomic capture)
+              pos = image_pos[j]++;
+              image_idx[pos] = i;
+            });
+            if constexpr(injectify_)
+              image_func(i, [&](Index j) {idx_mask[j] = 0;});
+          }
+
+          // restore the ascending order of the domain nodes
+          FEAT_PRAGMA_OMP(for schedule(dynamic, 1024))
+          for(Index j = 0; j < num_nodes_image; ++j)
+          {
+            if(!std::is_sorted(&image_idx[domain_ptr[j]], &image_idx[domain_ptr[j+1]]))
+              std::sort(&image_idx[domain_ptr[j]], &image_idx[domain_ptr[j+1]]);
           }
-          // reset mask
-          for(auto it = adj1.image_begin(j); it != adj1.image_end(j); ++it)
-            for(auto jt = adj2.image_begin(*it); jt != adj2.image_end(*it); ++jt)
-              idx_mask[*jt] = 0;
         }
       }
 
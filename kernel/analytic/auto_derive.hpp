@@ -28,6 +28,12 @@ namespace FEAT
         {
           return func_eval.gradient(point);
         }
+
+        template<typename DT_, typename FuncEval_, typename AutoDer_>
+        static void wrap_batch(typename AutoDer_::GradientType* grads, const DT_* coords, int num_points, FuncEval_& func_eval, AutoDer_&)
+        {
+          Analytic::eval_gradient_batch(func_eval, grads, coords, num_points);
+        }
       };
 
       template<>
@@ -38,6 +44,12 @@ namespace FEAT
         {
           return auto_der.extrapol_grad(point);
         }
+
+        template<typename DT_, typename FuncEval_, typename AutoDer_>
+        static void wrap_batch(typename AutoDer_::GradientType* grads, const DT_* coords, int num_points, FuncEval_&, AutoDer_& auto_der)
+        {
+          auto_der.extrapol_grad_batch(grads, coords, num_points);
+        }
       };
 
       template<bool wrap_>
@@ -48,6 +60,12 @@ namespace FEAT
         {
           return func_eval.hessian(point);
         }
+
+        template<typename DT_, typename FuncEval_, typename AutoDer_>
+        static void wrap_batch(typename AutoDer_::HessianType* hessians, const DT_* coords, int num_points, FuncEval_& func_eval, AutoDer_&)
+        {
+          Analytic::eval_hessian_batch(func_eval, hessians, coords, num_points);
+        }
       };
 
       template<>
@@ -58,6 +76,12 @@ namespace FEAT
         {
           return auto_der.extrapol_hess(point);
         }
+
+        template<typename DT_, typename FuncEval_, typename AutoDer_>
+        static void wrap_batch(typename AutoDer_::HessianType* hessians, const DT_* coords, int num_points, FuncEval_&, AutoDer_& auto_der)
+        {
+          auto_der.extrapol_hess_batch(hessians, coords, num_points);
+        }
       };
     } // namespace Intern
     /// \endcond
@@ -79,6 +103,12 @@ namespace FEAT
      * additionally provides the numerical computation of hessians, but uses the
      * original function's evaluator for the computation of gradients.
      *
+     * \note
+     * The batch evaluation functions gradient_batch() and hessian_batch() perform the extrapolation
+     * for all points of the batch simultaneously: in each extrapolation step, the difference stencils
+     * of all points, which have not converged yet, are evaluated by a single call of the original
+     * evaluator's value_batch() function. The results are identical to the point-wise evaluation.
+     *
      * \tparam Function_
      * The function to which the numerical computation of gradients and/or hessians is
      * to be added. This function will be used as a base-class for this template instance.
@@ -138,6 +168,16 @@ namespace FEAT
         const DataType _init_grad_h;
         /// initial h for hessian extrapolation
         const DataType _init_hess_h;
+        /// batch extrapolation tables of all points
+        std::vector<GradientType> _batch_grad;
+        std::vector<HessianType> _batch_hess;
+        /// indices of all batch points whose extrapolation has not terminated yet
+        std::vector<int> _batch_act;
+        /// extrapolation defects of all batch points
+        std::vector<DataType> _batch_def;
+        /// difference stencil points in SoA layout and the function values in these points
+        std::vector<DataType> _batch_coords;
+        std::vector<ValueType> _batch_vals;
 
       public:
         /// mandatory CTOR
@@ -155,6 +195,12 @@ namespace FEAT
           return _func_eval.value(point);
         }
 
+        /// Evaluates the function values in a batch of points by the original evaluator
+        void value_batch(ValueType* values, const DataType* coords, int num_points)
+        {
+          Analytic::eval_value_batch(_func_eval, values, coords, num_points);
+        }
+
         GradientType gradient(const PointType& point)
         {
           // Depending on whether the original function can compute gradients,
@@ -171,6 +217,18 @@ namespace FEAT
           return Intern::AutoDeriveHessWrapper<Function_::can_hess>::wrap(point, _func_eval, *this);
         }
 
+        /// Evaluates the function gradients in a batch of points
+        void gradient_batch(GradientType* grads, const DataType* coords, int num_points)
+        {
+          Intern::AutoDeriveGradWrapper<Function_::can_grad>::wrap_batch(grads, coords, num_points, _func_eval, *this);
+        }
+
+        /// Evaluates the function hessians in a batch of points
+        void hessian_batch(HessianType* hessians, const DataType* coords, int num_points)
+        {
+          Intern::AutoDeriveHessWrapper<Function_::can_hess>::wrap_batch(hessians, coords, num_points, _func_eval, *this);
+        }
+
         /**
          * \brief Computes the gradient by a Richardson extrapolation scheme.
          */
@@ -281,7 +339,196 @@ namespace FEAT
           return _hess.front();
         }
 
+        /**
+         * \brief Computes the gradients in a batch of points by a Richardson extrapolation scheme.
+         */
+        void extrapol_grad_batch(GradientType* grads, const DataType* coords, int num_points)
+        {
+          _extrapol_batch(grads, _batch_grad, coords, num_points, _grad.size(), _init_grad_h,
+            [this](std::size_t l, const DataType* c, int n, DataType h) {this->_eval_grad_quot_batch(l, c, n, h);});
+        }
+
+        /**
+         * \brief Computes the hessians in a batch of points by a Richardson extrapolation scheme.
+         */
+        void extrapol_hess_batch(HessianType* hessians, const DataType* coords, int num_points)
+        {
+          _extrapol_batch(hessians, _batch_hess, coords, num_points, _hess.size(), _init_hess_h,
+            [this](std::size_t l, const DataType* c, int n, DataType h) {this->_eval_hess_quot_batch(l, c, n, h);});
+        }
+
       protected:
+        /**
+         * \brief Performs the Richardson extrapolation for a batch of points
+         *
+         * This function performs the same steps as extrapol_grad() and extrapol_hess() for each point,
+         * but it evaluates the difference quotients of all active points of each step at once.
+         *
+         * \param[out] results
+         * Receives the extrapolated derivatives of all points.
+         *
+         * \param[in] tab
+         * The extrapolation table of all points, which is filled by \p eval_quot.
+         *
+         * \param[in] eval_quot
+         * A functor that evaluates the difference quotients of level \c l for all active points.
+         */
+        template<typename Tab_, typename EvalQuot_>
+        void _extrapol_batch(Tab_* results, std::vector<Tab_>& tab, const DataType* coords, int num_points,
+          const std::size_t num_steps, DataType h, EvalQuot_&& eval_quot)
+        {
+          tab.resize(std::size_t(num_points) * num_steps);
+          _batch_def.assign(std::size_t(num_points), Math::huge<DataType>());
+          _batch_act.resize(std::size_t(num_points));
+          for(int k(0); k < num_points; ++k)
+            _batch_act[std::size_t(k)] = k;
+
+          // evaluate initial difference quotients
+          eval_quot(std::size_t(0), coords, num_points, h);
+
+          // Now comes the Richardson extrapolation loop
+          const std::size_t n(num_steps-1);
+          for(std::size_t i(0); (i < n) && !_batch_act.empty(); ++i)
+          {
+            // evaluate next difference quotients of all active points
+            eval_quot(i+1, coords, num_points, h *= DataType(0.5));
+
+            std::size_t num_act(0);
+            for(std::size_t a(0); a < _batch_act.size(); ++a)
+            {
+              const std::size_t p = std::size_t(_batch_act[a]);
+              Tab_* t = &tab[p * num_steps];
+
+              // initialize scaling fator
+              DataType q = DataType(1);
+
+              // perform extrapolation steps except for the last one
+              for(std::size_t k(i); k > std::size_t(0); --k)
+              {
+                q *= DataType(4);
+                (t[k] -= q*t[k+1]) *= DataType(1) / (DataType(1) - q);
+              }
+
+              // compute and check our defect; the point is finished if the defect has increased
+              DataType d = def_norm_sqr(t[1], t[0]);
+              if(_batch_def[p] <= d)
+                continue;
+
+              // remember current defect
+              _batch_def[p] = d;
+
+              // perform last extrapolation step
+              q *= DataType(4);
+              (t[0] -= q*t[1]) *= DataType(1) / (DataType(1) - q);
+
+              // this point remains active
+              _batch_act[num_act++] = int(p);
+            }
+            _batch_act.resize(num_act);
+          }
+
+          // return our extrapolated derivatives
+          for(int k(0); k < num_points; ++k)
+            results[k] = tab[std::size_t(k) * num_steps];
+        }
+
+        /// sets the s-th difference stencil point of all active points, i.e. x + di*e_i + dj*e_j
+        void _set_stencil_points(int s, int num_stencil, const DataType* coords, int num_points,
+          int i, DataType di, int j, DataType dj)
+        {
+          const int na = int(_batch_act.size());
+          const int np = num_stencil * na;
+          for(int c(0); c < domain_dim; ++c)
+          {
+            DataType* sc = &_batch_coords[std::size_t(c*np + s*na)];
+            const DataType* pc = &coords[c*num_points];
+            for(int a(0); a < na; ++a)
+            {
+              const DataType x = pc[_batch_act[std::size_t(a)]];
+              sc[a] = (c == i ? x + di : (c == j ? x + dj : x));
+            }
+          }
+        }
+
+        /// evaluates the function in all difference stencil points of all active points
+        void _eval_stencil_values(int num_stencil)
+        {
+          const int np = num_stencil * int(_batch_act.size());
+          _batch_vals.resize(std::size_t(np));
+          Analytic::eval_value_batch(_func_eval, _batch_vals.data(), _batch_coords.data(), np);
+        }
+
+        /// evaluates the first-order difference quotients of level l for all active points
+        void _eval_grad_quot_batch(std::size_t l, const DataType* coords, int num_points, const DataType h)
+        {
+          // stencil: f(v + h*e_i), f(v - h*e_i) for all i
+          const int num_stencil = 2*domain_dim;
+          const int na = int(_batch_act.size());
+          _batch_coords.resize(std::size_t(domain_dim * num_stencil * na));
+          for(int i(0); i < domain_dim; ++i)
+          {
+            _set_stencil_points(2*i,   num_stencil, coords, num_points, i,  h, -1, DataType(0));
+            _set_stencil_points(2*i+1, num_stencil, coords, num_points, i, -h, -1, DataType(0));
+          }
+          _eval_stencil_values(num_stencil);
+
+          // difference quotient denominator
+          const DataType denom = DataType(1) / (DataType(2) * h);
+          const std::size_t num_steps = _grad.size();
+          for(int a(0); a < na; ++a)
+          {
+            GradientType& x = _batch_grad[std::size_t(_batch_act[std::size_t(a)]) * num_steps + l];
+            for(int i(0); i < domain_dim; ++i)
+              _set_grad_quot(x, i, _batch_vals[std::size_t((2*i)*na + a)], _batch_vals[std::size_t((2*i+1)*na + a)], denom);
+          }
+        }
+
+        /// evaluates the second-order difference quotients of level l for all active points
+        void _eval_hess_quot_batch(std::size_t l, const DataType* coords, int num_points, const DataType h)
+        {
+          // stencil: f(v), then for all i: f(v + h*e_i), f(v - h*e_i) followed by
+          // f(v +- h*e_i +- h*e_j) for all j > i in the same order as _eval_hess_quot()
+          const int num_stencil = 1 + 2*domain_dim + 2*domain_dim*(domain_dim-1);
+          const int na = int(_batch_act.size());
+          _batch_coords.resize(std::size_t(domain_dim * num_stencil * na));
+          int s(0);
+          _set_stencil_points(s++, num_stencil, coords, num_points, -1, DataType(0), -1, DataType(0));
+          for(int i(0); i < domain_dim; ++i)
+          {
+            _set_stencil_points(s++, num_stencil, coords, num_points, i,  h, -1, DataType(0));
+            _set_stencil_points(s++, num_stencil, coords, num_points, i, -h, -1, DataType(0));
+            for(int j(i+1); j < domain_dim; ++j)
+            {
+              _set_stencil_points(s++, num_stencil, coords, num_points, i,  h, j,  h);
+              _set_stencil_points(s++, num_stencil, coords, num_points, i, -h, j,  h);
+              _set_stencil_points(s++, num_stencil, coords, num_points, i,  h, j, -h);
+              _set_stencil_points(s++, num_stencil, coords, num_points, i, -h, j, -h);
+            }
+          }
+          _eval_stencil_values(num_stencil);
+
+          // difference quotient denominators
+          const DataType denom1 = DataType(1) / (h * h);
+          const DataType denom2 = DataType(1) / (DataType(4) * h * h);
+          const std::size_t num_steps = _hess.size();
+          for(int a(0); a < na; ++a)
+          {
+            HessianType& x = _batch_hess[std::size_t(_batch_act[std::size_t(a)]) * num_steps + l];
+            auto val = [&](int t) -> const ValueType& {return _batch_vals[std::size_t(t*na + a)];};
+            int t(1);
+            for(int i(0); i < domain_dim; ++i, t += 2)
+            {
+              _set_hess_quot(x, i, val(t), val(t+1), val(0), denom1);
+              for(int j(i+1); j < domain_dim; ++j)
+              {
+                // north-east, north-west, south-east, south-west
+                _set_hess_quot(x, i, j, val(t+2), val(t+5), val(t+3), val(t+4), denom2);
+                t += 4;
+              }
+            }
+          }
+        }
+
         template<int n_, int s_>
         static DataType def_norm_sqr(
           const Tiny::Vector<DataType, n_, s_>& x, const Tiny::Vector<DataType, n_, s_>& y)
@@ -0,0 +1,187 @@
+// FEAT3: Finite Element Analysis Toolbox, Version 3
+// Copyright (C) 2010 - 2023 by Stefan Turek & the FEAT group
+// FEAT3 is released under the GNU General Public License version 3,
+// see the file 'copyright.txt' in the top level directory for details.
+
+#include <test_system/test_system.hpp>
+#include <kernel/analytic/common.hpp>
+#include <kernel/analytic/auto_derive.hpp>
+#include <kernel/analytic/lambda_function.hpp>
+#include <kernel/analytic/wrappers.hpp>
+
+using namespace FEAT;
+using namespace FEAT::TestSystem;
+using namespace FEAT::Analytic;
+
+/// a wrapper that hides the derivatives of another function
+template<typename Function_>
+class ValueOnlyFunction :
+  public Analytic::Function
+{
+public:
+  static constexpr int domain_dim = Function_::domain_dim;
+  typedef typename Function_::ImageType ImageType;
+  static constexpr bool can_value = true;
+  static constexpr bool can_grad = false;
+  static constexpr bool can_hess = false;
+
+  template<typename Traits_>
+  class Evaluator :
+    public Analytic::Function::Evaluator<Traits_>
+  {
+  public:
+    typedef typename Traits_::DataType DataType;
+    typedef typename Traits_::PointType PointType;
+    typedef typename Traits_::ValueType ValueType;
+
+  private:
+    typename Function_::template Evaluator<Analytic::EvalTraits<DataType, Function_>> _func_eval;
+
+  public:
+    explicit Evaluator(const ValueOnlyFunction& function) :
+      _func_eval(function._function)
+    {
+    }
+
+    ValueType value(const PointType& point)
+    {
+      return _func_eval.value(point);
+    }
+  };
+
+private:
+  const Function_& _function;
+
+public:
+  explicit ValueOnlyFunction(const Function_& function) :
+    _function(function)
+  {
+  }
+}; // class ValueOnlyFunction<...>
+
+/**
+ * \brief Test class for the batch evaluation of analytic functions.
+ *
+ * \test Compares the results of the batch evaluation functions with the point-wise evaluation.
+ */
+template<typename DT_, typename IT_>
+class BatchEvalTest :
+  public UnitTest
+{
+public:
+  BatchEvalTest(PreferredBackend backend) :
+    UnitTest("BatchEvalTest", Type::Traits<DT_>::name(), Type::Traits<IT_>::name(), backend)
+  {
+  }
+
+  virtual ~BatchEvalTest()
+  {
+  }
+
+  /// fills a batch with some points in the unit cube
+  template<typename Batch_>
+  static void fill_batch(Batch_& batch, int num_points)
+  {
+    batch.resize(num_points);
+    Tiny::Vector<DT_, Batch_::domain_dim> point;
+    for(int k(0); k < num_points; ++k)
+    {
+      for(int i(0); i < Batch_::domain_dim; ++i)
+        point[i] = DT_(0.5) + DT_(0.5) * Math::sin(DT_(k+1) * DT_(i+2) * DT_(0.37));
+      batch.set_point(k, point);
+    }
+  }
+
+  /// computes the norm of the difference of two scalar hessians
+  template<int n_, int sm_, int sn_>
+  static DT_ hess_diff_norm(const Tiny::Matrix<DT_, n_, n_, sm_, sn_>& a, const Tiny::Matrix<DT_, n_, n_, sm_, sn_>& b)
+  {
+    return (a - b).norm_frobenius();
+  }
+
+  /// computes the norm of the difference of two vector hessians
+  template<int l_, int n_, int sl_, int sm_, int sn_>
+  static DT_ hess_diff_norm(const Tiny::Tensor3<DT_, l_, n_, n_, sl_, sm_, sn_>& a, const Tiny::Tensor3<DT_, l_, n_, n_, sl_, sm_, sn_>& b)
+  {
+    DT_ r(0);
+    for(int i(0); i < l_; ++i)
+      r += Math::sqr(hess_diff_norm(a[i], b[i]));
+    return Math::sqrt(r);
+  }
+
+  template<int max_der_, typename Function_>
+  void test_function(const Function_& function, int num_points) const
+  {
+    typedef Analytic::EvalTraits<DT_, Function_> EvalTraits;
+    typedef typename EvalTraits::PointType PointType;
+    const DT_ tol = Math::pow(Math::eps<DT_>(), DT_(0.8));
+
+    typename Function_::template Evaluator<EvalTraits> func_eval(function);
+
+    Analytic::EvalBatchData<EvalTraits> batch;
+    fill_batch(batch, num_points);
+    batch.template eval<max_der_>(func_eval);
+
+    TEST_CHECK_EQUAL(batch.values.size(), std::size_t(num_points));
+
+    for(int k(0); k < num_points; ++k)
+    {
+      const PointType point = Analytic::Intern::get_batch_point<PointType>(batch.coords.data(), num_points, k);
+      const auto dv = batch.values[std::size_t(k)] - func_eval.value(point);
+      TEST_CHECK_EQUAL_WITHIN_EPS(Math::sqrt(Tiny::dot(dv, dv)), DT_(0), tol);
+      if constexpr(max_der_ >= 1)
+      {
+        const auto dg = batch.grads[std::size_t(k)] - func_eval.gradient(point);
+        TEST_CHECK_EQUAL_WITHIN_EPS(Math::sqrt(Tiny::dot(dg, dg)), DT_(0), tol);
+      }
+      if constexpr(max_der_ >= 2)
+      {
+        TEST_CHECK_EQUAL_WITHIN_EPS(hess_diff_norm(batch.hessians[std::size_t(k)], func_eval.hessian(point)), DT_(0), tol);
+      }
+    }
+  }
+
+  virtual void run() const override
+  {
+    // static wrapper functions offer native batch evaluations
+    typedef Analytic::EvalTraits<DT_, Common::SineBubbleFunction<2>> EvalTraits2D;
+    typedef Common::SineBubbleFunction<2>::template Evaluator<EvalTraits2D> SineBubbleEval2D;
+    TEST_CHECK(Analytic::Intern::EvalHasBatch<SineBubbleEval2D>::value);
+    TEST_CHECK(Analytic::Intern::EvalHasBatch<SineBubbleEval2D>::grad);
+    TEST_CHECK(Analytic::Intern::EvalHasBatch<SineBubbleEval2D>::hess);
+
+    test_function<2>(Common::SineBubbleFunction<1>(), 17);
+    test_function<2>(Common::SineBubbleFunction<2>(), 23);
+    test_function<2>(Common::SineBubbleFunction<3>(), 5);
+    test_function<2>(Common::CosineWaveFunction<3>(), 1);
+    test_function<2>(Common::ExpBubbleFunction<2>(), 11);
+
+    Common::SineBubbleFunction<2> sine_bubble_2d;
+
+    // auto-derive forwards the values to the batch evaluation of the original function
+    test_function<1>(Analytic::AutoDerive<Common::SineBubbleFunction<2>, DT_>(), 9);
+
+    // lambda functions have no native batch evaluation and use the point-wise fallback
+    auto func_s = create_lambda_function_scalar_2d(
+      [](DT_ x, DT_ y) -> DT_ {return x*x*y + DT_(2)*y;},
+      [](DT_ x, DT_ y) -> DT_ {return DT_(2)*x*y;},
+      [](DT_ x, DT_  ) -> DT_ {return x*x + DT_(2);});
+    test_function<1>(func_s, 13);
+
+    auto func_v = create_lambda_function_vector_2d(
+      [](DT_ x, DT_ y) -> DT_ {return x*y;},
+      [](DT_ x, DT_ y) -> DT_ {return x - y*y;});
+    test_function<0>(func_v, 7);
+
+    // auto-derive extrapolates the derivatives of functions that provide values only for the whole batch
+    Common::ExpBubbleFunction<2> exp_bubble_2d;
+    Common::SineBubbleFunction<3> sine_bubble_3d;
+    Analytic::Gradient<Common::SineBubbleFunction<2>> sine_bubble_grad_2d(sine_bubble_2d);
+    test_function<2>(Analytic::AutoDerive<ValueOnlyFunction<Common::ExpBubbleFunction<2>>, DT_>(exp_bubble_2d), 19);
+    test_function<2>(Analytic::AutoDerive<ValueOnlyFunction<Common::SineBubbleFunction<3>>, DT_>(sine_bubble_3d), 6);
+    test_function<2>(Analytic::AutoDerive<ValueOnlyFunction<decltype(sine_bubble_grad_2d)>, DT_>(sine_bubble_grad_2d), 8);
+  }
+};
+
+BatchEvalTest<double, std::uint32_t> batch_eval_test_double_uint32(PreferredBackend::generic);
+BatchEvalTest<float, std::uint32_t> batch_eval_test_float_uint32(PreferredBackend::generic);
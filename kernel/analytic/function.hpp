@@ -11,6 +11,11 @@
 #include <kernel/base_header.hpp>
 #include <kernel/util/tiny_algebra.hpp>
 
+// includes, system
+#include <type_traits>
+#include <utility>
+#include <vector>
+
 namespace FEAT
 {
   /**
@@ -252,6 +257,44 @@ namespace FEAT
         HessianType hessian(const PointType& point)
         {
         }
+
+        /**
+         * \brief Computes the function values in a batch of points.
+         *
+         * This function is optional; if it is not provided by the evaluator, then the
+         * Analytic::eval_value_batch() function will fall back to calling value() for each point.
+         *
+         * \param[out] values
+         * An array of length \p num_points that receives the function values.
+         *
+         * \param[in] coords
+         * The coordinates of the points in SoA layout, i.e. the i-th coordinate of the k-th
+         * point is stored in <c>coords[i*num_points + k]</c>.
+         *
+         * \param[in] num_points
+         * The number of points in the batch.
+         */
+        void value_batch(ValueType* values, const DataType* coords, int num_points)
+        {
+        }
+
+        /**
+         * \brief Computes the function gradients in a batch of points.
+         *
+         * This function is optional; see value_batch() for details.
+         */
+        void gradient_batch(GradientType* grads, const DataType* coords, int num_points)
+        {
+        }
+
+        /**
+         * \brief Computes the function hessians in a batch of points.
+         *
+         * This function is optional; see value_batch() for details.
+         */
+        void hessian_batch(HessianType* hessians, const DataType* coords, int num_points)
+        {
+        }
 #endif // DOXYGEN
       }; // class Function::Evaluator<...>
     }; // class Function
@@ -436,6 +479,267 @@ namespace FEAT
       return eval_hessian(function, p);
     }
 
+    /// \cond internal
+    namespace Intern
+    {
+      /// extracts the k-th point of a batch of points in SoA layout
+      template<typename Point_, typename DT_>
+      inline Point_ get_batch_point(const DT_* coords, int num_points, int k)
+      {
+        Point_ point;
+        for(int i(0); i < Point_::n; ++i)
+          point[i] = coords[i*num_points + k];
+        return point;
+      }
+
+      /// deduces the evaluation traits of a function evaluator from its Function::Evaluator base class
+      template<typename Traits_>
+      Traits_ deduce_eval_traits(const Function::Evaluator<Traits_>*);
+
+      /**
+       * \brief Evaluation traits of a function evaluator
+       *
+       * Many evaluators re-declare the type definitions of their base class as protected members,
+       * so the types have to be taken from the public traits of the Function::Evaluator base class.
+       */
+      template<typename Eval_>
+      using EvalTraitsOf = decltype(deduce_eval_traits(std::declval<Eval_*>()));
+
+      /// helper class to detect whether a function evaluator offers batched evaluations
+      template<typename Eval_>
+      class EvalHasBatch
+      {
+        typedef EvalTraitsOf<Eval_> Traits;
+        typedef typename Traits::DataType DT;
+
+        template<typename T_>
+        static auto test_value(T_* e) -> decltype(e->value_batch(std::declval<typename Traits::ValueType*>(),
+          std::declval<const DT*>(), 0), std::true_type());
+        template<typename>
+        static std::false_type test_value(...);
+
+        template<typename T_>
+        static auto test_grad(T_* e) -> decltype(e->gradient_batch(std::declval<typename Traits::GradientType*>(),
+          std::declval<const DT*>(), 0), std::true_type());
+        template<typename>
+        static std::false_type test_grad(...);
+
+        template<typename T_>
+        static auto test_hess(T_* e) -> decltype(e->hessian_batch(std::declval<typename Traits::HessianType*>(),
+          std::declval<const DT*>(), 0), std::true_type());
+        template<typename>
+        static std::false_type test_hess(...);
+
+      public:
+        static constexpr bool value = decltype(test_value<Eval_>(nullptr))::value;
+        static constexpr bool grad = decltype(test_grad<Eval_>(nullptr))::value;
+        static constexpr bool hess = decltype(test_hess<Eval_>(nullptr))::value;
+      };
+
+      template<bool batch_>
+      struct EvalBatchHelper
+      {
+        template<typename Eval_>
+        static void value(Eval_& eval, typename EvalTraitsOf<Eval_>::ValueType* v, const typename EvalTraitsOf<Eval_>::DataType* c, int n)
+        {
+          eval.value_batch(v, c, n);
+        }
+
+        template<typename Eval_>
+        static void gradient(Eval_& eval, typename EvalTraitsOf<Eval_>::GradientType* g, const typename EvalTraitsOf<Eval_>::DataType* c, int n)
+        {
+          eval.gradient_batch(g, c, n);
+        }
+
+        template<typename Eval_>
+        static void hessian(Eval_& eval, typename EvalTraitsOf<Eval_>::HessianType* h, const typename EvalTraitsOf<Eval_>::DataType* c, int n)
+        {
+          eval.hessian_batch(h, c, n);
+        }
+      };
+
+      template<>
+      struct EvalBatchHelper<false>
+      {
+        template<typename Eval_>
+        static void value(Eval_& eval, typename EvalTraitsOf<Eval_>::ValueType* v, const typename EvalTraitsOf<Eval_>::DataType* c, int n)
+        {
+          for(int k(0); k < n; ++k)
+            v[k] = eval.value(get_batch_point<typename EvalTraitsOf<Eval_>::PointType>(c, n, k));
+        }
+
+        template<typename Eval_>
+        static void gradient(Eval_& eval, typename EvalTraitsOf<Eval_>::GradientType* g, const typename EvalTraitsOf<Eval_>::DataType* c, int n)
+        {
+          for(int k(0); k < n; ++k)
+            g[k] = eval.gradient(get_batch_point<typename EvalTraitsOf<Eval_>::PointType>(c, n, k));
+        }
+
+        template<typename Eval_>
+        static void hessian(Eval_& eval, typename EvalTraitsOf<Eval_>::HessianType* h, const typename EvalTraitsOf<Eval_>::DataType* c, int n)
+        {
+          for(int k(0); k < n; ++k)
+            h[k] = eval.hessian(get_batch_point<typename EvalTraitsOf<Eval_>::PointType>(c, n, k));
+        }
+      };
+    } // namespace Intern
+    /// \endcond
+
+    /**
+     * \brief Evaluates the function values of a function evaluator in a batch of points
+     *
+     * This function calls the evaluator's value_batch() function if it provides one,
+     * otherwise the evaluator's value() function is called for each point of the batch.
+     *
+     * \param[in,out] evaluator
+     * The function evaluator
+     *
+     * \param[out] values
+     * An array of length \p num_points that receives the function values.
+     *
+     * \param[in] coords
+     * The coordinates of the points in SoA layout, i.e. the i-th coordinate of the k-th
+     * point is stored in <c>coords[i*num_points + k]</c>.
+     *
+     * \param[in] num_points
+     * The number of points in the batch.
+     */
+    template<typename Eval_>
+    void eval_value_batch(Eval_& evaluator, typename Intern::EvalTraitsOf<Eval_>::ValueType* values,
+      const typename Intern::EvalTraitsOf<Eval_>::DataType* coords, int num_points)
+    {
+      Intern::EvalBatchHelper<Intern::EvalHasBatch<Eval_>::value>::value(evaluator, values, coords, num_points);
+    }
+
+    /**
+     * \brief Evaluates the function gradients of a function evaluator in a batch of points
+     *
+     * \see eval_value_batch()
+     */
+    template<typename Eval_>
+    void eval_gradient_batch(Eval_& evaluator, typename Intern::EvalTraitsOf<Eval_>::GradientType* grads,
+      const typename Intern::EvalTraitsOf<Eval_>::DataType* coords, int num_points)
+    {
+      Intern::EvalBatchHelper<Intern::EvalHasBatch<Eval_>::grad>::gradient(evaluator, grads, coords, num_points);
+    }
+
+    /**
+     * \brief Evaluates the function hessians of a function evaluator in a batch of points
+     *
+     * \see eval_value_batch()
+     */
+    template<typename Eval_>
+    void eval_hessian_batch(Eval_& evaluator, typename Intern::EvalTraitsOf<Eval_>::HessianType* hessians,
+      const typename Intern::EvalTraitsOf<Eval_>::DataType* coords, int num_points)
+    {
+      Intern::EvalBatchHelper<Intern::EvalHasBatch<Eval_>::hess>::hessian(evaluator, hessians, coords, num_points);
+    }
+
+    /**
+     * \brief Analytic function batch evaluation data class template
+     *
+     * This class stores a batch of points in SoA layout along with the function values, gradients
+     * and hessians in these points, which can be computed by the batch evaluation functions
+     * eval_value_batch(), eval_gradient_batch() and eval_hessian_batch(). This is typically used
+     * by assemblies, which first collect all cubature points of a cell and then evaluate the
+     * analytic function in all of these points at once.
+     *
+     * \tparam Traits_
+     * The analytic evaluation traits, see Analytic::EvalTraits.
+     */
+    template<typename Traits_>
+    class EvalBatchData
+    {
+    public:
+      typedef typename Traits_::DataType DataType;
+      typedef typename Traits_::ValueType ValueType;
+      typedef typename Traits_::GradientType GradientType;
+      typedef typename Traits_::HessianType HessianType;
+      static constexpr int domain_dim = Traits_::domain_dim;
+
+      /// the point coordinates in SoA layout
+      std::vector<DataType> coords;
+      /// the function values
+      std::vector<ValueType> values;
+      /// the function gradients
+      std::vector<GradientType> grads;
+      /// the function hessians
+      std::vector<HessianType> hessians;
+
+    protected:
+      /// the number of points in the batch
+      int _num_points;
+
+    public:
+      EvalBatchData() :
+        _num_points(0)
+      {
+      }
+
+      /// Sets the number of points in the batch
+      void resize(int num_points)
+      {
+        _num_points = num_points;
+        coords.resize(std::size_t(domain_dim * num_points));
+      }
+
+      /// Returns the number of points in the batch
+      int get_num_points() const
+      {
+        return _num_points;
+      }
+
+      /// Sets the k-th point of the batch
+      template<typename DT_, int n_, int sn_>
+      void set_point(int k, const Tiny::Vector<DT_, n_, sn_>& point)
+      {
+        static_assert(n_ == domain_dim, "invalid point dimension");
+        for(int i(0); i < domain_dim; ++i)
+          coords[std::size_t(i*_num_points + k)] = DataType(point[i]);
+      }
+
+      /// Computes the function values in all points of the batch
+      template<typename Eval_>
+      void eval_values(Eval_& evaluator)
+      {
+        values.resize(std::size_t(_num_points));
+        eval_value_batch(evaluator, values.data(), coords.data(), _num_points);
+      }
+
+      /// Computes the function gradients in all points of the batch
+      template<typename Eval_>
+      void eval_gradients(Eval_& evaluator)
+      {
+        grads.resize(std::size_t(_num_points));
+        eval_gradient_batch(evaluator, grads.data(), coords.data(), _num_points);
+      }
+
+      /// Computes the function hessians in all points of the batch
+      template<typename Eval_>
+      void eval_hessians(Eval_& evaluator)
+      {
+        hessians.resize(std::size_t(_num_points));
+        eval_hessian_batch(evaluator, hessians.data(), coords.data(), _num_points);
+      }
+
+      /**
+       * \brief Computes the function values and all derivatives up to a given order
+       *
+       * \tparam max_der_
+       * The maximum derivative order that is to be computed; must be 0, 1 or 2.
+       */
+      template<int max_der_, typename Eval_>
+      void eval(Eval_& evaluator)
+      {
+        static_assert((0 <= max_der_) && (max_der_ <= 2), "invalid derivative order");
+        eval_values(evaluator);
+        if constexpr(max_der_ >= 1)
+          eval_gradients(evaluator);
+        if constexpr(max_der_ >= 2)
+          eval_hessians(evaluator);
+      }
+    }; // class EvalBatchData<...>
+
   } // namespace Analytic
 } // namespace FEAT
 
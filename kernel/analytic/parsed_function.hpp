@@ -56,6 +56,35 @@ namespace FEAT
       explicit ParsedFunctionEvalError(const String& msg) : Exception(msg) {}
     };
 
+    /// \cond internal
+    namespace Intern
+    {
+      /// throws a ParsedFunctionEvalError if the given parser evaluation error code is non-zero
+      inline void check_parser_eval_error(int eval_error)
+      {
+        switch(eval_error)
+        {
+        case 0: // no error
+          break;
+
+        case 1: // division by zero
+          throw ParsedFunctionEvalError("Error in ParsedScalarFunction evaluation: division by zero");
+
+        case 2: // sqrt error
+        case 3: // log error
+        case 4: // trigonometric error
+          throw ParsedFunctionEvalError("Error in ParsedScalarFunction evaluation: illegal input value");
+
+        case 5: // recursion error
+          throw ParsedFunctionEvalError("Error in ParsedScalarFunction evaluation: maximum recursion depth reached");
+
+        default: // ???
+          throw ParsedFunctionEvalError("Error in ParsedScalarFunction evaluation: unknown error");
+        }
+      }
+    } // namespace Intern
+    /// \endcond
+
     /**
      * \brief Parsed scalar function implementation
      *
@@ -84,6 +113,17 @@ namespace FEAT
      * - <c>pi</c> = 3.14159...
      * - <c>eps</c> = ~1E-16
      *
+     * This class can only compute function values; gradients and hessians can be added by the
+     * AutoDerive wrapper, whose batch evaluation computes the difference stencils of all points of
+     * a batch by a single call of the value_batch() function of this class.
+     *
+     * \note
+     * The 'fparser' library can only evaluate its bytecode for one point at a time, so the batch
+     * evaluation is not vectorized; it runs the bytecode of the parser for all points of the batch
+     * and checks for evaluation errors only once per batch. Each evaluator creates its own deep copy
+     * of the parser, because the evaluation of a parser is not thread-safe, so an evaluator should be
+     * created once per thread and reused for all batches.
+     *
      * \tparam dim_
      * The dimension of the function, i.e. the number of variables. Must be 1 <= dim_ <= 3.
      *
@@ -305,29 +345,26 @@ namespace FEAT
           const double val = _parser.Eval(_vars.data());
 
           // check for errors
-          switch(_parser.EvalError())
-          {
-          case 0: // no error
-            break;
-
-          case 1: // division by zero
-            throw ParsedFunctionEvalError("Error in ParsedScalarFunction evaluation: division by zero");
-
-          case 2: // sqrt error
-          case 3: // log error
-          case 4: // trigonometric error
-            throw ParsedFunctionEvalError("Error in ParsedScalarFunction evaluation: illegal input value");
-
-          case 5: // recursion error
-            throw ParsedFunctionEvalError("Error in ParsedScalarFunction evaluation: maximum recursion depth reached");
-
-          default: // ???
-            throw ParsedFunctionEvalError("Error in ParsedScalarFunction evaluation: unknown error");
-          }
+          Intern::check_parser_eval_error(_parser.EvalError());
 
           // return value
           return ValueType(val);
         }
+
+        /// computes the function values in a batch of points in SoA layout by a point-wise loop over the bytecode
+        void value_batch(ValueType* values, const DataType* coords, int num_points)
+        {
+          // run the parser's bytecode for all points before checking for errors
+          int eval_error = 0;
+          for(int k(0); k < num_points; ++k)
+          {
+            for(int i(0); i < dim_; ++i)
+              _vars[std::size_t(i)] = double(coords[i*num_points + k]);
+            values[k] = ValueType(_parser.Eval(_vars.data()));
+            eval_error = Math::max(eval_error, _parser.EvalError());
+          }
+          Intern::check_parser_eval_error(eval_error);
+        }
       }; // class ParsedScalarFunction::Evaluator<...>
     }; // class ParsedScalarFunction
 
@@ -586,28 +623,28 @@ namespace FEAT
             val[int(i)] = DataType(_parsers[i].Eval(_vars.data()));
 
             // check for errors
-            switch(_parsers[i] .EvalError())
-            {
-            case 0: // no error
-              break;
-
-            case 1: // division by zero
-              throw ParsedFunctionEvalError("Error in ParsedScalarFunction evaluation: division by zero");
-
-            case 2: // sqrt error
-            case 3: // log error
-            case 4: // trigonometric error
-              throw ParsedFunctionEvalError("Error in ParsedScalarFunction evaluation: illegal input value");
+            Intern::check_parser_eval_error(_parsers[i].EvalError());
+          }
 
-            case 5: // recursion error
-              throw ParsedFunctionEvalError("Error in ParsedScalarFunction evaluation: maximum recursion depth reached");
+          return val;
+        }
 
-            default: // ???
-              throw ParsedFunctionEvalError("Error in ParsedScalarFunction evaluation: unknown error");
+        /// computes the function values in a batch of points in SoA layout by a point-wise loop over each bytecode
+        void value_batch(ValueType* values, const DataType* coords, int num_points)
+        {
+          // evaluate one component parser for all points at once to keep its bytecode hot
+          int eval_error = 0;
+          for(std::size_t i(0); i < _parsers.size(); ++i)
+          {
+            for(int k(0); k < num_points; ++k)
+            {
+              for(int j(0); j < dom_dim_; ++j)
+                _vars[std::size_t(j)] = double(coords[j*num_points + k]);
+              values[k][int(i)] = DataType(_parsers[i].Eval(_vars.data()));
+              eval_error = Math::max(eval_error, _parsers[i].EvalError());
             }
           }
-
-          return val;
+          Intern::check_parser_eval_error(eval_error);
         }
       }; // class ParsedVectorFunction::Evaluator<...>
     }; // class ParsedVectorFunction
@@ -379,6 +379,27 @@ namespace FEAT
         {
           v[0][0] = Function_<DataType_>::der_xx(x[0]);
         }
+
+        template<typename Value_>
+        static void eval_batch(Value_* v, const DataType_* x, int n)
+        {
+          for(int k(0); k < n; ++k)
+            v[k] = Function_<DataType_>::eval(x[k]);
+        }
+
+        template<typename Value_>
+        static void grad_batch(Value_* v, const DataType_* x, int n)
+        {
+          for(int k(0); k < n; ++k)
+            v[k][0] = Function_<DataType_>::der_x(x[k]);
+        }
+
+        template<typename Value_>
+        static void hess_batch(Value_* v, const DataType_* x, int n)
+        {
+          for(int k(0); k < n; ++k)
+            v[k][0][0] = Function_<DataType_>::der_xx(x[k]);
+        }
       };
 
       // specialization for 2D functions
@@ -406,6 +427,38 @@ namespace FEAT
           v[1][0] = Function_<DataType_>::der_yx(x[0], x[1]);
           v[1][1] = Function_<DataType_>::der_yy(x[0], x[1]);
         }
+
+        template<typename Value_>
+        static void eval_batch(Value_* v, const DataType_* x, int n)
+        {
+          const DataType_* y = &x[n];
+          for(int k(0); k < n; ++k)
+            v[k] = Function_<DataType_>::eval(x[k], y[k]);
+        }
+
+        template<typename Value_>
+        static void grad_batch(Value_* v, const DataType_* x, int n)
+        {
+          const DataType_* y = &x[n];
+          for(int k(0); k < n; ++k)
+          {
+            v[k][0] = Function_<DataType_>::der_x(x[k], y[k]);
+            v[k][1] = Function_<DataType_>::der_y(x[k], y[k]);
+          }
+        }
+
+        template<typename Value_>
+        static void hess_batch(Value_* v, const DataType_* x, int n)
+        {
+          const DataType_* y = &x[n];
+          for(int k(0); k < n; ++k)
+          {
+            v[k][0][0] = Function_<DataType_>::der_xx(x[k], y[k]);
+            v[k][0][1] = Function_<DataType_>::der_xy(x[k], y[k]);
+            v[k][1][0] = Function_<DataType_>::der_yx(x[k], y[k]);
+            v[k][1][1] = Function_<DataType_>::der_yy(x[k], y[k]);
+          }
+        }
       };
 
       // specialization for 3D functions
@@ -439,6 +492,47 @@ namespace FEAT
           v[2][1] = Function_<DataType_>::der_zy(x[0], x[1], x[2]);
           v[2][2] = Function_<DataType_>::der_zz(x[0], x[1], x[2]);
         }
+
+        template<typename Value_>
+        static void eval_batch(Value_* v, const DataType_* x, int n)
+        {
+          const DataType_* y = &x[n];
+          const DataType_* z = &x[2*n];
+          for(int k(0); k < n; ++k)
+            v[k] = Function_<DataType_>::eval(x[k], y[k], z[k]);
+        }
+
+        template<typename Value_>
+        static void grad_batch(Value_* v, const DataType_* x, int n)
+        {
+          const DataType_* y = &x[n];
+          const DataType_* z = &x[2*n];
+          for(int k(0); k < n; ++k)
+          {
+            v[k][0] = Function_<DataType_>::der_x(x[k], y[k], z[k]);
+            v[k][1] = Function_<DataType_>::der_y(x[k], y[k], z[k]);
+            v[k][2] = Function_<DataType_>::der_z(x[k], y[k], z[k]);
+          }
+        }
+
+        template<typename Value_>
+        static void hess_batch(Value_* v, const DataType_* x, int n)
+        {
+          const DataType_* y = &x[n];
+          const DataType_* z = &x[2*n];
+          for(int k(0); k < n; ++k)
+          {
+            v[k][0][0] = Function_<DataType_>::der_xx(x[k], y[k], z[k]);
+            v[k][0][1] = Function_<DataType_>::der_xy(x[k], y[k], z[k]);
+            v[k][0][2] = Function_<DataType_>::der_xz(x[k], y[k], z[k]);
+            v[k][1][0] = Function_<DataType_>::der_yx(x[k], y[k], z[k]);
+            v[k][1][1] = Function_<DataType_>::der_yy(x[k], y[k], z[k]);
+            v[k][1][2] = Function_<DataType_>::der_yz(x[k], y[k], z[k]);
+            v[k][2][0] = Function_<DataType_>::der_zx(x[k], y[k], z[k]);
+            v[k][2][1] = Function_<DataType_>::der_zy(x[k], y[k], z[k]);
+            v[k][2][2] = Function_<DataType_>::der_zz(x[k], y[k], z[k]);
+          }
+        }
       };
     } // namespace Intern
     /// \endcond
@@ -535,6 +629,24 @@ namespace FEAT
           Intern::StaticFunctionWrapper<Function_, DataType, domain_dim, can_hess_>::hess(hess, point);
           return hess;
         }
+
+        /// computes the function values in a batch of points in SoA layout
+        void value_batch(ValueType* values, const DataType* coords, int num_points) const
+        {
+          Intern::StaticFunctionWrapper<Function_, DataType, domain_dim, can_value_>::eval_batch(values, coords, num_points);
+        }
+
+        /// computes the function gradients in a batch of points in SoA layout
+        void gradient_batch(GradientType* grads, const DataType* coords, int num_points) const
+        {
+          Intern::StaticFunctionWrapper<Function_, DataType, domain_dim, can_grad_>::grad_batch(grads, coords, num_points);
+        }
+
+        /// computes the function hessians in a batch of points in SoA layout
+        void hessian_batch(HessianType* hessians, const DataType* coords, int num_points) const
+        {
+          Intern::StaticFunctionWrapper<Function_, DataType, domain_dim, can_hess_>::hess_batch(hessians, coords, num_points);
+        }
       }; // class StaticWrapperFunction::Evaluator<...>
     }; // class StaticWrapperFunction
   } // namespace Analytic
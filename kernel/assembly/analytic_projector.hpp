@@ -13,6 +13,9 @@
 #include <kernel/cubature/dynamic_factory.hpp>
 #include <kernel/trafo/base.hpp>
 
+// includes, system
+#include <vector>
+
 namespace FEAT
 {
   namespace Assembly
@@ -26,6 +29,12 @@ namespace FEAT
      */
     class AnalyticVertexProjector
     {
+    private:
+      /// \cond internal
+      /// the number of vertices that are evaluated in one function batch
+      static constexpr Index vertex_batch_size = Index(1024);
+      /// \endcond
+
     public:
       /**
        * \brief Projects an analytic function into the vertices.
@@ -68,13 +77,27 @@ namespace FEAT
         // create a function evaluator
         typename Function_::template Evaluator<EvalTraits> func_eval(function);
 
-        // loop over all cells of the mesh
-        for(Index i(0); i < num_verts; ++i)
+        // create function batch evaluation data
+        Analytic::EvalBatchData<EvalTraits> func_batch;
+
+        // loop over all vertices of the mesh in batches
+        for(Index i(0); i < num_verts; i += vertex_batch_size)
         {
-          // compute and store function value
-          vector(i, func_eval.value(vtx[i]));
+          const int n = int(Math::min(vertex_batch_size, num_verts - i));
+
+          // gather vertex coordinates
+          func_batch.resize(n);
+          for(int k(0); k < n; ++k)
+            func_batch.set_point(k, vtx[i + Index(k)]);
 
-          // continue with next vertex
+          // compute function values
+          func_batch.eval_values(func_eval);
+
+          // store function values
+          for(int k(0); k < n; ++k)
+            vector(i + Index(k), func_batch.values[std::size_t(k)]);
+
+          // continue with next batch
         }
       }
     }; // class AnalyticVertexProjector<...>
@@ -185,6 +208,12 @@ namespace FEAT
         // create a function evaluator
         typename Function_::template Evaluator<FuncEvalTraits> func_eval(function);
 
+        // create function batch evaluation data
+        const int num_points = cubature_rule.get_num_points();
+        Analytic::EvalBatchData<FuncEvalTraits> func_batch;
+        func_batch.resize(num_points);
+        std::vector<DataType> weights(std::size_t(num_points));
+
         // loop over all cells of the mesh
         for(Index cell(0); cell < num_cells; ++cell)
         {
@@ -194,25 +223,32 @@ namespace FEAT
           ValueType value(DataType(0));
           DataType area(DataType(0));
 
-          // loop over all quadrature points and integrate
-          for(int k(0); k < cubature_rule.get_num_points(); ++k)
+          // loop over all quadrature points and compute the trafo data
+          for(int k(0); k < num_points; ++k)
           {
             // compute trafo data
             trafo_eval(trafo_data, cubature_rule.get_point(k));
 
-            // compute function value
-            ValueType val = func_eval.value(trafo_data.img_point);
+            // store image point
+            func_batch.set_point(k, trafo_data.img_point);
 
             // compute weight
-            DataType weight(trafo_data.jac_det * cubature_rule.get_weight(k));
+            weights[std::size_t(k)] = trafo_data.jac_det * cubature_rule.get_weight(k);
+          }
+
+          // compute function values in all quadrature points
+          func_batch.eval_values(func_eval);
 
+          // loop over all quadrature points and integrate
+          for(int k(0); k < num_points; ++k)
+          {
             // update cell area
-            area += weight;
+            area += weights[std::size_t(k)];
 
             // update cell value
-            value += weight * val;
+            value += weights[std::size_t(k)] * func_batch.values[std::size_t(k)];
 
-            // continue with next vertex
+            // continue with next point
           }
 
           // set contribution
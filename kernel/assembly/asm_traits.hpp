@@ -10,6 +10,8 @@
 // includes, FEAT
 #include <kernel/assembly/base.hpp>
 #include <kernel/cubature/dynamic_factory.hpp>
+#include <kernel/space/ref_basis_tabulation.hpp>
+#include <kernel/trafo/geometry_cache.hpp>
 
 namespace FEAT
 {
@@ -146,6 +148,12 @@ namespace FEAT
       typedef SpaceEvalData TrialEvalData;
       typedef SpaceEvalData MultEvalData;
 
+      /// reference basis tabulation types
+      typedef Space::RefBasisTabulation<SpaceEvaluator, SpaceEvalData> SpaceRefTabulation;
+      typedef SpaceRefTabulation TestRefTabulation;
+      typedef SpaceRefTabulation TrialRefTabulation;
+      typedef SpaceRefTabulation MultRefTabulation;
+
       /// basis function data types
       typedef typename SpaceEvalData::BasisDataType SpaceBasisData;
       typedef SpaceBasisData BasisData;
@@ -186,6 +194,9 @@ namespace FEAT
 
       /// cubature rule type
       typedef typename Intern::CubatureTraits<TrafoEvaluator>::RuleType CubatureRuleType;
+
+      /// trafo geometry cache type
+      typedef Trafo::GeometryCache<TrafoType, DataType> GeometryCacheType;
     }; // class AsmTraits1
 
     /**
@@ -284,6 +295,11 @@ namespace FEAT
       typedef typename TrialEvaluator::template ConfigTraits<trial_config>::EvalDataType TrialEvalData;
       typedef TrialEvalData MultEvalData;
 
+      /// reference basis tabulation types
+      typedef Space::RefBasisTabulation<TestEvaluator, TestEvalData> TestRefTabulation;
+      typedef Space::RefBasisTabulation<TrialEvaluator, TrialEvalData> TrialRefTabulation;
+      typedef TrialRefTabulation MultRefTabulation;
+
       /// basis function data types
       typedef typename TestEvalData::BasisDataType TestBasisData;
       typedef typename TrialEvalData::BasisDataType TrialBasisData;
@@ -318,6 +334,9 @@ namespace FEAT
 
       /// cubature rule type
       typedef typename Intern::CubatureTraits<TrafoEvaluator>::RuleType CubatureRuleType;
+
+      /// trafo geometry cache type
+      typedef Trafo::GeometryCache<TrafoType, DataType> GeometryCacheType;
     }; // class AsmTraits2
 
     /**
@@ -422,6 +441,11 @@ namespace FEAT
       typedef typename TrialEvaluator::template ConfigTraits<trial_config>::EvalDataType TrialEvalData;
       typedef typename MultEvaluator::template ConfigTraits<trial_config>::EvalDataType MultEvalData;
 
+      /// reference basis tabulation types
+      typedef Space::RefBasisTabulation<TestEvaluator, TestEvalData> TestRefTabulation;
+      typedef Space::RefBasisTabulation<TrialEvaluator, TrialEvalData> TrialRefTabulation;
+      typedef Space::RefBasisTabulation<MultEvaluator, MultEvalData> MultRefTabulation;
+
       /// basis function data types
       typedef typename TestEvalData::BasisDataType TestBasisData;
       typedef typename TrialEvalData::BasisDataType TrialBasisData;
@@ -456,6 +480,9 @@ namespace FEAT
 
       /// cubature rule type
       typedef typename Intern::CubatureTraits<TrafoEvaluator>::RuleType CubatureRuleType;
+
+      /// trafo geometry cache type
+      typedef Trafo::GeometryCache<TrafoType, DataType> GeometryCacheType;
     }; // class AsmTraits3
   } // namespace Assembly
 } // namespace FEAT
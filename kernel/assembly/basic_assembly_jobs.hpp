@@ -77,6 +77,12 @@ namespace FEAT
       typename AsmTraits::DofMapping dof_mapping;
       /// the cubature rule used for integration
       typename AsmTraits::CubatureRuleType cubature_rule;
+      /// the tabulated reference basis data
+      typename AsmTraits::SpaceRefTabulation space_ref_tab;
+      /// the trafo geometry cache; may be nullptr
+      const typename AsmTraits::GeometryCacheType* geo_cache;
+      /// the index of the current cell
+      Index cur_cell;
       /// the trafo evaluation data
       typename AsmTraits::TrafoEvalData trafo_data;
       /// the space evaluation data
@@ -103,9 +109,14 @@ namespace FEAT
        *
        * \param[in] alpha_
        * A scaling factor for the assembly.
+       *
+       * \param[in] geo_cache_
+       * A \resident pointer to a trafo geometry cache or \c nullptr. The cache is only used if
+       * it is compatible with the cubature rule and the trafo configuration of this task.
        */
       explicit BasicVectorAssemblyTaskCRTP(Vector_& vector_, const Space_& space_,
-        const Cubature::DynamicFactory& cubature_factory, DataType alpha_) :
+        const Cubature::DynamicFactory& cubature_factory, DataType alpha_,
+        const typename AsmTraits::GeometryCacheType* geo_cache_ = nullptr) :
         vector(vector_),
         space(space_),
         trafo(space.get_trafo()),
@@ -113,9 +124,14 @@ namespace FEAT
         space_eval(space),
         dof_mapping(space),
         cubature_rule(Cubature::ctor_factory, cubature_factory),
+        geo_cache(nullptr),
+        cur_cell(~Index(0)),
         scatter_axpy(vector),
         scatter_alpha(alpha_)
       {
+        space_ref_tab.tabulate(space_eval, cubature_rule);
+        if((geo_cache_ != nullptr) && geo_cache_->template is_compatible<AsmTraits::trafo_config>(cubature_rule))
+          geo_cache = geo_cache_;
       }
 
 #ifdef DOXYGEN
@@ -155,9 +171,12 @@ namespace FEAT
       {
         // prepare dof mapping
         dof_mapping.prepare(cell);
+        cur_cell = cell;
 
-        // prepare trafo evaluator
-        trafo_eval.prepare(cell);
+        // prepare trafo evaluator; this can be skipped if the geometry cache replaces the trafo
+        // evaluator, because the evaluators of tabulated spaces do not evaluate the trafo here
+        if((geo_cache == nullptr) || !AsmTraits::SpaceRefTabulation::enabled)
+          trafo_eval.prepare(cell);
 
         // prepare space evaluator
         space_eval.prepare(trafo_eval);
@@ -177,11 +196,21 @@ namespace FEAT
         // loop over all quadrature points and integrate
         for(int k(0); k < cubature_rule.get_num_points(); ++k)
         {
-          // compute trafo data
-          trafo_eval(trafo_data, cubature_rule.get_point(k));
+          // compute trafo data and integration weight
+          DataType weight;
+          if(geo_cache != nullptr)
+          {
+            geo_cache->eval(trafo_data, cur_cell, k);
+            weight = geo_cache->get_weighted_det(cur_cell, k);
+          }
+          else
+          {
+            trafo_eval(trafo_data, cubature_rule.get_point(k));
+            weight = trafo_data.jac_det * cubature_rule.get_weight(k);
+          }
 
           // compute basis function data
-          space_eval(space_data, trafo_data);
+          space_ref_tab.eval(space_eval, space_data, trafo_data, k);
 
           // evaluate operator
           static_cast<Derived_&>(*this).set_point(trafo_data);
@@ -190,9 +219,7 @@ namespace FEAT
           for(int i(0); i < num_loc_dofs; ++i)
           {
             // evaluate functional and integrate
-            static_cast<Derived_&>(*this).eval(local_vector(i),
-              trafo_data.jac_det * cubature_rule.get_weight(k),
-              space_data.phi[i]);
+            static_cast<Derived_&>(*this).eval(local_vector(i), weight, space_data.phi[i]);
             // continue with next test function
           }
           // continue with next cubature point
@@ -292,6 +319,12 @@ namespace FEAT
       typename AsmTraits::DofMapping dof_mapping;
       /// the cubature rule used for integration
       typename AsmTraits::CubatureRuleType cubature_rule;
+      /// the tabulated reference basis data
+      typename AsmTraits::SpaceRefTabulation space_ref_tab;
+      /// the trafo geometry cache; may be nullptr
+      const typename AsmTraits::GeometryCacheType* geo_cache;
+      /// the index of the current cell
+      Index cur_cell;
       /// the trafo evaluation data
       typename AsmTraits::TrafoEvalData trafo_data;
       /// the space evaluation data
@@ -318,9 +351,14 @@ namespace FEAT
        *
        * \param[in] alpha_
        * A scaling factor for the assembly.
+       *
+       * \param[in] geo_cache_
+       * A \resident pointer to a trafo geometry cache or \c nullptr. The cache is only used if
+       * it is compatible with the cubature rule and the trafo configuration of this task.
        */
       explicit BasicMatrixAssemblyTaskCRTP1(Matrix_& matrix_, const Space_& space_,
-        const Cubature::DynamicFactory& cubature_factory, DataType alpha_) :
+        const Cubature::DynamicFactory& cubature_factory, DataType alpha_,
+        const typename AsmTraits::GeometryCacheType* geo_cache_ = nullptr) :
         matrix(matrix_),
         space(space_),
         trafo(space.get_trafo()),
@@ -328,9 +366,14 @@ namespace FEAT
         space_eval(space),
         dof_mapping(space),
         cubature_rule(Cubature::ctor_factory, cubature_factory),
+        geo_cache(nullptr),
+        cur_cell(~Index(0)),
         scatter_axpy(matrix),
         scatter_alpha(alpha_)
       {
+        space_ref_tab.tabulate(space_eval, cubature_rule);
+        if((geo_cache_ != nullptr) && geo_cache_->template is_compatible<AsmTraits::trafo_config>(cubature_rule))
+          geo_cache = geo_cache_;
       }
 
 #ifdef DOXYGEN
@@ -374,9 +417,12 @@ namespace FEAT
       {
         // prepare dof mapping
         dof_mapping.prepare(cell);
+        cur_cell = cell;
 
-        // prepare trafo evaluator
-        trafo_eval.prepare(cell);
+        // prepare trafo evaluator; this can be skipped if the geometry cache replaces the trafo
+        // evaluator, because the evaluators of tabulated spaces do not evaluate the trafo here
+        if((geo_cache == nullptr) || !AsmTraits::SpaceRefTabulation::enabled)
+          trafo_eval.prepare(cell);
 
         // prepare space evaluator
         space_eval.prepare(trafo_eval);
@@ -396,11 +442,21 @@ namespace FEAT
         // loop over all quadrature points and integrate
         for(int k(0); k < cubature_rule.get_num_points(); ++k)
         {
-          // compute trafo data
-          trafo_eval(trafo_data, cubature_rule.get_point(k));
+          // compute trafo data and integration weight
+          DataType weight;
+          if(geo_cache != nullptr)
+          {
+            geo_cache->eval(trafo_data, cur_cell, k);
+            weight = geo_cache->get_weighted_det(cur_cell, k);
+          }
+          else
+          {
+            trafo_eval(trafo_data, cubature_rule.get_point(k));
+            weight = trafo_data.jac_det * cubature_rule.get_weight(k);
+          }
 
           // compute basis function data
-          space_eval(space_data, trafo_data);
+          space_ref_tab.eval(space_eval, space_data, trafo_data, k);
 
           // evaluate operator
           static_cast<Derived_&>(*this).set_point(trafo_data);
@@ -412,9 +468,7 @@ namespace FEAT
             for(int j(0); j < num_loc_dofs; ++j)
             {
               // evaluate operator and integrate
-              static_cast<Derived_&>(*this).eval(local_matrix(i,j),
-                trafo_data.jac_det * cubature_rule.get_weight(k),
-                space_data.phi[j], space_data.phi[i]);
+              static_cast<Derived_&>(*this).eval(local_matrix(i,j), weight, space_data.phi[j], space_data.phi[i]);
               // continue with next trial function
             }
             // continue with next test function
@@ -535,6 +589,13 @@ namespace FEAT
       typename AsmTraits::TrialDofMapping trial_dof_mapping;
       /// the cubature rule used for integration
       typename AsmTraits::CubatureRuleType cubature_rule;
+      /// the tabulated reference basis data
+      typename AsmTraits::TestRefTabulation test_ref_tab;
+      typename AsmTraits::TrialRefTabulation trial_ref_tab;
+      /// the trafo geometry cache; may be nullptr
+      const typename AsmTraits::GeometryCacheType* geo_cache;
+      /// the index of the current cell
+      Index cur_cell;
       /// the trafo evaluation data
       typename AsmTraits::TrafoEvalData trafo_data;
       /// the space evaluation data
@@ -565,10 +626,15 @@ namespace FEAT
        *
        * \param[in] alpha_
        * A scaling factor for the assembly.
+       *
+       * \param[in] geo_cache_
+       * A \resident pointer to a trafo geometry cache or \c nullptr. The cache is only used if
+       * it is compatible with the cubature rule and the trafo configuration of this task.
        */
       explicit BasicMatrixAssemblyTaskCRTP2(Matrix_& matrix_,
         const TestSpace_& test_space_, const TrialSpace_& trial_space_,
-        const Cubature::DynamicFactory& cubature_factory, DataType alpha_) :
+        const Cubature::DynamicFactory& cubature_factory, DataType alpha_,
+        const typename AsmTraits::GeometryCacheType* geo_cache_ = nullptr) :
         matrix(matrix_),
         test_space(test_space_),
         trial_space(trial_space_),
@@ -579,9 +645,15 @@ namespace FEAT
         test_dof_mapping(test_space),
         trial_dof_mapping(trial_space),
         cubature_rule(Cubature::ctor_factory, cubature_factory),
+        geo_cache(nullptr),
+        cur_cell(~Index(0)),
         scatter_axpy(matrix),
         scatter_alpha(alpha_)
       {
+        test_ref_tab.tabulate(test_eval, cubature_rule);
+        trial_ref_tab.tabulate(trial_eval, cubature_rule);
+        if((geo_cache_ != nullptr) && geo_cache_->template is_compatible<AsmTraits::trafo_config>(cubature_rule))
+          geo_cache = geo_cache_;
       }
 
 #ifdef DOXYGEN
@@ -627,8 +699,12 @@ namespace FEAT
         test_dof_mapping.prepare(cell);
         trial_dof_mapping.prepare(cell);
 
-        // prepare trafo evaluator
-        trafo_eval.prepare(cell);
+        cur_cell = cell;
+
+        // prepare trafo evaluator; this can be skipped if the geometry cache replaces the trafo
+        // evaluator, because the evaluators of tabulated spaces do not evaluate the trafo here
+        if((geo_cache == nullptr) || !(AsmTraits::TestRefTabulation::enabled && AsmTraits::TrialRefTabulation::enabled))
+          trafo_eval.prepare(cell);
 
         // prepare space evaluators
         test_eval.prepare(trafo_eval);
@@ -650,12 +726,22 @@ namespace FEAT
         // loop over all quadrature points and integrate
         for(int k(0); k < cubature_rule.get_num_points(); ++k)
         {
-          // compute trafo data
-          trafo_eval(trafo_data, cubature_rule.get_point(k));
+          // compute trafo data and integration weight
+          DataType weight;
+          if(geo_cache != nullptr)
+          {
+            geo_cache->eval(trafo_data, cur_cell, k);
+            weight = geo_cache->get_weighted_det(cur_cell, k);
+          }
+          else
+          {
+            trafo_eval(trafo_data, cubature_rule.get_point(k));
+            weight = trafo_data.jac_det * cubature_rule.get_weight(k);
+          }
 
           // compute basis function data
-          test_eval(test_data, trafo_data);
-          trial_eval(trial_data, trafo_data);
+          test_ref_tab.eval(test_eval, test_data, trafo_data, k);
+          trial_ref_tab.eval(trial_eval, trial_data, trafo_data, k);
 
           // evaluate operator
           static_cast<Derived_&>(*this).set_point(trafo_data);
@@ -667,9 +753,7 @@ namespace FEAT
             for(int j(0); j < num_loc_trial_dofs; ++j)
             {
               // evaluate operator and integrate
-              static_cast<Derived_&>(*this).eval(local_matrix(i,j),
-                trafo_data.jac_det * cubature_rule.get_weight(k),
-                trial_data.phi[j], test_data.phi[i]);
+              static_cast<Derived_&>(*this).eval(local_matrix(i,j), weight, trial_data.phi[j], test_data.phi[i]);
               // continue with next trial function
             }
             // continue with next test function
@@ -734,6 +818,8 @@ namespace FEAT
     public:
       typedef typename Vector_::DataType DataType;
       typedef typename Vector_::ValueType ValueType;
+      /// the trafo geometry cache type
+      typedef Trafo::GeometryCache<typename Space_::TrafoType, DataType> GeometryCacheType;
 
       static constexpr TrafoTags trafo_config = LinearFunctional_::trafo_config;
       static constexpr SpaceTags test_config = LinearFunctional_::test_config;
@@ -753,7 +839,7 @@ namespace FEAT
 
       public:
         explicit Task(LinearFunctionalAssemblyJob& job) :
-          BaseClass(job.vector, job.space, job.cubature_factory, job.alpha),
+          BaseClass(job.vector, job.space, job.cubature_factory, job.alpha, job.geometry_cache),
           func_eval(job.linear_functional)
         {
         }
@@ -792,6 +878,8 @@ namespace FEAT
       Cubature::DynamicFactory cubature_factory;
       /// the scaling factor for the assembly.
       DataType alpha;
+      /// the trafo geometry cache
+      const GeometryCacheType* geometry_cache;
 
     public:
       /**
@@ -818,8 +906,21 @@ namespace FEAT
         vector(vector_),
         space(space_),
         cubature_factory(cubature_),
-        alpha(alpha_)
+        alpha(alpha_),
+        geometry_cache(nullptr)
+      {
+      }
+
+      /**
+       * \brief Sets a trafo geometry cache for the assembly
+       *
+       * \param[in] cache
+       * A \resident pointer to the geometry cache that is to be used or \c nullptr to disable it.
+       * The cache is only used if it is compatible with the cubature rule and trafo configuration.
+       */
+      void set_geometry_cache(const GeometryCacheType* cache)
       {
+        geometry_cache = cache;
       }
     }; // class LinearFunctionalAssemblyJob<...>
 
@@ -849,6 +950,8 @@ namespace FEAT
     public:
       typedef typename Vector_::DataType DataType;
       typedef typename Vector_::ValueType ValueType;
+      /// the trafo geometry cache type
+      typedef Trafo::GeometryCache<typename Space_::TrafoType, DataType> GeometryCacheType;
 
       static constexpr TrafoTags trafo_config = TrafoTags::img_point | TrafoTags::jac_det;
       static constexpr SpaceTags test_config = SpaceTags::value;
@@ -867,24 +970,67 @@ namespace FEAT
         typedef Analytic::EvalTraits<DataType, Function_> AnalyticEvalTraits;
         /// the function evaluator
         typename Function_::template Evaluator<AnalyticEvalTraits> func_eval;
-        /// the function value in the current point
-        typename AnalyticEvalTraits::ValueType func_value;
+        /// the function batch evaluation data
+        Analytic::EvalBatchData<AnalyticEvalTraits> func_batch;
+        /// the trafo evaluation data for all cubature points
+        std::vector<typename AsmTraits::TrafoEvalData> trafo_datas;
 
       public:
         explicit Task(ForceFunctionalAssemblyJob& job) :
-          BaseClass(job.vector, job.space, job.cubature_factory, job.alpha),
-          func_eval(job.function)
+          BaseClass(job.vector, job.space, job.cubature_factory, job.alpha, job.geometry_cache),
+          func_eval(job.function),
+          func_batch(),
+          trafo_datas(std::size_t(this->cubature_rule.get_num_points()))
         {
+          func_batch.resize(this->cubature_rule.get_num_points());
         }
 
-        void set_point(typename AsmTraits::TrafoEvalData& tau)
+        /**
+         * \brief Performs the local assembly.
+         *
+         * In contrast to the base-class implementation, this function first computes the trafo
+         * data in all cubature points, so that the force function can be evaluated in all
+         * cubature points of the cell by a single batch evaluation.
+         */
+        void assemble()
         {
-          func_value = func_eval.value(tau.img_point);
-        }
+          // format local vector
+          this->local_vector.format();
 
-        void eval(ValueType& val, const DataType& weight, typename AsmTraits::TestBasisData& psi)
-        {
-          Tiny::axpy(val, func_value, weight * psi.value);
+          // fetch number of local dofs and cubature points
+          const int num_loc_dofs = this->space_eval.get_num_local_dofs();
+          const int num_points = this->cubature_rule.get_num_points();
+
+          // compute trafo data in all cubature points
+          for(int k(0); k < num_points; ++k)
+          {
+            auto& tau = trafo_datas[std::size_t(k)];
+            if(this->geo_cache != nullptr)
+              this->geo_cache->eval(tau, this->cur_cell, k);
+            else
+              this->trafo_eval(tau, this->cubature_rule.get_point(k));
+            func_batch.set_point(k, tau.img_point);
+          }
+
+          // evaluate the force function in all cubature points at once
+          func_batch.eval_values(func_eval);
+
+          // loop over all quadrature points and integrate
+          for(int k(0); k < num_points; ++k)
+          {
+            const auto& tau = trafo_datas[std::size_t(k)];
+
+            // compute basis function data
+            this->space_ref_tab.eval(this->space_eval, this->space_data, tau, k);
+
+            // test function loop
+            const DataType omega = (this->geo_cache != nullptr) ? this->geo_cache->get_weighted_det(this->cur_cell, k) :
+              tau.jac_det * this->cubature_rule.get_weight(k);
+            for(int i(0); i < num_loc_dofs; ++i)
+            {
+              Tiny::axpy(this->local_vector(i), func_batch.values[std::size_t(k)], omega * this->space_data.phi[i].value);
+            }
+          }
         }
       }; // class Task
 
@@ -899,6 +1045,8 @@ namespace FEAT
       Cubature::DynamicFactory cubature_factory;
       /// the scaling factor for the assembly.
       DataType alpha;
+      /// the trafo geometry cache
+      const GeometryCacheType* geometry_cache;
 
     public:
       /**
@@ -925,9 +1073,22 @@ namespace FEAT
         vector(vector_),
         space(space_),
         cubature_factory(cubature_),
-        alpha(alpha_)
+        alpha(alpha_),
+        geometry_cache(nullptr)
       {
       }
+
+      /**
+       * \brief Sets a trafo geometry cache for the assembly
+       *
+       * \param[in] cache
+       * A \resident pointer to the geometry cache that is to be used or \c nullptr to disable it.
+       * The cache is only used if it is compatible with the cubature rule and trafo configuration.
+       */
+      void set_geometry_cache(const GeometryCacheType* cache)
+      {
+        geometry_cache = cache;
+      }
     }; // class ForceFunctionalAssemblyJob<...>
 
     /**
@@ -953,6 +1114,8 @@ namespace FEAT
     public:
       typedef typename Matrix_::DataType DataType;
       typedef typename Matrix_::ValueType ValueType;
+      /// the trafo geometry cache type
+      typedef Trafo::GeometryCache<typename Space_::TrafoType, DataType> GeometryCacheType;
 
       static constexpr TrafoTags trafo_config = BilinearOperator_::trafo_config;
       static constexpr SpaceTags space_config = BilinearOperator_::test_config | BilinearOperator_::trial_config;
@@ -972,7 +1135,7 @@ namespace FEAT
 
       public:
         explicit Task(BilinearOperatorMatrixAssemblyJob1& job) :
-          BaseClass(job.matrix, job.space, job.cubature_factory, job.alpha),
+          BaseClass(job.matrix, job.space, job.cubature_factory, job.alpha, job.geometry_cache),
           oper_eval(job.bilinear_operator)
         {
         }
@@ -1012,6 +1175,8 @@ namespace FEAT
       Cubature::DynamicFactory cubature_factory;
       /// the scaling factor for the assembly.
       DataType alpha;
+      /// the trafo geometry cache
+      const GeometryCacheType* geometry_cache;
 
     public:
       /**
@@ -1038,8 +1203,21 @@ namespace FEAT
         matrix(matrix_),
         space(space_),
         cubature_factory(cubature_),
-        alpha(alpha_)
+        alpha(alpha_),
+        geometry_cache(nullptr)
+      {
+      }
+
+      /**
+       * \brief Sets a trafo geometry cache for the assembly
+       *
+       * \param[in] cache
+       * A \resident pointer to the geometry cache that is to be used or \c nullptr to disable it.
+       * The cache is only used if it is compatible with the cubature rule and trafo configuration.
+       */
+      void set_geometry_cache(const GeometryCacheType* cache)
       {
+        geometry_cache = cache;
       }
     }; // class BilinearOperatorMatrixAssemblyJob1<...>
 
@@ -1069,6 +1247,8 @@ namespace FEAT
     public:
       typedef typename Matrix_::DataType DataType;
       typedef typename Matrix_::ValueType ValueType;
+      /// the trafo geometry cache type
+      typedef Trafo::GeometryCache<typename TestSpace_::TrafoType, DataType> GeometryCacheType;
 
       static constexpr TrafoTags trafo_config = BilinearOperator_::trafo_config;
       static constexpr SpaceTags test_config  = BilinearOperator_::test_config;
@@ -1089,7 +1269,7 @@ namespace FEAT
 
       public:
         explicit Task(BilinearOperatorMatrixAssemblyJob2& job) :
-          BaseClass(job.matrix, job.test_space, job.trial_space, job.cubature_factory, job.alpha),
+          BaseClass(job.matrix, job.test_space, job.trial_space, job.cubature_factory, job.alpha, job.geometry_cache),
           oper_eval(job.bilinear_operator)
         {
         }
@@ -1131,6 +1311,8 @@ namespace FEAT
       Cubature::DynamicFactory cubature_factory;
       /// the scaling factor for the assembly.
       DataType alpha;
+      /// the trafo geometry cache
+      const GeometryCacheType* geometry_cache;
 
     public:
       /**
@@ -1162,8 +1344,21 @@ namespace FEAT
         test_space(test_space_),
         trial_space(trial_space_),
         cubature_factory(cubature_),
-        alpha(alpha_)
+        alpha(alpha_),
+        geometry_cache(nullptr)
+      {
+      }
+
+      /**
+       * \brief Sets a trafo geometry cache for the assembly
+       *
+       * \param[in] cache
+       * A \resident pointer to the geometry cache that is to be used or \c nullptr to disable it.
+       * The cache is only used if it is compatible with the cubature rule and trafo configuration.
+       */
+      void set_geometry_cache(const GeometryCacheType* cache)
       {
+        geometry_cache = cache;
       }
     }; // class BilinearOperatorMatrixAssemblyJob2<...>
   } // namespace Assembly
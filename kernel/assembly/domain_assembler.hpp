@@ -12,6 +12,8 @@
 #include <kernel/adjacency/graph.hpp>
 #include <kernel/adjacency/coloring.hpp>
 #include <kernel/util/thread.hpp>
+#include <kernel/util/perf_counters.hpp>
+#include <kernel/util/trace.hpp>
 
 // includes, system
 #include <algorithm>
@@ -41,8 +43,9 @@ namespace FEAT
        * In its current implementation, the domain assembler will automatically choose the
        * strategy based on the following criterions:
        * - If only 1 thread is requested, ThreadingStrategy::single is chosen.
-       * - If the underlying mesh is permuted using the Geometry::PermutationStrategy::colored
-       *   permutation strategy, then ThreadingStrategy::colored is chosen.
+       * - If the underlying mesh is permuted using the Geometry::PermutationStrategy::colored or
+       *   Geometry::PermutationStrategy::colored_parallel permutation strategy, then
+       *   ThreadingStrategy::colored is chosen.
        * - In any other case, ThreadingStrategy::layered is chosen.
        */
       automatic = 0,
@@ -147,7 +150,17 @@ namespace FEAT
        * it is usually less efficient than the layered strategy due to higher
        * synchronization costs and less favorable memory access patterns.
        */
-      colored
+      colored,
+
+      /**
+       * \brief Parallel colored threading strategy
+       *
+       * This threading strategy is identical to the colored strategy, where the only difference is
+       * that the element coloring is computed by the thread-parallel Jones-Plassmann algorithm
+       * instead of the serial greedy algorithm, see Adjacency::Coloring::create_jones_plassmann().
+       * This reduces the setup time on large meshes, but the coloring may require more colors.
+       */
+      colored_parallel
     }; // enum class ThreadingStrategy
 
 #ifdef DOXYGEN
@@ -560,6 +573,8 @@ namespace FEAT
         {
           bool okay = false;
 
+          FEAT_TRACE_SCOPE(TraceKind::assembly, "DomainAssembler::Worker");
+          FEAT_PERF_REGION("DomainAssembler::Worker");
           TimeStamp stamp_total;
 
           // put everything in a try-catch block
@@ -579,7 +594,7 @@ namespace FEAT
               // we have multiple threads, but the task does not need to scatter
               okay = this->_work_no_scatter(std::move(task));
             }
-            else if(this->_strategy == ThreadingStrategy::colored)
+            else if((this->_strategy == ThreadingStrategy::colored) || (this->_strategy == ThreadingStrategy::colored_parallel))
             {
               // multiple threads and colored threading strategy
               okay = this->_work_colored(std::move(task));
@@ -1252,6 +1267,7 @@ namespace FEAT
           break;
 
         case ThreadingStrategy::colored:
+        case ThreadingStrategy::colored_parallel:
           // colored assembly is significantly more complex:
           // each layer represents a single color and all threads have
           // to traverse the layers simultaneously to avoid race conditions
@@ -1432,11 +1448,13 @@ namespace FEAT
         // choose automatic strategy?
         if(this->_strategy == ThreadingStrategy::automatic)
         {
+          const Geometry::PermutationStrategy perm_strategy = this->_trafo.get_mesh().get_mesh_permutation().get_strategy();
+
           // only 1 thread? => use single-threaded strategy
           if(this->_max_worker_threads <= std::size_t(1))
             this->_strategy = ThreadingStrategy::single;
           // multi-threaded: is the mesh permuted using colored strategy? => use colored threading strategy
-          else if(this->_trafo.get_mesh().get_mesh_permutation().get_strategy() == Geometry::PermutationStrategy::colored)
+          else if((perm_strategy == Geometry::PermutationStrategy::colored) || (perm_strategy == Geometry::PermutationStrategy::colored_parallel))
             this->_strategy = ThreadingStrategy::colored;
           // multi-threaded: use layered threading strategy
           else
@@ -1469,7 +1487,11 @@ namespace FEAT
             break;
 
           case ThreadingStrategy::colored:
-            this->_build_colors();
+            this->_build_colors(false);
+            break;
+
+          case ThreadingStrategy::colored_parallel:
+            this->_build_colors(true);
             break;
 
           default:
@@ -1774,12 +1796,16 @@ namespace FEAT
       /**
        * \brief Builds the color element vectors for the colored threading strategy.
        *
+       * \param[in] parallel
+       * Specifies whether to use the thread-parallel Jones-Plassmann coloring algorithm.
+       *
        * \todo utilize mesh permutation coloring if available
        */
-      void _build_colors()
+      void _build_colors(bool parallel)
       {
         // create coloring from our neighbors graph
-        Adjacency::Coloring coloring(this->_elem_neighbors);
+        Adjacency::Coloring coloring = (parallel ?
+          Adjacency::Coloring::create_jones_plassmann(this->_elem_neighbors) : Adjacency::Coloring(this->_elem_neighbors));
 
         // create the partitioning graph from our coloring
         Adjacency::Graph color_parti = coloring.create_partition_graph();
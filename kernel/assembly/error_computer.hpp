@@ -13,6 +13,9 @@
 #include <kernel/util/dist.hpp>
 #include <kernel/util/tiny_algebra.hpp>
 
+// includes, system
+#include <vector>
+
 namespace FEAT
 {
   namespace Assembly
@@ -25,9 +28,10 @@ namespace FEAT
       {
         typedef typename AsmTraits_::DataType DataType;
 
-        template<typename FuncEval_, typename LocalVec_>
+        template<typename FuncBatch_, typename LocalVec_>
         static DataType eval(
-          FuncEval_&,
+          const FuncBatch_&,
+          const int,
           const typename AsmTraits_::TrafoEvalData&,
           const typename AsmTraits_::SpaceEvalData&,
           const LocalVec_&,
@@ -43,17 +47,18 @@ namespace FEAT
       {
         typedef typename AsmTraits_::DataType DataType;
 
-        template<typename FuncEval_, typename LocalVec_>
+        template<typename FuncBatch_, typename LocalVec_>
         static DataType eval(
-          FuncEval_& func_eval,
-          const typename AsmTraits_::TrafoEvalData& trafo_data,
+          const FuncBatch_& func_batch,
+          const int point,
+          const typename AsmTraits_::TrafoEvalData&,
           const typename AsmTraits_::SpaceEvalData& space_data,
           const LocalVec_& lvad,
           const int num_loc_dofs
           )
         {
           // evaluate function value
-          typename AnaTraits_::ValueType value = func_eval.value(trafo_data.img_point);
+          typename AnaTraits_::ValueType value = func_batch.values[std::size_t(point)];
 
           // subtract FE function value
           for(int i(0); i < num_loc_dofs; ++i)
@@ -69,9 +74,10 @@ namespace FEAT
       {
         typedef typename AsmTraits_::DataType DataType;
 
-        template<typename FuncEval_, typename LocalVec_>
+        template<typename FuncBatch_, typename LocalVec_>
         static DataType eval(
-          FuncEval_&,
+          const FuncBatch_&,
+          const int,
           const typename AsmTraits_::TrafoEvalData&,
           const typename AsmTraits_::SpaceEvalData&,
           const LocalVec_&,
@@ -88,17 +94,18 @@ namespace FEAT
       {
         typedef typename AsmTraits_::DataType DataType;
 
-        template<typename FuncEval_, typename LocalVec_>
+        template<typename FuncBatch_, typename LocalVec_>
         static DataType eval(
-          FuncEval_& func_eval,
-          const typename AsmTraits_::TrafoEvalData& trafo_data,
+          const FuncBatch_& func_batch,
+          const int point,
+          const typename AsmTraits_::TrafoEvalData&,
           const typename AsmTraits_::SpaceEvalData& space_data,
           const LocalVec_& lvad,
           const int num_loc_dofs
           )
         {
           // evaluate function gradient
-          typename AnaTraits_::GradientType grad = func_eval.gradient(trafo_data.img_point);
+          typename AnaTraits_::GradientType grad = func_batch.grads[std::size_t(point)];
 
           // subtract FE function gradient
           for(int i(0); i < num_loc_dofs; ++i)
@@ -115,9 +122,10 @@ namespace FEAT
       {
         typedef typename AsmTraits_::DataType DataType;
 
-        template<typename FuncEval_, typename LocalVec_>
+        template<typename FuncBatch_, typename LocalVec_>
         static DataType eval(
-          FuncEval_& func_eval,
+          const FuncBatch_& func_batch,
+          const int point,
           const typename AsmTraits_::TrafoEvalData& trafo_data,
           const typename AsmTraits_::SpaceEvalData& space_data,
           const LocalVec_& lvad,
@@ -128,7 +136,7 @@ namespace FEAT
           static constexpr int dom_dim = AsmTraits_::domain_dim;
 
           // evaluate function gradient
-          typename AnaTraits_::GradientType grad = func_eval.gradient(trafo_data.img_point);
+          typename AnaTraits_::GradientType grad = func_batch.grads[std::size_t(point)];
 
           // transform back onto reference element by applying chain rule
           Tiny::Vector<DataType, dom_dim> ref_grad;
@@ -153,9 +161,10 @@ namespace FEAT
       {
         typedef typename AsmTraits_::DataType DataType;
 
-        template<typename FuncEval_, typename LocalVec_>
+        template<typename FuncBatch_, typename LocalVec_>
         static DataType eval(
-          FuncEval_&,
+          const FuncBatch_&,
+          const int,
           const typename AsmTraits_::TrafoEvalData&,
           const typename AsmTraits_::SpaceEvalData&,
           const LocalVec_&,
@@ -171,17 +180,18 @@ namespace FEAT
       {
         typedef typename AsmTraits_::DataType DataType;
 
-        template<typename FuncEval_, typename LocalVec_>
+        template<typename FuncBatch_, typename LocalVec_>
         static DataType eval(
-          FuncEval_& func_eval,
-          const typename AsmTraits_::TrafoEvalData& trafo_data,
+          const FuncBatch_& func_batch,
+          const int point,
+          const typename AsmTraits_::TrafoEvalData&,
           const typename AsmTraits_::SpaceEvalData& space_data,
           const LocalVec_& lvad,
           const int num_loc_dofs
           )
         {
           // evaluate function hessian
-          typename AnaTraits_::HessianType hess = func_eval.hessian(trafo_data.img_point);
+          typename AnaTraits_::HessianType hess = func_batch.hessians[std::size_t(point)];
 
           // subtract FE function hessian
           for(int i(0); i < num_loc_dofs; ++i)
@@ -469,8 +479,14 @@ namespace FEAT
         // create a dof-mapping
         typename AsmTraits::DofMapping dof_mapping(space);
 
-        // create trafo evaluation data
-        typename AsmTraits::TrafoEvalData trafo_data;
+        // create trafo evaluation data for all cubature points
+        const int num_points = cubature_rule.get_num_points();
+        std::vector<typename AsmTraits::TrafoEvalData> trafo_datas;
+        trafo_datas.resize(std::size_t(num_points));
+
+        // create function batch evaluation data
+        Analytic::EvalBatchData<AnalyticEvalTraits> func_batch;
+        func_batch.resize(num_points);
 
         // create space evaluation data
         typename AsmTraits::SpaceEvalData space_data;
@@ -518,11 +534,21 @@ namespace FEAT
           // fetch number of local dofs
           int num_loc_dofs = space_eval.get_num_local_dofs();
 
+          // compute trafo data in all cubature points
+          for(int k(0); k < num_points; ++k)
+          {
+            trafo_eval(trafo_datas[std::size_t(k)], cubature_rule.get_point(k));
+            func_batch.set_point(k, trafo_datas[std::size_t(k)].img_point);
+          }
+
+          // evaluate the analytic function in all cubature points at once
+          func_batch.template eval<max_norm_>(func_eval);
+
           // loop over all quadrature points and integrate
-          for(int k(0); k < cubature_rule.get_num_points(); ++k)
+          for(int k(0); k < num_points; ++k)
           {
-            // compute trafo data
-            trafo_eval(trafo_data, cubature_rule.get_point(k));
+            // fetch trafo data
+            const typename AsmTraits::TrafoEvalData& trafo_data = trafo_datas[std::size_t(k)];
 
             // compute basis function data
             space_eval(space_data, trafo_data);
@@ -531,14 +557,14 @@ namespace FEAT
             const DataType omega = trafo_data.jac_det * cubature_rule.get_weight(k);
 
             // get absolute point error
-            const DataType abs_err = SecH0::eval(func_eval, trafo_data, space_data, lvad, num_loc_dofs);
+            const DataType abs_err = SecH0::eval(func_batch, k, trafo_data, space_data, lvad, num_loc_dofs);
 
             // update results
             result.norm_lmax = Math::max(result.norm_lmax, abs_err);
             result.norm_l1 += omega * abs_err;
             result.norm_h0 += omega * abs_err * abs_err;
-            result.norm_h1 += omega * SecH1::eval(func_eval, trafo_data, space_data, lvad, num_loc_dofs);
-            result.norm_h2 += omega * SecH2::eval(func_eval, trafo_data, space_data, lvad, num_loc_dofs);
+            result.norm_h1 += omega * SecH1::eval(func_batch, k, trafo_data, space_data, lvad, num_loc_dofs);
+            result.norm_h2 += omega * SecH2::eval(func_batch, k, trafo_data, space_data, lvad, num_loc_dofs);
 
             // continue with next cubature point
           }
@@ -569,9 +595,10 @@ namespace FEAT
         typedef typename AsmTraits_::DataType DataType;
         typedef Tiny::Vector<DataType, AnaTraits_::image_dim> ResultType;
 
-        template<typename FuncEval_, typename LocalVec_>
+        template<typename FuncBatch_, typename LocalVec_>
         static ResultType eval(
-          FuncEval_&,
+          const FuncBatch_&,
+          const int,
           const typename AsmTraits_::TrafoEvalData&,
           const typename AsmTraits_::SpaceEvalData&,
           const LocalVec_&,
@@ -588,17 +615,18 @@ namespace FEAT
         typedef typename AsmTraits_::DataType DataType;
         typedef Tiny::Vector<DataType, AnaTraits_::image_dim> ResultType;
 
-        template<typename FuncEval_, typename LocalVec_>
+        template<typename FuncBatch_, typename LocalVec_>
         static ResultType eval(
-          FuncEval_& func_eval,
-          const typename AsmTraits_::TrafoEvalData& trafo_data,
+          const FuncBatch_& func_batch,
+          const int point,
+          const typename AsmTraits_::TrafoEvalData&,
           const typename AsmTraits_::SpaceEvalData& space_data,
           const LocalVec_& lvad,
           const int num_loc_dofs
           )
         {
           // evaluate function value
-          typename AnaTraits_::ValueType value = func_eval.value(trafo_data.img_point);
+          typename AnaTraits_::ValueType value = func_batch.values[std::size_t(point)];
 
           // subtract FE function value
           for(int i(0); i < num_loc_dofs; ++i)
@@ -619,9 +647,10 @@ namespace FEAT
         typedef typename AsmTraits_::DataType DataType;
         typedef Tiny::Vector<DataType, AnaTraits_::image_dim> ResultType;
 
-        template<typename FuncEval_, typename LocalVec_>
+        template<typename FuncBatch_, typename LocalVec_>
         static ResultType eval(
-          FuncEval_&,
+          const FuncBatch_&,
+          const int,
           const typename AsmTraits_::TrafoEvalData&,
           const typename AsmTraits_::SpaceEvalData&,
           const LocalVec_&,
@@ -638,17 +667,18 @@ namespace FEAT
         typedef typename AsmTraits_::DataType DataType;
         typedef Tiny::Vector<DataType, AnaTraits_::image_dim> ResultType;
 
-        template<typename FuncEval_, typename LocalVec_>
+        template<typename FuncBatch_, typename LocalVec_>
         static ResultType eval(
-          FuncEval_& func_eval,
-          const typename AsmTraits_::TrafoEvalData& trafo_data,
+          const FuncBatch_& func_batch,
+          const int point,
+          const typename AsmTraits_::TrafoEvalData&,
           const typename AsmTraits_::SpaceEvalData& space_data,
           const LocalVec_& lvad,
           const int num_loc_dofs
           )
         {
           // evaluate reference function gradient
-          typename AnaTraits_::GradientType grad = func_eval.gradient(trafo_data.img_point);
+          typename AnaTraits_::GradientType grad = func_batch.grads[std::size_t(point)];
 
           // subtract FE function gradient
           for(int i(0); i < num_loc_dofs; ++i)
@@ -669,9 +699,10 @@ namespace FEAT
         typedef typename AsmTraits_::DataType DataType;
         typedef Tiny::Vector<DataType, AnaTraits_::image_dim> ResultType;
 
-        template<typename FuncEval_, typename LocalVec_>
+        template<typename FuncBatch_, typename LocalVec_>
         static ResultType eval(
-          FuncEval_&,
+          const FuncBatch_&,
+          const int,
           const typename AsmTraits_::TrafoEvalData&,
           const typename AsmTraits_::SpaceEvalData&,
           const LocalVec_&,
@@ -688,17 +719,18 @@ namespace FEAT
         typedef typename AsmTraits_::DataType DataType;
         typedef Tiny::Vector<DataType, AnaTraits_::image_dim> ResultType;
 
-        template<typename FuncEval_, typename LocalVec_>
+        template<typename FuncBatch_, typename LocalVec_>
         static ResultType eval(
-          FuncEval_& func_eval,
-          const typename AsmTraits_::TrafoEvalData& trafo_data,
+          const FuncBatch_& func_batch,
+          const int point,
+          const typename AsmTraits_::TrafoEvalData&,
           const typename AsmTraits_::SpaceEvalData& space_data,
           const LocalVec_& lvad,
           const int num_loc_dofs
           )
         {
           // evaluate reference function hessian
-          typename AnaTraits_::HessianType hess = func_eval.hessian(trafo_data.img_point);
+          typename AnaTraits_::HessianType hess = func_batch.hessians[std::size_t(point)];
 
           // subtract FE function hessian
           for(int i(0); i < num_loc_dofs; ++i)
@@ -1108,8 +1140,14 @@ namespace FEAT
         // create a dof-mapping
         typename AsmTraits::DofMapping dof_mapping(space);
 
-        // create trafo evaluation data
-        typename AsmTraits::TrafoEvalData trafo_data;
+        // create trafo evaluation data for all cubature points
+        const int num_points = cubature_rule.get_num_points();
+        std::vector<typename AsmTraits::TrafoEvalData> trafo_datas;
+        trafo_datas.resize(std::size_t(num_points));
+
+        // create function batch evaluation data
+        Analytic::EvalBatchData<AnalyticEvalTraits> func_batch;
+        func_batch.resize(num_points);
 
         // create space evaluation data
         typename AsmTraits::SpaceEvalData space_data;
@@ -1160,11 +1198,21 @@ namespace FEAT
           // fetch number of local dofs
           int num_loc_dofs = space_eval.get_num_local_dofs();
 
+          // compute trafo data in all cubature points
+          for(int k(0); k < num_points; ++k)
+          {
+            trafo_eval(trafo_datas[std::size_t(k)], cubature_rule.get_point(k));
+            func_batch.set_point(k, trafo_datas[std::size_t(k)].img_point);
+          }
+
+          // evaluate the analytic function in all cubature points at once
+          func_batch.template eval<max_norm_>(func_eval);
+
           // loop over all quadrature points and integrate
-          for(int k(0); k < cubature_rule.get_num_points(); ++k)
+          for(int k(0); k < num_points; ++k)
           {
-            // compute trafo data
-            trafo_eval(trafo_data, cubature_rule.get_point(k));
+            // fetch trafo data
+            const typename AsmTraits::TrafoEvalData& trafo_data = trafo_datas[std::size_t(k)];
 
             // compute basis function data
             space_eval(space_data, trafo_data);
@@ -1173,7 +1221,7 @@ namespace FEAT
             const DataType omega = trafo_data.jac_det * cubature_rule.get_weight(k);
 
             // get absolute point error
-            auto abs_err = VecH0::eval(func_eval, trafo_data, space_data, lvad, num_loc_dofs);
+            auto abs_err = VecH0::eval(func_batch, k, trafo_data, space_data, lvad, num_loc_dofs);
 
             // update H0/L1/Lmax results
             for(int i(0); i < dim; ++i)
@@ -1184,8 +1232,8 @@ namespace FEAT
             }
 
             // update H1/H2 results
-            info.norm_h1_comp.axpy(omega, VecH1::eval(func_eval, trafo_data, space_data, lvad, num_loc_dofs));
-            info.norm_h2_comp.axpy(omega, VecH2::eval(func_eval, trafo_data, space_data, lvad, num_loc_dofs));
+            info.norm_h1_comp.axpy(omega, VecH1::eval(func_batch, k, trafo_data, space_data, lvad, num_loc_dofs));
+            info.norm_h2_comp.axpy(omega, VecH2::eval(func_batch, k, trafo_data, space_data, lvad, num_loc_dofs));
 
             // continue with next cubature point
           }
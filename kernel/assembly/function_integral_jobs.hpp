@@ -14,6 +14,9 @@
 #include <kernel/lafem/dense_vector_blocked.hpp>
 #include <kernel/util/dist.hpp>
 
+// includes, system
+#include <vector>
+
 namespace FEAT
 {
   namespace Assembly
@@ -673,33 +676,33 @@ namespace FEAT
       template<>
       struct AnaFunIntJobHelper<0>
       {
-        template<typename FID_, typename DT_, typename FEV_, typename IPT_>
-        static void work(FID_& fid, const DT_ omega, FEV_& fev, const IPT_& ipt)
+        template<typename FID_, typename DT_, typename FEB_>
+        static void work(FID_& fid, const DT_ omega, const FEB_& feb, const int k)
         {
-          fid.add_value(omega, fev.value(ipt));
+          fid.add_value(omega, feb.values[std::size_t(k)]);
         }
       };
 
       template<>
       struct AnaFunIntJobHelper<1>
       {
-        template<typename FID_, typename DT_, typename FEV_, typename IPT_>
-        static void work(FID_& fid, const DT_ omega, FEV_& fev, const IPT_& ipt)
+        template<typename FID_, typename DT_, typename FEB_>
+        static void work(FID_& fid, const DT_ omega, const FEB_& feb, const int k)
         {
-          fid.add_value(omega, fev.value(ipt));
-          fid.add_grad(omega, fev.gradient(ipt));
+          fid.add_value(omega, feb.values[std::size_t(k)]);
+          fid.add_grad(omega, feb.grads[std::size_t(k)]);
         }
       };
 
       template<>
       struct AnaFunIntJobHelper<2>
       {
-        template<typename FID_, typename DT_, typename FEV_, typename IPT_>
-        static void work(FID_& fid, const DT_ omega, FEV_& fev, const IPT_& ipt)
+        template<typename FID_, typename DT_, typename FEB_>
+        static void work(FID_& fid, const DT_ omega, const FEB_& feb, const int k)
         {
-          fid.add_value(omega, fev.value(ipt));
-          fid.add_grad(omega, fev.gradient(ipt));
-          fid.add_hess(omega, fev.hessian(ipt));
+          fid.add_value(omega, feb.values[std::size_t(k)]);
+          fid.add_grad(omega, feb.grads[std::size_t(k)]);
+          fid.add_hess(omega, feb.hessians[std::size_t(k)]);
         }
       };
 
@@ -807,11 +810,11 @@ namespace FEAT
       struct ErrFunIntJobHelper<0>
       {
         // version for scalar functions
-        template<typename FID_, typename DT_, typename FEV_, typename IPT_, typename SED_, int n_, int sn_>
-        static void work(FID_& fid, const DT_ omega, FEV_& fev, const IPT_& ipt, const SED_& sed,
+        template<typename FID_, typename DT_, typename FEB_, typename SED_, int n_, int sn_>
+        static void work(FID_& fid, const DT_ omega, const FEB_& feb, const int k, const SED_& sed,
           const Tiny::Vector<DT_, n_, sn_>& lvec, int n)
         {
-          typename FID_::ValueType    v = fev.value(ipt);
+          typename FID_::ValueType    v = feb.values[std::size_t(k)];
           for(int i(0); i < n; ++i)
           {
             v -= lvec[i] * sed.phi[i].value;
@@ -821,11 +824,11 @@ namespace FEAT
         }
 
         // version for vector fields
-        template<typename FID_, typename DT_, typename FEV_, typename IPT_, typename SED_, int d_, int sd_, int n_, int sn_>
-        static void work(FID_& fid, const DT_ omega, FEV_& fev, const IPT_& ipt, const SED_& sed,
+        template<typename FID_, typename DT_, typename FEB_, typename SED_, int d_, int sd_, int n_, int sn_>
+        static void work(FID_& fid, const DT_ omega, const FEB_& feb, const int k, const SED_& sed,
           const Tiny::Vector<Tiny::Vector<DT_, d_, sd_>, n_, sn_>& lvec, int n)
         {
-          typename FID_::ValueType    v = fev.value(ipt);
+          typename FID_::ValueType    v = feb.values[std::size_t(k)];
           for(int i(0); i < n; ++i)
           {
             v.axpy(-sed.phi[i].value, lvec[i]);
@@ -839,12 +842,12 @@ namespace FEAT
       struct ErrFunIntJobHelper<1>
       {
         // version for scalar functions
-        template<typename FID_, typename DT_, typename FEV_, typename IPT_, typename SED_, int n_, int sn_>
-        static void work(FID_& fid, const DT_ omega, FEV_& fev, const IPT_& ipt, const SED_& sed,
+        template<typename FID_, typename DT_, typename FEB_, typename SED_, int n_, int sn_>
+        static void work(FID_& fid, const DT_ omega, const FEB_& feb, const int k, const SED_& sed,
           const Tiny::Vector<DT_, n_, sn_>& lvec, int n)
         {
-          typename FID_::ValueType    v = fev.value(ipt);
-          typename FID_::GradientType g = fev.gradient(ipt);
+          typename FID_::ValueType    v = feb.values[std::size_t(k)];
+          typename FID_::GradientType g = feb.grads[std::size_t(k)];
           for(int i(0); i < n; ++i)
           {
             v -= lvec[i] * sed.phi[i].value;
@@ -856,12 +859,12 @@ namespace FEAT
         }
 
         // version for vector fields
-        template<typename FID_, typename DT_, typename FEV_, typename IPT_, typename SED_, int d_, int sd_, int n_, int sn_>
-        static void work(FID_& fid, const DT_ omega, FEV_& fev, const IPT_& ipt, const SED_& sed,
+        template<typename FID_, typename DT_, typename FEB_, typename SED_, int d_, int sd_, int n_, int sn_>
+        static void work(FID_& fid, const DT_ omega, const FEB_& feb, const int k, const SED_& sed,
           const Tiny::Vector<Tiny::Vector<DT_, d_, sd_>, n_, sn_>& lvec, int n)
         {
-          typename FID_::ValueType    v = fev.value(ipt);
-          typename FID_::GradientType g = fev.gradient(ipt);
+          typename FID_::ValueType    v = feb.values[std::size_t(k)];
+          typename FID_::GradientType g = feb.grads[std::size_t(k)];
           for(int i(0); i < n; ++i)
           {
             v.axpy(-sed.phi[i].value, lvec[i]);
@@ -877,13 +880,13 @@ namespace FEAT
       struct ErrFunIntJobHelper<2>
       {
         // version for scalar functions
-        template<typename FID_, typename DT_, typename FEV_, typename IPT_, typename SED_, int n_, int sn_>
-        static void work(FID_& fid, const DT_ omega, FEV_& fev, const IPT_& ipt, const SED_& sed,
+        template<typename FID_, typename DT_, typename FEB_, typename SED_, int n_, int sn_>
+        static void work(FID_& fid, const DT_ omega, const FEB_& feb, const int k, const SED_& sed,
           const Tiny::Vector<DT_, n_, sn_>& lvec, int n)
         {
-          typename FID_::ValueType    v = fev.value(ipt);
-          typename FID_::GradientType g = fev.gradient(ipt);
-          typename FID_::HessianType  h = fev.hessian(ipt);
+          typename FID_::ValueType    v = feb.values[std::size_t(k)];
+          typename FID_::GradientType g = feb.grads[std::size_t(k)];
+          typename FID_::HessianType  h = feb.hessians[std::size_t(k)];
           for(int i(0); i < n; ++i)
           {
             v -= lvec[i] * sed.phi[i].value;
@@ -897,13 +900,13 @@ namespace FEAT
         }
 
         // version for vector fields
-        template<typename FID_, typename DT_, typename FEV_, typename IPT_, typename SED_, int d_, int sd_, int n_, int sn_>
-        static void work(FID_& fid, const DT_ omega, FEV_& fev, const IPT_& ipt, const SED_& sed,
+        template<typename FID_, typename DT_, typename FEB_, typename SED_, int d_, int sd_, int n_, int sn_>
+        static void work(FID_& fid, const DT_ omega, const FEB_& feb, const int k, const SED_& sed,
           const Tiny::Vector<Tiny::Vector<DT_, d_, sd_>, n_, sn_>& lvec, int n)
         {
-          typename FID_::ValueType    v = fev.value(ipt);
-          typename FID_::GradientType g = fev.gradient(ipt);
-          typename FID_::HessianType  h = fev.hessian(ipt);
+          typename FID_::ValueType    v = feb.values[std::size_t(k)];
+          typename FID_::GradientType g = feb.grads[std::size_t(k)];
+          typename FID_::HessianType  h = feb.hessians[std::size_t(k)];
           for(int i(0); i < n; ++i)
           {
             v.axpy(-sed.phi[i].value, lvec[i]);
@@ -1000,6 +1003,10 @@ namespace FEAT
         typename Assembly::Intern::CubatureTraits<TrafoEvaluator>::RuleType cubature_rule;
         /// the function evaluator
         typename Function_::template Evaluator<AnalyticEvalTraits> func_eval;
+        /// the function batch evaluation data
+        Analytic::EvalBatchData<AnalyticEvalTraits> func_batch;
+        /// the integration weights
+        std::vector<DataType> weights;
         /// the local integrals
         FunctionIntegralType loc_integral;
         /// the accumulated job integral
@@ -1011,9 +1018,12 @@ namespace FEAT
           trafo_data(),
           cubature_rule(Cubature::ctor_factory, job._cubature_factory),
           func_eval(job._function),
+          func_batch(),
+          weights(std::size_t(cubature_rule.get_num_points())),
           loc_integral(),
           job_integral(job._integral)
         {
+          func_batch.resize(cubature_rule.get_num_points());
         }
 
         void prepare(Index cell)
@@ -1023,15 +1033,24 @@ namespace FEAT
 
         void assemble()
         {
-          // loop over all quadrature points and integrate
-          for(int k(0); k < cubature_rule.get_num_points(); ++k)
+          const int num_points = cubature_rule.get_num_points();
+
+          // compute trafo data in all quadrature points
+          for(int k(0); k < num_points; ++k)
           {
-            // compute trafo data
             trafo_eval(trafo_data, cubature_rule.get_point(k));
+            func_batch.set_point(k, trafo_data.img_point);
+            weights[std::size_t(k)] = cubature_rule.get_weight(k) * trafo_data.jac_det;
+          }
 
+          // evaluate the function in all quadrature points at once
+          func_batch.template eval<max_der_>(func_eval);
+
+          // loop over all quadrature points and integrate
+          for(int k(0); k < num_points; ++k)
+          {
             // call helper to integrate
-            Intern::AnaFunIntJobHelper<max_der_>::work(loc_integral,
-              cubature_rule.get_weight(k) * trafo_data.jac_det, func_eval, trafo_data.img_point);
+            Intern::AnaFunIntJobHelper<max_der_>::work(loc_integral, weights[std::size_t(k)], func_batch, k);
           }
         }
 
@@ -1313,6 +1332,9 @@ namespace FEAT
       /// declare our analytic eval traits
       typedef Analytic::EvalTraits<DataType, Function_> AnalyticEvalTraits;
 
+      /// the trafo geometry cache type
+      typedef Trafo::GeometryCache<typename Space_::TrafoType, DataType> GeometryCacheType;
+
     public:
       class Task
       {
@@ -1344,8 +1366,12 @@ namespace FEAT
         typename AsmTraits::DofMapping dof_mapping;
         /// the cubature rule used for integration
         typename AsmTraits::CubatureRuleType cubature_rule;
-        /// the trafo evaluation data
-        typename AsmTraits::TrafoEvalData trafo_data;
+        /// the trafo geometry cache; may be nullptr
+        const typename AsmTraits::GeometryCacheType* geo_cache;
+        /// the index of the current cell
+        Index cur_cell;
+        /// the trafo evaluation data for all cubature points
+        std::vector<typename AsmTraits::TrafoEvalData> trafo_datas;
         /// the space evaluation data
         typename AsmTraits::SpaceEvalData space_data;
         /// the local vector to be assembled
@@ -1354,6 +1380,8 @@ namespace FEAT
         typename Vector_::GatherAxpy gather_axpy;
         /// the function evaluator
         typename Function_::template Evaluator<AnalyticEvalTraits> func_eval;
+        /// the function batch evaluation data
+        Analytic::EvalBatchData<AnalyticEvalTraits> func_batch;
         /// the local integral
         FunctionIntegralType loc_integral;
         /// the function value
@@ -1368,23 +1396,32 @@ namespace FEAT
           space_eval(space),
           dof_mapping(space),
           cubature_rule(Cubature::ctor_factory, job._cubature_factory),
-          trafo_data(),
+          geo_cache(nullptr),
+          cur_cell(~Index(0)),
+          trafo_datas(std::size_t(cubature_rule.get_num_points())),
           space_data(),
           local_vector(),
           gather_axpy(vector),
           func_eval(job._function),
+          func_batch(),
           loc_integral(),
           job_integral(job._integral)
         {
+          func_batch.resize(cubature_rule.get_num_points());
+          if((job._geometry_cache != nullptr) && job._geometry_cache->template is_compatible<AsmTraits::trafo_config>(cubature_rule))
+            geo_cache = job._geometry_cache;
         }
 
         void prepare(Index cell)
         {
           // prepare dof mapping
           dof_mapping.prepare(cell);
+          cur_cell = cell;
 
-          // prepare trafo evaluator
-          trafo_eval.prepare(cell);
+          // prepare trafo evaluator; this can be skipped if the geometry cache replaces the trafo
+          // evaluator, because parametric space evaluators do not evaluate the trafo here
+          if((geo_cache == nullptr) || !AsmTraits::SpaceEvaluator::ref_data_cell_invariant)
+            trafo_eval.prepare(cell);
 
           // prepare space evaluator
           space_eval.prepare(trafo_eval);
@@ -1401,18 +1438,36 @@ namespace FEAT
           // fetch number of local dofs
           const int num_loc_dofs = space_eval.get_num_local_dofs();
 
+          const int num_points = cubature_rule.get_num_points();
+
+          // compute trafo data in all quadrature points
+          for(int k(0); k < num_points; ++k)
+          {
+            auto& trafo_data = trafo_datas[std::size_t(k)];
+            if(geo_cache != nullptr)
+              geo_cache->eval(trafo_data, cur_cell, k);
+            else
+              trafo_eval(trafo_data, cubature_rule.get_point(k));
+            func_batch.set_point(k, trafo_data.img_point);
+          }
+
+          // evaluate the function in all quadrature points at once
+          func_batch.template eval<max_der_>(func_eval);
+
           // loop over all quadrature points and integrate
-          for(int k(0); k < cubature_rule.get_num_points(); ++k)
+          for(int k(0); k < num_points; ++k)
           {
-            // compute trafo data
-            trafo_eval(trafo_data, cubature_rule.get_point(k));
+            const auto& trafo_data = trafo_datas[std::size_t(k)];
 
             // compute basis function data
             space_eval(space_data, trafo_data);
 
+            // fetch the integration weight
+            const DataType omega = (geo_cache != nullptr) ? geo_cache->get_weighted_det(cur_cell, k) :
+              cubature_rule.get_weight(k) * trafo_data.jac_det;
+
             // do the dirty work
-            Intern::ErrFunIntJobHelper<max_der_>::work(loc_integral,
-              cubature_rule.get_weight(k) * trafo_data.jac_det, func_eval, trafo_data.img_point,
+            Intern::ErrFunIntJobHelper<max_der_>::work(loc_integral, omega, func_batch, k,
               space_data, local_vector, num_loc_dofs);
           }
         }
@@ -1444,6 +1499,8 @@ namespace FEAT
       Cubature::DynamicFactory _cubature_factory;
       /// the function integral
       FunctionIntegralType _integral;
+      /// the trafo geometry cache
+      const GeometryCacheType* _geometry_cache;
 
     public:
       /**
@@ -1466,11 +1523,24 @@ namespace FEAT
         _vector(vector),
         _space(space),
         _cubature_factory(cubature),
-        _integral()
+        _integral(),
+        _geometry_cache(nullptr)
       {
         _integral.max_der = max_der_;
       }
 
+      /**
+       * \brief Sets a trafo geometry cache for the integration
+       *
+       * \param[in] cache
+       * A \resident pointer to the geometry cache that is to be used or \c nullptr to disable it.
+       * The cache is only used if it is compatible with the cubature rule of this job.
+       */
+      void set_geometry_cache(const GeometryCacheType* cache)
+      {
+        _geometry_cache = cache;
+      }
+
       // \returns The integral of the discrete function
       const FunctionIntegralType& result() const
       {
@@ -0,0 +1,346 @@
+// FEAT3: Finite Element Analysis Toolbox, Version 3
+// Copyright (C) 2010 - 2023 by Stefan Turek & the FEAT group
+// FEAT3 is released under the GNU General Public License version 3,
+// see the file 'copyright.txt' in the top level directory for details.
+
+#include <test_system/test_system.hpp>
+#include <kernel/analytic/common.hpp>
+#include <kernel/assembly/bilinear_operator_assembler.hpp>
+#include <kernel/assembly/common_functionals.hpp>
+#include <kernel/assembly/common_operators.hpp>
+#include <kernel/assembly/hanging_node_filter_assembler.hpp>
+#include <kernel/assembly/interpolator.hpp>
+#include <kernel/assembly/linear_functional_assembler.hpp>
+#include <kernel/assembly/symbolic_assembler.hpp>
+#include <kernel/assembly/unit_filter_assembler.hpp>
+#include <kernel/geometry/boundary_factory.hpp>
+#include <kernel/geometry/common_factories.hpp>
+#include <kernel/geometry/hanging_node_refinery.hpp>
+#include <kernel/lafem/filter_chain.hpp>
+#include <kernel/lafem/hanging_node_filter.hpp>
+#include <kernel/lafem/sparse_matrix_csr.hpp>
+#include <kernel/lafem/unit_filter.hpp>
+#include <kernel/solver/jacobi_precond.hpp>
+#include <kernel/solver/pcg.hpp>
+#include <kernel/space/lagrange1/element.hpp>
+#include <kernel/space/lagrange2/element.hpp>
+#include <kernel/trafo/standard/mapping.hpp>
+#include <kernel/util/random.hpp>
+
+using namespace FEAT;
+using namespace FEAT::TestSystem;
+
+/**
+ * \brief Test class for the HangingNodeFilter class template and its assembler.
+ *
+ * \test Tests the hanging-node filter together with a Dirichlet unit filter on the boundary
+ * mesh-part by solving a Poisson problem with a linear solution on a locally refined mesh with
+ * hanging vertices, which is preconditioned by the filtered conforming matrix. For Lagrange-2
+ * spaces, it checks that the filter reproduces the interpolant of a biquadratic function and
+ * solves a Poisson problem with this function as exact solution.
+ */
+template<typename DataType_, typename IndexType_>
+class HangingNodeFilterTest :
+  public UnitTest
+{
+  typedef LAFEM::DenseVector<DataType_, IndexType_> VectorType;
+  typedef LAFEM::SparseMatrixCSR<DataType_, IndexType_> MatrixType;
+  typedef LAFEM::UnitFilter<DataType_, IndexType_> UnitFilterType;
+  typedef LAFEM::HangingNodeFilter<DataType_, IndexType_> HangingFilterType;
+  typedef LAFEM::FilterChain<UnitFilterType, HangingFilterType> FilterType;
+
+public:
+  HangingNodeFilterTest(PreferredBackend backend) :
+    UnitTest("HangingNodeFilterTest", Type::Traits<DataType_>::name(), Type::Traits<IndexType_>::name(), backend)
+  {
+  }
+
+  virtual ~HangingNodeFilterTest()
+  {
+  }
+
+  /// the exact solution, which is contained in the conforming Q1 space
+  template<typename Point_>
+  static DataType_ linear_func(const Point_& p)
+  {
+    DataType_ u(1);
+    for(int k(0); k < Point_::n; ++k)
+      u += DataType_(k+1) * DataType_(p[k]);
+    return u;
+  }
+
+  /**
+   * \brief Creates a locally refined mesh by refining all elements around the origin twice
+   */
+  template<typename Mesh_>
+  static std::unique_ptr<Mesh_> create_mesh(int level, Adjacency::Graph& hanging)
+  {
+    typedef Geometry::HangingNodeRefinery<Mesh_> RefineryType;
+    Geometry::RefinedUnitCubeFactory<Mesh_> factory(level);
+    std::unique_ptr<Mesh_> mesh(new Mesh_(factory));
+    Adjacency::Graph parents;
+    for(int step(0); step < 2; ++step)
+    {
+      const double radius = (step == 0 ? 0.5 : 0.3);
+      std::vector<int> marker = RefineryType::mark_elements(*mesh,
+        [radius](const typename Mesh_::VertexType& p) {return p.norm_euclid() < radius;});
+      RefineryType refinery(*mesh, marker, parents);
+      std::unique_ptr<Mesh_> fine_mesh(new Mesh_(refinery));
+      parents = refinery.get_vertex_parents();
+      mesh = std::move(fine_mesh);
+    }
+    hanging = RefineryType::compute_hanging_vertices(*mesh, parents);
+    return mesh;
+  }
+
+  template<typename Mesh_>
+  void test_poisson(int level) const
+  {
+    typedef Trafo::Standard::Mapping<Mesh_> TrafoType;
+    typedef Space::Lagrange1::Element<TrafoType> SpaceType;
+    const DataType_ tol = Math::pow(Math::eps<DataType_>(), DataType_(0.6));
+
+    Adjacency::Graph hanging;
+    std::unique_ptr<Mesh_> mesh = create_mesh<Mesh_>(level, hanging);
+    TrafoType trafo(*mesh);
+    SpaceType space(trafo);
+    const Index num_dofs = space.get_num_dofs();
+    TEST_CHECK(hanging.get_num_indices() > Index(0));
+
+    // assemble the Laplace matrix on the non-conforming mesh
+    MatrixType matrix;
+    Assembly::SymbolicAssembler::assemble_matrix_std1(matrix, space);
+    matrix.format();
+    Assembly::Common::LaplaceOperator laplace;
+    Assembly::BilinearOperatorAssembler::assemble_matrix1(matrix, laplace, space, Cubature::DynamicFactory("gauss-legendre:2"));
+
+    // interpolate the exact solution; the Q1 DOFs coincide with the mesh vertices
+    const auto& vtx = mesh->get_vertex_set();
+    VectorType vec_exact(num_dofs);
+    for(Index i(0); i < num_dofs; ++i)
+      vec_exact(i, linear_func(vtx[i]));
+
+    // count the vertices on the domain boundary
+    std::vector<int> geo_bnd(num_dofs, 0);
+    Index num_geo_bnd(0);
+    for(Index i(0); i < num_dofs; ++i)
+    {
+      for(int k(0); k < Mesh_::world_dim; ++k)
+        geo_bnd[i] |= ((vtx[i][k] < 1E-12) || (vtx[i][k] > 1.0 - 1E-12) ? 1 : 0);
+      num_geo_bnd += Index(geo_bnd[i]);
+    }
+
+    // without the facet mask, the BoundaryFactory also regards the hanging interfaces as boundary
+    {
+      Geometry::BoundaryFactory<Mesh_> bnd_factory(*mesh);
+      Geometry::MeshPart<Mesh_> bnd_part(bnd_factory);
+      TEST_CHECK(bnd_part.get_num_entities(0) > num_geo_bnd);
+    }
+
+    // create the boundary mesh-part without the hanging interface facets
+    std::vector<int> facet_mask = Geometry::HangingNodeRefinery<Mesh_>::compute_interface_facets(*mesh, hanging);
+    Geometry::BoundaryFactory<Mesh_> bnd_factory(*mesh, facet_mask);
+    Geometry::MeshPart<Mesh_> bnd_part(bnd_factory);
+
+    // assemble the Dirichlet unit filter on the boundary mesh-part
+    FilterType filter;
+    UnitFilterType& unit_filter = filter.template at<0>();
+    Assembly::UnitFilterAssembler<Mesh_> unit_asm;
+    unit_asm.add_mesh_part(bnd_part);
+    unit_asm.assemble(unit_filter, space, vec_exact);
+
+    // the unit filter must contain exactly the vertices on the domain boundary
+    TEST_CHECK_EQUAL(unit_filter.used_elements(), num_geo_bnd);
+    const IndexType_* uf_idx = unit_filter.get_indices();
+    for(Index i(0); i < unit_filter.used_elements(); ++i)
+    {
+      TEST_CHECK_EQUAL(geo_bnd[uf_idx[i]], 1);
+    }
+
+    Assembly::HangingNodeFilterAssembler::assemble(filter.template at<1>(), space, hanging, unit_filter);
+    TEST_CHECK(filter.template at<1>().used_elements() > Index(0));
+
+    // solve the system with a zero right-hand-side
+    VectorType vec_sol(num_dofs, DataType_(0));
+    VectorType vec_rhs(num_dofs, DataType_(0));
+    filter.filter_sol(vec_sol);
+    filter.filter_rhs(vec_rhs);
+
+    // the filtered matrix does not depend on the order of the unit and hanging-node filters
+    MatrixType matrix_filtered = matrix.clone();
+    filter.filter_mat(matrix_filtered);
+    {
+      MatrixType matrix_filtered2 = matrix.clone();
+      filter.template at<1>().filter_mat(matrix_filtered2);
+      filter.template at<0>().filter_mat(matrix_filtered2);
+      TEST_CHECK_EQUAL(matrix_filtered2.used_elements(), matrix_filtered.used_elements());
+      matrix_filtered2.axpy(matrix_filtered, matrix_filtered2, -DataType_(1));
+      TEST_CHECK_EQUAL_WITHIN_EPS(matrix_filtered2.max_abs_element(), DataType_(0), tol);
+    }
+
+    // precondition by the diagonal of the conforming matrix
+    auto precond = Solver::new_jacobi_precond(matrix_filtered, filter);
+    auto solver = Solver::new_pcg(matrix, filter, precond);
+    solver->set_max_iter(1000);
+    solver->set_tol_rel(tol);
+    solver->init();
+    Solver::Status status = Solver::solve(*solver, vec_sol, vec_rhs, matrix, filter);
+    solver->done();
+    TEST_CHECK(Solver::status_success(status));
+
+    // the linear function is contained in the conforming Q1 space, so it must be reproduced exactly
+    for(Index i(0); i < num_dofs; ++i)
+    {
+      TEST_CHECK_EQUAL_WITHIN_EPS(vec_sol(i), vec_exact(i), DataType_(100) * tol);
+    }
+  }
+
+  template<typename Mesh_>
+  void test_poisson_q2(int level) const
+  {
+    typedef Trafo::Standard::Mapping<Mesh_> TrafoType;
+    typedef Space::Lagrange2::Element<TrafoType> SpaceType;
+    const DataType_ tol = Math::pow(Math::eps<DataType_>(), DataType_(0.6));
+
+    Adjacency::Graph hanging;
+    std::unique_ptr<Mesh_> mesh = create_mesh<Mesh_>(level, hanging);
+    TrafoType trafo(*mesh);
+    SpaceType space(trafo);
+    const Index num_dofs = space.get_num_dofs();
+
+    // the Q2 bubble is contained in the conforming Q2 space and vanishes on the boundary
+    Analytic::Common::Q2BubbleFunction<Mesh_::shape_dim> bubble;
+    VectorType vec_exact;
+    Assembly::Interpolator::project(vec_exact, bubble, space);
+
+    std::vector<int> facet_mask = Geometry::HangingNodeRefinery<Mesh_>::compute_interface_facets(*mesh, hanging);
+    Geometry::BoundaryFactory<Mesh_> bnd_factory(*mesh, facet_mask);
+    Geometry::MeshPart<Mesh_> bnd_part(bnd_factory);
+
+    FilterType filter;
+    Assembly::UnitFilterAssembler<Mesh_> unit_asm;
+    unit_asm.add_mesh_part(bnd_part);
+    unit_asm.assemble(filter.template at<0>(), space);
+    Assembly::HangingNodeFilterAssembler::assemble(filter.template at<1>(), space, hanging, filter.template at<0>());
+    TEST_CHECK(filter.template at<1>().used_elements() > Index(0));
+
+    // the interpolant of a function in the conforming space is a fix-point of the solution filter
+    {
+      VectorType vec_tmp(vec_exact.clone());
+      filter.filter_sol(vec_tmp);
+      vec_tmp.axpy(vec_exact, vec_tmp, -DataType_(1));
+      TEST_CHECK_EQUAL_WITHIN_EPS(vec_tmp.max_abs_element(), DataType_(0), tol);
+    }
+
+    // assemble the Laplace matrix and the right-hand side -laplace(u)
+    MatrixType matrix;
+    Assembly::SymbolicAssembler::assemble_matrix_std1(matrix, space);
+    matrix.format();
+    Assembly::Common::LaplaceOperator laplace;
+    Assembly::BilinearOperatorAssembler::assemble_matrix1(matrix, laplace, space, Cubature::DynamicFactory("gauss-legendre:3"));
+    VectorType vec_rhs(num_dofs, DataType_(0));
+    Assembly::Common::LaplaceFunctional<decltype(bubble)> functional(bubble);
+    Assembly::LinearFunctionalAssembler::assemble_vector(vec_rhs, functional, space, Cubature::DynamicFactory("gauss-legendre:3"));
+
+    VectorType vec_sol(num_dofs, DataType_(0));
+    filter.filter_sol(vec_sol);
+    filter.filter_rhs(vec_rhs);
+    MatrixType matrix_filtered = matrix.clone();
+    filter.filter_mat(matrix_filtered);
+
+    auto precond = Solver::new_jacobi_precond(matrix_filtered, filter);
+    auto solver = Solver::new_pcg(matrix, filter, precond);
+    solver->set_max_iter(1000);
+    solver->set_tol_rel(tol);
+    solver->init();
+    Solver::Status status = Solver::solve(*solver, vec_sol, vec_rhs, matrix, filter);
+    solver->done();
+    TEST_CHECK(Solver::status_success(status));
+
+    // the discrete solution is the interpolant of the exact solution
+    vec_sol.axpy(vec_exact, vec_sol, -DataType_(1));
+    TEST_CHECK_EQUAL_WITHIN_EPS(vec_sol.max_abs_element(), DataType_(0), DataType_(100) * tol);
+  }
+
+  void test_adjoint() const
+  {
+    typedef Geometry::ConformalMesh<Shape::Quadrilateral> MeshType;
+    typedef Trafo::Standard::Mapping<MeshType> TrafoType;
+    typedef Space::Lagrange1::Element<TrafoType> SpaceType;
+    const DataType_ tol = Math::pow(Math::eps<DataType_>(), DataType_(0.8));
+
+    Adjacency::Graph hanging;
+    std::unique_ptr<MeshType> mesh = create_mesh<MeshType>(2, hanging);
+    TrafoType trafo(*mesh);
+    SpaceType space(trafo);
+    const Index num_dofs = space.get_num_dofs();
+
+    HangingFilterType filter;
+    Assembly::HangingNodeFilterAssembler::assemble(filter, space, hanging);
+    TEST_CHECK_EQUAL(filter.size(), num_dofs);
+
+    // the correction and defect filters are adjoint to each other: <cor(x), y> = <x, def(y)>
+    Random rng;
+    VectorType vec_x(rng, num_dofs, DataType_(-1), DataType_(1));
+    VectorType vec_y(rng, num_dofs, DataType_(-1), DataType_(1));
+    VectorType vec_cx(vec_x.clone()), vec_dy(vec_y.clone());
+    filter.filter_cor(vec_cx);
+    filter.filter_def(vec_dy);
+    TEST_CHECK_EQUAL_WITHIN_EPS(vec_cx.dot(vec_y), vec_x.dot(vec_dy), tol);
+
+    // all slave entries of a filtered defect are zero and the filtered correction is a fix-point
+    const IndexType_* slaves = filter.get_slaves().elements();
+    for(Index i(0); i < filter.used_elements(); ++i)
+    {
+      TEST_CHECK_EQUAL(vec_dy(slaves[i]), DataType_(0));
+    }
+    VectorType vec_cx2(vec_cx.clone());
+    filter.filter_cor(vec_cx2);
+    vec_cx2.axpy(vec_cx, vec_cx2, -DataType_(1));
+    TEST_CHECK_EQUAL_WITHIN_EPS(vec_cx2.norm2(), DataType_(0), tol);
+
+    // the filtered matrix is the conforming matrix: C*y = def(A*cor(y)) for all y with zero slave entries
+    MatrixType matrix;
+    Assembly::SymbolicAssembler::assemble_matrix_std1(matrix, space);
+    matrix.format();
+    Assembly::Common::LaplaceOperator laplace;
+    Assembly::BilinearOperatorAssembler::assemble_matrix1(matrix, laplace, space, Cubature::DynamicFactory("gauss-legendre:2"));
+    MatrixType matrix_filtered = matrix.clone();
+    filter.filter_mat(matrix_filtered);
+    VectorType vec_z(vec_x.clone());
+    for(Index i(0); i < filter.used_elements(); ++i)
+      vec_z(slaves[i], DataType_(0));
+    VectorType vec_cz(vec_z.clone()), vec_az(num_dofs), vec_fz(num_dofs);
+    filter.filter_cor(vec_cz);
+    matrix.apply(vec_az, vec_cz);
+    filter.filter_def(vec_az);
+    matrix_filtered.apply(vec_fz, vec_z);
+    vec_fz.axpy(vec_az, vec_fz, -DataType_(1));
+    TEST_CHECK_EQUAL_WITHIN_EPS(vec_fz.norm2(), DataType_(0), tol);
+
+    // the filtered matrix is symmetric
+    MatrixType matrix_trans = matrix_filtered.transpose();
+    matrix_trans.axpy(matrix_filtered, matrix_trans, -DataType_(1));
+    TEST_CHECK_EQUAL_WITHIN_EPS(matrix_trans.max_abs_element(), DataType_(0), tol);
+
+    // test clone and convert
+    HangingFilterType filter2 = filter.clone();
+    TEST_CHECK_EQUAL(filter2.used_elements(), filter.used_elements());
+    LAFEM::HangingNodeFilter<float, std::uint32_t> filter3;
+    filter3.convert(filter);
+    TEST_CHECK_EQUAL(filter3.used_elements(), filter.used_elements());
+    TEST_CHECK_EQUAL(filter3.bytes() > std::size_t(0), true);
+  }
+
+  virtual void run() const override
+  {
+    test_adjoint();
+    test_poisson<Geometry::ConformalMesh<Shape::Quadrilateral>>(2);
+    test_poisson<Geometry::ConformalMesh<Shape::Hexahedron>>(1);
+    test_poisson_q2<Geometry::ConformalMesh<Shape::Quadrilateral>>(2);
+    test_poisson_q2<Geometry::ConformalMesh<Shape::Hexahedron>>(1);
+  }
+};
+
+HangingNodeFilterTest<double, std::uint32_t> hanging_node_filter_test_double_uint32(PreferredBackend::generic);
+HangingNodeFilterTest<double, std::uint64_t> hanging_node_filter_test_double_uint64(PreferredBackend::generic);
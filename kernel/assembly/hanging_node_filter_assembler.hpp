@@ -0,0 +1,352 @@
+// FEAT3: Finite Element Analysis Toolbox, Version 3
+// Copyright (C) 2010 - 2023 by Stefan Turek & the FEAT group
+// FEAT3 is released under the GNU General Public License version 3,
+// see the file 'copyright.txt' in the top level directory for details.
+
+#pragma once
+#ifndef KERNEL_ASSEMBLY_HANGING_NODE_FILTER_ASSEMBLER_HPP
+#define KERNEL_ASSEMBLY_HANGING_NODE_FILTER_ASSEMBLER_HPP 1
+
+// includes, FEAT
+#include <kernel/base_header.hpp>
+#include <kernel/adjacency/graph.hpp>
+#include <kernel/lafem/hanging_node_filter.hpp>
+#include <kernel/lafem/unit_filter.hpp>
+#include <kernel/space/lagrange1/element.hpp>
+#include <kernel/space/lagrange2/element.hpp>
+
+// includes, system
+#include <algorithm>
+#include <map>
+#include <vector>
+
+namespace FEAT
+{
+  namespace Assembly
+  {
+    /**
+     * \brief Hanging-Node Filter assembler class
+     *
+     * This class assembles a LAFEM::HangingNodeFilter for a Lagrange-1 or Lagrange-2 finite element
+     * space on a mesh with hanging vertices, which has been created by the Geometry::HangingNodeRefinery.
+     *
+     * For a Lagrange-1 space, the value of each hanging vertex is the mean of the values of its 2 or 4
+     * parent vertices; if a parent vertex is itself hanging, then its constraint is resolved recursively,
+     * so that the filter only contains unconstrained master DOFs.
+     *
+     * For a Lagrange-2 space, the trace of the coarse element on a hanging edge or face is the quadratic
+     * interpolant of the values in the vertices of the refined edge or face, i.e. in the 3 or 9 lattice
+     * vertices including the hanging vertex. Therefore, the DOF of the coarse edge or face is constrained
+     * by the value of its hanging midpoint vertex and the DOFs of the refined edges and faces on the coarse
+     * edge or face are constrained by the quadratic interpolation of the lattice vertex values. Since all
+     * master DOFs are vertex DOFs, which are never constrained, no recursion is required.
+     *
+     * \note
+     * On partitioned domains, the hanging vertices have to be created by the constructor for partitioned
+     * meshes of the Geometry::HangingNodeRefinery class, so that no slave DOF is shared with another patch.
+     * The local filter has to be wrapped into a Global::HangingNodeFilter then, which applies the defect
+     * filter to the type-0 defect before its synchronization, because some master DOFs may be shared.
+     */
+    class HangingNodeFilterAssembler
+    {
+      /// helper class to check whether a space is a Lagrange-1 space
+      template<typename Space_>
+      struct IsLagrange1
+      {
+        static constexpr bool value = false;
+      };
+
+      template<typename Trafo_>
+      struct IsLagrange1<Space::Lagrange1::Element<Trafo_>>
+      {
+        static constexpr bool value = true;
+      };
+
+      /// helper class to check whether a space is a Lagrange-2 space
+      template<typename Space_>
+      struct IsLagrange2
+      {
+        static constexpr bool value = false;
+      };
+
+      template<typename Trafo_>
+      struct IsLagrange2<Space::Lagrange2::Element<Trafo_>>
+      {
+        static constexpr bool value = true;
+      };
+
+    public:
+      /**
+       * \brief Assembles a hanging-node filter
+       *
+       * \param[out] filter
+       * The \transient filter that is to be assembled.
+       *
+       * \param[in] space
+       * The \transient Lagrange-1 or Lagrange-2 space for which the filter is to be assembled.
+       *
+       * \param[in] hanging
+       * The \transient hanging vertices graph, as returned by the
+       * Geometry::HangingNodeRefinery::compute_hanging_vertices() function.
+       */
+      template<typename DT_, typename IT_, typename Space_>
+      static void assemble(LAFEM::HangingNodeFilter<DT_, IT_>& filter, const Space_& space,
+        const Adjacency::Graph& hanging)
+      {
+        _assemble(filter, space, hanging, static_cast<const LAFEM::UnitFilter<DT_, IT_>*>(nullptr));
+      }
+
+      /**
+       * \brief Assembles a hanging-node filter with Dirichlet boundary conditions
+       *
+       * In contrast to the other overload, all master DOFs which are contained in the unit filter
+       * are eliminated from the constraints and their Dirichlet values are stored as offsets.
+       *
+       * \param[out] filter
+       * The \transient filter that is to be assembled.
+       *
+       * \param[in] space
+       * The \transient Lagrange-1 or Lagrange-2 space for which the filter is to be assembled.
+       *
+       * \param[in] hanging
+       * The \transient hanging vertices graph, as returned by the
+       * Geometry::HangingNodeRefinery::compute_hanging_vertices() function.
+       *
+       * \param[in] unit_filter
+       * The \transient unit filter containing the Dirichlet boundary conditions.
+       */
+      template<typename DT_, typename IT_, typename Space_>
+      static void assemble(LAFEM::HangingNodeFilter<DT_, IT_>& filter, const Space_& space,
+        const Adjacency::Graph& hanging, const LAFEM::UnitFilter<DT_, IT_>& unit_filter)
+      {
+        _assemble(filter, space, hanging, &unit_filter);
+      }
+
+    protected:
+      /// adds all unconstrained masters of a vertex to the map
+      static void _add_masters(std::map<Index, double>& masters, const Adjacency::Graph& hanging,
+        Index vertex, double weight, int depth)
+      {
+        XASSERTM(depth < 32, "cyclic hanging vertex dependency detected");
+        const Index deg = hanging.degree(vertex);
+        if(deg == Index(0))
+        {
+          masters[vertex] += weight;
+          return;
+        }
+        const double w = weight / double(deg);
+        for(auto it = hanging.image_begin(vertex); it != hanging.image_end(vertex); ++it)
+          _add_masters(masters, hanging, *it, w, depth + 1);
+      }
+
+      /// computes the constraints of all hanging vertex DOFs of a Lagrange-1 space
+      static void _constraints_lagrange1(std::map<Index, std::map<Index, double>>& constraints,
+        const Adjacency::Graph& hanging)
+      {
+        for(Index i(0); i < hanging.get_num_nodes_domain(); ++i)
+        {
+          if(hanging.degree(i) > Index(0))
+            _add_masters(constraints[i], hanging, i, 1.0, 0);
+        }
+      }
+
+      /// evaluates the 1D quadratic Lagrange polynomial of the lattice point k in {0,1,2} in x in [-1,1]
+      static double _lagrange2_basis(int k, double x)
+      {
+        return (k == 0 ? 0.5*x*(x - 1.0) : (k == 1 ? 1.0 - x*x : 0.5*x*(x + 1.0)));
+      }
+
+      /// computes the constraints of all DOFs on the hanging edges and faces of a Lagrange-2 space
+      template<typename Mesh_>
+      static void _constraints_lagrange2(std::map<Index, std::map<Index, double>>& constraints,
+        const Mesh_& mesh, const Adjacency::Graph& hanging)
+      {
+        const Index num_verts = mesh.get_num_vertices();
+        const Index num_edges = mesh.get_num_entities(1);
+
+        // map the sorted vertices of all edges and faces to their DOFs
+        std::map<std::vector<Index>, Index> dofs;
+        const auto& idx_e = mesh.template get_index_set<1, 0>();
+        for(Index i(0); i < num_edges; ++i)
+          dofs.emplace(std::vector<Index>({std::min(idx_e(i, 0), idx_e(i, 1)), std::max(idx_e(i, 0), idx_e(i, 1))}), num_verts + i);
+        if constexpr(Mesh_::shape_dim == 3)
+        {
+          const auto& idx_f = mesh.template get_index_set<2, 0>();
+          for(Index i(0); i < mesh.get_num_entities(2); ++i)
+          {
+            std::vector<Index> key({idx_f(i, 0), idx_f(i, 1), idx_f(i, 2), idx_f(i, 3)});
+            std::sort(key.begin(), key.end());
+            dofs.emplace(std::move(key), num_verts + num_edges + i);
+          }
+        }
+
+        // map the sorted parents of all hanging edge midpoints to the midpoints
+        std::map<std::vector<Index>, Index> midpoints;
+        for(Index i(0); i < num_verts; ++i)
+        {
+          if(hanging.degree(i) == Index(2))
+          {
+            std::vector<Index> key(hanging.image_begin(i), hanging.image_end(i));
+            std::sort(key.begin(), key.end());
+            midpoints.emplace(std::move(key), i);
+          }
+        }
+        auto midpoint = [&midpoints](Index a, Index b) -> Index
+        {
+          auto it = midpoints.find(std::vector<Index>({std::min(a, b), std::max(a, b)}));
+          XASSERTM(it != midpoints.end(), "hanging edge midpoint not found");
+          return it->second;
+        };
+
+        // adds a constraint for the DOF of the edge or face spanned by the given vertices
+        auto constrain = [&dofs, &constraints](std::vector<Index> verts, const std::vector<std::pair<Index, double>>& masters)
+        {
+          std::sort(verts.begin(), verts.end());
+          auto it = dofs.find(verts);
+          XASSERTM(it != dofs.end(), "constrained edge or face not found");
+          std::map<Index, double>& con = constraints[it->second];
+          XASSERTM(con.empty(), "DOF is constrained twice");
+          for(const auto& m : masters)
+          {
+            if(Math::abs(m.second) > 1E-12)
+              con[m.first] += m.second;
+          }
+        };
+
+        for(Index h(0); h < num_verts; ++h)
+        {
+          const Index deg = hanging.degree(h);
+          if(deg == Index(2))
+          {
+            // coarse edge (p0,p1) with the midpoint h and its two halves
+            const Index p0 = *hanging.image_begin(h);
+            const Index p1 = *(hanging.image_begin(h) + 1);
+            constrain({p0, p1}, {{h, 1.0}});
+            constrain({p0, h}, {{p0, 0.375}, {h, 0.75}, {p1, -0.125}});
+            constrain({h, p1}, {{p0, -0.125}, {h, 0.75}, {p1, 0.375}});
+          }
+          else if(deg == Index(4))
+          {
+            // coarse face with the center h: arrange its corners and edge midpoints in the 3x3 lattice q[a][b]
+            const std::vector<Index> par(hanging.image_begin(h), hanging.image_end(h));
+            Index q[3][3];
+            q[0][0] = par[0];
+            int num_neighbors(0);
+            for(int j(1); j < 4; ++j)
+            {
+              if(midpoints.find(std::vector<Index>({std::min(par[0], par[j]), std::max(par[0], par[j])})) == midpoints.end())
+                q[2][2] = par[j];
+              else if(num_neighbors++ == 0)
+                q[2][0] = par[j];
+              else
+                q[0][2] = par[j];
+            }
+            XASSERTM(num_neighbors == 2, "invalid hanging face");
+            q[1][0] = midpoint(q[0][0], q[2][0]);
+            q[0][1] = midpoint(q[0][0], q[0][2]);
+            q[2][1] = midpoint(q[2][0], q[2][2]);
+            q[1][2] = midpoint(q[0][2], q[2][2]);
+            q[1][1] = h;
+
+            // interpolates the face trace in the point (x,y) of the reference square [-1,1]^2
+            auto interpolate = [&q](double x, double y)
+            {
+              std::vector<std::pair<Index, double>> masters;
+              for(int a(0); a < 3; ++a)
+              {
+                for(int b(0); b < 3; ++b)
+                  masters.emplace_back(q[a][b], _lagrange2_basis(a, x) * _lagrange2_basis(b, y));
+              }
+              return masters;
+            };
+
+            constrain({q[0][0], q[2][0], q[0][2], q[2][2]}, {{h, 1.0}});
+            constrain({q[1][0], h}, interpolate(0.0, -0.5));
+            constrain({q[0][1], h}, interpolate(-0.5, 0.0));
+            constrain({q[2][1], h}, interpolate(0.5, 0.0));
+            constrain({q[1][2], h}, interpolate(0.0, 0.5));
+            for(int a(0); a < 3; a += 2)
+            {
+              for(int b(0); b < 3; b += 2)
+                constrain({q[a][b], q[1][b], q[a][1], h}, interpolate(0.5*double(a-1), 0.5*double(b-1)));
+            }
+          }
+        }
+      }
+
+      /// assembles the filter
+      template<typename DT_, typename IT_, typename Space_>
+      static void _assemble(LAFEM::HangingNodeFilter<DT_, IT_>& filter, const Space_& space,
+        const Adjacency::Graph& hanging, const LAFEM::UnitFilter<DT_, IT_>* unit_filter)
+      {
+        static_assert(IsLagrange1<Space_>::value || IsLagrange2<Space_>::value,
+          "HangingNodeFilterAssembler only supports Lagrange-1 and Lagrange-2 spaces");
+        const Index num_dofs = space.get_num_dofs();
+        const auto& mesh = space.get_trafo().get_mesh();
+        XASSERTM(hanging.get_num_nodes_domain() == mesh.get_num_vertices(), "hanging graph does not match space");
+
+        // compute the master DOFs and weights of all slave DOFs
+        std::map<Index, std::map<Index, double>> constraints;
+        if constexpr(IsLagrange1<Space_>::value)
+          _constraints_lagrange1(constraints, hanging);
+        else
+          _constraints_lagrange2(constraints, mesh, hanging);
+
+        // gather the Dirichlet DOFs and their values
+        std::vector<int> dirichlet(num_dofs, 0);
+        std::vector<DT_> dirichlet_val(num_dofs, DT_(0));
+        if(unit_filter != nullptr)
+        {
+          const Index n = unit_filter->used_elements();
+          const IT_* idx = unit_filter->get_indices();
+          const DT_* val = unit_filter->get_values();
+          for(Index i(0); i < n; ++i)
+          {
+            dirichlet[idx[i]] = 1;
+            dirichlet_val[idx[i]] = val[i];
+          }
+        }
+
+        std::vector<IT_> slaves, master_ptr(1u, IT_(0)), master_idx;
+        std::vector<DT_> weights, offsets;
+        for(const auto& con : constraints)
+        {
+          // skip constrained DOFs which are fixed by the unit filter anyway
+          const Index i = con.first;
+          if(dirichlet[i] != 0)
+            continue;
+          DT_ offset(0);
+          for(const auto& m : con.second)
+          {
+            if(dirichlet[m.first] != 0)
+            {
+              offset += DT_(m.second) * dirichlet_val[m.first];
+              continue;
+            }
+            master_idx.push_back(IT_(m.first));
+            weights.push_back(DT_(m.second));
+          }
+          slaves.push_back(IT_(i));
+          offsets.push_back(offset);
+          master_ptr.push_back(IT_(master_idx.size()));
+        }
+
+        LAFEM::DenseVector<IT_, IT_> vec_slaves(Index(slaves.size()));
+        LAFEM::DenseVector<IT_, IT_> vec_ptr(Index(master_ptr.size()));
+        LAFEM::DenseVector<IT_, IT_> vec_idx(Index(master_idx.size()));
+        LAFEM::DenseVector<DT_, IT_> vec_weights(Index(weights.size()));
+        LAFEM::DenseVector<DT_, IT_> vec_offsets(Index(offsets.size()));
+        std::copy(slaves.begin(), slaves.end(), vec_slaves.elements());
+        std::copy(master_ptr.begin(), master_ptr.end(), vec_ptr.elements());
+        std::copy(master_idx.begin(), master_idx.end(), vec_idx.elements());
+        std::copy(weights.begin(), weights.end(), vec_weights.elements());
+        std::copy(offsets.begin(), offsets.end(), vec_offsets.elements());
+
+        filter = LAFEM::HangingNodeFilter<DT_, IT_>(num_dofs, std::move(vec_slaves), std::move(vec_ptr),
+          std::move(vec_idx), std::move(vec_weights), std::move(vec_offsets));
+      }
+    }; // class HangingNodeFilterAssembler
+  } // namespace Assembly
+} // namespace FEAT
+
+#endif // KERNEL_ASSEMBLY_HANGING_NODE_FILTER_ASSEMBLER_HPP
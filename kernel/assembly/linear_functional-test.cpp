@@ -12,6 +12,7 @@
 #include <kernel/space/lagrange1/element.hpp>
 #include <kernel/space/discontinuous/element.hpp>
 #include <kernel/trafo/standard/mapping.hpp>
+#include <kernel/assembly/domain_assembler_helpers.hpp>
 #include <kernel/util/math.hpp>
 
 using namespace FEAT;
@@ -54,6 +55,7 @@ public:
     // run tests
     test_unit_2d_q1(mesh);
     test_unit_2d_q0(mesh);
+    test_unit_2d_force(mesh);
   }
 
   void test_unit_2d_q1(QuadMesh& mesh) const
@@ -158,6 +160,41 @@ public:
       TEST_CHECK_EQUAL_WITHIN_EPS(vector(i), s, eps);
     }
   }
+
+  void test_unit_2d_force(QuadMesh& mesh) const
+  {
+    // compute eps
+    const DataType_ eps = Math::pow(Math::eps<DataType_>(), DataType_(0.8));
+
+    // create trafo
+    QuadTrafo trafo(mesh);
+
+    // create space
+    QuadSpaceQ1 space(trafo);
+
+    // assemble the force functional by the linear functional assembler
+    Analytic::Common::SineBubbleFunction<2> function;
+    Assembly::Common::ForceFunctional<Analytic::Common::SineBubbleFunction<2>> functional(function);
+    Cubature::DynamicFactory cubature_factory("gauss-legendre:3");
+    VectorType vector(space.get_num_dofs(), DataType_(0));
+    Assembly::LinearFunctionalAssembler::assemble_vector(vector, functional, space, cubature_factory);
+
+    // assemble the force functional by the domain assembler, which evaluates the function in batches
+    Assembly::DomainAssembler<QuadTrafo> dom_asm(trafo);
+    dom_asm.compile_all_elements();
+    VectorType vector2(space.get_num_dofs(), DataType_(0));
+    Assembly::assemble_force_function_vector(dom_asm, vector2, function, space, "gauss-legendre:3");
+
+    for(Index i(0); i < vector.size(); ++i)
+    {
+      TEST_CHECK_EQUAL_WITHIN_EPS(vector(i), vector2(i), eps);
+    }
+
+    // integrate the function: int_[0,1]^2 sin(pi*x)*sin(pi*y) dxy = 4/pi^2
+    const DataType_ pi = Math::pi<DataType_>();
+    auto integral = Assembly::integrate_analytic_function<0, DataType_>(dom_asm, function, "gauss-legendre:5");
+    TEST_CHECK_EQUAL_WITHIN_EPS(integral.value, DataType_(4) / (pi*pi), Math::pow(Math::eps<DataType_>(), DataType_(0.5)));
+  }
 };
 
 LinearFunctionalTest <float, std::uint32_t> linear_functional_test_float_uint32(PreferredBackend::generic);
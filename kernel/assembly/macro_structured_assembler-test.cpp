@@ -0,0 +1,416 @@
+// FEAT3: Finite Element Analysis Toolbox, Version 3
+// Copyright (C) 2010 - 2023 by Stefan Turek & the FEAT group
+// FEAT3 is released under the GNU General Public License version 3,
+// see the file 'copyright.txt' in the top level directory for details.
+
+#include <test_system/test_system.hpp>
+#include <kernel/assembly/macro_structured_assembler.hpp>
+#include <kernel/assembly/common_operators.hpp>
+#include <kernel/geometry/common_factories.hpp>
+#include <kernel/geometry/conformal_mesh.hpp>
+#include <kernel/geometry/boundary_factory.hpp>
+#include <kernel/geometry/mesh_node.hpp>
+#include <kernel/geometry/atlas/circle.hpp>
+#include <kernel/lafem/none_filter.hpp>
+#include <kernel/lafem/transfer.hpp>
+#include <kernel/lafem/vector_mirror.hpp>
+#include <kernel/solver/pcg.hpp>
+#include <kernel/solver/jacobi_precond.hpp>
+#include <kernel/solver/richardson.hpp>
+#include <kernel/solver/multigrid.hpp>
+
+using namespace FEAT;
+using namespace FEAT::TestSystem;
+
+/**
+ * \brief Test class for the macro-structured assembler.
+ *
+ * \test Compares the macro-structured Q1 matrices with the matrices assembled on the
+ * unstructured refined mesh, with and without charts, solves a system by multigrid
+ * on a hierarchy of macro-structured matrices and checks the halo mirrors of a
+ * partitioned base mesh by emulating the synchronization of a gate.
+ */
+template<typename DataType_, typename IndexType_>
+class MacroStructuredAssemblerTest :
+  public UnitTest
+{
+  typedef Geometry::ConformalMesh<Shape::Quadrilateral, 2, DataType_> MeshType;
+  typedef Geometry::RootMeshNode<MeshType> MeshNodeType;
+  typedef Trafo::Standard::Mapping<MeshType> TrafoType;
+  typedef Space::Lagrange1::Element<TrafoType> SpaceType;
+  typedef LAFEM::MacroStructuredMatrix<DataType_, IndexType_> MacroMatrixType;
+  typedef LAFEM::SparseMatrixCSR<DataType_, IndexType_> MatrixType;
+  typedef LAFEM::DenseVector<DataType_, IndexType_> VectorType;
+  typedef LAFEM::VectorMirror<DataType_, IndexType_> MirrorType;
+
+public:
+  MacroStructuredAssemblerTest() :
+    UnitTest("MacroStructuredAssemblerTest", Type::Traits<DataType_>::name(), Type::Traits<IndexType_>::name())
+  {
+  }
+
+  virtual ~MacroStructuredAssemblerTest()
+  {
+  }
+
+  /// computes the permutation from the unstructured fine mesh vertices to the macro DOFs
+  static std::vector<Index> compute_perm(const MeshType& fine_mesh, const std::vector<Tiny::Vector<DataType_, 2>>& coords)
+  {
+    const DataType_ tol = Math::pow(Math::eps<DataType_>(), DataType_(0.7));
+    const auto& vtx = fine_mesh.get_vertex_set();
+    std::vector<Index> perm(vtx.get_num_vertices(), ~Index(0));
+    for(Index i(0); i < vtx.get_num_vertices(); ++i)
+    {
+      for(Index j(0); j < coords.size(); ++j)
+      {
+        if((Math::abs(vtx[i][0] - coords[j][0]) < tol) && (Math::abs(vtx[i][1] - coords[j][1]) < tol))
+        {
+          perm[i] = j;
+          break;
+        }
+      }
+    }
+    return perm;
+  }
+
+  void test_operator(const MeshNodeType& base_node, Index num_levels) const
+  {
+    const DataType_ tol = Math::pow(Math::eps<DataType_>(), DataType_(0.8));
+
+    // refine base mesh node and adapt it to its charts
+    std::unique_ptr<MeshNodeType> fine_node = base_node.clone_unique();
+    for(Index lvl(0); lvl < num_levels; ++lvl)
+      fine_node = fine_node->refine_unique();
+    MeshType& fine_mesh = *fine_node->get_mesh();
+
+    // assemble unstructured reference matrix: Laplace + mass
+    TrafoType trafo(fine_mesh);
+    SpaceType space(trafo);
+    Assembly::DomainAssembler<TrafoType> dom_asm(trafo);
+    dom_asm.compile_all_elements();
+    MatrixType matrix;
+    Assembly::SymbolicAssembler::assemble_matrix_std1(matrix, space);
+    matrix.format();
+    Assembly::Common::LaplaceOperator laplace;
+    Assembly::Common::IdentityOperator identity;
+    Assembly::assemble_bilinear_operator_matrix_1(dom_asm, matrix, laplace, space, "gauss-legendre:2");
+    Assembly::assemble_bilinear_operator_matrix_1(dom_asm, matrix, identity, space, "gauss-legendre:2", DataType_(0.5));
+
+    // assemble macro-structured matrix
+    MacroMatrixType macro_matrix;
+    Assembly::MacroStructuredAssembler::assemble_structure(macro_matrix, *base_node.get_mesh(), Index(1) << num_levels);
+    Assembly::MacroStructuredAssembler::assemble_bilinear_operator(macro_matrix, laplace, base_node, "gauss-legendre:2");
+    Assembly::MacroStructuredAssembler::assemble_bilinear_operator(macro_matrix, identity, base_node, "gauss-legendre:2", DataType_(0.5));
+    TEST_CHECK_EQUAL(macro_matrix.rows(), matrix.rows());
+
+    // compute DOF permutation by vertex coordinates
+    std::vector<Tiny::Vector<DataType_, 2>> coords;
+    Assembly::MacroStructuredAssembler::compute_dof_coords(coords, macro_matrix, base_node);
+    std::vector<Index> perm = compute_perm(fine_mesh, coords);
+    for(Index i(0); i < perm.size(); ++i)
+    {
+      TEST_CHECK(perm[i] < coords.size());
+    }
+
+    // compare matrix-vector products
+    const Index n = matrix.rows();
+    VectorType vec_x(n), vec_y(n), vec_r(n), vec_xf(n), vec_yf(n), vec_rf(n);
+    for(Index i(0); i < n; ++i)
+    {
+      vec_x(i, Math::sin(DataType_(i+1)));
+      vec_y(i, Math::cos(DataType_(2*i+1)));
+    }
+    for(Index i(0); i < n; ++i)
+    {
+      vec_xf(i, vec_x(perm[i]));
+      vec_yf(i, vec_y(perm[i]));
+    }
+
+    macro_matrix.apply(vec_r, vec_x);
+    matrix.apply(vec_rf, vec_xf);
+    for(Index i(0); i < n; ++i)
+    {
+      TEST_CHECK_EQUAL_WITHIN_EPS(vec_r(perm[i]), vec_rf(i), tol);
+    }
+
+    macro_matrix.apply(vec_r, vec_x, vec_y, -DataType_(0.7));
+    matrix.apply(vec_rf, vec_xf, vec_yf, -DataType_(0.7));
+    for(Index i(0); i < n; ++i)
+    {
+      TEST_CHECK_EQUAL_WITHIN_EPS(vec_r(perm[i]), vec_rf(i), tol);
+    }
+
+    // compare main diagonals
+    VectorType diag = macro_matrix.extract_diag();
+    VectorType diag_f = matrix.extract_diag();
+    for(Index i(0); i < n; ++i)
+    {
+      TEST_CHECK_EQUAL_WITHIN_EPS(diag(perm[i]), diag_f(i), tol);
+    }
+
+    // the macro-structured matrix does not store any column indices, which pays off
+    // as soon as the patches are large enough to outweigh the duplicated macro boundary rows
+    if(num_levels >= Index(3))
+    {
+      TEST_CHECK(macro_matrix.bytes() < matrix.bytes());
+    }
+
+    // solve a system with PCG-Jacobi
+    LAFEM::NoneFilter<DataType_, IndexType_> filter;
+    auto solver = Solver::new_pcg(macro_matrix, filter, Solver::new_jacobi_precond(macro_matrix, filter));
+    solver->set_tol_rel(Math::pow(Math::eps<DataType_>(), DataType_(0.7)));
+    solver->set_max_iter(1000);
+    solver->init();
+    macro_matrix.apply(vec_y, vec_x);
+    vec_r.format();
+    TEST_CHECK(Solver::status_success(solver->correct(vec_r, vec_y)));
+    solver->done();
+    vec_r.axpy(vec_x, vec_r, -DataType_(1));
+    TEST_CHECK_EQUAL_WITHIN_EPS(vec_r.max_abs_element(), DataType_(0), Math::sqrt(tol));
+  }
+
+  void test_multigrid(const MeshNodeType& base_node, Index num_levels) const
+  {
+    typedef LAFEM::Transfer<MatrixType> TransferType;
+    typedef LAFEM::NoneFilter<DataType_, IndexType_> FilterType;
+    const DataType_ tol = Math::pow(Math::eps<DataType_>(), DataType_(0.8));
+
+    // assemble Laplace + mass matrices on all levels, finest level first
+    Assembly::Common::LaplaceOperator laplace;
+    Assembly::Common::IdentityOperator identity;
+    std::deque<MacroMatrixType> matrices(num_levels + 1u);
+    std::deque<TransferType> transfers(num_levels);
+    for(Index lvl(0); lvl <= num_levels; ++lvl)
+    {
+      MacroMatrixType& mat = matrices.at(lvl);
+      Assembly::MacroStructuredAssembler::assemble_structure(mat, *base_node.get_mesh(), Index(1) << (num_levels + 1u - lvl));
+      Assembly::MacroStructuredAssembler::assemble_bilinear_operator(mat, laplace, base_node, "gauss-legendre:2");
+      Assembly::MacroStructuredAssembler::assemble_bilinear_operator(mat, identity, base_node, "gauss-legendre:2", DataType_(0.1));
+    }
+    for(Index lvl(0); lvl < num_levels; ++lvl)
+    {
+      MatrixType& prol = transfers.at(lvl).get_mat_prol();
+      Assembly::MacroStructuredAssembler::assemble_prolongation(prol, matrices.at(lvl), matrices.at(lvl+1u));
+      transfers.at(lvl).get_mat_rest() = prol.transpose();
+
+      // the prolongation must reproduce the bilinear coordinate functions on each macro
+      std::vector<Tiny::Vector<DataType_, 2>> coords_f, coords_c;
+      Assembly::MacroStructuredAssembler::compute_dof_coords(coords_f, matrices.at(lvl), *base_node.get_mesh());
+      Assembly::MacroStructuredAssembler::compute_dof_coords(coords_c, matrices.at(lvl+1u), *base_node.get_mesh());
+      VectorType vec_c(prol.columns()), vec_f(prol.rows());
+      for(int k(0); k < 2; ++k)
+      {
+        for(Index i(0); i < vec_c.size(); ++i)
+          vec_c(i, coords_c[i][k]);
+        prol.apply(vec_f, vec_c);
+        for(Index i(0); i < vec_f.size(); ++i)
+        {
+          TEST_CHECK_EQUAL_WITHIN_EPS(vec_f(i), coords_f[i][k], tol);
+        }
+      }
+    }
+
+    // set up a V-cycle with Richardson-Jacobi smoothers
+    FilterType filter;
+    auto hierarchy = std::make_shared<Solver::MultiGridHierarchy<MacroMatrixType, FilterType, TransferType>>(num_levels + 1u);
+    for(Index lvl(0); lvl < num_levels; ++lvl)
+    {
+      auto smoother = Solver::new_richardson(matrices.at(lvl), filter, DataType_(0.7),
+        Solver::new_jacobi_precond(matrices.at(lvl), filter));
+      smoother->set_min_iter(4);
+      smoother->set_max_iter(4);
+      hierarchy->push_level(matrices.at(lvl), filter, transfers.at(lvl), smoother, smoother, smoother);
+    }
+    auto coarse_solver = Solver::new_pcg(matrices.back(), filter);
+    coarse_solver->set_tol_rel(Math::pow(Math::eps<DataType_>(), DataType_(0.8)));
+    coarse_solver->set_max_iter(1000);
+    hierarchy->push_level(matrices.back(), filter, coarse_solver);
+
+    auto multigrid = Solver::new_multigrid(hierarchy, Solver::MultiGridCycle::V);
+    auto solver = Solver::new_richardson(matrices.front(), filter, DataType_(1), multigrid);
+    solver->set_tol_rel(Math::pow(Math::eps<DataType_>(), DataType_(0.7)));
+    solver->set_max_iter(30);
+
+    hierarchy->init();
+    solver->init();
+
+    const MacroMatrixType& matrix = matrices.front();
+    VectorType vec_x(matrix.rows()), vec_b(matrix.rows()), vec_sol(matrix.rows(), DataType_(0));
+    for(Index i(0); i < vec_x.size(); ++i)
+      vec_x(i, Math::sin(DataType_(i+1)));
+    matrix.apply(vec_b, vec_x);
+    TEST_CHECK(Solver::status_success(solver->correct(vec_sol, vec_b)));
+    TEST_CHECK(solver->get_num_iter() < Index(20));
+
+    solver->done();
+    hierarchy->done();
+  }
+
+  /// returns the index of the DOF with the given coordinates
+  static Index find_dof(const std::vector<Tiny::Vector<DataType_, 2>>& coords, const Tiny::Vector<DataType_, 2>& x)
+  {
+    const DataType_ tol = Math::pow(Math::eps<DataType_>(), DataType_(0.7));
+    for(Index j(0); j < coords.size(); ++j)
+    {
+      if((Math::abs(x[0] - coords[j][0]) < tol) && (Math::abs(x[1] - coords[j][1]) < tol))
+        return j;
+    }
+    return ~Index(0);
+  }
+
+  static DataType_ func(const Tiny::Vector<DataType_, 2>& x)
+  {
+    return Math::sin(DataType_(3) * x[0]) + Math::cos(DataType_(2) * x[1]);
+  }
+
+  void test_mirrors(const MeshNodeType& base_node, const std::vector<int>& elem_ranks, int num_ranks) const
+  {
+    const DataType_ tol = Math::pow(Math::eps<DataType_>(), DataType_(0.8));
+    const Index num_slices(4);
+    Assembly::Common::LaplaceOperator laplace;
+
+    // compute the reference matrix-vector product on the whole base mesh
+    MacroMatrixType matrix;
+    Assembly::MacroStructuredAssembler::assemble_structure(matrix, *base_node.get_mesh(), num_slices);
+    Assembly::MacroStructuredAssembler::assemble_bilinear_operator(matrix, laplace, *base_node.get_mesh(), "gauss-legendre:2");
+    std::vector<Tiny::Vector<DataType_, 2>> coords;
+    Assembly::MacroStructuredAssembler::compute_dof_coords(coords, matrix, *base_node.get_mesh());
+    VectorType vec_x(matrix.rows()), vec_r(matrix.rows());
+    for(Index i(0); i < vec_x.size(); ++i)
+      vec_x(i, func(coords[i]));
+    matrix.apply(vec_r, vec_x);
+
+    // create the elements-at-rank graph of the partitioning
+    std::vector<Index> dom_ptr(Index(num_ranks) + 1u, Index(0)), img_idx;
+    for(int r(0); r < num_ranks; ++r)
+    {
+      for(Index e(0); e < elem_ranks.size(); ++e)
+      {
+        if(elem_ranks[e] == r)
+          img_idx.push_back(e);
+      }
+      dom_ptr[std::size_t(r) + 1u] = Index(img_idx.size());
+    }
+    Adjacency::Graph elems_at_rank(Index(elem_ranks.size()), dom_ptr, img_idx);
+
+    // extract the patches and assemble the patch matrices and halo mirrors
+    std::unique_ptr<MeshNodeType> root_node = base_node.clone_unique();
+    const std::size_t nr = std::size_t(num_ranks);
+    std::vector<std::vector<Tiny::Vector<DataType_, 2>>> patch_coords(nr);
+    std::vector<std::map<int, MirrorType>> mirrors(nr);
+    std::vector<VectorType> vecs_r;
+    for(int p(0); p < num_ranks; ++p)
+    {
+      std::vector<int> comm_ranks;
+      std::unique_ptr<MeshNodeType> patch_node = root_node->extract_patch(comm_ranks, elems_at_rank, p);
+      MeshType& patch_mesh = *patch_node->get_mesh();
+
+      // reverse the edges of every other patch, so that the halo edges are oriented differently
+      if(p % 2 == 1)
+      {
+        auto& verts_at_edge = patch_mesh.template get_index_set<1, 0>();
+        for(Index e(0); e < verts_at_edge.get_num_entities(); ++e)
+          std::swap(verts_at_edge(e, 0), verts_at_edge(e, 1));
+      }
+
+      MacroMatrixType patch_matrix;
+      Assembly::MacroStructuredAssembler::assemble_structure(patch_matrix, patch_mesh, num_slices);
+      Assembly::MacroStructuredAssembler::assemble_bilinear_operator(patch_matrix, laplace, patch_mesh, "gauss-legendre:2");
+      for(const auto& it : patch_node->get_halo_map())
+        Assembly::MacroStructuredAssembler::assemble_mirror(mirrors.at(std::size_t(p))[it.first], patch_matrix, patch_mesh, *it.second);
+
+      // compute the type-0 product of the patch
+      auto& pc = patch_coords.at(std::size_t(p));
+      Assembly::MacroStructuredAssembler::compute_dof_coords(pc, patch_matrix, patch_mesh);
+      VectorType vec_px(patch_matrix.rows());
+      for(Index i(0); i < vec_px.size(); ++i)
+        vec_px(i, func(pc[i]));
+      vecs_r.push_back(patch_matrix.create_vector_l());
+      patch_matrix.apply(vecs_r.back(), vec_px);
+    }
+
+    // synchronize the type-0 products as a gate would do and compare them to the reference
+    for(int p(0); p < num_ranks; ++p)
+    {
+      const auto& pc = patch_coords.at(std::size_t(p));
+      VectorType vec_s = vecs_r.at(std::size_t(p)).clone();
+      for(const auto& it : mirrors.at(std::size_t(p)))
+      {
+        const MirrorType& mirror = it.second;
+        const MirrorType& mirror_q = mirrors.at(std::size_t(it.first)).at(p);
+        const auto& qc = patch_coords.at(std::size_t(it.first));
+
+        // both mirrors must contain the same DOFs in the same order
+        TEST_CHECK_EQUAL(mirror.num_indices(), mirror_q.num_indices());
+        for(Index k(0); k < mirror.num_indices(); ++k)
+        {
+          const auto& x = pc[mirror.indices()[k]];
+          const auto& y = qc[mirror_q.indices()[k]];
+          TEST_CHECK_EQUAL_WITHIN_EPS(x[0], y[0], tol);
+          TEST_CHECK_EQUAL_WITHIN_EPS(x[1], y[1], tol);
+        }
+
+        VectorType buffer = mirror_q.create_buffer(vecs_r.at(std::size_t(it.first)));
+        mirror_q.gather(buffer, vecs_r.at(std::size_t(it.first)));
+        mirror.scatter_axpy(vec_s, buffer);
+      }
+      for(Index i(0); i < vec_s.size(); ++i)
+      {
+        const Index j = find_dof(coords, pc[i]);
+        TEST_CHECK(j < coords.size());
+        TEST_CHECK_EQUAL_WITHIN_EPS(vec_s(i), vec_r(j), tol);
+      }
+    }
+  }
+
+  virtual void run() const override
+  {
+    // unit star cube: 5 differently oriented macros
+    Geometry::UnitStarCubeFactory<MeshType> star_factory;
+    MeshNodeType star_node(star_factory.make_unique());
+    test_operator(star_node, Index(1));
+    test_operator(star_node, Index(3));
+    test_mirrors(star_node, std::vector<int>({0, 1, 2, 1, 0}), 3);
+
+    // distorted refined unit square
+    Geometry::RefinedUnitCubeFactory<MeshType> cube_factory(1);
+    std::unique_ptr<MeshType> cube_mesh = cube_factory.make_unique();
+    auto& vtx = cube_mesh->get_vertex_set();
+    for(Index i(0); i < vtx.get_num_vertices(); ++i)
+    {
+      vtx[i][0] += DataType_(0.05) * Math::sin(DataType_(7) * vtx[i][1]);
+      vtx[i][1] += DataType_(0.03) * Math::cos(DataType_(5) * vtx[i][0]);
+    }
+    MeshNodeType cube_node(std::move(cube_mesh));
+    test_operator(cube_node, Index(2));
+    test_multigrid(cube_node, Index(2));
+
+    // partition the refined unit square into its quadrants
+    {
+      Geometry::RefinedUnitCubeFactory<MeshType> quad_factory(2);
+      MeshNodeType quad_node(quad_factory.make_unique());
+      const auto& qvtx = quad_node.get_mesh()->get_vertex_set();
+      const auto& verts_at_elem = quad_node.get_mesh()->template get_index_set<2, 0>();
+      std::vector<int> elem_ranks(quad_node.get_mesh()->get_num_elements());
+      for(Index e(0); e < elem_ranks.size(); ++e)
+      {
+        const auto& v = qvtx[verts_at_elem(e, 3)];
+        elem_ranks[e] = (v[0] > DataType_(0.6) ? 1 : 0) + (v[1] > DataType_(0.6) ? 2 : 0);
+      }
+      test_mirrors(quad_node, elem_ranks, 4);
+    }
+
+    // unit square with its boundary adapted to the circumcircle
+    Geometry::Atlas::Circle<MeshType> circle(DataType_(0.5), DataType_(0.5), Math::sqrt(DataType_(0.5)));
+    MeshNodeType circle_node(Geometry::RefinedUnitCubeFactory<MeshType>(1).make_unique());
+    {
+      Geometry::BoundaryFactory<MeshType> bnd_factory(*circle_node.get_mesh());
+      circle_node.add_mesh_part("bnd", bnd_factory.make_unique(), "circle", &circle);
+    }
+    circle_node.adapt();
+    test_operator(circle_node, Index(2));
+    test_multigrid(circle_node, Index(2));
+  }
+};
+
+MacroStructuredAssemblerTest<double, Index> macro_structured_assembler_test_double_index;
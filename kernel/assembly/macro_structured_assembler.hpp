@@ -0,0 +1,555 @@
+// FEAT3: Finite Element Analysis Toolbox, Version 3
+// Copyright (C) 2010 - 2023 by Stefan Turek & the FEAT group
+// FEAT3 is released under the GNU General Public License version 3,
+// see the file 'copyright.txt' in the top level directory for details.
+
+#pragma once
+#ifndef KERNEL_ASSEMBLY_MACRO_STRUCTURED_ASSEMBLER_HPP
+#define KERNEL_ASSEMBLY_MACRO_STRUCTURED_ASSEMBLER_HPP 1
+
+// includes, FEAT
+#include <kernel/geometry/conformal_mesh.hpp>
+#include <kernel/geometry/mesh_node.hpp>
+#include <kernel/geometry/mesh_part.hpp>
+#include <kernel/geometry/common_factories.hpp>
+#include <kernel/geometry/intern/face_index_mapping.hpp>
+#include <kernel/assembly/symbolic_assembler.hpp>
+#include <kernel/assembly/domain_assembler_helpers.hpp>
+#include <kernel/trafo/standard/mapping.hpp>
+#include <kernel/space/lagrange1/element.hpp>
+#include <kernel/lafem/sparse_matrix_csr.hpp>
+#include <kernel/lafem/vector_mirror.hpp>
+#include <kernel/lafem/macro_structured_matrix.hpp>
+
+// includes, system
+#include <algorithm>
+#include <array>
+#include <vector>
+
+namespace FEAT
+{
+  namespace Assembly
+  {
+    /**
+     * \brief Assembler for macro-wise structured Q1 matrices
+     *
+     * This class sets up LAFEM::MacroStructuredMatrix objects for the Q1 discretization on the
+     * mesh that results from refining each cell of a quadrilateral base mesh into a structured
+     * patch of n x n cells. The fine mesh vertices of each macro patch are given by the bilinear
+     * transformation of the macro, i.e. they coincide with the vertices created by refining the
+     * base mesh with the StandardRefinery log2(n) times.
+     *
+     * If the base mesh is given as a RootMeshNode, then the charts of its mesh parts are applied
+     * to the patch vertices on the corresponding macro edges. In this case, n must be a power of
+     * two and the patch vertices are created by recursive bisection followed by a projection onto
+     * the chart, so that they coincide with the vertices of the (already adapted) mesh node
+     * refined log2(n) times by RootMeshNode::refine_unique(). Only implicit charts, i.e. charts
+     * which can project single points, are supported.
+     *
+     * The local macro matrices are assembled by the usual DomainAssembler on a single temporary
+     * patch mesh, whose vertices are moved onto each macro in turn, so that any bilinear operator
+     * supported by the standard assembly can be used.
+     *
+     * Finally, the assemble_prolongation() function assembles the Q1 prolongation matrix between
+     * two macro-structured matrices with n and 2n slices on the same base mesh, which allows the
+     * macro-structured matrices to be used within a Solver::MultiGrid hierarchy, and the
+     * assemble_mirror() function assembles the vector mirrors for the halos of a partitioned
+     * base mesh, which allows the macro-structured matrices to be used in parallel.
+     */
+    class MacroStructuredAssembler
+    {
+    public:
+      /**
+       * \brief Assembles the layout of a macro-structured matrix
+       *
+       * \param[out] matrix
+       * The matrix whose layout is to be assembled.
+       *
+       * \param[in] base_mesh
+       * The quadrilateral base mesh, whose cells are the macros.
+       *
+       * \param[in] num_slices
+       * The number of slices per macro edge, must be > 0.
+       */
+      template<typename DT_, typename IT_, typename Coord_>
+      static void assemble_structure(LAFEM::MacroStructuredMatrix<DT_, IT_>& matrix,
+        const Geometry::ConformalMesh<Shape::Quadrilateral, 2, Coord_>& base_mesh, Index num_slices)
+      {
+        XASSERTM(num_slices > Index(0), "invalid number of slices");
+
+        const auto& verts_at_elem = base_mesh.template get_index_set<2, 0>();
+        const auto& edges_at_elem = base_mesh.template get_index_set<2, 1>();
+        const auto& verts_at_edge = base_mesh.template get_index_set<1, 0>();
+
+        const Index num_macros = base_mesh.get_num_elements();
+        std::vector<IT_> macro_verts(4u*num_macros), macro_edges(4u*num_macros);
+        std::vector<char> macro_edge_flip(4u*num_macros);
+
+        for(Index m(0); m < num_macros; ++m)
+        {
+          for(int i(0); i < 4; ++i)
+          {
+            macro_verts[4u*m + Index(i)] = IT_(verts_at_elem(m, i));
+            const Index e = edges_at_elem(m, i);
+            macro_edges[4u*m + Index(i)] = IT_(e);
+            // check whether the base mesh edge starts at the first vertex of the local edge
+            const Index v0 = verts_at_elem(m, Geometry::Intern::FaceIndexMapping<Shape::Quadrilateral, 1, 0>::map(i, 0));
+            macro_edge_flip[4u*m + Index(i)] = (verts_at_edge(e, 0) == v0 ? 0 : 1);
+          }
+        }
+
+        matrix = LAFEM::MacroStructuredMatrix<DT_, IT_>(num_slices, base_mesh.get_num_vertices(),
+          base_mesh.get_num_entities(1), std::move(macro_verts), std::move(macro_edges), std::move(macro_edge_flip));
+      }
+
+      /**
+       * \brief Computes the coordinates of all DOFs of a macro-structured matrix
+       *
+       * \param[out] coords
+       * Receives the coordinates of all fine mesh vertices in the DOF ordering of the matrix.
+       *
+       * \param[in] matrix
+       * The matrix whose layout has been assembled by assemble_structure().
+       *
+       * \param[in] base_mesh
+       * The quadrilateral base mesh that was used to assemble the layout.
+       */
+      template<typename DT_, typename IT_, typename Coord_>
+      static void compute_dof_coords(std::vector<Tiny::Vector<Coord_, 2>>& coords,
+        const LAFEM::MacroStructuredMatrix<DT_, IT_>& matrix,
+        const Geometry::ConformalMesh<Shape::Quadrilateral, 2, Coord_>& base_mesh)
+      {
+        _compute_dof_coords(coords, matrix, base_mesh, _EdgeCharts<Coord_>());
+      }
+
+      /**
+       * \brief Computes the coordinates of all DOFs of a macro-structured matrix
+       *
+       * \param[out] coords
+       * Receives the coordinates of all fine mesh vertices in the DOF ordering of the matrix.
+       *
+       * \param[in] matrix
+       * The matrix whose layout has been assembled by assemble_structure().
+       *
+       * \param[in] base_node
+       * The root mesh node of the base mesh, whose charts are to be applied.
+       */
+      template<typename DT_, typename IT_, typename Coord_>
+      static void compute_dof_coords(std::vector<Tiny::Vector<Coord_, 2>>& coords,
+        const LAFEM::MacroStructuredMatrix<DT_, IT_>& matrix,
+        const Geometry::RootMeshNode<Geometry::ConformalMesh<Shape::Quadrilateral, 2, Coord_>>& base_node)
+      {
+        _compute_dof_coords(coords, matrix, *base_node.get_mesh(), _get_edge_charts(base_node));
+      }
+
+      /**
+       * \brief Assembles a bilinear operator into a macro-structured matrix
+       *
+       * \param[in,out] matrix
+       * The matrix whose layout has been assembled by assemble_structure(). The operator is
+       * added onto the macro matrices, which are allocated by the first call of this function.
+       *
+       * \param[in] operat
+       * The bilinear operator that is to be assembled.
+       *
+       * \param[in] base_mesh
+       * The quadrilateral base mesh that was used to assemble the layout.
+       *
+       * \param[in] cubature
+       * The name of the cubature rule that is to be used for the assembly.
+       *
+       * \param[in] alpha
+       * The scaling factor for the assembly.
+       */
+      template<typename DT_, typename IT_, typename Operator_, typename Coord_>
+      static void assemble_bilinear_operator(LAFEM::MacroStructuredMatrix<DT_, IT_>& matrix,
+        const Operator_& operat, const Geometry::ConformalMesh<Shape::Quadrilateral, 2, Coord_>& base_mesh,
+        const String& cubature, const DT_ alpha = DT_(1))
+      {
+        _assemble_bilinear_operator(matrix, operat, base_mesh, _EdgeCharts<Coord_>(), cubature, alpha);
+      }
+
+      /**
+       * \brief Assembles a bilinear operator into a macro-structured matrix
+       *
+       * \param[in,out] matrix
+       * The matrix whose layout has been assembled by assemble_structure(). The operator is
+       * added onto the macro matrices, which are allocated by the first call of this function.
+       *
+       * \param[in] operat
+       * The bilinear operator that is to be assembled.
+       *
+       * \param[in] base_node
+       * The root mesh node of the base mesh, whose charts are to be applied.
+       *
+       * \param[in] cubature
+       * The name of the cubature rule that is to be used for the assembly.
+       *
+       * \param[in] alpha
+       * The scaling factor for the assembly.
+       */
+      template<typename DT_, typename IT_, typename Operator_, typename Coord_>
+      static void assemble_bilinear_operator(LAFEM::MacroStructuredMatrix<DT_, IT_>& matrix,
+        const Operator_& operat, const Geometry::RootMeshNode<Geometry::ConformalMesh<Shape::Quadrilateral, 2, Coord_>>& base_node,
+        const String& cubature, const DT_ alpha = DT_(1))
+      {
+        _assemble_bilinear_operator(matrix, operat, *base_node.get_mesh(), _get_edge_charts(base_node), cubature, alpha);
+      }
+
+      /**
+       * \brief Assembles the prolongation matrix between two macro-structured matrices
+       *
+       * This function assembles the Q1 prolongation matrix from the DOFs of a coarse macro-structured
+       * matrix with n slices onto the DOFs of a fine macro-structured matrix with 2n slices, whose
+       * layouts have been assembled on the same base mesh. The restriction matrix is given by the
+       * transpose of the prolongation matrix.
+       *
+       * \param[out] prol_matrix
+       * The prolongation matrix that is to be assembled.
+       *
+       * \param[in] matrix_f
+       * The fine macro-structured matrix.
+       *
+       * \param[in] matrix_c
+       * The coarse macro-structured matrix.
+       */
+      template<typename DT_, typename IT_>
+      static void assemble_prolongation(LAFEM::SparseMatrixCSR<DT_, IT_>& prol_matrix,
+        const LAFEM::MacroStructuredMatrix<DT_, IT_>& matrix_f, const LAFEM::MacroStructuredMatrix<DT_, IT_>& matrix_c)
+      {
+        const Index nc = matrix_c.get_num_slices();
+        const Index nf = matrix_f.get_num_slices();
+        XASSERTM(nf == 2u*nc, "fine matrix must have twice as many slices as the coarse matrix");
+        XASSERTM(matrix_f.get_num_macros() == matrix_c.get_num_macros(), "incompatible base meshes");
+        const Index sc = nc + 1u;
+        const Index sf = nf + 1u;
+
+        // the prolongation of a DOF only depends on the DOFs of the sub-entity of the base mesh
+        // it lies on, so rows shared by several macros are assembled by the first macro only
+        const Index num_rows = matrix_f.rows();
+        std::vector<IT_> row_ptr(num_rows + 1u, IT_(0));
+        std::vector<std::array<IT_, 4>> row_cols(num_rows);
+        std::vector<std::array<DT_, 4>> row_vals(num_rows);
+
+        std::vector<Index> dofs_f, dofs_c;
+        for(Index m(0); m < matrix_f.get_num_macros(); ++m)
+        {
+          matrix_f.get_macro_dofs(dofs_f, m);
+          matrix_c.get_macro_dofs(dofs_c, m);
+          for(Index j(0); j < sf; ++j)
+          {
+            for(Index i(0); i < sf; ++i)
+            {
+              const Index row = dofs_f[j*sf + i];
+              if(row_ptr[row + 1u] > IT_(0))
+                continue;
+
+              // coarse points and weights in each direction
+              const Index ni = (i % 2u) + 1u, nj = (j % 2u) + 1u;
+              const Index ci[2] = {i / 2u, (i + 1u) / 2u}, cj[2] = {j / 2u, (j + 1u) / 2u};
+              const DT_ wi = DT_(1) / DT_(ni), wj = DT_(1) / DT_(nj);
+              IT_ k(0);
+              for(Index b(0); b < nj; ++b)
+              {
+                for(Index a(0); a < ni; ++a, ++k)
+                {
+                  row_cols[row][k] = IT_(dofs_c[cj[b]*sc + ci[a]]);
+                  row_vals[row][k] = wi * wj;
+                }
+              }
+              row_ptr[row + 1u] = k;
+            }
+          }
+        }
+
+        // build the CSR arrays with column indices sorted in ascending order
+        for(Index i(0); i < num_rows; ++i)
+          row_ptr[i + 1u] += row_ptr[i];
+        LAFEM::DenseVector<IT_, IT_> vrow_ptr(num_rows + 1u);
+        LAFEM::DenseVector<IT_, IT_> vcol_idx(Index(row_ptr.back()));
+        LAFEM::DenseVector<DT_, IT_> vval(Index(row_ptr.back()));
+        IT_* rp = vrow_ptr.elements();
+        IT_* ci = vcol_idx.elements();
+        DT_* va = vval.elements();
+        for(Index i(0); i < num_rows; ++i)
+        {
+          const IT_ nze = row_ptr[i + 1u] - row_ptr[i];
+          std::array<IT_, 4> perm = {IT_(0), IT_(1), IT_(2), IT_(3)};
+          std::sort(perm.begin(), perm.begin() + std::ptrdiff_t(nze),
+            [&](IT_ x, IT_ y) {return row_cols[i][x] < row_cols[i][y];});
+          rp[i] = row_ptr[i];
+          for(IT_ k(0); k < nze; ++k)
+          {
+            ci[row_ptr[i] + k] = row_cols[i][perm[k]];
+            va[row_ptr[i] + k] = row_vals[i][perm[k]];
+          }
+        }
+        rp[num_rows] = row_ptr[num_rows];
+
+        prol_matrix = LAFEM::SparseMatrixCSR<DT_, IT_>(num_rows, matrix_c.columns(), vcol_idx, vval, vrow_ptr);
+      }
+
+      /**
+       * \brief Assembles the vector mirror of a mesh part for a macro-structured matrix
+       *
+       * The mirror contains the DOFs of the base mesh vertices of the mesh part, followed by the
+       * inner DOFs of its base mesh edges and finally the interior DOFs of its macros. The inner
+       * DOFs of each edge are ordered from the edge vertex that comes first in the vertex target
+       * set of the mesh part to the other one, so that two processes whose halos share the same
+       * target set ordering also agree on the mirror ordering, even if their local base mesh edges
+       * are oriented differently. This allows the mirrors of the halos of a partitioned base mesh
+       * to be used by a Global::Gate for the macro-structured matrix.
+       *
+       * \param[out] vec_mirror
+       * The vector mirror that is to be assembled.
+       *
+       * \param[in] matrix
+       * The matrix whose layout has been assembled by assemble_structure().
+       *
+       * \param[in] base_mesh
+       * The quadrilateral base mesh that was used to assemble the layout.
+       *
+       * \param[in] mesh_part
+       * The mesh part of the base mesh, e.g. a halo, whose DOFs are to be mirrored.
+       */
+      template<typename DT_, typename IT_, typename Coord_>
+      static void assemble_mirror(LAFEM::VectorMirror<DT_, IT_>& vec_mirror,
+        const LAFEM::MacroStructuredMatrix<DT_, IT_>& matrix,
+        const Geometry::ConformalMesh<Shape::Quadrilateral, 2, Coord_>& base_mesh,
+        const Geometry::MeshPart<Geometry::ConformalMesh<Shape::Quadrilateral, 2, Coord_>>& mesh_part)
+      {
+        const Index n = matrix.get_num_slices();
+        const Index num_verts = base_mesh.get_num_vertices();
+        XASSERTM(matrix.get_interior_offset(0) == num_verts + base_mesh.get_num_entities(1) * (n - 1u),
+          "matrix layout does not match base mesh");
+
+        const auto& trg_verts = mesh_part.template get_target_set<0>();
+        const auto& trg_edges = mesh_part.template get_target_set<1>();
+        const auto& trg_quads = mesh_part.template get_target_set<2>();
+        const auto& verts_at_edge = base_mesh.template get_index_set<1, 0>();
+
+        // compute the position of each base mesh vertex in the vertex target set
+        std::vector<Index> vert_pos(num_verts, ~Index(0));
+        for(Index i(0); i < trg_verts.get_num_entities(); ++i)
+          vert_pos[trg_verts[i]] = i;
+
+        const Index num_idx = trg_verts.get_num_entities() + trg_edges.get_num_entities() * (n - 1u)
+          + trg_quads.get_num_entities() * (n - 1u) * (n - 1u);
+        vec_mirror = LAFEM::VectorMirror<DT_, IT_>(matrix.rows(), num_idx);
+        IT_* idx = vec_mirror.indices();
+        Index k(0);
+
+        // base mesh vertex DOFs
+        for(Index i(0); i < trg_verts.get_num_entities(); ++i, ++k)
+          idx[k] = IT_(trg_verts[i]);
+
+        // inner DOFs of the base mesh edges, which are stored from the first to the second edge vertex
+        for(Index i(0); i < trg_edges.get_num_entities(); ++i)
+        {
+          const Index e = trg_edges[i];
+          const Index p0 = vert_pos[verts_at_edge(e, 0)];
+          const Index p1 = vert_pos[verts_at_edge(e, 1)];
+          XASSERTM((p0 != ~Index(0)) && (p1 != ~Index(0)), "mesh part contains an edge without its vertices");
+          const Index off = num_verts + e * (n - 1u);
+          for(Index j(0); j + 1u < n; ++j, ++k)
+            idx[k] = IT_(off + (p0 < p1 ? j : n - 2u - j));
+        }
+
+        // interior DOFs of the macros
+        for(Index i(0); i < trg_quads.get_num_entities(); ++i)
+        {
+          const Index off = matrix.get_interior_offset(trg_quads[i]);
+          for(Index j(0); j < (n - 1u) * (n - 1u); ++j, ++k)
+            idx[k] = IT_(off + j);
+        }
+      }
+
+    protected:
+      /// the chart pointers for each base mesh edge; empty if no charts are to be applied
+      template<typename Coord_>
+      using _EdgeCharts = std::vector<const Geometry::Atlas::ChartBase<Geometry::ConformalMesh<Shape::Quadrilateral, 2, Coord_>>*>;
+
+      /// determines the chart of each base mesh edge by the mesh parts of a root mesh node
+      template<typename Coord_>
+      static _EdgeCharts<Coord_> _get_edge_charts(const Geometry::RootMeshNode<Geometry::ConformalMesh<Shape::Quadrilateral, 2, Coord_>>& base_node)
+      {
+        _EdgeCharts<Coord_> edge_charts(base_node.get_mesh()->get_num_entities(1), nullptr);
+        for(const auto& name : base_node.get_mesh_part_names(true))
+        {
+          const auto* chart = base_node.find_mesh_part_chart(name);
+          const auto* part = base_node.find_mesh_part(name);
+          if((chart == nullptr) || (part == nullptr))
+            continue;
+          XASSERTM(chart->can_implicit(), "only implicit charts are supported by macro-structured assembly");
+          const auto& trg = part->template get_target_set<1>();
+          for(Index i(0); i < trg.get_num_entities(); ++i)
+            edge_charts.at(trg[i]) = chart;
+        }
+        return edge_charts;
+      }
+
+      template<typename DT_, typename IT_, typename Coord_>
+      static void _compute_dof_coords(std::vector<Tiny::Vector<Coord_, 2>>& coords,
+        const LAFEM::MacroStructuredMatrix<DT_, IT_>& matrix,
+        const Geometry::ConformalMesh<Shape::Quadrilateral, 2, Coord_>& base_mesh,
+        const _EdgeCharts<Coord_>& edge_charts)
+      {
+        const Index n = matrix.get_num_slices();
+        const Index s = n + 1u;
+        coords.resize(matrix.rows());
+
+        std::vector<Tiny::Vector<Coord_, 2>> loc(s*s);
+        std::vector<Index> dofs;
+        for(Index m(0); m < matrix.get_num_macros(); ++m)
+        {
+          _map_patch(loc, base_mesh, edge_charts, m, n);
+          matrix.get_macro_dofs(dofs, m);
+          for(Index k(0); k < s*s; ++k)
+            coords[dofs[k]] = loc[k];
+        }
+      }
+
+      template<typename DT_, typename IT_, typename Operator_, typename Coord_>
+      static void _assemble_bilinear_operator(LAFEM::MacroStructuredMatrix<DT_, IT_>& matrix,
+        const Operator_& operat, const Geometry::ConformalMesh<Shape::Quadrilateral, 2, Coord_>& base_mesh,
+        const _EdgeCharts<Coord_>& edge_charts, const String& cubature, const DT_ alpha)
+      {
+        typedef Geometry::ConformalMesh<Shape::Quadrilateral, 2, Coord_> MeshType;
+        typedef Trafo::Standard::Mapping<MeshType> TrafoType;
+        typedef Space::Lagrange1::Element<TrafoType> SpaceType;
+
+        const Index n = matrix.get_num_slices();
+        const Index s = n + 1u;
+
+        // create a lexicographically ordered patch mesh, which is moved onto each macro
+        MeshType patch_mesh = Geometry::StructUnitCubeFactory<MeshType>::make_from(n, n);
+        TrafoType patch_trafo(patch_mesh);
+        SpaceType patch_space(patch_trafo);
+        DomainAssembler<TrafoType> dom_asm(patch_trafo);
+        dom_asm.compile_all_elements();
+
+        LAFEM::SparseMatrixCSR<DT_, IT_> patch_matrix;
+        SymbolicAssembler::assemble_matrix_std1(patch_matrix, patch_space);
+
+        std::vector<Tiny::Vector<Coord_, 2>> loc(s*s);
+        auto& vtx = patch_mesh.get_vertex_set();
+        for(Index m(0); m < matrix.get_num_macros(); ++m)
+        {
+          _map_patch(loc, base_mesh, edge_charts, m, n);
+          for(Index i(0); i < s*s; ++i)
+            vtx[i] = loc[i];
+
+          patch_matrix.format();
+          assemble_bilinear_operator_matrix_1(dom_asm, patch_matrix, operat, patch_space, cubature, alpha);
+
+          auto& macro_mat = matrix.get_macro_matrix(m);
+          if(macro_mat.used_elements() == Index(0))
+          {
+            macro_mat.convert(patch_matrix);
+          }
+          else
+          {
+            LAFEM::SparseMatrixBanded<DT_, IT_> temp;
+            temp.convert(patch_matrix);
+            XASSERTM(temp.num_of_offsets() == macro_mat.num_of_offsets(), "incompatible macro matrix layout");
+            DT_* mv = macro_mat.val();
+            const DT_* tv = temp.val();
+            const Index nv = temp.num_of_offsets() * temp.rows();
+            for(Index k(0); k < nv; ++k)
+              mv[k] += tv[k];
+          }
+        }
+      }
+
+      /**
+       * \brief Maps the reference patch vertices onto a macro
+       *
+       * If none of the macro edges is associated with a chart, the patch vertices are given by the
+       * bilinear transformation of the macro. Otherwise, the patch is bisected recursively as by
+       * the StandardRefinery and the new vertices on the macro edges are projected onto the charts
+       * after each bisection.
+       */
+      template<typename Coord_>
+      static void _map_patch(std::vector<Tiny::Vector<Coord_, 2>>& loc,
+        const Geometry::ConformalMesh<Shape::Quadrilateral, 2, Coord_>& base_mesh,
+        const _EdgeCharts<Coord_>& edge_charts, Index macro, Index n)
+      {
+        const auto& verts_at_elem = base_mesh.template get_index_set<2, 0>();
+        const auto& edges_at_elem = base_mesh.template get_index_set<2, 1>();
+        const auto& vtx = base_mesh.get_vertex_set();
+        const auto& v0 = vtx[verts_at_elem(macro, 0)];
+        const auto& v1 = vtx[verts_at_elem(macro, 1)];
+        const auto& v2 = vtx[verts_at_elem(macro, 2)];
+        const auto& v3 = vtx[verts_at_elem(macro, 3)];
+        const Index s = n + 1u;
+
+        const Geometry::Atlas::ChartBase<Geometry::ConformalMesh<Shape::Quadrilateral, 2, Coord_>>* charts[4] =
+          {nullptr, nullptr, nullptr, nullptr};
+        bool any_chart = false;
+        if(!edge_charts.empty())
+        {
+          for(int e(0); e < 4; ++e)
+            any_chart = ((charts[e] = edge_charts.at(edges_at_elem(macro, e))) != nullptr) || any_chart;
+        }
+
+        if(!any_chart)
+        {
+          for(Index j(0); j < s; ++j)
+          {
+            const Coord_ t = Coord_(j) / Coord_(n);
+            for(Index i(0); i < s; ++i)
+            {
+              const Coord_ r = Coord_(i) / Coord_(n);
+              auto& x = loc[j*s + i];
+              for(int k(0); k < 2; ++k)
+                x[k] = (Coord_(1)-r)*(Coord_(1)-t)*v0[k] + r*(Coord_(1)-t)*v1[k] + (Coord_(1)-r)*t*v2[k] + r*t*v3[k];
+            }
+          }
+          return;
+        }
+
+        XASSERTM((n & (n - 1u)) == Index(0), "number of slices must be a power of two if charts are applied");
+
+        loc[0] = v0;
+        loc[n] = v1;
+        loc[n*s] = v2;
+        loc[n*s + n] = v3;
+
+        // bisect the patch until h = 1
+        for(Index h(n); h > Index(1); h /= 2u)
+        {
+          const Index g = h / 2u;
+
+          // bisect the edges in both directions
+          for(Index j(0); j < s; j += h)
+            for(Index i(g); i < s; i += h)
+              loc[j*s + i] = Coord_(0.5) * (loc[j*s + i - g] + loc[j*s + i + g]);
+          for(Index j(g); j < s; j += h)
+            for(Index i(0); i < s; i += h)
+              loc[j*s + i] = Coord_(0.5) * (loc[(j - g)*s + i] + loc[(j + g)*s + i]);
+
+          // compute the cell midpoints
+          for(Index j(g); j < s; j += h)
+            for(Index i(g); i < s; i += h)
+              loc[j*s + i] = Coord_(0.25) * (loc[(j - g)*s + i - g] + loc[(j - g)*s + i + g] +
+                loc[(j + g)*s + i - g] + loc[(j + g)*s + i + g]);
+
+          // project the new vertices on the macro edges onto the charts
+          for(Index k(g); k < s; k += h)
+          {
+            if(charts[0] != nullptr)
+              loc[k] = charts[0]->project(loc[k]);
+            if(charts[1] != nullptr)
+              loc[n*s + k] = charts[1]->project(loc[n*s + k]);
+            if(charts[2] != nullptr)
+              loc[k*s] = charts[2]->project(loc[k*s]);
+            if(charts[3] != nullptr)
+              loc[k*s + n] = charts[3]->project(loc[k*s + n]);
+          }
+        }
+      }
+    }; // class MacroStructuredAssembler
+  } // namespace Assembly
+} // namespace FEAT
+
+#endif // KERNEL_ASSEMBLY_MACRO_STRUCTURED_ASSEMBLER_HPP
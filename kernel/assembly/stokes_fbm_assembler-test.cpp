@@ -0,0 +1,178 @@
+// FEAT3: Finite Element Analysis Toolbox, Version 3
+// Copyright (C) 2010 - 2023 by Stefan Turek & the FEAT group
+// FEAT3 is released under the GNU General Public License version 3,
+// see the file 'copyright.txt' in the top level directory for details.
+
+#include <test_system/test_system.hpp>
+#include <kernel/assembly/stokes_fbm_assembler.hpp>
+#include <kernel/geometry/common_factories.hpp>
+#include <kernel/geometry/conformal_mesh.hpp>
+#include <kernel/geometry/hit_test_factory.hpp>
+#include <kernel/trafo/standard/mapping.hpp>
+#include <kernel/space/lagrange2/element.hpp>
+
+using namespace FEAT;
+using namespace FEAT::TestSystem;
+
+/**
+ * \brief Test class for the StokesFBMAssembler class.
+ *
+ * \test Tests the incremental update of the FBM region of a moving sphere against a full reassembly.
+ */
+template<typename Shape_>
+class StokesFBMAssemblerTest :
+  public UnitTest
+{
+  typedef Geometry::ConformalMesh<Shape_> MeshType;
+  typedef Geometry::MeshPart<MeshType> MeshPartType;
+  typedef Trafo::Standard::Mapping<MeshType> TrafoType;
+  typedef Space::Lagrange2::Element<TrafoType> SpaceType;
+  typedef Assembly::StokesFBMAssembler<MeshType> FBMAssemblerType;
+  typedef typename FBMAssemblerType::VertexType VertexType;
+  typedef Geometry::SphereHitTestFunction<double, MeshType::shape_dim> HitFuncType;
+
+  static constexpr int dim = MeshType::shape_dim;
+
+public:
+  StokesFBMAssemblerTest() :
+    UnitTest("StokesFBMAssemblerTest<" + Shape_::name() + ">")
+  {
+  }
+
+  virtual ~StokesFBMAssemblerTest()
+  {
+  }
+
+  void check_meshparts(const MeshPartType& part_a, const MeshPartType& part_b) const
+  {
+    for(int d(0); d <= dim; ++d)
+    {
+      TEST_CHECK_EQUAL(part_a.get_num_entities(d), part_b.get_num_entities(d));
+      if(part_a.get_num_entities(d) != part_b.get_num_entities(d))
+        continue;
+
+      // the target sets of both mesh-parts are sorted
+      TEST_CHECK(get_targets(part_a, d) == get_targets(part_b, d));
+    }
+  }
+
+  /// returns the target indices of a mesh-part for a given dimension
+  static std::vector<Index> get_targets(const MeshPartType& part, int d)
+  {
+    std::vector<Index> v;
+    if(d == 0)
+      fill_targets(v, part.template get_target_set<0>());
+    else if(d == 1)
+      fill_targets(v, part.template get_target_set<1>());
+    else if(d == 2)
+      fill_targets(v, part.template get_target_set<(dim > 1 ? 2 : 0)>());
+    else
+      fill_targets(v, part.template get_target_set<(dim > 2 ? 3 : 0)>());
+    return v;
+  }
+
+  static void fill_targets(std::vector<Index>& v, const Geometry::TargetSet& trg)
+  {
+    for(Index i(0); i < trg.get_num_entities(); ++i)
+      v.push_back(trg[i]);
+  }
+
+  template<typename Filter_>
+  void check_filters(const Filter_& filter_a, const Filter_& filter_b) const
+  {
+    TEST_CHECK_EQUAL(filter_a.size(), filter_b.size());
+    TEST_CHECK_EQUAL(filter_a.used_elements(), filter_b.used_elements());
+    if(filter_a.used_elements() != filter_b.used_elements())
+      return;
+    for(Index i(0); i < filter_a.used_elements(); ++i)
+    {
+      TEST_CHECK_EQUAL(filter_a.get_indices()[i], filter_b.get_indices()[i]);
+    }
+  }
+
+  /// returns the bounding box of a sphere
+  static std::pair<VertexType, VertexType> sphere_box(const VertexType& mid, double radius)
+  {
+    VertexType bmin(mid), bmax(mid);
+    for(int k(0); k < dim; ++k)
+    {
+      bmin[k] -= radius;
+      bmax[k] += radius;
+    }
+    return std::make_pair(bmin, bmax);
+  }
+
+  void test_moving_sphere(Index level) const
+  {
+    Geometry::RefinedUnitCubeFactory<MeshType> mesh_factory(level);
+    MeshType mesh(mesh_factory);
+    TrafoType trafo(mesh);
+    SpaceType space(trafo);
+
+    const double radius(0.21);
+    VertexType mid(0.3);
+
+    // assemble the initial FBM region
+    FBMAssemblerType fbm_asm(mesh);
+    {
+      HitFuncType hit_func(mid, radius);
+      Geometry::HitTestFactory<HitFuncType, MeshType> hit_factory(hit_func, mesh);
+      MeshPartType fbm_part(hit_factory);
+      fbm_asm.add_fbm_meshpart(fbm_part);
+      fbm_asm.compile();
+    }
+
+    LAFEM::UnitFilter<double, Index> filter;
+    LAFEM::UnitFilterBlocked<double, Index, dim> filter_b;
+    fbm_asm.assemble_inside_filter(filter, space);
+    fbm_asm.assemble_inside_filter(filter_b, space);
+
+    // move the sphere in a few small steps across the domain
+    for(int step(0); step < 6; ++step)
+    {
+      VertexType mid_new(mid);
+      mid_new[0] += 0.07;
+      mid_new[dim-1] += 0.045;
+
+      // the band is the union of the bounding boxes of the old and new spheres
+      std::vector<std::pair<VertexType, VertexType>> bands;
+      bands.push_back(sphere_box(mid, radius));
+      bands.push_back(sphere_box(mid_new, radius));
+      mid = mid_new;
+
+      HitFuncType hit_func(mid, radius);
+      fbm_asm.update_region(hit_func, bands);
+      fbm_asm.update_inside_filter(filter, space);
+      fbm_asm.update_inside_filter(filter_b, space);
+
+      // assemble reference from scratch
+      Geometry::HitTestFactory<HitFuncType, MeshType> hit_factory(hit_func, mesh);
+      MeshPartType fbm_part(hit_factory);
+      FBMAssemblerType fbm_ref(mesh);
+      fbm_ref.add_fbm_meshpart(fbm_part);
+      fbm_ref.compile();
+
+      for(int d(0); d <= dim; ++d)
+      {
+        TEST_CHECK(fbm_asm.get_fbm_mask_vector(d) == fbm_ref.get_fbm_mask_vector(d));
+      }
+      check_meshparts(fbm_asm.get_meshpart_inside(), fbm_ref.get_meshpart_inside());
+      check_meshparts(fbm_asm.get_meshpart_interface(), fbm_ref.get_meshpart_interface());
+
+      LAFEM::UnitFilter<double, Index> filter_ref;
+      LAFEM::UnitFilterBlocked<double, Index, dim> filter_b_ref;
+      fbm_ref.assemble_inside_filter(filter_ref, space);
+      fbm_ref.assemble_inside_filter(filter_b_ref, space);
+      check_filters(filter, filter_ref);
+      check_filters(filter_b, filter_b_ref);
+    }
+  }
+
+  virtual void run() const override
+  {
+    test_moving_sphere(Index(dim == 2 ? 4 : 2));
+  }
+};
+
+StokesFBMAssemblerTest<Shape::Quadrilateral> stokes_fbm_assembler_test_quad;
+StokesFBMAssemblerTest<Shape::Hexahedron> stokes_fbm_assembler_test_hexa;
@@ -22,9 +22,11 @@
 #include <kernel/global/matrix.hpp>
 
 // includes, system
+#include <algorithm>
 #include <array>
 #include <vector>
 #include <memory>
+#include <utility>
 
 namespace FEAT
 {
@@ -58,6 +60,13 @@ namespace FEAT
      * -# If you require the characteristic function of the FBM region interface, e.g. for the volumetric computation of
      *    the drag and lift forces, then you can use the assemble_characteristic_vector() function for that.
      *
+     * If the FBM region moves over time, e.g. in particle-laden flows, then there is no need to clear the assembler and
+     * recompute the FBM masks on the whole mesh in every time step. Instead, call the update_region() function with a
+     * hit-test function representing the whole FBM region at its new position as well as a set of narrow bands which
+     * contain all entities whose FBM mask may have changed. Afterwards, the inside filters can be updated by the
+     * update_inside_filter() functions, whereas the (much smaller) interface filters have to be reassembled by the
+     * assemble_interface_filter() functions.
+     *
      * \author Peter Zajac
      */
     template<typename MeshType_>
@@ -68,6 +77,14 @@ namespace FEAT
       typedef MeshType_ MeshType;
       /// our shape dimension
       static constexpr int shape_dim = MeshType::shape_dim;
+      /// our world dimension
+      static constexpr int world_dim = MeshType::world_dim;
+      /// our coordinate type
+      typedef typename MeshType::CoordType CoordType;
+      /// our vertex type
+      typedef typename MeshType::VertexType VertexType;
+      /// narrow band type: minimum and maximum corner of an axis-aligned box
+      typedef std::pair<VertexType, VertexType> BandType;
 
     protected:
       /// a reference to our mesh object
@@ -98,6 +115,22 @@ namespace FEAT
       std::unique_ptr<Assembly::UnitFilterAssembler<MeshType_>> _unit_asm_inside;
       /// unit-filter assembler on interface mesh-part
       std::unique_ptr<Assembly::UnitFilterAssembler<MeshType_>> _unit_asm_interface;
+      /// unit-filter assembler on the entities added to the inside region by the last update
+      std::unique_ptr<Assembly::UnitFilterAssembler<MeshType_>> _unit_asm_added;
+      /// unit-filter assembler on the entities removed from the inside region by the last update
+      std::unique_ptr<Assembly::UnitFilterAssembler<MeshType_>> _unit_asm_removed;
+      /// the meshparts representing the entities added to/removed from the inside region by the last update
+      std::unique_ptr<Geometry::MeshPart<MeshType>> _fbm_meshpart_added, _fbm_meshpart_removed;
+      /// entity midpoints for each dimension; only computed for update_region()
+      std::array<std::vector<VertexType>, shape_dim+1> _midpoints;
+      /// spatial index: bucket pointer and bucket entity index arrays for each dimension
+      std::array<std::vector<Index>, shape_dim+1> _bucket_ptr, _bucket_idx;
+      /// spatial index: grid origin and bucket widths
+      VertexType _grid_origin, _grid_width;
+      /// maximum extents of all elements in each world dimension
+      VertexType _elem_extent;
+      /// spatial index: number of buckets per world dimension
+      Index _grid_size;
       /// already compiled?
       bool _compiled;
 
@@ -115,6 +148,17 @@ namespace FEAT
         _fbm_meshpart_interface(),
         _unit_asm_inside(),
         _unit_asm_interface(),
+        _unit_asm_added(),
+        _unit_asm_removed(),
+        _fbm_meshpart_added(),
+        _fbm_meshpart_removed(),
+        _midpoints(),
+        _bucket_ptr(),
+        _bucket_idx(),
+        _grid_origin(),
+        _grid_width(),
+        _elem_extent(),
+        _grid_size(0u),
         _compiled(false)
       {
         // allocate FBM mask vectors
@@ -147,6 +191,10 @@ namespace FEAT
         _fbm_meshpart_interface.reset();
         _unit_asm_inside.reset();
         _unit_asm_interface.reset();
+        _unit_asm_added.reset();
+        _unit_asm_removed.reset();
+        _fbm_meshpart_added.reset();
+        _fbm_meshpart_removed.reset();
         _compiled = false;
       }
 
@@ -279,7 +327,7 @@ namespace FEAT
         XASSERTM(!_compiled, "assembler has already been compiled!");
 
         // process the mask
-        _process_shapes(_fbm_masks, _mesh.get_index_set_holder());
+        _process_shapes(_fbm_masks, _mesh.get_index_set_holder(), nullptr);
 
         // count masked entities
         Index counts_i[shape_dim+1], counts_o[shape_dim+1];
@@ -318,6 +366,114 @@ namespace FEAT
         _compiled = true;
       }
 
+      /**
+       * \brief Updates the FBM region of a compiled assembler within a set of narrow bands
+       *
+       * This function re-evaluates the hit-test function only for the entities whose midpoints are contained
+       * in at least one of the given narrow bands, which are found by a spatial index over the mesh entities
+       * that is built upon the first call of this function. The FBM masks of all other entities remain unchanged,
+       * so the caller has to ensure that the FBM region did not change outside of the narrow bands, e.g. by
+       * choosing the bounding box of the previous and the new position of each moving body as a narrow band.
+       *
+       * Afterwards, the FBM inside and interface mesh-parts represent the updated region and the inside filters
+       * can be updated by calling update_inside_filter(), which only processes the changed entities.
+       *
+       * \note The hit-test function is evaluated in the entity midpoints in the same way as by the
+       * Geometry::HitTestFactory, so the result is identical to clearing the assembler and adding a mesh-part
+       * created by a HitTestFactory with the same hit-test function.
+       *
+       * \param[in] hit_func
+       * A \transient reference to the hit-test function representing the whole FBM region at its new position.
+       *
+       * \param[in] bands
+       * A \transient reference to the vector of narrow bands that contain all changed entities.
+       */
+      template<typename HitFunc_>
+      void update_region(const HitFunc_& hit_func, const std::vector<BandType>& bands)
+      {
+        XASSERTM(_compiled, "FBM assembler must be compiled first!");
+
+        // build the spatial index if necessary
+        if(_bucket_ptr.front().empty())
+          _build_spatial_index();
+
+        // the masks of an entity may also change if only one of its faces is inside a band,
+        // so extend the bands by the element extents to find all candidates
+        std::vector<BandType> ext_bands(bands);
+        for(auto& b : ext_bands)
+        {
+          b.first -= _elem_extent;
+          b.second += _elem_extent;
+        }
+
+        std::array<std::vector<Index>, shape_dim+1> cands, added_i, removed_i, added_f, removed_f;
+        std::array<std::vector<int>, shape_dim+1> old_masks;
+
+        // re-evaluate the hit-test function for all candidates inside the bands
+        for(int d(0); d <= shape_dim; ++d)
+        {
+          std::vector<Index>& cand = cands.at(std::size_t(d));
+          for(const auto& b : ext_bands)
+            _query_spatial_index(cand, d, b.first, b.second);
+          std::sort(cand.begin(), cand.end());
+          cand.erase(std::unique(cand.begin(), cand.end()), cand.end());
+
+          std::vector<int>& mask = _fbm_masks.at(std::size_t(d));
+          const std::vector<VertexType>& mids = _midpoints.at(std::size_t(d));
+          std::vector<int>& old_mask = old_masks.at(std::size_t(d));
+          old_mask.resize(cand.size());
+          for(std::size_t k(0); k < cand.size(); ++k)
+          {
+            const Index i = cand[k];
+            old_mask[k] = mask[i];
+            int bit0 = mask[i] & 1;
+            if(_is_in_bands(mids[i], bands))
+              bit0 = (hit_func(mids[i]) ? 1 : 0);
+            mask[i] = bit0 | (bit0 << 1);
+          }
+        }
+
+        // recompute bit 1 of all candidates
+        _process_shapes(_fbm_masks, _mesh.get_index_set_holder(), &cands);
+
+        // determine the changes of the inside and interface regions
+        for(std::size_t d(0); d <= std::size_t(shape_dim); ++d)
+        {
+          const std::vector<int>& mask = _fbm_masks.at(d);
+          for(std::size_t k(0); k < cands[d].size(); ++k)
+          {
+            const Index i = cands[d][k];
+            const int mo = old_masks[d][k], mn = mask[i];
+            if(mo == mn)
+              continue;
+            if(mo == 3)
+              removed_i[d].push_back(i);
+            else if(mn == 3)
+              added_i[d].push_back(i);
+            if(mo == 1)
+              removed_f[d].push_back(i);
+            else if(mn == 1)
+              added_f[d].push_back(i);
+          }
+        }
+
+        // update mesh-parts
+        _fbm_meshpart_inside = _update_meshpart(*_fbm_meshpart_inside, added_i, removed_i);
+        _fbm_meshpart_interface = _update_meshpart(*_fbm_meshpart_interface, added_f, removed_f);
+        _fbm_meshpart_added = _create_meshpart(added_i);
+        _fbm_meshpart_removed = _create_meshpart(removed_i);
+
+        // set up unit filter assemblers
+        this->_unit_asm_interface.reset(new Assembly::UnitFilterAssembler<MeshType>());
+        this->_unit_asm_inside.reset(new Assembly::UnitFilterAssembler<MeshType>());
+        this->_unit_asm_added.reset(new Assembly::UnitFilterAssembler<MeshType>());
+        this->_unit_asm_removed.reset(new Assembly::UnitFilterAssembler<MeshType>());
+        _unit_asm_interface->add_mesh_part(*this->_fbm_meshpart_interface);
+        _unit_asm_inside->add_mesh_part(*this->_fbm_meshpart_inside);
+        _unit_asm_added->add_mesh_part(*this->_fbm_meshpart_added);
+        _unit_asm_removed->add_mesh_part(*this->_fbm_meshpart_removed);
+      }
+
       /// Returns a reference to the mesh-part representing the FBM interface
       const Geometry::MeshPart<MeshType>& get_meshpart_interface() const
       {
@@ -417,6 +573,100 @@ namespace FEAT
         this->_unit_asm_inside->assemble(filter, space);
       }
 
+      /**
+       * \brief Updates a UnitFilter inside the FBM region after a call of update_region()
+       *
+       * This function removes the DOFs of all entities that have left the FBM inside region and adds the DOFs of all
+       * entities that have entered the FBM inside region by the last call of update_region(), so the filter has to be
+       * assembled by assemble_inside_filter() (or updated by this function) before the last region update.
+       *
+       * \param[inout] filter
+       * A \transient reference to the filter to be updated
+       *
+       * \param[in] space
+       * A \transient reference to the space to update the filter for
+       */
+      template<typename DT_, typename IT_, typename Space_>
+      void update_inside_filter(LAFEM::UnitFilter<DT_, IT_>& filter, const Space_& space) const
+      {
+        XASSERTM(_compiled, "FBM assembler must be compiled first!");
+        XASSERTM(_unit_asm_added != nullptr, "FBM region has not been updated!");
+
+        const Index num_dofs = space.get_num_dofs();
+        LAFEM::UnitFilter<DT_, IT_> filter_add(num_dofs), filter_rem(num_dofs);
+        this->_unit_asm_added->assemble(filter_add, space);
+        this->_unit_asm_removed->assemble(filter_rem, space);
+
+        std::vector<IT_> idx;
+        std::vector<DT_> val;
+        // note: the value arrays of empty filters must not be accessed
+        const Index n_old = filter.used_elements();
+        const Index n_add = filter_add.used_elements();
+        const Index n_rem = filter_rem.used_elements();
+        _merge_filter_entries(idx, val,
+          n_old > Index(0) ? filter.get_indices() : nullptr, n_old > Index(0) ? filter.get_values() : nullptr, n_old,
+          n_add > Index(0) ? filter_add.get_indices() : nullptr, n_add > Index(0) ? filter_add.get_values() : nullptr, n_add,
+          n_rem > Index(0) ? filter_rem.get_indices() : nullptr, n_rem);
+
+        if(idx.empty())
+        {
+          filter = LAFEM::UnitFilter<DT_, IT_>(num_dofs);
+          return;
+        }
+
+        LAFEM::DenseVector<DT_, IT_> vec_val(Index(val.size()));
+        LAFEM::DenseVector<IT_, IT_> vec_idx(Index(idx.size()));
+        std::copy(val.begin(), val.end(), vec_val.elements());
+        std::copy(idx.begin(), idx.end(), vec_idx.elements());
+        filter.get_filter_vector() = LAFEM::SparseVector<DT_, IT_>(num_dofs, vec_val, vec_idx);
+      }
+
+      /**
+       * \brief Updates a UnitFilterBlocked inside the FBM region after a call of update_region()
+       *
+       * \param[inout] filter
+       * A \transient reference to the filter to be updated
+       *
+       * \param[in] space
+       * A \transient reference to the space to update the filter for
+       */
+      template<typename DT_, typename IT_, typename Space_, int dim_>
+      void update_inside_filter(LAFEM::UnitFilterBlocked<DT_, IT_, dim_>& filter, const Space_& space) const
+      {
+        XASSERTM(_compiled, "FBM assembler must be compiled first!");
+        XASSERTM(_unit_asm_added != nullptr, "FBM region has not been updated!");
+
+        typedef typename LAFEM::UnitFilterBlocked<DT_, IT_, dim_>::ValueType ValueType;
+
+        const Index num_dofs = space.get_num_dofs();
+        LAFEM::UnitFilterBlocked<DT_, IT_, dim_> filter_add(num_dofs), filter_rem(num_dofs);
+        this->_unit_asm_added->assemble(filter_add, space);
+        this->_unit_asm_removed->assemble(filter_rem, space);
+
+        std::vector<IT_> idx;
+        std::vector<ValueType> val;
+        // note: the value arrays of empty filters must not be accessed
+        const Index n_old = filter.used_elements();
+        const Index n_add = filter_add.used_elements();
+        const Index n_rem = filter_rem.used_elements();
+        _merge_filter_entries(idx, val,
+          n_old > Index(0) ? filter.get_indices() : nullptr, n_old > Index(0) ? filter.get_values() : nullptr, n_old,
+          n_add > Index(0) ? filter_add.get_indices() : nullptr, n_add > Index(0) ? filter_add.get_values() : nullptr, n_add,
+          n_rem > Index(0) ? filter_rem.get_indices() : nullptr, n_rem);
+
+        if(idx.empty())
+        {
+          filter = LAFEM::UnitFilterBlocked<DT_, IT_, dim_>(num_dofs);
+          return;
+        }
+
+        LAFEM::DenseVectorBlocked<DT_, IT_, dim_> vec_val(Index(val.size()));
+        LAFEM::DenseVector<IT_, IT_> vec_idx(Index(idx.size()));
+        std::copy(val.begin(), val.end(), vec_val.elements());
+        std::copy(idx.begin(), idx.end(), vec_idx.elements());
+        filter.get_filter_vector() = LAFEM::SparseVectorBlocked<DT_, IT_, dim_>(num_dofs, vec_val, vec_idx);
+      }
+
       /**
        * \brief Assembles a UnitFilter on the FBM interface (non-parallel version)
        *
@@ -552,6 +802,274 @@ namespace FEAT
       }
 
     protected:
+      /// auxiliary function: merges sorted filter entries by removing and adding entries
+      template<typename IT_, typename VT_>
+      static void _merge_filter_entries(std::vector<IT_>& idx, std::vector<VT_>& val,
+        const IT_* old_idx, const VT_* old_val, const Index n_old,
+        const IT_* add_idx, const VT_* add_val, const Index n_add,
+        const IT_* rem_idx, const Index n_rem)
+      {
+        idx.reserve(n_old + n_add);
+        val.reserve(n_old + n_add);
+        Index i(0), j(0), k(0);
+        while((i < n_old) || (j < n_add))
+        {
+          if((j >= n_add) || ((i < n_old) && (old_idx[i] < add_idx[j])))
+          {
+            // skip removed entries
+            while((k < n_rem) && (rem_idx[k] < old_idx[i]))
+              ++k;
+            if((k >= n_rem) || (rem_idx[k] != old_idx[i]))
+            {
+              idx.push_back(old_idx[i]);
+              val.push_back(old_val[i]);
+            }
+            ++i;
+          }
+          else
+          {
+            // skip entries that already exist
+            if((i < n_old) && (old_idx[i] == add_idx[j]))
+              ++i;
+            idx.push_back(add_idx[j]);
+            val.push_back(add_val[j]);
+            ++j;
+          }
+        }
+      }
+
+      /// auxiliary function: creates a mesh-part from sorted target index vectors
+      static std::unique_ptr<Geometry::MeshPart<MeshType>> _create_meshpart(const std::array<std::vector<Index>, shape_dim+1>& trg)
+      {
+        Index counts[shape_dim+1];
+        for(int d(0); d <= shape_dim; ++d)
+          counts[d] = Index(trg.at(std::size_t(d)).size());
+
+        std::unique_ptr<Geometry::MeshPart<MeshType>> part(new Geometry::MeshPart<MeshType>(counts, false));
+        for(int d(0); d <= shape_dim; ++d)
+        {
+          Geometry::TargetSet& target_set = _get_target_set(part->get_target_set_holder(), d);
+          const std::vector<Index>& t = trg.at(std::size_t(d));
+          for(Index i(0); i < counts[d]; ++i)
+            target_set[i] = t[i];
+        }
+        return part;
+      }
+
+      /// auxiliary function: creates an updated mesh-part by adding and removing sorted target indices
+      static std::unique_ptr<Geometry::MeshPart<MeshType>> _update_meshpart(const Geometry::MeshPart<MeshType>& part,
+        const std::array<std::vector<Index>, shape_dim+1>& added, const std::array<std::vector<Index>, shape_dim+1>& removed)
+      {
+        std::array<std::vector<Index>, shape_dim+1> trg;
+        for(std::size_t d(0); d <= std::size_t(shape_dim); ++d)
+        {
+          const Geometry::TargetSet& target_set = _get_target_set(part.get_target_set_holder(), int(d));
+          const Index n = target_set.get_num_entities();
+          const std::vector<Index>& add = added[d];
+          const std::vector<Index>& rem = removed[d];
+          std::vector<Index>& t = trg[d];
+          t.reserve(n + add.size());
+          std::size_t j(0), k(0);
+          for(Index i(0); i < n; ++i)
+          {
+            const Index x = target_set[i];
+            for(; (j < add.size()) && (add[j] < x); ++j)
+              t.push_back(add[j]);
+            for(; (k < rem.size()) && (rem[k] < x); ++k) {}
+            if((k >= rem.size()) || (rem[k] != x))
+              t.push_back(x);
+          }
+          for(; j < add.size(); ++j)
+            t.push_back(add[j]);
+        }
+        return _create_meshpart(trg);
+      }
+
+      /// auxiliary function: checks whether a point is inside at least one of the bands
+      static bool _is_in_bands(const VertexType& p, const std::vector<BandType>& bands)
+      {
+        for(const auto& b : bands)
+        {
+          bool inside = true;
+          for(int k(0); k < world_dim; ++k)
+            inside = inside && (b.first[k] <= p[k]) && (p[k] <= b.second[k]);
+          if(inside)
+            return true;
+        }
+        return false;
+      }
+
+      /// auxiliary function: computes the bucket coordinate of a point coordinate
+      Index _bucket_coord(CoordType x, int k) const
+      {
+        const CoordType t = (x - _grid_origin[k]) / _grid_width[k];
+        if(!(t > CoordType(0)))
+          return Index(0);
+        return Math::min(Index(t), _grid_size - Index(1));
+      }
+
+      /// auxiliary function: computes the bucket index of a point
+      Index _bucket_index(const VertexType& p) const
+      {
+        Index b(0);
+        for(int k(world_dim-1); k >= 0; --k)
+          b = b*_grid_size + _bucket_coord(p[k], k);
+        return b;
+      }
+
+      /// auxiliary function: builds the spatial index of all entity midpoints
+      void _build_spatial_index()
+      {
+        // compute the midpoints of all entities
+        _compute_midpoints(_midpoints, _mesh.get_vertex_set(), _mesh.get_index_set_holder());
+
+        // compute the bounding box of the mesh
+        const auto& vtx = _mesh.get_vertex_set();
+        const Index num_verts = vtx.get_num_vertices();
+        VertexType vmin(vtx[0]), vmax(vtx[0]);
+        for(Index i(1); i < num_verts; ++i)
+        {
+          for(int k(0); k < world_dim; ++k)
+          {
+            vmin[k] = Math::min(vmin[k], vtx[i][k]);
+            vmax[k] = Math::max(vmax[k], vtx[i][k]);
+          }
+        }
+
+        // compute the maximum element extents
+        const auto& verts_at_elem = _mesh.template get_index_set<shape_dim, 0>();
+        const Index num_elems = verts_at_elem.get_num_entities();
+        _elem_extent.format();
+        for(Index i(0); i < num_elems; ++i)
+        {
+          VertexType emin(vtx[verts_at_elem(i, 0)]), emax(vtx[verts_at_elem(i, 0)]);
+          for(int j(1); j < verts_at_elem.get_num_indices(); ++j)
+          {
+            for(int k(0); k < world_dim; ++k)
+            {
+              emin[k] = Math::min(emin[k], vtx[verts_at_elem(i, j)][k]);
+              emax[k] = Math::max(emax[k], vtx[verts_at_elem(i, j)][k]);
+            }
+          }
+          for(int k(0); k < world_dim; ++k)
+            _elem_extent[k] = Math::max(_elem_extent[k], emax[k] - emin[k]);
+        }
+
+        // choose roughly one element per bucket
+        _grid_size = Math::max(Index(1), Index(Math::pow(double(num_elems), 1.0 / double(world_dim))));
+        Index num_buckets(1);
+        for(int k(0); k < world_dim; ++k)
+        {
+          num_buckets *= _grid_size;
+          _grid_origin[k] = vmin[k];
+          _grid_width[k] = (vmax[k] - vmin[k]) / CoordType(_grid_size);
+          if(!(_grid_width[k] > CoordType(0)))
+            _grid_width[k] = CoordType(1);
+        }
+
+        // sort the entities of each dimension into the buckets
+        for(std::size_t d(0); d <= std::size_t(shape_dim); ++d)
+        {
+          const std::vector<VertexType>& mids = _midpoints[d];
+          const Index n = Index(mids.size());
+          std::vector<Index>& ptr = _bucket_ptr[d];
+          std::vector<Index>& idx = _bucket_idx[d];
+          std::vector<Index> bidx(n);
+          ptr.assign(num_buckets + 1u, Index(0));
+          for(Index i(0); i < n; ++i)
+            ++ptr[(bidx[i] = _bucket_index(mids[i])) + 1u];
+          for(Index b(0); b < num_buckets; ++b)
+            ptr[b+1u] += ptr[b];
+          std::vector<Index> aux(ptr.begin(), ptr.end()-1);
+          idx.resize(n);
+          for(Index i(0); i < n; ++i)
+            idx[aux[bidx[i]]++] = i;
+        }
+      }
+
+      /// auxiliary function: appends all entities whose midpoints are inside a box to a vector
+      void _query_spatial_index(std::vector<Index>& cand, int dim, const VertexType& bmin, const VertexType& bmax) const
+      {
+        const std::vector<VertexType>& mids = _midpoints.at(std::size_t(dim));
+        const std::vector<Index>& ptr = _bucket_ptr.at(std::size_t(dim));
+        const std::vector<Index>& idx = _bucket_idx.at(std::size_t(dim));
+        const std::vector<BandType> box(1u, BandType(bmin, bmax));
+
+        // compute bucket coordinate ranges
+        Index lo[world_dim], hi[world_dim], c[world_dim];
+        for(int k(0); k < world_dim; ++k)
+        {
+          if(bmax[k] < bmin[k])
+            return;
+          c[k] = lo[k] = _bucket_coord(bmin[k], k);
+          hi[k] = _bucket_coord(bmax[k], k);
+        }
+
+        // loop over all buckets in the range
+        while(true)
+        {
+          Index b(0);
+          for(int k(world_dim-1); k >= 0; --k)
+            b = b*_grid_size + c[k];
+          for(Index j(ptr[b]); j < ptr[b+1u]; ++j)
+          {
+            if(_is_in_bands(mids[idx[j]], box))
+              cand.push_back(idx[j]);
+          }
+
+          // advance to next bucket
+          int k(0);
+          for(; k < world_dim; ++k)
+          {
+            if(++c[k] <= hi[k])
+              break;
+            c[k] = lo[k];
+          }
+          if(k >= world_dim)
+            break;
+        }
+      }
+
+      /// auxiliary function: computes the midpoints of all entities of all dimensions
+      template<typename VertexSet_, typename Shape_, std::size_t n_>
+      static void _compute_midpoints(std::array<std::vector<VertexType>, n_>& mids, const VertexSet_& vtx, const Geometry::IndexSetHolder<Shape_>& idx_holder)
+      {
+        typedef typename Shape::FaceTraits<Shape_, Shape_::dimension-1>::ShapeType FacetType;
+        _compute_midpoints(mids, vtx, static_cast<const Geometry::IndexSetHolder<FacetType>&>(idx_holder));
+
+        // compute the midpoints in the same way as the HitTestFactory
+        const auto& idx = idx_holder.template get_index_set_wrapper<Shape_::dimension>().template get_index_set<0>();
+        const Index n = idx.get_num_entities();
+        const int nv = idx.get_num_indices();
+        std::vector<VertexType>& mid = mids.at(std::size_t(Shape_::dimension));
+        mid.resize(n);
+        for(Index i(0); i < n; ++i)
+        {
+          VertexType p;
+          p.format();
+          for(int j(0); j < nv; ++j)
+          {
+            for(int k(0); k < world_dim; ++k)
+              p[k] += vtx[idx(i, j)][k];
+          }
+          mid[i] = p * (CoordType(1) / CoordType(nv));
+        }
+      }
+
+      /// auxiliary function: computes the midpoints of all entities of all dimensions (recursion end)
+      template<typename VertexSet_, std::size_t n_>
+      static void _compute_midpoints(std::array<std::vector<VertexType>, n_>& mids, const VertexSet_& vtx, const Geometry::IndexSetHolder<Shape::Vertex>&)
+      {
+        const Index n = vtx.get_num_vertices();
+        std::vector<VertexType>& mid = mids.front();
+        mid.resize(n);
+        for(Index i(0); i < n; ++i)
+        {
+          for(int k(0); k < world_dim; ++k)
+            mid[i][k] = vtx[i][k];
+        }
+      }
+
       /// auxiliary function: add a target set to the FBM mask vector
       void _add_fbm_target_set(const Geometry::TargetSet& target_set, int dim)
       {
@@ -628,17 +1146,23 @@ namespace FEAT
        *
        * \param[in] faces_at_shape
        * The faces-at-shape index set of the underlying mesh which describes the faces that are adjacent to a shape
+       *
+       * \param[in] cand
+       * A pointer to the vector of shape entities that are to be processed or \c nullptr, if all shape entities
+       * are to be processed.
        */
       template<int m_>
-      static void _process_mask(std::vector<int>& shape_mask, const std::vector<int>& face_mask, const Geometry::IndexSet<m_>& faces_at_shape)
+      static void _process_mask(std::vector<int>& shape_mask, const std::vector<int>& face_mask,
+        const Geometry::IndexSet<m_>& faces_at_shape, const std::vector<Index>* cand)
       {
         XASSERT(Index(shape_mask.size()) == faces_at_shape.get_num_entities());
         XASSERT(Index(face_mask.size()) == faces_at_shape.get_index_bound());
 
-        const Index n = faces_at_shape.get_num_entities();
+        const Index n = (cand != nullptr ? Index(cand->size()) : faces_at_shape.get_num_entities());
         const int m = faces_at_shape.get_num_indices();
-        for(Index i(0); i < n; ++i)
+        for(Index k(0); k < n; ++k)
         {
+          const Index i = (cand != nullptr ? (*cand)[k] : k);
           // bit 1 of shape mask is only 1 if bit 0 of all faces (of all dimensions) are 1
           int bit1 = (shape_mask[i] >> 1) & 1;
           for(int j(0); j < m; ++j)
@@ -649,31 +1173,36 @@ namespace FEAT
 
       /// auxiliary function: process masks for all face dimensions for a given shape
       template<typename Shape_, int face_dim_, std::size_t n_>
-      static void _process_masks(std::array<std::vector<int>, n_>& masks, const Geometry::IndexSetWrapper<Shape_, face_dim_>& idx_wrapper)
+      static void _process_masks(std::array<std::vector<int>, n_>& masks, const Geometry::IndexSetWrapper<Shape_, face_dim_>& idx_wrapper,
+        const std::vector<Index>* cand)
       {
-        _process_masks(masks, static_cast<const Geometry::IndexSetWrapper<Shape_, face_dim_-1>&>(idx_wrapper));
-        _process_mask(masks.at(Shape_::dimension), masks.at(std::size_t(face_dim_)), idx_wrapper.template get_index_set<face_dim_>());
+        _process_masks(masks, static_cast<const Geometry::IndexSetWrapper<Shape_, face_dim_-1>&>(idx_wrapper), cand);
+        _process_mask(masks.at(Shape_::dimension), masks.at(std::size_t(face_dim_)), idx_wrapper.template get_index_set<face_dim_>(), cand);
       }
 
       /// auxiliary function: process masks for all face dimensions for a given shape (recursion end)
       template<typename Shape_, std::size_t n_>
-      static void _process_masks(std::array<std::vector<int>, n_>& masks, const Geometry::IndexSetWrapper<Shape_, 0>& idx_wrapper)
+      static void _process_masks(std::array<std::vector<int>, n_>& masks, const Geometry::IndexSetWrapper<Shape_, 0>& idx_wrapper,
+        const std::vector<Index>* cand)
       {
-        _process_mask(masks.at(Shape_::dimension), masks.front(), idx_wrapper.template get_index_set<0>());
+        _process_mask(masks.at(Shape_::dimension), masks.front(), idx_wrapper.template get_index_set<0>(), cand);
       }
 
-      /// auxiliary function: process masks shape dimensions
+      /// auxiliary function: process masks shape dimensions; processes only the candidates if cands is not \c nullptr
       template<typename Shape_, std::size_t n_>
-      static void _process_shapes(std::array<std::vector<int>, n_>& masks, const Geometry::IndexSetHolder<Shape_>& idx_holder)
+      static void _process_shapes(std::array<std::vector<int>, n_>& masks, const Geometry::IndexSetHolder<Shape_>& idx_holder,
+        const std::array<std::vector<Index>, shape_dim+1>* cands)
       {
         typedef typename Shape::FaceTraits<Shape_, Shape_::dimension-1>::ShapeType FacetType;
-        _process_shapes(masks, static_cast<const Geometry::IndexSetHolder<FacetType>&>(idx_holder));
-        _process_masks(masks, idx_holder.template get_index_set_wrapper<Shape_::dimension>());
+        _process_shapes(masks, static_cast<const Geometry::IndexSetHolder<FacetType>&>(idx_holder), cands);
+        _process_masks(masks, idx_holder.template get_index_set_wrapper<Shape_::dimension>(),
+          cands != nullptr ? &cands->at(std::size_t(Shape_::dimension)) : nullptr);
       }
 
       /// auxiliary function: process masks shape dimensions (recursion end)
       template<std::size_t n_>
-      static void _process_shapes(std::array<std::vector<int>, n_>&, const Geometry::IndexSetHolder<Shape::Vertex>&)
+      static void _process_shapes(std::array<std::vector<int>, n_>&, const Geometry::IndexSetHolder<Shape::Vertex>&,
+        const std::array<std::vector<Index>, shape_dim+1>*)
       {
         // end of recursion; nothing to do here
       }
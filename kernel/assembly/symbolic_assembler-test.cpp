@@ -0,0 +1,158 @@
+// FEAT3: Finite Element Analysis Toolbox, Version 3
+// Copyright (C) 2010 - 2023 by Stefan Turek & the FEAT group
+// FEAT3 is released under the GNU General Public License version 3,
+// see the file 'copyright.txt' in the top level directory for details.
+
+#include <test_system/test_system.hpp>
+#include <kernel/assembly/symbolic_assembler.hpp>
+#include <kernel/geometry/common_factories.hpp>
+#include <kernel/geometry/conformal_mesh.hpp>
+#include <kernel/trafo/standard/mapping.hpp>
+#include <kernel/space/lagrange1/element.hpp>
+#include <kernel/space/lagrange2/element.hpp>
+#include <kernel/space/discontinuous/element.hpp>
+
+using namespace FEAT;
+using namespace FEAT::TestSystem;
+
+/**
+ * \brief Test class for the SymbolicAssembler class.
+ *
+ * \test Compares the matrix structures assembled directly into CSR and BCSR matrices
+ * with the structures of the corresponding rendered adjacency graphs.
+ */
+template<typename Shape_, typename IT_>
+class SymbolicAssemblerTest :
+  public UnitTest
+{
+  typedef Geometry::ConformalMesh<Shape_> MeshType;
+  typedef Trafo::Standard::Mapping<MeshType> TrafoType;
+  typedef Space::Lagrange1::Element<TrafoType> SpaceQ1;
+  typedef Space::Lagrange2::Element<TrafoType> SpaceQ2;
+  typedef Space::Discontinuous::ElementP0<TrafoType> SpaceP0;
+  typedef LAFEM::SparseMatrixCSR<double, IT_> MatrixCSR;
+  typedef LAFEM::SparseMatrixBCSR<double, IT_, 2, 3> MatrixBCSR;
+
+  static constexpr int dim = MeshType::shape_dim;
+
+public:
+  SymbolicAssemblerTest() :
+    UnitTest("SymbolicAssemblerTest<" + Shape_::name() + ">", Type::Traits<double>::name(), Type::Traits<IT_>::name())
+  {
+  }
+
+  virtual ~SymbolicAssemblerTest()
+  {
+  }
+
+  /// compares the structure of a matrix with the structure of a graph
+  template<typename Matrix_>
+  void check_structure(const Matrix_& matrix, const Adjacency::Graph& graph) const
+  {
+    TEST_CHECK_EQUAL(matrix.rows(), graph.get_num_nodes_domain());
+    TEST_CHECK_EQUAL(matrix.columns(), graph.get_num_nodes_image());
+    TEST_CHECK_EQUAL(matrix.used_elements(), graph.get_num_indices());
+    if(matrix.used_elements() != graph.get_num_indices())
+      return;
+
+    const IT_* row_ptr = matrix.row_ptr();
+    const IT_* col_idx = matrix.col_ind();
+    const Index* dom_ptr = graph.get_domain_ptr();
+    const Index* img_idx = graph.get_image_idx();
+    for(Index i(0); i <= graph.get_num_nodes_domain(); ++i)
+    {
+      TEST_CHECK_EQUAL(Index(row_ptr[i]), dom_ptr[i]);
+    }
+    for(Index k(0); k < graph.get_num_indices(); ++k)
+    {
+      TEST_CHECK_EQUAL(Index(col_idx[k]), img_idx[k]);
+    }
+
+    // all matrix entries must be zero
+    TEST_CHECK_EQUAL(matrix.norm_frobenius(), 0.0);
+  }
+
+  /// checks the dof-mapping renderer against the dof-mapping of the space
+  template<typename Space_>
+  void check_dof_mapping(const Space_& space) const
+  {
+    Adjacency::Graph graph = Space::DofMappingRenderer::render(space);
+    const Index num_cells = space.get_mesh().get_num_elements();
+    TEST_CHECK_EQUAL(graph.get_num_nodes_domain(), num_cells);
+    TEST_CHECK_EQUAL(graph.get_num_nodes_image(), space.get_num_dofs());
+    const Index* dom_ptr = graph.get_domain_ptr();
+    const Index* img_idx = graph.get_image_idx();
+    typename Space_::DofMappingType dof_map(space);
+    for(Index i(0); i < num_cells; ++i)
+    {
+      dof_map.prepare(i);
+      TEST_CHECK_EQUAL(dom_ptr[i+1] - dom_ptr[i], Index(dof_map.get_num_local_dofs()));
+      for(int j(0); j < dof_map.get_num_local_dofs(); ++j)
+      {
+        TEST_CHECK_EQUAL(img_idx[dom_ptr[i] + Index(j)], dof_map.get_index(j));
+      }
+      dof_map.finish();
+    }
+  }
+
+  void test_structures(Index level) const
+  {
+    Geometry::RefinedUnitCubeFactory<MeshType> coarse_factory(level);
+    MeshType coarse_mesh(coarse_factory);
+    Geometry::StandardRefinery<MeshType> refinery(coarse_mesh);
+    MeshType fine_mesh(refinery);
+
+    TrafoType coarse_trafo(coarse_mesh);
+    TrafoType fine_trafo(fine_mesh);
+    SpaceQ1 space_q1(fine_trafo);
+    SpaceQ2 space_q2(fine_trafo);
+    SpaceP0 space_p0(fine_trafo);
+    SpaceQ1 space_q1c(coarse_trafo);
+
+    check_dof_mapping(space_q1);
+    check_dof_mapping(space_q2);
+
+    MatrixCSR mat_csr;
+    MatrixBCSR mat_bcsr;
+
+    // standard structures
+    Adjacency::Graph graph_std1 = Assembly::SymbolicAssembler::assemble_graph_std1(space_q2);
+    Assembly::SymbolicAssembler::assemble_matrix_std1(mat_csr, space_q2);
+    check_structure(mat_csr, graph_std1);
+    Assembly::SymbolicAssembler::assemble_matrix_std1(mat_bcsr, space_q2);
+    check_structure(mat_bcsr, graph_std1);
+
+    Adjacency::Graph graph_std2 = Assembly::SymbolicAssembler::assemble_graph_std2(space_q2, space_p0);
+    Assembly::SymbolicAssembler::assemble_matrix_std2(mat_csr, space_q2, space_p0);
+    check_structure(mat_csr, graph_std2);
+    Assembly::SymbolicAssembler::assemble_matrix_std2(mat_bcsr, space_q2, space_p0);
+    check_structure(mat_bcsr, graph_std2);
+
+    // extended structures
+    Adjacency::Graph graph_ext_facet1 = Assembly::SymbolicAssembler::assemble_graph_ext_facet1(space_q1);
+    Assembly::SymbolicAssembler::assemble_matrix_ext_facet1(mat_csr, space_q1);
+    check_structure(mat_csr, graph_ext_facet1);
+
+    Adjacency::Graph graph_ext_node1 = Assembly::SymbolicAssembler::assemble_graph_ext_node1(space_q1);
+    Assembly::SymbolicAssembler::assemble_matrix_ext_node1(mat_csr, space_q1);
+    check_structure(mat_csr, graph_ext_node1);
+
+    // 2-level structure
+    Adjacency::Graph graph_2lvl = Assembly::SymbolicAssembler::assemble_graph_2lvl(space_q1, space_q1c);
+    Assembly::SymbolicAssembler::assemble_matrix_2lvl(mat_csr, space_q1, space_q1c);
+    check_structure(mat_csr, graph_2lvl);
+    Assembly::SymbolicAssembler::assemble_matrix_2lvl(mat_bcsr, space_q1, space_q1c);
+    check_structure(mat_bcsr, graph_2lvl);
+  }
+
+  virtual void run() const override
+  {
+    // the finer levels exceed the minimum number of rows for the parallel assembly
+    test_structures(Index(dim == 2 ? 2 : 1));
+    test_structures(Index(dim == 2 ? 5 : 3));
+  }
+};
+
+SymbolicAssemblerTest<Shape::Quadrilateral, std::uint32_t> symbolic_assembler_test_quad_uint32;
+SymbolicAssemblerTest<Shape::Quadrilateral, std::uint64_t> symbolic_assembler_test_quad_uint64;
+SymbolicAssemblerTest<Shape::Hexahedron, std::uint64_t> symbolic_assembler_test_hexa_uint64;
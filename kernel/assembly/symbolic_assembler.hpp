@@ -12,8 +12,14 @@
 #include <kernel/adjacency/graph.hpp>
 #include <kernel/space/dof_mapping_renderer.hpp>
 #include <kernel/lafem/null_matrix.hpp>
+#include <kernel/lafem/sparse_matrix_csr.hpp>
+#include <kernel/lafem/sparse_matrix_bcsr.hpp>
 #include <kernel/geometry/intern/coarse_fine_cell_mapping.hpp>
 
+// includes, system
+#include <algorithm>
+#include <vector>
+
 namespace FEAT
 {
   namespace Assembly
@@ -43,6 +49,19 @@ namespace FEAT
      *   This pattern is used for prolongation and restriction matrices in multigrid methods.
      *   The corresponding function is assemble_matrix_2lvl.
      *
+     * All of these patterns are the sorted composition of a dof-support graph, which maps each
+     * test dof onto the (extended) set of cells in its support, and a dof-mapping graph, which
+     * maps each (extended) cell onto its trial dofs. The assemble_matrix_* functions write this
+     * composition directly into the row-pointer and column-index arrays of SparseMatrixCSR and
+     * SparseMatrixBCSR objects by a thread-parallel two-pass algorithm, which first counts the
+     * number of non-zero entries per row and then fills in the column indices, so that the full
+     * pattern never has to be stored as an intermediate Adjacency::Graph.
+     *
+     * Each call allocates new index arrays. Blocks with identical patterns should therefore assemble
+     * the pattern only once and share it by LAFEM::CloneMode::Layout clones or by
+     * LAFEM::Container::share_indices(), as the Control system levels do; power meta-matrices keep
+     * the sharing of their blocks on conversion.
+     *
      * \author Peter Zajac
      */
     class SymbolicAssembler
@@ -60,21 +79,9 @@ namespace FEAT
       template<typename TestSpace_, typename TrialSpace_>
       static Adjacency::Graph assemble_graph_std2(const TestSpace_& test_space, const TrialSpace_& trial_space)
       {
-        // render dof-graphs
-        Adjacency::Graph test_dof_graph(Space::DofMappingRenderer::render(test_space));
-        Adjacency::Graph trial_dof_graph(Space::DofMappingRenderer::render(trial_space));
-
-        // check dimensions
-        XASSERTM(test_dof_graph.get_num_nodes_domain() == trial_dof_graph.get_num_nodes_domain(), "invalid test-/trial-space pair");
-
-        // render transposed test-dof-mapping
-        Adjacency::Graph test_dof_support(Adjacency::RenderType::transpose, test_dof_graph);
-
-        // render composite test-dof-mapping/trial-dof-support graph
-        Adjacency::Graph dof_adjactor(Adjacency::RenderType::injectify_sorted, test_dof_support, trial_dof_graph);
-
-        // return the graph
-        return dof_adjactor;
+        Adjacency::Graph graph_sup, graph_map;
+        _render_factors_std2(graph_sup, graph_map, test_space, trial_space);
+        return Adjacency::Graph(Adjacency::RenderType::injectify_sorted, graph_sup, graph_map);
       }
 
       /**
@@ -89,17 +96,9 @@ namespace FEAT
       template<typename Space_>
       static Adjacency::Graph assemble_graph_std1(const Space_& space)
       {
-        // create dof-mapping
-        Adjacency::Graph dof_graph(Space::DofMappingRenderer::render(space));
-
-        // render transposed dof-mapping
-        Adjacency::Graph dof_support(Adjacency::RenderType::transpose, dof_graph);
-
-        // render composite dof-mapping/dof-support graph
-        Adjacency::Graph dof_adjactor(Adjacency::RenderType::injectify_sorted, dof_support, dof_graph);
-
-        // return the graph
-        return dof_adjactor;
+        Adjacency::Graph graph_sup, graph_map;
+        _render_factors_std1(graph_sup, graph_map, space);
+        return Adjacency::Graph(Adjacency::RenderType::injectify_sorted, graph_sup, graph_map);
       }
 
       /**
@@ -114,37 +113,9 @@ namespace FEAT
       template<typename TestSpace_, typename TrialSpace_>
       static Adjacency::Graph assemble_graph_ext_facet2(const TestSpace_& test_space, const TrialSpace_& trial_space)
       {
-        // render dof-graphs
-        Adjacency::Graph test_dof_graph(Space::DofMappingRenderer::render(test_space));
-        Adjacency::Graph trial_dof_graph(Space::DofMappingRenderer::render(trial_space));
-
-        // check dimensions
-        XASSERTM(test_dof_graph.get_num_nodes_domain() == trial_dof_graph.get_num_nodes_domain(), "invalid test-/trial-space pair");
-
-        // get the shape dimension
-        typedef typename TestSpace_::ShapeType ShapeType;
-        static constexpr Index shape_dim = Index(ShapeType::dimension);
-
-        // get the facet index set
-        const auto& facet_at_shape = test_space.get_trafo().get_mesh().template get_index_set<shape_dim, shape_dim-1>();
-
-        // transpose to get the facet support
-        Adjacency::Graph shape_at_facet(Adjacency::RenderType::transpose, facet_at_shape);
-
-        // render transposed test-dof-mapping
-        Adjacency::Graph test_dof_support(Adjacency::RenderType::transpose, test_dof_graph);
-
-        // render extended test-dof-support
-        Adjacency::Graph test_dof_ext_sup(Adjacency::RenderType::injectify, test_dof_support, facet_at_shape);
-
-        // render extended trial-dof-mapping
-        Adjacency::Graph trial_dof_ext_graph(Adjacency::RenderType::injectify, shape_at_facet, trial_dof_graph);
-
-        // render composite test-dof-mapping/trial-dof-support graph
-        Adjacency::Graph dof_adjactor(Adjacency::RenderType::injectify_sorted, test_dof_ext_sup, trial_dof_ext_graph);
-
-        // return the graph
-        return dof_adjactor;
+        Adjacency::Graph graph_sup, graph_map;
+        _render_factors_ext_facet2(graph_sup, graph_map, test_space, trial_space);
+        return Adjacency::Graph(Adjacency::RenderType::injectify_sorted, graph_sup, graph_map);
       }
 
       /**
@@ -159,30 +130,9 @@ namespace FEAT
       template<typename Space_>
       static Adjacency::Graph assemble_graph_ext_facet1(const Space_& space)
       {
-        // create dof-mapping
-        Adjacency::Graph dof_graph(Space::DofMappingRenderer::render(space));
-
-        // get the shape dimension
-        typedef typename Space_::ShapeType ShapeType;
-        static constexpr Index shape_dim = Index(ShapeType::dimension);
-
-        // get the facet index set
-        const auto& facet_at_shape = space.get_trafo().get_mesh().template get_index_set<shape_dim, shape_dim-1>();
-
-        // transpose to get the facet support
-        Adjacency::Graph shape_at_facet(Adjacency::RenderType::transpose, facet_at_shape);
-
-        // render extended dof-mapping
-        Adjacency::Graph dof_ext_graph(Adjacency::RenderType::injectify, shape_at_facet, dof_graph);
-
-        // render transposed extended dof-mapping
-        Adjacency::Graph dof_ext_sup(Adjacency::RenderType::transpose, dof_ext_graph);
-
-        // render composite dof-mapping/dof-support graph
-        Adjacency::Graph dof_adjactor(Adjacency::RenderType::injectify_sorted, dof_ext_sup, dof_ext_graph);
-
-        // return the graph
-        return dof_adjactor;
+        Adjacency::Graph graph_sup, graph_map;
+        _render_factors_ext_facet1(graph_sup, graph_map, space);
+        return Adjacency::Graph(Adjacency::RenderType::injectify_sorted, graph_sup, graph_map);
       }
 
       /**
@@ -197,37 +147,9 @@ namespace FEAT
       template<typename TestSpace_, typename TrialSpace_>
       static Adjacency::Graph assemble_graph_ext_node2(const TestSpace_& test_space, const TrialSpace_& trial_space)
       {
-        // render dof-graphs
-        Adjacency::Graph test_dof_graph(Space::DofMappingRenderer::render(test_space));
-        Adjacency::Graph trial_dof_graph(Space::DofMappingRenderer::render(trial_space));
-
-        // check dimensions
-        XASSERTM(test_dof_graph.get_num_nodes_domain() == trial_dof_graph.get_num_nodes_domain(), "invalid test-/trial-space pair");
-
-        // get the shape dimension
-        typedef typename TestSpace_::ShapeType ShapeType;
-        static constexpr Index shape_dim = Index(ShapeType::dimension);
-
-        // get the facet index set
-        const auto& facet_at_shape = test_space.get_trafo().get_mesh().template get_index_set<shape_dim, 0>();
-
-        // transpose to get the facet support
-        Adjacency::Graph shape_at_facet(Adjacency::RenderType::transpose, facet_at_shape);
-
-        // render transposed test-dof-mapping
-        Adjacency::Graph test_dof_support(Adjacency::RenderType::transpose, test_dof_graph);
-
-        // render extended test-dof-support
-        Adjacency::Graph test_dof_ext_sup(Adjacency::RenderType::injectify, test_dof_support, facet_at_shape);
-
-        // render extended trial-dof-mapping
-        Adjacency::Graph trial_dof_ext_graph(Adjacency::RenderType::injectify, shape_at_facet, trial_dof_graph);
-
-        // render composite test-dof-mapping/trial-dof-support graph
-        Adjacency::Graph dof_adjactor(Adjacency::RenderType::injectify_sorted, test_dof_ext_sup, trial_dof_ext_graph);
-
-        // return the graph
-        return dof_adjactor;
+        Adjacency::Graph graph_sup, graph_map;
+        _render_factors_ext_node2(graph_sup, graph_map, test_space, trial_space);
+        return Adjacency::Graph(Adjacency::RenderType::injectify_sorted, graph_sup, graph_map);
       }
 
       /**
@@ -242,30 +164,9 @@ namespace FEAT
       template<typename Space_>
       static Adjacency::Graph assemble_graph_ext_node1(const Space_& space)
       {
-        // create dof-mapping
-        Adjacency::Graph dof_graph(Space::DofMappingRenderer::render(space));
-
-        // get the shape dimension
-        typedef typename Space_::ShapeType ShapeType;
-        static constexpr Index shape_dim = Index(ShapeType::dimension);
-
-        // get the facet index set
-        const auto& facet_at_shape = space.get_trafo().get_mesh().template get_index_set<shape_dim, 0>();
-
-        // transpose to get the facet support
-        Adjacency::Graph shape_at_facet(Adjacency::RenderType::transpose, facet_at_shape);
-
-        // render extended dof-mapping
-        Adjacency::Graph dof_ext_graph(Adjacency::RenderType::injectify, shape_at_facet, dof_graph);
-
-        // render transposed extended dof-mapping
-        Adjacency::Graph dof_ext_sup(Adjacency::RenderType::transpose, dof_ext_graph);
-
-        // render composite dof-mapping/dof-support graph
-        Adjacency::Graph dof_adjactor(Adjacency::RenderType::injectify_sorted, dof_ext_sup, dof_ext_graph);
-
-        // return the graph
-        return dof_adjactor;
+        Adjacency::Graph graph_sup, graph_map;
+        _render_factors_ext_node1(graph_sup, graph_map, space);
+        return Adjacency::Graph(Adjacency::RenderType::injectify_sorted, graph_sup, graph_map);
       }
 
       /**
@@ -319,65 +220,9 @@ namespace FEAT
         const FineTestSpace_& fine_space,
         const CoarseTrialSpace_& coarse_space)
       {
-        // create test- and trial-dof-mappers
-        Adjacency::Graph test_dof_mapping(Space::DofMappingRenderer::render(fine_space));
-        Adjacency::Graph trial_dof_mapping(Space::DofMappingRenderer::render(coarse_space));
-
-        // create an refinement adjactor
-        Geometry::Intern::CoarseFineCellMapping<typename FineTestSpace_::MeshType, typename CoarseTrialSpace_::MeshType>
-            refine_adjactor(fine_space.get_trafo().get_mesh(), coarse_space.get_trafo().get_mesh());
-
-        // get coarse and fine mesh permutations
-        const Adjacency::Permutation& coarse_perm =
-          coarse_space.get_trafo().get_mesh().get_mesh_permutation().get_perm();
-        const Adjacency::Permutation& fine_inv_perm =
-          fine_space.get_trafo().get_mesh().get_mesh_permutation().get_inv_perm();
-        if(!coarse_perm.empty() || !fine_inv_perm.empty())
-        {
-          // render refinement adjactor
-          Adjacency::Graph refine_graph(Adjacency::RenderType::as_is, refine_adjactor);
-
-          // permute refinement graph indices
-          Adjacency::Graph permuted_graph;
-          if(coarse_perm.empty())
-          {
-            // no coarse permutation, only fine mesh permuted
-            permuted_graph = std::move(refine_graph);
-            permuted_graph.permute_indices(fine_inv_perm);
-          }
-          else if(fine_inv_perm.empty())
-          {
-            // no fine permutation, only coarse mesh permuted
-            // create a dummy identity permutation for the fine mesh
-            Adjacency::Permutation id_perm(refine_graph.get_num_nodes_image(), Adjacency::Permutation::type_identity);
-            permuted_graph = Adjacency::Graph(refine_graph, coarse_perm, id_perm);
-          }
-          else
-          {
-            // both coarse and fine permutations exist
-            permuted_graph = Adjacency::Graph(refine_graph, coarse_perm, fine_inv_perm);
-          }
-
-          // render transposed test-dof-mapping
-          Adjacency::Graph test_dof_support(Adjacency::RenderType::injectify_transpose, permuted_graph, test_dof_mapping);
-
-          // render composite test-dof-mapping/trial-dof-support graph
-          Adjacency::Graph dof_adjactor(Adjacency::RenderType::injectify_sorted, test_dof_support, trial_dof_mapping);
-
-          // return the graph
-          return dof_adjactor;
-        }
-        else // no permutation
-        {
-          // render transposed test-dof-mapping
-          Adjacency::Graph test_dof_support(Adjacency::RenderType::injectify_transpose, refine_adjactor, test_dof_mapping);
-
-          // render composite test-dof-mapping/trial-dof-support graph
-          Adjacency::Graph dof_adjactor(Adjacency::RenderType::injectify_sorted, test_dof_support, trial_dof_mapping);
-
-          // return the graph
-          return dof_adjactor;
-        }
+        Adjacency::Graph graph_sup, graph_map;
+        _render_factors_2lvl(graph_sup, graph_map, fine_space, coarse_space);
+        return Adjacency::Graph(Adjacency::RenderType::injectify_sorted, graph_sup, graph_map);
       }
 
       /**
@@ -393,7 +238,9 @@ namespace FEAT
       static void assemble_matrix_std2(MatrixType_ & matrix,
         const TestSpace_& test_space, const TrialSpace_& trial_space)
       {
-        matrix = MatrixType_(assemble_graph_std2(test_space, trial_space));
+        Adjacency::Graph graph_sup, graph_map;
+        _render_factors_std2(graph_sup, graph_map, test_space, trial_space);
+        _assemble_composite(matrix, graph_sup, graph_map);
       }
 
       /// specialization for NullMatrix
@@ -418,7 +265,9 @@ namespace FEAT
       template<typename MatrixType_, typename Space_>
       static void assemble_matrix_std1(MatrixType_ & matrix, const Space_& space)
       {
-        matrix = MatrixType_(assemble_graph_std1(space));
+        Adjacency::Graph graph_sup, graph_map;
+        _render_factors_std1(graph_sup, graph_map, space);
+        _assemble_composite(matrix, graph_sup, graph_map);
       }
 
       /// specialization for NullMatrix
@@ -443,7 +292,9 @@ namespace FEAT
       static void assemble_matrix_ext_facet2(MatrixType_ & matrix,
         const TestSpace_& test_space, const TrialSpace_& trial_space)
       {
-        matrix = MatrixType_(assemble_graph_ext_facet2(test_space, trial_space));
+        Adjacency::Graph graph_sup, graph_map;
+        _render_factors_ext_facet2(graph_sup, graph_map, test_space, trial_space);
+        _assemble_composite(matrix, graph_sup, graph_map);
       }
 
       /**
@@ -458,7 +309,9 @@ namespace FEAT
       template<typename MatrixType_, typename Space_>
       static void assemble_matrix_ext_facet1(MatrixType_ & matrix, const Space_& space)
       {
-        matrix = MatrixType_(assemble_graph_ext_facet1(space));
+        Adjacency::Graph graph_sup, graph_map;
+        _render_factors_ext_facet1(graph_sup, graph_map, space);
+        _assemble_composite(matrix, graph_sup, graph_map);
       }
 
       /**
@@ -474,7 +327,9 @@ namespace FEAT
       static void assemble_matrix_ext_node2(MatrixType_ & matrix,
         const TestSpace_& test_space, const TrialSpace_& trial_space)
       {
-        matrix = MatrixType_(assemble_graph_ext_node2(test_space, trial_space));
+        Adjacency::Graph graph_sup, graph_map;
+        _render_factors_ext_node2(graph_sup, graph_map, test_space, trial_space);
+        _assemble_composite(matrix, graph_sup, graph_map);
       }
 
       /**
@@ -489,7 +344,9 @@ namespace FEAT
       template<typename MatrixType_, typename Space_>
       static void assemble_matrix_ext_node1(MatrixType_ & matrix, const Space_& space)
       {
-        matrix = MatrixType_(assemble_graph_ext_node1(space));
+        Adjacency::Graph graph_sup, graph_map;
+        _render_factors_ext_node1(graph_sup, graph_map, space);
+        _assemble_composite(matrix, graph_sup, graph_map);
       }
 
       /**
@@ -525,7 +382,382 @@ namespace FEAT
       static void assemble_matrix_2lvl(MatrixType_ & matrix,
         const FineSpace_& fine_space, const CoarseSpace_& coarse_space)
       {
-        matrix = MatrixType_(assemble_graph_2lvl(fine_space, coarse_space));
+        Adjacency::Graph graph_sup, graph_map;
+        _render_factors_2lvl(graph_sup, graph_map, fine_space, coarse_space);
+        _assemble_composite(matrix, graph_sup, graph_map);
+      }
+
+    protected:
+      /// renders the dof-support and dof-mapping graphs of the standard pattern for a test-/trial-space pair
+      template<typename TestSpace_, typename TrialSpace_>
+      static void _render_factors_std2(Adjacency::Graph& graph_sup, Adjacency::Graph& graph_map,
+        const TestSpace_& test_space, const TrialSpace_& trial_space)
+      {
+        // render dof-graphs
+        Adjacency::Graph test_dof_graph(Space::DofMappingRenderer::render(test_space));
+        Adjacency::Graph trial_dof_graph(Space::DofMappingRenderer::render(trial_space));
+
+        // check dimensions
+        XASSERTM(test_dof_graph.get_num_nodes_domain() == trial_dof_graph.get_num_nodes_domain(), "invalid test-/trial-space pair");
+
+        // render transposed test-dof-mapping
+        Adjacency::Graph test_dof_support(Adjacency::RenderType::transpose, test_dof_graph);
+
+        // return the dof-support and dof-mapping graphs
+        graph_sup = std::move(test_dof_support);
+        graph_map = std::move(trial_dof_graph);
+      }
+
+      /// renders the dof-support and dof-mapping graphs of the standard pattern for a single space
+      template<typename Space_>
+      static void _render_factors_std1(Adjacency::Graph& graph_sup, Adjacency::Graph& graph_map,
+        const Space_& space)
+      {
+        // create dof-mapping
+        Adjacency::Graph dof_graph(Space::DofMappingRenderer::render(space));
+
+        // render transposed dof-mapping
+        Adjacency::Graph dof_support(Adjacency::RenderType::transpose, dof_graph);
+
+        // return the dof-support and dof-mapping graphs
+        graph_sup = std::move(dof_support);
+        graph_map = std::move(dof_graph);
+      }
+
+      /// renders the dof-support and dof-mapping graphs of the extended-facet pattern for a test-/trial-space pair
+      template<typename TestSpace_, typename TrialSpace_>
+      static void _render_factors_ext_facet2(Adjacency::Graph& graph_sup, Adjacency::Graph& graph_map,
+        const TestSpace_& test_space, const TrialSpace_& trial_space)
+      {
+        // render dof-graphs
+        Adjacency::Graph test_dof_graph(Space::DofMappingRenderer::render(test_space));
+        Adjacency::Graph trial_dof_graph(Space::DofMappingRenderer::render(trial_space));
+
+        // check dimensions
+        XASSERTM(test_dof_graph.get_num_nodes_domain() == trial_dof_graph.get_num_nodes_domain(), "invalid test-/trial-space pair");
+
+        // get the shape dimension
+        typedef typename TestSpace_::ShapeType ShapeType;
+        static constexpr Index shape_dim = Index(ShapeType::dimension);
+
+        // get the facet index set
+        const auto& facet_at_shape = test_space.get_trafo().get_mesh().template get_index_set<shape_dim, shape_dim-1>();
+
+        // transpose to get the facet support
+        Adjacency::Graph shape_at_facet(Adjacency::RenderType::transpose, facet_at_shape);
+
+        // render transposed test-dof-mapping
+        Adjacency::Graph test_dof_support(Adjacency::RenderType::transpose, test_dof_graph);
+
+        // render extended test-dof-support
+        Adjacency::Graph test_dof_ext_sup(Adjacency::RenderType::injectify, test_dof_support, facet_at_shape);
+
+        // render extended trial-dof-mapping
+        Adjacency::Graph trial_dof_ext_graph(Adjacency::RenderType::injectify, shape_at_facet, trial_dof_graph);
+
+        // return the dof-support and dof-mapping graphs
+        graph_sup = std::move(test_dof_ext_sup);
+        graph_map = std::move(trial_dof_ext_graph);
+      }
+
+      /// renders the dof-support and dof-mapping graphs of the extended-facet pattern for a single space
+      template<typename Space_>
+      static void _render_factors_ext_facet1(Adjacency::Graph& graph_sup, Adjacency::Graph& graph_map,
+        const Space_& space)
+      {
+        // create dof-mapping
+        Adjacency::Graph dof_graph(Space::DofMappingRenderer::render(space));
+
+        // get the shape dimension
+        typedef typename Space_::ShapeType ShapeType;
+        static constexpr Index shape_dim = Index(ShapeType::dimension);
+
+        // get the facet index set
+        const auto& facet_at_shape = space.get_trafo().get_mesh().template get_index_set<shape_dim, shape_dim-1>();
+
+        // transpose to get the facet support
+        Adjacency::Graph shape_at_facet(Adjacency::RenderType::transpose, facet_at_shape);
+
+        // render extended dof-mapping
+        Adjacency::Graph dof_ext_graph(Adjacency::RenderType::injectify, shape_at_facet, dof_graph);
+
+        // render transposed extended dof-mapping
+        Adjacency::Graph dof_ext_sup(Adjacency::RenderType::transpose, dof_ext_graph);
+
+        // return the dof-support and dof-mapping graphs
+        graph_sup = std::move(dof_ext_sup);
+        graph_map = std::move(dof_ext_graph);
+      }
+
+      /// renders the dof-support and dof-mapping graphs of the extended-node pattern for a test-/trial-space pair
+      template<typename TestSpace_, typename TrialSpace_>
+      static void _render_factors_ext_node2(Adjacency::Graph& graph_sup, Adjacency::Graph& graph_map,
+        const TestSpace_& test_space, const TrialSpace_& trial_space)
+      {
+        // render dof-graphs
+        Adjacency::Graph test_dof_graph(Space::DofMappingRenderer::render(test_space));
+        Adjacency::Graph trial_dof_graph(Space::DofMappingRenderer::render(trial_space));
+
+        // check dimensions
+        XASSERTM(test_dof_graph.get_num_nodes_domain() == trial_dof_graph.get_num_nodes_domain(), "invalid test-/trial-space pair");
+
+        // get the shape dimension
+        typedef typename TestSpace_::ShapeType ShapeType;
+        static constexpr Index shape_dim = Index(ShapeType::dimension);
+
+        // get the facet index set
+        const auto& facet_at_shape = test_space.get_trafo().get_mesh().template get_index_set<shape_dim, 0>();
+
+        // transpose to get the facet support
+        Adjacency::Graph shape_at_facet(Adjacency::RenderType::transpose, facet_at_shape);
+
+        // render transposed test-dof-mapping
+        Adjacency::Graph test_dof_support(Adjacency::RenderType::transpose, test_dof_graph);
+
+        // render extended test-dof-support
+        Adjacency::Graph test_dof_ext_sup(Adjacency::RenderType::injectify, test_dof_support, facet_at_shape);
+
+        // render extended trial-dof-mapping
+        Adjacency::Graph trial_dof_ext_graph(Adjacency::RenderType::injectify, shape_at_facet, trial_dof_graph);
+
+        // return the dof-support and dof-mapping graphs
+        graph_sup = std::move(test_dof_ext_sup);
+        graph_map = std::move(trial_dof_ext_graph);
+      }
+
+      /// renders the dof-support and dof-mapping graphs of the extended-node pattern for a single space
+      template<typename Space_>
+      static void _render_factors_ext_node1(Adjacency::Graph& graph_sup, Adjacency::Graph& graph_map,
+        const Space_& space)
+      {
+        // create dof-mapping
+        Adjacency::Graph dof_graph(Space::DofMappingRenderer::render(space));
+
+        // get the shape dimension
+        typedef typename Space_::ShapeType ShapeType;
+        static constexpr Index shape_dim = Index(ShapeType::dimension);
+
+        // get the facet index set
+        const auto& facet_at_shape = space.get_trafo().get_mesh().template get_index_set<shape_dim, 0>();
+
+        // transpose to get the facet support
+        Adjacency::Graph shape_at_facet(Adjacency::RenderType::transpose, facet_at_shape);
+
+        // render extended dof-mapping
+        Adjacency::Graph dof_ext_graph(Adjacency::RenderType::injectify, shape_at_facet, dof_graph);
+
+        // render transposed extended dof-mapping
+        Adjacency::Graph dof_ext_sup(Adjacency::RenderType::transpose, dof_ext_graph);
+
+        // return the dof-support and dof-mapping graphs
+        graph_sup = std::move(dof_ext_sup);
+        graph_map = std::move(dof_ext_graph);
+      }
+
+      /// renders the dof-support and dof-mapping graphs of the 2-level pattern
+      template<typename FineTestSpace_, typename CoarseTrialSpace_>
+      static void _render_factors_2lvl(Adjacency::Graph& graph_sup, Adjacency::Graph& graph_map,
+        const FineTestSpace_& fine_space, const CoarseTrialSpace_& coarse_space)
+      {
+        // create test- and trial-dof-mappers
+        Adjacency::Graph test_dof_mapping(Space::DofMappingRenderer::render(fine_space));
+        Adjacency::Graph trial_dof_mapping(Space::DofMappingRenderer::render(coarse_space));
+
+        // create an refinement adjactor
+        Geometry::Intern::CoarseFineCellMapping<typename FineTestSpace_::MeshType, typename CoarseTrialSpace_::MeshType>
+            refine_adjactor(fine_space.get_trafo().get_mesh(), coarse_space.get_trafo().get_mesh());
+
+        // get coarse and fine mesh permutations
+        const Adjacency::Permutation& coarse_perm =
+          coarse_space.get_trafo().get_mesh().get_mesh_permutation().get_perm();
+        const Adjacency::Permutation& fine_inv_perm =
+          fine_space.get_trafo().get_mesh().get_mesh_permutation().get_inv_perm();
+        if(!coarse_perm.empty() || !fine_inv_perm.empty())
+        {
+          // render refinement adjactor
+          Adjacency::Graph refine_graph(Adjacency::RenderType::as_is, refine_adjactor);
+
+          // permute refinement graph indices
+          Adjacency::Graph permuted_graph;
+          if(coarse_perm.empty())
+          {
+            // no coarse permutation, only fine mesh permuted
+            permuted_graph = std::move(refine_graph);
+            permuted_graph.permute_indices(fine_inv_perm);
+          }
+          else if(fine_inv_perm.empty())
+          {
+            // no fine permutation, only coarse mesh permuted
+            // create a dummy identity permutation for the fine mesh
+            Adjacency::Permutation id_perm(refine_graph.get_num_nodes_image(), Adjacency::Permutation::type_identity);
+            permuted_graph = Adjacency::Graph(refine_graph, coarse_perm, id_perm);
+          }
+          else
+          {
+            // both coarse and fine permutations exist
+            permuted_graph = Adjacency::Graph(refine_graph, coarse_perm, fine_inv_perm);
+          }
+
+          // render transposed test-dof-mapping
+          Adjacency::Graph test_dof_support(Adjacency::RenderType::injectify_transpose, permuted_graph, test_dof_mapping);
+
+          // return the dof-support and dof-mapping graphs
+          graph_sup = std::move(test_dof_support);
+          graph_map = std::move(trial_dof_mapping);
+        }
+        else // no permutation
+        {
+          // render transposed test-dof-mapping
+          Adjacency::Graph test_dof_support(Adjacency::RenderType::injectify_transpose, refine_adjactor, test_dof_mapping);
+
+          // return the dof-support and dof-mapping graphs
+          graph_sup = std::move(test_dof_support);
+          graph_map = std::move(trial_dof_mapping);
+        }
+      }
+
+      /// minimum number of rows for the parallel composition
+      static constexpr Index _min_parallel_rows = Index(4096);
+
+      /**
+       * \brief Computes the sorted composite adjacency structure of two graphs
+       *
+       * This function computes the row-pointer and column-index arrays of the injectified and
+       * sorted composition of two graphs by a two-pass algorithm: the first pass counts the number
+       * of adjacencies of each row and the second pass fills in and sorts the column indices. The
+       * rows are distributed over all OpenMP threads in both passes and each thread uses its own
+       * column mask, so the result is identical to the one rendered by Adjacency::Graph with
+       * RenderType::injectify_sorted.
+       *
+       * \param[out] row_ptr, col_idx
+       * The \transient row-pointer and column-index arrays that receive the composite structure.
+       *
+       * \param[in] graph_a, graph_b
+       * The \transient graphs whose composition is to be computed.
+       */
+      template<typename IT_>
+      static void _compose_sorted(LAFEM::DenseVector<IT_, IT_>& row_ptr, LAFEM::DenseVector<IT_, IT_>& col_idx,
+        const Adjacency::Graph& graph_a, const Adjacency::Graph& graph_b)
+      {
+        XASSERTM(graph_a.get_num_nodes_image() == graph_b.get_num_nodes_domain(), "graph dimension mismatch");
+
+        const Index num_rows = graph_a.get_num_nodes_domain();
+        const Index num_cols = graph_b.get_num_nodes_image();
+        const Index* a_ptr = graph_a.get_domain_ptr();
+        const Index* a_idx = graph_a.get_image_idx();
+        const Index* b_ptr = graph_b.get_domain_ptr();
+        const Index* b_idx = graph_b.get_image_idx();
+
+        row_ptr = LAFEM::DenseVector<IT_, IT_>(num_rows + Index(1));
+        IT_* rp = row_ptr.elements();
+        rp[0] = IT_(0);
+
+        // first pass: count the number of non-zero entries in each row
+        FEAT_PRAGMA_OMP(parallel if(num_rows >= _min_parallel_rows))
+        {
+          std::vector<char> vmask(num_cols, 0);
+          char* mask = vmask.data();
+
+          FEAT_PRAGMA_OMP(for schedule(dynamic, 1024))
+          for(Index i = 0; i < num_rows; ++i)
+          {
+            Index count(0);
+            for(Index k(a_ptr[i]); k < a_ptr[i+1]; ++k)
+            {
+              for(Index l(b_ptr[a_idx[k]]); l < b_ptr[a_idx[k]+1]; ++l)
+              {
+                if(mask[b_idx[l]] == 0)
+                {
+                  mask[b_idx[l]] = 1;
+                  ++count;
+                }
+              }
+            }
+            for(Index k(a_ptr[i]); k < a_ptr[i+1]; ++k)
+              for(Index l(b_ptr[a_idx[k]]); l < b_ptr[a_idx[k]+1]; ++l)
+                mask[b_idx[l]] = 0;
+            rp[i+1] = IT_(count);
+          }
+        }
+
+        // build row-pointer array and allocate column-index array
+        for(Index i(0); i < num_rows; ++i)
+          rp[i+1] += rp[i];
+        const Index num_nze = Index(rp[num_rows]);
+        col_idx = LAFEM::DenseVector<IT_, IT_>(num_nze);
+        if(num_nze == Index(0))
+          return;
+        IT_* ci = col_idx.elements();
+
+        // second pass: fill in and sort the column indices of each row
+        FEAT_PRAGMA_OMP(parallel if(num_rows >= _min_parallel_rows))
+        {
+          std::vector<char> vmask(num_cols, 0);
+          char* mask = vmask.data();
+
+          FEAT_PRAGMA_OMP(for schedule(dynamic, 1024))
+          for(Index i = 0; i < num_rows; ++i)
+          {
+            IT_ pos = rp[i];
+            for(Index k(a_ptr[i]); k < a_ptr[i+1]; ++k)
+            {
+              for(Index l(b_ptr[a_idx[k]]); l < b_ptr[a_idx[k]+1]; ++l)
+              {
+                if(mask[b_idx[l]] == 0)
+                {
+                  mask[b_idx[l]] = 1;
+                  ci[pos++] = IT_(b_idx[l]);
+                }
+              }
+            }
+            for(IT_ j(rp[i]); j < rp[i+1]; ++j)
+              mask[ci[j]] = 0;
+            std::sort(&ci[rp[i]], &ci[rp[i+1]]);
+          }
+        }
+      }
+
+      /// assembles a matrix structure from the composition of a dof-support and a dof-mapping graph
+      template<typename MatrixType_>
+      static void _assemble_composite(MatrixType_& matrix, const Adjacency::Graph& graph_sup, const Adjacency::Graph& graph_map)
+      {
+        matrix = MatrixType_(Adjacency::Graph(Adjacency::RenderType::injectify_sorted, graph_sup, graph_map));
+      }
+
+      /// assembles a CSR matrix structure directly without rendering the composite graph
+      template<typename DT_, typename IT_>
+      static void _assemble_composite(LAFEM::SparseMatrixCSR<DT_, IT_>& matrix,
+        const Adjacency::Graph& graph_sup, const Adjacency::Graph& graph_map)
+      {
+        const Index num_rows = graph_sup.get_num_nodes_domain();
+        const Index num_cols = graph_map.get_num_nodes_image();
+        LAFEM::DenseVector<IT_, IT_> row_ptr, col_idx;
+        _compose_sorted(row_ptr, col_idx, graph_sup, graph_map);
+        if(col_idx.size() == Index(0))
+        {
+          matrix = LAFEM::SparseMatrixCSR<DT_, IT_>(num_rows, num_cols);
+          return;
+        }
+        LAFEM::DenseVector<DT_, IT_> val(col_idx.size(), DT_(0));
+        matrix = LAFEM::SparseMatrixCSR<DT_, IT_>(num_rows, num_cols, col_idx, val, row_ptr);
+      }
+
+      /// assembles a BCSR matrix structure directly without rendering the composite graph
+      template<typename DT_, typename IT_, int BH_, int BW_>
+      static void _assemble_composite(LAFEM::SparseMatrixBCSR<DT_, IT_, BH_, BW_>& matrix,
+        const Adjacency::Graph& graph_sup, const Adjacency::Graph& graph_map)
+      {
+        const Index num_rows = graph_sup.get_num_nodes_domain();
+        const Index num_cols = graph_map.get_num_nodes_image();
+        LAFEM::DenseVector<IT_, IT_> row_ptr, col_idx;
+        _compose_sorted(row_ptr, col_idx, graph_sup, graph_map);
+        if(col_idx.size() == Index(0))
+        {
+          matrix = LAFEM::SparseMatrixBCSR<DT_, IT_, BH_, BW_>(num_rows, num_cols);
+          return;
+        }
+        LAFEM::DenseVector<DT_, IT_> val(col_idx.size() * Index(BH_*BW_), DT_(0));
+        matrix = LAFEM::SparseMatrixBCSR<DT_, IT_, BH_, BW_>(num_rows, num_cols, col_idx, val, row_ptr);
       }
     }; // class SymbolicAssembler
   } // namespace Assembly
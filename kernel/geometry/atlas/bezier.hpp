@@ -145,6 +145,8 @@ namespace FEAT
          */
         void push_vertex(const WorldPoint& point)
         {
+          ++this->_version;
+
           // update vertex pointer
           _vtx_ptr.push_back(_world.size());
           _world.push_back(point);
@@ -158,6 +160,7 @@ namespace FEAT
          */
         void push_control(const WorldPoint& point)
         {
+          ++this->_version;
           _world.push_back(point);
         }
 
@@ -169,6 +172,7 @@ namespace FEAT
          */
         void push_param(const ParamPoint& param)
         {
+          ++this->_version;
           this->_param.push_back(param);
         }
 
@@ -177,6 +181,7 @@ namespace FEAT
          */
         void push_close()
         {
+          ++this->_version;
           this->_closed = true;
         }
 
@@ -210,6 +215,7 @@ namespace FEAT
         {
           XASSERTM(Math::abs(ori) == 1, "invalid orientation; must be +1 or -1");
           this->_orientation = ori;
+          ++this->_version;
         }
 
         /**
@@ -266,6 +272,8 @@ namespace FEAT
         /// \copydoc ChartBase:transform()
         virtual void transform(const WorldPoint& origin, const WorldPoint& angles, const WorldPoint& offset) override
         {
+          ++this->_version;
+
           // create rotation matrix
           Tiny::Matrix<DataType, 2, 2> rot;
           rot.set_rotation_2d(angles(0));
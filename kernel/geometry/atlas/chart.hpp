@@ -44,10 +44,26 @@ namespace FEAT
         /// out coordinate type
         typedef typename VertexSetType::CoordType CoordType;
 
+      protected:
+        /// modification counter of this chart
+        std::uint64_t _version = 0u;
+
       public:
         /// virtual DTOR
         virtual ~ChartBase() {}
 
+        /**
+         * \brief Returns the modification counter of this chart.
+         *
+         * The version is incremented by each function that modifies the chart geometry, e.g. by
+         * transform(), so that precomputed data which depends on the chart, e.g. the geometry
+         * cache of an isoparametric trafo, can detect chart modifications.
+         */
+        std::uint64_t get_version() const
+        {
+          return _version;
+        }
+
         /// \returns The size of dynamically allocated memory in bytes.
         virtual std::size_t bytes() const
         {
@@ -188,6 +204,25 @@ namespace FEAT
          */
         virtual CoordType signed_dist(const WorldPoint& point, WorldPoint& grad_dist) const = 0;
 
+        /**
+         * \brief Computes a bounding box of the chart
+         *
+         * If this function returns a non-zero value, then the signed distance of all points which are
+         * outside of the bounding box is non-zero and has the sign of the returned value, so that e.g.
+         * hit-tests can classify these points without computing their signed distances.
+         *
+         * \param[out] box_min, box_max
+         * The minimum and maximum corners of the bounding box.
+         *
+         * \returns
+         * The sign of the signed distance outside of the bounding box or 0, if the chart does not provide
+         * a bounding box.
+         */
+        virtual int get_bounding_box(WorldPoint& DOXY(box_min), WorldPoint& DOXY(box_max)) const
+        {
+          return 0;
+        }
+
         /**
          * \brief Writes the type as String
          *
@@ -422,6 +457,9 @@ namespace FEAT
           // ensure that the mesh world dimension is compatible
           XASSERTM(MeshType::world_dim == world_dim, "Mesh/Chart world dimension mismatch");
 
+          // the adaption modifies the vertex coordinates
+          mesh.touch_vertices();
+
           // Try to adapt explicitly
           if(Intern::ExplicitChartHelper<is_explicit>::adapt(cast(), mesh, part))
             return;
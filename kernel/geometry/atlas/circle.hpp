@@ -129,9 +129,23 @@ namespace FEAT
           return _have_domain;
         }
 
+        /// \copydoc ChartBase::get_bounding_box()
+        virtual int get_bounding_box(WorldPoint& box_min, WorldPoint& box_max) const override
+        {
+          for(int i(0); i < WorldPoint::n; ++i)
+          {
+            box_min[i] = _midpoint[i] - _radius;
+            box_max[i] = _midpoint[i] + _radius;
+          }
+          // the signed distance is negative outside of the circle
+          return -1;
+        }
+
         /// \copydoc ChartBase:transform()
         virtual void transform(const WorldPoint& origin, const WorldPoint& angles, const WorldPoint& offset) override
         {
+          ++this->_version;
+
           // create rotation matrix
           Tiny::Matrix<CoordType, 2, 2> rot;
           rot.set_rotation_2d(angles(0));
@@ -83,12 +83,14 @@ namespace FEAT
 
         void set_origin(CoordType x, CoordType y)
         {
+          ++this->_version;
           _origin[0] = x;
           _origin[1] = y;
         }
 
         void set_offset(CoordType x, CoordType y, CoordType z)
         {
+          ++this->_version;
           _offset[0] = x;
           _offset[1] = y;
           _offset[2] = z;
@@ -96,11 +98,13 @@ namespace FEAT
 
         void set_angles(CoordType yaw, CoordType pitch, CoordType roll)
         {
+          ++this->_version;
           _rotation.set_rotation_3d(yaw, pitch, roll);
         }
 
         void set_sub_chart(std::unique_ptr<SubChart_> sub_chart)
         {
+          ++this->_version;
           XASSERTM(bool(_sub_chart), "Extrude chart already has a sub-chart");
           _sub_chart = std::move(sub_chart);
         }
@@ -148,6 +152,8 @@ namespace FEAT
 
         virtual void transform(const WorldPoint& origin, const WorldPoint& angles, const WorldPoint& offset) override
         {
+          ++this->_version;
+
           // the rotation matrix
           Tiny::Matrix<CoordType, 3, 3> rotation;
           rotation.set_rotation_3d(angles[0], angles[1], angles[2]);
@@ -85,9 +85,23 @@ namespace FEAT
           return "sphere";
         }
 
+        /// \copydoc ChartBase::get_bounding_box()
+        virtual int get_bounding_box(WorldPoint& box_min, WorldPoint& box_max) const override
+        {
+          for(int i(0); i < WorldPoint::n; ++i)
+          {
+            box_min[i] = _midpoint[i] - _radius;
+            box_max[i] = _midpoint[i] + _radius;
+          }
+          // the signed distance is positive outside of the sphere
+          return 1;
+        }
+
         /// \copydoc ChartBase:transform()
         virtual void transform(const WorldPoint& origin, const WorldPoint& angles, const WorldPoint& offset) override
         {
+          ++this->_version;
+
           // create rotation matrix
           Tiny::Matrix<CoordType, 3, 3> rot;
           rot.set_rotation_3d(angles(0), angles(1), angles(2));
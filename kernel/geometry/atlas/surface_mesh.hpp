@@ -120,6 +120,8 @@ namespace FEAT
         /// \copydoc ChartBase:transform()
         virtual void transform(const WorldPoint& origin, const WorldPoint& angles, const WorldPoint& offset) override
         {
+          ++this->_version;
+
           // create rotation matrix
           Tiny::Matrix<CoordType, 3, 3> rot;
           rot.set_rotation_3d(angles[0], angles[1], angles[2]);
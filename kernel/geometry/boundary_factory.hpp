@@ -22,6 +22,10 @@ namespace FEAT
      * The boundary factory is a MeshPart factory, which creates a MeshPart without
      * topology containing all boundary faces for a given conformal mesh.
      *
+     * \attention
+     * The boundary computation requires the full topology of the mesh, so this factory cannot be used
+     * for a mesh whose index sets have been released by ConformalMesh::release_index_sets().
+     *
      * \author Peter Zajac
      */
     template<typename ParentMesh_>
@@ -59,6 +63,23 @@ namespace FEAT
       {
       }
 
+      /**
+       * \brief Constructor
+       *
+       * \param[in] mesh_in
+       * A \resident reference to mesh for which the boundary meshpart is to be computed.
+       *
+       * \param[in] facet_mask
+       * A \transient mask vector for the facets of the mesh; all facets with a non-zero mask entry
+       * are not regarded as boundary facets, e.g. the interface facets of a mesh with hanging
+       * vertices as computed by the HangingNodeRefinery::compute_interface_facets() function.
+       */
+      explicit BoundaryFactory(const ParentMeshType& mesh_in, const std::vector<int>& facet_mask) :
+        _mesh_in(mesh_in),
+        _face_computer(mesh_in.get_index_set_holder(), facet_mask)
+      {
+      }
+
       /// Returns the number of entities.
       virtual Index get_num_entities(int dim) override
       {
@@ -120,6 +120,15 @@ namespace FEAT
       /// mesh permutation (if permuted)
       MeshPermutationType _permutation;
 
+      /// modification counter of the vertex set
+      std::uint64_t _vertex_version;
+
+      /// specifies whether the redundant index sets have been released by release_index_sets()
+      bool _index_sets_released;
+
+      /// specifies whether the faces-at-element index sets have been kept by release_index_sets()
+      bool _faces_at_elem_kept;
+
     public:
       /**
        * \brief Constructor.
@@ -132,7 +141,10 @@ namespace FEAT
         _vertex_set(num_entities[0]),
         _index_set_holder(num_entities),
         _neighbors(num_entities[shape_dim]),
-        _permutation()
+        _permutation(),
+        _vertex_version(0u),
+        _index_sets_released(false),
+        _faces_at_elem_kept(false)
       {
         for(int i(0); i <= shape_dim; ++i)
         {
@@ -151,7 +163,10 @@ namespace FEAT
         _vertex_set(factory.get_num_entities(0)),
         _index_set_holder(Intern::NumEntitiesWrapper<shape_dim>(factory).num_entities),
         _neighbors(Intern::NumEntitiesWrapper<shape_dim>(factory).num_entities[shape_dim]),
-        _permutation()
+        _permutation(),
+        _vertex_version(0u),
+        _index_sets_released(false),
+        _faces_at_elem_kept(false)
       {
         // Compute entity counts
         Intern::NumEntitiesWrapper<shape_dim>::apply(factory, _num_entities);
@@ -176,7 +191,10 @@ namespace FEAT
         _vertex_set(std::forward<VertexSetType>(other._vertex_set)),
         _index_set_holder(std::forward<IndexSetHolderType>(other._index_set_holder)),
         _neighbors(std::forward<NeighborSetType>(other._neighbors)),
-        _permutation(std::forward<MeshPermutationType>(other._permutation))
+        _permutation(std::forward<MeshPermutationType>(other._permutation)),
+        _vertex_version(other._vertex_version),
+        _index_sets_released(other._index_sets_released),
+        _faces_at_elem_kept(other._faces_at_elem_kept)
       {
         for(int i(0); i <= shape_dim; ++i)
         {
@@ -195,6 +213,9 @@ namespace FEAT
         _index_set_holder = std::forward<IndexSetHolderType>(other._index_set_holder);
         _neighbors = std::forward<NeighborSetType>(other._neighbors);
         _permutation = std::forward<MeshPermutationType>(other._permutation);
+        _vertex_version = Math::max(_vertex_version, other._vertex_version) + 1u;
+        _index_sets_released = other._index_sets_released;
+        _faces_at_elem_kept = other._faces_at_elem_kept;
 
         for(int i(0); i <= shape_dim; ++i)
         {
@@ -229,6 +250,9 @@ namespace FEAT
         this->_index_set_holder.clone(other._index_set_holder);
         this->_neighbors = other._neighbors.clone();
         this->_permutation.clone(other._permutation);
+        this->_index_sets_released = other._index_sets_released;
+        this->_faces_at_elem_kept = other._faces_at_elem_kept;
+        ++this->_vertex_version;
       }
 
       /// \returns An independent clone of \c this mesh object.
@@ -239,6 +263,8 @@ namespace FEAT
         mesh._index_set_holder.clone(this->_index_set_holder);
         mesh._neighbors = this->_neighbors.clone();
         mesh._permutation.clone(this->_permutation);
+        mesh._index_sets_released = this->_index_sets_released;
+        mesh._faces_at_elem_kept = this->_faces_at_elem_kept;
         return mesh;
       }
 
@@ -321,12 +347,14 @@ namespace FEAT
       {
         // make sure that we don't already have a permutation
         XASSERTM(this->_permutation.empty(), "mesh is already permuted!");
+        XASSERTM(!this->_index_sets_released, "cannot permute a mesh whose index sets have been released!");
 
         // create the permutation
         this->_permutation.create(strategy, this->_index_set_holder, this->_vertex_set);
 
         // permute vertex set
         this->_vertex_set.permute(this->_permutation.get_perm(0));
+        ++this->_vertex_version;
 
         // permute index sets
         this->_index_set_holder.permute(this->_permutation.get_perms(), this->_permutation.get_inv_perms());
@@ -355,6 +383,7 @@ namespace FEAT
       {
         // make sure that we don't already have a permutation
         XASSERTM(this->_permutation.empty(), "mesh is already permuted!");
+        XASSERTM(!this->_index_sets_released, "cannot permute a mesh whose index sets have been released!");
 
         // check the dimensions
         XASSERTM(mesh_perm.validate_sizes(this->_num_entities) == 0, "mesh permutation has invalid size!");
@@ -364,6 +393,7 @@ namespace FEAT
 
         // permute vertex set
         this->_vertex_set.permute(this->_permutation.get_perm(0));
+        ++this->_vertex_version;
 
         // permute index sets
         this->_index_set_holder.permute(this->_permutation.get_perms(), this->_permutation.get_inv_perms());
@@ -481,12 +511,14 @@ namespace FEAT
       /// Fills the neighbor index set
       void fill_neighbors()
       {
+        XASSERTM(!_index_sets_released, "cannot compute neighbors of a mesh whose index sets have been released!");
+
         // Facet at cell index set
         auto& facet_idx = get_index_set<shape_dim, shape_dim -1>();
 
         XASSERTM(get_num_entities(shape_dim-1) == facet_idx.get_index_bound(), "mesh num_entities / index_set num_entities mismatch");
 
-        if(_neighbors.get_num_indices() == Index(0))
+        if(_neighbors.get_num_entities() != get_num_entities(shape_dim))
           _neighbors = std::move(typename IndexSet<shape_dim, shape_dim-1>::Type(get_num_entities(shape_dim)));
 
         Intern::FacetNeighbors::compute(_neighbors, facet_idx);
@@ -495,16 +527,24 @@ namespace FEAT
       /// \returns A reference to the facet neighbor relations
       typename IndexSet<shape_dim, shape_dim-1>::Type& get_neighbors()
       {
+        XASSERTM(!_index_sets_released, "neighbors of this mesh have been released!");
         return _neighbors;
       }
 
       /// \copydoc get_neighbors()
       const typename IndexSet<shape_dim, shape_dim-1>::Type& get_neighbors() const
       {
+        XASSERTM(!_index_sets_released, "neighbors of this mesh have been released!");
         return _neighbors;
       }
 
-      /// Returns a reference to the vertex set of the mesh.
+      /**
+       * \brief Returns a reference to the vertex set of the mesh.
+       *
+       * \attention
+       * This function does not increment the vertex version, so any code which modifies the vertex
+       * coordinates through the returned reference has to call touch_vertices() afterwards.
+       */
       VertexSetType& get_vertex_set()
       {
         return _vertex_set;
@@ -516,6 +556,31 @@ namespace FEAT
         return _vertex_set;
       }
 
+      /**
+       * \brief Returns the modification counter of the vertex set.
+       *
+       * The vertex version is incremented by each operation that modifies the vertex coordinates,
+       * i.e. by transform(), the permutation functions, clone and move assignment as well as by
+       * touch_vertices(), which has to be called by all code that modifies the vertex coordinates
+       * via get_vertex_set(). This allows precomputed data which depends on the vertex coordinates,
+       * e.g. a Trafo::GeometryCache, to check its validity in constant time.
+       */
+      std::uint64_t get_vertex_version() const
+      {
+        return _vertex_version;
+      }
+
+      /**
+       * \brief Marks the vertex coordinates as modified.
+       *
+       * This function increments the vertex version and must be called after the vertex coordinates
+       * have been modified via get_vertex_set(), e.g. by a chart adaption or a mesh optimizer.
+       */
+      void touch_vertices()
+      {
+        ++_vertex_version;
+      }
+
       /**
        * \brief Returns the reference to an index set.
        *
@@ -533,6 +598,7 @@ namespace FEAT
         int face_dim_>
       typename IndexSet<cell_dim_, face_dim_>::Type& get_index_set()
       {
+        XASSERTM(has_index_set(cell_dim_, face_dim_), "requested index set has been released!");
         return _index_set_holder.template get_index_set_wrapper<cell_dim_>().template get_index_set<face_dim_>();
       }
 
@@ -542,27 +608,57 @@ namespace FEAT
         int face_dim_>
       const typename IndexSet<cell_dim_, face_dim_>::Type& get_index_set() const
       {
+        XASSERTM(has_index_set(cell_dim_, face_dim_), "requested index set has been released!");
         return _index_set_holder.template get_index_set_wrapper<cell_dim_>().template get_index_set<face_dim_>();
       }
 
+      /**
+       * \brief Checks whether an index set is available.
+       *
+       * \param[in] cell_dim
+       * The dimension of the entity whose index set is to be checked.
+       *
+       * \param[in] face_dim
+       * The dimension of the face that the index set refers to.
+       *
+       * \returns
+       * \c false, if the index set has been released by release_index_sets(), otherwise \c true.
+       */
+      bool has_index_set(int cell_dim, int face_dim) const
+      {
+        if(!_index_sets_released)
+          return true;
+        return (cell_dim == shape_dim) && ((face_dim == 0) || _faces_at_elem_kept);
+      }
+
+      /// \returns \c true, if the index sets of this mesh have been released by release_index_sets().
+      bool has_released_index_sets() const
+      {
+        return _index_sets_released;
+      }
+
       /// \cond internal
       IndexSetHolderType& get_index_set_holder()
       {
+        XASSERTM(!_index_sets_released, "index set holder of this mesh has been released!");
         return _index_set_holder;
       }
 
       const IndexSetHolderType& get_index_set_holder() const
       {
+        XASSERTM(!_index_sets_released, "index set holder of this mesh has been released!");
         return _index_set_holder;
       }
 
       IndexSetHolderType* get_topology()
       {
+        XASSERTM(!_index_sets_released, "index set holder of this mesh has been released!");
         return &_index_set_holder;
       }
 
       const IndexSetHolderType* get_topology() const
       {
+        XASSERTM(!_index_sets_released, "index set holder of this mesh has been released!");
         return &_index_set_holder;
       }
       /// \endcond
@@ -577,6 +673,7 @@ namespace FEAT
       {
         RedundantIndexSetBuilder<ShapeType>::compute(_index_set_holder);
         NumEntitiesExtractor<shape_dim>::set_num_entities(_index_set_holder, _num_entities);
+        _index_sets_released = _faces_at_elem_kept = false;
         this->fill_neighbors();
         this->reorient_boundary_facets();
       }
@@ -592,6 +689,37 @@ namespace FEAT
         Geometry::FacetFlipper<ShapeType>::reorient(this->_index_set_holder);
       }
 
+      /**
+       * \brief Releases all index sets that are not required for the assembly on this mesh.
+       *
+       * This function releases the facet neighbor information as well as all index sets except for
+       * the vertices-at-element index set and (optionally) the other faces-at-element index sets,
+       * which are the only index sets required by the trafos and the DOF mappings of the spaces.
+       * The number of entities of each dimension is not affected by this function.
+       *
+       * This function is meant to be called for the finest mesh level once it has been set up
+       * completely, as its memory footprint is typically dominated by the redundant index sets.
+       * Note that a mesh whose index sets have been released can neither be refined nor permuted
+       * and the trace assembly on its mesh parts is not possible anymore; all accessors of the released
+       * index sets fire an assertion, use has_index_set() to check whether an index set is available.
+       *
+       * \param[in] keep_faces_at_elem
+       * Specifies whether the faces-at-element index sets are to be kept. These are required by all
+       * spaces that have DOFs on edges or faces, e.g. Lagrange-2 or Rannacher-Turek, whereas spaces
+       * with DOFs on vertices and elements only, e.g. Lagrange-1 or Discontinuous, do not need them.
+       *
+       * \note The released index sets can be recomputed by deduct_topology_from_top(), however,
+       * this does generally not restore the original numbering and orientation of edges and faces.
+       */
+      void release_index_sets(bool keep_faces_at_elem)
+      {
+        _index_set_holder.clear(keep_faces_at_elem ? shape_dim : 1);
+        _neighbors.clear();
+        // faces-at-element sets that have been released before cannot be kept now
+        _faces_at_elem_kept = keep_faces_at_elem && (_faces_at_elem_kept || !_index_sets_released);
+        _index_sets_released = true;
+      }
+
       /**
        * \brief Applies a "proper rigid" transformation onto the mesh.
        *
@@ -621,6 +749,7 @@ namespace FEAT
       void transform(const VertexType& origin, const VertexType& angles, const VertexType& offset)
       {
         _vertex_set.transform(origin, angles, offset);
+        ++_vertex_version;
       }
 
       /**
@@ -755,6 +884,8 @@ namespace FEAT
       explicit StandardRefinery(const MeshType& coarse_mesh) :
         _coarse_mesh(coarse_mesh)
       {
+        XASSERTM(!coarse_mesh.has_released_index_sets(), "cannot refine a mesh whose index sets have been released!");
+
         // get number of entities in coarse mesh
         for(int i(0); i <= shape_dim; ++i)
         {
@@ -0,0 +1,258 @@
+// FEAT3: Finite Element Analysis Toolbox, Version 3
+// Copyright (C) 2010 - 2023 by Stefan Turek & the FEAT group
+// FEAT3 is released under the GNU General Public License version 3,
+// see the file 'copyright.txt' in the top level directory for details.
+
+#include <test_system/test_system.hpp>
+#include <kernel/geometry/common_factories.hpp>
+#include <kernel/geometry/conformal_mesh.hpp>
+#include <kernel/geometry/hanging_node_refinery.hpp>
+#include <kernel/geometry/boundary_factory.hpp>
+#include <kernel/geometry/mesh_atlas.hpp>
+#include <kernel/geometry/atlas/circle.hpp>
+
+#include <set>
+
+using namespace FEAT;
+using namespace FEAT::TestSystem;
+using namespace FEAT::Geometry;
+
+/**
+ * \brief Test class for the HangingNodeRefinery class template.
+ *
+ * \test Tests the local refinement of quadrilateral and hexahedral meshes with hanging vertices.
+ */
+class HangingNodeRefineryTest :
+  public UnitTest
+{
+public:
+  typedef ConformalMesh<Shape::Quadrilateral> QuadMesh;
+  typedef ConformalMesh<Shape::Hexahedron> HexaMesh;
+  typedef MeshAtlas<QuadMesh> QuadAtlas;
+  typedef RootMeshNode<QuadMesh> QuadNode;
+
+  HangingNodeRefineryTest() :
+    UnitTest("hanging_node_refinery-test")
+  {
+  }
+
+  virtual ~HangingNodeRefineryTest()
+  {
+  }
+
+  /// computes the total volume of all elements of an axis-aligned hypercube mesh
+  template<typename Mesh_>
+  static double compute_volume(const Mesh_& mesh)
+  {
+    const auto& vtx = mesh.get_vertex_set();
+    const auto& idx = mesh.template get_index_set<Mesh_::shape_dim, 0>();
+    const int nv = idx.get_num_indices();
+    double vol(0.0);
+    for(Index i(0); i < mesh.get_num_elements(); ++i)
+    {
+      double v(1.0);
+      for(int k(0); k < Mesh_::shape_dim; ++k)
+        v *= Math::abs(double(vtx[idx(i, nv-1)][k] - vtx[idx(i, 0)][k]));
+      vol += v;
+    }
+    return vol;
+  }
+
+  /// counts the number of vertices with a non-empty adjacency list
+  static Index count_nonempty(const Adjacency::Graph& graph)
+  {
+    Index n(0);
+    for(Index i(0); i < graph.get_num_nodes_domain(); ++i)
+      n += (graph.degree(i) > Index(0) ? Index(1) : Index(0));
+    return n;
+  }
+
+  void test_quad_single() const
+  {
+    // 4x4 quad mesh, refine one interior element
+    RefinedUnitCubeFactory<QuadMesh> factory(2);
+    QuadMesh coarse_mesh(factory);
+    std::vector<int> marker = HangingNodeRefinery<QuadMesh>::mark_elements(coarse_mesh,
+      [](const Tiny::Vector<Real, 2>& p) {return (p[0] > 0.25) && (p[0] < 0.5) && (p[1] > 0.25) && (p[1] < 0.5);});
+
+    HangingNodeRefinery<QuadMesh> refinery(coarse_mesh, marker);
+    QuadMesh fine_mesh(refinery);
+
+    TEST_CHECK_EQUAL(fine_mesh.get_num_elements(), Index(19));
+    TEST_CHECK_EQUAL(fine_mesh.get_num_vertices(), Index(30));
+    TEST_CHECK_EQUAL(fine_mesh.get_num_entities(1), Index(52));
+    TEST_CHECK_EQUAL_WITHIN_EPS(compute_volume(fine_mesh), 1.0, 1E-12);
+
+    // 4 edge midpoints are hanging vertices
+    Adjacency::Graph parents = refinery.get_vertex_parents();
+    TEST_CHECK_EQUAL(count_nonempty(parents), Index(4));
+    Adjacency::Graph hanging = HangingNodeRefinery<QuadMesh>::compute_hanging_vertices(fine_mesh, parents);
+    TEST_CHECK_EQUAL(count_nonempty(hanging), Index(4));
+
+    // refine all other elements: no hanging vertices are left
+    const auto& vtx = fine_mesh.get_vertex_set();
+    const auto& idx = fine_mesh.get_index_set<2, 0>();
+    std::vector<int> marker2(fine_mesh.get_num_elements(), 0);
+    for(Index i(0); i < fine_mesh.get_num_elements(); ++i)
+      marker2[i] = (Math::abs(vtx[idx(i, 3)][0] - vtx[idx(i, 0)][0]) > 0.2 ? 1 : 0);
+    HangingNodeRefinery<QuadMesh> refinery2(fine_mesh, marker2, parents);
+    QuadMesh fine_mesh2(refinery2);
+    TEST_CHECK_EQUAL(fine_mesh2.get_num_elements(), Index(64));
+    TEST_CHECK_EQUAL(fine_mesh2.get_num_vertices(), Index(81));
+    TEST_CHECK_EQUAL(count_nonempty(HangingNodeRefinery<QuadMesh>::compute_hanging_vertices(
+      fine_mesh2, refinery2.get_vertex_parents())), Index(0));
+  }
+
+  void test_quad_closure() const
+  {
+    // 2x2 quad mesh, refine the lower left element
+    RefinedUnitCubeFactory<QuadMesh> factory(1);
+    QuadMesh mesh_0(factory);
+    std::vector<int> marker_0 = HangingNodeRefinery<QuadMesh>::mark_elements(mesh_0,
+      [](const Tiny::Vector<Real, 2>& p) {return (p[0] < 0.5) && (p[1] < 0.5);});
+    HangingNodeRefinery<QuadMesh> refinery_0(mesh_0, marker_0);
+    QuadMesh mesh_1(refinery_0);
+    TEST_CHECK_EQUAL(mesh_1.get_num_elements(), Index(7));
+
+    // refine the upper right child of the refined element; its corner vertices include two hanging
+    // vertices, so the two neighbor elements must be refined by the closure
+    std::vector<int> marker_1 = HangingNodeRefinery<QuadMesh>::mark_elements(mesh_1,
+      [](const Tiny::Vector<Real, 2>& p) {return (p[0] > 0.25) && (p[0] < 0.5) && (p[1] > 0.25) && (p[1] < 0.5);});
+    HangingNodeRefinery<QuadMesh> refinery_1(mesh_1, marker_1, refinery_0.get_vertex_parents());
+    const std::vector<int>& marker = refinery_1.get_marker();
+    TEST_CHECK_EQUAL(std::count(marker.begin(), marker.end(), 1), std::ptrdiff_t(3));
+    QuadMesh mesh_2(refinery_1);
+    TEST_CHECK_EQUAL(mesh_2.get_num_elements(), Index(16));
+    TEST_CHECK_EQUAL_WITHIN_EPS(compute_volume(mesh_2), 1.0, 1E-12);
+
+    // the refined child has 4 hanging vertices on its edges and the two closure elements have one
+    // hanging vertex each; all hanging vertices are 1-irregular, i.e. their parents are not hanging
+    Adjacency::Graph hanging = HangingNodeRefinery<QuadMesh>::compute_hanging_vertices(mesh_2, refinery_1.get_vertex_parents());
+    TEST_CHECK_EQUAL(count_nonempty(hanging), Index(6));
+    for(Index i(0); i < hanging.get_num_nodes_domain(); ++i)
+    {
+      for(auto it = hanging.image_begin(i); it != hanging.image_end(i); ++it)
+        TEST_CHECK_EQUAL(hanging.degree(*it), Index(0));
+    }
+  }
+
+  void test_hexa() const
+  {
+    // 2x2x2 hexa mesh, refine one element
+    RefinedUnitCubeFactory<HexaMesh> factory(1);
+    HexaMesh coarse_mesh(factory);
+    std::vector<int> marker = HangingNodeRefinery<HexaMesh>::mark_elements(coarse_mesh,
+      [](const Tiny::Vector<Real, 3>& p) {return (p[0] < 0.5) && (p[1] < 0.5) && (p[2] < 0.5);});
+    HangingNodeRefinery<HexaMesh> refinery(coarse_mesh, marker);
+    HexaMesh fine_mesh(refinery);
+
+    TEST_CHECK_EQUAL(fine_mesh.get_num_elements(), Index(15));
+    TEST_CHECK_EQUAL(fine_mesh.get_num_vertices(), Index(27 + 19));
+    TEST_CHECK_EQUAL_WITHIN_EPS(compute_volume(fine_mesh), 1.0, 1E-12);
+
+    // all edges and faces of the refined element, which are shared with a neighbor element, are
+    // split by hanging vertices: 9 of the 12 edges and 3 of the 6 faces
+    Adjacency::Graph hanging = HangingNodeRefinery<HexaMesh>::compute_hanging_vertices(fine_mesh, refinery.get_vertex_parents());
+    TEST_CHECK_EQUAL(count_nonempty(hanging), Index(12));
+    TEST_CHECK_EQUAL(hanging.get_num_indices(), Index(9*2 + 3*4));
+  }
+
+  /// checks whether two mesh parts contain the same entities of dimension dim_ and higher
+  template<int dim_, typename Mesh_>
+  void check_same_part(const MeshPart<Mesh_>& part_a, const MeshPart<Mesh_>& part_b) const
+  {
+    const auto& trg_a = part_a.template get_target_set<dim_>();
+    const auto& trg_b = part_b.template get_target_set<dim_>();
+    std::set<Index> set_a, set_b;
+    for(Index i(0); i < trg_a.get_num_entities(); ++i)
+      set_a.insert(trg_a[i]);
+    for(Index i(0); i < trg_b.get_num_entities(); ++i)
+      set_b.insert(trg_b[i]);
+    TEST_CHECK_EQUAL(trg_a.get_num_entities(), Index(set_a.size()));
+    TEST_CHECK(set_a == set_b);
+    if constexpr(dim_ < Mesh_::shape_dim)
+      check_same_part<dim_ + 1>(part_a, part_b);
+  }
+
+  /// checks the refined boundary mesh part against the boundary of the fine mesh
+  template<typename Mesh_>
+  void check_boundary_part(const Mesh_& coarse_mesh, const std::vector<int>& marker) const
+  {
+    BoundaryFactory<Mesh_> coarse_factory(coarse_mesh);
+    MeshPart<Mesh_> coarse_bnd(coarse_factory);
+
+    HangingNodeRefinery<Mesh_> refinery(coarse_mesh, marker);
+    Mesh_ fine_mesh(refinery);
+    std::unique_ptr<MeshPart<Mesh_>> fine_bnd = refinery.refine_mesh_part(fine_mesh, coarse_bnd);
+
+    // the refined boundary must not contain the hanging interface facets
+    Adjacency::Graph hanging = HangingNodeRefinery<Mesh_>::compute_hanging_vertices(fine_mesh, refinery.get_vertex_parents());
+    BoundaryFactory<Mesh_> fine_factory(fine_mesh, HangingNodeRefinery<Mesh_>::compute_interface_facets(fine_mesh, hanging));
+    MeshPart<Mesh_> fine_ref(fine_factory);
+    check_same_part<0>(*fine_bnd, fine_ref);
+  }
+
+  void test_mesh_parts() const
+  {
+    // 4x4 quad mesh, refine a corner element and an interior element
+    RefinedUnitCubeFactory<QuadMesh> quad_factory(2);
+    QuadMesh quad_mesh(quad_factory);
+    check_boundary_part(quad_mesh, HangingNodeRefinery<QuadMesh>::mark_elements(quad_mesh,
+      [](const Tiny::Vector<Real, 2>& p) {return ((p[0] < 0.25) && (p[1] < 0.25)) || ((p[0] > 0.5) && (p[0] < 0.75) && (p[1] > 0.5) && (p[1] < 0.75));}));
+
+    // 2x2x2 hexa mesh, refine one element
+    RefinedUnitCubeFactory<HexaMesh> hexa_factory(1);
+    HexaMesh hexa_mesh(hexa_factory);
+    check_boundary_part(hexa_mesh, HangingNodeRefinery<HexaMesh>::mark_elements(hexa_mesh,
+      [](const Tiny::Vector<Real, 3>& p) {return (p[0] < 0.5) && (p[1] < 0.5) && (p[2] < 0.5);}));
+  }
+
+  void test_mesh_node() const
+  {
+    // 2x2 quad mesh, whose boundary is adapted to the circumcircle of the unit square
+    const Real rad = Math::sqrt(Real(0.5));
+    QuadAtlas atlas;
+    atlas.add_mesh_chart("circle", std::unique_ptr<Atlas::Circle<QuadMesh>>(new Atlas::Circle<QuadMesh>(0.5, 0.5, rad)));
+
+    RefinedUnitCubeFactory<QuadMesh> factory(1);
+    QuadNode coarse_node(factory.make_unique(), &atlas);
+    BoundaryFactory<QuadMesh> bnd_factory(*coarse_node.get_mesh());
+    coarse_node.add_mesh_part("bnd", bnd_factory.make_unique(), "circle", atlas.find_mesh_chart("circle"));
+    coarse_node.add_mesh_part("empty", nullptr);
+    coarse_node.adapt();
+
+    // refine the lower left element
+    std::vector<int> marker = HangingNodeRefinery<QuadMesh>::mark_elements(*coarse_node.get_mesh(),
+      [](const Tiny::Vector<Real, 2>& p) {return (p[0] < 0.5) && (p[1] < 0.5);});
+    HangingNodeRefinery<QuadMesh> refinery(*coarse_node.get_mesh(), marker);
+    std::unique_ptr<QuadNode> fine_node = refinery.refine_node(coarse_node);
+
+    TEST_CHECK_EQUAL(fine_node->get_mesh_part_names().size(), std::size_t(2));
+    TEST_CHECK(fine_node->find_mesh_part("empty") == nullptr);
+    TEST_CHECK_EQUAL(fine_node->find_mesh_part_chart_name("bnd"), String("circle"));
+    TEST_CHECK(fine_node->find_mesh_part_chart("bnd") == atlas.find_mesh_chart("circle"));
+
+    // the boundary contains 2 new vertices and edges, all boundary vertices lie on the circle
+    const MeshPart<QuadMesh>* bnd = fine_node->find_mesh_part("bnd");
+    TEST_CHECK(bnd != nullptr);
+    TEST_CHECK_EQUAL(bnd->get_num_entities(0), Index(10));
+    TEST_CHECK_EQUAL(bnd->get_num_entities(1), Index(10));
+    const auto& vtx = fine_node->get_mesh()->get_vertex_set();
+    const auto& trg = bnd->get_target_set<0>();
+    for(Index i(0); i < trg.get_num_entities(); ++i)
+    {
+      const Real dx = vtx[trg[i]][0] - Real(0.5);
+      const Real dy = vtx[trg[i]][1] - Real(0.5);
+      TEST_CHECK_EQUAL_WITHIN_EPS(Math::sqrt(dx*dx + dy*dy), rad, 1E-12);
+    }
+  }
+
+  virtual void run() const override
+  {
+    test_quad_single();
+    test_quad_closure();
+    test_hexa();
+    test_mesh_parts();
+    test_mesh_node();
+  }
+} hanging_node_refinery_test;
@@ -0,0 +1,1007 @@
+// FEAT3: Finite Element Analysis Toolbox, Version 3
+// Copyright (C) 2010 - 2023 by Stefan Turek & the FEAT group
+// FEAT3 is released under the GNU General Public License version 3,
+// see the file 'copyright.txt' in the top level directory for details.
+
+#pragma once
+#ifndef KERNEL_GEOMETRY_HANGING_NODE_REFINERY_HPP
+#define KERNEL_GEOMETRY_HANGING_NODE_REFINERY_HPP 1
+
+// includes, FEAT
+#include <kernel/adjacency/graph.hpp>
+#include <kernel/geometry/conformal_mesh.hpp>
+#include <kernel/geometry/index_calculator.hpp>
+#include <kernel/geometry/mesh_node.hpp>
+#include <kernel/geometry/mesh_part.hpp>
+#include <kernel/util/assertion.hpp>
+#include <kernel/util/dist.hpp>
+
+// includes, system
+#include <algorithm>
+#include <array>
+#include <map>
+#include <set>
+#include <vector>
+
+namespace FEAT
+{
+  namespace Geometry
+  {
+    /// \cond internal
+    namespace Intern
+    {
+      /**
+       * \brief Helper class for the lattice of a locally refined hypercube
+       *
+       * The 3^dim lattice points of a refined hypercube are indexed by their lattice coordinates
+       * t_k in {0, 1, 2}; a lattice point is the midpoint of all cell corners b with b_k = t_k/2
+       * for all k with t_k != 1, i.e. corners, edge midpoints, face midpoints and the cell center.
+       */
+      template<int dim_>
+      struct HangingLattice
+      {
+        /// number of corners
+        static constexpr int num_corners = 1 << dim_;
+        /// number of lattice points
+        static constexpr int num_points = (dim_ == 2 ? 9 : 27);
+
+        /// key of a sub-entity: sorted vertex indices, padded by ~Index(0)
+        typedef std::array<Index, 4> KeyType;
+
+        /// returns the k-th lattice coordinate of lattice point p
+        static int coord(int p, int k)
+        {
+          return (k == 0 ? p % 3 : (k == 1 ? (p / 3) % 3 : p / 9));
+        }
+
+        /// returns the number of free coordinates of a lattice point
+        static int num_free(int p)
+        {
+          int n(0);
+          for(int k(0); k < dim_; ++k)
+            n += (coord(p, k) == 1 ? 1 : 0);
+          return n;
+        }
+
+        /// returns the local corner indices whose midpoint is the lattice point p
+        static int parents(int p, int* corners)
+        {
+          int n(0);
+          for(int b(0); b < num_corners; ++b)
+          {
+            bool match = true;
+            for(int k(0); k < dim_; ++k)
+            {
+              const int t = coord(p, k);
+              match = match && ((t == 1) || (t == 2*((b >> k) & 1)));
+            }
+            if(match)
+              corners[n++] = b;
+          }
+          return n;
+        }
+
+        /// returns the lattice point of corner b of child c
+        static int child_point(int c, int b)
+        {
+          int p(0);
+          for(int k(dim_-1); k >= 0; --k)
+            p = 3*p + ((c >> k) & 1) + ((b >> k) & 1);
+          return p;
+        }
+
+        /// creates a key from a set of vertex indices
+        static KeyType make_key(const Index* v, int n)
+        {
+          KeyType key;
+          key.fill(~Index(0));
+          for(int i(0); i < n; ++i)
+            key[std::size_t(i)] = v[i];
+          std::sort(key.begin(), key.begin() + n);
+          return key;
+        }
+
+        /**
+         * \brief Calls a functor for each edge and face of a cell
+         *
+         * \param[in] verts
+         * The global indices of the corners of the cell.
+         *
+         * \param[in] func
+         * The functor that is called with the key of each edge and face.
+         */
+        template<typename Func_>
+        static void for_each_entity(const Index* verts, Func_&& func)
+        {
+          int loc[num_corners];
+          Index glob[num_corners];
+          for(int p(0); p < num_points; ++p)
+          {
+            const int nf = num_free(p);
+            if((nf == 0) || (nf == dim_))
+              continue;
+            const int n = parents(p, loc);
+            for(int i(0); i < n; ++i)
+              glob[i] = verts[loc[i]];
+            func(make_key(glob, n));
+          }
+        }
+      }; // struct HangingLattice
+    } // namespace Intern
+    /// \endcond
+
+    /** \brief Hanging-Node-Refinery class template declaration */
+    template<typename Mesh_>
+    class HangingNodeRefinery;
+
+    /**
+     * \brief Hanging-Node-Refinery class template specialization for hypercube ConformalMesh
+     *
+     * This class implements a factory that refines a user-defined subset of the elements of a 2D
+     * quadrilateral or a 3D hexahedral mesh, whereas all other elements are left unrefined. The
+     * resulting mesh is not conforming anymore, because the edge and face midpoints, which are
+     * created on the interfaces between refined and unrefined elements, are <em>hanging vertices</em>.
+     *
+     * The refinery ensures that the resulting mesh is <em>1-irregular</em>, i.e. that each edge or face
+     * contains at most one level of hanging vertices, by refining the coarser neighbors of each marked
+     * element as well if necessary. Note that this closure may mark additional elements, so the
+     * final marker can be queried by the #get_marker() function.
+     *
+     * Since the ConformalMesh class does not store any information about the refinement hierarchy,
+     * this class manages a <em>vertex-parents</em> graph, which stores the indices of the two or four
+     * parent vertices of each edge or face midpoint vertex, resp. This graph has to be passed to
+     * the refinery when refining an already locally refined mesh once again and it is required to
+     * compute the hanging vertices by the #compute_hanging_vertices() function, which in turn can be
+     * used to assemble a LAFEM::HangingNodeFilter for the conforming (e.g. Q1) finite element spaces.
+     *
+     * The vertices of the input mesh keep their indices in the refined mesh, whereas the elements
+     * are numbered in the order of the input elements, where each refined element is replaced by
+     * its 2^dim children.
+     *
+     * The mesh parts of the coarse mesh can be refined by the #refine_mesh_part() function and the
+     * #refine_node() function creates a refined root mesh node, whose mesh parts are refined and
+     * linked to the charts of the coarse root mesh node.
+     *
+     * \note
+     * The neighbor information treats the facets on the interfaces between refined and unrefined
+     * elements as boundary facets, so a boundary mesh-part, which is created for the fine mesh rather
+     * than refined from the coarse mesh, has to be created by passing the facet mask returned by the
+     * #compute_interface_facets() function to the BoundaryFactory.
+     *
+     * \note
+     * The patches of a partitioned mesh have to be refined by the constructor, which accepts the
+     * communicator and the patch mesh node, because the halo edges and faces have to be refined
+     * consistently on both neighbor patches. This ensures that no hanging vertex is contained in
+     * a halo, so that the #refine_node() function can refine the halos of the patch mesh node.
+     *
+     * <b>Example:</b>
+     * \code{.cpp}
+     * // mark all elements that are to be refined
+     * std::vector<int> marker = HangingNodeRefinery<MeshType>::mark_elements(coarse_mesh,
+     *   [](const auto& p) {return p[0] < 0.25;});
+     *
+     * // create the refinery and the fine mesh
+     * HangingNodeRefinery<MeshType> refinery(coarse_mesh, marker);
+     * MeshType fine_mesh(refinery);
+     *
+     * // compute the hanging vertices of the fine mesh
+     * Adjacency::Graph hanging = HangingNodeRefinery<MeshType>::compute_hanging_vertices(
+     *   fine_mesh, refinery.get_vertex_parents());
+     *
+     * // create the boundary mesh-part without the hanging interface facets
+     * BoundaryFactory<MeshType> bnd_factory(fine_mesh,
+     *   HangingNodeRefinery<MeshType>::compute_interface_facets(fine_mesh, hanging));
+     * MeshPart<MeshType> boundary(bnd_factory);
+     * \endcode
+     */
+    template<int shape_dim_, int num_coords_, typename Coord_>
+    class HangingNodeRefinery<ConformalMesh<Shape::Hypercube<shape_dim_>, num_coords_, Coord_>> :
+      public Factory<ConformalMesh<Shape::Hypercube<shape_dim_>, num_coords_, Coord_>>
+    {
+    public:
+      static_assert((shape_dim_ == 2) || (shape_dim_ == 3), "only 2D and 3D hypercube meshes are supported");
+
+      /// the shape type
+      typedef Shape::Hypercube<shape_dim_> ShapeType;
+      /// the mesh type
+      typedef ConformalMesh<ShapeType, num_coords_, Coord_> MeshType;
+      /// the vertex set type
+      typedef typename MeshType::VertexSetType VertexSetType;
+      /// the index set holder type
+      typedef typename MeshType::IndexSetHolderType IndexSetHolderType;
+      /// the mesh part type
+      typedef MeshPart<MeshType> MeshPartType;
+      /// the root mesh node type
+      typedef RootMeshNode<MeshType> MeshNodeType;
+      /// the shape dimension
+      static constexpr int shape_dim = shape_dim_;
+
+    protected:
+      /// our lattice helper
+      typedef Intern::HangingLattice<shape_dim_> LatticeType;
+      /// the entity key type
+      typedef typename LatticeType::KeyType KeyType;
+      /// number of vertices per element
+      static constexpr int num_corners = LatticeType::num_corners;
+
+      /// the coarse mesh
+      const MeshType& _coarse_mesh;
+      /// the element marker after closure
+      std::vector<int> _marker;
+      /// the parent vertices of each fine mesh vertex
+      std::vector<std::vector<Index>> _parents;
+      /// the fine mesh vertex of each lattice point of each marked element
+      std::vector<Index> _lattice_verts;
+      /// the first lattice vertex offset of each coarse element
+      std::vector<Index> _lattice_offset;
+      /// number of fine mesh elements
+      Index _num_elems;
+      /// the computed entity counts of the fine mesh
+      Index _num_entities[shape_dim_ + 1];
+
+    public:
+      /**
+       * \brief Constructor
+       *
+       * \param[in] coarse_mesh
+       * A \resident reference to the mesh that is to be refined.
+       *
+       * \param[in] marker
+       * The element marker vector; an element is refined if its marker is non-zero.
+       *
+       * \param[in] vertex_parents
+       * The vertex-parents graph of the coarse mesh, as returned by the #get_vertex_parents()
+       * function of the refinery that created the coarse mesh. May be empty, if the coarse mesh
+       * does not contain any vertices created by a previous local refinement.
+       */
+      explicit HangingNodeRefinery(const MeshType& coarse_mesh, const std::vector<int>& marker,
+        const Adjacency::Graph& vertex_parents = Adjacency::Graph()) :
+        _coarse_mesh(coarse_mesh),
+        _marker(marker),
+        _parents(coarse_mesh.get_num_vertices()),
+        _num_elems(0)
+      {
+        _init_parents(vertex_parents);
+
+        // apply the closure and create the lattice vertices of all marked elements
+        std::map<KeyType, std::vector<Index>> owners;
+        _build_owners(owners);
+        std::vector<Index> work = _marked_elements();
+        _closure(owners, work);
+        _build_lattice();
+      }
+
+      /**
+       * \brief Constructor for partitioned meshes
+       *
+       * In addition to the closure of the other constructor, this constructor ensures that each
+       * edge or face on the interface to a neighbor patch, i.e. each edge or face in one of the
+       * halos of the coarse mesh node, is refined on both patches or on none of them. For this,
+       * all elements which contain such an edge or face are marked on both patches if one of
+       * these elements is marked on one of the patches, which is repeated until the closure does
+       * not mark any further element on any patch.
+       *
+       * Therefore, no hanging vertex is ever contained in a halo, so all hanging vertices and all
+       * their (recursive) parent vertices are contained in the local patch. However, some of these
+       * parent vertices may be shared with other patches, so the defect filter has to be applied
+       * to the type-0 defect before its synchronization, see Global::HangingNodeFilter.
+       *
+       * \param[in] comm
+       * A \transient reference to the communicator of the halo ranks.
+       *
+       * \param[in] coarse_node
+       * A \resident reference to the root mesh node of the patch that is to be refined.
+       *
+       * \param[in] marker
+       * The element marker vector; an element is refined if its marker is non-zero.
+       *
+       * \param[in] vertex_parents
+       * The vertex-parents graph of the coarse mesh, as returned by the #get_vertex_parents()
+       * function of the refinery that created the coarse mesh node. May be empty, if the coarse
+       * mesh does not contain any vertices created by a previous local refinement.
+       */
+      explicit HangingNodeRefinery(const Dist::Comm& comm, const MeshNodeType& coarse_node,
+        const std::vector<int>& marker, const Adjacency::Graph& vertex_parents = Adjacency::Graph()) :
+        _coarse_mesh(*coarse_node.get_mesh()),
+        _marker(marker),
+        _parents(coarse_node.get_mesh()->get_num_vertices()),
+        _num_elems(0)
+      {
+        _init_parents(vertex_parents);
+
+        std::map<KeyType, std::vector<Index>> owners;
+        _build_owners(owners);
+        std::vector<Index> work = _marked_elements();
+        for(;;)
+        {
+          _closure(owners, work);
+          Index changed = _sync_halos(comm, coarse_node, owners, work);
+          comm.allreduce(&changed, &changed, std::size_t(1), Dist::op_sum);
+          if(changed == Index(0))
+            break;
+        }
+        _build_lattice();
+      }
+
+      /// virtual destructor
+      virtual ~HangingNodeRefinery()
+      {
+      }
+
+      /// \returns The element marker after closure.
+      const std::vector<int>& get_marker() const
+      {
+        return _marker;
+      }
+
+      /**
+       * \brief Returns the vertex-parents graph of the refined mesh.
+       *
+       * The adjacency list of each vertex that has been created as an edge or face midpoint contains
+       * the indices of the 2 or 4 vertices of that edge or face; the adjacency lists of all other
+       * vertices are empty.
+       */
+      Adjacency::Graph get_vertex_parents() const
+      {
+        const Index n = Index(_parents.size());
+        Index nnz(0);
+        for(const auto& p : _parents)
+          nnz += (p.size() < std::size_t(num_corners) ? Index(p.size()) : Index(0));
+        Adjacency::Graph graph(n, n, nnz);
+        Index* ptr = graph.get_domain_ptr();
+        Index* idx = graph.get_image_idx();
+        ptr[0] = Index(0);
+        for(Index i(0); i < n; ++i)
+        {
+          ptr[i+1] = ptr[i];
+          if(_parents[i].size() >= std::size_t(num_corners))
+            continue; // element center
+          for(Index j : _parents[i])
+            idx[ptr[i+1]++] = j;
+        }
+        return graph;
+      }
+
+      virtual Index get_num_entities(int dim) override
+      {
+        return _num_entities[dim];
+      }
+
+      virtual void fill_vertex_set(VertexSetType& vertex_set) override
+      {
+        const auto& vtx_c = _coarse_mesh.get_vertex_set();
+        const Index num_verts_c = vtx_c.get_num_vertices();
+        for(Index i(0); i < num_verts_c; ++i)
+          vertex_set[i] = vtx_c[i];
+
+        // new vertices are the midpoints of their parents; note that the parents of a
+        // vertex always have smaller indices, so they have been computed already
+        for(Index i(num_verts_c); i < Index(_parents.size()); ++i)
+        {
+          auto& v = vertex_set[i];
+          v.format();
+          for(Index j : _parents[i])
+            v += vertex_set[j];
+          v *= Coord_(1) / Coord_(_parents[i].size());
+        }
+      }
+
+      virtual void fill_index_sets(IndexSetHolderType& index_set_holder) override
+      {
+        const auto& idx_c = _coarse_mesh.template get_index_set<shape_dim_, 0>();
+        auto& idx_f = index_set_holder.template get_index_set<shape_dim_, 0>();
+        const Index num_elems_c = _coarse_mesh.get_num_elements();
+
+        Index k(0);
+        for(Index i(0); i < num_elems_c; ++i)
+        {
+          if(_marker[i] == 0)
+          {
+            for(int j(0); j < num_corners; ++j)
+              idx_f(k, j) = idx_c(i, j);
+            ++k;
+            continue;
+          }
+          const Index* lat = &_lattice_verts[_lattice_offset[i]];
+          for(int c(0); c < num_corners; ++c, ++k)
+          {
+            for(int b(0); b < num_corners; ++b)
+              idx_f(k, b) = lat[LatticeType::child_point(c, b)];
+          }
+        }
+
+        // build redundant index sets
+        RedundantIndexSetBuilder<ShapeType>::compute(index_set_holder);
+        NumEntitiesExtractor<shape_dim_>::set_num_entities(index_set_holder, _num_entities);
+      }
+
+      /**
+       * \brief Refines a mesh part of the coarse mesh.
+       *
+       * Each entity of the fine mesh lies within a unique coarse mesh entity of minimal dimension,
+       * which is spanned by the coarse vertices that the vertices of the fine entity have been
+       * created from. A fine mesh entity belongs to the refined mesh part if and only if this
+       * coarse mesh entity belongs to the coarse mesh part.
+       *
+       * \param[in] fine_mesh
+       * A \transient reference to the fine mesh that has been created by this refinery.
+       *
+       * \param[in] coarse_part
+       * A \transient reference to the mesh part of the coarse mesh that is to be refined.
+       *
+       * \returns The refined mesh part.
+       */
+      std::unique_ptr<MeshPartType> refine_mesh_part(const MeshType& fine_mesh, const MeshPartType& coarse_part) const
+      {
+        XASSERTM(fine_mesh.get_num_vertices() == Index(_parents.size()), "fine mesh was not created by this refinery");
+
+        // collect the coarse vertices of all coarse mesh part entities
+        std::set<std::vector<Index>> part_keys;
+        _collect_part_keys<0>(part_keys, coarse_part);
+
+        // collect all fine mesh entities, whose coarse entity is in the mesh part
+        std::vector<std::vector<Index>> entities(std::size_t(shape_dim_ + 1));
+        _refine_part_entities<0>(entities, fine_mesh, part_keys);
+
+        Index num_entities[shape_dim_ + 1];
+        for(int i(0); i <= shape_dim_; ++i)
+          num_entities[i] = Index(entities[std::size_t(i)].size());
+
+        std::unique_ptr<MeshPartType> fine_part(new MeshPartType(num_entities, coarse_part.has_topology()));
+        _fill_target_sets<0>(*fine_part, entities);
+        if(coarse_part.has_topology())
+          fine_part->deduct_topology(fine_mesh.get_index_set_holder());
+        return fine_part;
+      }
+
+      /**
+       * \brief Creates the refined root mesh node.
+       *
+       * This function creates the fine mesh, refines all mesh parts of the coarse root mesh node by
+       * the #refine_mesh_part() function and links them to the same charts. The halos of a partitioned
+       * mesh node are refined as well, where the entities of each refined halo are sorted in the same
+       * order on both neighbor patches. Finally, the fine mesh node is adapted to its charts, so that
+       * the new vertices on curved boundaries are projected onto their charts.
+       *
+       * \attention
+       * The halos of a partitioned mesh node can only be refined by a refinery, which has been
+       * created by the constructor for partitioned meshes.
+       *
+       * \param[in] coarse_node
+       * A \transient reference to the root mesh node of the coarse mesh.
+       *
+       * \returns The refined root mesh node.
+       */
+      std::unique_ptr<MeshNodeType> refine_node(MeshNodeType& coarse_node)
+      {
+        XASSERTM(coarse_node.get_mesh() == &_coarse_mesh, "mesh node does not contain the coarse mesh");
+
+        std::unique_ptr<MeshNodeType> fine_node = MeshNodeType::make_unique(this->make_unique(), coarse_node.get_atlas());
+        const MeshType& fine_mesh = *fine_node->get_mesh();
+        for(const auto& name : coarse_node.get_mesh_part_names())
+        {
+          const MeshPartType* coarse_part = coarse_node.find_mesh_part(name);
+          std::unique_ptr<MeshPartType> fine_part;
+          if(coarse_part != nullptr)
+            fine_part = refine_mesh_part(fine_mesh, *coarse_part);
+          fine_node->add_mesh_part(name, std::move(fine_part), coarse_node.find_mesh_part_chart_name(name),
+            coarse_node.find_mesh_part_chart(name));
+        }
+        for(const auto& halo : coarse_node.get_halo_map())
+          fine_node->add_halo(halo.first, _refine_halo(fine_mesh, *halo.second));
+        fine_node->adapt();
+        return fine_node;
+      }
+
+      /**
+       * \brief Computes the hanging vertices of a locally refined mesh.
+       *
+       * A vertex is hanging if it is the midpoint of an edge or face, which is still an edge or
+       * face of an element in the mesh.
+       *
+       * \param[in] mesh
+       * The locally refined mesh.
+       *
+       * \param[in] vertex_parents
+       * The vertex-parents graph of the mesh.
+       *
+       * \returns
+       * A graph, whose adjacency list of each hanging vertex contains its parent vertices and
+       * whose adjacency lists of all other vertices are empty.
+       */
+      static Adjacency::Graph compute_hanging_vertices(const MeshType& mesh, const Adjacency::Graph& vertex_parents)
+      {
+        const Index num_verts = mesh.get_num_vertices();
+        const auto& idx = mesh.template get_index_set<shape_dim_, 0>();
+        XASSERTM(vertex_parents.get_num_nodes_domain() == num_verts, "invalid vertex-parents graph");
+
+        // collect all edges and faces
+        std::set<KeyType> entities;
+        for(Index i(0); i < mesh.get_num_elements(); ++i)
+        {
+          Index verts[num_corners];
+          for(int j(0); j < num_corners; ++j)
+            verts[j] = idx(i, j);
+          LatticeType::for_each_entity(verts, [&entities](const KeyType& key) {entities.insert(key);});
+        }
+
+        // check each midpoint vertex
+        std::vector<int> hanging(num_verts, 0);
+        Index nnz(0);
+        const Index* par_ptr = vertex_parents.get_domain_ptr();
+        const Index* par_idx = vertex_parents.get_image_idx();
+        for(Index i(0); i < num_verts; ++i)
+        {
+          const int n = int(par_ptr[i+1] - par_ptr[i]);
+          if((n != 2) && (n != 4))
+            continue;
+          if(entities.find(LatticeType::make_key(&par_idx[par_ptr[i]], n)) == entities.end())
+            continue;
+          hanging[i] = 1;
+          nnz += Index(n);
+        }
+
+        Adjacency::Graph graph(num_verts, num_verts, nnz);
+        Index* ptr = graph.get_domain_ptr();
+        Index* gidx = graph.get_image_idx();
+        ptr[0] = Index(0);
+        for(Index i(0); i < num_verts; ++i)
+        {
+          ptr[i+1] = ptr[i];
+          if(hanging[i] == 0)
+            continue;
+          for(Index j(par_ptr[i]); j < par_ptr[i+1]; ++j)
+            gidx[ptr[i+1]++] = par_idx[j];
+        }
+        return graph;
+      }
+
+      /**
+       * \brief Computes the facets on the interfaces between refined and unrefined elements.
+       *
+       * The interface facets are the facets of the unrefined elements, whose midpoints are hanging
+       * vertices, as well as the children of these facets, which contain such a midpoint vertex.
+       * Each of these facets is adjacent to only one element, so the returned mask has to be passed
+       * to the BoundaryFactory to exclude them from the boundary mesh-part.
+       *
+       * \param[in] mesh
+       * The locally refined mesh.
+       *
+       * \param[in] hanging
+       * The hanging vertices graph, as returned by the #compute_hanging_vertices() function.
+       *
+       * \returns
+       * A mask vector, whose entry of each interface facet is 1 and whose other entries are 0.
+       */
+      static std::vector<int> compute_interface_facets(const MeshType& mesh, const Adjacency::Graph& hanging)
+      {
+        static constexpr int facet_verts = num_corners / 2;
+        const auto& idx = mesh.template get_index_set<shape_dim_-1, 0>();
+        XASSERTM(hanging.get_num_nodes_domain() == mesh.get_num_vertices(), "invalid hanging vertices graph");
+
+        // collect the parent keys of all hanging facet midpoints
+        std::set<KeyType> parent_facets;
+        std::vector<int> facet_midpoint(mesh.get_num_vertices(), 0);
+        for(Index i(0); i < mesh.get_num_vertices(); ++i)
+        {
+          if(hanging.degree(i) != Index(facet_verts))
+            continue;
+          Index par[facet_verts];
+          std::copy(hanging.image_begin(i), hanging.image_end(i), par);
+          parent_facets.insert(LatticeType::make_key(par, facet_verts));
+          facet_midpoint[i] = 1;
+        }
+
+        std::vector<int> mask(idx.get_num_entities(), 0);
+        for(Index i(0); i < idx.get_num_entities(); ++i)
+        {
+          Index verts[facet_verts];
+          for(int j(0); j < facet_verts; ++j)
+          {
+            verts[j] = idx(i, j);
+            mask[i] |= facet_midpoint[verts[j]];
+          }
+          if(parent_facets.find(LatticeType::make_key(verts, facet_verts)) != parent_facets.end())
+            mask[i] = 1;
+        }
+        return mask;
+      }
+
+      /**
+       * \brief Creates an element marker by evaluating a predicate in each element barycenter.
+       *
+       * \param[in] mesh
+       * The mesh whose elements are to be marked.
+       *
+       * \param[in] pred
+       * The predicate that is called with the barycenter of each element; an element is marked
+       * for refinement if the predicate returns \c true.
+       *
+       * \returns The element marker vector.
+       */
+      template<typename Pred_>
+      static std::vector<int> mark_elements(const MeshType& mesh, Pred_&& pred)
+      {
+        const auto& vtx = mesh.get_vertex_set();
+        const auto& idx = mesh.template get_index_set<shape_dim_, 0>();
+        std::vector<int> marker(mesh.get_num_elements(), 0);
+        for(Index i(0); i < mesh.get_num_elements(); ++i)
+        {
+          typename VertexSetType::VertexType v;
+          v.format();
+          for(int j(0); j < num_corners; ++j)
+            v += vtx[idx(i, j)];
+          v *= Coord_(1) / Coord_(num_corners);
+          marker[i] = (pred(v) ? 1 : 0);
+        }
+        return marker;
+      }
+
+    protected:
+      /// copies the parents of the coarse mesh vertices
+      void _init_parents(const Adjacency::Graph& vertex_parents)
+      {
+        const Index num_verts = _coarse_mesh.get_num_vertices();
+        XASSERTM(Index(_marker.size()) == _coarse_mesh.get_num_elements(), "invalid marker vector size");
+        if(vertex_parents.get_num_nodes_domain() > Index(0))
+        {
+          XASSERTM(vertex_parents.get_num_nodes_domain() == num_verts, "invalid vertex-parents graph");
+          for(Index i(0); i < num_verts; ++i)
+            _parents[i].assign(vertex_parents.image_begin(i), vertex_parents.image_end(i));
+        }
+      }
+
+      /// builds the map of all edges and faces to the elements containing them
+      void _build_owners(std::map<KeyType, std::vector<Index>>& owners) const
+      {
+        const auto& idx = _coarse_mesh.template get_index_set<shape_dim_, 0>();
+        for(Index i(0); i < _coarse_mesh.get_num_elements(); ++i)
+        {
+          Index verts[num_corners];
+          for(int j(0); j < num_corners; ++j)
+            verts[j] = idx(i, j);
+          LatticeType::for_each_entity(verts, [&owners, i](const KeyType& key) {owners[key].push_back(i);});
+        }
+      }
+
+      /// returns the indices of all marked elements
+      std::vector<Index> _marked_elements() const
+      {
+        std::vector<Index> marked;
+        for(Index i(0); i < Index(_marker.size()); ++i)
+        {
+          if(_marker[i] != 0)
+            marked.push_back(i);
+        }
+        return marked;
+      }
+
+      /// marks all unmarked elements in a list and adds them to the work list; returns the number of marked elements
+      Index _mark_all(const std::vector<Index>& elems, std::vector<Index>& work)
+      {
+        Index count(0);
+        for(Index k : elems)
+        {
+          if(_marker[k] == 0)
+          {
+            _marker[k] = 1;
+            work.push_back(k);
+            ++count;
+          }
+        }
+        return count;
+      }
+
+      /**
+       * \brief Applies the closure to all elements in the work list
+       *
+       * If a marked element contains a hanging vertex, then all elements which contain the edge or
+       * face that this hanging vertex is the midpoint of must be refined as well.
+       */
+      void _closure(const std::map<KeyType, std::vector<Index>>& owners, std::vector<Index>& work)
+      {
+        const auto& idx = _coarse_mesh.template get_index_set<shape_dim_, 0>();
+        while(!work.empty())
+        {
+          const Index i = work.back();
+          work.pop_back();
+          for(int j(0); j < num_corners; ++j)
+          {
+            const std::vector<Index>& par = _parents[idx(i, j)];
+            if((par.size() != 2u) && (par.size() != 4u))
+              continue;
+            auto it = owners.find(LatticeType::make_key(par.data(), int(par.size())));
+            if(it != owners.end())
+              _mark_all(it->second, work);
+          }
+        }
+      }
+
+      /// adds the keys of all halo entities of dimension dim_ and higher, but less than shape_dim_
+      template<int dim_>
+      void _collect_halo_keys(std::vector<KeyType>& keys, const MeshPartType& halo) const
+      {
+        const auto& trg = halo.template get_target_set<dim_>();
+        const auto& idx = _coarse_mesh.template get_index_set<dim_, 0>();
+        Index verts[num_corners];
+        for(Index i(0); i < trg.get_num_entities(); ++i)
+        {
+          for(int j(0); j < idx.get_num_indices(); ++j)
+            verts[j] = idx(trg[i], j);
+          keys.push_back(LatticeType::make_key(verts, idx.get_num_indices()));
+        }
+        if constexpr(dim_ + 1 < shape_dim_)
+          _collect_halo_keys<dim_ + 1>(keys, halo);
+      }
+
+      /**
+       * \brief Marks all elements containing a halo edge or face which is refined on either patch
+       *
+       * \returns The number of elements that have been marked by this function.
+       */
+      Index _sync_halos(const Dist::Comm& comm, const MeshNodeType& coarse_node,
+        const std::map<KeyType, std::vector<Index>>& owners, std::vector<Index>& work)
+      {
+        const auto& halo_map = coarse_node.get_halo_map();
+        const std::size_t num_halos = halo_map.size();
+
+        std::vector<int> ranks;
+        std::vector<std::vector<KeyType>> halo_keys(num_halos);
+        std::vector<std::vector<char>> send_bufs(num_halos), recv_bufs(num_halos);
+        Dist::RequestVector send_reqs, recv_reqs;
+        ranks.reserve(num_halos);
+        send_reqs.reserve(num_halos);
+        recv_reqs.reserve(num_halos);
+
+        // a halo edge or face is refined if any of its local owners is marked
+        Index count(0);
+        for(auto it = halo_map.begin(); it != halo_map.end(); ++it)
+        {
+          const std::size_t k = ranks.size();
+          std::vector<KeyType>& keys = halo_keys.at(k);
+          _collect_halo_keys<1>(keys, *it->second);
+          send_bufs.at(k).resize(keys.size(), 0);
+          recv_bufs.at(k).resize(keys.size(), 0);
+          ranks.push_back(it->first);
+          recv_reqs.push_back(comm.irecv(recv_bufs.at(k).data(), recv_bufs.at(k).size(), it->first));
+
+          for(std::size_t j(0); j < keys.size(); ++j)
+          {
+            const std::vector<Index>& elems = owners.at(keys[j]);
+            for(Index e : elems)
+              send_bufs.at(k)[j] |= char(_marker[e] != 0 ? 1 : 0);
+          }
+          send_reqs.push_back(comm.isend(send_bufs.at(k).data(), send_bufs.at(k).size(), it->first));
+
+          // all local owners of a refined halo entity have to be refined
+          for(std::size_t j(0); j < keys.size(); ++j)
+          {
+            if(send_bufs.at(k)[j] != 0)
+              count += _mark_all(owners.at(keys[j]), work);
+          }
+        }
+
+        // all local owners of a halo entity, which is refined by the neighbor, have to be refined
+        for(std::size_t idx(0u); recv_reqs.wait_any(idx); )
+        {
+          const std::vector<KeyType>& keys = halo_keys.at(idx);
+          for(std::size_t j(0); j < keys.size(); ++j)
+          {
+            if(recv_bufs.at(idx)[j] != 0)
+              count += _mark_all(owners.at(keys[j]), work);
+          }
+        }
+        send_reqs.wait_all();
+        return count;
+      }
+
+      /// creates the lattice vertices of all marked elements; existing midpoints are reused
+      void _build_lattice()
+      {
+        const Index num_verts = _coarse_mesh.get_num_vertices();
+        const Index num_elems = _coarse_mesh.get_num_elements();
+        const auto& idx = _coarse_mesh.template get_index_set<shape_dim_, 0>();
+
+        std::map<KeyType, Index> midpoints;
+        for(Index i(0); i < num_verts; ++i)
+        {
+          if(!_parents[i].empty())
+            midpoints.emplace(LatticeType::make_key(_parents[i].data(), int(_parents[i].size())), i);
+        }
+        _lattice_offset.resize(num_elems + 1u, Index(0));
+        for(Index i(0); i < num_elems; ++i)
+          _lattice_offset[i+1] = _lattice_offset[i] + (_marker[i] != 0 ? Index(LatticeType::num_points) : Index(0));
+        _lattice_verts.resize(_lattice_offset.back());
+
+        int loc[num_corners];
+        Index glob[num_corners];
+        for(Index i(0); i < num_elems; ++i)
+        {
+          if(_marker[i] == 0)
+          {
+            ++_num_elems;
+            continue;
+          }
+          _num_elems += Index(num_corners);
+          for(int p(0); p < LatticeType::num_points; ++p)
+          {
+            const int n = LatticeType::parents(p, loc);
+            for(int j(0); j < n; ++j)
+              glob[j] = idx(i, loc[j]);
+            Index& v = _lattice_verts[_lattice_offset[i] + Index(p)];
+            if(n == 1)
+            {
+              v = glob[0];
+              continue;
+            }
+            if(n == num_corners)
+            {
+              // element centers are never shared
+              v = Index(_parents.size());
+              _parents.emplace_back(glob, glob + n);
+              continue;
+            }
+            const KeyType key = LatticeType::make_key(glob, n);
+            auto it = midpoints.find(key);
+            if(it != midpoints.end())
+            {
+              v = it->second;
+              continue;
+            }
+            v = Index(_parents.size());
+            _parents.emplace_back(key.begin(), key.begin() + n);
+            midpoints.emplace(key, v);
+          }
+        }
+
+        for(int i(0); i <= shape_dim_; ++i)
+          _num_entities[i] = Index(0);
+        _num_entities[0] = Index(_parents.size());
+        _num_entities[shape_dim_] = _num_elems;
+      }
+
+      /**
+       * \brief Refines a halo of the coarse mesh node.
+       *
+       * The entities of the refined halo are sorted by the positions of the coarse vertices, which
+       * they have been created from, in the coarse halo, so that both neighbors obtain the same
+       * order of the halo entities.
+       */
+      std::unique_ptr<MeshPartType> _refine_halo(const MeshType& fine_mesh, const MeshPartType& coarse_halo) const
+      {
+        std::unique_ptr<MeshPartType> fine_halo = refine_mesh_part(fine_mesh, coarse_halo);
+
+        std::map<Index, Index> coarse_pos;
+        const auto& trg_c = coarse_halo.template get_target_set<0>();
+        for(Index i(0); i < trg_c.get_num_entities(); ++i)
+          coarse_pos.emplace(trg_c[i], i);
+
+        // the key of a fine halo vertex consists of the sorted halo positions of its coarse vertices
+        std::map<Index, std::vector<Index>> vertex_keys;
+        const auto& trg_f = fine_halo->template get_target_set<0>();
+        std::vector<Index> verts;
+        for(Index i(0); i < trg_f.get_num_entities(); ++i)
+        {
+          verts.clear();
+          _add_coarse_verts(verts, trg_f[i]);
+          std::vector<Index> key;
+          for(Index v : verts)
+            key.push_back(coarse_pos.at(v));
+          std::sort(key.begin(), key.end());
+          vertex_keys.emplace(trg_f[i], std::move(key));
+        }
+
+        _sort_halo_entities<0>(*fine_halo, fine_mesh, vertex_keys);
+        if(fine_halo->has_topology())
+          fine_halo->deduct_topology(fine_mesh.get_index_set_holder());
+        return fine_halo;
+      }
+
+      /// sorts the halo entities of dimension dim_ and higher by the sorted keys of their vertices
+      template<int dim_>
+      static void _sort_halo_entities(MeshPartType& halo, const MeshType& fine_mesh,
+        const std::map<Index, std::vector<Index>>& vertex_keys)
+      {
+        auto& trg = halo.template get_target_set<dim_>();
+        std::vector<std::pair<std::vector<std::vector<Index>>, Index>> ents;
+        for(Index i(0); i < trg.get_num_entities(); ++i)
+        {
+          std::vector<std::vector<Index>> key;
+          if constexpr(dim_ == 0)
+          {
+            key.push_back(vertex_keys.at(trg[i]));
+          }
+          else
+          {
+            const auto& idx = fine_mesh.template get_index_set<dim_, 0>();
+            for(int j(0); j < idx.get_num_indices(); ++j)
+              key.push_back(vertex_keys.at(idx(trg[i], j)));
+            std::sort(key.begin(), key.end());
+          }
+          ents.emplace_back(std::move(key), trg[i]);
+        }
+        std::sort(ents.begin(), ents.end());
+        for(Index i(0); i < trg.get_num_entities(); ++i)
+          trg[i] = ents[i].second;
+        if constexpr(dim_ < shape_dim_)
+          _sort_halo_entities<dim_ + 1>(halo, fine_mesh, vertex_keys);
+      }
+
+      /// adds the sorted coarse vertex indices of all mesh part entities of dimension dim_ and higher
+      template<int dim_>
+      void _collect_part_keys(std::set<std::vector<Index>>& keys, const MeshPartType& part) const
+      {
+        const auto& trg = part.template get_target_set<dim_>();
+        for(Index i(0); i < trg.get_num_entities(); ++i)
+        {
+          if constexpr(dim_ == 0)
+          {
+            keys.insert(std::vector<Index>(1u, trg[i]));
+          }
+          else
+          {
+            const auto& idx = _coarse_mesh.template get_index_set<dim_, 0>();
+            std::vector<Index> key;
+            for(int j(0); j < idx.get_num_indices(); ++j)
+              key.push_back(idx(trg[i], j));
+            std::sort(key.begin(), key.end());
+            keys.insert(std::move(key));
+          }
+        }
+        if constexpr(dim_ < shape_dim_)
+          _collect_part_keys<dim_ + 1>(keys, part);
+      }
+
+      /// adds the coarse vertices that a fine vertex has been created from
+      void _add_coarse_verts(std::vector<Index>& key, Index vertex) const
+      {
+        if(vertex < _coarse_mesh.get_num_vertices())
+          key.push_back(vertex);
+        else
+          key.insert(key.end(), _parents[vertex].begin(), _parents[vertex].end());
+      }
+
+      /// collects all fine mesh entities of dimension dim_ and higher, whose coarse entity is in the mesh part
+      template<int dim_>
+      void _refine_part_entities(std::vector<std::vector<Index>>& entities, const MeshType& fine_mesh,
+        const std::set<std::vector<Index>>& part_keys) const
+      {
+        std::vector<Index> key;
+        for(Index i(0); i < fine_mesh.get_num_entities(dim_); ++i)
+        {
+          key.clear();
+          if constexpr(dim_ == 0)
+          {
+            _add_coarse_verts(key, i);
+          }
+          else
+          {
+            const auto& idx = fine_mesh.template get_index_set<dim_, 0>();
+            for(int j(0); j < idx.get_num_indices(); ++j)
+              _add_coarse_verts(key, idx(i, j));
+          }
+          std::sort(key.begin(), key.end());
+          key.erase(std::unique(key.begin(), key.end()), key.end());
+          if(part_keys.find(key) != part_keys.end())
+            entities[std::size_t(dim_)].push_back(i);
+        }
+        if constexpr(dim_ < shape_dim_)
+          _refine_part_entities<dim_ + 1>(entities, fine_mesh, part_keys);
+      }
+
+      /// fills the target sets of dimension dim_ and higher
+      template<int dim_>
+      static void _fill_target_sets(MeshPartType& part, const std::vector<std::vector<Index>>& entities)
+      {
+        auto& trg = part.template get_target_set<dim_>();
+        const std::vector<Index>& ent = entities[std::size_t(dim_)];
+        for(Index i(0); i < Index(ent.size()); ++i)
+          trg[i] = ent[i];
+        if constexpr(dim_ < shape_dim_)
+          _fill_target_sets<dim_ + 1>(part, entities);
+      }
+    }; // class HangingNodeRefinery<ConformalMesh<Hypercube<...>>>
+  } // namespace Geometry
+} // namespace FEAT
+
+#endif // KERNEL_GEOMETRY_HANGING_NODE_REFINERY_HPP
@@ -8,12 +8,71 @@
 #include <kernel/geometry/conformal_mesh.hpp>              // for ConformalMesh
 #include <kernel/geometry/common_factories.hpp>         // for RefinedUnitCubeFactor
 #include <kernel/geometry/mesh_part.hpp>                   // for MeshPart
+#include <kernel/geometry/atlas/circle.hpp>                // for Circle
 #include <kernel/util/string.hpp>                          // for String
 
+#ifdef FEAT_HAVE_OMP
+#include <omp.h>
+#endif
+
 using namespace FEAT;
 using namespace FEAT::TestSystem;
 using namespace FEAT::Geometry;
 
+/// a sphere hit-test function that offers a batched evaluation
+template<typename DataType_, int dim_>
+class BatchSphereHitTestFunction :
+  public SphereHitTestFunction<DataType_, dim_>
+{
+public:
+  typedef Tiny::Vector<DataType_, dim_> PointType;
+  /// number of points evaluated by batches
+  mutable Index num_batch_points;
+
+  explicit BatchSphereHitTestFunction(PointType midpoint, DataType_ radius) :
+    SphereHitTestFunction<DataType_, dim_>(midpoint, radius),
+    num_batch_points(0)
+  {
+  }
+
+  void hit_test_batch(std::vector<int>& hits, const std::vector<PointType>& points) const
+  {
+    for(std::size_t i(0); i < points.size(); ++i)
+      hits[i] = ((*this)(points[i]) ? 1 : 0);
+    num_batch_points += Index(points.size());
+  }
+};
+
+/// a sphere hit-test function that is not thread-safe, as it counts its calls
+template<typename DataType_, int dim_>
+class CountingSphereHitTestFunction
+{
+public:
+  typedef Tiny::Vector<DataType_, dim_> PointType;
+  SphereHitTestFunction<DataType_, dim_> sphere;
+  /// number of evaluated points
+  mutable Index num_points;
+  /// number of points evaluated inside a parallel region
+  mutable Index num_parallel;
+
+  explicit CountingSphereHitTestFunction(PointType midpoint, DataType_ radius) :
+    sphere(midpoint, radius),
+    num_points(0),
+    num_parallel(0)
+  {
+  }
+
+  bool operator()(const PointType& point) const
+  {
+    ++num_points;
+#ifdef FEAT_HAVE_OMP
+    if(omp_in_parallel())
+      ++num_parallel;
+#endif
+    return sphere(point);
+  }
+};
+
 /**
  * \brief Test class for the HitTestFactoryTest class.
  *
@@ -89,10 +148,111 @@ public:
     }
   } // test_0
 
+  /// compares the target sets of a mesh-part with the serial evaluation of a hit function
+  template<typename MeshType_, typename HitFunc_>
+  void check_mesh_part(const MeshPart<MeshType_>& part, const MeshType_& mesh, const HitFunc_& hit_func) const
+  {
+    const auto& vtx = mesh.get_vertex_set();
+    std::vector<Index> trg_v, trg_q;
+    for(Index i(0); i < mesh.get_num_vertices(); ++i)
+    {
+      if(hit_func(vtx[i]))
+        trg_v.push_back(i);
+    }
+    const auto& verts_at_quad = mesh.template get_index_set<2, 0>();
+    for(Index i(0); i < mesh.get_num_elements(); ++i)
+    {
+      Tiny::Vector<double, 2> mid(0.0);
+      for(int j(0); j < 4; ++j)
+        mid += vtx[verts_at_quad(i, j)];
+      if(hit_func(mid * 0.25))
+        trg_q.push_back(i);
+    }
+    TEST_CHECK_EQUAL(part.get_num_entities(0), Index(trg_v.size()));
+    TEST_CHECK_EQUAL(part.get_num_entities(2), Index(trg_q.size()));
+    if(part.get_num_entities(0) == Index(trg_v.size()))
+    {
+      for(Index i(0); i < part.get_num_entities(0); ++i)
+      {
+        TEST_CHECK_EQUAL(part.template get_target_set<0>()[i], trg_v[i]);
+      }
+    }
+    if(part.get_num_entities(2) == Index(trg_q.size()))
+    {
+      for(Index i(0); i < part.get_num_entities(2); ++i)
+      {
+        TEST_CHECK_EQUAL(part.template get_target_set<2>()[i], trg_q[i]);
+      }
+    }
+  }
+
+  void test_1() const
+  {
+    typedef Geometry::ConformalMesh<Shape::Quadrilateral> MeshType;
+
+    // this mesh has more entities than fit into a single batch
+    Geometry::RefinedUnitCubeFactory<MeshType> mesh_factory(Index(8));
+    MeshType mesh(mesh_factory);
+
+    Tiny::Vector<double, 2> mid_point(0.4);
+    SphereHitTestFunction<double, 2> hit_func(mid_point, 0.35);
+    BatchSphereHitTestFunction<double, 2> batch_func(mid_point, 0.35);
+
+    // point-wise hit-test function
+    HitTestFactory<SphereHitTestFunction<double, 2>, MeshType> hit_test(hit_func, mesh);
+    MeshPart<MeshType> sphere(hit_test);
+    check_mesh_part(sphere, mesh, hit_func);
+
+    // batched hit-test function
+    HitTestFactory<BatchSphereHitTestFunction<double, 2>, MeshType> batch_test(batch_func, mesh);
+    MeshPart<MeshType> sphere_batch(batch_test);
+    check_mesh_part(sphere_batch, mesh, hit_func);
+    TEST_CHECK_EQUAL(batch_func.num_batch_points,
+      mesh.get_num_entities(0) + mesh.get_num_entities(1) + mesh.get_num_entities(2));
+
+    // hit-test functions which are not marked as thread-safe must be evaluated sequentially
+    CountingSphereHitTestFunction<double, 2> count_func(mid_point, 0.35);
+    HitTestFactory<CountingSphereHitTestFunction<double, 2>, MeshType> count_test(count_func, mesh);
+    MeshPart<MeshType> sphere_count(count_test);
+    check_mesh_part(sphere_count, mesh, hit_func);
+    TEST_CHECK_EQUAL(count_func.num_points,
+      mesh.get_num_entities(0) + mesh.get_num_entities(1) + mesh.get_num_entities(2));
+    TEST_CHECK_EQUAL(count_func.num_parallel, Index(0));
+    TEST_CHECK((Geometry::Intern::HitTestIsThreadSafe<SphereHitTestFunction<double, 2>>::value));
+    TEST_CHECK(!(Geometry::Intern::HitTestIsThreadSafe<CountingSphereHitTestFunction<double, 2>>::value));
+  }
+
+  void test_2() const
+  {
+    typedef Geometry::ConformalMesh<Shape::Quadrilateral> MeshType;
+    Geometry::RefinedUnitCubeFactory<MeshType> mesh_factory(Index(5));
+    MeshType mesh(mesh_factory);
+
+    // the circle's bounding box only covers a part of the mesh
+    Geometry::Atlas::Circle<MeshType> circle(0.6, 0.45, 0.25);
+    Tiny::Vector<double, 2> box_min, box_max;
+    TEST_CHECK_EQUAL(circle.get_bounding_box(box_min, box_max), -1);
+
+    for(int inv(0); inv < 2; ++inv)
+    {
+      ChartHitTestFactory<MeshType> hit_test(mesh, circle, inv != 0);
+      MeshPart<MeshType> part(hit_test);
+      auto ref_func = [&](const Tiny::Vector<double, 2>& p)
+      {
+        return (inv != 0 ? -1.0 : 1.0) * circle.signed_dist(p) <= 0.0;
+      };
+      check_mesh_part(part, mesh, ref_func);
+    }
+  }
+
   virtual void run() const override
   {
     // run test #0
     test_0();
+    // run test #1
+    test_1();
+    // run test #2
+    test_2();
   }
 };
 
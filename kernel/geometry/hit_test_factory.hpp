@@ -13,6 +13,11 @@
 #include <kernel/geometry/atlas/chart.hpp>
 #include <kernel/util/tiny_algebra.hpp>
 
+// includes, system
+#include <type_traits>
+#include <utility>
+#include <vector>
+
 namespace FEAT
 {
   namespace Geometry
@@ -20,6 +25,12 @@ namespace FEAT
     /// \cond internal
     namespace Intern
     {
+      /// number of entities whose midpoints are passed to the hit-test function at once
+      static constexpr Index hit_test_batch_size = Index(16384);
+
+      /// minimum number of entities for which the hit-test is performed in parallel
+      static constexpr Index hit_test_min_parallel = Index(4096);
+
       template<
         typename HitFunc_,
         typename Mesh_,
@@ -38,6 +49,26 @@ namespace FEAT
      * which consists of all entities that are inside the region characterized by a
      * hit-test function.
      *
+     * The midpoints of the mesh entities are computed and tested in batches. The hit-test function has
+     * to implement the member function
+     * \code{.cpp}
+       bool operator()(const PointType& point) const
+       \endcode
+     * which returns \c true if and only if \p point is inside the region. By default, this operator is
+     * called sequentially, so it does not need to be thread-safe. A hit-test function whose operator
+     * can be called concurrently by several threads may opt in to a parallel evaluation by declaring
+     * \code{.cpp}
+       static constexpr bool is_thread_safe = true;
+       \endcode
+     * Alternatively, the hit-test function may offer a batched evaluation by implementing the member
+     * function
+     * \code{.cpp}
+       void hit_test_batch(std::vector<int>& hits, const std::vector<PointType>& points) const
+       \endcode
+     * which has to set <c>hits[i]</c> to a non-zero value if and only if <c>points[i]</c> is inside
+     * the region; this function is called sequentially for each batch and it is responsible for its
+     * own parallelization.
+     *
      * \tparam HitFunc_
      * A class implementing the HitTest-Function interface. See SphereHitTestFunction
      * for an example.
@@ -115,6 +146,105 @@ namespace FEAT
     /// \cond internal
     namespace Intern
     {
+      /// helper class to detect whether a hit-test function offers a batched evaluation
+      template<typename HitFunc_, typename Point_>
+      class HitTestHasBatch
+      {
+        template<typename T_>
+        static auto test(T_* f) -> decltype(f->hit_test_batch(std::declval<std::vector<int>&>(),
+          std::declval<const std::vector<Point_>&>()), std::true_type());
+
+        template<typename>
+        static std::false_type test(...);
+
+      public:
+        static constexpr bool value = decltype(test<const HitFunc_>(nullptr))::value;
+      };
+
+      /// helper class to detect whether a hit-test function has opted in to a parallel evaluation
+      template<typename HitFunc_>
+      class HitTestIsThreadSafe
+      {
+        template<typename T_>
+        static std::integral_constant<bool, T_::is_thread_safe> test(T_*);
+
+        template<typename>
+        static std::false_type test(...);
+
+      public:
+        static constexpr bool value = decltype(test<HitFunc_>(nullptr))::value;
+      };
+
+      /// evaluates a hit-test function for a batch of points by its batched evaluation
+      template<typename HitFunc_, typename Point_, bool batch_ = HitTestHasBatch<HitFunc_, Point_>::value>
+      struct HitTestBatch
+      {
+        static void eval(std::vector<int>& hits, const std::vector<Point_>& points, const HitFunc_& hit_func)
+        {
+          hit_func.hit_test_batch(hits, points);
+        }
+      };
+
+      /// evaluates a hit-test function for a batch of points point by point; in parallel only if it is thread-safe
+      template<typename HitFunc_, typename Point_>
+      struct HitTestBatch<HitFunc_, Point_, false>
+      {
+        static void eval(std::vector<int>& hits, const std::vector<Point_>& points, const HitFunc_& hit_func)
+        {
+          const Index n = Index(points.size());
+          FEAT_PRAGMA_OMP(parallel for schedule(static) if(HitTestIsThreadSafe<HitFunc_>::value && (n >= hit_test_min_parallel)))
+          for(Index i = 0; i < n; ++i)
+          {
+            hits[i] = (hit_func(points[i]) ? 1 : 0);
+          }
+        }
+      };
+
+      /**
+       * \brief Performs the hit-test for all entities of one dimension in batches
+       *
+       * \param[out] trg
+       * Receives the indices of all entities whose midpoints are inside the region in ascending order.
+       *
+       * \param[in] num_entities
+       * The total number of entities to be tested.
+       *
+       * \param[in] hit_func
+       * The hit-test function.
+       *
+       * \param[in] mid_func
+       * A thread-safe functor that returns the midpoint of an entity.
+       */
+      template<typename Point_, typename HitFunc_, typename MidFunc_>
+      void hit_test_entities(std::vector<Index>& trg, Index num_entities, const HitFunc_& hit_func, const MidFunc_& mid_func)
+      {
+        std::vector<Point_> points;
+        std::vector<int> hits;
+        for(Index off(0); off < num_entities; off += hit_test_batch_size)
+        {
+          const Index n = Math::min(hit_test_batch_size, num_entities - off);
+          points.resize(n);
+          hits.resize(n);
+
+          // compute the midpoints of this batch
+          FEAT_PRAGMA_OMP(parallel for schedule(static) if(n >= hit_test_min_parallel))
+          for(Index i = 0; i < n; ++i)
+          {
+            points[i] = mid_func(off + i);
+          }
+
+          // evaluate the hit-test function
+          HitTestBatch<HitFunc_, Point_>::eval(hits, points, hit_func);
+
+          // collect the hits in ascending order
+          for(Index i(0); i < n; ++i)
+          {
+            if(hits[i] != 0)
+              trg.push_back(off + i);
+          }
+        }
+      }
+
       template<
         typename HitFunc_,
         typename Mesh_,
@@ -132,16 +262,13 @@ namespace FEAT
         static void apply(TargetData& trg, const Mesh_& mesh, const HitFunc_& hit_test)
         {
           static constexpr int shape_dim(Shape_::dimension);
+          typedef typename Mesh_::VertexSetType VertexSetType;
+          typedef Tiny::Vector<typename VertexSetType::CoordType, VertexSetType::num_coords> PointType;
           const Index num_cells(mesh.get_num_entities(shape_dim));
           const auto& index_set(mesh.template get_index_set<shape_dim,0>());
-          trg[shape_dim].reserve(num_cells);
-          for(Index i(0); i < num_cells; ++i)
-          {
-            if (hit_test(get_midpoint(mesh.get_vertex_set(), index_set[i])))
-            {
-              trg[shape_dim].push_back(i);
-            }
-          }
+          const VertexSetType& vertex_set(mesh.get_vertex_set());
+          hit_test_entities<PointType>(trg[shape_dim], num_cells, hit_test,
+            [&](Index i) {return get_midpoint(vertex_set, index_set[i]);});
         }
 
         template<
@@ -182,15 +309,12 @@ namespace FEAT
 
         static void apply(TargetData& trg, const Mesh_& mesh, const HitFunc_& hit_test)
         {
+          typedef typename Mesh_::VertexSetType VertexSetType;
+          typedef Tiny::Vector<typename VertexSetType::CoordType, VertexSetType::num_coords> PointType;
           const Index num_cells(mesh.get_num_entities(0));
-          trg[0].reserve(num_cells);
-          for(Index i(0); i < num_cells; ++i)
-          {
-            if (hit_test(get_midpoint(mesh.get_vertex_set(), i)))
-            {
-              trg[0].push_back(i);
-            }
-          }
+          const VertexSetType& vertex_set(mesh.get_vertex_set());
+          hit_test_entities<PointType>(trg[0], num_cells, hit_test,
+            [&](Index i) {return get_midpoint(vertex_set, i);});
         }
 
         template<typename VertexSet_>
@@ -223,7 +347,8 @@ namespace FEAT
         static void apply(TargetSet& trg, std::vector<Index>& sd)
         {
           const Index num_cells(Index(sd.size()));
-          for(Index i(0); i < num_cells; ++i)
+          FEAT_PRAGMA_OMP(parallel for schedule(static) if(num_cells >= hit_test_min_parallel))
+          for(Index i = 0; i < num_cells; ++i)
           {
             trg[i] = sd[i];
           }
@@ -242,7 +367,8 @@ namespace FEAT
         static void apply(TargetSet& trg, std::vector<Index>& sd)
         {
           const Index num_cells(Index(sd.size()));
-          for(Index i(0); i < num_cells; ++i)
+          FEAT_PRAGMA_OMP(parallel for schedule(static) if(num_cells >= hit_test_min_parallel))
+          for(Index i = 0; i < num_cells; ++i)
           {
             trg[i] = sd[i];
           }
@@ -272,6 +398,9 @@ namespace FEAT
       /// The point type
       typedef Tiny::Vector<DataType_, dim_> PointType;
 
+      /// the hit-test may be evaluated by several threads concurrently
+      static constexpr bool is_thread_safe = true;
+
     private:
       /// the sphere's midpoint
       PointType _midpoint;
@@ -330,6 +459,9 @@ namespace FEAT
      * This class template can be used to create a MeshPart for a particular mesh, which consists of
      * all entities that are inside or outside the region characterized by a given chart.
      *
+     * The hit-test is evaluated in parallel, so the signed_dist() function of the chart must be thread-safe;
+     * this is the case for all charts in the Atlas namespace, which do not have any mutable state.
+     *
      * \tparam Mesh_
      * The type of the mesh for which the cell sub-set is to be computed.
      *
@@ -358,18 +490,42 @@ namespace FEAT
       protected:
         const Geometry::Atlas::ChartBase<Mesh_>& _chart;
         const CoordType _inv;
+        /// the bounding box of the chart
+        WorldPointType _box_min, _box_max;
+        /// the sign of the signed distance outside of the bounding box; 0 if there is no bounding box
+        int _box_sign;
 
       public:
+        /// the charts' signed distance functions may be evaluated by several threads concurrently
+        static constexpr bool is_thread_safe = true;
+
         explicit ChartHitFunction(const Geometry::Atlas::ChartBase<Mesh_>& chart, bool invert) :
           _chart(chart),
-          _inv(CoordType(invert ? -1 : 1))
+          _inv(CoordType(invert ? -1 : 1)),
+          _box_min(),
+          _box_max(),
+          _box_sign(chart.get_bounding_box(_box_min, _box_max))
         {
         }
 
         bool operator()(const WorldPointType& point) const
         {
+          // points outside of the bounding box can be classified by the sign of the distance outside of the box
+          if((_box_sign != 0) && _is_outside_box(point))
+            return _inv * CoordType(_box_sign) <= CoordType(0);
           return _inv * _chart.signed_dist(point) <= CoordType(0);
         }
+
+      protected:
+        bool _is_outside_box(const WorldPointType& point) const
+        {
+          for(int i(0); i < WorldPointType::n; ++i)
+          {
+            if((point[i] < _box_min[i]) || (_box_max[i] < point[i]))
+              return true;
+          }
+          return false;
+        }
       };
 
     protected:
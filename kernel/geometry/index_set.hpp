@@ -164,6 +164,16 @@ namespace FEAT
         return _indices.size() * sizeof(IndexTupleType);
       }
 
+      /**
+       * \brief Releases the index vectors of this index set.
+       *
+       * After calling this function, the index set contains no entities anymore, but it keeps its index bound.
+       */
+      void clear()
+      {
+        std::vector<IndexTupleType>().swap(_indices);
+      }
+
       /**
        * \brief Returns the number of indices per entity.
        * \returns
@@ -466,6 +476,13 @@ namespace FEAT
       {
         return BaseClass::bytes() + _index_set.bytes();
       }
+
+      void clear(int min_face_dim)
+      {
+        BaseClass::clear(min_face_dim);
+        if(face_dim_ >= min_face_dim)
+          _index_set.clear();
+      }
     };
 
     template<typename Shape_>
@@ -562,6 +579,12 @@ namespace FEAT
       {
         return _index_set.bytes();
       }
+
+      void clear(int min_face_dim)
+      {
+        if(min_face_dim <= 0)
+          _index_set.clear();
+      }
     };
 
     /* ***************************************************************************************** */
@@ -753,6 +776,19 @@ namespace FEAT
       {
         return BaseClass::bytes() + _index_set_wrapper.bytes();
       }
+
+      /**
+       * \brief Releases index sets of this holder.
+       *
+       * \param[in] min_face_dim
+       * The minimum face dimension of the index sets of the highest dimensional cells that are to be released.
+       * All index sets of the lower dimensional cells are released regardless of this parameter.
+       */
+      void clear(int min_face_dim = 0)
+      {
+        BaseClass::clear(0);
+        _index_set_wrapper.clear(min_face_dim);
+      }
     };
 
     template<>
@@ -809,6 +845,10 @@ namespace FEAT
       {
         return std::size_t(0);
       }
+
+      void clear(int = 0)
+      {
+      }
     };
 
     /**
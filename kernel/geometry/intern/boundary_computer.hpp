@@ -111,6 +111,19 @@ namespace FEAT
       public:
         template<typename ParentIndexSetHolder_>
         explicit BoundaryFaceComputer(const ParentIndexSetHolder_& index_set_holder)
+        {
+          _compute(index_set_holder, nullptr);
+        }
+
+        template<typename ParentIndexSetHolder_>
+        explicit BoundaryFaceComputer(const ParentIndexSetHolder_& index_set_holder, const std::vector<int>& facet_mask)
+        {
+          _compute(index_set_holder, &facet_mask);
+        }
+
+      protected:
+        template<typename ParentIndexSetHolder_>
+        void _compute(const ParentIndexSetHolder_& index_set_holder, const std::vector<int>* facet_mask)
         {
           // Phase 1:
           // Compute all facets, i.e. (n-1)-dimensional faces, which reside on the boundary.
@@ -118,6 +131,8 @@ namespace FEAT
           // If the number of cells is exactly 1, the facet is a boundary facet.
 
           const auto& face_index_set = index_set_holder.template get_index_set<shape_dim_, shape_dim_-1>();
+          XASSERTM((facet_mask == nullptr) || (Index(facet_mask->size()) == face_index_set.get_index_bound()),
+            "invalid facet mask size");
 
           // allocate a temporary vector; this stores the number of cells adjacent to each facet
           std::vector<Index> caf(face_index_set.get_index_bound(), Index(0));
@@ -136,6 +151,9 @@ namespace FEAT
           {
             // for each conformal mesh, a facet must be adjacent to either 1 (boundary facet) or 2 (inner facet) cells.
             ASSERTM((caf[i] > 0) && (caf[i] < 3), "invalid number of cells at facet");
+            // facets excluded by the mask are no boundary facets
+            if((facet_mask != nullptr) && ((*facet_mask)[i] != 0))
+              caf[i] = Index(0);
             if(caf[i] == Index(1))
               ++count;
           }
@@ -153,6 +171,7 @@ namespace FEAT
           BaseClass::compute(index_set_holder, _faces);
         }
 
+      public:
         Index get_num_entities(int dim)
         {
           if(dim+1 == shape_dim_)
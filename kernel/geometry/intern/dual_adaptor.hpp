@@ -63,6 +63,7 @@ namespace FEAT
 
           // get fine mesh vertex set
           auto& vtx = mesh_f.get_vertex_set();
+          mesh_f.touch_vertices();
 
           // get coarse mesh facet index set
           const auto& facet = mesh_c.template get_index_set<shape_dim_, shape_dim_-1>();
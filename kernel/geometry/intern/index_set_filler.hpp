@@ -9,6 +9,7 @@
 
 // includes, FEAT
 #include <kernel/geometry/index_set.hpp>
+#include <kernel/geometry/intern/standard_refinement_traits.hpp>
 
 // includes, system
 #include <vector>
@@ -50,15 +51,23 @@ namespace FEAT
           // For every vertex in the parent, this will contain its index in the MeshPart
           std::vector<Index> inverse_target_map(index_set_parent.get_index_bound());
 
+          const Index num_parent_verts = index_set_parent.get_index_bound();
+          const Index num_verts = target_set_vertex.get_num_entities();
+          const Index num_cells = target_set_dim.get_num_entities();
+
           // Set every index to something out of range to catch errors
-          for(Index i(0); i < index_set_parent.get_index_bound(); ++i)
-            inverse_target_map[i] = target_set_vertex.get_num_entities() + Index(1);
+          FEAT_PRAGMA_OMP(parallel for schedule(static) if(num_parent_verts >= standard_refinement_min_parallel))
+          for(Index i = 0; i < num_parent_verts; ++i)
+            inverse_target_map[i] = num_verts + Index(1);
 
-          for(Index i(0); i < target_set_vertex.get_num_entities(); ++i)
+          // The target indices are unique, so each entry is written by at most one thread
+          FEAT_PRAGMA_OMP(parallel for schedule(static) if(num_verts >= standard_refinement_min_parallel))
+          for(Index i = 0; i < num_verts; ++i)
             inverse_target_map[target_set_vertex[i]] = i;
 
           // Now we can just iterate over the shapes of the MeshPart
-          for(Index cell(0); cell < target_set_dim.get_num_entities(); ++cell)
+          FEAT_PRAGMA_OMP(parallel for schedule(static) if(num_cells >= standard_refinement_min_parallel))
+          for(Index cell = 0; cell < num_cells; ++cell)
           {
             // For the shape cell, get its index in the parent. Then get the local vertex' index in the parent and
             // map that back to the MeshPart with the inverse_target_map. Ez!
@@ -0,0 +1,263 @@
+// FEAT3: Finite Element Analysis Toolbox, Version 3
+// Copyright (C) 2010 - 2023 by Stefan Turek & the FEAT group
+// FEAT3 is released under the GNU General Public License version 3,
+// see the file 'copyright.txt' in the top level directory for details.
+
+#pragma once
+#ifndef KERNEL_GEOMETRY_INTERN_SFC_KEY_HPP
+#define KERNEL_GEOMETRY_INTERN_SFC_KEY_HPP 1
+
+// includes, FEAT
+#include <kernel/base_header.hpp>
+#include <kernel/util/tiny_algebra.hpp>
+
+// includes, system
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace FEAT
+{
+  namespace Geometry
+  {
+    /**
+     * \brief Space-filling curve enumeration
+     */
+    enum class SFCurve
+    {
+      /// Hilbert curve
+      hilbert = 0,
+      /// Morton curve a.k.a. Z-order curve
+      morton
+    };
+
+    /// \cond internal
+    namespace Intern
+    {
+      /**
+       * \brief Space-filling curve key computation helper
+       *
+       * This class computes Hilbert and Morton keys of points in 1D, 2D and 3D. The points are
+       * mapped onto an integer grid with 2^num_bits points per dimension, which spans the bounding
+       * box passed to the constructor, and the grid coordinates are encoded into a single 64-bit key
+       * by using the algorithm of J. Skilling: "Programming the Hilbert curve", AIP Conf. Proc. 707,
+       * 2004.
+       *
+       * \tparam dim_
+       * The number of coordinates of the points.
+       */
+      template<int dim_>
+      class SFCKey
+      {
+      public:
+        static_assert((0 < dim_) && (dim_ <= 3), "invalid point dimension");
+
+        /// the number of bits per dimension
+        static constexpr int num_bits = (dim_ == 1 ? 63 : 63 / dim_);
+
+      protected:
+        /// the lower left corner of the bounding box
+        Tiny::Vector<double, dim_> _box_min;
+        /// the scaling factors for each dimension
+        Tiny::Vector<double, dim_> _scale;
+
+      public:
+        /**
+         * \brief Constructor
+         *
+         * \param[in] box_min, box_max
+         * The corners of the bounding box of all points that are to be encoded.
+         */
+        template<typename Coord_, int sn_>
+        explicit SFCKey(const Tiny::Vector<Coord_, dim_, sn_>& box_min, const Tiny::Vector<Coord_, dim_, sn_>& box_max)
+        {
+          // use the same scaling factor in each dimension to preserve the aspect ratio of the domain
+          double ext(0.0);
+          for(int i(0); i < dim_; ++i)
+            ext = Math::max(ext, double(box_max[i]) - double(box_min[i]));
+          const double grid_max = double((std::uint64_t(1) << num_bits) - 1u);
+          for(int i(0); i < dim_; ++i)
+          {
+            _box_min[i] = double(box_min[i]);
+            _scale[i] = (ext > 0.0 ? grid_max / ext : 0.0);
+          }
+        }
+
+        /// computes the curve key of a point
+        template<typename Coord_, int sn_>
+        std::uint64_t operator()(const Tiny::Vector<Coord_, dim_, sn_>& point, SFCurve curve) const
+        {
+          std::uint64_t x[dim_];
+          const double grid_max = double((std::uint64_t(1) << num_bits) - 1u);
+          for(int i(0); i < dim_; ++i)
+            x[i] = std::uint64_t(Math::max(0.0, Math::min(grid_max, (double(point[i]) - _box_min[i]) * _scale[i])));
+          // note: the 1D Hilbert curve is the identity
+          if((curve == SFCurve::hilbert) && (dim_ > 1))
+            axes_to_transpose(x);
+          return interleave(x);
+        }
+
+        /**
+         * \brief Transforms grid coordinates into the transposed Hilbert index
+         *
+         * \param[inout] x
+         * The grid coordinates which are transformed in-place.
+         */
+        static void axes_to_transpose(std::uint64_t* x)
+        {
+          const std::uint64_t m = std::uint64_t(1) << (num_bits - 1);
+
+          // inverse undo excess work
+          for(std::uint64_t q(m); q > 1u; q >>= 1)
+          {
+            const std::uint64_t p = q - 1u;
+            for(int i(0); i < dim_; ++i)
+            {
+              if((x[i] & q) != 0u)
+                x[0] ^= p; // invert
+              else
+              {
+                // exchange
+                const std::uint64_t t = (x[0] ^ x[i]) & p;
+                x[0] ^= t;
+                x[i] ^= t;
+              }
+            }
+          }
+
+          // Gray encode
+          for(int i(1); i < dim_; ++i)
+            x[i] ^= x[i-1];
+          std::uint64_t t(0u);
+          for(std::uint64_t q(m); q > 1u; q >>= 1)
+          {
+            if((x[dim_-1] & q) != 0u)
+              t ^= q - 1u;
+          }
+          for(int i(0); i < dim_; ++i)
+            x[i] ^= t;
+        }
+
+        /// interleaves the bits of the grid coordinates into a single key
+        static std::uint64_t interleave(const std::uint64_t* x)
+        {
+          std::uint64_t key(0u);
+          for(int b(num_bits - 1); b >= 0; --b)
+          {
+            for(int i(0); i < dim_; ++i)
+              key = (key << 1) | ((x[i] >> b) & 1u);
+          }
+          return key;
+        }
+
+        /**
+         * \brief Computes the curve keys of the barycenters of mesh entities.
+         *
+         * \param[out] keys
+         * Receives the keys of all entities.
+         *
+         * \param[in] idx
+         * The vertices-at-entity index set.
+         *
+         * \param[in] vtx
+         * The vertex set of the mesh.
+         *
+         * \param[in] curve
+         * The space-filling curve to be used.
+         */
+        template<typename IndexSet_, typename VertexSet_>
+        void compute_entity_keys(std::vector<std::uint64_t>& keys, const IndexSet_& idx, const VertexSet_& vtx, SFCurve curve) const
+        {
+          const Index n = idx.get_num_entities();
+          const int nidx = idx.get_num_indices();
+          const double scale = 1.0 / double(nidx);
+          keys.resize(n);
+          for(Index i(0); i < n; ++i)
+          {
+            Tiny::Vector<double, dim_> v(0.0);
+            for(int j(0); j < nidx; ++j)
+            {
+              const auto& w = vtx[idx(i, j)];
+              for(int k(0); k < dim_; ++k)
+                v[k] += double(w[k]);
+            }
+            keys[i] = (*this)(v * scale, curve);
+          }
+        }
+
+        /**
+         * \brief Computes the curve keys of the vertices of a mesh.
+         *
+         * \param[out] keys
+         * Receives the keys of all vertices.
+         *
+         * \param[in] vtx
+         * The vertex set of the mesh.
+         *
+         * \param[in] curve
+         * The space-filling curve to be used.
+         */
+        template<typename VertexSet_>
+        void compute_vertex_keys(std::vector<std::uint64_t>& keys, const VertexSet_& vtx, SFCurve curve) const
+        {
+          const Index n = vtx.get_num_vertices();
+          keys.resize(n);
+          for(Index i(0); i < n; ++i)
+            keys[i] = (*this)(vtx[i], curve);
+        }
+
+        /**
+         * \brief Creates a key computation object for the bounding box of a vertex set.
+         *
+         * \param[in] vtx
+         * The vertex set whose bounding box is to be used.
+         */
+        template<typename VertexSet_>
+        static SFCKey from_vertex_set(const VertexSet_& vtx)
+        {
+          typedef typename VertexSet_::CoordType CoordType;
+          Tiny::Vector<CoordType, dim_> box_min(CoordType(0)), box_max(CoordType(0));
+          const Index n = vtx.get_num_vertices();
+          if(n > Index(0))
+          {
+            box_min = box_max = vtx[0];
+          }
+          for(Index i(1); i < n; ++i)
+          {
+            for(int k(0); k < dim_; ++k)
+            {
+              box_min[k] = Math::min(box_min[k], vtx[i][k]);
+              box_max[k] = Math::max(box_max[k], vtx[i][k]);
+            }
+          }
+          return SFCKey(box_min, box_max);
+        }
+
+        /**
+         * \brief Sorts a set of indices by their keys.
+         *
+         * \param[in] keys
+         * The keys of the entities.
+         *
+         * \returns
+         * A vector containing the entity indices sorted by ascending keys; entities with equal keys
+         * are sorted by their indices.
+         */
+        static std::vector<Index> sort_by_keys(const std::vector<std::uint64_t>& keys)
+        {
+          std::vector<Index> order(keys.size());
+          for(std::size_t i(0); i < order.size(); ++i)
+            order[i] = Index(i);
+          std::sort(order.begin(), order.end(), [&keys](Index a, Index b)
+          {
+            return (keys[a] < keys[b]) || ((keys[a] == keys[b]) && (a < b));
+          });
+          return order;
+        }
+      }; // class SFCKey<...>
+    } // namespace Intern
+    /// \endcond
+  } // namespace Geometry
+} // namespace FEAT
+
+#endif // KERNEL_GEOMETRY_INTERN_SFC_KEY_HPP
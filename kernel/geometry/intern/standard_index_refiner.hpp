@@ -69,7 +69,8 @@ namespace FEAT
           const Index num_edges = index_set_e_v.get_num_entities();
 
           // loop over all coarse mesh edges
-          for(Index i(0); i < num_edges; ++i)
+          FEAT_PRAGMA_OMP(parallel for schedule(static) if(num_edges >= standard_refinement_min_parallel))
+          for(Index i = 0; i < num_edges; ++i)
           {
             // fetch coarse mesh vertices-at-edge index vector
             const IndexTupleTypeEV& e_v = index_set_e_v[i];
@@ -152,7 +153,8 @@ namespace FEAT
           */
 
           // loop over all coarse mesh simplices
-          for(Index i(0); i < num_simps; ++i)
+          FEAT_PRAGMA_OMP(parallel for schedule(static) if(num_simps >= standard_refinement_min_parallel))
+          for(Index i = 0; i < num_simps; ++i)
           {
             // fetch coarse mesh edges-at-triangle index vector
             const IndexTupleTypeSE& s_e = index_set_s_e[i];
@@ -239,7 +241,8 @@ namespace FEAT
           */
 
           // loop over all coarse mesh simplices
-          for(Index i(0); i < num_simps; ++i)
+          FEAT_PRAGMA_OMP(parallel for schedule(static) if(num_simps >= standard_refinement_min_parallel))
+          for(Index i = 0; i < num_simps; ++i)
           {
             // fetch coarse mesh vertices-at-triangle and edges-at-triangle index vectors
             const IndexTupleTypeSV& s_v = index_set_s_v[i];
@@ -340,7 +343,8 @@ namespace FEAT
           */
 
           // loop over all coarse mesh simplices
-          for(Index i(0); i < num_simps; ++i)
+          FEAT_PRAGMA_OMP(parallel for schedule(static) if(num_simps >= standard_refinement_min_parallel))
+          for(Index i = 0; i < num_simps; ++i)
           {
             // fetch coarse mesh index vectors
             const IndexTupleTypeSV& s_v = index_set_s_v[i];
@@ -460,7 +464,8 @@ namespace FEAT
 
 
           // loop over all coarse mesh simplices
-          for(Index i(0); i < num_simps; ++i)
+          FEAT_PRAGMA_OMP(parallel for schedule(static) if(num_simps >= standard_refinement_min_parallel))
+          for(Index i = 0; i < num_simps; ++i)
           {
             // fetch coarse mesh simplex-at-edge index vector
             const IndexTupleTypeSE& s_e = index_set_s_e[i];
@@ -576,7 +581,8 @@ namespace FEAT
           */
 
           // loop over all coarse mesh simplices
-          for(Index i(0); i < num_simps; ++i)
+          FEAT_PRAGMA_OMP(parallel for schedule(static) if(num_simps >= standard_refinement_min_parallel))
+          for(Index i = 0; i < num_simps; ++i)
           {
             // fetch coarse mesh edges-at-simplex index vectors
             const IndexTupleTypeSE& s_e = index_set_s_e[i];
@@ -756,7 +762,8 @@ namespace FEAT
           */
 
           // loop over all coarse mesh simplices
-          for(Index i(0); i < num_simps; ++i)
+          FEAT_PRAGMA_OMP(parallel for schedule(static) if(num_simps >= standard_refinement_min_parallel))
+          for(Index i = 0; i < num_simps; ++i)
           {
             // fetch coarse mesh index vectors
             const IndexTupleTypeSE& s_e = index_set_s_e[i];
@@ -902,7 +909,8 @@ namespace FEAT
           typedef Intern::SubIndexMapping<ShapeType, cell_dim, face_dim> SubIndexMappingType;
 
           // loop over all coarse mesh simplices
-          for(Index i(0); i < num_simps; ++i)
+          FEAT_PRAGMA_OMP(parallel for schedule(static) if(num_simps >= standard_refinement_min_parallel))
+          for(Index i = 0; i < num_simps; ++i)
           {
             // fetch coarse mesh vertices-at-simplex and edges-at-simplex index vectors
             const IndexTupleTypeSV& s_v = index_set_s_v[i];
@@ -1067,7 +1075,8 @@ namespace FEAT
           typedef Intern::SubIndexMapping<ShapeType, face_dim, 0> EdgeIndexMappingType;
 
           // loop over all coarse mesh simplices
-          for(Index i(0); i < num_simps; ++i)
+          FEAT_PRAGMA_OMP(parallel for schedule(static) if(num_simps >= standard_refinement_min_parallel))
+          for(Index i = 0; i < num_simps; ++i)
           {
             // fetch coarse mesh index vectors
             const IndexTupleTypeSV& s_v = index_set_s_v[i];
@@ -1241,7 +1250,8 @@ namespace FEAT
           typedef Intern::SubIndexMapping<ShapeType, face_dim, 0> SubIndexMappingType;
 
           // loop over all coarse mesh simplices
-          for(Index i(0); i < num_simps; ++i)
+          FEAT_PRAGMA_OMP(parallel for schedule(static) if(num_simps >= standard_refinement_min_parallel))
+          for(Index i = 0; i < num_simps; ++i)
           {
             // fetch coarse mesh vertices-at-simplex and triangle-at-simplex index vectors
             const IndexTupleTypeSV& s_v = index_set_s_v[i];
@@ -1380,7 +1390,8 @@ namespace FEAT
           const Index num_edges = index_set_e_v.get_num_entities();
 
           // loop over all coarse mesh edges
-          for(Index i(0); i < num_edges; ++i)
+          FEAT_PRAGMA_OMP(parallel for schedule(static) if(num_edges >= standard_refinement_min_parallel))
+          for(Index i = 0; i < num_edges; ++i)
           {
             // fetch coarse mesh vertices-at-edge index vector
             const IndexTupleTypeEV& e_v = index_set_e_v[i];
@@ -1467,7 +1478,8 @@ namespace FEAT
 
 
           // loop over all coarse mesh edges
-          for(Index i(0); i < num_quads; ++i)
+          FEAT_PRAGMA_OMP(parallel for schedule(static) if(num_quads >= standard_refinement_min_parallel))
+          for(Index i = 0; i < num_quads; ++i)
           {
             // fetch coarse mesh edges-at-quad index vector
             const IndexTupleTypeQE& q_e = index_set_q_e[i];
@@ -1562,7 +1574,8 @@ namespace FEAT
           // v_0-----------e_0-----------v_1
 
           // loop over all coarse mesh quads
-          for(Index i(0); i < num_quads; ++i)
+          FEAT_PRAGMA_OMP(parallel for schedule(static) if(num_quads >= standard_refinement_min_parallel))
+          for(Index i = 0; i < num_quads; ++i)
           {
             // fetch coarse mesh vertices-at-quad and edges-at-quad index vectors
             const IndexTupleTypeQV& q_v = index_set_q_v[i];
@@ -1668,7 +1681,8 @@ namespace FEAT
           //   +----e_0_0----+----e_0_1----+
 
           // loop over all coarse mesh quads
-          for(Index i(0); i < num_quads; ++i)
+          FEAT_PRAGMA_OMP(parallel for schedule(static) if(num_quads >= standard_refinement_min_parallel))
+          for(Index i = 0; i < num_quads; ++i)
           {
             // fetch coarse mesh vertices-at-quad and edges-at-quad index vectors
             const IndexTupleTypeQV& q_v = index_set_q_v[i];
@@ -1773,7 +1787,8 @@ namespace FEAT
 
 
           // loop over all coarse mesh cubes
-          for(Index i(0); i < num_cubes; ++i)
+          FEAT_PRAGMA_OMP(parallel for schedule(static) if(num_cubes >= standard_refinement_min_parallel))
+          for(Index i = 0; i < num_cubes; ++i)
           {
             // fetch coarse mesh quad-at-cube index vector
             const IndexTupleTypeCQ& c_q = index_set_c_q[i];
@@ -1912,7 +1927,8 @@ namespace FEAT
           //
 
           // loop over all coarse mesh cubes
-          for(Index i(0); i < num_cubes; ++i)
+          FEAT_PRAGMA_OMP(parallel for schedule(static) if(num_cubes >= standard_refinement_min_parallel))
+          for(Index i = 0; i < num_cubes; ++i)
           {
             // fetch coarse mesh quad-at-cube and edges-at-cube index vectors
             const IndexTupleTypeCQ& c_q = index_set_c_q[i];
@@ -2077,7 +2093,8 @@ namespace FEAT
           //
 
           // loop over all coarse mesh cubes
-          for(Index i(0); i < num_cubes; ++i)
+          FEAT_PRAGMA_OMP(parallel for schedule(static) if(num_cubes >= standard_refinement_min_parallel))
+          for(Index i = 0; i < num_cubes; ++i)
           {
             // fetch coarse mesh index vectors
             const IndexTupleTypeCQ& c_q = index_set_c_q[i];
@@ -2279,7 +2296,8 @@ namespace FEAT
           //
 
           // loop over all coarse mesh cubes
-          for(Index i(0); i < num_cubes; ++i)
+          FEAT_PRAGMA_OMP(parallel for schedule(static) if(num_cubes >= standard_refinement_min_parallel))
+          for(Index i = 0; i < num_cubes; ++i)
           {
             // fetch coarse mesh vertices-at-quad and edges-at-quad index vectors
             const IndexTupleTypeCV& c_v = index_set_c_v[i];
@@ -2454,7 +2472,8 @@ namespace FEAT
           //
 
           // loop over all coarse mesh cubes
-          for(Index i(0); i < num_cubes; ++i)
+          FEAT_PRAGMA_OMP(parallel for schedule(static) if(num_cubes >= standard_refinement_min_parallel))
+          for(Index i = 0; i < num_cubes; ++i)
           {
             // fetch coarse mesh index vectors
             const IndexTupleTypeCV& c_v = index_set_c_v[i];
@@ -2669,7 +2688,8 @@ namespace FEAT
           //
 
           // loop over all coarse mesh cubes
-          for(Index i(0); i < num_cubes; ++i)
+          FEAT_PRAGMA_OMP(parallel for schedule(static) if(num_cubes >= standard_refinement_min_parallel))
+          for(Index i = 0; i < num_cubes; ++i)
           {
             // fetch coarse mesh vertices-at-cube and quads-at-cube index vectors
             const IndexTupleTypeCV& c_v = index_set_c_v[i];
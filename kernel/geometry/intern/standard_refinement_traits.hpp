@@ -17,6 +17,16 @@ namespace FEAT
     /// \cond internal
     namespace Intern
     {
+      /**
+       * \brief Minimum number of coarse entities for parallel refinement
+       *
+       * All standard refiners write the refined entities of each coarse entity to a fixed offset,
+       * which is determined by the coarse entity index only, so the refinement loops can be
+       * executed by multiple threads and still yield the same result as the serial refinement.
+       * The loops are only parallelized if the number of coarse entities reaches this threshold.
+       */
+      static constexpr Index standard_refinement_min_parallel = Index(4096);
+
       /**
        * \brief Standard Refinement traits class template
        *
@@ -10,6 +10,7 @@
 // includes, FEAT
 #include <kernel/geometry/index_set.hpp>
 #include <kernel/geometry/target_set.hpp>
+#include <kernel/geometry/intern/standard_refinement_traits.hpp>
 #include <kernel/geometry/intern/target_index_mapping.hpp>
 
 namespace FEAT
@@ -40,7 +41,8 @@ namespace FEAT
           const Index num_verts = target_set_holder_in.get_num_entities(0);
           const TargetSetType& target_set_in = target_set_holder_in.get_target_set<0>();
 
-          for(Index i(0); i < num_verts; ++i)
+          FEAT_PRAGMA_OMP(parallel for schedule(static) if(num_verts >= standard_refinement_min_parallel))
+          for(Index i = 0; i < num_verts; ++i)
           {
             target_set_out[i] = index_offsets[0] + target_set_in[offset + i];
           }
@@ -75,7 +77,8 @@ namespace FEAT
           Index num_cells = target_set_in.get_num_entities();
 
           // set target indices
-          for(Index i(0); i < num_cells; ++i)
+          FEAT_PRAGMA_OMP(parallel for schedule(static) if(num_cells >= standard_refinement_min_parallel))
+          for(Index i = 0; i < num_cells; ++i)
           {
             target_set_out[offset + i] = index_offsets[shape_dim_] + target_set_in[i];
           }
@@ -126,7 +129,8 @@ namespace FEAT
           Index num_cells = target_set_e.get_num_entities();
 
           // set target indices
-          for(Index i(0); i < num_cells; ++i)
+          FEAT_PRAGMA_OMP(parallel for schedule(static) if(num_cells >= standard_refinement_min_parallel))
+          for(Index i = 0; i < num_cells; ++i)
           {
             // fetch edge target index
             const Index trg_e = target_set_e[i];
@@ -219,7 +223,8 @@ namespace FEAT
           Index num_cells = target_set_t.get_num_entities();
 
           // set target indices
-          for(Index i(0); i < num_cells; ++i)
+          FEAT_PRAGMA_OMP(parallel for schedule(static) if(num_cells >= standard_refinement_min_parallel))
+          for(Index i = 0; i < num_cells; ++i)
           {
             // fetch tria target index
             const Index trg_t = target_set_t[i];
@@ -289,7 +294,8 @@ namespace FEAT
           Index num_cells = target_set_t.get_num_entities();
 
           // set target indices
-          for(Index i(0); i < num_cells; ++i)
+          FEAT_PRAGMA_OMP(parallel for schedule(static) if(num_cells >= standard_refinement_min_parallel))
+          for(Index i = 0; i < num_cells; ++i)
           {
             // fetch tria target index
             const Index trg_t = target_set_t[i];
@@ -406,7 +412,8 @@ namespace FEAT
           Index num_cells = target_set_in.get_num_entities();
 
           // set target indices
-          for(Index i(0); i < num_cells; ++i)
+          FEAT_PRAGMA_OMP(parallel for schedule(static) if(num_cells >= standard_refinement_min_parallel))
+          for(Index i = 0; i < num_cells; ++i)
           {
             target_set_out[offset + i] = index_offsets[shape_dim_] + target_set_in[i];
           }
@@ -457,7 +464,8 @@ namespace FEAT
           Index num_cells = target_set_e.get_num_entities();
 
           // set target indices
-          for(Index i(0); i < num_cells; ++i)
+          FEAT_PRAGMA_OMP(parallel for schedule(static) if(num_cells >= standard_refinement_min_parallel))
+          for(Index i = 0; i < num_cells; ++i)
           {
             // fetch edge target index
             const Index trg_e = target_set_e[i];
@@ -527,7 +535,8 @@ namespace FEAT
           Index num_cells = target_set_q.get_num_entities();
 
           // set target indices
-          for(Index i(0); i < num_cells; ++i)
+          FEAT_PRAGMA_OMP(parallel for schedule(static) if(num_cells >= standard_refinement_min_parallel))
+          for(Index i = 0; i < num_cells; ++i)
           {
             // fetch quad target index
             const Index trg_q = target_set_q[i];
@@ -600,7 +609,8 @@ namespace FEAT
           Index num_cells = target_set_q.get_num_entities();
 
           // set target indices
-          for(Index i(0); i < num_cells; ++i)
+          FEAT_PRAGMA_OMP(parallel for schedule(static) if(num_cells >= standard_refinement_min_parallel))
+          for(Index i = 0; i < num_cells; ++i)
           {
             // fetch quad target index
             const Index trg_q = target_set_q[i];
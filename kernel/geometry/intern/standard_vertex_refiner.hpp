@@ -43,7 +43,8 @@ namespace FEAT
           XASSERT(vertex_set_out.get_num_vertices() >= offset+num_verts);
 
           // loop over all vertices
-          for(Index i(0); i < num_verts; ++i)
+          FEAT_PRAGMA_OMP(parallel for schedule(static) if(num_verts >= standard_refinement_min_parallel))
+          for(Index i = 0; i < num_verts; ++i)
           {
             // copy source vertex
             vertex_set_out[offset + i] = vertex_set_in[i];
@@ -86,7 +87,8 @@ namespace FEAT
           XASSERT(vertex_set_out.get_num_vertices() >= offset+num_cells);
 
           // loop over all cells
-          for(Index i(0); i < num_cells; ++i)
+          FEAT_PRAGMA_OMP(parallel for schedule(static) if(num_cells >= standard_refinement_min_parallel))
+          for(Index i = 0; i < num_cells; ++i)
           {
             // get input index vector
             const IndexTupleType& idx_in = index_set_in[i];
@@ -141,7 +143,8 @@ namespace FEAT
           XASSERT(vertex_set_out.get_num_vertices() >= offset+num_cells);
 
           // loop over all cells
-          for(Index i(0); i < num_cells; ++i)
+          FEAT_PRAGMA_OMP(parallel for schedule(static) if(num_cells >= standard_refinement_min_parallel))
+          for(Index i = 0; i < num_cells; ++i)
           {
             // get input index vector
             const IndexTupleType& idx_in = index_set_in[i];
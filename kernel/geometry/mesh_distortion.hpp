@@ -101,6 +101,7 @@ namespace FEAT
         _calc_boundary_vertices();
 
         auto& vtx = _mesh.get_vertex_set();
+        _mesh.touch_vertices();
 
         if(world_dim == 2)
         {
@@ -181,6 +182,7 @@ namespace FEAT
         CoordType rad;
 
         auto& vtx = _mesh.get_vertex_set();
+        _mesh.touch_vertices();
 
         if(world_dim == 2)
         {
@@ -520,6 +522,7 @@ namespace FEAT
         _calc_vertex_owners();
 
         auto& vertex_set = _root_mesh_node.get_mesh()->get_vertex_set();
+        _root_mesh_node.get_mesh()->touch_vertices();
 
         const int my_rank = _comm.rank();
 
@@ -8,6 +8,10 @@
 #include <kernel/geometry/test_aux/validate_neighbors.hpp>
 #include <kernel/geometry/mesh_node.hpp>
 
+#ifdef FEAT_HAVE_OMP
+#include <omp.h>
+#endif
+
 using namespace FEAT;
 using namespace FEAT::TestSystem;
 using namespace FEAT::Geometry;
@@ -148,3 +152,144 @@ public:
   }
 
 } mesh_node_test_conf_quad;
+
+/**
+ * \brief Test class for the concurrent refinement of the MeshNode class template.
+ *
+ * \test Tests whether the refinement of a mesh tree with several mesh parts, halos and patches
+ * yields bitwise identical results with one and with multiple threads.
+ */
+class MeshNodeParallelRefineTestConfQuad
+  : public TestSystem::UnitTest
+{
+public:
+  MeshNodeParallelRefineTestConfQuad() :
+    TestSystem::UnitTest("mesh_node-parallel-refine-test-conf-quad")
+  {
+  }
+
+  virtual ~MeshNodeParallelRefineTestConfQuad()
+  {
+  }
+
+  static std::unique_ptr<MeshPartType> make_part(MeshPartType* part)
+  {
+    return std::unique_ptr<MeshPartType>(part);
+  }
+
+  static std::unique_ptr<RootMeshNodeType> create_tree()
+  {
+    std::unique_ptr<RootMeshNodeType> node = RootMeshNodeType::make_unique(std::unique_ptr<RootMeshType>(create_tetris_mesh_2d()));
+    MeshPartNodeType* quad_node = node->add_mesh_part("0", make_part(create_tetris_quad_submesh_2d()));
+    node->add_mesh_part("1", make_part(create_tetris_edge_submesh_2d()));
+    quad_node->add_mesh_part("2", make_part(create_tetris_quad_edge_submesh_2d()));
+    node->add_mesh_part("7", make_part(create_tetris_quad_cellsubset_2d()));
+    node->add_mesh_part("42", make_part(create_tetris_quad_edge_cellsubset_2d()));
+    for(int i(0); i < 4; ++i)
+    {
+      node->add_halo(i, make_part(create_tetris_edge_submesh_2d()));
+      node->add_patch(i, make_part(create_tetris_quad_cellsubset_2d()));
+    }
+    return node;
+  }
+
+  template<int dim_>
+  static bool compare_index_sets(const RootMeshType& mesh_1, const RootMeshType& mesh_2)
+  {
+    const auto& idx_1 = mesh_1.template get_index_set<dim_, 0>();
+    const auto& idx_2 = mesh_2.template get_index_set<dim_, 0>();
+    if(idx_1.get_num_entities() != idx_2.get_num_entities())
+      return false;
+    for(Index i(0); i < idx_1.get_num_entities(); ++i)
+      for(int j(0); j < idx_1.get_num_indices(); ++j)
+        if(idx_1(i, j) != idx_2(i, j))
+          return false;
+    return true;
+  }
+
+  template<int dim_>
+  static bool compare_target_set(const MeshPartType& part_1, const MeshPartType& part_2)
+  {
+    const auto& ts_1 = part_1.template get_target_set<dim_>();
+    const auto& ts_2 = part_2.template get_target_set<dim_>();
+    if(ts_1.get_num_entities() != ts_2.get_num_entities())
+      return false;
+    for(Index i(0); i < ts_1.get_num_entities(); ++i)
+      if(ts_1[i] != ts_2[i])
+        return false;
+    return true;
+  }
+
+  static bool compare_target_sets(const MeshPartType& part_1, const MeshPartType& part_2)
+  {
+    return compare_target_set<0>(part_1, part_2) && compare_target_set<1>(part_1, part_2) &&
+      compare_target_set<2>(part_1, part_2);
+  }
+
+  static bool compare_parts(const MeshPartNodeType& node_1, const MeshPartNodeType& node_2)
+  {
+    if(!compare_target_sets(*node_1.get_mesh(), *node_2.get_mesh()))
+      return false;
+    for(const auto& name : node_1.get_mesh_part_names())
+    {
+      const MeshPartNodeType* sub_2 = node_2.find_mesh_part_node(name);
+      if((sub_2 == nullptr) || !compare_parts(*node_1.find_mesh_part_node(name), *sub_2))
+        return false;
+    }
+    return true;
+  }
+
+  virtual void run() const override
+  {
+    std::unique_ptr<RootMeshNodeType> node_s = create_tree();
+    std::unique_ptr<RootMeshNodeType> node_p = create_tree();
+
+#ifdef FEAT_HAVE_OMP
+    const int max_threads = omp_get_max_threads();
+#endif
+    for(int lvl(0); lvl < 3; ++lvl)
+    {
+#ifdef FEAT_HAVE_OMP
+      omp_set_num_threads(1);
+#endif
+      node_s = node_s->refine_unique();
+#ifdef FEAT_HAVE_OMP
+      omp_set_num_threads(Math::max(max_threads, 4));
+#endif
+      node_p = node_p->refine_unique();
+    }
+#ifdef FEAT_HAVE_OMP
+    omp_set_num_threads(max_threads);
+#endif
+
+    // compare root meshes bitwise
+    const RootMeshType& mesh_s = *node_s->get_mesh();
+    const RootMeshType& mesh_p = *node_p->get_mesh();
+    TEST_CHECK_EQUAL(mesh_s.get_num_vertices(), mesh_p.get_num_vertices());
+    TEST_CHECK_EQUAL(mesh_s.get_num_elements(), mesh_p.get_num_elements());
+    const auto& vtx_s = mesh_s.get_vertex_set();
+    const auto& vtx_p = mesh_p.get_vertex_set();
+    for(Index i(0); i < vtx_s.get_num_vertices(); ++i)
+    {
+      TEST_CHECK(vtx_s[i][0] == vtx_p[i][0]);
+      TEST_CHECK(vtx_s[i][1] == vtx_p[i][1]);
+    }
+    TEST_CHECK(compare_index_sets<1>(mesh_s, mesh_p));
+    TEST_CHECK(compare_index_sets<2>(mesh_s, mesh_p));
+
+    // compare mesh part trees
+    for(const auto& name : node_s->get_mesh_part_names())
+    {
+      const MeshPartNodeType* part_p = node_p->find_mesh_part_node(name);
+      TEST_CHECK(part_p != nullptr);
+      TEST_CHECK(compare_parts(*node_s->find_mesh_part_node(name), *part_p));
+    }
+
+    // compare halos and patches
+    for(int i(0); i < 4; ++i)
+    {
+      TEST_CHECK(compare_target_sets(*node_s->get_halo(i), *node_p->get_halo(i)));
+      TEST_CHECK(compare_target_sets(*node_s->get_patch(i), *node_p->get_patch(i)));
+    }
+  }
+} mesh_node_parallel_refine_test_conf_quad;
@@ -25,6 +25,7 @@
 #include <set>
 #include <map>
 #include <deque>
+#include <exception>
 #include <vector>
 
 namespace FEAT
@@ -570,13 +571,60 @@ namespace FEAT
        */
       void refine_mesh_parts(MeshNode& refined_node) const
       {
+        std::vector<std::unique_ptr<MeshPartNodeType>> refined_parts = this->_refine_mesh_part_nodes();
+
         MeshPartNodeConstIterator it(_mesh_part_nodes.begin());
         MeshPartNodeConstIterator jt(_mesh_part_nodes.end());
 
-        for(; it != jt; ++it)
+        for(std::size_t k(0); it != jt; ++it, ++k)
+        {
+          refined_node.add_mesh_part_node(it->first, std::move(refined_parts[k]), it->second.chart_name, it->second.chart);
+        }
+      }
+
+      /**
+       * \brief Refines all child MeshPart nodes of this node concurrently.
+       *
+       * The mesh part nodes are independent of each other, so they are refined by multiple threads
+       * (if available), whereas the insertion into the refined node is left to the caller.
+       *
+       * \returns
+       * A vector of the refined mesh part nodes in the order of the mesh part node container.
+       */
+      std::vector<std::unique_ptr<MeshPartNodeType>> _refine_mesh_part_nodes() const
+      {
+        std::vector<const MeshPartNodeType*> coarse_parts;
+        coarse_parts.reserve(_mesh_part_nodes.size());
+        for(auto it = _mesh_part_nodes.begin(); it != _mesh_part_nodes.end(); ++it)
+          coarse_parts.push_back(it->second.node.get());
+
+        const std::size_t num_parts = coarse_parts.size();
+        std::vector<std::unique_ptr<MeshPartNodeType>> refined_parts(num_parts);
+
+        // exceptions must not escape the parallel region, so capture them and rethrow afterwards
+        std::vector<std::exception_ptr> errors(num_parts);
+
+        FEAT_PRAGMA_OMP(parallel for schedule(dynamic, 1) if(num_parts > std::size_t(1)))
+        for(std::size_t k = 0; k < num_parts; ++k)
+        {
+          try
+          {
+            refined_parts[k] = coarse_parts[k]->refine(*_mesh);
+          }
+          catch(...)
+          {
+            errors[k] = std::current_exception();
+          }
+        }
+
+        // rethrow the first captured exception in container order
+        for(const auto& e : errors)
         {
-          refined_node.add_mesh_part_node(it->first, it->second.node->refine(*_mesh), it->second.chart_name, it->second.chart);
+          if(e)
+            std::rethrow_exception(e);
         }
+
+        return refined_parts;
       }
     }; // class MeshNode
 
@@ -717,11 +765,13 @@ namespace FEAT
        */
       void refine_mesh_parts(MeshPartNode& refined_node) const
       {
+        auto refined_parts = this->_refine_mesh_part_nodes();
+
         typename BaseClass::MeshPartNodeConstIterator it(this->_mesh_part_nodes.begin());
         typename BaseClass::MeshPartNodeConstIterator jt(this->_mesh_part_nodes.end());
-        for(; it != jt; ++it)
+        for(std::size_t k(0); it != jt; ++it, ++k)
         {
-          refined_node.add_mesh_part_node(it->first, it->second.node->refine(*this->_mesh));
+          refined_node.add_mesh_part_node(it->first, std::move(refined_parts[k]));
         }
       }
 
@@ -816,6 +866,12 @@ namespace FEAT
         return _atlas;
       }
 
+      /// \returns A pointer to the underlying mesh atlas; may return \c nullptr.
+      MeshAtlasType* get_atlas()
+      {
+        return _atlas;
+      }
+
       /**
        * \brief Creates a new RootMeshNode on the heap and returns a unique pointer to it
        *
@@ -992,17 +1048,19 @@ namespace FEAT
         this->refine_children(*fine_node);
 
         // refine our halos
-        for(const auto& v : _halos)
         {
-          StandardRefinery<MeshPartType> halo_refinery(*v.second, *this->_mesh);
-          fine_node->add_halo(v.first, halo_refinery.make_unique());
+          auto fine_halos = _refine_mesh_parts(_halos);
+          std::size_t k(0);
+          for(const auto& v : _halos)
+            fine_node->add_halo(v.first, std::move(fine_halos[k++]));
         }
 
         // refine our patch mesh-parts
-        for(const auto& v : _patches)
         {
-          StandardRefinery<MeshPartType> patch_refinery(*v.second, *this->_mesh);
-          fine_node->add_patch(v.first, patch_refinery.make_unique());
+          auto fine_patches = _refine_mesh_parts(_patches);
+          std::size_t k(0);
+          for(const auto& v : _patches)
+            fine_node->add_patch(v.first, std::move(fine_patches[k++]));
         }
 
         // adapt by chart?
@@ -1327,6 +1385,44 @@ namespace FEAT
             it->second->permute(mesh_perm);
         }
       }
+
+      /// helper function: refines all halos or patches concurrently and returns them in container order
+      std::vector<std::unique_ptr<MeshPartType>> _refine_mesh_parts(const std::map<int, std::unique_ptr<MeshPartType>>& parts) const
+      {
+        std::vector<const MeshPartType*> coarse_parts;
+        coarse_parts.reserve(parts.size());
+        for(const auto& v : parts)
+          coarse_parts.push_back(v.second.get());
+
+        const std::size_t num_parts = coarse_parts.size();
+        std::vector<std::unique_ptr<MeshPartType>> fine_parts(num_parts);
+
+        // exceptions must not escape the parallel region, so capture them and rethrow afterwards
+        std::vector<std::exception_ptr> errors(num_parts);
+
+        FEAT_PRAGMA_OMP(parallel for schedule(dynamic, 1) if(num_parts > std::size_t(1)))
+        for(std::size_t k = 0; k < num_parts; ++k)
+        {
+          try
+          {
+            StandardRefinery<MeshPartType> refinery(*coarse_parts[k], *this->_mesh);
+            fine_parts[k] = refinery.make_unique();
+          }
+          catch(...)
+          {
+            errors[k] = std::current_exception();
+          }
+        }
+
+        // rethrow the first captured exception in container order
+        for(const auto& e : errors)
+        {
+          if(e)
+            std::rethrow_exception(e);
+        }
+
+        return fine_parts;
+      }
     }; // class RootMeshNode
 
 #ifdef FEAT_EICKT
@@ -13,6 +13,7 @@
 #include <kernel/adjacency/graph.hpp>
 #include <kernel/adjacency/permutation.hpp>
 #include <kernel/geometry/index_set.hpp>
+#include <kernel/geometry/intern/sfc_key.hpp>
 #include <kernel/geometry/target_set.hpp>
 #include <kernel/geometry/vertex_set.hpp>
 
@@ -183,6 +184,65 @@ namespace FEAT
           perms.front() = std::move(p);
         }
       }; // class LexiPermuter<...,0>
+
+      /// helper class to compute Hilbert curve permutation
+      template<typename Shape_, int shape_dim_ = Shape_::dimension>
+      class HilbertPermuter
+      {
+      public:
+        template<int nc_, typename Coord_>
+        static void compute(
+          std::array<Adjacency::Permutation, Shape_::dimension + 1>& perms,
+          const IndexSetHolder<Shape_>& ish, const VertexSet<nc_, Coord_>& vtx,
+          const SFCKey<nc_>& sfc)
+        {
+          // recurse down
+          HilbertPermuter<Shape_, shape_dim_-1>::compute(perms, ish, vtx, sfc);
+
+          // compute the keys of the entity barycenters
+          std::vector<std::uint64_t> keys;
+          sfc.compute_entity_keys(keys, ish.template get_index_set<shape_dim_, 0>(), vtx, SFCurve::hilbert);
+
+          // sort the entities by their keys
+          std::vector<Index> order = SFCKey<nc_>::sort_by_keys(keys);
+
+          // create permutation
+          Adjacency::Permutation p(Index(order.size()));
+          Index* vp = p.get_perm_pos();
+          for(auto it = order.begin(); it != order.end(); ++it, ++vp)
+            *vp = *it;
+          p.calc_swap_from_perm();
+          perms.at(shape_dim_) = std::move(p);
+        }
+      }; // class HilbertPermuter
+
+      /// helper class to compute Hilbert curve permutation
+      template<typename Shape_>
+      class HilbertPermuter<Shape_, 0>
+      {
+      public:
+        template<int nc_, typename Coord_>
+        static void compute(
+          std::array<Adjacency::Permutation, Shape_::dimension + 1>& perms,
+          const IndexSetHolder<Shape_>&, const VertexSet<nc_, Coord_>& vtx,
+          const SFCKey<nc_>& sfc)
+        {
+          // compute the keys of the vertices
+          std::vector<std::uint64_t> keys;
+          sfc.compute_vertex_keys(keys, vtx, SFCurve::hilbert);
+
+          // sort the vertices by their keys
+          std::vector<Index> order = SFCKey<nc_>::sort_by_keys(keys);
+
+          // create permutation
+          Adjacency::Permutation p(Index(order.size()));
+          Index* vp = p.get_perm_pos();
+          for(auto it = order.begin(); it != order.end(); ++it, ++vp)
+            *vp = *it;
+          p.calc_swap_from_perm();
+          perms.front() = std::move(p);
+        }
+      }; // class HilbertPermuter<...,0>
     } // namespace Intern
     /// \endcond
 
@@ -248,6 +308,22 @@ namespace FEAT
        */
       colored,
 
+      /**
+       * \brief parallel colored permutation strategy
+       *
+       * This value indicates that the mesh elements have been sorted based on a coloring of the
+       * elements, which has been computed by the thread-parallel Jones-Plassmann algorithm, see
+       * Adjacency::Coloring::create_jones_plassmann() for details.
+       *
+       * This permutation strategy will automatically create an element coloring; see the
+       * documentation of the MeshPermutation class for more information.
+       *
+       * \note
+       * This permutation strategy is only applied to the mesh elements (cells of highest dimension),
+       * i.e. all sub-dimensional entities are left unpermuted.
+       */
+      colored_parallel,
+
       /**
        * \brief (algebraic) Cuthill-McKee permutation strategy
        *
@@ -299,6 +375,18 @@ namespace FEAT
        * documentation of the MeshPermutation class for more information.
        */
       geometric_cuthill_mckee_reversed,
+
+      /**
+       * \brief Hilbert curve permutation strategy
+       *
+       * This value indicates that all mesh entities have been sorted along a Hilbert space-filling
+       * curve through the bounding box of the mesh, i.e. the entities are sorted by the Hilbert
+       * keys of their barycenters.
+       *
+       * This ordering keeps entities which are close in space close in memory, which usually
+       * results in a better cache efficiency than the lexicographic ordering.
+       */
+      hilbert,
     }; // enum class PermutationStrategy
 
     /**
@@ -604,7 +692,11 @@ namespace FEAT
           break;
 
         case PermutationStrategy::colored:
-          create_colored(ish);
+          create_colored(ish, false);
+          break;
+
+        case PermutationStrategy::colored_parallel:
+          create_colored(ish, true);
           break;
 
         case PermutationStrategy::cuthill_mckee:
@@ -622,6 +714,10 @@ namespace FEAT
         case PermutationStrategy::geometric_cuthill_mckee_reversed:
           create_gcmk(ish, vtx, true);
           break;
+
+        case PermutationStrategy::hilbert:
+          create_hilbert(ish, vtx);
+          break;
         }
       }
 
@@ -716,12 +812,49 @@ namespace FEAT
         this->_strategy = PermutationStrategy::lexicographic;
       }
 
+      /**
+       * \brief Creates a Hilbert curve mesh permutation for a conformal mesh.
+       *
+       * \param[in] ish
+       * A \transient reference to the index set holder of the conformal mesh.
+       *
+       * \param[in] vtx
+       * A \transient reference to the vertex set of the conformal mesh.
+       *
+       * \note
+       * This function creates permutations for the mesh entities for each dimension.
+       */
+      template<int num_coords_, typename Coord_>
+      void create_hilbert(const IndexSetHolder<Shape_>& ish, const VertexSet<num_coords_, Coord_>& vtx)
+      {
+        XASSERTM(this->_strategy == PermutationStrategy::none, "permutation already created!");
+
+        // all entities are sorted along the same curve through the bounding box of the mesh
+        const auto sfc = Intern::SFCKey<num_coords_>::from_vertex_set(vtx);
+
+        // call the actual helper class
+        Intern::HilbertPermuter<ShapeType>::compute(this->_perms, ish, vtx, sfc);
+
+        // compute inverse permutations
+        for(std::size_t dim(0); dim <= std::size_t(shape_dim); ++dim)
+        {
+          _inv_perms.at(dim) = _perms.at(dim).inverse();
+        }
+
+        // save strategy
+        this->_strategy = PermutationStrategy::hilbert;
+      }
+
       /**
        * \brief Creates a colored mesh permutation for a conformal mesh.
        *
        * \param[in] ish
        * A \transient reference to the index set holder of the conformal mesh.
        *
+       * \param[in] parallel
+       * Specifies whether the coloring is to be computed by the thread-parallel Jones-Plassmann
+       * algorithm instead of the serial greedy algorithm.
+       *
        * \note
        * This function also creates an element coloring automatically.
        *
@@ -729,7 +862,7 @@ namespace FEAT
        * This function only creates a permutation for the mesh elements (entities of highest dimension)
        * but not for the lower-dimensional entities.
        */
-      void create_colored(const IndexSetHolder<Shape_>& ish)
+      void create_colored(const IndexSetHolder<Shape_>& ish, bool parallel = false)
       {
         XASSERTM(this->_strategy == PermutationStrategy::none, "permutation already created!");
 
@@ -738,7 +871,8 @@ namespace FEAT
         Adjacency::Graph elems_at_elem(Adjacency::RenderType::injectify, verts_at_elem, elems_at_vert);
 
         // create coloring
-        Adjacency::Coloring col(elems_at_elem);
+        Adjacency::Coloring col = (parallel ?
+          Adjacency::Coloring::create_jones_plassmann(elems_at_elem) : Adjacency::Coloring(elems_at_elem));
 
         // create coloring partition graph
         Adjacency::Graph cparti = col.create_partition_graph();
@@ -758,7 +892,7 @@ namespace FEAT
         this->_element_coloring.assign(dom_ptr, &dom_ptr[num_colors]);
 
         // save strategy
-        this->_strategy = PermutationStrategy::colored;
+        this->_strategy = (parallel ? PermutationStrategy::colored_parallel : PermutationStrategy::colored);
       }
 
       /**
@@ -785,8 +919,8 @@ namespace FEAT
         Adjacency::Graph elems_at_vert(Adjacency::RenderType::transpose, verts_at_elem);
         Adjacency::Graph elems_at_elem(Adjacency::RenderType::injectify, verts_at_elem, elems_at_vert);
 
-        // create Cuthill-McKee permutation
-        _perms.back() = Adjacency::CuthillMcKee::compute(this->_element_layering, elems_at_elem, reverse,
+        // create Cuthill-McKee permutation; the parallel algorithm yields the same permutation and layering
+        _perms.back() = Adjacency::CuthillMcKee::compute_parallel(this->_element_layering, elems_at_elem, reverse,
           Adjacency::CuthillMcKee::root_minimum_degree, Adjacency::CuthillMcKee::sort_asc);
         _inv_perms.back() = _perms.back().inverse();
 
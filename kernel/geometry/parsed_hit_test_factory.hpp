@@ -116,7 +116,59 @@ namespace FEAT
           const double val= _parser.Eval(vars.v);
 
           // check for errors
-          switch (_parser.EvalError())
+          check_eval_error(_parser.EvalError());
+
+          //Returns true, if point is in the "inner" part of the Mesh
+          //Otherwise returns false
+          return (val>=0.0);
+        }
+
+        /**
+         * \brief Evaluates the hit function for a batch of points
+         *
+         * Since the parser's evaluation is not thread-safe, each thread works on its own deep copy
+         * of the parser.
+         *
+         * \param[out] hits
+         * Receives 1 for all points in the "inner" part and 0 for all other points.
+         *
+         * \param[in] points
+         * The points to be tested.
+         */
+        void hit_test_batch(std::vector<int>& hits, const std::vector<PointType>& points) const
+        {
+          const Index n = Index(points.size());
+          int eval_error = 0;
+
+          FEAT_PRAGMA_OMP(parallel if(n >= Intern::hit_test_min_parallel) reduction(max:eval_error))
+          {
+            // the copy shares its data with the original parser until the deep copy is made
+            ::FunctionParser parser;
+            FEAT_PRAGMA_OMP(critical)
+            {
+              parser = _parser;
+              parser.ForceDeepCopy();
+            }
+
+            FEAT_PRAGMA_OMP(for schedule(static))
+            for(Index i = 0; i < n; ++i)
+            {
+              const Tiny::Vector<double, world_dim> vars(points[i]);
+              const double val = parser.Eval(vars.v);
+              // exceptions must not leave the parallel region, so remember the error code
+              const int err = parser.EvalError();
+              eval_error = Math::max(eval_error, err);
+              hits[i] = (val >= 0.0 ? 1 : 0);
+            }
+          }
+
+          check_eval_error(eval_error);
+        }
+
+        /// throws a ParseError if the error code of the parser is non-zero
+        static void check_eval_error(int eval_error)
+        {
+          switch (eval_error)
           {
           case 0: // no error
             break;
@@ -139,9 +191,6 @@ namespace FEAT
           default: // ???
             throw ParseError("Error in ParsedScalarFunction evaluation: unknown error");
           }
-          //Returns true, if point is in the "inner" part of the Mesh
-          //Otherwise returns false
-          return (val>=0.0);
         }
       };
       //Member Variables of ParsedHitTestFactory
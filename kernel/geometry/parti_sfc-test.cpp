@@ -0,0 +1,172 @@
+// FEAT3: Finite Element Analysis Toolbox, Version 3
+// Copyright (C) 2010 - 2023 by Stefan Turek & the FEAT group
+// FEAT3 is released under the GNU General Public License version 3,
+// see the file 'copyright.txt' in the top level directory for details.
+
+#include <test_system/test_system.hpp>
+#include <kernel/geometry/common_factories.hpp>
+#include <kernel/geometry/conformal_mesh.hpp>
+#include <kernel/geometry/parti_sfc.hpp>
+
+using namespace FEAT;
+using namespace FEAT::TestSystem;
+using namespace FEAT::Geometry;
+
+/**
+ * \brief Test class for the PartiSFC class template and the Hilbert mesh permutation.
+ *
+ * \test Tests the space-filling curve partitioner and the Hilbert curve mesh permutation.
+ */
+class PartiSFCTest :
+  public UnitTest
+{
+public:
+  typedef ConformalMesh<Shape::Quadrilateral> QuadMesh;
+  typedef ConformalMesh<Shape::Hexahedron> HexaMesh;
+  typedef ConformalMesh<Shape::Triangle> TriaMesh;
+
+  PartiSFCTest() :
+    UnitTest("parti_sfc-test")
+  {
+  }
+
+  virtual ~PartiSFCTest()
+  {
+  }
+
+  /// checks whether all consecutive elements of a mesh are facet-neighbors
+  template<typename Mesh_>
+  static bool check_consecutive_neighbors(const Mesh_& mesh)
+  {
+    const auto& neighbors = mesh.get_neighbors();
+    for(Index i(1); i < mesh.get_num_elements(); ++i)
+    {
+      bool found = false;
+      for(int j(0); j < neighbors.get_num_indices(); ++j)
+        found = found || (neighbors(i, j) == i-1);
+      if(!found)
+        return false;
+    }
+    return true;
+  }
+
+  void test_hilbert_keys() const
+  {
+    // the Hilbert curve through a regular 2^k x 2^k grid visits facet-neighbors consecutively
+    Geometry::Intern::SFCKey<2> sfc(Tiny::Vector<double, 2>(0.0), Tiny::Vector<double, 2>(1.0));
+    std::vector<std::uint64_t> keys;
+    for(int j(0); j < 8; ++j)
+      for(int i(0); i < 8; ++i)
+        keys.push_back(sfc(Tiny::Vector<double, 2>({(double(i) + 0.5) / 8.0, (double(j) + 0.5) / 8.0}), SFCurve::hilbert));
+    std::vector<Index> order = Geometry::Intern::SFCKey<2>::sort_by_keys(keys);
+    TEST_CHECK_EQUAL(order.front(), Index(0));
+    for(std::size_t k(1); k < order.size(); ++k)
+    {
+      const int di = int(order[k] % 8u) - int(order[k-1] % 8u);
+      const int dj = int(order[k] / 8u) - int(order[k-1] / 8u);
+      TEST_CHECK_EQUAL(di*di + dj*dj, 1);
+    }
+
+    // the Morton curve visits the quadrants in N-order, since X is the most significant coordinate
+    keys.clear();
+    for(int j(0); j < 2; ++j)
+      for(int i(0); i < 2; ++i)
+        keys.push_back(sfc(Tiny::Vector<double, 2>({0.25 + 0.5*double(i), 0.25 + 0.5*double(j)}), SFCurve::morton));
+    TEST_CHECK(keys[0] < keys[2]);
+    TEST_CHECK(keys[2] < keys[1]);
+    TEST_CHECK(keys[1] < keys[3]);
+  }
+
+  void test_permutation() const
+  {
+    // permute a 16x16 quad mesh and an 8x8x8 hexa mesh
+    RefinedUnitCubeFactory<QuadMesh> quad_factory(4);
+    QuadMesh quad_mesh(quad_factory);
+    quad_mesh.create_permutation(PermutationStrategy::hilbert);
+    TEST_CHECK(quad_mesh.get_mesh_permutation().get_strategy() == PermutationStrategy::hilbert);
+    TEST_CHECK(check_consecutive_neighbors(quad_mesh));
+
+    RefinedUnitCubeFactory<HexaMesh> hexa_factory(3);
+    HexaMesh hexa_mesh(hexa_factory);
+    hexa_mesh.create_permutation(PermutationStrategy::hilbert);
+    TEST_CHECK(check_consecutive_neighbors(hexa_mesh));
+  }
+
+  template<typename Mesh_>
+  void test_parti(int level, Index num_ranks) const
+  {
+    RefinedUnitCubeFactory<Mesh_> factory(level);
+    Mesh_ mesh(factory);
+    const Index num_elems = mesh.get_num_elements();
+
+    PartiSFC<Mesh_> parti(mesh, num_ranks);
+
+    // check balance: uniform weights must be distributed up to one element
+    const std::vector<Real>& weights = parti.get_rank_weights();
+    for(Index r(0); r < num_ranks; ++r)
+    {
+      TEST_CHECK(weights[r] >= Math::floor(Real(num_elems) / Real(num_ranks)) - Real(1));
+      TEST_CHECK(weights[r] <= Math::ceil(Real(num_elems) / Real(num_ranks)) + Real(1));
+    }
+
+    // refinement must not increase the number of interface facets and keep the balance
+    const Index num_ifacets = parti.get_num_interface_facets();
+    parti.refine(Index(10), Real(0.1));
+    TEST_CHECK(parti.get_num_interface_facets() <= num_ifacets);
+    for(Index r(0); r < num_ranks; ++r)
+    {
+      TEST_CHECK(weights[r] > Real(0));
+      TEST_CHECK(weights[r] <= Real(1.1) * Real(num_elems) / Real(num_ranks) + Real(1E-10));
+    }
+
+    // check elements-at-rank graph
+    Adjacency::Graph graph = parti.build_elems_at_rank();
+    TEST_CHECK_EQUAL(graph.get_num_nodes_domain(), num_ranks);
+    TEST_CHECK_EQUAL(graph.get_num_nodes_image(), num_elems);
+    TEST_CHECK_EQUAL(graph.get_num_indices(), num_elems);
+    const Index* ptr = graph.get_domain_ptr();
+    const Index* idx = graph.get_image_idx();
+    std::vector<int> mask(num_elems, 0);
+    for(Index r(0); r < num_ranks; ++r)
+    {
+      TEST_CHECK(ptr[r] < ptr[r+1]);
+      for(Index k(ptr[r]); k < ptr[r+1]; ++k)
+      {
+        TEST_CHECK_EQUAL(parti.get_element_ranks()[idx[k]], r);
+        ++mask[idx[k]];
+      }
+    }
+    for(Index i(0); i < num_elems; ++i)
+      TEST_CHECK_EQUAL(mask[i], 1);
+  }
+
+  void test_parti_weighted() const
+  {
+    // 4x4 quad mesh, where the elements in the lower half are 3 times as expensive
+    RefinedUnitCubeFactory<QuadMesh> factory(2);
+    QuadMesh mesh(factory);
+    const auto& vtx = mesh.get_vertex_set();
+    const auto& idx = mesh.get_index_set<2, 0>();
+    std::vector<Real> weights(mesh.get_num_elements());
+    for(Index i(0); i < mesh.get_num_elements(); ++i)
+      weights[i] = (vtx[idx(i, 0)][1] + vtx[idx(i, 3)][1] < 1.0 ? Real(3) : Real(1));
+
+    PartiSFC<QuadMesh> parti(mesh, Index(4), weights);
+    for(Index r(0); r < Index(4); ++r)
+    {
+      TEST_CHECK(parti.get_rank_weights()[r] >= Real(6));
+      TEST_CHECK(parti.get_rank_weights()[r] <= Real(10));
+    }
+  }
+
+  virtual void run() const override
+  {
+    test_hilbert_keys();
+    test_permutation();
+    test_parti<QuadMesh>(4, Index(7));
+    test_parti<HexaMesh>(3, Index(5));
+    test_parti<TriaMesh>(3, Index(12));
+    test_parti<QuadMesh>(1, Index(4));
+    test_parti_weighted();
+  }
+} parti_sfc_test;
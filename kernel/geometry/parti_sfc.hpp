@@ -0,0 +1,294 @@
+// FEAT3: Finite Element Analysis Toolbox, Version 3
+// Copyright (C) 2010 - 2023 by Stefan Turek & the FEAT group
+// FEAT3 is released under the GNU General Public License version 3,
+// see the file 'copyright.txt' in the top level directory for details.
+
+#pragma once
+#ifndef KERNEL_GEOMETRY_PARTI_SFC_HPP
+#define KERNEL_GEOMETRY_PARTI_SFC_HPP 1
+
+#include <kernel/adjacency/graph.hpp>
+#include <kernel/geometry/conformal_mesh.hpp>
+#include <kernel/geometry/intern/sfc_key.hpp>
+#include <kernel/util/assertion.hpp>
+
+// includes, system
+#include <vector>
+
+namespace FEAT
+{
+  namespace Geometry
+  {
+    /** \brief Space-filling curve partitioner class template declaration */
+    template<typename Mesh_>
+    class PartiSFC;
+
+    /**
+     * \brief Space-filling curve partitioner class template specialization for ConformalMesh
+     *
+     * This class implements a simple and fast geometric partitioner, which sorts the elements of
+     * a mesh along a space-filling curve (by default the Hilbert curve) through the bounding box
+     * of the mesh and splits the sorted sequence into contiguous chunks of (approximately) equal
+     * total element weight. Due to the locality of the Hilbert curve, the resulting partitions
+     * are usually compact and have a small number of interface facets, so that this partitioner
+     * is a reasonable default in the case where neither ParMETIS nor Zoltan are available.
+     *
+     * Optionally, the partitioning can be improved by a number of greedy refinement passes, which
+     * move elements on the partition interfaces to a neighbor partition if this reduces the total
+     * number of interface facets without exceeding the allowed weight imbalance.
+     *
+     * This partitioner is deterministic, i.e. all processes which call it for the same mesh will
+     * compute the same partitioning without any communication.
+     *
+     * The basic usage of this class is as follows:
+     * -# Create an object of this class and pass the to-be-partitioned mesh as well as the
+     *    desired number of ranks/patches and optionally the element weights to the constructor.
+     * -# Optionally, call the #refine() function to reduce the number of interface facets.
+     * -# Create the Elements-At-Rank graph using the #build_elems_at_rank() function.
+     */
+    template<typename Shape_, int num_coords_, typename Coord_>
+    class PartiSFC<ConformalMesh<Shape_, num_coords_, Coord_>>
+    {
+    public:
+      /// our mesh type
+      typedef ConformalMesh<Shape_, num_coords_, Coord_> MeshType;
+      /// our shape dimension
+      static constexpr int shape_dim = Shape_::dimension;
+
+    protected:
+      /// the mesh to be partitioned
+      const MeshType& _mesh;
+      /// number of elements in input mesh
+      const Index _num_elems;
+      /// number of desired ranks/patches
+      const Index _num_ranks;
+      /// the element weights
+      std::vector<Real> _weights;
+      /// the rank of each element
+      std::vector<Index> _ranks;
+      /// the total weight of each rank
+      std::vector<Real> _rank_weights;
+      /// the number of elements of each rank
+      std::vector<Index> _rank_counts;
+
+    public:
+      /**
+       * \brief Constructor
+       *
+       * \param[in] mesh
+       * A \resident reference to the mesh that is to be partitioned.
+       *
+       * \param[in] num_ranks
+       * The desired number of ranks/patches. Must be in the range [1, number of elements].
+       *
+       * \param[in] weights
+       * The weights of the elements. May be empty, in which case all elements are weighted equally.
+       *
+       * \param[in] curve
+       * The space-filling curve that is to be used.
+       */
+      explicit PartiSFC(const MeshType& mesh, Index num_ranks,
+        const std::vector<Real>& weights = std::vector<Real>(), SFCurve curve = SFCurve::hilbert) :
+        _mesh(mesh),
+        _num_elems(mesh.get_num_elements()),
+        _num_ranks(num_ranks),
+        _weights(weights),
+        _ranks(_num_elems, Index(0)),
+        _rank_weights(num_ranks, Real(0)),
+        _rank_counts(num_ranks, Index(0))
+      {
+        XASSERTM(num_ranks > Index(0), "invalid number of ranks");
+        XASSERTM(num_ranks <= _num_elems, "mesh does not have enough elements");
+        XASSERTM(_weights.empty() || (Index(_weights.size()) == _num_elems), "invalid weight vector size");
+        if(_weights.empty())
+          _weights.resize(_num_elems, Real(1));
+
+        // compute the curve keys of the element barycenters and sort the elements by their keys
+        const auto sfc = Intern::SFCKey<num_coords_>::from_vertex_set(mesh.get_vertex_set());
+        std::vector<std::uint64_t> keys;
+        sfc.compute_entity_keys(keys, mesh.template get_index_set<shape_dim, 0>(), mesh.get_vertex_set(), curve);
+        std::vector<Index> order = Intern::SFCKey<num_coords_>::sort_by_keys(keys);
+
+        // compute the total weight
+        Real total_weight(0);
+        for(Index i(0); i < _num_elems; ++i)
+          total_weight += _weights[i];
+
+        // split the sorted elements into contiguous chunks of approximately equal weight
+        Index rank(0);
+        Real acc_weight(0);
+        for(Index k(0); k < _num_elems; ++k)
+        {
+          const Index elem = order[k];
+          const Real w = _weights[elem];
+          // advance to the next rank if the current rank has reached its target weight or if the
+          // remaining elements are required to give each remaining rank at least one element
+          if((rank + 1u < _num_ranks) && (_rank_counts[rank] > Index(0)))
+          {
+            const Real target = (total_weight * Real(rank + 1u)) / Real(_num_ranks);
+            if((acc_weight + Real(0.5) * w >= target) || (_num_elems - k <= _num_ranks - rank - 1u))
+              ++rank;
+          }
+          _ranks[elem] = rank;
+          _rank_weights[rank] += w;
+          ++_rank_counts[rank];
+          acc_weight += w;
+        }
+      }
+
+      /// no copy, no problems
+      PartiSFC(const PartiSFC&) = delete;
+      /// no copy, no problems
+      PartiSFC& operator=(const PartiSFC&) = delete;
+
+      /**
+       * \brief Improves the partitioning by greedy interface refinement.
+       *
+       * In each pass, this function loops over all elements and moves an element to the neighbor
+       * rank, which shares the most facets with it, if this reduces the number of interface facets
+       * and if the total weight of the neighbor rank does not exceed the average rank weight by
+       * more than the allowed imbalance factor afterwards. No rank is emptied by this function.
+       *
+       * \param[in] max_passes
+       * The maximum number of refinement passes.
+       *
+       * \param[in] imbalance
+       * The allowed relative imbalance of the rank weights, e.g. 0.05 for 5%.
+       *
+       * \returns
+       * The total number of elements that have been moved.
+       */
+      Index refine(Index max_passes, Real imbalance = Real(0.05))
+      {
+        const auto& neighbors = _mesh.get_neighbors();
+        const int num_facets = neighbors.get_num_indices();
+
+        Real total_weight(0);
+        for(Index r(0); r < _num_ranks; ++r)
+          total_weight += _rank_weights[r];
+        const Real max_weight = (Real(1) + imbalance) * total_weight / Real(_num_ranks);
+
+        Index num_moved(0);
+        for(Index pass(0); pass < max_passes; ++pass)
+        {
+          Index moved(0);
+          for(Index elem(0); elem < _num_elems; ++elem)
+          {
+            const Index rank = _ranks[elem];
+            if(_rank_counts[rank] <= Index(1))
+              continue;
+
+            // count the facets shared with each neighbor rank
+            Index nbr_rank[Shape::FaceTraits<Shape_, shape_dim-1>::count];
+            int nbr_count[Shape::FaceTraits<Shape_, shape_dim-1>::count];
+            int num_nbr(0), num_int(0);
+            for(int j(0); j < num_facets; ++j)
+            {
+              const Index other = neighbors(elem, j);
+              if(other == ~Index(0))
+                continue;
+              const Index r = _ranks[other];
+              if(r == rank)
+              {
+                ++num_int;
+                continue;
+              }
+              int l(0);
+              while((l < num_nbr) && (nbr_rank[l] != r))
+                ++l;
+              if(l == num_nbr)
+              {
+                nbr_rank[num_nbr] = r;
+                nbr_count[num_nbr++] = 0;
+              }
+              ++nbr_count[l];
+            }
+
+            // find the best admissible neighbor rank
+            const Real w = _weights[elem];
+            int best(-1);
+            for(int l(0); l < num_nbr; ++l)
+            {
+              if((nbr_count[l] <= num_int) || (_rank_weights[nbr_rank[l]] + w > max_weight))
+                continue;
+              if((best < 0) || (nbr_count[l] > nbr_count[best]))
+                best = l;
+            }
+            if(best < 0)
+              continue;
+
+            // move element
+            const Index new_rank = nbr_rank[best];
+            _ranks[elem] = new_rank;
+            _rank_weights[rank] -= w;
+            _rank_weights[new_rank] += w;
+            --_rank_counts[rank];
+            ++_rank_counts[new_rank];
+            ++moved;
+          }
+          num_moved += moved;
+          if(moved == Index(0))
+            break;
+        }
+        return num_moved;
+      }
+
+      /// \returns The rank of each element.
+      const std::vector<Index>& get_element_ranks() const
+      {
+        return _ranks;
+      }
+
+      /// \returns The total element weight of each rank.
+      const std::vector<Real>& get_rank_weights() const
+      {
+        return _rank_weights;
+      }
+
+      /// \returns The number of facets on the interfaces between two different ranks.
+      Index get_num_interface_facets() const
+      {
+        const auto& neighbors = _mesh.get_neighbors();
+        const int num_facets = neighbors.get_num_indices();
+        Index count(0);
+        for(Index elem(0); elem < _num_elems; ++elem)
+        {
+          for(int j(0); j < num_facets; ++j)
+          {
+            const Index other = neighbors(elem, j);
+            if((other != ~Index(0)) && (elem < other) && (_ranks[elem] != _ranks[other]))
+              ++count;
+          }
+        }
+        return count;
+      }
+
+      /**
+       * \brief Returns the Elements-at-Rank graph of the partitioning.
+       *
+       * \returns
+       * The Elements-at-Rank graph of the partitioning.
+       */
+      Adjacency::Graph build_elems_at_rank() const
+      {
+        Adjacency::Graph graph(_num_ranks, _num_elems, _num_elems);
+        Index* ptr = graph.get_domain_ptr();
+        Index* idx = graph.get_image_idx();
+
+        // compute rank pointer array
+        ptr[0] = Index(0);
+        for(Index r(0); r < _num_ranks; ++r)
+          ptr[r+1] = ptr[r] + _rank_counts[r];
+
+        // insert the elements in ascending order
+        std::vector<Index> aux(ptr, ptr + _num_ranks);
+        for(Index elem(0); elem < _num_elems; ++elem)
+          idx[aux[_ranks[elem]]++] = elem;
+
+        return graph;
+      }
+    }; // class PartiSFC<ConformalMesh<...>>
+  } // namespace Geometry
+} // namespace FEAT
+
+#endif // KERNEL_GEOMETRY_PARTI_SFC_HPP
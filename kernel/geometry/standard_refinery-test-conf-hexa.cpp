@@ -7,6 +7,10 @@
 #include <kernel/geometry/test_aux/standard_hexa.hpp>
 #include <kernel/geometry/test_aux/tetris_hexa.hpp>
 #include <kernel/geometry/conformal_mesh.hpp>
+#include <kernel/geometry/common_factories.hpp>
+#include <kernel/geometry/intern/face_index_mapping.hpp>
+
+#include <algorithm>
 
 using namespace FEAT;
 using namespace FEAT::TestSystem;
@@ -42,6 +46,7 @@ public:
   {
     hexa_std_test();
     hexa_tetris_test();
+    hexa_large_test();
   }
 
   void hexa_std_test() const
@@ -105,4 +110,76 @@ public:
     delete quad_submesh_coarse;
   }
 
+  template<int face_dim_>
+  void validate_faces(const HexaMesh& mesh) const
+  {
+    typedef Geometry::Intern::FaceIndexMapping<Shape::Hexahedron, face_dim_, 0> FimType;
+    static constexpr int num_faces = Shape::FaceTraits<Shape::Hexahedron, face_dim_>::count;
+    static constexpr int num_verts = Shape::FaceTraits<typename Shape::FaceTraits<Shape::Hexahedron, face_dim_>::ShapeType, 0>::count;
+
+    const auto& verts_at_elem = mesh.template get_index_set<3, 0>();
+    const auto& faces_at_elem = mesh.template get_index_set<3, face_dim_>();
+    const auto& verts_at_face = mesh.template get_index_set<face_dim_, 0>();
+
+    Index va[num_verts], vb[num_verts];
+    for(Index cell(0); cell < mesh.get_num_elements(); ++cell)
+    {
+      for(int k(0); k < num_faces; ++k)
+      {
+        // the vertices of each face must coincide with the corresponding local vertices of the cell
+        for(int j(0); j < num_verts; ++j)
+        {
+          va[j] = verts_at_elem(cell, FimType::map(k, j));
+          vb[j] = verts_at_face(faces_at_elem(cell, k), j);
+        }
+        std::sort(va, va + num_verts);
+        std::sort(vb, vb + num_verts);
+        TEST_CHECK(std::equal(va, va + num_verts, vb));
+      }
+    }
+  }
+
+  void hexa_large_test() const
+  {
+    // create a coarse mesh, which is large enough to trigger the parallel refinement code paths
+    RefinedUnitCubeFactory<HexaMesh> factory(Index(4));
+    HexaMesh hexa_mesh_coarse(factory);
+    TEST_CHECK(hexa_mesh_coarse.get_num_elements() >= Geometry::Intern::standard_refinement_min_parallel);
+
+    // refine the mesh
+    HexaMeshRefinery hexa_mesh_refinery(hexa_mesh_coarse);
+    HexaMesh hexa_mesh_fine(hexa_mesh_refinery);
+
+    // check entity counts
+    TEST_CHECK_EQUAL(hexa_mesh_fine.get_num_vertices(), Index(33*33*33));
+    TEST_CHECK_EQUAL(hexa_mesh_fine.get_num_entities(1), Index(3*32*33*33));
+    TEST_CHECK_EQUAL(hexa_mesh_fine.get_num_entities(2), Index(3*32*32*33));
+    TEST_CHECK_EQUAL(hexa_mesh_fine.get_num_elements(), Index(32*32*32));
+
+    // each fine cell must be a cube with edge length 1/32
+    const Real tol = Real(1E-12);
+    const Real h = Real(1) / Real(32);
+    const auto& vtx = hexa_mesh_fine.get_vertex_set();
+    const auto& verts_at_elem = hexa_mesh_fine.get_index_set<3, 0>();
+    for(Index cell(0); cell < hexa_mesh_fine.get_num_elements(); ++cell)
+    {
+      Real vmin[3] = {Real(1), Real(1), Real(1)}, vmax[3] = {Real(0), Real(0), Real(0)};
+      for(int j(0); j < 8; ++j)
+      {
+        for(int d(0); d < 3; ++d)
+        {
+          vmin[d] = Math::min(vmin[d], vtx[verts_at_elem(cell, j)][d]);
+          vmax[d] = Math::max(vmax[d], vtx[verts_at_elem(cell, j)][d]);
+        }
+      }
+      for(int d(0); d < 3; ++d)
+      {
+        TEST_CHECK_EQUAL_WITHIN_EPS(vmax[d] - vmin[d], h, tol);
+      }
+    }
+
+    // validate the consistency of the refined index sets
+    validate_faces<1>(hexa_mesh_fine);
+    validate_faces<2>(hexa_mesh_fine);
+  }
 } standard_refinery_test_conf_hexa;
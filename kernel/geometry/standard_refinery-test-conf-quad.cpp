@@ -44,6 +44,7 @@ public:
   {
     quad_std_test();
     quad_tetris_test();
+    quad_release_test();
   }
 
   void quad_tetris_test() const
@@ -121,4 +122,60 @@ public:
     }
   }
 
+  void quad_release_test() const
+  {
+    // create a 2D tetris mesh and refine it
+    std::unique_ptr<RootMesh> quad_mesh_coarse(TestAux::create_tetris_mesh_2d());
+    RootMeshRefinery quad_mesh_refinery(*quad_mesh_coarse);
+    RootMesh quad_mesh_fine(quad_mesh_refinery);
+    RootMesh quad_mesh_fine2(quad_mesh_fine.clone());
+
+    const Index num_verts = quad_mesh_fine.get_num_entities(0);
+    const Index num_edges = quad_mesh_fine.get_num_entities(1);
+    const Index num_quads = quad_mesh_fine.get_num_entities(2);
+    const std::size_t bytes_full = quad_mesh_fine.bytes();
+
+    // release all index sets except for the faces-at-element sets
+    quad_mesh_fine.release_index_sets(true);
+    TEST_CHECK(quad_mesh_fine.bytes() < bytes_full);
+    TEST_CHECK_EQUAL(quad_mesh_fine.get_num_entities(1), num_edges);
+    TEST_CHECK(quad_mesh_fine.has_released_index_sets());
+    TEST_CHECK(!quad_mesh_fine.has_index_set(1, 0));
+    TEST_CHECK(quad_mesh_fine.has_index_set(2, 0));
+    TEST_CHECK(quad_mesh_fine.has_index_set(2, 1));
+    TEST_CHECK_EQUAL((quad_mesh_fine.get_index_set<2,1>().get_num_entities()), num_quads);
+
+    // the release flag must survive a clone
+    RootMesh quad_mesh_fine3(quad_mesh_fine.clone());
+    TEST_CHECK(quad_mesh_fine3.has_released_index_sets());
+    TEST_CHECK(quad_mesh_fine3.has_index_set(2, 1));
+
+    // the remaining index sets must be unchanged
+    const auto& verts_at_quad = quad_mesh_fine.get_index_set<2,0>();
+    const auto& verts_at_quad2 = quad_mesh_fine2.get_index_set<2,0>();
+    TEST_CHECK_EQUAL(verts_at_quad.get_num_entities(), num_quads);
+    for(Index i(0); i < num_quads; ++i)
+    {
+      for(int j(0); j < 4; ++j)
+      {
+        TEST_CHECK_EQUAL(verts_at_quad(i, j), verts_at_quad2(i, j));
+      }
+    }
+
+    // release all index sets except for the vertices-at-element set
+    quad_mesh_fine2.release_index_sets(false);
+    TEST_CHECK(quad_mesh_fine2.bytes() < quad_mesh_fine.bytes());
+    TEST_CHECK(!quad_mesh_fine2.has_index_set(2, 1));
+    TEST_CHECK(quad_mesh_fine2.has_index_set(2, 0));
+    TEST_CHECK_EQUAL((quad_mesh_fine2.get_index_set<2,0>().get_num_entities()), num_quads);
+
+    // recompute the topology from the vertices-at-element index set
+    quad_mesh_fine2.deduct_topology_from_top();
+    TEST_CHECK(!quad_mesh_fine2.has_released_index_sets());
+    TEST_CHECK_EQUAL(quad_mesh_fine2.get_num_entities(0), num_verts);
+    TEST_CHECK_EQUAL(quad_mesh_fine2.get_num_entities(1), num_edges);
+    TEST_CHECK_EQUAL((quad_mesh_fine2.get_index_set<1,0>().get_num_entities()), num_edges);
+    TEST_CHECK_EQUAL((quad_mesh_fine2.get_index_set<2,1>().get_num_entities()), num_quads);
+    TEST_CHECK_EQUAL(quad_mesh_fine2.get_neighbors().get_num_entities(), num_quads);
+  }
 } standard_refinery_test_conf_quad;
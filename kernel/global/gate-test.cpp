@@ -0,0 +1,396 @@
+// FEAT3: Finite Element Analysis Toolbox, Version 3
+// Copyright (C) 2010 - 2023 by Stefan Turek & the FEAT group
+// FEAT3 is released under the GNU General Public License version 3,
+// see the file 'copyright.txt' in the top level directory for details.
+
+#include <test_system/test_system.hpp>
+#include <kernel/lafem/dense_vector.hpp>
+#include <kernel/lafem/dense_vector_blocked.hpp>
+#include <kernel/lafem/power_mirror.hpp>
+#include <kernel/lafem/power_vector.hpp>
+#include <kernel/lafem/tuple_mirror.hpp>
+#include <kernel/lafem/tuple_vector.hpp>
+#include <kernel/lafem/vector_mirror.hpp>
+#include <kernel/global/gate.hpp>
+
+#include <memory>
+#include <set>
+#include <vector>
+
+using namespace FEAT;
+using namespace FEAT::TestSystem;
+
+/**
+ * \brief Helper class for the gate tests
+ *
+ * This class creates a gate for a chain of processes, in which each process has 5 local dofs:
+ * - dof 0 is a 'hub' dof, which is shared by all processes
+ * - dof 1 is shared with the previous process in the chain (interior on the first process)
+ * - dofs 2 and 3 are interior dofs
+ * - dof 4 is shared with the next process in the chain (interior on the last process)
+ *
+ * Therefore, the hub dof is shared by 3 or more processes if the test is run with at least 3 processes.
+ */
+template<typename DT_, typename IT_>
+class GateTestHelper
+{
+public:
+  typedef LAFEM::DenseVector<DT_, IT_> LocalVectorType;
+  typedef LAFEM::VectorMirror<DT_, IT_> MirrorType;
+  typedef Global::Gate<LocalVectorType, MirrorType> GateType;
+
+  /// the number of local dofs
+  static constexpr Index num_dofs = Index(5);
+
+  /// creates the mirror for the neighbor process q of the chain
+  static MirrorType create_mirror(int rank, int q)
+  {
+    // hub dof first, then the chain interface dof (if any)
+    const bool chain = (q + 1 == rank) || (q == rank + 1);
+    MirrorType mirror(num_dofs, chain ? Index(2) : Index(1));
+    mirror.indices()[0] = IT_(0);
+    if(q + 1 == rank)
+      mirror.indices()[1] = IT_(1);
+    else if(q == rank + 1)
+      mirror.indices()[1] = IT_(4);
+    return mirror;
+  }
+
+  /// creates the gate for the chain
+  static void create_gate(GateType& gate, const Dist::Comm& comm)
+  {
+    const int rank = comm.rank();
+    for(int q(0); q < comm.size(); ++q)
+    {
+      if(q != rank)
+        gate.push(q, create_mirror(rank, q));
+    }
+    gate.compile(LocalVectorType(num_dofs));
+  }
+
+  /// returns the global index of a local dof on a process
+  static Index global_dof(int rank, Index k)
+  {
+    if(k == Index(0))
+      return Index(0);
+    if((k == Index(1)) && (rank > 0))
+      return Index(4*rank);
+    return Index(4*rank) + k;
+  }
+
+  /// returns the set of all global dof indices
+  static std::set<Index> global_dofs(const Dist::Comm& comm)
+  {
+    std::set<Index> dofs;
+    for(int r(0); r < comm.size(); ++r)
+      for(Index k(0); k < num_dofs; ++k)
+        dofs.insert(global_dof(r, k));
+    return dofs;
+  }
+
+  static DT_ func_x(Index i)
+  {
+    return DT_(1) + DT_(0.5) * DT_(i);
+  }
+
+  static DT_ func_y(Index i)
+  {
+    return Math::sin(DT_(i) + DT_(0.5));
+  }
+
+  /// creates a type-1 vector by evaluating a function in the global dofs
+  template<typename Func_>
+  static LocalVectorType create_vector(const Dist::Comm& comm, Func_ func)
+  {
+    LocalVectorType vec(num_dofs);
+    for(Index k(0); k < num_dofs; ++k)
+      vec(k, func(global_dof(comm.rank(), k)));
+    return vec;
+  }
+}; // class GateTestHelper
+
+/**
+ * \brief Test class for the ownership-based dot-products of the Global::Gate class.
+ *
+ * \test Tests the dot-products of the Global::Gate class, which are computed over the owned dofs,
+ * against the frequency-weighted dot-products and the global reference dot-products. This test
+ * should be run with at least 3 processes, so that some dofs are shared by 3 or more processes.
+ */
+template<typename DT_, typename IT_>
+class GateDotTest :
+  public UnitTest
+{
+public:
+  typedef GateTestHelper<DT_, IT_> HelperType;
+  typedef typename HelperType::LocalVectorType LocalVectorType;
+  typedef typename HelperType::GateType GateType;
+
+  GateDotTest(PreferredBackend backend) :
+    UnitTest("GateDotTest", Type::Traits<DT_>::name(), Type::Traits<IT_>::name(), backend)
+  {
+  }
+
+  virtual ~GateDotTest()
+  {
+  }
+
+  virtual void run() const override
+  {
+    const DT_ eps = Math::pow(Math::eps<DT_>(), DT_(0.7));
+    const Dist::Comm comm = Dist::Comm::world();
+
+    GateType gate(comm);
+    HelperType::create_gate(gate, comm);
+
+    LocalVectorType vec_x = HelperType::create_vector(comm, HelperType::func_x);
+    LocalVectorType vec_y = HelperType::create_vector(comm, HelperType::func_y);
+
+    // compute the reference dot-products over all global dofs
+    const std::set<Index> dofs = HelperType::global_dofs(comm);
+    DT_ ref_xy(0), ref_xx(0);
+    for(const Index i : dofs)
+    {
+      ref_xy += HelperType::func_x(i) * HelperType::func_y(i);
+      ref_xx += HelperType::func_x(i) * HelperType::func_x(i);
+    }
+
+    // use a relative tolerance
+    const DT_ tol = eps * ref_xx;
+
+    TEST_CHECK_EQUAL(gate.get_num_global_dofs(), Index(dofs.size()));
+
+    // compare against the reference dot-products
+    TEST_CHECK_EQUAL_WITHIN_EPS(gate.dot(vec_x, vec_y), ref_xy, tol);
+    TEST_CHECK_EQUAL_WITHIN_EPS(gate.dot(vec_x, vec_x), ref_xx, tol);
+    TEST_CHECK_EQUAL_WITHIN_EPS(gate.dot_async(vec_x, vec_y).wait(), ref_xy, tol);
+    TEST_CHECK_EQUAL_WITHIN_EPS(gate.dot_async(vec_x, vec_x, true).wait(), Math::sqrt(ref_xx), tol);
+
+    // compare against the frequency-weighted dot-products
+    TEST_CHECK_EQUAL_WITHIN_EPS(gate.dot(vec_x, vec_y), gate.sum(gate._freqs.triple_dot(vec_x, vec_y)), tol);
+    TEST_CHECK_EQUAL_WITHIN_EPS(gate.dot(vec_y, vec_y), gate.sum(gate._freqs.triple_dot(vec_y, vec_y)), tol);
+
+    // the hub dof is shared by all processes
+    if(comm.size() > 1)
+    {
+      TEST_CHECK_EQUAL_WITHIN_EPS(gate._freqs(Index(0)), DT_(1) / DT_(comm.size()), eps);
+    }
+  }
+};
+
+GateDotTest<double, Index> gate_dot_test_double_index(PreferredBackend::generic);
+GateDotTest<float, unsigned int> gate_dot_test_float_uint(PreferredBackend::generic);
+
+/**
+ * \brief Test class for the ownership-based dot-products of the Global::Gate class for meta-vectors.
+ *
+ * \test Tests the dot-products of a gate for a tuple of a power vector and a blocked vector, whose
+ * DOFs are given by the chain of the GateTestHelper class, against the global reference dot-products.
+ */
+template<typename DT_, typename IT_>
+class GateMetaDotTest :
+  public UnitTest
+{
+public:
+  typedef GateTestHelper<DT_, IT_> HelperType;
+  typedef typename HelperType::MirrorType SubMirrorType;
+  typedef LAFEM::PowerVector<LAFEM::DenseVector<DT_, IT_>, 2> PowerVectorType;
+  typedef LAFEM::DenseVectorBlocked<DT_, IT_, 2> BlockedVectorType;
+  typedef LAFEM::TupleVector<PowerVectorType, BlockedVectorType> LocalVectorType;
+  typedef LAFEM::TupleMirror<LAFEM::PowerMirror<SubMirrorType, 2>, SubMirrorType> MirrorType;
+  typedef Global::Gate<LocalVectorType, MirrorType> GateType;
+
+  GateMetaDotTest(PreferredBackend backend) :
+    UnitTest("GateMetaDotTest", Type::Traits<DT_>::name(), Type::Traits<IT_>::name(), backend)
+  {
+  }
+
+  virtual ~GateMetaDotTest()
+  {
+  }
+
+  /// creates a type-1 vector by evaluating a function in the 4 components of all global dofs
+  template<typename Func_>
+  static LocalVectorType create_vector(const Dist::Comm& comm, Func_ func)
+  {
+    const Index n = HelperType::num_dofs;
+    LocalVectorType vec{PowerVectorType(n), BlockedVectorType(n)};
+    for(Index k(0); k < n; ++k)
+    {
+      const Index i = 4u * HelperType::global_dof(comm.rank(), k);
+      vec.template at<0>().template at<0>()(k, func(i));
+      vec.template at<0>().template at<1>()(k, func(i + 1u));
+      Tiny::Vector<DT_, 2> v;
+      v[0] = func(i + 2u);
+      v[1] = func(i + 3u);
+      vec.template at<1>()(k, v);
+    }
+    return vec;
+  }
+
+  virtual void run() const override
+  {
+    const DT_ eps = Math::pow(Math::eps<DT_>(), DT_(0.7));
+    const Dist::Comm comm = Dist::Comm::world();
+    const Index n = HelperType::num_dofs;
+
+    GateType gate(comm);
+    for(int q(0); q < comm.size(); ++q)
+    {
+      if(q == comm.rank())
+        continue;
+      SubMirrorType mirror = HelperType::create_mirror(comm.rank(), q);
+      gate.push(q, MirrorType(LAFEM::PowerMirror<SubMirrorType, 2>(mirror.clone()), mirror.clone()));
+    }
+    gate.compile(LocalVectorType(PowerVectorType(n), BlockedVectorType(n)));
+
+    LocalVectorType vec_x = create_vector(comm, HelperType::func_x);
+    LocalVectorType vec_y = create_vector(comm, HelperType::func_y);
+
+    // compute the reference dot-products over all components of all global dofs
+    DT_ ref_xy(0), ref_xx(0);
+    for(const Index i : HelperType::global_dofs(comm))
+    {
+      for(Index c(0); c < 4u; ++c)
+      {
+        ref_xy += HelperType::func_x(4u*i + c) * HelperType::func_y(4u*i + c);
+        ref_xx += HelperType::func_x(4u*i + c) * HelperType::func_x(4u*i + c);
+      }
+    }
+    const DT_ tol = eps * ref_xx;
+
+    TEST_CHECK_EQUAL_WITHIN_EPS(gate.dot(vec_x, vec_y), ref_xy, tol);
+    TEST_CHECK_EQUAL_WITHIN_EPS(gate.dot(vec_x, vec_x), ref_xx, tol);
+  }
+};
+
+GateMetaDotTest<double, Index> gate_meta_dot_test_double_index(PreferredBackend::generic);
+
+/**
+ * \brief Test class for the synchronization functions of the Global::Gate class.
+ *
+ * \test Tests the synchronous and asynchronous type-0 and type-1 synchronizations of the Global::Gate
+ * class, including several pending tickets on the same gate, which are waited for in different orders.
+ * If the processes reside on the same compute node, the halos are exchanged via shared memory windows.
+ */
+template<typename DT_, typename IT_>
+class GateSyncTest :
+  public UnitTest
+{
+public:
+  typedef GateTestHelper<DT_, IT_> HelperType;
+  typedef typename HelperType::LocalVectorType LocalVectorType;
+  typedef typename HelperType::GateType GateType;
+  typedef typename GateType::VectorTicketType TicketType;
+
+  GateSyncTest(PreferredBackend backend) :
+    UnitTest("GateSyncTest", Type::Traits<DT_>::name(), Type::Traits<IT_>::name(), backend)
+  {
+  }
+
+  virtual ~GateSyncTest()
+  {
+  }
+
+  /// checks whether a type-1 vector contains the scaled frequency counts
+  void check_counts(const LocalVectorType& vec, const GateType& gate, DT_ scale, DT_ tol) const
+  {
+    for(Index k(0); k < vec.size(); ++k)
+    {
+      TEST_CHECK_EQUAL_WITHIN_EPS(vec(k), scale / gate._freqs(k), tol);
+    }
+  }
+
+  virtual void run() const override
+  {
+    const DT_ tol = Math::pow(Math::eps<DT_>(), DT_(0.8));
+    const Dist::Comm comm = Dist::Comm::world();
+
+    GateType gate(comm);
+    HelperType::create_gate(gate, comm);
+
+    // if all processes reside on the same node, then all halos are exchanged via shared memory
+    if((comm.size() > 1) && (comm.comm_split_shared().size() == comm.size()))
+    {
+      TEST_CHECK(gate._shared != nullptr);
+    }
+
+    // a type-0 vector of ones is synchronized to the frequency counts
+    LocalVectorType vec(HelperType::num_dofs, DT_(1));
+    gate.sync_0(vec);
+    check_counts(vec, gate, DT_(1), tol);
+
+    // a type-1 vector is invariant under a type-1 synchronization
+    LocalVectorType vec_x = HelperType::create_vector(comm, HelperType::func_x);
+    LocalVectorType vec_y = vec_x.clone();
+    gate.sync_1(vec_y);
+    vec_y.axpy(vec_x, vec_y, -DT_(1));
+    TEST_CHECK_EQUAL_WITHIN_EPS(vec_y.max_abs_element(), DT_(0), tol);
+
+    // empty tickets of gates without neighbors must not be waited for
+    if(gate._ranks.empty())
+      return;
+
+    // post more tickets on the same gate than there are shared buffer slots and wait for them in
+    // different orders; this also reuses the shared memory buffers of completed tickets
+    const std::size_t num_vecs = 2u * Global::SynchVectorShared<DT_, IT_>::num_slots - 1u;
+    for(int iter(0); iter < 4; ++iter)
+    {
+      std::vector<LocalVectorType> vecs;
+      std::vector<TicketType> tickets;
+      for(std::size_t i(0); i < num_vecs; ++i)
+        vecs.push_back(LocalVectorType(HelperType::num_dofs, DT_(i+1)));
+      for(std::size_t i(0); i < num_vecs; ++i)
+        tickets.push_back(gate.sync_0_async(vecs.at(i)));
+
+      // wait in forward order, reverse order or a rank-dependent order
+      for(std::size_t j(0); j < num_vecs; ++j)
+      {
+        std::size_t i = j;
+        if(iter == 1)
+          i = num_vecs - j - 1u;
+        else if(iter >= 2)
+          i = (j + std::size_t(comm.rank())) % num_vecs;
+        tickets.at(i).wait();
+      }
+
+      for(std::size_t i(0); i < num_vecs; ++i)
+        check_counts(vecs.at(i), gate, DT_(i+1), tol);
+    }
+
+    // nested tickets of a type-1 synchronization within a type-0 synchronization
+    LocalVectorType vec_0(HelperType::num_dofs, DT_(1));
+    LocalVectorType vec_1 = vec_x.clone();
+    TicketType ticket_0 = gate.sync_0_async(vec_0);
+    TicketType ticket_1 = gate.sync_1_async(vec_1);
+    gate.sync_0(vec);
+    ticket_1.wait();
+    ticket_0.wait();
+    check_counts(vec_0, gate, DT_(1), tol);
+    vec_1.axpy(vec_x, vec_1, -DT_(1));
+    TEST_CHECK_EQUAL_WITHIN_EPS(vec_1.max_abs_element(), DT_(0), tol);
+
+    // the destruction of a gate is not collective, so destroy a second gate at different times
+    std::unique_ptr<GateType> gate_2(new GateType(comm));
+    HelperType::create_gate(*gate_2, comm);
+    if(comm.rank() % 2 == 0)
+      gate_2.reset();
+    vec.format(DT_(1));
+    gate.sync_0(vec);
+    check_counts(vec, gate, DT_(1), tol);
+    gate_2.reset();
+
+    // the windows of destroyed gates are freed by the compilation of new gates on the same processes
+    const std::size_t num_windows = Dist::SharedWindow::get_num_allocated();
+    for(int iter(0); iter < 4; ++iter)
+    {
+      std::unique_ptr<GateType> gate_3(new GateType(comm));
+      HelperType::create_gate(*gate_3, comm);
+      if(comm.rank() % 2 == iter % 2)
+        gate_3.reset();
+      gate.sync_0(vec);
+    }
+    TEST_CHECK(Dist::SharedWindow::get_num_allocated() <= num_windows + 1u);
+  }
+};
+
+GateSyncTest<double, Index> gate_sync_test_double_index(PreferredBackend::generic);
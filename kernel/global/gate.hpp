@@ -8,12 +8,18 @@
 #define KERNEL_GLOBAL_GATE_HPP 1
 
 #include <kernel/base_header.hpp>
+#include <kernel/backend.hpp>
 #include <kernel/util/dist.hpp>
 #include <kernel/util/exception.hpp>
 #include <kernel/lafem/dense_vector.hpp>
+#include <kernel/lafem/dense_vector_blocked.hpp>
+#include <kernel/lafem/power_vector.hpp>
+#include <kernel/lafem/tuple_vector.hpp>
 #include <kernel/global/synch_vec.hpp>
 #include <kernel/global/synch_scal.hpp>
 
+#include <algorithm>
+#include <memory>
 #include <vector>
 
 namespace FEAT
@@ -23,6 +29,75 @@ namespace FEAT
    */
   namespace Global
   {
+    /// \cond internal
+    namespace Intern
+    {
+      /**
+       * \brief Computes the dot-product of two vectors restricted to a sorted list of POD indices
+       *
+       * The indices in [idx, idx_end) are POD indices relative to \p offset, i.e. the POD index of
+       * the first entry of \p x and \p y is \p offset. The meta-vector overloads split the index
+       * list at the POD sizes of their sub-vectors and recurse.
+       */
+      template<typename DT_, typename IT_>
+      DT_ indexed_dot(const LAFEM::DenseVector<DT_, IT_>& x, const LAFEM::DenseVector<DT_, IT_>& y,
+        const IT_* idx, const IT_* idx_end, const Index offset)
+      {
+        const DT_* vx = x.elements();
+        const DT_* vy = y.elements();
+        DT_ r(0);
+        for(; idx != idx_end; ++idx)
+          r += vx[Index(*idx) - offset] * vy[Index(*idx) - offset];
+        return r;
+      }
+
+      template<typename DT_, typename IT_, int block_size_>
+      DT_ indexed_dot(const LAFEM::DenseVectorBlocked<DT_, IT_, block_size_>& x,
+        const LAFEM::DenseVectorBlocked<DT_, IT_, block_size_>& y,
+        const IT_* idx, const IT_* idx_end, const Index offset)
+      {
+        const DT_* vx = x.template elements<LAFEM::Perspective::pod>();
+        const DT_* vy = y.template elements<LAFEM::Perspective::pod>();
+        DT_ r(0);
+        for(; idx != idx_end; ++idx)
+          r += vx[Index(*idx) - offset] * vy[Index(*idx) - offset];
+        return r;
+      }
+
+      template<typename SubVector_, int count_>
+      typename SubVector_::DataType indexed_dot(const LAFEM::PowerVector<SubVector_, count_>& x,
+        const LAFEM::PowerVector<SubVector_, count_>& y,
+        const typename SubVector_::IndexType* idx, const typename SubVector_::IndexType* idx_end, const Index offset)
+      {
+        if constexpr(count_ == 1)
+          return indexed_dot(x.first(), y.first(), idx, idx_end, offset);
+        else
+        {
+          const Index off_rest = offset + x.first().template size<LAFEM::Perspective::pod>();
+          const auto* idx_rest = std::lower_bound(idx, idx_end, off_rest);
+          return indexed_dot(x.first(), y.first(), idx, idx_rest, offset) +
+            indexed_dot(x.rest(), y.rest(), idx_rest, idx_end, off_rest);
+        }
+      }
+
+      template<typename First_, typename... Rest_>
+      typename First_::DataType indexed_dot(const LAFEM::TupleVector<First_, Rest_...>& x,
+        const LAFEM::TupleVector<First_, Rest_...>& y,
+        const typename First_::IndexType* idx, const typename First_::IndexType* idx_end, const Index offset)
+      {
+        if constexpr(sizeof...(Rest_) == 0)
+          return indexed_dot(x.first(), y.first(), idx, idx_end, offset);
+        else
+        {
+          const Index off_rest = offset + x.first().template size<LAFEM::Perspective::pod>();
+          const auto* idx_rest = std::lower_bound(idx, idx_end, off_rest);
+          return indexed_dot(x.first(), y.first(), idx, idx_rest, offset) +
+            indexed_dot(x.rest(), y.rest(), idx_rest, idx_end, off_rest);
+        }
+      }
+    } // namespace Intern
+    /// \endcond
+
     /**
      * \brief Global gate implementation
      *
@@ -46,6 +121,17 @@ namespace FEAT
      * -# Add the mirror for each nearest neighbor by using the push() function.
      * -# Compile the gate by calling the compile() function and supplying it with a temporary local vector.
      *
+     * If several processes of the gate's communicator reside on the same compute node, then the compile()
+     * function also allocates a Dist::SharedWindow for these processes, which is used to exchange the
+     * halo buffers of all node-local neighbors directly via shared memory, so that messages only have
+     * to be sent to remote neighbors, see SynchVectorShared for details.
+     *
+     * \note
+     * The shared memory window is released by the destructor of the gate, but it is only freed by
+     * the next compile() call of a gate on the same node processes or by Dist::finalize(), so the
+     * destruction of a gate is not a collective operation. However, the destructor waits until the
+     * node-local neighbors have completed all tickets of this gate.
+     *
      * \author Peter Zajac
      */
     template<typename LocalVector_, typename Mirror_>
@@ -59,6 +145,7 @@ namespace FEAT
 
       typedef SynchScalarTicket<DataType> ScalarTicketType;
       typedef SynchVectorTicket<LocalVector_, Mirror_> VectorTicketType;
+      typedef SynchVectorShared<DataType, IndexType> SharedBufferType;
 
     public:
       /// our communicator
@@ -69,6 +156,10 @@ namespace FEAT
       std::vector<Mirror_> _mirrors;
       /// frequency vector
       LocalVector_ _freqs;
+      /// sorted POD indices of all local DOFs which are owned by a lower-rank neighbor
+      std::vector<IndexType> _unowned_idx;
+      /// shared memory halo buffers for node-local neighbors; may be nullptr
+      std::unique_ptr<SharedBufferType> _shared;
 
       /// Our 'base' class type
       template <typename LocalVector2_, typename Mirror2_>
@@ -101,7 +192,9 @@ namespace FEAT
         _comm(other._comm),
         _ranks(std::forward<std::vector<int>>(other._ranks)),
         _mirrors(std::forward<std::vector<Mirror_>>(other._mirrors)),
-        _freqs(std::forward<LocalVector_>(other._freqs))
+        _freqs(std::forward<LocalVector_>(other._freqs)),
+        _unowned_idx(std::forward<std::vector<IndexType>>(other._unowned_idx)),
+        _shared(std::move(other._shared))
       {
       }
 
@@ -117,6 +210,8 @@ namespace FEAT
         _ranks = std::forward<std::vector<int>>(other._ranks);
         _mirrors = std::forward<std::vector<Mirror_>>(other._mirrors);
         _freqs = std::forward<LocalVector_>(other._freqs);
+        _unowned_idx = std::forward<std::vector<IndexType>>(other._unowned_idx);
+        _shared = std::move(other._shared);
 
         return *this;
       }
@@ -150,6 +245,10 @@ namespace FEAT
       /**
        * \brief Conversion function for same vector container type but with different MDI-Type
        *
+       * \note
+       * As this function is not collective, the converted gate does not create any shared memory
+       * buffers and therefore exchanges the halos of all neighbors via messages.
+       *
        * \param[in] other
        * A \transient reference to the gate to convert from
        */
@@ -173,6 +272,12 @@ namespace FEAT
         }
 
         this->_freqs.convert(other._freqs);
+
+        // rebuild the ownership lists for the converted vector type
+        this->_compile_ownership();
+
+        // this function is not collective, so the converted gate exchanges all halos via messages
+        this->_shared.reset();
       }
 
       /**
@@ -228,6 +333,7 @@ namespace FEAT
         }
         temp += _freqs.bytes();
         temp += _ranks.size() * sizeof(int);
+        temp += _unowned_idx.size() * sizeof(IndexType);
 
         return temp;
       }
@@ -282,6 +388,12 @@ namespace FEAT
 
         // invert frequencies
         _freqs.component_invert(_freqs);
+
+        // determine which of our shared DOFs are owned by other ranks
+        _compile_ownership();
+
+        // set up shared memory buffers for our node-local neighbors
+        _compile_shared();
       }
 
       /**
@@ -379,7 +491,7 @@ namespace FEAT
       {
         if(!_ranks.empty())
         {
-          SynchVectorTicket<LocalVector_, Mirror_> ticket(vector, *_comm, _ranks, _mirrors);
+          SynchVectorTicket<LocalVector_, Mirror_> ticket(vector, *_comm, _ranks, _mirrors, _get_shared());
           ticket.wait();
         }
       }
@@ -404,7 +516,7 @@ namespace FEAT
         if(_ranks.empty())
           return SynchVectorTicket<LocalVector_, Mirror_>(); // empty ticket
 
-        return SynchVectorTicket<LocalVector_, Mirror_>(vector, *_comm, _ranks, _mirrors);
+        return SynchVectorTicket<LocalVector_, Mirror_>(vector, *_comm, _ranks, _mirrors, _get_shared());
       }
 
       /**
@@ -429,7 +541,7 @@ namespace FEAT
         if(!_ranks.empty())
         {
           from_1_to_0(vector);
-          SynchVectorTicket<LocalVector_, Mirror_> ticket(vector, *_comm, _ranks, _mirrors);
+          SynchVectorTicket<LocalVector_, Mirror_> ticket(vector, *_comm, _ranks, _mirrors, _get_shared());
           ticket.wait();
         }
       }
@@ -458,7 +570,7 @@ namespace FEAT
           return SynchVectorTicket<LocalVector_, Mirror_>(); // empty ticket
 
         from_1_to_0(vector);
-        return SynchVectorTicket<LocalVector_, Mirror_>(vector, *_comm, _ranks, _mirrors);
+        return SynchVectorTicket<LocalVector_, Mirror_>(vector, *_comm, _ranks, _mirrors, _get_shared());
       }
 
       /**
@@ -485,10 +597,10 @@ namespace FEAT
         {
           return sum(x.dot(y));
         }
-        // If there are neighbors, we have to use the frequencies and sum up globally
+        // If there are neighbors, we have to skip all DOFs not owned by us and sum up globally
         else
         {
-          return sum(_freqs.triple_dot(x, y));
+          return sum(_owned_dot(x, y));
         }
       }
 
@@ -505,7 +617,7 @@ namespace FEAT
        */
       ScalarTicketType dot_async(const LocalVector_& x, const LocalVector_& y, bool sqrt = false) const
       {
-        return sum_async(_freqs.triple_dot(x, y), sqrt);
+        return sum_async(_owned_dot(x, y), sqrt);
       }
 
       /**
@@ -645,6 +757,173 @@ namespace FEAT
       {
         return SynchScalarTicket<DataType>(x*x, *_comm, Dist::op_sum, true);
       }
+
+    protected:
+      /**
+       * \brief Returns the shared memory buffers for a new synchronization ticket
+       *
+       * \returns
+       * A pointer to the shared memory buffers or \c nullptr, if this gate has no shared memory
+       * buffers. As the buffers are set up collectively by compile(), this is consistent among all
+       * neighbor processes.
+       */
+      SharedBufferType* _get_shared() const
+      {
+        return _shared.get();
+      }
+
+      /**
+       * \brief Sets up the shared memory buffers for the node-local neighbors
+       *
+       * This function splits the gate's communicator into node communicators, determines which of
+       * our neighbors reside on the same node and allocates a shared window on each node, which
+       * contains SharedBufferType::num_slots send buffer regions for each node-local neighbor of each
+       * process. Afterwards, the offsets of these regions are exchanged with the node-local neighbors.
+       * The decision whether to use shared memory buffers at all is made collectively on each node.
+       *
+       * \attention This function is collective, i.e. it must be called by all processes participating
+       * in the gate's communicator, otherwise the application will deadlock.
+       */
+      void _compile_shared()
+      {
+        _shared.reset();
+
+        if((_comm == nullptr) || (_comm->size() <= 1))
+          return;
+
+        // split our communicator into node communicators
+        Dist::Comm node_comm = _comm->comm_split_shared();
+        if(node_comm.size() <= 1)
+          return;
+
+        // the shared memory windows reside in main memory, so use messages for all other backends;
+        // all processes on the node have to agree on this, as they exchange their halos in the same way
+        int use_shared = (Backend::get_preferred_backend() == PreferredBackend::cuda ? 0 : 1);
+        node_comm.allreduce(&use_shared, &use_shared, std::size_t(1), Dist::op_min);
+        if(use_shared == 0)
+          return;
+
+        // gather the ranks of all processes on our node
+        const int my_rank = _comm->rank();
+        std::vector<int> node_procs(std::size_t(node_comm.size()));
+        node_comm.allgather(&my_rank, std::size_t(1), node_procs.data(), std::size_t(1));
+
+        // determine node-local neighbors and compute the offsets of their send buffer regions
+        const std::size_t n = _ranks.size();
+        std::unique_ptr<SharedBufferType> shared(new SharedBufferType());
+        shared->node_ranks.resize(n, -1);
+        std::vector<Index> send_info(3u*n, Index(0)), recv_info(3u*n, Index(0));
+        Index total_size(0u);
+        for(std::size_t i(0); i < n; ++i)
+        {
+          auto it = std::find(node_procs.begin(), node_procs.end(), _ranks.at(i));
+          if(it == node_procs.end())
+            continue;
+
+          shared->node_ranks.at(i) = int(it - node_procs.begin());
+          send_info.at(3u*i) = total_size;
+          send_info.at(3u*i+1u) = _mirrors.at(i).buffer_size(_freqs);
+          total_size += send_info.at(3u*i+1u);
+        }
+        for(std::size_t i(0); i < n; ++i)
+          send_info.at(3u*i+2u) = total_size;
+
+        // allocate our segment of the shared window; this is collective even if we have no local neighbors
+        const std::size_t num_slots = SharedBufferType::num_slots;
+        shared->window = Dist::SharedWindow(node_comm, num_slots * std::size_t(total_size) * sizeof(DataType));
+
+        // exchange buffer offsets and sizes with our node-local neighbors
+        Dist::RequestVector reqs;
+        for(std::size_t i(0); i < n; ++i)
+        {
+          if(!shared->is_local(i))
+            continue;
+          reqs.push_back(_comm->irecv(&recv_info.at(3u*i), std::size_t(3), _ranks.at(i)));
+          reqs.push_back(_comm->isend(&send_info.at(3u*i), std::size_t(3), _ranks.at(i)));
+        }
+        reqs.wait_all();
+
+        // create the buffer wrappers for our segment and the segments of our neighbors for each slot
+        DataType* own_seg = static_cast<DataType*>(shared->window.get_local());
+        for(std::size_t i(0); i < n; ++i)
+        {
+          if(!shared->is_local(i))
+          {
+            for(std::size_t s(0); s < num_slots; ++s)
+            {
+              shared->send_bufs.at(s).emplace_back(nullptr, Index(0));
+              shared->recv_bufs.at(s).emplace_back(nullptr, Index(0));
+            }
+            continue;
+          }
+
+          XASSERTM(recv_info.at(3u*i+1u) == send_info.at(3u*i+1u), "halo buffer size mismatch");
+          DataType* nbr_seg = static_cast<DataType*>(shared->window.get_segment(shared->node_ranks.at(i)));
+          for(std::size_t s(0); s < num_slots; ++s)
+          {
+            const Index own_off = Index(s) * send_info.at(3u*i+2u) + send_info.at(3u*i);
+            const Index nbr_off = Index(s) * recv_info.at(3u*i+2u) + recv_info.at(3u*i);
+            shared->send_bufs.at(s).emplace_back(own_seg + own_off, send_info.at(3u*i+1u));
+            shared->recv_bufs.at(s).emplace_back(nbr_seg + nbr_off, recv_info.at(3u*i+1u));
+          }
+        }
+
+        _shared = std::move(shared);
+      }
+
+      /**
+       * \brief Computes the list of the shared DOFs owned by other processes
+       *
+       * Each shared DOF is owned by the process with the lowest rank that shares it, which is
+       * the same rule as used by get_num_global_dofs(), so this function records the POD indices
+       * of all local DOFs which are shared with a lower-rank neighbor.
+       *
+       * \note This function is not collective; it only requires the frequency vector to be allocated.
+       */
+      void _compile_ownership()
+      {
+        _unowned_idx.clear();
+
+        if((_comm == nullptr) || (_comm->size() <= 1) || _ranks.empty())
+          return;
+
+        const int my_rank = _comm->rank();
+
+        // set all DOFs, which are shared with a lower rank neighbor, to 0
+        std::vector<int> mask(std::size_t(_freqs.template size<LAFEM::Perspective::pod>()), 1);
+        for(std::size_t i(0); i < _mirrors.size(); ++i)
+        {
+          if(_ranks.at(i) < my_rank)
+            _mirrors.at(i).template mask_scatter<LAFEM::Perspective::pod>(_freqs, mask, 0);
+        }
+
+        for(std::size_t k(0); k < mask.size(); ++k)
+        {
+          if(mask[k] == 0)
+            _unowned_idx.push_back(IndexType(k));
+        }
+      }
+
+      /**
+       * \brief Computes the local dot-product of two type-1 vectors over all owned DOFs.
+       *
+       * The full local dot-product is computed by the plain dot kernel and the contributions of
+       * all DOFs owned by other processes are subtracted afterwards by direct indexing, so this
+       * function neither allocates any buffers nor gathers any mirrors.
+       *
+       * \param[in] x, y
+       * The two type-1 vector whose dot-product is to be computed.
+       *
+       * \returns
+       * The local dot-product of \p x and \p y restricted to the DOFs owned by this process.
+       */
+      DataType _owned_dot(const LocalVector_& x, const LocalVector_& y) const
+      {
+        DataType r = x.dot(y);
+        if(!_unowned_idx.empty())
+          r -= Intern::indexed_dot(x, y, _unowned_idx.data(), _unowned_idx.data() + _unowned_idx.size(), Index(0));
+        return r;
+      }
     }; // class Gate<...>
   } // namespace Global
 } // namespace FEAT
@@ -0,0 +1,250 @@
+// FEAT3: Finite Element Analysis Toolbox, Version 3
+// Copyright (C) 2010 - 2023 by Stefan Turek & the FEAT group
+// FEAT3 is released under the GNU General Public License version 3,
+// see the file 'copyright.txt' in the top level directory for details.
+
+#pragma once
+#ifndef KERNEL_GLOBAL_HANGING_NODE_FILTER_HPP
+#define KERNEL_GLOBAL_HANGING_NODE_FILTER_HPP 1
+
+// includes, FEAT
+#include <kernel/global/gate.hpp>
+#include <kernel/lafem/dense_vector.hpp>
+#include <kernel/lafem/hanging_node_filter.hpp>
+#include <kernel/lafem/vector_mirror.hpp>
+#include <kernel/util/dist.hpp>
+
+namespace FEAT
+{
+  namespace Global
+  {
+    /**
+     * \brief Global Hanging-Node Filter class template.
+     *
+     * This class wraps a LAFEM::HangingNodeFilter for the local patch of a partitioned domain, whose
+     * hanging vertices have been created by the constructor for partitioned meshes of the
+     * Geometry::HangingNodeRefinery class. In this case, no slave DOF is shared with another patch,
+     * but some of the master DOFs may be shared. Therefore, the solution and correction filters can
+     * be applied to the type-1 vectors locally, whereas the restriction of the right-hand-side and
+     * defect filters has to be applied to the type-0 vector, which is synchronized afterwards by the
+     * gate. If none of the master DOFs is shared on any process, which is determined by the
+     * constructor, then the synchronization is skipped.
+     *
+     * This filter operates on local vectors, so it has to be wrapped into a Global::Filter, possibly
+     * combined with other filters in a LAFEM::FilterChain.
+     */
+    template<typename DT_, typename IT_>
+    class HangingNodeFilter
+    {
+    public:
+      /// vector-type typedef
+      typedef LAFEM::DenseVector<DT_, IT_> VectorType;
+      /// data-type typedef
+      typedef typename VectorType::DataType DataType;
+      /// index-type typedef
+      typedef typename VectorType::IndexType IndexType;
+      /// the local filter type
+      typedef LAFEM::HangingNodeFilter<DT_, IT_> LocalFilterType;
+      /// the gate type
+      typedef Global::Gate<VectorType, LAFEM::VectorMirror<DT_, IT_>> GateType;
+
+      /// Our 'base' class type
+      template<typename DT2_, typename IT2_>
+      using FilterType = HangingNodeFilter<DT2_, IT2_>;
+
+      /// this typedef lets you create a filter with new Datatape and Index types
+      template <typename DataType2_, typename IndexType2_>
+      using FilterTypeByDI = FilterType<DataType2_, IndexType2_>;
+
+    protected:
+      /// the local filter
+      LocalFilterType _filter;
+      /// the gate
+      const GateType* _gate;
+      /// do we have to synchronize the restricted defects?
+      bool _sync;
+
+    public:
+      // default CTOR
+      HangingNodeFilter() :
+        _filter(),
+        _gate(nullptr),
+        _sync(false)
+      {
+      }
+
+      /**
+       * \brief Constructor
+       *
+       * \param[in] filter
+       * The local hanging-node filter of this patch.
+       *
+       * \param[in] gate
+       * A \resident pointer to the compiled gate of the space.
+       *
+       * \attention This constructor is collective, i.e. it must be called by all processes
+       * participating in the gate's communicator, otherwise the application will deadlock.
+       */
+      explicit HangingNodeFilter(LocalFilterType&& filter, const GateType* gate) :
+        _filter(std::forward<LocalFilterType>(filter)),
+        _gate(gate),
+        _sync(false)
+      {
+        XASSERT(_gate != nullptr);
+        XASSERTM(_gate->get_num_local_dofs() == _filter.size(), "gate does not match filter");
+
+        // a DOF is shared if its inverse frequency is less than 1
+        VectorType vec_freq(_filter.size(), DataType(1));
+        _gate->from_1_to_0(vec_freq);
+        const IndexType* master_idx = _filter.get_master_idx().elements();
+        int shared(0);
+        for(Index i(0); i < _filter.get_master_idx().size(); ++i)
+          shared |= (vec_freq(master_idx[i]) < DataType(0.75) ? 1 : 0);
+        _gate->get_comm()->allreduce(&shared, &shared, std::size_t(1), Dist::op_max);
+        _sync = (shared != 0);
+      }
+
+      /// move ctor
+      HangingNodeFilter(HangingNodeFilter && other) :
+        _filter(std::move(other._filter)),
+        _gate(other._gate),
+        _sync(other._sync)
+      {
+      }
+
+      /// move-assign operator
+      HangingNodeFilter & operator=(HangingNodeFilter && other)
+      {
+        if(this != &other)
+        {
+          _filter = std::move(other._filter);
+          _gate = other._gate;
+          _sync = other._sync;
+        }
+        return *this;
+      }
+
+      /// virtual destructor
+      virtual ~HangingNodeFilter()
+      {
+      }
+
+      /// Creates a clone of itself
+      HangingNodeFilter clone(LAFEM::CloneMode clone_mode = LAFEM::CloneMode::Deep) const
+      {
+        HangingNodeFilter other;
+        other.clone(*this, clone_mode);
+        return other;
+      }
+
+      /// Clones data from another HangingNodeFilter
+      void clone(const HangingNodeFilter & other, LAFEM::CloneMode clone_mode = LAFEM::CloneMode::Deep)
+      {
+        if(this == &other)
+          return;
+
+        _filter.clone(other.get_local_filter(), clone_mode);
+        _gate = other.get_gate();
+        _sync = other.get_sync();
+      }
+
+      /// \cond internal
+      LocalFilterType & get_local_filter()
+      {
+        return _filter;
+      }
+
+      const LocalFilterType & get_local_filter() const
+      {
+        return _filter;
+      }
+
+      const GateType* get_gate() const
+      {
+        return _gate;
+      }
+
+      bool get_sync() const
+      {
+        return _sync;
+      }
+      /// \endcond
+
+      std::size_t bytes() const
+      {
+        return _filter.bytes();
+      }
+
+      /**
+       * \brief Applies the filter onto the right-hand-side vector.
+       *
+       * \param[in,out] vector
+       * A reference to the type-1 right-hand-side vector to be filtered.
+       */
+      void filter_rhs(VectorType& vector) const
+      {
+        if(!_sync)
+        {
+          _filter.filter_rhs(vector);
+          return;
+        }
+        _gate->from_1_to_0(vector);
+        _filter.filter_rhs(vector);
+        _gate->sync_0(vector);
+      }
+
+      /**
+       * \brief Applies the filter onto the solution vector.
+       *
+       * \param[in,out] vector
+       * A reference to the type-1 solution vector to be filtered.
+       */
+      void filter_sol(VectorType& vector) const
+      {
+        _filter.filter_sol(vector);
+      }
+
+      /**
+       * \brief Applies the filter onto a defect vector.
+       *
+       * \param[in,out] vector
+       * A reference to the type-1 defect vector to be filtered.
+       */
+      void filter_def(VectorType& vector) const
+      {
+        if(!_sync)
+        {
+          _filter.filter_def(vector);
+          return;
+        }
+        _gate->from_1_to_0(vector);
+        _filter.filter_def(vector);
+        _gate->sync_0(vector);
+      }
+
+      /**
+       * \brief Applies the filter onto a correction vector.
+       *
+       * \param[in,out] vector
+       * A reference to the type-1 correction vector to be filtered.
+       */
+      void filter_cor(VectorType& vector) const
+      {
+        _filter.filter_cor(vector);
+      }
+
+      /**
+       * \brief Applies the filter onto the local type-0 matrix of the patch.
+       *
+       * \param[in,out] matrix
+       * A reference to the type-0 matrix to be filtered.
+       */
+      void filter_mat(LAFEM::SparseMatrixCSR<DT_, IT_>& matrix) const
+      {
+        _filter.filter_mat(matrix);
+      }
+    }; // class HangingNodeFilter<...>
+  } // namespace Global
+} // namespace FEAT
+
+#endif // KERNEL_GLOBAL_HANGING_NODE_FILTER_HPP
@@ -203,6 +203,7 @@ namespace FEAT
         Statistics::add_time_mpi_execute_reduction(_mpi_exec);
         Statistics::add_time_mpi_wait_reduction(_mpi_wait);
 #else // no FEAT_MPI_THREAD_MULTIPLE
+        FEAT_TRACE_SCOPE_EX(TraceKind::sync, "SynchScalarTicket::wait", -1, sizeof(DT_));
         TimeStamp ts_start;
         _req.wait();
         Statistics::add_time_mpi_wait_reduction(ts_start.elapsed_now());
@@ -13,10 +13,163 @@
 #include <kernel/util/statistics.hpp>
 #include <kernel/lafem/dense_vector.hpp>
 
+#include <vector>
+
 namespace FEAT
 {
   namespace Global
   {
+    /// \cond internal
+    namespace Intern
+    {
+      /**
+       * \brief Buffer vector wrapper for a region of a shared memory window
+       *
+       * This class wraps a region of a Dist::SharedWindow into a DenseVector object, so that it can be
+       * passed directly to the gather and scatter functions of the vector mirrors. The wrapper does not
+       * own its memory, just like a ranged DenseVector.
+       */
+      template<typename DT_, typename IT_>
+      class SharedBufferVector :
+        public LAFEM::DenseVector<DT_, IT_>
+      {
+      public:
+        explicit SharedBufferVector(DT_* data, Index size_in) :
+          LAFEM::DenseVector<DT_, IT_>()
+        {
+          this->_foreign_memory = true;
+          if(size_in == Index(0))
+            return;
+          this->_scalar_index.at(0) = size_in;
+          this->_elements.push_back(data);
+          this->_elements_size.push_back(size_in);
+        }
+      }; // class SharedBufferVector<...>
+    } // namespace Intern
+    /// \endcond
+
+    /**
+     * \brief Shared memory halo buffers for the node-local neighbors of a gate
+     *
+     * This class manages a Dist::SharedWindow, which contains one send buffer region for each
+     * neighbor process that resides on the same compute node as this process. A SynchVectorTicket
+     * gathers the halo values for such a neighbor directly into our window segment and the neighbor
+     * scatters them directly out of our segment, so that only small notification messages have to
+     * be exchanged with node-local neighbors instead of the halo buffers themselves.
+     *
+     * Only a ticket, which is posted while no other ticket of the same gate is pending, uses the
+     * shared memory buffers, whereas all tickets posted while another ticket is still pending
+     * exchange their halos via messages. As posting and waiting for tickets happens in the same
+     * order on all processes, all processes make the same decision for each ticket, so no process
+     * ever has to decide on its own whether to use the shared memory buffers or messages for a
+     * particular ticket, and any number of tickets may be pending at the same time. The shared
+     * tickets are assigned to \p num_slots sets of send buffer regions in a round-robin fashion,
+     * so that a new shared ticket rarely has to wait for the neighbors to finish reading the buffers
+     * of a previous one. The notification messages use one pair of tags per slot.
+     *
+     * A ticket does not wait for its node-local neighbors to finish reading its send buffers. Instead,
+     * the notifications of the neighbors are received before the slot is reused by another ticket or
+     * before the object is destroyed, so that a ticket never depends on the wait calls of its
+     * neighbors and the tickets may be waited for in a different order on each process.
+     *
+     * Objects of this class are created by Gate::compile() and are only used for those mirrors,
+     * whose node_ranks entry is non-negative.
+     */
+    template<typename DT_, typename IT_>
+    class SynchVectorShared
+    {
+    public:
+      /// the buffer wrapper type
+      typedef Intern::SharedBufferVector<DT_, IT_> BufferType;
+
+      /// the number of send buffer slots
+      static constexpr std::size_t num_slots = 4u;
+
+      /// tag for the notification messages signaling that our send buffer of a slot is ready
+      static int tag_ready(std::size_t slot)
+      {
+        return 0x5B0 + int(slot);
+      }
+
+      /// tag for the notification messages signaling that the neighbor's send buffer of a slot was read
+      static int tag_done(std::size_t slot)
+      {
+        return 0x5C0 + int(slot);
+      }
+
+      /// the shared window containing our send buffers
+      Dist::SharedWindow window;
+      /// the ranks of all neighbors in the node communicator; -1 for remote neighbors
+      std::vector<int> node_ranks;
+      /// the send buffers in our window segment for each slot; empty for remote neighbors
+      std::vector<std::vector<BufferType>> send_bufs;
+      /// the send buffers of the neighbors in their window segments for each slot; empty for remote neighbors
+      std::vector<std::vector<BufferType>> recv_bufs;
+      /// receive requests for the notifications that the neighbors have read our buffers of each slot
+      std::vector<Dist::RequestVector> done_reqs;
+      /// the total number of posted tickets that used the shared buffers
+      std::size_t num_tickets;
+      /// the number of currently pending tickets
+      std::size_t num_pending;
+      /// dummy buffer for the notification messages
+      char flag;
+
+      SynchVectorShared() :
+        send_bufs(num_slots),
+        recv_bufs(num_slots),
+        done_reqs(num_slots),
+        num_tickets(0u),
+        num_pending(0u),
+        flag(0)
+      {
+      }
+
+      /**
+       * \brief Destructor
+       *
+       * The destructor waits until the node-local neighbors have read our send buffers of all tickets.
+       */
+      ~SynchVectorShared()
+      {
+        for(auto& reqs : done_reqs)
+          reqs.wait_all();
+      }
+
+      /// checks whether the i-th neighbor resides on our node
+      bool is_local(std::size_t i) const
+      {
+        return node_ranks.at(i) >= 0;
+      }
+
+      /**
+       * \brief Registers a new ticket and acquires a slot for it, if no other ticket is pending
+       *
+       * \param[out] slot
+       * The index of the slot for the new ticket, if the shared buffers are to be used.
+       *
+       * \returns \c true, if the new ticket uses the shared buffers, or \c false, if it has to
+       * exchange all halos via messages.
+       */
+      bool acquire(std::size_t& slot)
+      {
+        if(num_pending++ > 0u)
+          return false;
+
+        slot = (num_tickets++) % num_slots;
+
+        // wait until the neighbors have read our buffers of the previous ticket in this slot
+        done_reqs.at(slot).wait_all();
+        done_reqs.at(slot) = Dist::RequestVector(node_ranks.size());
+        return true;
+      }
+
+      /// unregisters a completed ticket
+      void release()
+      {
+        --num_pending;
+      }
+    }; // class SynchVectorShared<...>
+
     /**
      * \brief Ticket class for asynchronous global operations on vectors
      *
@@ -40,12 +193,22 @@ namespace FEAT
       VT_* _target;
       /// our communicator
       const Dist::Comm* _comm;
+      /// the neighbor ranks
+      const std::vector<int>* _ranks;
       /// the vector mirrors
       const std::vector<VMT_>* _mirrors;
       /// send and receive request vectors
       Dist::RequestVector _send_reqs, _recv_reqs;
       /// send and receive buffers
       std::vector<BufferType> _send_bufs, _recv_bufs;
+      /// the shared memory buffers for node-local neighbors; may be nullptr
+      SynchVectorShared<typename VT_::DataType, typename VT_::IndexType>* _shared;
+      /// specifies whether this ticket uses the shared memory buffers
+      bool _use_shared;
+      /// the slot of the shared memory buffers used by this ticket
+      std::size_t _slot;
+      /// dummy buffer for the notification messages
+      char _flag;
 #endif // FEAT_HAVE_MPI || DOXYGEN
 
     public:
@@ -55,11 +218,16 @@ namespace FEAT
         _finished(true),
         _target(nullptr),
         _comm(nullptr),
+        _ranks(nullptr),
         _mirrors(nullptr),
         _send_reqs(),
         _recv_reqs(),
         _send_bufs(),
-        _recv_bufs()
+        _recv_bufs(),
+        _shared(nullptr),
+        _use_shared(false),
+        _slot(0u),
+        _flag(0)
 #else
         _finished(true)
 #endif // FEAT_HAVE_MPI || DOXYGEN
@@ -76,28 +244,53 @@ namespace FEAT
        * The communicator
        *
        * \param[in] ranks
-       * The neighbor ranks within the communicator
+       * The \resident neighbor ranks within the communicator
        *
        * \param[in] mirrors
        * The vector mirrors to be used for synchronization
+       *
+       * \param[in] shared
+       * A pointer to the shared memory buffers for the node-local neighbors or \c nullptr,
+       * if all halos are to be exchanged via messages. This must be consistent on all processes.
        */
 #if defined(FEAT_HAVE_MPI) || defined(DOXYGEN)
-      SynchVectorTicket(VT_ & target, const Dist::Comm& comm, const std::vector<int>& ranks, const std::vector<VMT_> & mirrors) :
+      SynchVectorTicket(VT_ & target, const Dist::Comm& comm, const std::vector<int>& ranks, const std::vector<VMT_> & mirrors,
+        SynchVectorShared<typename VT_::DataType, typename VT_::IndexType>* shared = nullptr) :
         _finished(false),
         _target(&target),
         _comm(&comm),
-        _mirrors(&mirrors)
+        _ranks(&ranks),
+        _mirrors(&mirrors),
+        _shared(shared),
+        _use_shared(false),
+        _slot(0u),
+        _flag(0)
       {
+        FEAT_TRACE_SCOPE(TraceKind::sync, "SynchVectorTicket::post");
         TimeStamp ts_start;
         const std::size_t n = ranks.size();
 
         XASSERTM(_mirrors->size() == n, "invalid vector mirror count");
 
+        if(_shared != nullptr)
+        {
+          XASSERTM(_shared->node_ranks.size() == n, "invalid shared buffer count");
+          _use_shared = _shared->acquire(_slot);
+        }
+
         // post receives
         _recv_reqs.reserve(n);
         _recv_bufs.resize(n);
         for(std::size_t i(0); i < n; ++i)
         {
+          // node-local neighbor: wait for the notification that its buffer is ready
+          if(_use_shared && _shared->is_local(i))
+          {
+            _recv_reqs.push_back(_comm->irecv(&_flag, std::size_t(0), ranks.at(i), _shared->tag_ready(_slot)));
+            _shared->done_reqs.at(_slot)[i] = _comm->irecv(&_shared->flag, std::size_t(0), ranks.at(i), _shared->tag_done(_slot));
+            continue;
+          }
+
           // create buffer vector in main memory
           _recv_bufs.at(i) = BufferType(_mirrors->at(i).buffer_size(*_target));
 
@@ -105,11 +298,29 @@ namespace FEAT
           _recv_reqs.push_back(_comm->irecv(_recv_bufs.at(i).elements(), _recv_bufs.at(i).size(), ranks.at(i)));
         }
 
+        // gather directly into our shared window segment
+        if(_use_shared)
+        {
+          for(std::size_t i(0); i < n; ++i)
+          {
+            if(_shared->is_local(i))
+              _mirrors->at(i).gather(_shared->send_bufs.at(_slot).at(i), *_target);
+          }
+          _shared->window.sync();
+        }
+
         // post sends
         _send_reqs.reserve(n);
         _send_bufs.resize(n);
         for(std::size_t i(0); i < n; ++i)
         {
+          // node-local neighbor: notify that our buffer is ready
+          if(_use_shared && _shared->is_local(i))
+          {
+            _send_reqs.push_back(_comm->isend(&_flag, std::size_t(0), ranks.at(i), _shared->tag_ready(_slot)));
+            continue;
+          }
+
           // create buffer in device memory
           _send_bufs.at(i) = BufferType(_mirrors->at(i).buffer_size(*_target));
 
@@ -123,7 +334,8 @@ namespace FEAT
         Statistics::add_time_mpi_execute_blas2(ts_start.elapsed_now());
       }
 #else // non-MPI version
-      SynchVectorTicket(VT_ &, const Dist::Comm&, const std::vector<int>& ranks, const std::vector<VMT_> &) :
+      SynchVectorTicket(VT_ &, const Dist::Comm&, const std::vector<int>& ranks, const std::vector<VMT_> &,
+        SynchVectorShared<typename VT_::DataType, typename VT_::IndexType>* = nullptr) :
         _finished(false)
       {
         XASSERT(ranks.empty());
@@ -138,23 +350,30 @@ namespace FEAT
       SynchVectorTicket(SynchVectorTicket&& other) :
 #if defined(FEAT_HAVE_MPI) || defined(DOXYGEN)
         _finished(other._finished),
-        _target(other->_target),
-        _comm(other->_comm),
-        _mirrors(other->_mirrors),
+        _target(other._target),
+        _comm(other._comm),
+        _ranks(other._ranks),
+        _mirrors(other._mirrors),
         _send_reqs(std::forward<Dist::RequestVector>(other._send_reqs)),
         _recv_reqs(std::forward<Dist::RequestVector>(other._recv_reqs)),
         _send_bufs(std::forward<std::vector<BufferType>>(other._send_bufs)),
-        _recv_bufs(std::forward<std::vector<BufferType>>(other._recv_bufs))
+        _recv_bufs(std::forward<std::vector<BufferType>>(other._recv_bufs)),
+        _shared(other._shared),
+        _use_shared(other._use_shared),
+        _slot(other._slot),
+        _flag(0)
       {
-        other->_finished = true;
-        other->_comm = nullptr;
-        other->_target = nullptr;
-        other->_mirrors = nullptr;
+        other._finished = true;
+        other._comm = nullptr;
+        other._ranks = nullptr;
+        other._target = nullptr;
+        other._mirrors = nullptr;
+        other._shared = nullptr;
       }
 #else
         _finished(other._finished)
       {
-        other->_finished = true;
+        other._finished = true;
       }
 #endif // FEAT_HAVE_MPI
 
@@ -166,21 +385,27 @@ namespace FEAT
 
 #if defined(FEAT_HAVE_MPI) || defined(DOXYGEN)
         _finished = other._finished;
-        _target = other->_target;
-        _comm = other->_comm;
-        _mirrors = other->_mirrors;
+        _target = other._target;
+        _comm = other._comm;
+        _ranks = other._ranks;
+        _mirrors = other._mirrors;
         _send_reqs = std::forward<Dist::RequestVector>(other._send_reqs);
         _recv_reqs = std::forward<Dist::RequestVector>(other._recv_reqs);
         _send_bufs = std::forward<std::vector<BufferType>>(other._send_bufs);
         _recv_bufs = std::forward<std::vector<BufferType>>(other._recv_bufs);
+        _shared = other._shared;
+        _use_shared = other._use_shared;
+        _slot = other._slot;
 
-        other->_finished = true;
-        other->_comm = nullptr;
-        other->_target = nullptr;
-        other->_mirrors = nullptr;
+        other._finished = true;
+        other._comm = nullptr;
+        other._ranks = nullptr;
+        other._target = nullptr;
+        other._mirrors = nullptr;
+        other._shared = nullptr;
 #else
         _finished = other._finished;
-        other->_finished = true;
+        other._finished = true;
 #endif // FEAT_HAVE_MPI
 
         return *this;
@@ -197,15 +422,38 @@ namespace FEAT
         XASSERTM(!_finished, "ticket was already completed by a wait call");
 
 #ifdef FEAT_HAVE_MPI
+        // the byte count is only required if tracing is enabled
+        std::uint64_t bytes(0u);
+        if(Tracer::enabled())
+        {
+          for(const auto& buf : _recv_bufs)
+            bytes += std::uint64_t(buf.size()) * sizeof(typename BufferType::DataType);
+        }
+        FEAT_TRACE_SCOPE_EX(TraceKind::sync, "SynchVectorTicket::wait", -1, bytes);
         TimeStamp ts_start;
 
         // process all pending receives
         for(std::size_t idx(0u); _recv_reqs.wait_any(idx); )
         {
+          // node-local neighbor: scatter directly from its window segment
+          if(_use_shared && _shared->is_local(idx))
+          {
+            _shared->window.sync();
+            _mirrors->at(idx).scatter_axpy(*_target, _shared->recv_bufs.at(_slot).at(idx));
+
+            // notify neighbor that we are done reading its buffer
+            _send_reqs.push_back(_comm->isend(&_flag, std::size_t(0), _ranks->at(idx), _shared->tag_done(_slot)));
+            continue;
+          }
+
           // scatter the receive buffer
           _mirrors->at(idx).scatter_axpy(*_target, _recv_bufs.at(idx));
         }
 
+        // our slot can be reused once the neighbors are done reading our buffers, see SynchVectorShared
+        if(_shared != nullptr)
+          _shared->release();
+
         // wait for all sends to finish
         _send_reqs.wait_all();
 
@@ -132,6 +132,28 @@ namespace FEAT
           BACKEND_SKELETON_VOID_T2(BlockHeight_, BlockWidth_, bcsr_cuda, bcsr_generic, bcsr_generic, r, a, x, b, y, val, col_ind, row_ptr, rows, columns, used_elements)
         }
 
+        template <int BlockHeight_, int BlockWidth_, int BlockWidth2_, typename DT_, typename IT_>
+        static void bcsr_fused(DT_ * r, const DT_ a, const DT_ * const x, const DT_ * const z, const DT_ b, const DT_ * const y,
+                               const DT_ * const val, const IT_ * const col_ind, const IT_ * const row_ptr,
+                               const DT_ * const val2, const IT_ * const col_ind2, const IT_ * const row_ptr2, const Index rows)
+        {
+          bcsr_fused_generic<BlockHeight_, BlockWidth_, BlockWidth2_, DT_, IT_>(r, a, x, z, b, y, val, col_ind, row_ptr, val2, col_ind2, row_ptr2, rows);
+        }
+
+        template <typename DT_, typename IT_>
+        static void csr_mrhs(DT_ * r, const DT_ a, const DT_ * const x, const DT_ b, const DT_ * const y, const DT_ * const val,
+                             const IT_ * const col_ind, const IT_ * const row_ptr, const Index rows, const Index num_rhs)
+        {
+          csr_mrhs_generic(r, a, x, b, y, val, col_ind, row_ptr, rows, num_rhs);
+        }
+
+        template <int BlockHeight_, int BlockWidth_, typename DT_, typename IT_>
+        static void bcsr_mrhs(DT_ * r, const DT_ a, const DT_ * const x, const DT_ b, const DT_ * const y, const DT_ * const val,
+                              const IT_ * const col_ind, const IT_ * const row_ptr, const Index rows, const Index num_rhs)
+        {
+          bcsr_mrhs_generic<BlockHeight_, BlockWidth_, DT_, IT_>(r, a, x, b, y, val, col_ind, row_ptr, rows, num_rhs);
+        }
+
         template <int BlockSize_, typename DT_, typename IT_>
         static void csrsb(DT_ * r, const DT_ a, const DT_ * const x, const DT_ b, const DT_ * const y, const DT_ * const val, const IT_ * const col_ind, const IT_ * const row_ptr, const Index rows, const Index columns, const Index used_elements)
         {
@@ -211,9 +233,22 @@ namespace FEAT
         static void bcsr_generic(DT_ * r, const DT_ a, const DT_ * const x, const DT_ b, const DT_ * const y, const DT_ * const val,
                          const IT_ * const col_ind, const IT_ * const row_ptr, const Index rows, const Index, const Index);
 
+        template <int BlockHeight_, int BlockWidth_, int BlockWidth2_, typename DT_, typename IT_>
+        static void bcsr_fused_generic(DT_ * r, const DT_ a, const DT_ * const x, const DT_ * const z, const DT_ b, const DT_ * const y,
+                               const DT_ * const val, const IT_ * const col_ind, const IT_ * const row_ptr,
+                               const DT_ * const val2, const IT_ * const col_ind2, const IT_ * const row_ptr2, const Index rows);
+
         template <int BlockSize_, typename DT_, typename IT_>
         static void csrsb_generic(DT_ * r, const DT_ a, const DT_ * const x, const DT_ b, const DT_ * const y, const DT_ * const val, const IT_ * const col_ind, const IT_ * const row_ptr, const Index rows, const Index, const Index);
 
+        template <typename DT_, typename IT_>
+        static void csr_mrhs_generic(DT_ * r, const DT_ a, const DT_ * const x, const DT_ b, const DT_ * const y, const DT_ * const val,
+                                     const IT_ * const col_ind, const IT_ * const row_ptr, const Index rows, const Index num_rhs);
+
+        template <int BlockHeight_, int BlockWidth_, typename DT_, typename IT_>
+        static void bcsr_mrhs_generic(DT_ * r, const DT_ a, const DT_ * const x, const DT_ b, const DT_ * const y, const DT_ * const val,
+                                      const IT_ * const col_ind, const IT_ * const row_ptr, const Index rows, const Index num_rhs);
+
         template <typename DT_, typename IT_>
         static void banded_generic(DT_ * r, const DT_ alpha, const DT_ * const x, const DT_ beta, const DT_ * const y, const DT_ * const val, const IT_ * const offsets,  const Index num_of_offsets, const Index rows, const Index columns);
 
@@ -276,6 +311,20 @@ namespace FEAT
       extern template void Apply::cscr_generic(double *, const double, const double * const, const double, const double * const, const double * const, const std::uint32_t * const, const std::uint32_t * const, const std::uint32_t * const, const Index, const Index, const Index, const Index, const bool);
       extern template void Apply::cscr_generic(double *, const double, const double * const, const double, const double * const, const double * const, const std::uint32_t * const, const std::uint32_t * const, const std::uint32_t * const, const Index, const Index, const Index, const Index, const bool);
 
+      extern template void Apply::csr_mrhs_generic(float *, const float, const float * const, const float, const float * const, const float * const, const std::uint64_t * const, const std::uint64_t * const, const Index, const Index);
+      extern template void Apply::csr_mrhs_generic(float *, const float, const float * const, const float, const float * const, const float * const, const std::uint32_t * const, const std::uint32_t * const, const Index, const Index);
+      extern template void Apply::csr_mrhs_generic(double *, const double, const double * const, const double, const double * const, const double * const, const std::uint64_t * const, const std::uint64_t * const, const Index, const Index);
+      extern template void Apply::csr_mrhs_generic(double *, const double, const double * const, const double, const double * const, const double * const, const std::uint32_t * const, const std::uint32_t * const, const Index, const Index);
+
+      extern template void Apply::bcsr_mrhs_generic<2, 2, float, std::uint64_t>(float *, const float, const float * const, const float, const float * const, const float * const, const std::uint64_t * const, const std::uint64_t * const, const Index, const Index);
+      extern template void Apply::bcsr_mrhs_generic<2, 2, float, std::uint32_t>(float *, const float, const float * const, const float, const float * const, const float * const, const std::uint32_t * const, const std::uint32_t * const, const Index, const Index);
+      extern template void Apply::bcsr_mrhs_generic<2, 2, double, std::uint64_t>(double *, const double, const double * const, const double, const double * const, const double * const, const std::uint64_t * const, const std::uint64_t * const, const Index, const Index);
+      extern template void Apply::bcsr_mrhs_generic<2, 2, double, std::uint32_t>(double *, const double, const double * const, const double, const double * const, const double * const, const std::uint32_t * const, const std::uint32_t * const, const Index, const Index);
+      extern template void Apply::bcsr_mrhs_generic<3, 3, float, std::uint64_t>(float *, const float, const float * const, const float, const float * const, const float * const, const std::uint64_t * const, const std::uint64_t * const, const Index, const Index);
+      extern template void Apply::bcsr_mrhs_generic<3, 3, float, std::uint32_t>(float *, const float, const float * const, const float, const float * const, const float * const, const std::uint32_t * const, const std::uint32_t * const, const Index, const Index);
+      extern template void Apply::bcsr_mrhs_generic<3, 3, double, std::uint64_t>(double *, const double, const double * const, const double, const double * const, const double * const, const std::uint64_t * const, const std::uint64_t * const, const Index, const Index);
+      extern template void Apply::bcsr_mrhs_generic<3, 3, double, std::uint32_t>(double *, const double, const double * const, const double, const double * const, const double * const, const std::uint32_t * const, const std::uint32_t * const, const Index, const Index);
+
       extern template void Apply::banded_generic(float *, const float, const float * const, const float, const float * const, const float * const, const std::uint64_t * const, const Index, const Index, const Index);
       extern template void Apply::banded_generic(float *, const float, const float * const, const float, const float * const, const float * const, const std::uint32_t * const, const Index, const Index, const Index);
       extern template void Apply::banded_generic(double *, const double, const double * const, const double, const double * const, const double * const, const std::uint64_t * const, const Index, const Index, const Index);
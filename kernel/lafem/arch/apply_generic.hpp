@@ -153,6 +153,54 @@ namespace FEAT
         }
       }
 
+      template <int BlockHeight_, int BlockWidth_, int BlockWidth2_, typename DT_, typename IT_>
+      void Apply::bcsr_fused_generic(DT_ * r, const DT_ a, const DT_ * const x, const DT_ * const z, const DT_ b, const DT_ * const y,
+                                                const DT_ * const val, const IT_ * const col_ind, const IT_ * const row_ptr,
+                                                const DT_ * const val2, const IT_ * const col_ind2, const IT_ * const row_ptr2, const Index rows)
+      {
+        Tiny::Vector<DT_, BlockHeight_> * br(reinterpret_cast<Tiny::Vector<DT_, BlockHeight_> *>(r));
+        const Tiny::Vector<DT_, BlockHeight_> * const by(reinterpret_cast<const Tiny::Vector<DT_, BlockHeight_> *>(y));
+        const Tiny::Matrix<DT_, BlockHeight_, BlockWidth_> * const bval(reinterpret_cast<const Tiny::Matrix<DT_, BlockHeight_, BlockWidth_> *>(val));
+        const Tiny::Matrix<DT_, BlockHeight_, BlockWidth2_> * const bval2(reinterpret_cast<const Tiny::Matrix<DT_, BlockHeight_, BlockWidth2_> *>(val2));
+        const Tiny::Vector<DT_, BlockWidth_> * const bx(reinterpret_cast<const Tiny::Vector<DT_, BlockWidth_> *>(x));
+        const Tiny::Vector<DT_, BlockWidth2_> * const bz(reinterpret_cast<const Tiny::Vector<DT_, BlockWidth2_> *>(z));
+
+        // y is not accessed for b = 0, so r may be uninitialized in this case
+        const bool use_y(Math::abs(b) >= Math::eps<DT_>());
+
+        for (Index row(0) ; row < rows ; ++row)
+        {
+          // accumulate both row parts before the single store into r
+          Tiny::Vector<DT_, BlockHeight_> bsum(0);
+          const IT_ end(row_ptr[row + 1]);
+          for (IT_ i(row_ptr[row]) ; i < end ; ++i)
+          {
+            for (int h(0) ; h < BlockHeight_ ; ++h)
+            {
+              for (int w(0) ; w < BlockWidth_ ; ++w)
+              {
+                bsum[h] += bval[i][h][w] * bx[col_ind[i]][w];
+              }
+            }
+          }
+          const IT_ end2(row_ptr2[row + 1]);
+          for (IT_ i(row_ptr2[row]) ; i < end2 ; ++i)
+          {
+            for (int h(0) ; h < BlockHeight_ ; ++h)
+            {
+              for (int w(0) ; w < BlockWidth2_ ; ++w)
+              {
+                bsum[h] += bval2[i][h][w] * bz[col_ind2[i]][w];
+              }
+            }
+          }
+          if (use_y)
+            br[row] = (bsum * a) + (b * by[row]);
+          else
+            br[row] = bsum * a;
+        }
+      }
+
       template <int BlockSize_, typename DT_, typename IT_>
       void Apply::csrsb_generic(DT_ * r, const DT_ a, const DT_ * const x, const DT_ b, const DT_ * const y, const DT_ * const val, const IT_ * const col_ind, const IT_ * const row_ptr, const Index rows, const Index, const Index)
       {
@@ -180,6 +228,102 @@ namespace FEAT
         }
       }
 
+      template <typename DT_, typename IT_>
+      void Apply::csr_mrhs_generic(DT_ * r, const DT_ a, const DT_ * const x, const DT_ b, const DT_ * const y, const DT_ * const val,
+                                   const IT_ * const col_ind, const IT_ * const row_ptr, const Index rows, const Index num_rhs)
+      {
+        // the right-hand-sides are processed in chunks, so that the row sums fit into registers
+        static constexpr Index chunk = 8;
+        const bool zero_b = (Math::abs(b) < Math::eps<DT_>());
+
+        for (Index row(0) ; row < rows ; ++row)
+        {
+          const IT_ end(row_ptr[row + 1]);
+          for (Index jb(0) ; jb < num_rhs ; jb += chunk)
+          {
+            const Index nj = Math::min(chunk, num_rhs - jb);
+            DT_ sum[chunk];
+            for (Index j(0) ; j < chunk ; ++j)
+              sum[j] = DT_(0);
+
+            for (IT_ i(row_ptr[row]) ; i < end ; ++i)
+            {
+              const DT_ v(val[i]);
+              const DT_ * xi = &x[Index(col_ind[i]) * num_rhs + jb];
+              for (Index j(0) ; j < nj ; ++j)
+                sum[j] += v * xi[j];
+            }
+
+            DT_ * ri = &r[row * num_rhs + jb];
+            if (zero_b)
+            {
+              for (Index j(0) ; j < nj ; ++j)
+                ri[j] = a * sum[j];
+            }
+            else
+            {
+              const DT_ * yi = &y[row * num_rhs + jb];
+              for (Index j(0) ; j < nj ; ++j)
+                ri[j] = a * sum[j] + b * yi[j];
+            }
+          }
+        }
+      }
+
+      template <int BlockHeight_, int BlockWidth_, typename DT_, typename IT_>
+      void Apply::bcsr_mrhs_generic(DT_ * r, const DT_ a, const DT_ * const x, const DT_ b, const DT_ * const y, const DT_ * const val,
+                                    const IT_ * const col_ind, const IT_ * const row_ptr, const Index rows, const Index num_rhs)
+      {
+        // the right-hand-sides are processed in chunks, so that the row sums fit into registers
+        static constexpr Index chunk = 4;
+        static constexpr Index bs = Index(BlockHeight_ * BlockWidth_);
+        const bool zero_b = (Math::abs(b) < Math::eps<DT_>());
+
+        for (Index row(0) ; row < rows ; ++row)
+        {
+          const IT_ end(row_ptr[row + 1]);
+          for (Index jb(0) ; jb < num_rhs ; jb += chunk)
+          {
+            const Index nj = Math::min(chunk, num_rhs - jb);
+            DT_ sum[BlockHeight_][chunk];
+            for (int h(0) ; h < BlockHeight_ ; ++h)
+              for (Index j(0) ; j < chunk ; ++j)
+                sum[h][j] = DT_(0);
+
+            for (IT_ i(row_ptr[row]) ; i < end ; ++i)
+            {
+              const DT_ * bv = &val[Index(i) * bs];
+              const DT_ * xi = &x[Index(col_ind[i]) * Index(BlockWidth_) * num_rhs + jb];
+              for (int h(0) ; h < BlockHeight_ ; ++h)
+              {
+                for (int w(0) ; w < BlockWidth_ ; ++w)
+                {
+                  const DT_ v(bv[h * BlockWidth_ + w]);
+                  const DT_ * xw = &xi[Index(w) * num_rhs];
+                  for (Index j(0) ; j < nj ; ++j)
+                    sum[h][j] += v * xw[j];
+                }
+              }
+            }
+
+            for (int h(0) ; h < BlockHeight_ ; ++h)
+            {
+              const Index off = (row * Index(BlockHeight_) + Index(h)) * num_rhs + jb;
+              if (zero_b)
+              {
+                for (Index j(0) ; j < nj ; ++j)
+                  r[off + j] = a * sum[h][j];
+              }
+              else
+              {
+                for (Index j(0) ; j < nj ; ++j)
+                  r[off + j] = a * sum[h][j] + b * y[off + j];
+              }
+            }
+          }
+        }
+      }
+
       namespace Intern
       {
         template <Index Start, Index End, Index Step = 1>
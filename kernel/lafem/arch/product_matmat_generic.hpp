@@ -14,6 +14,7 @@
 #include <kernel/util/math.hpp>
 
 #include <iostream>
+#include <vector>
 
 namespace FEAT
 {
@@ -24,18 +25,90 @@ namespace FEAT
       template <typename DT_>
       void ProductMatMat::dense_generic(DT_ * r, const DT_ alpha, const DT_ beta, const DT_ * const x, const DT_ * const y, const DT_ * const z, const Index rows, const Index columns, const Index inner)
       {
-        for (Index i(0) ; i < rows ; ++i)
+        // Blocking parameters: the y-matrix is processed in panels of kc x nc entries, which are
+        // packed into a contiguous buffer that fits into the L2 cache; each panel is multiplied
+        // onto mr rows of x at once, so that each packed panel row is reused mr times while the
+        // innermost loop runs over contiguous memory and can be vectorized by the compiler.
+        static constexpr Index kc = 128;
+        static constexpr Index nc = 512;
+        static constexpr Index mr = 4;
+
+        // packed y-panel buffer
+        std::vector<DT_> vpanel(Math::min(kc, inner) * Math::min(nc, columns));
+        DT_* panel = vpanel.data();
+
+        FEAT_PRAGMA_OMP(parallel if(rows * columns * inner >= Index(32768)))
         {
-          for (Index j(0) ; j < columns ; ++j)
+          // r := beta * z
+          FEAT_PRAGMA_OMP(for schedule(static))
+          for (Index i = 0 ; i < rows * columns ; ++i)
+          {
+            r[i] = (beta != DT_(0) ? beta * z[i] : DT_(0));
+          }
+
+          // r += alpha * x * y
+          for (Index jj(0) ; jj < columns ; jj += nc)
           {
-            DT_ sum(0.);
-            Index xindex(i * inner);
-            Index yindex(j);
-            for (Index xcol(0) ; xcol < inner ; ++xcol)
+            const Index nb = Math::min(nc, columns - jj);
+            for (Index kk(0) ; kk < inner ; kk += kc)
             {
-              sum  = sum + x[xindex + xcol] * y[yindex + xcol * columns];
+              const Index kb = Math::min(kc, inner - kk);
+
+              // pack the kb x nb panel of y
+              FEAT_PRAGMA_OMP(for schedule(static))
+              for (Index k = 0 ; k < kb ; ++k)
+              {
+                for (Index j(0) ; j < nb ; ++j)
+                {
+                  panel[k * nb + j] = y[(kk + k) * columns + jj + j];
+                }
+              }
+
+              // multiply the panel onto mr rows of x at once
+              FEAT_PRAGMA_OMP(for schedule(static))
+              for (Index ii = 0 ; ii < rows ; ii += mr)
+              {
+                if (ii + mr <= rows)
+                {
+                  DT_ * r0 = &r[(ii + 0) * columns + jj];
+                  DT_ * r1 = &r[(ii + 1) * columns + jj];
+                  DT_ * r2 = &r[(ii + 2) * columns + jj];
+                  DT_ * r3 = &r[(ii + 3) * columns + jj];
+                  for (Index k(0) ; k < kb ; ++k)
+                  {
+                    const DT_ a0 = alpha * x[(ii + 0) * inner + kk + k];
+                    const DT_ a1 = alpha * x[(ii + 1) * inner + kk + k];
+                    const DT_ a2 = alpha * x[(ii + 2) * inner + kk + k];
+                    const DT_ a3 = alpha * x[(ii + 3) * inner + kk + k];
+                    const DT_ * bk = &panel[k * nb];
+                    for (Index j(0) ; j < nb ; ++j)
+                    {
+                      r0[j] += a0 * bk[j];
+                      r1[j] += a1 * bk[j];
+                      r2[j] += a2 * bk[j];
+                      r3[j] += a3 * bk[j];
+                    }
+                  }
+                }
+                else
+                {
+                  // remainder rows
+                  for (Index i(ii) ; i < rows ; ++i)
+                  {
+                    DT_ * ri = &r[i * columns + jj];
+                    for (Index k(0) ; k < kb ; ++k)
+                    {
+                      const DT_ ai = alpha * x[i * inner + kk + k];
+                      const DT_ * bk = &panel[k * nb];
+                      for (Index j(0) ; j < nb ; ++j)
+                      {
+                        ri[j] += ai * bk[j];
+                      }
+                    }
+                  }
+                }
+              }
             }
-            r[i * columns + j] = beta * z[i * columns + j] + alpha * sum;
           }
         }
       }
@@ -44,18 +117,23 @@ namespace FEAT
       void ProductMatMat::dsd_generic(DT_ * r, const DT_ alpha, const DT_ beta, const DT_ * const val, const IT_ * const col_ind, const IT_ * const row_ptr, const Index /*used_elements*/,
                                          const DT_ * y, const Index rows,  const Index columns, const Index /*inner*/)
       {
-        for (Index i(0) ; i < rows ; ++i)
+        // process each row of r by adding scaled rows of y, so that all accesses to y and r are contiguous
+        FEAT_PRAGMA_OMP(parallel for schedule(dynamic, 64) if(rows * columns >= Index(4096)))
+        for (Index i = 0 ; i < rows ; ++i)
         {
+          DT_ * ri = &r[i * columns];
           for (Index j(0) ; j < columns ; ++j)
           {
-            DT_ sum(0.);
-	    Index xindex = row_ptr[i];
-            Index yindex(j);
-            for (Index tmp(xindex) ; tmp < row_ptr[i+1] ; ++tmp)
+            ri[j] = (beta != DT_(0) ? beta * ri[j] : DT_(0));
+          }
+          for (Index tmp(row_ptr[i]) ; tmp < Index(row_ptr[i+1]) ; ++tmp)
+          {
+            const DT_ a = alpha * val[tmp];
+            const DT_ * yk = &y[Index(col_ind[tmp]) * columns];
+            for (Index j(0) ; j < columns ; ++j)
             {
-              sum  = sum + val[tmp] * y[yindex + col_ind[tmp] * columns];
+              ri[j] += a * yk[j];
             }
-            r[i * columns + j] = beta * r[i * columns + j] + alpha * sum;
           }
         }
       }
@@ -16,6 +16,7 @@
 #include <kernel/util/pack.hpp>
 
 
+#include <algorithm>
 #include <vector>
 #include <limits>
 #include <cmath>
@@ -1050,6 +1051,59 @@ namespace FEAT
         return tbytes;
       }
 
+      /**
+       * \brief Checks whether this container shares its index arrays with another container.
+       *
+       * \param[in] other The other container.
+       *
+       * \returns \c true, if both containers reference the same non-empty set of index arrays.
+       */
+      template<typename DT2_>
+      bool shares_indices(const Container<DT2_, IT_> & other) const
+      {
+        return (!_indices.empty()) && (_indices == other._indices);
+      }
+
+      /**
+       * \brief Shares the index arrays of another container with identical contents.
+       *
+       * \param[in] other The other container, whose index arrays are to be shared.
+       *
+       * If all index arrays of this container coincide with the index arrays of the other container,
+       * then this container releases its own index arrays and references the (reference-counted) index
+       * arrays of the other container instead. This allows to store the index arrays of matrices with
+       * identical sparsity patterns only once, even if these matrices have been converted or deserialized
+       * independently of each other. The data arrays of this container remain untouched.
+       *
+       * \returns \c true, if this container shares the index arrays of the other container after the call.
+       */
+      template<typename DT2_>
+      bool share_indices(const Container<DT2_, IT_> & other)
+      {
+        if(_foreign_memory || other._foreign_memory)
+          return false;
+        if(_indices.empty() || (_indices.size() != other._indices.size()) || (_indices_size != other._indices_size))
+          return false;
+        if(_indices == other._indices)
+          return true;
+
+        // compare the contents of all index arrays
+        for(std::size_t i(0); i < _indices.size(); ++i)
+        {
+          if(!std::equal(_indices.at(i), _indices.at(i) + _indices_size.at(i), other._indices.at(i)))
+            return false;
+        }
+
+        // replace our index arrays by the ones of the other container
+        for(std::size_t i(0); i < _indices.size(); ++i)
+        {
+          MemoryPool::increase_memory(other._indices.at(i));
+          MemoryPool::release_memory(_indices.at(i));
+          _indices.at(i) = other._indices.at(i);
+        }
+        return true;
+      }
+
 
       /**
        * \brief Returns a list of all data arrays.
@@ -561,6 +561,80 @@ DenseMatrixMultiplyTest <float, std::uint64_t> cuda_dense_matrix_multiply_test_f
 DenseMatrixMultiplyTest <double, std::uint64_t> cuda_dense_matrix_multiply_test_double_uint64(PreferredBackend::cuda, 1e-6);
 #endif
 
+/**
+ * \brief Test class for the cache-blocked dense matrix kernels.
+ *
+ * \test Tests the dense matrix product and inversion for matrices, whose dimensions exceed the
+ * block sizes of the generic kernels.
+ */
+template<
+  typename DT_,
+  typename IT_>
+  class DenseMatrixBlockedTest
+  : public UnitTest
+{
+public:
+  explicit DenseMatrixBlockedTest(PreferredBackend backend)
+    : UnitTest("DenseMatrixBlockedTest", Type::Traits<DT_>::name(), Type::Traits<IT_>::name(), backend)
+  {
+  }
+
+  virtual ~DenseMatrixBlockedTest()
+  {
+  }
+
+  virtual void run() const override
+  {
+    const DT_ tol = Math::pow(Math::eps<DT_>(), DT_(0.7));
+
+    // dimensions are chosen to have incomplete blocks in all directions
+    const Index m(150), k(300), n(530);
+    DenseMatrix<DT_, IT_> x(m, k), y(k, n), z(m, n), result(m, n);
+    for (Index i(0); i < x.size(); ++i)
+      x.elements()[i] = DT_(1) / DT_(1 + (7*i) % 97);
+    for (Index i(0); i < y.size(); ++i)
+      y.elements()[i] = DT_(1) / DT_(1 + (5*i) % 89) - DT_(0.1);
+    for (Index i(0); i < z.size(); ++i)
+      z.elements()[i] = DT_(i % 13);
+
+    // result := 2*x*y - z
+    result.multiply(x, y, z, DT_(2), -DT_(1));
+
+    for (Index i(0); i < m; ++i)
+    {
+      for (Index j(0); j < n; ++j)
+      {
+        DT_ sum(0), asum(0);
+        for (Index l(0); l < k; ++l)
+        {
+          sum += x(i, l) * y(l, j);
+          asum += Math::abs(x(i, l) * y(l, j));
+        }
+        TEST_CHECK_EQUAL_WITHIN_EPS(result(i, j), DT_(2) * sum - z(i, j), tol * (DT_(1) + asum));
+      }
+    }
+
+    // invert a diagonally dominant matrix, which is large enough to use the blocked LU factorization
+    const Index nn(100);
+    DenseMatrix<DT_, IT_> a(nn, nn);
+    for (Index i(0); i < nn; ++i)
+    {
+      for (Index j(0); j < nn; ++j)
+        a(i, j, (i == j ? DT_(nn) : DT_(1) / DT_(1 + (i*j) % 17)));
+    }
+    DenseMatrix<DT_, IT_> ai = a.inverse();
+    DenseMatrix<DT_, IT_> id(nn, nn);
+    id.multiply(a, ai);
+    for (Index i(0); i < nn; ++i)
+    {
+      for (Index j(0); j < nn; ++j)
+        TEST_CHECK_EQUAL_WITHIN_EPS(id(i, j), (i == j ? DT_(1) : DT_(0)), tol);
+    }
+  }
+};
+DenseMatrixBlockedTest <float, std::uint32_t> dense_matrix_blocked_test_float_uint32(PreferredBackend::generic);
+DenseMatrixBlockedTest <double, std::uint64_t> dense_matrix_blocked_test_double_uint64(PreferredBackend::generic);
+
 template<
   typename DT_,
   typename IT_>
@@ -569,6 +569,19 @@ namespace FEAT
         return result;
       }
 
+      /**
+       * \brief Calculates the Euclidean norm of this matrix interpreted as a vector
+       *
+       * This is identical to the Frobenius norm; it allows dense matrices to be used as
+       * multi-vectors in the iterative solvers.
+       *
+       * \returns The Frobenius norm of this matrix.
+       */
+      DT_ norm2() const
+      {
+        return this->norm_frobenius();
+      }
+
       /**
        * \brief Calculate \f$this \leftarrow \alpha~ x + y\f$
        *
@@ -765,9 +778,27 @@ namespace FEAT
         TimeStamp ts_start;
         Statistics::add_flops(this->used_elements() * this->columns()*2);
 
-        IT_ * temp = new IT_[this->rows()];
-        Math::invert_matrix((IT_)this->rows(), (IT_)this->rows(), this->elements(), temp);
-        delete[] temp;
+        const IT_ n = IT_(this->rows());
+        std::vector<IT_> pivot(this->rows());
+        if(n < IT_(64))
+        {
+          Math::invert_matrix(n, n, this->elements(), pivot.data());
+        }
+        else
+        {
+          // for larger matrices, use the blocked LU factorization and solve for the identity matrix
+          std::vector<DT_> lu(this->elements(), this->elements() + this->used_elements());
+          Math::factorize_lu(n, n, lu.data(), pivot.data());
+          DT_ * inv = this->elements();
+          for(IT_ i(0); i < n; ++i)
+          {
+            for(IT_ j(0); j < n; ++j)
+            {
+              inv[i*n + j] = (i == j ? DT_(1) : DT_(0));
+            }
+          }
+          Math::solve_lu(n, n, lu.data(), pivot.data(), n, inv, n);
+        }
 
         TimeStamp ts_stop;
         Statistics::add_time_blas3(ts_stop.elapsed(ts_start));
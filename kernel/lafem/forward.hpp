@@ -48,6 +48,12 @@ namespace FEAT
     template<typename DT_, typename IT_>
     class MatrixMirror;
 
+    template<typename SubType_, int count_>
+    class PowerVector;
+
+    template<typename First_, typename... Rest_>
+    class TupleVector;
+
   } // namespace LAFEM
 } // namespace FEAT
 
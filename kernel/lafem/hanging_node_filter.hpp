@@ -0,0 +1,440 @@
+// FEAT3: Finite Element Analysis Toolbox, Version 3
+// Copyright (C) 2010 - 2023 by Stefan Turek & the FEAT group
+// FEAT3 is released under the GNU General Public License version 3,
+// see the file 'copyright.txt' in the top level directory for details.
+
+#pragma once
+#ifndef KERNEL_LAFEM_HANGING_NODE_FILTER_HPP
+#define KERNEL_LAFEM_HANGING_NODE_FILTER_HPP 1
+
+// includes, FEAT
+#include <kernel/base_header.hpp>
+#include <kernel/lafem/dense_vector.hpp>
+#include <kernel/lafem/sparse_matrix_csr.hpp>
+
+// includes, system
+#include <map>
+#include <vector>
+
+namespace FEAT
+{
+  namespace LAFEM
+  {
+    /**
+     * \brief Hanging-Node Filter class template.
+     *
+     * This filter implements the continuity constraints of conforming finite element spaces on
+     * meshes with hanging vertices, which are created by the Geometry::HangingNodeRefinery class.
+     * Each constrained (slave) DOF is a linear combination of a set of unconstrained (master) DOFs
+     * plus an optional offset, i.e.
+     *   \f[x_s = o_s + \sum_m w_{s,m}\cdot x_m\f]
+     * where the offset o_s is non-zero only if the slave depends on a master DOF that is fixed by
+     * a Dirichlet boundary condition, see the Assembly::HangingNodeFilterAssembler class.
+     *
+     * Let P denote the prolongation matrix, which maps the master DOFs onto all DOFs by the above
+     * constraints, then this filter allows to solve the conforming system P^T*A*P*x = P^T*b by an
+     * iterative solver, where A and b are the matrix and the right-hand-side vector assembled in
+     * the usual way on the mesh with hanging vertices:
+     * - the solution and correction filters evaluate the constraints of all slave DOFs
+     * - the right-hand-side and defect filters apply P^T, i.e. the entries of all slave DOFs are
+     *   distributed to their master DOFs and are set to zero afterwards
+     *
+     * Since all master DOFs are unconstrained, this filter can be combined with a UnitFilter in a
+     * LAFEM::FilterChain in arbitrary order.
+     *
+     * The #filter_mat() function replaces a CSR matrix A by the conforming matrix P^T*A*P, which is
+     * extended by unit rows for all slave DOFs, so that the filtered matrix can be passed to direct
+     * solvers and matrix-based preconditioners. Since all master DOFs are unconstrained, this also
+     * commutes with the UnitFilter::filter_mat() function.
+     *
+     * On partitioned domains, this filter has to be wrapped into a Global::HangingNodeFilter, which
+     * applies the right-hand-side and defect filters to the type-0 vectors.
+     *
+     * \note
+     * The filtered matrix does not couple the offsets of the slave DOFs to their neighbor DOFs, so it
+     * is only valid for correction vectors and for solution vectors with vanishing offsets, i.e. the
+     * defect of a solution vector with non-zero offsets has to be computed with the unfiltered matrix.
+     */
+    template<
+      typename DT_,
+      typename IT_ = Index>
+    class HangingNodeFilter
+    {
+    public:
+      /// data-type typedef
+      typedef DT_ DataType;
+      /// index-type typedef
+      typedef IT_ IndexType;
+
+      /// our supported vector type
+      typedef DenseVector<DataType, IndexType> VectorType;
+
+      /// Our 'base' class type
+      template <typename DT2_ = DT_, typename IT2_ = IT_>
+      using FilterType = HangingNodeFilter<DT2_, IT2_>;
+
+      /// this typedef lets you create a filter with new Datatype and Index types
+      template <typename DataType2_, typename IndexType2_>
+      using FilterTypeByDI = FilterType<DataType2_, IndexType2_>;
+
+      static constexpr bool is_global = false;
+      static constexpr bool is_local = true;
+
+    private:
+      /// the total size of the filter
+      Index _size;
+      /// the indices of all slave DOFs
+      DenseVector<IT_, IT_> _slaves;
+      /// the master pointer array
+      DenseVector<IT_, IT_> _master_ptr;
+      /// the master index array
+      DenseVector<IT_, IT_> _master_idx;
+      /// the master weight array
+      DenseVector<DT_, IT_> _weights;
+      /// the slave offsets
+      DenseVector<DT_, IT_> _offsets;
+
+    public:
+      /// default constructor
+      HangingNodeFilter() :
+        _size(0)
+      {
+      }
+
+      /**
+       * \brief Constructor
+       *
+       * \param[in] size_in
+       * The total size of the filter.
+       *
+       * \param[in] slaves
+       * The indices of the slave DOFs.
+       *
+       * \param[in] master_ptr, master_idx, weights
+       * The master DOFs and their weights of each slave DOF in CSR format.
+       *
+       * \param[in] offsets
+       * The offsets of the slave DOFs.
+       */
+      explicit HangingNodeFilter(Index size_in, DenseVector<IT_, IT_>&& slaves,
+        DenseVector<IT_, IT_>&& master_ptr, DenseVector<IT_, IT_>&& master_idx,
+        DenseVector<DT_, IT_>&& weights, DenseVector<DT_, IT_>&& offsets) :
+        _size(size_in),
+        _slaves(std::forward<DenseVector<IT_, IT_>>(slaves)),
+        _master_ptr(std::forward<DenseVector<IT_, IT_>>(master_ptr)),
+        _master_idx(std::forward<DenseVector<IT_, IT_>>(master_idx)),
+        _weights(std::forward<DenseVector<DT_, IT_>>(weights)),
+        _offsets(std::forward<DenseVector<DT_, IT_>>(offsets))
+      {
+        XASSERTM(_master_ptr.size() == _slaves.size() + 1u, "invalid master pointer array size");
+        XASSERTM(_master_idx.size() == _weights.size(), "invalid master weight array size");
+        XASSERTM(_offsets.size() == _slaves.size(), "invalid offset array size");
+      }
+
+      /// move-ctor
+      HangingNodeFilter(HangingNodeFilter && other) :
+        _size(other._size),
+        _slaves(std::move(other._slaves)),
+        _master_ptr(std::move(other._master_ptr)),
+        _master_idx(std::move(other._master_idx)),
+        _weights(std::move(other._weights)),
+        _offsets(std::move(other._offsets))
+      {
+      }
+
+      /// move-assignment operator
+      HangingNodeFilter & operator=(HangingNodeFilter && other)
+      {
+        if(this != &other)
+        {
+          _size = other._size;
+          _slaves = std::move(other._slaves);
+          _master_ptr = std::move(other._master_ptr);
+          _master_idx = std::move(other._master_idx);
+          _weights = std::move(other._weights);
+          _offsets = std::move(other._offsets);
+        }
+        return *this;
+      }
+
+      /// virtual destructor
+      virtual ~HangingNodeFilter()
+      {
+      }
+
+      /// \brief Creates a clone of itself
+      HangingNodeFilter clone(CloneMode clone_mode = CloneMode::Deep) const
+      {
+        HangingNodeFilter other;
+        other.clone(*this, clone_mode);
+        return other;
+      }
+
+      /// \brief Clones data from another HangingNodeFilter
+      void clone(const HangingNodeFilter & other, CloneMode clone_mode = CloneMode::Deep)
+      {
+        _size = other._size;
+        _slaves.clone(other._slaves, clone_mode);
+        _master_ptr.clone(other._master_ptr, clone_mode);
+        _master_idx.clone(other._master_idx, clone_mode);
+        _weights.clone(other._weights, clone_mode);
+        _offsets.clone(other._offsets, clone_mode);
+      }
+
+      /// \brief Converts data from another HangingNodeFilter
+      template<typename DT2_, typename IT2_>
+      void convert(const HangingNodeFilter<DT2_, IT2_>& other)
+      {
+        _size = other.size();
+        _slaves.convert(other.get_slaves());
+        _master_ptr.convert(other.get_master_ptr());
+        _master_idx.convert(other.get_master_idx());
+        _weights.convert(other.get_weights());
+        _offsets.convert(other.get_offsets());
+      }
+
+      /// \brief Clears the underlying data
+      void clear()
+      {
+        _size = Index(0);
+        _slaves.clear();
+        _master_ptr.clear();
+        _master_idx.clear();
+        _weights.clear();
+        _offsets.clear();
+      }
+
+      /// \brief Returns the total amount of bytes allocated.
+      std::size_t bytes() const
+      {
+        return _slaves.bytes() + _master_ptr.bytes() + _master_idx.bytes() + _weights.bytes() + _offsets.bytes();
+      }
+
+      /// \returns The total size of the filter.
+      Index size() const
+      {
+        return _size;
+      }
+
+      /// \returns The number of slave DOFs.
+      Index used_elements() const
+      {
+        return _slaves.size();
+      }
+
+      /// \cond internal
+      const DenseVector<IT_, IT_>& get_slaves() const
+      {
+        return _slaves;
+      }
+
+      const DenseVector<IT_, IT_>& get_master_ptr() const
+      {
+        return _master_ptr;
+      }
+
+      const DenseVector<IT_, IT_>& get_master_idx() const
+      {
+        return _master_idx;
+      }
+
+      const DenseVector<DT_, IT_>& get_weights() const
+      {
+        return _weights;
+      }
+
+      DenseVector<DT_, IT_>& get_offsets()
+      {
+        return _offsets;
+      }
+
+      const DenseVector<DT_, IT_>& get_offsets() const
+      {
+        return _offsets;
+      }
+      /// \endcond
+
+      /**
+       * \brief Applies the filter onto the right-hand-side vector.
+       *
+       * \param[in,out] vector
+       * A reference to the right-hand-side vector to be filtered.
+       */
+      void filter_rhs(VectorType& vector) const
+      {
+        _restrict(vector);
+      }
+
+      /**
+       * \brief Applies the filter onto the solution vector.
+       *
+       * \param[in,out] vector
+       * A reference to the solution vector to be filtered.
+       */
+      void filter_sol(VectorType& vector) const
+      {
+        _prolongate(vector, true);
+      }
+
+      /**
+       * \brief Applies the filter onto a defect vector.
+       *
+       * \param[in,out] vector
+       * A reference to the defect vector to be filtered.
+       */
+      void filter_def(VectorType& vector) const
+      {
+        // same as rhs
+        _restrict(vector);
+      }
+
+      /**
+       * \brief Applies the filter onto a correction vector.
+       *
+       * \param[in,out] vector
+       * A reference to the correction vector to be filtered.
+       */
+      void filter_cor(VectorType& vector) const
+      {
+        _prolongate(vector, false);
+      }
+
+      /**
+       * \brief Applies the filter onto a system matrix.
+       *
+       * This function replaces the matrix A by the conforming matrix P^T*A*P, where all slave rows
+       * are unit rows and all slave columns are empty. Since the sparsity pattern is extended by the
+       * couplings of the master DOFs, the matrix receives a new layout, which is not shared with any
+       * other matrix.
+       *
+       * \param[in,out] matrix
+       * A reference to the matrix to be filtered.
+       */
+      void filter_mat(SparseMatrixCSR<DT_, IT_>& matrix) const
+      {
+        const Index n = _slaves.size();
+        if(n == Index(0))
+          return;
+        XASSERTM(_size == matrix.rows(), "Matrix size does not match!");
+        XASSERTM(_size == matrix.columns(), "Matrix is not square!");
+
+        const IT_* sl = _slaves.elements();
+        const IT_* ptr = _master_ptr.elements();
+        const IT_* idx = _master_idx.elements();
+        const DT_* w = _weights.elements();
+        const IT_* row_ptr = matrix.row_ptr();
+        const IT_* col_idx = matrix.col_ind();
+        const DT_* val = matrix.val();
+
+        // slave index of each DOF or n for all master and unconstrained DOFs
+        std::vector<Index> slave_of(_size, n);
+        for(Index i(0); i < n; ++i)
+          slave_of[sl[i]] = i;
+
+        // distribute each entry A(i,j) onto the entries C(p,q) of all masters p of i and q of j
+        std::vector<std::map<IT_, DT_>> rows(_size);
+        for(Index i(0); i < _size; ++i)
+        {
+          const Index si = slave_of[i];
+          const IT_ pb = (si < n ? ptr[si] : IT_(0));
+          const IT_ pe = (si < n ? ptr[si+1] : IT_(1));
+          for(IT_ k(row_ptr[i]); k < row_ptr[i+1]; ++k)
+          {
+            const Index j = Index(col_idx[k]);
+            const Index sj = slave_of[j];
+            const IT_ qb = (sj < n ? ptr[sj] : IT_(0));
+            const IT_ qe = (sj < n ? ptr[sj+1] : IT_(1));
+            for(IT_ pi(pb); pi < pe; ++pi)
+            {
+              const IT_ p = (si < n ? idx[pi] : IT_(i));
+              const DT_ wp = (si < n ? w[pi] : DT_(1)) * val[k];
+              for(IT_ qi(qb); qi < qe; ++qi)
+                rows[p][(sj < n ? idx[qi] : IT_(j))] += wp * (sj < n ? w[qi] : DT_(1));
+            }
+          }
+        }
+
+        // unit rows for all slaves
+        for(Index i(0); i < n; ++i)
+          rows[sl[i]][sl[i]] = DT_(1);
+
+        Index nnz(0);
+        for(const auto& r : rows)
+          nnz += Index(r.size());
+
+        DenseVector<IT_, IT_> new_row_ptr(_size + 1u);
+        DenseVector<IT_, IT_> new_col_idx(nnz);
+        DenseVector<DT_, IT_> new_val(nnz);
+        IT_* nrp = new_row_ptr.elements();
+        IT_* nci = new_col_idx.elements();
+        DT_* nv = new_val.elements();
+        nrp[0] = IT_(0);
+        for(Index i(0); i < _size; ++i)
+        {
+          IT_ k = nrp[i];
+          for(const auto& e : rows[i])
+          {
+            nci[k] = e.first;
+            nv[k] = e.second;
+            ++k;
+          }
+          nrp[i+1] = k;
+        }
+
+        matrix = SparseMatrixCSR<DT_, IT_>(_size, _size, new_col_idx, new_val, new_row_ptr);
+      }
+
+    protected:
+      /// distributes the slave entries to their masters
+      void _restrict(VectorType& vector) const
+      {
+        const Index n = _slaves.size();
+        if(n == Index(0))
+          return;
+        XASSERTM(_size == vector.size(), "Vector size does not match!");
+
+        DT_* v = vector.elements();
+        const IT_* sl = _slaves.elements();
+        const IT_* ptr = _master_ptr.elements();
+        const IT_* idx = _master_idx.elements();
+        const DT_* w = _weights.elements();
+
+        // note: masters are never slaves, so the order of the slaves does not matter
+        for(Index i(0); i < n; ++i)
+        {
+          const DT_ vs = v[sl[i]];
+          for(IT_ j(ptr[i]); j < ptr[i+1]; ++j)
+            v[idx[j]] += w[j] * vs;
+          v[sl[i]] = DT_(0);
+        }
+      }
+
+      /// evaluates the slave entries from their masters
+      void _prolongate(VectorType& vector, bool offsets) const
+      {
+        const Index n = _slaves.size();
+        if(n == Index(0))
+          return;
+        XASSERTM(_size == vector.size(), "Vector size does not match!");
+
+        DT_* v = vector.elements();
+        const IT_* sl = _slaves.elements();
+        const IT_* ptr = _master_ptr.elements();
+        const IT_* idx = _master_idx.elements();
+        const DT_* w = _weights.elements();
+        const DT_* off = _offsets.elements();
+
+        FEAT_PRAGMA_OMP(parallel for)
+        for(Index i = 0; i < n; ++i)
+        {
+          DT_ vs = (offsets ? off[i] : DT_(0));
+          for(IT_ j(ptr[i]); j < ptr[i+1]; ++j)
+            vs += w[j] * v[idx[j]];
+          v[sl[i]] = vs;
+        }
+      }
+    }; // class HangingNodeFilter<...>
+  } // namespace LAFEM
+} // namespace FEAT
+
+#endif // KERNEL_LAFEM_HANGING_NODE_FILTER_HPP
@@ -0,0 +1,509 @@
+// FEAT3: Finite Element Analysis Toolbox, Version 3
+// Copyright (C) 2010 - 2023 by Stefan Turek & the FEAT group
+// FEAT3 is released under the GNU General Public License version 3,
+// see the file 'copyright.txt' in the top level directory for details.
+
+#pragma once
+#ifndef KERNEL_LAFEM_MACRO_STRUCTURED_MATRIX_HPP
+#define KERNEL_LAFEM_MACRO_STRUCTURED_MATRIX_HPP 1
+
+// includes, FEAT
+#include <kernel/lafem/dense_vector.hpp>
+#include <kernel/lafem/sparse_matrix_banded.hpp>
+#include <kernel/util/assertion.hpp>
+
+// includes, system
+#include <vector>
+
+namespace FEAT
+{
+  namespace LAFEM
+  {
+    /**
+     * \brief Macro-wise structured matrix for vertex-based discretizations on quadrilateral meshes
+     *
+     * This class represents a matrix of a vertex-based (i.e. Q1) discretization on a mesh, which
+     * is obtained by refining each cell of a quadrilateral base mesh (the so-called \e macros)
+     * into a logically structured patch of n x n cells. The fine mesh topology is never stored
+     * explicitly: instead, the DOFs are numbered as follows:
+     * - the first \e V DOFs correspond to the \e V vertices of the base mesh
+     * - the next E*(n-1) DOFs correspond to the inner points of the \e E edges of the base mesh,
+     *   ordered from the first to the second vertex of each base mesh edge
+     * - the remaining M*(n-1)^2 DOFs correspond to the inner points of the \e M macros, ordered
+     *   lexicographically within each macro
+     *
+     * Hence, only the base mesh vertex and edge indices of each macro need to be stored, and the
+     * DOFs of the macro interior are addressed as contiguous index ranges.
+     *
+     * The matrix itself is stored as the sum of one local (n+1)^2 x (n+1)^2 SparseMatrixBanded
+     * per macro, which uses the lexicographic local vertex ordering of the macro patch, i.e.
+     * the local DOF (i,j) for 0 <= i,j <= n has the local index i + j*(n+1). The local vertex
+     * 0, 1, 2 and 3 of the macro correspond to the local DOFs (0,0), (n,0), (0,n) and (n,n).
+     * The matrix-vector product is performed macro-wise by gathering the local DOFs, applying
+     * the banded macro matrix and scatter-adding the result, so that the finest level operator
+     * is applied by contiguous and vectorizable band kernels. The local DOFs are gathered into
+     * scratch arrays, which are allocated by each call, so all const member functions of this
+     * class may be called concurrently.
+     *
+     * The Assembly::MacroStructuredAssembler class can also assemble the vector mirrors of the
+     * halos of a partitioned base mesh, so that the matrix can be used as the local matrix of a
+     * Global::Matrix, e.g. by the Control::ScalarBasicSystemLevel class in combination with the
+     * Control::Domain::PartiDomainControl class.
+     *
+     * Use the Assembly::MacroStructuredAssembler class to set up the layout, the macro matrices
+     * and the grid transfer matrices between two macro-structured matrices over the same base
+     * mesh, which allows the matrix to be used as a system matrix on each level of the
+     * Solver::MultiGrid solver together with LAFEM::Transfer.
+     *
+     * \tparam DT_
+     * The data type of the matrix.
+     *
+     * \tparam IT_
+     * The index type of the matrix.
+     */
+    template<typename DT_, typename IT_>
+    class MacroStructuredMatrix
+    {
+    public:
+      /// Our datatype
+      typedef DT_ DataType;
+      /// Our indextype
+      typedef IT_ IndexType;
+      /// Compatible L-vector type
+      typedef DenseVector<DT_, IT_> VectorTypeL;
+      /// Compatible R-vector type
+      typedef DenseVector<DT_, IT_> VectorTypeR;
+      /// the local macro matrix type
+      typedef SparseMatrixBanded<DT_, IT_> MacroMatrixType;
+
+      /// Our 'base' class type
+      template <typename DT2_ = DT_, typename IT2_ = IT_>
+      using ContainerType = MacroStructuredMatrix<DT2_, IT2_>;
+
+      /// this typedef lets you create a matrix container with new Datatype and Index types
+      template <typename DataType2_, typename IndexType2_>
+      using ContainerTypeByDI = ContainerType<DataType2_, IndexType2_>;
+
+    protected:
+      /// the number of slices per macro edge
+      Index _num_slices;
+      /// the number of base mesh vertices
+      Index _num_verts;
+      /// the number of base mesh edges
+      Index _num_edges;
+      /// the base mesh vertex indices of each macro, 4 per macro
+      std::vector<IT_> _macro_verts;
+      /// the base mesh edge indices of each macro, 4 per macro
+      std::vector<IT_> _macro_edges;
+      /// specifies for each macro edge whether it is oriented opposite to the base mesh edge
+      std::vector<char> _macro_edge_flip;
+      /// the local macro matrices
+      std::vector<MacroMatrixType> _macro_mats;
+
+    public:
+      /// default constructor
+      MacroStructuredMatrix() :
+        _num_slices(0),
+        _num_verts(0),
+        _num_edges(0)
+      {
+      }
+
+      /**
+       * \brief Constructor
+       *
+       * \param[in] num_slices
+       * The number of slices per macro edge, must be > 0.
+       *
+       * \param[in] num_verts, num_edges
+       * The number of base mesh vertices and edges.
+       *
+       * \param[in] macro_verts
+       * The base mesh vertex indices of each macro, 4 per macro.
+       *
+       * \param[in] macro_edges
+       * The base mesh edge indices of each macro, 4 per macro; must be ordered as the local
+       * edges of the quadrilateral, i.e. (0,1), (2,3), (0,2) and (1,3).
+       *
+       * \param[in] macro_edge_flip
+       * Specifies for each macro edge whether the local edge of the macro is oriented opposite
+       * to the base mesh edge.
+       */
+      explicit MacroStructuredMatrix(Index num_slices, Index num_verts, Index num_edges,
+        std::vector<IT_>&& macro_verts, std::vector<IT_>&& macro_edges, std::vector<char>&& macro_edge_flip) :
+        _num_slices(num_slices),
+        _num_verts(num_verts),
+        _num_edges(num_edges),
+        _macro_verts(std::forward<std::vector<IT_>>(macro_verts)),
+        _macro_edges(std::forward<std::vector<IT_>>(macro_edges)),
+        _macro_edge_flip(std::forward<std::vector<char>>(macro_edge_flip)),
+        _macro_mats(_macro_verts.size() / 4u)
+      {
+        XASSERT(num_slices > Index(0));
+        XASSERT(_macro_verts.size() % 4u == 0u);
+        XASSERT(_macro_edges.size() == _macro_verts.size());
+        XASSERT(_macro_edge_flip.size() == _macro_verts.size());
+      }
+
+      /// move constructor
+      MacroStructuredMatrix(MacroStructuredMatrix&&) = default;
+      /// move-assignment operator
+      MacroStructuredMatrix& operator=(MacroStructuredMatrix&&) = default;
+
+      /// virtual destructor
+      virtual ~MacroStructuredMatrix()
+      {
+      }
+
+      /// \returns The number of slices per macro edge
+      Index get_num_slices() const
+      {
+        return _num_slices;
+      }
+
+      /// \returns The number of macros
+      Index get_num_macros() const
+      {
+        return Index(_macro_mats.size());
+      }
+
+      /// \returns The number of local DOFs per macro
+      Index get_num_macro_dofs() const
+      {
+        return (_num_slices + 1u) * (_num_slices + 1u);
+      }
+
+      /// \returns The index of the first DOF of the macro interior DOFs
+      Index get_interior_offset(Index macro) const
+      {
+        const Index n = _num_slices;
+        return _num_verts + _num_edges * (n - 1u) + macro * (n - 1u) * (n - 1u);
+      }
+
+      /// \returns A reference to the local matrix of a macro
+      MacroMatrixType& get_macro_matrix(Index macro)
+      {
+        return _macro_mats.at(macro);
+      }
+
+      /// \returns A const reference to the local matrix of a macro
+      const MacroMatrixType& get_macro_matrix(Index macro) const
+      {
+        return _macro_mats.at(macro);
+      }
+
+      /// \returns The number of rows
+      Index rows() const
+      {
+        return get_interior_offset(get_num_macros());
+      }
+
+      /// \returns The number of columns
+      Index columns() const
+      {
+        return rows();
+      }
+
+      /// \returns The total number of non-zero elements stored in all macro matrices
+      Index used_elements() const
+      {
+        Index nze(0);
+        for(const auto& m : _macro_mats)
+          nze += m.used_elements();
+        return nze;
+      }
+
+      /// \returns The total number of bytes allocated by this matrix
+      std::size_t bytes() const
+      {
+        std::size_t b = (_macro_verts.size() + _macro_edges.size()) * sizeof(IT_) + _macro_edge_flip.size();
+        for(const auto& m : _macro_mats)
+          b += m.bytes();
+        return b;
+      }
+
+      /// \returns A new L-vector for this matrix
+      VectorTypeL create_vector_l() const
+      {
+        return VectorTypeL(rows());
+      }
+
+      /// \returns A new R-vector for this matrix
+      VectorTypeR create_vector_r() const
+      {
+        return VectorTypeR(columns());
+      }
+
+      /**
+       * \brief Computes the global DOF indices of the local boundary DOFs of a macro
+       *
+       * This function is a helper function that is used by the assemblers and the gather/scatter
+       * operations and it computes the global DOF index for each local DOF on the boundary of the
+       * macro patch.
+       *
+       * \param[out] idx
+       * Receives the 4*n global DOF indices of the local boundary DOFs in the order
+       * bottom row (j=0), top row (j=n), left column (i=0, 0<j<n) and right column (i=n, 0<j<n).
+       *
+       * \param[out] loc
+       * Receives the corresponding local DOF indices.
+       *
+       * \param[in] macro
+       * The index of the macro.
+       */
+      void get_boundary_dofs(std::vector<Index>& idx, std::vector<Index>& loc, Index macro) const
+      {
+        const Index n = _num_slices;
+        const Index s = n + 1u;
+        const IT_* mv = &_macro_verts[4u*macro];
+        const IT_* me = &_macro_edges[4u*macro];
+        const char* mf = &_macro_edge_flip[4u*macro];
+
+        idx.clear();
+        loc.clear();
+
+        // returns the global DOF index of the k-th inner point along local macro edge e
+        auto edge_dof = [&](int e, Index k) -> Index
+        {
+          return _num_verts + Index(me[e]) * (n - 1u) + (mf[e] ? n - 1u - k : k - 1u);
+        };
+
+        // bottom row: vertex 0, edge 0, vertex 1
+        idx.push_back(Index(mv[0]));
+        loc.push_back(0u);
+        for(Index k(1); k < n; ++k)
+        {
+          idx.push_back(edge_dof(0, k));
+          loc.push_back(k);
+        }
+        idx.push_back(Index(mv[1]));
+        loc.push_back(n);
+
+        // top row: vertex 2, edge 1, vertex 3
+        idx.push_back(Index(mv[2]));
+        loc.push_back(n*s);
+        for(Index k(1); k < n; ++k)
+        {
+          idx.push_back(edge_dof(1, k));
+          loc.push_back(n*s + k);
+        }
+        idx.push_back(Index(mv[3]));
+        loc.push_back(n*s + n);
+
+        // left and right columns: edges 2 and 3
+        for(Index k(1); k < n; ++k)
+        {
+          idx.push_back(edge_dof(2, k));
+          loc.push_back(k*s);
+        }
+        for(Index k(1); k < n; ++k)
+        {
+          idx.push_back(edge_dof(3, k));
+          loc.push_back(k*s + n);
+        }
+      }
+
+      /**
+       * \brief Computes the global DOF indices of all local DOFs of a macro
+       *
+       * \param[out] dofs
+       * Receives the (n+1)^2 global DOF indices of the macro in lexicographic local ordering.
+       *
+       * \param[in] macro
+       * The index of the macro.
+       */
+      void get_macro_dofs(std::vector<Index>& dofs, Index macro) const
+      {
+        const Index n = _num_slices;
+        const Index s = n + 1u;
+        std::vector<Index> idx, loc;
+        get_boundary_dofs(idx, loc, macro);
+        dofs.resize(s*s);
+        for(std::size_t k(0); k < idx.size(); ++k)
+          dofs[loc[k]] = idx[k];
+        const Index off = get_interior_offset(macro);
+        for(Index j(1); j < n; ++j)
+          for(Index i(1); i < n; ++i)
+            dofs[j*s + i] = off + (j-1u)*(n-1u) + i-1u;
+      }
+
+      /**
+       * \brief Gathers the local DOF values of a macro from a global vector
+       *
+       * \param[out] vec_loc
+       * The local vector of size (n+1)^2 that receives the macro DOF values.
+       *
+       * \param[in] vec
+       * The global vector to gather from.
+       *
+       * \param[in] macro
+       * The index of the macro.
+       */
+      void gather_macro(VectorTypeR& vec_loc, const VectorTypeR& vec, Index macro) const
+      {
+        std::vector<Index> idx, loc;
+        get_boundary_dofs(idx, loc, macro);
+        _gather(vec_loc.elements(), vec.elements(), idx, loc, macro);
+      }
+
+      /**
+       * \brief Scatter-adds local DOF values of a macro onto a global vector
+       *
+       * \param[in,out] vec
+       * The global vector to scatter-add to.
+       *
+       * \param[in] vec_loc
+       * The local vector of size (n+1)^2 that contains the macro DOF values.
+       *
+       * \param[in] macro
+       * The index of the macro.
+       *
+       * \param[in] alpha
+       * The scaling factor for the local values.
+       */
+      void scatter_macro(VectorTypeL& vec, const VectorTypeL& vec_loc, Index macro, DT_ alpha = DT_(1)) const
+      {
+        std::vector<Index> idx, loc;
+        get_boundary_dofs(idx, loc, macro);
+        _scatter(vec.elements(), vec_loc.elements(), idx, loc, macro, alpha);
+      }
+
+      /**
+       * \brief Calculate \f$ r \leftarrow this\cdot x \f$
+       *
+       * \param[out] r The vector that receives the result.
+       * \param[in] x The vector to be multiplied by this matrix.
+       */
+      void apply(VectorTypeL& r, const VectorTypeR& x) const
+      {
+        XASSERTM(r.size() == this->rows(), "Vector size of r does not match!");
+        XASSERTM(x.size() == this->columns(), "Vector size of x does not match!");
+        XASSERTM(r.elements() != x.elements(), "Vector x and r must not share the same memory!");
+
+        r.format();
+        _apply_add(r, x, DT_(1));
+      }
+
+      /**
+       * \brief Calculate \f$ r \leftarrow y + \alpha~ this\cdot x \f$
+       *
+       * \param[out] r The vector that receives the result.
+       * \param[in] x The vector to be multiplied by this matrix.
+       * \param[in] y The summand vector.
+       * \param[in] alpha A scalar to scale the product with.
+       */
+      void apply(VectorTypeL& r, const VectorTypeR& x, const VectorTypeL& y, const DT_ alpha = DT_(1)) const
+      {
+        XASSERTM(r.size() == this->rows(), "Vector size of r does not match!");
+        XASSERTM(x.size() == this->columns(), "Vector size of x does not match!");
+        XASSERTM(y.size() == this->rows(), "Vector size of y does not match!");
+        XASSERTM(r.elements() != x.elements(), "Vector x and r must not share the same memory!");
+
+        if(r.elements() != y.elements())
+          r.copy(y);
+        _apply_add(r, x, alpha);
+      }
+
+      /**
+       * \brief Extracts the main diagonal of the matrix
+       *
+       * \param[out] diag
+       * The vector that receives the main diagonal.
+       */
+      void extract_diag(VectorTypeL& diag) const
+      {
+        XASSERTM(diag.size() == rows(), "diag size does not match matrix row count!");
+        diag.format();
+        VectorTypeL loc_diag(get_num_macro_dofs());
+        for(Index m(0); m < get_num_macros(); ++m)
+        {
+          const MacroMatrixType& mat = _macro_mats.at(m);
+          const Index nrows = mat.rows();
+          loc_diag.format();
+          for(Index k(0); k < mat.num_of_offsets(); ++k)
+          {
+            if(Index(mat.offsets()[k]) + 1u == nrows)
+            {
+              MemoryPool::copy(loc_diag.elements(), mat.val() + k * nrows, nrows);
+              break;
+            }
+          }
+          scatter_macro(diag, loc_diag, m);
+        }
+      }
+
+      /// \returns The main diagonal of the matrix
+      VectorTypeL extract_diag() const
+      {
+        VectorTypeL diag = create_vector_l();
+        extract_diag(diag);
+        return diag;
+      }
+
+    protected:
+      /// gathers the local DOFs of a macro
+      void _gather(DT_* loc_x, const DT_* x, const std::vector<Index>& idx, const std::vector<Index>& loc, Index macro) const
+      {
+        const Index n = _num_slices;
+        const Index s = n + 1u;
+
+        // boundary DOFs are gathered via index lists
+        for(std::size_t k(0); k < idx.size(); ++k)
+          loc_x[loc[k]] = x[idx[k]];
+
+        // interior DOFs are gathered row-wise as contiguous ranges
+        const DT_* xi = &x[get_interior_offset(macro)];
+        for(Index j(1); j < n; ++j)
+        {
+          DT_* lx = &loc_x[j*s + 1u];
+          const DT_* gx = &xi[(j-1u)*(n-1u)];
+          for(Index i(0); i + 1u < n; ++i)
+            lx[i] = gx[i];
+        }
+      }
+
+      /// scatter-adds the local DOFs of a macro
+      void _scatter(DT_* y, const DT_* loc_y, const std::vector<Index>& idx, const std::vector<Index>& loc, Index macro, DT_ alpha) const
+      {
+        const Index n = _num_slices;
+        const Index s = n + 1u;
+
+        // boundary DOFs are scattered via index lists
+        for(std::size_t k(0); k < idx.size(); ++k)
+          y[idx[k]] += alpha * loc_y[loc[k]];
+
+        // interior DOFs are scattered row-wise as contiguous ranges
+        DT_* yi = &y[get_interior_offset(macro)];
+        for(Index j(1); j < n; ++j)
+        {
+          const DT_* ly = &loc_y[j*s + 1u];
+          DT_* gy = &yi[(j-1u)*(n-1u)];
+          for(Index i(0); i + 1u < n; ++i)
+            gy[i] += alpha * ly[i];
+        }
+      }
+
+      /// computes r += alpha * A * x
+      void _apply_add(VectorTypeL& r, const VectorTypeR& x, const DT_ alpha) const
+      {
+        // local scratch arrays for the macro DOFs
+        std::vector<DT_> loc_x(get_num_macro_dofs(), DT_(0)), loc_y(get_num_macro_dofs(), DT_(0));
+        std::vector<Index> idx, loc;
+
+        DT_* vr = r.elements();
+        const DT_* vx = x.elements();
+        for(Index m(0); m < get_num_macros(); ++m)
+        {
+          const MacroMatrixType& mat = _macro_mats.at(m);
+          get_boundary_dofs(idx, loc, m);
+          _gather(loc_x.data(), vx, idx, loc, m);
+          Arch::Apply::banded(loc_y.data(), DT_(1), loc_x.data(), DT_(0), loc_y.data(),
+            mat.val(), mat.offsets(), mat.num_of_offsets(), mat.rows(), mat.columns());
+          _scatter(vr, loc_y.data(), idx, loc, m, alpha);
+        }
+      }
+    }; // class MacroStructuredMatrix<...>
+  } // namespace LAFEM
+} // namespace FEAT
+
+#endif // KERNEL_LAFEM_MACRO_STRUCTURED_MATRIX_HPP
@@ -8,6 +8,12 @@
 #define KERNEL_LAFEM_META_ELEMENT_HPP 1
 
 #include <kernel/base_header.hpp>
+#include <kernel/lafem/base.hpp>
+#include <kernel/lafem/forward.hpp>
+#include <kernel/util/memory_pool.hpp>
+
+#include <type_traits>
+#include <utility>
 
 namespace FEAT
 {
@@ -107,6 +113,250 @@ namespace FEAT
       }
     };
     /// \endcond
+
+    /**
+     * \brief Contiguous meta-vector helper class template
+     *
+     * This class template is a helper which is used by the PowerVector and TupleVector
+     * class templates to check whether all of their sub-vectors are stored consecutively
+     * in one contiguous array and to move the sub-vectors into such an array.
+     *
+     * The generic implementation is used for all vector classes which cannot be part
+     * of a contiguous meta-vector, e.g. SparseVector.
+     */
+    template<typename Vector_>
+    struct MetaContiguous
+    {
+      /**
+       * \brief Checks whether the vector is stored in an array at a given position
+       *
+       * \param[in] vector
+       * The vector to be checked.
+       *
+       * \param[in,out] next
+       * On entry, the address where the entries of the vector are expected to start, or \c nullptr,
+       * if no entries have been found so far. On exit, the address behind the last entry.
+       *
+       * \returns \c true, if the vector is stored at \p next; empty vectors are always contiguous.
+       */
+      template<typename DT_>
+      static bool follows(const Vector_&, DT_*&)
+      {
+        return false;
+      }
+
+      /// moves the vector into the array \p data inside the memory chunk \p chunk and advances \p data by the pod size
+      template<typename DT_>
+      static void relocate(Vector_&, DT_*, DT_*&)
+      {
+        static_assert(sizeof(DT_) == 0u, "vector class cannot be part of a contiguous meta-vector");
+      }
+
+      /// creates a vector with the layout of \p layout, which uses the array \p data inside \p chunk, and advances \p data
+      template<typename DT_>
+      static void create_view(Vector_&, const Vector_&, DT_*, DT_*&)
+      {
+        static_assert(sizeof(DT_) == 0u, "vector class cannot be part of a contiguous meta-vector");
+      }
+    };
+
+    /// \cond internal
+    template<typename DT_, typename IT_>
+    struct MetaContiguous<DenseVector<DT_, IT_>>
+    {
+      static bool follows(const DenseVector<DT_, IT_>& vector, DT_*& next)
+      {
+        const Index n = vector.size();
+        if(n == Index(0))
+          return true;
+        DT_* data = const_cast<DT_*>(vector.elements());
+        if((next != nullptr) && (data != next))
+          return false;
+        next = data + n;
+        return true;
+      }
+
+      static void relocate(DenseVector<DT_, IT_>& vector, DT_* chunk, DT_*& data)
+      {
+        const Index n = vector.size();
+        if(n == Index(0))
+          return;
+
+        // the new vector shares the memory chunk that data points into
+        DenseVector<DT_, IT_> tmp(n, MemoryPool::create_view(chunk, data));
+        tmp.copy(vector);
+        vector = std::move(tmp);
+        data += n;
+      }
+
+      static void create_view(DenseVector<DT_, IT_>& vector, const DenseVector<DT_, IT_>& layout, DT_* chunk, DT_*& data)
+      {
+        const Index n = layout.size();
+        vector = (n > Index(0) ? DenseVector<DT_, IT_>(n, MemoryPool::create_view(chunk, data)) : DenseVector<DT_, IT_>());
+        data += n;
+      }
+    };
+
+    template<typename DT_, typename IT_, int BlockSize_>
+    struct MetaContiguous<DenseVectorBlocked<DT_, IT_, BlockSize_>>
+    {
+      static bool follows(const DenseVectorBlocked<DT_, IT_, BlockSize_>& vector, DT_*& next)
+      {
+        const Index n = vector.template size<Perspective::pod>();
+        if(n == Index(0))
+          return true;
+        DT_* data = const_cast<DT_*>(vector.template elements<Perspective::pod>());
+        if((next != nullptr) && (data != next))
+          return false;
+        next = data + n;
+        return true;
+      }
+
+      static void relocate(DenseVectorBlocked<DT_, IT_, BlockSize_>& vector, DT_* chunk, DT_*& data)
+      {
+        const Index n = vector.size();
+        if(n == Index(0))
+          return;
+
+        DenseVectorBlocked<DT_, IT_, BlockSize_> tmp(n, MemoryPool::create_view(chunk, data));
+        tmp.copy(vector);
+        vector = std::move(tmp);
+        data += n * Index(BlockSize_);
+      }
+
+      static void create_view(DenseVectorBlocked<DT_, IT_, BlockSize_>& vector,
+        const DenseVectorBlocked<DT_, IT_, BlockSize_>& layout, DT_* chunk, DT_*& data)
+      {
+        const Index n = layout.size();
+        vector = (n > Index(0) ? DenseVectorBlocked<DT_, IT_, BlockSize_>(n, MemoryPool::create_view(chunk, data)) : DenseVectorBlocked<DT_, IT_, BlockSize_>());
+        data += n * Index(BlockSize_);
+      }
+    };
+
+    template<typename SubType_, int count_>
+    struct MetaContiguous<PowerVector<SubType_, count_>>
+    {
+      typedef typename SubType_::DataType DataType;
+
+      static bool follows(const PowerVector<SubType_, count_>& vector, DataType*& next)
+      {
+        return vector.contiguous_follows(next);
+      }
+
+      static void relocate(PowerVector<SubType_, count_>& vector, DataType* chunk, DataType*& data)
+      {
+        vector.relocate_to(chunk, data);
+      }
+
+      static void create_view(PowerVector<SubType_, count_>& vector, const PowerVector<SubType_, count_>& layout, DataType* chunk, DataType*& data)
+      {
+        vector.create_views(layout, chunk, data);
+      }
+    };
+
+    template<typename First_, typename... Rest_>
+    struct MetaContiguous<TupleVector<First_, Rest_...>>
+    {
+      typedef typename First_::DataType DataType;
+
+      static bool follows(const TupleVector<First_, Rest_...>& vector, DataType*& next)
+      {
+        return vector.contiguous_follows(next);
+      }
+
+      static void relocate(TupleVector<First_, Rest_...>& vector, DataType* chunk, DataType*& data)
+      {
+        vector.relocate_to(chunk, data);
+      }
+
+      static void create_view(TupleVector<First_, Rest_...>& vector, const TupleVector<First_, Rest_...>& layout, DataType* chunk, DataType*& data)
+      {
+        vector.create_views(layout, chunk, data);
+      }
+    };
+    /// \endcond
+
+    /**
+     * \brief Meta-matrix layout sharing helper class template
+     *
+     * This class template is a helper which is used by the Power meta-matrix class templates to restore
+     * the sharing of index arrays between their sub-matrices after a conversion: each converted block
+     * allocates its own index arrays, even if the corresponding blocks of the source matrix shared them.
+     * The generic implementation is used for all sub-matrix classes which do not offer shared index
+     * arrays, e.g. other meta-matrices, and does nothing.
+     */
+    template<typename Matrix_, typename = void>
+    struct MetaLayoutShare
+    {
+      /// lets \p block share the index arrays of \p first, if \p src_block shares the ones of \p src_first
+      template<typename Matrix2_>
+      static void share(Matrix_&, const Matrix_&, const Matrix2_&, const Matrix2_&)
+      {
+      }
+    };
+
+    /// \cond internal
+    template<typename Matrix_>
+    struct MetaLayoutShare<Matrix_, decltype(void(std::declval<const Matrix_&>().shares_indices(std::declval<const Matrix_&>())))>
+    {
+      template<typename Matrix2_>
+      static void share(Matrix_& block, const Matrix_& first, const Matrix2_& src_block, const Matrix2_& src_first)
+      {
+        if(src_block.shares_indices(src_first))
+          block.share_indices(first);
+      }
+    };
+    /// \endcond
+
+    /**
+     * \brief Block-row apply helper class template
+     *
+     * This class template is a helper which is used by the SaddlePointMatrix and TupleMatrix
+     * class templates to apply a block row <em>[A B]</em> onto a pair of vectors.
+     * The generic implementation applies both blocks one after another, whereas the
+     * specialization for two SparseMatrixBCSR blocks of the same block height uses the
+     * single-pass SparseMatrixBCSR::apply_fused() function.
+     */
+    template<typename MatrixA_, typename MatrixB_>
+    struct BlockRowApply
+    {
+      /// computes r <- A*x + B*z
+      template<typename VectorR_, typename VectorX_, typename VectorZ_>
+      static void apply(VectorR_& r, const MatrixA_& a, const VectorX_& x, const MatrixB_& b, const VectorZ_& z)
+      {
+        a.apply(r, x);
+        b.apply(r, z, r, typename MatrixA_::DataType(1));
+      }
+
+      /// computes r <- y + alpha*(A*x + B*z)
+      template<typename VectorR_, typename VectorX_, typename VectorZ_, typename DT_>
+      static void apply(VectorR_& r, const MatrixA_& a, const VectorX_& x, const MatrixB_& b, const VectorZ_& z, const VectorR_& y, DT_ alpha)
+      {
+        a.apply(r, x, y, alpha);
+        b.apply(r, z, r, alpha);
+      }
+    };
+
+    /// \cond internal
+    template<typename DT_, typename IT_, int BlockHeight_, int BlockWidthA_, int BlockWidthB_>
+    struct BlockRowApply<SparseMatrixBCSR<DT_, IT_, BlockHeight_, BlockWidthA_>, SparseMatrixBCSR<DT_, IT_, BlockHeight_, BlockWidthB_>>
+    {
+      typedef SparseMatrixBCSR<DT_, IT_, BlockHeight_, BlockWidthA_> MatrixA;
+      typedef SparseMatrixBCSR<DT_, IT_, BlockHeight_, BlockWidthB_> MatrixB;
+
+      static void apply(typename MatrixA::VectorTypeL& r, const MatrixA& a, const typename MatrixA::VectorTypeR& x,
+        const MatrixB& b, const typename MatrixB::VectorTypeR& z)
+      {
+        a.apply_fused(r, x, b, z);
+      }
+
+      static void apply(typename MatrixA::VectorTypeL& r, const MatrixA& a, const typename MatrixA::VectorTypeR& x,
+        const MatrixB& b, const typename MatrixB::VectorTypeR& z, const typename MatrixA::VectorTypeL& y, DT_ alpha)
+      {
+        a.apply_fused(r, x, b, z, y, alpha);
+      }
+    };
+    /// \endcond
   } // namespace LAFEM
 } // namespace FEAT
 
@@ -0,0 +1,149 @@
+// FEAT3: Finite Element Analysis Toolbox, Version 3
+// Copyright (C) 2010 - 2023 by Stefan Turek & the FEAT group
+// FEAT3 is released under the GNU General Public License version 3,
+// see the file 'copyright.txt' in the top level directory for details.
+
+#include <test_system/test_system.hpp>
+#include <kernel/lafem/meta_vector_test_base.hpp>
+
+using namespace FEAT;
+using namespace FEAT::LAFEM;
+using namespace FEAT::TestSystem;
+
+/**
+ * \brief Meta-Vector contiguous storage test class
+ *
+ * \test The contiguous storage of the PowerVector and TupleVector class templates.
+ */
+template<
+  typename DataType_,
+  typename IndexType_>
+class MetaVectorContiguousTest
+  : public MetaVectorTestBase<DataType_, IndexType_>
+{
+public:
+  typedef DataType_ DataType;
+  typedef MetaVectorTestBase<DataType_, IndexType_> BaseClass;
+  typedef typename BaseClass::MetaVector MetaVector;
+
+   MetaVectorContiguousTest(PreferredBackend backend) :
+    BaseClass("MetaVectorContiguousTest", Type::Traits<DataType>::name(), Type::Traits<IndexType_>::name(), backend)
+  {
+  }
+
+  virtual ~MetaVectorContiguousTest()
+  {
+  }
+
+  using BaseClass::fx00;
+  using BaseClass::fx01;
+  using BaseClass::fx1;
+  using BaseClass::fy00;
+  using BaseClass::fy01;
+  using BaseClass::fy1;
+
+  void check_values(const MetaVector& z, DataType a, DataType b, Index n00, Index n01, Index n1, DataType tol) const
+  {
+    for(Index i(0); i < n00; ++i)
+      TEST_CHECK_EQUAL_WITHIN_EPS(z.template at<0>().template at<0>()(i), a*fx00(i) + b*fy00(i), tol);
+    for(Index i(0); i < n01; ++i)
+      TEST_CHECK_EQUAL_WITHIN_EPS(z.template at<0>().template at<1>()(i), a*fx01(i) + b*fy01(i), tol);
+    for(Index i(0); i < n1; ++i)
+      TEST_CHECK_EQUAL_WITHIN_EPS(z.template at<1>()(i), a*fx1(i) + b*fy1(i), tol);
+  }
+
+  virtual void run() const override
+  {
+    const DataType tol = Math::pow(Math::eps<DataType>(), DataType(0.6));
+
+    const Index n00 = 5;
+    const Index n01 = 10;
+    const Index n1 = 7;
+
+    MetaVector x(this->gen_vector_x(n00, n01, n1));
+    MetaVector y(this->gen_vector_y(n00, n01, n1));
+    MetaVector z(this->gen_vector_null(n00, n01, n1));
+
+    // separately allocated vectors are not contiguous
+    TEST_CHECK(!x.is_contiguous());
+
+    // compute reference results with separate sub-vectors
+    const DataType x_dot_y = x.dot(y);
+    const DataType x_norm2 = x.norm2();
+
+    // move the vectors into contiguous arrays; the contents must be preserved
+    x.make_contiguous();
+    y.make_contiguous();
+    z.make_contiguous();
+    TEST_CHECK(x.is_contiguous());
+    TEST_CHECK(x.template at<0>().is_contiguous());
+    TEST_CHECK_EQUAL(x.contiguous_elements() + n00 + n01, x.template at<1>().elements());
+    check_values(x, DataType(1), DataType(0), n00, n01, n1, tol);
+    check_values(y, DataType(0), DataType(1), n00, n01, n1, tol);
+
+    // single-pass BLAS-1 operations
+    TEST_CHECK_EQUAL_WITHIN_EPS(x.dot(y), x_dot_y, tol);
+    TEST_CHECK_EQUAL_WITHIN_EPS(x.norm2(), x_norm2, tol);
+    z.axpy(x, y, DataType(0.7));
+    check_values(z, DataType(0.7), DataType(1), n00, n01, n1, tol);
+    z.scale(x, DataType(2));
+    check_values(z, DataType(2), DataType(0), n00, n01, n1, tol);
+    z.copy(y);
+    check_values(z, DataType(0), DataType(1), n00, n01, n1, tol);
+
+    // deep and weak clones are contiguous, shallow clones share the array
+    MetaVector w(x.clone(CloneMode::Deep));
+    TEST_CHECK(w.is_contiguous());
+    TEST_CHECK(w.contiguous_elements() != x.contiguous_elements());
+    check_values(w, DataType(1), DataType(0), n00, n01, n1, tol);
+    MetaVector s(x.clone(CloneMode::Shallow));
+    TEST_CHECK_EQUAL(s.contiguous_elements(), x.contiguous_elements());
+
+    // the array must outlive the meta-vector which created it
+    x.clear();
+    check_values(s, DataType(1), DataType(0), n00, n01, n1, tol);
+
+    // re-assigning a sub-vector breaks the contiguous storage
+    z.template at<1>() = typename BaseClass::ScalarVector(n1, DataType(0));
+    TEST_CHECK(!z.is_contiguous());
+    TEST_CHECK(z.template at<0>().is_contiguous());
+    z.axpy(s, y, DataType(0.7));
+    check_values(z, DataType(0.7), DataType(1), n00, n01, n1, tol);
+
+    // empty sub-vectors do not break the contiguous storage
+    MetaVector e(this->gen_vector_x(n00, Index(0), n1));
+    e.make_contiguous();
+    TEST_CHECK(e.is_contiguous());
+    DataType* e_data = e.contiguous_elements();
+    TEST_CHECK(e_data != nullptr);
+    e.make_contiguous();
+    TEST_CHECK_EQUAL(e.contiguous_elements(), e_data);
+    check_values(e, DataType(1), DataType(0), n00, Index(0), n1, tol);
+
+    // clones of vectors with empty sub-vectors are contiguous as well
+    MetaVector f(e.clone(CloneMode::Layout));
+    TEST_CHECK(f.is_contiguous());
+    TEST_CHECK_EQUAL(f.template at<0>().template at<0>().elements() + n00, f.template at<1>().elements());
+    f.copy(e);
+    check_values(f, DataType(1), DataType(0), n00, Index(0), n1, tol);
+  }
+};
+
+MetaVectorContiguousTest <float, std::uint32_t> meta_vector_contiguous_test_generic_float_uint32(PreferredBackend::generic);
+MetaVectorContiguousTest <double, std::uint32_t> meta_vector_contiguous_test_generic_double_uint32(PreferredBackend::generic);
+MetaVectorContiguousTest <float, std::uint64_t> meta_vector_contiguous_test_generic_float_uint64(PreferredBackend::generic);
+MetaVectorContiguousTest <double, std::uint64_t> meta_vector_contiguous_test_generic_double_uint64(PreferredBackend::generic);
+#ifdef FEAT_HAVE_MKL
+MetaVectorContiguousTest <float, std::uint64_t> mkl_meta_vector_contiguous_test_float_uint64(PreferredBackend::mkl);
+MetaVectorContiguousTest <double, std::uint64_t> mkl_meta_vector_contiguous_test_double_uint64(PreferredBackend::mkl);
+#endif
+#ifdef FEAT_HAVE_QUADMATH
+MetaVectorContiguousTest <__float128, std::uint32_t> meta_vector_contiguous_test_generic_float128_uint32(PreferredBackend::generic);
+MetaVectorContiguousTest <__float128, std::uint64_t> meta_vector_contiguous_test_generic_float128_uint64(PreferredBackend::generic);
+#endif
+#ifdef FEAT_HAVE_CUDA
+MetaVectorContiguousTest <float, std::uint32_t> meta_vector_contiguous_test_cuda_float_uint32(PreferredBackend::cuda);
+MetaVectorContiguousTest <double, std::uint32_t> meta_vector_contiguous_test_cuda_double_uint32(PreferredBackend::cuda);
+MetaVectorContiguousTest <float, std::uint64_t> meta_vector_contiguous_test_cuda_float_uint64(PreferredBackend::cuda);
+MetaVectorContiguousTest <double, std::uint64_t> meta_vector_contiguous_test_cuda_double_uint64(PreferredBackend::cuda);
+#endif
@@ -588,6 +588,10 @@ namespace FEAT
       {
         this->first().convert(other.first());
         this->rest().convert(other.rest());
+
+        // restore the sharing of index arrays between the blocks
+        for(int i(1); i < blocks_; ++i)
+          MetaLayoutShare<SubType_>::share(this->get(i,0), this->get(0,0), other.get(i,0), other.get(0,0));
       }
 
       template <typename SubType2_>
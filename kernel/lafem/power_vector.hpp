@@ -10,6 +10,7 @@
 // includes, FEAT
 #include <kernel/lafem/meta_element.hpp>
 #include <kernel/lafem/container.hpp>
+#include <kernel/lafem/dense_vector.hpp>
 
 
 // includes, system
@@ -88,6 +89,9 @@ namespace FEAT
       /// number of vector blocks
       static constexpr int num_blocks = count_;
 
+      /// the vector type used for views of the contiguous array
+      typedef DenseVector<DataType, IndexType> ContiguousVectorType;
+
     protected:
       /// the first sub-vector
       SubVectorType _first;
@@ -171,7 +175,9 @@ namespace FEAT
        */
       PowerVector clone(LAFEM::CloneMode mode = LAFEM::CloneMode::Weak) const
       {
-        return PowerVector(_first.clone(mode), _rest.clone(mode));
+        PowerVector result;
+        result.clone(*this, mode);
+        return result;
       }
 
       /**
@@ -183,6 +189,11 @@ namespace FEAT
        */
       void clone(const PowerVector& other, CloneMode clone_mode)
       {
+        if((clone_mode != CloneMode::Shallow) && other.is_contiguous())
+        {
+          _clone_contiguous(other, clone_mode);
+          return;
+        }
         _first.clone(other._first, clone_mode);
         _rest.clone(other._rest, clone_mode);
       }
@@ -195,6 +206,12 @@ namespace FEAT
        */
       void clone(const PowerVector& other)
       {
+        // contiguous vectors consist of dense vectors only, whose default clone mode is deep
+        if(other.is_contiguous())
+        {
+          _clone_contiguous(other, CloneMode::Deep);
+          return;
+        }
         _first.clone(other._first);
         _rest.clone(other._rest);
       }
@@ -279,6 +296,108 @@ namespace FEAT
         return sizeof(std::uint64_t) + ireal_size + _rest.set_checkpoint_data(data, config); //generate and add checkpoint data for the _rest
       }
 
+      /**
+       * \brief Returns the contiguous pod array of this vector.
+       *
+       * \returns
+       * A pointer to the first entry of the array containing the entries of all sub-vectors
+       * or \c nullptr, if the sub-vectors are not stored consecutively in one array or if
+       * this vector is empty.
+       */
+      DataType* contiguous_elements() const
+      {
+        DataType* next(nullptr);
+        if(!contiguous_follows(next) || (next == nullptr))
+          return nullptr;
+        return next - this->template size<Perspective::pod>();
+      }
+
+      /**
+       * \brief Checks whether all sub-vectors are stored consecutively in one contiguous array.
+       *
+       * \note Empty sub-vectors do not own any array and are therefore regarded as contiguous.
+       */
+      bool is_contiguous() const
+      {
+        DataType* next(nullptr);
+        return contiguous_follows(next);
+      }
+
+      /**
+       * \brief Moves all sub-vectors into one contiguous array.
+       *
+       * This function allocates a single array for the entries of all sub-vectors and replaces
+       * each sub-vector by a sub-vector sharing this array while preserving its contents.
+       * As long as all operands are contiguous, the BLAS-1 operations of this vector are then
+       * performed by a single kernel call over the whole array instead of one call per sub-vector.
+       *
+       * \note The contiguous layout is preserved by all non-shallow clone operations, which allocate
+       * the array of the clone at once, but it is lost if a sub-vector is re-assigned or re-allocated
+       * afterwards.
+       *
+       * \note The sub-vectors are still full-fledged vectors, which merely share one array, so all
+       * operations which work per sub-vector, e.g. the gather and scatter operations of the vector
+       * mirrors used by the Global::Gate, are not affected by the contiguous layout.
+       */
+      void make_contiguous()
+      {
+        const Index n = this->template size<Perspective::pod>();
+        if(is_contiguous())
+          return;
+
+        DataType* data = MemoryPool::template allocate_memory<DataType>(n);
+        DataType* ptr = data;
+        relocate_to(data, ptr);
+
+        // the sub-vectors hold their own references to the array
+        MemoryPool::release_memory(data);
+      }
+
+      /// \cond internal
+      bool contiguous_follows(DataType*& next) const
+      {
+        return MetaContiguous<SubVectorType>::follows(_first, next) && MetaContiguous<RestClass>::follows(_rest, next);
+      }
+
+      void relocate_to(DataType* chunk, DataType*& data)
+      {
+        MetaContiguous<SubVectorType>::relocate(_first, chunk, data);
+        MetaContiguous<RestClass>::relocate(_rest, chunk, data);
+      }
+
+      void create_views(const PowerVector& layout, DataType* chunk, DataType*& data)
+      {
+        MetaContiguous<SubVectorType>::create_view(_first, layout._first, chunk, data);
+        MetaContiguous<RestClass>::create_view(_rest, layout._rest, chunk, data);
+      }
+
+      ContiguousVectorType contiguous_view() const
+      {
+        return ContiguousVectorType(this->template size<Perspective::pod>(), contiguous_elements());
+      }
+      /// \endcond
+
+    protected:
+      /// clones a contiguous vector by allocating the array of the clone at once
+      void _clone_contiguous(const PowerVector& other, CloneMode clone_mode)
+      {
+        const Index n = other.template size<Perspective::pod>();
+        DataType* data = (n > Index(0) ? MemoryPool::template allocate_memory<DataType>(n) : nullptr);
+        DataType* ptr = data;
+        create_views(other, data, ptr);
+        if(data == nullptr)
+          return;
+
+        // the sub-vectors hold their own references to the array
+        MemoryPool::release_memory(data);
+
+        // the layout and allocate modes do not copy the entries
+        if((clone_mode == CloneMode::Deep) || (clone_mode == CloneMode::Weak))
+          contiguous_view().copy(other.contiguous_view());
+      }
+
+    public:
+
       /// \cond internal
       SubVectorType& first()
       {
@@ -322,6 +441,11 @@ namespace FEAT
        */
       void format(DataType value = DataType(0))
       {
+        if(is_contiguous())
+        {
+          contiguous_view().format(value);
+          return;
+        }
         first().format(value);
         rest().format(value);
       }
@@ -361,6 +485,14 @@ namespace FEAT
       template<typename SubType2_>
       void copy(const PowerVector<SubType2_, count_>& x, bool full = false)
       {
+        if constexpr(std::is_same<SubType2_, SubType_>::value)
+        {
+          if(!full && is_contiguous() && x.is_contiguous())
+          {
+            contiguous_view().copy(x.contiguous_view());
+            return;
+          }
+        }
         first().copy(x.first(), full);
         rest().copy(x.rest(), full);
       }
@@ -379,6 +511,11 @@ namespace FEAT
        */
       void axpy(const PowerVector& x, const PowerVector& y, DataType alpha = DataType(1))
       {
+        if(is_contiguous() && x.is_contiguous() && y.is_contiguous())
+        {
+          contiguous_view().axpy(x.contiguous_view(), y.contiguous_view(), alpha);
+          return;
+        }
         first().axpy(x.first(), y.first(), alpha);
         rest().axpy(x.rest(), y.rest(), alpha);
       }
@@ -391,6 +528,11 @@ namespace FEAT
        */
       void component_product(const PowerVector & x, const PowerVector & y)
       {
+        if(is_contiguous() && x.is_contiguous() && y.is_contiguous())
+        {
+          contiguous_view().component_product(x.contiguous_view(), y.contiguous_view());
+          return;
+        }
         first().component_product(x.first(), y.first());
         rest().component_product(x.rest(), y.rest());
       }
@@ -406,6 +548,11 @@ namespace FEAT
        */
       void component_invert(const PowerVector& x, DataType alpha = DataType(1))
       {
+        if(is_contiguous() && x.is_contiguous())
+        {
+          contiguous_view().component_invert(x.contiguous_view(), alpha);
+          return;
+        }
         first().component_invert(x.first(), alpha);
         rest().component_invert(x.rest(), alpha);
       }
@@ -421,6 +568,11 @@ namespace FEAT
        */
       void scale(const PowerVector& x, DataType alpha)
       {
+        if(is_contiguous() && x.is_contiguous())
+        {
+          contiguous_view().scale(x.contiguous_view(), alpha);
+          return;
+        }
         first().scale(x.first(), alpha);
         rest().scale(x.rest(), alpha);
       }
@@ -433,6 +585,8 @@ namespace FEAT
        */
       DataType dot(const PowerVector& x) const
       {
+        if(is_contiguous() && x.is_contiguous())
+          return contiguous_view().dot(x.contiguous_view());
         return first().dot(x.first()) + rest().dot(x.rest());
       }
 
@@ -441,6 +595,8 @@ namespace FEAT
        **/
       DataType triple_dot(const PowerVector& x, const PowerVector& y) const
       {
+        if(is_contiguous() && x.is_contiguous() && y.is_contiguous())
+          return contiguous_view().triple_dot(x.contiguous_view(), y.contiguous_view());
         return first().triple_dot(x.first(), y.first())
           + rest().triple_dot(x.rest(), y.rest());
       }
@@ -450,6 +606,8 @@ namespace FEAT
        */
       DataType norm2sqr() const
       {
+        if(is_contiguous())
+          return contiguous_view().norm2sqr();
         return first().norm2sqr() + rest().norm2sqr();
       }
 
@@ -837,6 +995,47 @@ namespace FEAT
         return _first;
       }
 
+      DataType* contiguous_elements() const
+      {
+        DataType* next(nullptr);
+        if(!contiguous_follows(next) || (next == nullptr))
+          return nullptr;
+        return next - this->template size<Perspective::pod>();
+      }
+
+      bool is_contiguous() const
+      {
+        DataType* next(nullptr);
+        return contiguous_follows(next);
+      }
+
+      void make_contiguous()
+      {
+        const Index n = this->template size<Perspective::pod>();
+        if(is_contiguous())
+          return;
+
+        DataType* data = MemoryPool::template allocate_memory<DataType>(n);
+        DataType* ptr = data;
+        relocate_to(data, ptr);
+        MemoryPool::release_memory(data);
+      }
+
+      bool contiguous_follows(DataType*& next) const
+      {
+        return MetaContiguous<SubVectorType>::follows(_first, next);
+      }
+
+      void relocate_to(DataType* chunk, DataType*& data)
+      {
+        MetaContiguous<SubVectorType>::relocate(_first, chunk, data);
+      }
+
+      void create_views(const PowerVector& layout, DataType* chunk, DataType*& data)
+      {
+        MetaContiguous<SubVectorType>::create_view(_first, layout._first, chunk, data);
+      }
+
       /// \copydoc FEAT::Control::Checkpointable::get_checkpoint_size()
       std::uint64_t get_checkpoint_size(SerialConfig& config)
       {
@@ -445,8 +445,7 @@ namespace FEAT
        */
       void apply(VectorTypeL& r, const VectorTypeR& x) const
       {
-        block_a().apply(r.template at<0>(), x.template at<0>());
-        block_b().apply(r.template at<0>(), x.template at<1>(), r.template at<0>(), DataType(1));
+        BlockRowApply<MatrixTypeA, MatrixTypeB>::apply(r.template at<0>(), block_a(), x.template at<0>(), block_b(), x.template at<1>());
         block_d().apply(r.template at<1>(), x.template at<0>());
       }
 
@@ -485,8 +484,8 @@ namespace FEAT
        */
       void apply(VectorTypeL& r, const VectorTypeR& x, const VectorTypeL& y, DataType alpha = DataType(1)) const
       {
-        block_a().apply(r.template at<0>(), x.template at<0>(), y.template at<0>(), alpha);
-        block_b().apply(r.template at<0>(), x.template at<1>(), r.template at<0>(), alpha);
+        BlockRowApply<MatrixTypeA, MatrixTypeB>::apply(r.template at<0>(), block_a(), x.template at<0>(),
+          block_b(), x.template at<1>(), y.template at<0>(), alpha);
         block_d().apply(r.template at<1>(), x.template at<0>(), y.template at<1>(), alpha);
       }
 
@@ -523,6 +522,30 @@ namespace FEAT
         return VectorTypeR(block_a().create_vector_r(), block_b().create_vector_r());
       }
 
+      /**
+       * \brief Returns a new compatible L-Vector, whose velocity and pressure parts are stored contiguously.
+       *
+       * \see TupleVector::make_contiguous()
+       */
+      VectorTypeL create_vector_l_contiguous() const
+      {
+        VectorTypeL vector(create_vector_l());
+        vector.make_contiguous();
+        return vector;
+      }
+
+      /**
+       * \brief Returns a new compatible R-Vector, whose velocity and pressure parts are stored contiguously.
+       *
+       * \see TupleVector::make_contiguous()
+       */
+      VectorTypeR create_vector_r_contiguous() const
+      {
+        VectorTypeR vector(create_vector_r());
+        vector.make_contiguous();
+        return vector;
+      }
+
       /// Returns the number of NNZ-elements of the selected row
       Index get_length_of_line(const Index row) const
       {
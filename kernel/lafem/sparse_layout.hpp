@@ -57,6 +57,10 @@ namespace FEAT
      * This class acts as an data wrapper for all index arrays, describing a specific sparse matrix layout.
      * It enables FEAT to store layout related data only once per layout per matrix type.
      * In addition, one is able to create a new matrix with a given layout without assembling it a second time.
+     * The index arrays are reference-counted by the MemoryPool, so a layout object keeps its arrays alive
+     * even if the matrix it was created from is destroyed, and copies of a layout share the same arrays.
+     * Since the CSR and BCSR matrix containers use the same index arrays, a layout can also be shared
+     * between these two container types.
      *
      * \todo Enable layout conversion between matrix types
      *
@@ -89,6 +93,16 @@ namespace FEAT
           MemoryPool::increase_memory(i);
       }
 
+      /// copy constructor; the copy references the same index arrays
+      SparseLayout(const SparseLayout & other) :
+        _indices(other._indices),
+        _indices_size(other._indices_size),
+        _scalar_index(other._scalar_index)
+      {
+        for(auto i : this->_indices)
+          MemoryPool::increase_memory(i);
+      }
+
       /// move constructor
       SparseLayout(SparseLayout && other) :
         _indices(std::move(other._indices)),
@@ -104,9 +118,33 @@ namespace FEAT
           MemoryPool::release_memory(i);
       }
 
+      /// copy operator=; the copy references the same index arrays
+      SparseLayout & operator= (const SparseLayout & other)
+      {
+        if(this == &other)
+          return *this;
+
+        for(auto i : other._indices)
+          MemoryPool::increase_memory(i);
+        for(auto i : this->_indices)
+          MemoryPool::release_memory(i);
+
+        _indices = other._indices;
+        _indices_size = other._indices_size;
+        _scalar_index = other._scalar_index;
+
+        return *this;
+      }
+
       /// move operator=
       SparseLayout & operator= (SparseLayout && other)
       {
+        if(this == &other)
+          return *this;
+
+        for(auto i : this->_indices)
+          MemoryPool::release_memory(i);
+
         _indices = std::move(other._indices);
         _indices_size = std::move(other._indices_size);
         _scalar_index = std::move(other._scalar_index);
@@ -114,6 +152,18 @@ namespace FEAT
         return *this;
       }
 
+      /**
+       * \brief Checks whether this layout references the same index arrays as another layout.
+       *
+       * \param[in] other The other layout.
+       *
+       * \returns \c true, if both layouts reference the same non-empty set of index arrays.
+       */
+      bool is_shared_with(const SparseLayout & other) const
+      {
+        return (!_indices.empty()) && (_indices == other._indices);
+      }
+
       /**
        * \brief Returns a list of all Index arrays.
        *
@@ -7,6 +7,7 @@
 #include <test_system/test_system.hpp>
 #include <kernel/lafem/sparse_matrix_bcsr.hpp>
 #include <kernel/lafem/sparse_matrix_csr.hpp>
+#include <kernel/lafem/saddle_point_matrix.hpp>
 #include <kernel/util/binary_stream.hpp>
 #include <kernel/adjacency/cuthill_mckee.hpp>
 
@@ -378,6 +379,131 @@ SparseMatrixBCSRApplyTest <float, std::uint32_t> cuda_sm_bcsr_apply_test_float_u
 SparseMatrixBCSRApplyTest <double, std::uint32_t> cuda_sm_bcsr_apply_test_double_uint32(PreferredBackend::cuda);
 #endif
 
+/**
+ * \brief Test class for the fused block-row apply of the sparse matrix csr blocked class.
+ *
+ * \test The apply_fused method and its use in the SaddlePointMatrix apply method.
+ */
+template<
+  typename DT_,
+  typename IT_>
+class SparseMatrixBCSRApplyFusedTest
+  : public UnitTest
+{
+public:
+  SparseMatrixBCSRApplyFusedTest(PreferredBackend backend)
+    : UnitTest("SparseMatrixBCSRApplyFusedTest", Type::Traits<DT_>::name(), Type::Traits<IT_>::name(), backend)
+  {
+  }
+
+  virtual ~SparseMatrixBCSRApplyFusedTest()
+  {
+  }
+
+  // creates a graph with a non-trivial pattern
+  static Adjacency::Graph create_graph(Index num_rows, Index num_cols)
+  {
+    std::vector<Index> dom_ptr(1u, Index(0)), img_idx;
+    for(Index i(0); i < num_rows; ++i)
+    {
+      for(Index j(0); j < num_cols; ++j)
+      {
+        if((i + 2u*j) % 3u != 1u)
+          img_idx.push_back(j);
+      }
+      dom_ptr.push_back(Index(img_idx.size()));
+    }
+    return Adjacency::Graph(num_cols, dom_ptr, img_idx);
+  }
+
+  template<typename VectorType_>
+  void check_vector(const VectorType_& r, const VectorType_& ref, const DT_ tol) const
+  {
+    const DT_* pr = r.template elements<Perspective::pod>();
+    const DT_* pref = ref.template elements<Perspective::pod>();
+    for (Index i(0) ; i < r.template size<Perspective::pod>() ; ++i)
+      TEST_CHECK_EQUAL_WITHIN_EPS(pr[i], pref[i], tol);
+  }
+
+  virtual void run() const override
+  {
+    const DT_ tol = Math::pow(Math::eps<DT_>(), DT_(0.7));
+    const Index nv(11), np(7);
+
+    Random rng;
+    SparseMatrixBCSR<DT_, IT_, 2, 2> a(create_graph(nv, nv));
+    SparseMatrixBCSR<DT_, IT_, 2, 1> b(create_graph(nv, np));
+    SparseMatrixBCSR<DT_, IT_, 1, 2> d(create_graph(np, nv));
+    a.format(rng, DT_(-1), DT_(1));
+    b.format(rng, DT_(-1), DT_(1));
+    d.format(rng, DT_(-1), DT_(1));
+
+    DenseVectorBlocked<DT_, IT_, 2> xu(nv), yu(nv), ru(nv), refu(nv);
+    DenseVector<DT_, IT_> xp(np), yp(np), rp(np), refp(np);
+    xu.format(rng, DT_(-1), DT_(1));
+    yu.format(rng, DT_(-1), DT_(1));
+    xp.format(rng, DT_(-1), DT_(1));
+    yp.format(rng, DT_(-1), DT_(1));
+
+    // r <- A*x + B*z
+    a.apply(refu, xu);
+    b.apply(refu, xp, refu, DT_(1));
+    a.apply_fused(ru, xu, b, xp);
+    check_vector(ru, refu, tol);
+
+    // r <- y + alpha*(A*x + B*z)
+    const DT_ alpha(-0.7);
+    a.apply(refu, xu, yu, alpha);
+    b.apply(refu, xp, refu, alpha);
+    a.apply_fused(ru, xu, b, xp, yu, alpha);
+    check_vector(ru, refu, tol);
+
+    // &r == &y
+    ru.copy(yu);
+    a.apply_fused(ru, xu, b, xp, ru, alpha);
+    check_vector(ru, refu, tol);
+
+    // saddle-point matrix
+    SaddlePointMatrix<SparseMatrixBCSR<DT_, IT_, 2, 2>, SparseMatrixBCSR<DT_, IT_, 2, 1>, SparseMatrixBCSR<DT_, IT_, 1, 2>>
+      matrix(a.clone(CloneMode::Shallow), b.clone(CloneMode::Shallow), d.clone(CloneMode::Shallow));
+    auto vec_x = matrix.create_vector_r();
+    auto vec_y = matrix.create_vector_l();
+    auto vec_r = matrix.create_vector_l();
+    vec_x.template at<0>().copy(xu);
+    vec_x.template at<1>().copy(xp);
+    vec_y.template at<0>().copy(yu);
+    vec_y.template at<1>().copy(yp);
+
+    matrix.apply(vec_r, vec_x);
+    a.apply(refu, xu);
+    b.apply(refu, xp, refu, DT_(1));
+    d.apply(refp, xu);
+    check_vector(vec_r.template at<0>(), refu, tol);
+    check_vector(vec_r.template at<1>(), refp, tol);
+
+    matrix.apply(vec_r, vec_x, vec_y, alpha);
+    a.apply(refu, xu, yu, alpha);
+    b.apply(refu, xp, refu, alpha);
+    d.apply(refp, xu, yp, alpha);
+    check_vector(vec_r.template at<0>(), refu, tol);
+    check_vector(vec_r.template at<1>(), refp, tol);
+  }
+};
+SparseMatrixBCSRApplyFusedTest <float, std::uint64_t> cpu_sm_bcsr_apply_fused_test_float_uint64(PreferredBackend::generic);
+SparseMatrixBCSRApplyFusedTest <double, std::uint64_t> cpu_sm_bcsr_apply_fused_test_double_uint64(PreferredBackend::generic);
+SparseMatrixBCSRApplyFusedTest <float, std::uint32_t> cpu_sm_bcsr_apply_fused_test_float_uint32(PreferredBackend::generic);
+SparseMatrixBCSRApplyFusedTest <double, std::uint32_t> cpu_sm_bcsr_apply_fused_test_double_uint32(PreferredBackend::generic);
+#ifdef FEAT_HAVE_QUADMATH
+SparseMatrixBCSRApplyFusedTest <__float128, std::uint64_t> cpu_sm_bcsr_apply_fused_test_float128_uint64(PreferredBackend::generic);
+SparseMatrixBCSRApplyFusedTest <__float128, std::uint32_t> cpu_sm_bcsr_apply_fused_test_float128_uint32(PreferredBackend::generic);
+#endif
+#ifdef FEAT_HAVE_CUDA
+SparseMatrixBCSRApplyFusedTest <float, std::uint64_t> cuda_sm_bcsr_apply_fused_test_float_uint64(PreferredBackend::cuda);
+SparseMatrixBCSRApplyFusedTest <double, std::uint64_t> cuda_sm_bcsr_apply_fused_test_double_uint64(PreferredBackend::cuda);
+SparseMatrixBCSRApplyFusedTest <float, std::uint32_t> cuda_sm_bcsr_apply_fused_test_float_uint32(PreferredBackend::cuda);
+SparseMatrixBCSRApplyFusedTest <double, std::uint32_t> cuda_sm_bcsr_apply_fused_test_double_uint32(PreferredBackend::cuda);
+#endif
+
 /**
  * \brief Test class for the sparse matrix csr blocked apply method.
  *
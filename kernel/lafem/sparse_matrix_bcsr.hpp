@@ -1594,6 +1594,186 @@ namespace FEAT
         Statistics::add_time_blas2(ts_stop.elapsed(ts_start));
       }
 
+      /**
+       * \brief Calculate \f$ R \leftarrow this\cdot X \f$ for multiple vectors at once
+       *
+       * The k columns of the dense matrices \p r and \p x are interpreted as k vectors, i.e. the
+       * vectors are stored interleaved, and all k products are computed in a single sweep over this
+       * matrix, so that the matrix is read from memory only once instead of k times.
+       *
+       * \attention r and x must \b not refer to the same object!
+       *
+       * \param[out] r The (rows()*BlockHeight) x k dense matrix that receives the results.
+       * \param[in] x The (columns()*BlockWidth) x k dense matrix whose columns are to be multiplied by this matrix.
+       */
+      void apply_multi(DenseMatrix<DT_, IT_> & r, const DenseMatrix<DT_, IT_> & x) const
+      {
+        XASSERTM(r.rows() == this->template rows<Perspective::pod>(), "Matrix rows of r do not match!");
+        XASSERTM(x.rows() == this->template columns<Perspective::pod>(), "Matrix rows of x do not match!");
+        XASSERTM(r.columns() == x.columns(), "Number of vectors of r and x do not match!");
+
+        TimeStamp ts_start;
+
+        if (this->used_elements() == 0)
+        {
+          r.format();
+          return;
+        }
+
+        XASSERTM(r.elements() != x.elements(), "Matrix x and r must not share the same memory!");
+
+        Statistics::add_flops(this->template used_elements<Perspective::pod>() * 2 * x.columns());
+        Arch::Apply::template bcsr_mrhs<BlockHeight_, BlockWidth_>(r.elements(), DT_(1), x.elements(), DT_(0), r.elements(),
+            this->template val<Perspective::pod>(), this->col_ind(), this->row_ptr(), this->rows(), x.columns());
+
+        TimeStamp ts_stop;
+        Statistics::add_time_blas2(ts_stop.elapsed(ts_start));
+      }
+
+      /**
+       * \brief Calculate \f$ R \leftarrow Y + \alpha~ this\cdot X \f$ for multiple vectors at once
+       *
+       * \attention r and x must \b not refer to the same object!
+       * \note r and y are allowed to refer to the same object.
+       *
+       * \param[out] r The (rows()*BlockHeight) x k dense matrix that receives the results.
+       * \param[in] x The (columns()*BlockWidth) x k dense matrix whose columns are to be multiplied by this matrix.
+       * \param[in] y The (rows()*BlockHeight) x k dense summand matrix.
+       * \param[in] alpha A scalar to scale the products with.
+       */
+      void apply_multi(
+                 DenseMatrix<DT_, IT_> & r,
+                 const DenseMatrix<DT_, IT_> & x,
+                 const DenseMatrix<DT_, IT_> & y,
+                 const DT_ alpha = DT_(1)) const
+      {
+        XASSERTM(r.rows() == this->template rows<Perspective::pod>(), "Matrix rows of r do not match!");
+        XASSERTM(x.rows() == this->template columns<Perspective::pod>(), "Matrix rows of x do not match!");
+        XASSERTM(y.rows() == this->template rows<Perspective::pod>(), "Matrix rows of y do not match!");
+        XASSERTM(r.columns() == x.columns(), "Number of vectors of r and x do not match!");
+        XASSERTM(r.columns() == y.columns(), "Number of vectors of r and y do not match!");
+
+        TimeStamp ts_start;
+
+        if (this->used_elements() == 0 || Math::abs(alpha) < Math::eps<DT_>())
+        {
+          r.copy(y);
+          return;
+        }
+
+        XASSERTM(r.elements() != x.elements(), "Matrix x and r must not share the same memory!");
+
+        Statistics::add_flops((this->template used_elements<Perspective::pod>() + this->template rows<Perspective::pod>()) * 2 * x.columns());
+        Arch::Apply::template bcsr_mrhs<BlockHeight_, BlockWidth_>(r.elements(), alpha, x.elements(), DT_(1), y.elements(),
+            this->template val<Perspective::pod>(), this->col_ind(), this->row_ptr(), this->rows(), x.columns());
+
+        TimeStamp ts_stop;
+        Statistics::add_time_blas2(ts_stop.elapsed(ts_start));
+      }
+
+      /**
+       * \brief Calculate \f$ r \leftarrow this\cdot x + M\cdot z \f$ in a single pass
+       *
+       * This function applies a block row <em>[this M]</em> of a meta-matrix, e.g. the velocity row
+       * <em>[A B]</em> of a SaddlePointMatrix, by processing the corresponding rows of both matrices
+       * at once, so that each entry of \p r is written only once.
+       *
+       * \attention r must \b not refer to the same vector object as x or z!
+       *
+       * \param[out] r The vector that receives the result.
+       * \param[in] x The vector to be multiplied by this matrix.
+       * \param[in] matrix2 The second matrix \e M of the block row.
+       * \param[in] z The vector to be multiplied by \p matrix2.
+       */
+      template<int BlockWidth2_>
+      void apply_fused(
+                 VectorTypeL & r,
+                 const VectorTypeR & x,
+                 const SparseMatrixBCSR<DT_, IT_, BlockHeight_, BlockWidth2_> & matrix2,
+                 const typename SparseMatrixBCSR<DT_, IT_, BlockHeight_, BlockWidth2_>::VectorTypeR & z) const
+      {
+        _apply_fused(r, x, matrix2, z, DT_(0), r, DT_(1));
+      }
+
+      /**
+       * \brief Calculate \f$ r \leftarrow y + \alpha~ (this\cdot x + M\cdot z) \f$ in a single pass
+       *
+       * \attention r must \b not refer to the same vector object as x or z!
+       * \note r and y are allowed to refer to the same vector object.
+       *
+       * \param[out] r The vector that receives the result.
+       * \param[in] x The vector to be multiplied by this matrix.
+       * \param[in] matrix2 The second matrix \e M of the block row.
+       * \param[in] z The vector to be multiplied by \p matrix2.
+       * \param[in] y The summand vector.
+       * \param[in] alpha A scalar to scale the product with.
+       */
+      template<int BlockWidth2_>
+      void apply_fused(
+                 VectorTypeL & r,
+                 const VectorTypeR & x,
+                 const SparseMatrixBCSR<DT_, IT_, BlockHeight_, BlockWidth2_> & matrix2,
+                 const typename SparseMatrixBCSR<DT_, IT_, BlockHeight_, BlockWidth2_>::VectorTypeR & z,
+                 const VectorTypeL & y,
+                 const DT_ alpha = DT_(1)) const
+      {
+        if (Math::abs(alpha) < Math::eps<DT_>())
+        {
+          r.copy(y);
+          return;
+        }
+
+        _apply_fused(r, x, matrix2, z, DT_(1), y, alpha);
+      }
+
+    private:
+      /// common implementation of the apply_fused functions
+      template<int BlockWidth2_>
+      void _apply_fused(
+                 VectorTypeL & r,
+                 const VectorTypeR & x,
+                 const SparseMatrixBCSR<DT_, IT_, BlockHeight_, BlockWidth2_> & matrix2,
+                 const typename SparseMatrixBCSR<DT_, IT_, BlockHeight_, BlockWidth2_>::VectorTypeR & z,
+                 const DT_ beta,
+                 const VectorTypeL & y,
+                 const DT_ alpha) const
+      {
+        XASSERTM(r.template size<Perspective::pod>() == this->rows<Perspective::pod>(), "Vector size of r does not match!");
+        XASSERTM(x.template size<Perspective::pod>() == this->columns<Perspective::pod>(), "Vector size of x does not match!");
+        XASSERTM(y.template size<Perspective::pod>() == this->rows<Perspective::pod>(), "Vector size of y does not match!");
+        XASSERTM(matrix2.rows() == this->rows(), "Matrix row count does not match!");
+        XASSERTM(z.template size<Perspective::pod>() == matrix2.template columns<Perspective::pod>(), "Vector size of z does not match!");
+
+        // fall back to two separate applications if there is no fused kernel for the
+        // preferred backend or if one of the matrices is empty
+        if ((Backend::get_preferred_backend() == PreferredBackend::cuda) ||
+          (this->used_elements() == 0) || (matrix2.used_elements() == 0))
+        {
+          if (Math::abs(beta) < Math::eps<DT_>())
+            this->apply(r, x);
+          else
+            this->apply(r, x, y, alpha);
+          matrix2.apply(r, z, r, alpha);
+          return;
+        }
+
+        TimeStamp ts_start;
+
+        XASSERTM(r.template elements<Perspective::pod>() != x.template elements<Perspective::pod>(), "Vector x and r must not share the same memory!");
+        XASSERTM(r.template elements<Perspective::pod>() != z.template elements<Perspective::pod>(), "Vector z and r must not share the same memory!");
+
+        Statistics::add_flops((this->used_elements<Perspective::pod>() + matrix2.template used_elements<Perspective::pod>() + this->rows<Perspective::pod>()) * 2);
+        Arch::Apply::template bcsr_fused<BlockHeight_, BlockWidth_, BlockWidth2_>(
+            r.template elements<Perspective::pod>(), alpha, x.template elements<Perspective::pod>(), z.template elements<Perspective::pod>(),
+            beta, y.template elements<Perspective::pod>(), this->template val<Perspective::pod>(), this->col_ind(), this->row_ptr(),
+            matrix2.template val<Perspective::pod>(), matrix2.col_ind(), matrix2.row_ptr(), this->rows());
+
+        TimeStamp ts_stop;
+        Statistics::add_time_blas2(ts_stop.elapsed(ts_start));
+      }
+
+    public:
+
       /**
        * \brief Adds a double-matrix product onto this matrix
        *
@@ -6,6 +6,7 @@
 #include <kernel/base_header.hpp>
 #include <test_system/test_system.hpp>
 #include <kernel/lafem/sparse_matrix_csr.hpp>
+#include <kernel/lafem/power_diag_matrix.hpp>
 #include <kernel/util/binary_stream.hpp>
 #include <kernel/util/random.hpp>
 #include <kernel/adjacency/cuthill_mckee.hpp>
@@ -219,6 +220,55 @@ public:
     SparseMatrixCSR<DT_, IT_> l(f.clone());
     l.shrink(DT_(1.9));
     TEST_CHECK_EQUAL(l.used_elements(), 10ul);
+
+    // shared layout testing
+    typedef typename std::conditional<std::is_same<IT_, std::uint32_t>::value, std::uint64_t, std::uint32_t>::type IT2;
+    auto layout_f = f.layout();
+    auto layout_g(layout_f);
+    TEST_CHECK(layout_g.is_shared_with(layout_f));
+    SparseMatrixCSR<DT_, IT_> g(layout_g);
+    TEST_CHECK(g.shares_indices(f));
+    layout_f = SparseLayout<IT_, SparseLayoutId::lt_csr>();
+    TEST_CHECK(!layout_f.is_shared_with(layout_g));
+
+    // converting to another index type loses the sharing, which can be restored afterwards
+    SparseMatrixCSR<DT_, IT2> f2, g2;
+    f2.convert(f);
+    g2.convert(g);
+    TEST_CHECK(!g2.shares_indices(f2));
+    TEST_CHECK(g2.share_indices(f2));
+    TEST_CHECK(g2.shares_indices(f2));
+    TEST_CHECK_EQUAL((void*)g2.row_ptr(), (void*)f2.row_ptr());
+    TEST_CHECK_EQUAL((void*)g2.col_ind(), (void*)f2.col_ind());
+    TEST_CHECK_NOT_EQUAL((void*)g2.val(), (void*)f2.val());
+    f2.clear();
+    TEST_CHECK_EQUAL(g2.used_elements(), f.used_elements());
+    TEST_CHECK_EQUAL(Index(g2.row_ptr()[g2.rows()]), f.used_elements());
+
+    // matrices with different patterns cannot share their layouts
+    SparseMatrixCSR<DT_, IT_> h(b.clone(CloneMode::Deep));
+    TEST_CHECK(!h.share_indices(f));
+    TEST_CHECK(h.share_indices(b));
+    TEST_CHECK_EQUAL(h, b);
+
+    // deserialized matrices can share their layouts again
+    BinaryStream bs;
+    f.write_out(FileMode::fm_csr, bs);
+    bs.seekg(0);
+    SparseMatrixCSR<DT_, IT_> k(FileMode::fm_csr, bs);
+    TEST_CHECK(!k.shares_indices(f));
+    TEST_CHECK(k.share_indices(f));
+    TEST_CHECK_EQUAL(k, f);
+
+    // converted power matrices keep sharing the layouts of their blocks
+    PowerDiagMatrix<SparseMatrixCSR<DT_, IT_>, 3> pd;
+    pd.get(0,0) = f.clone(CloneMode::Deep);
+    pd.get(1,1) = pd.get(0,0).clone(CloneMode::Layout);
+    pd.get(2,2) = b.clone(CloneMode::Deep);
+    PowerDiagMatrix<SparseMatrixCSR<DT_, IT2>, 3> pd2;
+    pd2.convert(pd);
+    TEST_CHECK(pd2.get(1,1).shares_indices(pd2.get(0,0)));
+    TEST_CHECK(!pd2.get(2,2).shares_indices(pd2.get(0,0)));
   }
 
 };
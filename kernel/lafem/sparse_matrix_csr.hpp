@@ -1887,6 +1887,83 @@ namespace FEAT
         Statistics::add_time_blas2(ts_stop.elapsed(ts_start));
       }
 
+      /**
+       * \brief Calculate \f$ R \leftarrow this\cdot X \f$ for multiple vectors at once
+       *
+       * The k columns of the dense matrices \p r and \p x are interpreted as k vectors, i.e. the
+       * vectors are stored interleaved, and all k products are computed in a single sweep over this
+       * matrix, so that the matrix is read from memory only once instead of k times.
+       *
+       * \attention r and x must \b not refer to the same object!
+       *
+       * \param[out] r The rows() x k dense matrix that receives the results.
+       * \param[in] x The columns() x k dense matrix whose columns are to be multiplied by this matrix.
+       */
+      void apply_multi(DenseMatrix<DT_, IT_> & r, const DenseMatrix<DT_, IT_> & x) const
+      {
+        XASSERTM(r.rows() == this->rows(), "Matrix rows of r do not match!");
+        XASSERTM(x.rows() == this->columns(), "Matrix rows of x do not match!");
+        XASSERTM(r.columns() == x.columns(), "Number of vectors of r and x do not match!");
+
+        TimeStamp ts_start;
+
+        if (this->used_elements() == 0)
+        {
+          r.format();
+          return;
+        }
+
+        XASSERTM(r.elements() != x.elements(), "Matrix x and r must not share the same memory!");
+
+        Statistics::add_flops(this->used_elements() * 2 * x.columns());
+        Arch::Apply::csr_mrhs(r.elements(), DT_(1), x.elements(), DT_(0), r.elements(),
+            this->val(), this->col_ind(), this->row_ptr(), this->rows(), x.columns());
+
+        TimeStamp ts_stop;
+        Statistics::add_time_blas2(ts_stop.elapsed(ts_start));
+      }
+
+      /**
+       * \brief Calculate \f$ R \leftarrow Y + \alpha~ this\cdot X \f$ for multiple vectors at once
+       *
+       * \attention r and x must \b not refer to the same object!
+       * \note r and y are allowed to refer to the same object.
+       *
+       * \param[out] r The rows() x k dense matrix that receives the results.
+       * \param[in] x The columns() x k dense matrix whose columns are to be multiplied by this matrix.
+       * \param[in] y The rows() x k dense summand matrix.
+       * \param[in] alpha A scalar to scale the products with.
+       */
+      void apply_multi(
+                 DenseMatrix<DT_, IT_> & r,
+                 const DenseMatrix<DT_, IT_> & x,
+                 const DenseMatrix<DT_, IT_> & y,
+                 const DT_ alpha = DT_(1)) const
+      {
+        XASSERTM(r.rows() == this->rows(), "Matrix rows of r do not match!");
+        XASSERTM(x.rows() == this->columns(), "Matrix rows of x do not match!");
+        XASSERTM(y.rows() == this->rows(), "Matrix rows of y do not match!");
+        XASSERTM(r.columns() == x.columns(), "Number of vectors of r and x do not match!");
+        XASSERTM(r.columns() == y.columns(), "Number of vectors of r and y do not match!");
+
+        TimeStamp ts_start;
+
+        if (this->used_elements() == 0 || Math::abs(alpha) < Math::eps<DT_>())
+        {
+          r.copy(y);
+          return;
+        }
+
+        XASSERTM(r.elements() != x.elements(), "Matrix x and r must not share the same memory!");
+
+        Statistics::add_flops((this->used_elements() + this->rows()) * 2 * x.columns());
+        Arch::Apply::csr_mrhs(r.elements(), alpha, x.elements(), DT_(1), y.elements(),
+            this->val(), this->col_ind(), this->row_ptr(), this->rows(), x.columns());
+
+        TimeStamp ts_stop;
+        Statistics::add_time_blas2(ts_stop.elapsed(ts_start));
+      }
+
       /**
        * \brief Adds a double-matrix product onto this matrix
        *
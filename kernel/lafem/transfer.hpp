@@ -8,8 +8,10 @@
 #define KERNEL_LAFEM_TRANSFER_HPP 1
 
 #include <kernel/lafem/base.hpp>
+#include <kernel/lafem/container.hpp>
 #include <kernel/util/exception.hpp>
 
+#include <type_traits>
 #include <utility>
 
 namespace FEAT
@@ -131,6 +133,13 @@ namespace FEAT
         _mat_prol.convert(other.get_mat_prol());
         _mat_rest.convert(other.get_mat_rest());
         _mat_trunc.convert(other.get_mat_trunc());
+
+        // the truncation matrix is usually a layout clone of the restriction matrix, but this
+        // sharing is lost if the index type is converted, so try to restore it here
+        if constexpr(std::is_base_of<Container<DataType, IndexType>, Matrix_>::value)
+        {
+          _mat_trunc.share_indices(_mat_rest);
+        }
       }
 
       /**
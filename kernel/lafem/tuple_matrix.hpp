@@ -304,14 +304,19 @@ namespace FEAT
 
       void apply(VectorTypeL& r, const VectorTypeR& x) const
       {
-        first().apply(r, x.first());
-        rest().apply(r, x.rest(), r, DataType(1));
+        // apply the first two blocks in a single pass and add the remaining ones afterwards
+        BlockRowApply<First_, typename TupleElement<0, Rest_...>::Type>::apply(
+          r, first(), x.first(), rest().first(), x.rest().first());
+        if constexpr(sizeof...(Rest_) > 1)
+          rest().rest().apply(r, x.rest().rest(), r, DataType(1));
       }
 
       void apply(VectorTypeL& r, const VectorTypeR& x, const VectorTypeL& y, DataType alpha = DataType(1)) const
       {
-        first().apply(r, x.first(), y, alpha);
-        rest().apply(r, x.rest(), r, alpha);
+        BlockRowApply<First_, typename TupleElement<0, Rest_...>::Type>::apply(
+          r, first(), x.first(), rest().first(), x.rest().first(), y, alpha);
+        if constexpr(sizeof...(Rest_) > 1)
+          rest().rest().apply(r, x.rest().rest(), r, alpha);
       }
 
       Index get_length_of_line(const Index row) const
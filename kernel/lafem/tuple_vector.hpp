@@ -9,6 +9,7 @@
 
 // includes, FEAT
 #include <kernel/lafem/meta_element.hpp>
+#include <kernel/lafem/dense_vector.hpp>
 
 
 // includes, system
@@ -85,6 +86,9 @@ namespace FEAT
       static_assert(std::is_same<IndexType, typename RestClass::IndexType>::value,
                     "sub-vectors have different index-types");
 
+      /// the vector type used for views of the contiguous array
+      typedef DenseVector<DataType, IndexType> ContiguousVectorType;
+
     protected:
       /// the first sub-vector
       First_ _first;
@@ -149,7 +153,9 @@ namespace FEAT
        */
       TupleVector clone(LAFEM::CloneMode mode = LAFEM::CloneMode::Weak) const
       {
-        return TupleVector(_first.clone(mode), _rest.clone(mode));
+        TupleVector result;
+        result.clone(*this, mode);
+        return result;
       }
 
       /**
@@ -161,6 +167,11 @@ namespace FEAT
        */
       void clone(const TupleVector& other, CloneMode clone_mode)
       {
+        if((clone_mode != CloneMode::Shallow) && other.is_contiguous())
+        {
+          _clone_contiguous(other, clone_mode);
+          return;
+        }
         _first.clone(other._first, clone_mode);
         _rest.clone(other._rest, clone_mode);
       }
@@ -173,6 +184,12 @@ namespace FEAT
        */
       void clone(const TupleVector& other)
       {
+        // contiguous vectors consist of dense vectors only, whose default clone mode is deep
+        if(other.is_contiguous())
+        {
+          _clone_contiguous(other, CloneMode::Deep);
+          return;
+        }
         _first.clone(other._first);
         _rest.clone(other._rest);
       }
@@ -211,6 +228,93 @@ namespace FEAT
         return sizeof(std::uint64_t) + ireal_size + _rest.set_checkpoint_data(data, config); //generate and add checkpoint data for the _rest
       }
 
+      /**
+       * \brief Returns the contiguous pod array of this vector.
+       *
+       * \returns
+       * A pointer to the first entry of the array containing the entries of all sub-vectors
+       * or \c nullptr, if the sub-vectors are not stored consecutively in one array or if
+       * this vector is empty.
+       */
+      DataType* contiguous_elements() const
+      {
+        DataType* next(nullptr);
+        if(!contiguous_follows(next) || (next == nullptr))
+          return nullptr;
+        return next - this->template size<Perspective::pod>();
+      }
+
+      /// Checks whether all non-empty sub-vectors are stored consecutively in one contiguous array.
+      bool is_contiguous() const
+      {
+        DataType* next(nullptr);
+        return contiguous_follows(next);
+      }
+
+      /**
+       * \brief Moves all sub-vectors into one contiguous array.
+       *
+       * \see PowerVector::make_contiguous()
+       */
+      void make_contiguous()
+      {
+        const Index n = this->template size<Perspective::pod>();
+        if(is_contiguous())
+          return;
+
+        DataType* data = MemoryPool::template allocate_memory<DataType>(n);
+        DataType* ptr = data;
+        relocate_to(data, ptr);
+
+        // the sub-vectors hold their own references to the array
+        MemoryPool::release_memory(data);
+      }
+
+      /// \cond internal
+      bool contiguous_follows(DataType*& next) const
+      {
+        return MetaContiguous<First_>::follows(_first, next) && MetaContiguous<RestClass>::follows(_rest, next);
+      }
+
+      void relocate_to(DataType* chunk, DataType*& data)
+      {
+        MetaContiguous<First_>::relocate(_first, chunk, data);
+        MetaContiguous<RestClass>::relocate(_rest, chunk, data);
+      }
+
+      void create_views(const TupleVector& layout, DataType* chunk, DataType*& data)
+      {
+        MetaContiguous<First_>::create_view(_first, layout._first, chunk, data);
+        MetaContiguous<RestClass>::create_view(_rest, layout._rest, chunk, data);
+      }
+
+      ContiguousVectorType contiguous_view() const
+      {
+        return ContiguousVectorType(this->template size<Perspective::pod>(), contiguous_elements());
+      }
+      /// \endcond
+
+    protected:
+      /// clones a contiguous vector by allocating the array of the clone at once
+      void _clone_contiguous(const TupleVector& other, CloneMode clone_mode)
+      {
+        const Index n = other.template size<Perspective::pod>();
+        DataType* data = (n > Index(0) ? MemoryPool::template allocate_memory<DataType>(n) : nullptr);
+        DataType* ptr = data;
+        create_views(other, data, ptr);
+        if(data == nullptr)
+          return;
+
+        // the sub-vectors hold their own references to the array
+        MemoryPool::release_memory(data);
+
+        // the layout and allocate modes do not copy the entries
+        if((clone_mode == CloneMode::Deep) || (clone_mode == CloneMode::Weak))
+          contiguous_view().copy(other.contiguous_view());
+      }
+
+    public:
+
       /// \cond internal
       First_& first()
       {
@@ -284,6 +388,11 @@ namespace FEAT
        */
       void format(DataType value = DataType(0))
       {
+        if(is_contiguous())
+        {
+          contiguous_view().format(value);
+          return;
+        }
         first().format(value);
         rest().format(value);
       }
@@ -317,36 +426,63 @@ namespace FEAT
       //template<typename First2_, typename... Rest2_>
       void copy(const TupleVector/*<First2_, Rest2_...>*/& x, bool full = false)
       {
+        if(!full && is_contiguous() && x.is_contiguous())
+        {
+          contiguous_view().copy(x.contiguous_view());
+          return;
+        }
         first().copy(x.first(), full);
         rest().copy(x.rest(), full);
       }
 
       void axpy(const TupleVector& x, const TupleVector& y, DataType alpha = DataType(1))
       {
+        if(is_contiguous() && x.is_contiguous() && y.is_contiguous())
+        {
+          contiguous_view().axpy(x.contiguous_view(), y.contiguous_view(), alpha);
+          return;
+        }
         first().axpy(x.first(), y.first(), alpha);
         rest().axpy(x.rest(), y.rest(), alpha);
       }
 
       void component_product(const TupleVector & x, const TupleVector & y)
       {
+        if(is_contiguous() && x.is_contiguous() && y.is_contiguous())
+        {
+          contiguous_view().component_product(x.contiguous_view(), y.contiguous_view());
+          return;
+        }
         first().component_product(x.first(), y.first());
         rest().component_product(x.rest(), y.rest());
       }
 
       void component_invert(const TupleVector& x, DataType alpha = DataType(1))
       {
+        if(is_contiguous() && x.is_contiguous())
+        {
+          contiguous_view().component_invert(x.contiguous_view(), alpha);
+          return;
+        }
         first().component_invert(x.first(), alpha);
         rest().component_invert(x.rest(), alpha);
       }
 
       void scale(const TupleVector& x, DataType alpha)
       {
+        if(is_contiguous() && x.is_contiguous())
+        {
+          contiguous_view().scale(x.contiguous_view(), alpha);
+          return;
+        }
         first().scale(x.first(), alpha);
         rest().scale(x.rest(), alpha);
       }
 
       DataType dot(const TupleVector& x) const
       {
+        if(is_contiguous() && x.is_contiguous())
+          return contiguous_view().dot(x.contiguous_view());
         return first().dot(x.first()) + rest().dot(x.rest());
       }
 
@@ -355,12 +491,16 @@ namespace FEAT
        **/
       DataType triple_dot(const TupleVector& x, const TupleVector& y) const
       {
+        if(is_contiguous() && x.is_contiguous() && y.is_contiguous())
+          return contiguous_view().triple_dot(x.contiguous_view(), y.contiguous_view());
         return first().triple_dot(x.first(), y.first())
           + rest().triple_dot(x.rest(), y.rest());
       }
 
       DataType norm2sqr() const
       {
+        if(is_contiguous())
+          return contiguous_view().norm2sqr();
         return first().norm2sqr() + rest().norm2sqr();
       }
 
@@ -653,6 +793,47 @@ namespace FEAT
         return _first;
       }
 
+      DataType* contiguous_elements() const
+      {
+        DataType* next(nullptr);
+        if(!contiguous_follows(next) || (next == nullptr))
+          return nullptr;
+        return next - this->template size<Perspective::pod>();
+      }
+
+      bool is_contiguous() const
+      {
+        DataType* next(nullptr);
+        return contiguous_follows(next);
+      }
+
+      void make_contiguous()
+      {
+        const Index n = this->template size<Perspective::pod>();
+        if(is_contiguous())
+          return;
+
+        DataType* data = MemoryPool::template allocate_memory<DataType>(n);
+        DataType* ptr = data;
+        relocate_to(data, ptr);
+        MemoryPool::release_memory(data);
+      }
+
+      bool contiguous_follows(DataType*& next) const
+      {
+        return MetaContiguous<First_>::follows(_first, next);
+      }
+
+      void relocate_to(DataType* chunk, DataType*& data)
+      {
+        MetaContiguous<First_>::relocate(_first, chunk, data);
+      }
+
+      void create_views(const TupleVector& layout, DataType* chunk, DataType*& data)
+      {
+        MetaContiguous<First_>::create_view(_first, layout._first, chunk, data);
+      }
+
       /// \copydoc FEAT::Control::Checkpointable::get_checkpoint_size()
       std::uint64_t get_checkpoint_size(SerialConfig& config)
       {
@@ -160,6 +160,8 @@ namespace FEAT
 
           for(Index i(0); i < get_mesh()->get_num_entities(0); ++i)
             vertex_set[i] = _coords_buffer(i);
+
+          get_mesh()->touch_vertices();
         }
 
         /**
@@ -16,6 +16,7 @@
 #include <kernel/solver/base.hpp>
 #include <kernel/util/stop_watch.hpp>
 
+#include <algorithm>
 #include <array>
 
 namespace FEAT
@@ -1104,19 +1105,19 @@ namespace FEAT
         /* ********************************************************************************************************* */
 
         /**
-         * \brief Calculates the stride for the local matrix
+         * \brief Calculates the sizes of the local matrices of all macros
          *
          * \param[in] matrix
-         * The Vanka matrix for which the local matrix stride is to be computed.
+         * The Vanka matrix for which the local matrix sizes are to be computed.
          *
          * \param[in] macro_dofs
-         * The vector of macro-dof graphs for which the stride is to be computed.
+         * The vector of macro-dof graphs for which the local matrix sizes are to be computed.
          *
          * \returns
-         * The stride of the local matrix part.
+         * A vector containing the number of rows of the local matrix of each macro.
          */
         template<typename Matrix_>
-        static Index calc_stride(const Matrix_& matrix, const std::vector<Adjacency::Graph>& macro_dofs)
+        static std::vector<Index> calc_macro_sizes(const Matrix_& matrix, const std::vector<Adjacency::Graph>& macro_dofs)
         {
           const std::size_t num_graphs = macro_dofs.size();
           const Index num_macros = macro_dofs.front().get_num_nodes_domain();
@@ -1128,23 +1129,122 @@ namespace FEAT
           XASSERT(num_graphs == block_sizes.size());
 
           // loop over all macros
-          Index rtn = Index(0);
+          std::vector<Index> macro_sizes(num_macros, Index(0));
           for(Index imacro(0); imacro < num_macros; ++imacro)
           {
-            Index count = Index(0);
-
             // loop over all graphs and summarize degrees
             for(std::size_t igraph(0); igraph < num_graphs; ++igraph)
             {
-              count += macro_dofs.at(igraph).degree(imacro) * block_sizes.at(igraph);
+              macro_sizes[imacro] += macro_dofs.at(igraph).degree(imacro) * block_sizes.at(igraph);
             }
-
-            rtn = Math::max(rtn, count);
           }
 
-          return rtn;
+          return macro_sizes;
         }
 
+        /**
+         * \brief Sorts the macros of each color by their local matrix sizes
+         *
+         * This function sorts the adjacency list of each color by the local matrix sizes of the macros,
+         * so that the macros of the same size, e.g. all element macros of the same element type, form
+         * consecutive runs, whose local matrices can be inverted as a batch by Math::invert_matrix_batched.
+         *
+         * \param[inout] color_macros
+         * The colors-at-macro graph whose adjacency lists are to be sorted.
+         *
+         * \param[in] macro_sizes
+         * The local matrix sizes of all macros, as returned by calc_macro_sizes().
+         */
+        static void sort_macros_by_size(Adjacency::Graph& color_macros, const std::vector<Index>& macro_sizes)
+        {
+          const Index num_colors = color_macros.get_num_nodes_domain();
+          const Index* ptr = color_macros.get_domain_ptr();
+          Index* idx = color_macros.get_image_idx();
+          for(Index k(0); k < num_colors; ++k)
+          {
+            std::stable_sort(&idx[ptr[k]], &idx[ptr[k+1]],
+              [&macro_sizes](Index a, Index b) {return macro_sizes[a] < macro_sizes[b];});
+          }
+        }
+
+        /**
+         * \brief Computes a coloring of the macros
+         *
+         * This function computes a greedy coloring of the macros, such that two macros of the same color
+         * do not share any DOF in any block. Consequently, the local matrices of all macros of the same
+         * color can be scattered into the Vanka matrix concurrently without any race conditions.
+         *
+         * \param[in] macro_dofs
+         * The macro-dofs graphs of all blocks.
+         *
+         * \param[in] dof_macros
+         * The dof-macros graphs of all blocks.
+         *
+         * \returns
+         * The colors-at-macro graph, i.e. the graph that contains all macros of color k in ascending
+         * order in its k-th adjacency list.
+         */
+        static Adjacency::Graph color_macros(const std::vector<Adjacency::Graph>& macro_dofs,
+          const std::vector<Adjacency::Graph>& dof_macros)
+        {
+          const Index num_macros = macro_dofs.front().get_num_nodes_domain();
+
+          // the color of each macro
+          std::vector<Index> colors(num_macros, ~Index(0));
+          // the last macro that has blocked a color
+          std::vector<Index> blocked;
+          Index num_colors(0);
+
+          // loop over all macros
+          for(Index imacro(0); imacro < num_macros; ++imacro)
+          {
+            // block the colors of all already colored macros that share a DOF with this macro
+            for(std::size_t igraph(0); igraph < macro_dofs.size(); ++igraph)
+            {
+              const Index* dom_ptr = macro_dofs[igraph].get_domain_ptr();
+              const Index* img_idx = macro_dofs[igraph].get_image_idx();
+              const Index* dm_ptr = dof_macros[igraph].get_domain_ptr();
+              const Index* dm_idx = dof_macros[igraph].get_image_idx();
+              for(Index i(dom_ptr[imacro]); i < dom_ptr[imacro+1]; ++i)
+              {
+                const Index idof = img_idx[i];
+                for(Index j(dm_ptr[idof]); j < dm_ptr[idof+1]; ++j)
+                {
+                  const Index c = colors[dm_idx[j]];
+                  if(c != ~Index(0))
+                    blocked[c] = imacro;
+                }
+              }
+            }
+
+            // pick the first color that is not blocked
+            Index color(0);
+            while((color < num_colors) && (blocked[color] == imacro))
+              ++color;
+            if(color == num_colors)
+            {
+              blocked.push_back(~Index(0));
+              ++num_colors;
+            }
+            colors[imacro] = color;
+          }
+
+          // build the colors-at-macro graph
+          Adjacency::Graph graph(num_colors, num_macros, num_macros);
+          Index* ptr = graph.get_domain_ptr();
+          Index* idx = graph.get_image_idx();
+          for(Index k(0); k <= num_colors; ++k)
+            ptr[k] = Index(0);
+          for(Index i(0); i < num_macros; ++i)
+            ++ptr[colors[i]+1];
+          for(Index k(0); k < num_colors; ++k)
+            ptr[k+1] += ptr[k];
+          std::vector<Index> aux(ptr, ptr + num_colors);
+          for(Index i(0); i < num_macros; ++i)
+            idx[aux[colors[i]]++] = i;
+
+          return graph;
+        }
       }; // struct AmaVankaCore
     } // namespace Intern
     /// \endcond
@@ -1187,6 +1287,13 @@ namespace FEAT
      * In the case of a LAFEM::SaddlePointMatrix, the smoother implemented in this class is mathematically
      * equivalent to a Solver::Vanka smoother of type Solver::VankaType::block_full_add.
      *
+     * <b>Multi-Threading:</b>\n
+     * If FEAT is compiled with OpenMP support, the numeric initialization is performed in parallel: the
+     * macros are colored once during the symbolic initialization, such that two macros of the same color
+     * do not share any DOFs, and then all macros of a single color are gathered, inverted and scattered
+     * in parallel by using thread-local scratch arrays. The application of the smoother is a sparse
+     * matrix-vector multiplication, so it does not require any macro-wise synchronization.
+     *
      * \author Peter Zajac
      */
     template<typename Matrix_, typename Filter_>
@@ -1222,6 +1329,10 @@ namespace FEAT
       std::vector<Adjacency::Graph> _macro_dofs, _dof_macros;
       /// the macro mask
       std::vector<int> _macro_mask;
+      /// the colors-at-macro graph
+      Adjacency::Graph _color_macros;
+      /// the local matrix size of each macro
+      std::vector<Index> _macro_sizes;
       /// number of steps
       Index _num_steps;
       /// damping parameter
@@ -1343,6 +1454,8 @@ namespace FEAT
           s += sizeof(Index) * std::size_t(g.get_num_nodes_domain() + g.get_num_indices());
         for(const auto& g : _dof_macros)
           s += sizeof(Index) * std::size_t(g.get_num_nodes_domain() + g.get_num_indices());
+        s += sizeof(Index) * std::size_t(_color_macros.get_num_nodes_domain() + _color_macros.get_num_indices());
+        s += sizeof(Index) * _macro_sizes.size();
         s += _vec_c.bytes();
         s += _vec_d.bytes();
         return s;
@@ -1440,8 +1553,15 @@ namespace FEAT
         if(this->_skip_singular)
           this->_macro_mask.resize(this->_macro_dofs.front().get_num_nodes_domain(), 0);
 
+        // color the macros for the parallel numeric initialization
+        this->_color_macros = Intern::AmaVankaCore::color_macros(this->_macro_dofs, this->_dof_macros);
+
         Solver::Intern::AmaVankaCore::alloc(this->_vanka, this->_dof_macros, this->_macro_dofs, Index(0), Index(0));
 
+        // group the macros of each color by their sizes for the batched inversion
+        this->_macro_sizes = Intern::AmaVankaCore::calc_macro_sizes(this->_vanka, this->_macro_dofs);
+        Intern::AmaVankaCore::sort_macros_by_size(this->_color_macros, this->_macro_sizes);
+
         watch_init_symbolic.stop();
       }
 
@@ -1450,6 +1570,8 @@ namespace FEAT
       {
         this->_vanka.clear();
         this->_macro_mask.clear();
+        this->_color_macros.clear();
+        this->_macro_sizes.clear();
         this->_dof_macros.clear();
         if(this->_auto_macros)
           this->_macro_dofs.clear();
@@ -1469,90 +1591,117 @@ namespace FEAT
         watch_init_numeric.start();
         BaseClass::init_numeric();
 
-        // get maximum macro size
-        const Index num_macros = Index(this->_macro_dofs.front().get_num_nodes_domain());
-        const Index stride = Intern::AmaVankaCore::calc_stride(this->_vanka, this->_macro_dofs);
+        // the maximum number of local matrix entries of a single batch
+        const Index max_batch_size = Index(1) << 20;
 
-        // allocate arrays for local matrix
-        std::vector<DataType> vec_local(stride*stride, DataType(0)), vec_local_t(stride*stride, DataType(0));
-        std::vector<Index> vec_pivot(stride);
-        DataType* local = vec_local.data();
-        DataType* local_t = vec_local_t.data();
-        Index* pivot = vec_pivot.data();
+        const Index num_colors = this->_color_macros.get_num_nodes_domain();
+        const Index* color_ptr = this->_color_macros.get_domain_ptr();
+        const Index* color_idx = this->_color_macros.get_image_idx();
+        const Index* macro_sizes = this->_macro_sizes.data();
 
         this->_vanka.format();
 
-        // loop over all macros
-        for(Index imacro(0); imacro < num_macros; ++imacro)
+        // the local matrices of a batch and their backups for the singularity check
+        std::vector<DataType> vec_batch, vec_batch_t;
+
+        // loop over all colors; the macros of a single color do not share any DOFs
+        for(Index icolor(0); icolor < num_colors; ++icolor)
         {
-          // gather local matrix
-          const std::pair<Index,Index> nrc = Intern::AmaVankaCore::gather(this->_matrix,
-            local, stride, imacro, this->_macro_dofs, Index(0), Index(0), Index(0), Index(0));
+          // loop over all batches of macros of the same size; the macros of each color are sorted by size
+          for(Index kbeg(color_ptr[icolor]), kend(kbeg); kbeg < color_ptr[icolor+1]; kbeg = kend)
+          {
+            const Index n = macro_sizes[color_idx[kbeg]];
+            const Index nn = n*n;
+            const Index max_count = Math::max(Index(1), max_batch_size / Math::max(Index(1), nn));
+            for(kend = kbeg + 1u; kend < color_ptr[icolor+1]; ++kend)
+            {
+              if((kend - kbeg >= max_count) || (macro_sizes[color_idx[kend]] != n))
+                break;
+            }
+            const Index count = kend - kbeg;
 
-          // make sure we have gathered a square matrix
-          XASSERTM(nrc.first == nrc.second, "local matrix is not square");
+            vec_batch.resize(count*nn);
+            if(this->_skip_singular)
+              vec_batch_t.resize(count*nn);
+            DataType* batch = vec_batch.data();
+            DataType* batch_t = vec_batch_t.data();
 
-          // do we check for singular macros?
-          if(this->_skip_singular)
-          {
-            // the approach used for checking the regularity of the local matrix is to check whether
-            //
-            //     || I - A*A^{-1} ||_F^2 < eps
-            //
-            // we could try to analyse the pivots returned by invert_matrix function instead, but
-            // unfortunately this approach sometimes leads to false positives
-
-            // make a backup if checking for singularity
-            for(Index i(0); i < nrc.first; ++i)
-              for(Index j(0); j < nrc.second; ++j)
-                local_t[i*stride+j] = local[i*stride+j];
-
-            // invert local matrix
-            Math::invert_matrix(nrc.first, stride, local, pivot);
-
-            // compute (squared) Frobenius norm of (I - A*A^{-1})
-            DataType norm = DataType(0);
-            for(Index i(0); i < nrc.first; ++i)
+            // gather all local matrices of this batch
+            FEAT_PRAGMA_OMP(parallel for schedule(static))
+            for(Index j = 0; j < count; ++j)
             {
-              for(Index j(0); j < nrc.first; ++j)
+              DataType* local = &batch[j*nn];
+              for(Index i(0); i < nn; ++i)
+                local[i] = DataType(0);
+
+              // gather local matrix
+              const std::pair<Index,Index> nrc = Intern::AmaVankaCore::gather(this->_matrix,
+                local, n, color_idx[kbeg+j], this->_macro_dofs, Index(0), Index(0), Index(0), Index(0));
+
+              // make sure we have gathered a square matrix
+              XASSERTM((nrc.first == n) && (nrc.second == n), "local matrix is not square");
+
+              // make a backup if checking for singularity
+              if(this->_skip_singular)
               {
-                DataType xij = DataType(i == j ? 1 : 0);
-                for(Index k(0); k < nrc.first; ++k)
-                  xij -= local_t[i*stride+k] * local[k*stride+j]; // A_ik * (A^{-1})_kj
-                norm += xij * xij;
+                for(Index i(0); i < nn; ++i)
+                  batch_t[j*nn + i] = local[i];
               }
             }
 
-            // is the matrix block singular?
-            // Note: we check for !(norm < eps) instead of (norm >= eps),
-            // because the latter one evaluates to false if norm is NaN,
-            // which would result in a false negative
-            const bool singular = !(norm < eps);
+            // invert all local matrices of this batch
+            Math::invert_matrix_batched(count, n, n, batch);
 
-            // set macro regularity mask
-            this->_macro_mask[imacro] = (singular ? 0 : 1);
-
-            // scatter local matrix
-            if(!singular)
+            // scatter all local matrices of this batch
+            FEAT_PRAGMA_OMP(parallel for schedule(static))
+            for(Index j = 0; j < count; ++j)
             {
-              Intern::AmaVankaCore::scatter_add(this->_vanka, local, stride, imacro, this->_macro_dofs,
+              const Index imacro = color_idx[kbeg+j];
+              const DataType* local = &batch[j*nn];
+
+              // do we check for singular macros?
+              if(this->_skip_singular)
+              {
+                // the approach used for checking the regularity of the local matrix is to check whether
+                //
+                //     || I - A*A^{-1} ||_F^2 < eps
+                //
+                // we could try to analyse the pivots returned by invert_matrix function instead, but
+                // unfortunately this approach sometimes leads to false positives
+                const DataType* local_t = &batch_t[j*nn];
+
+                // compute (squared) Frobenius norm of (I - A*A^{-1})
+                DataType norm = DataType(0);
+                for(Index i(0); i < n; ++i)
+                {
+                  for(Index jj(0); jj < n; ++jj)
+                  {
+                    DataType xij = DataType(i == jj ? 1 : 0);
+                    for(Index l(0); l < n; ++l)
+                      xij -= local_t[i*n+l] * local[l*n+jj]; // A_il * (A^{-1})_lj
+                    norm += xij * xij;
+                  }
+                }
+
+                // is the matrix block singular?
+                // Note: we check for !(norm < eps) instead of (norm >= eps),
+                // because the latter one evaluates to false if norm is NaN,
+                // which would result in a false negative
+                const bool singular = !(norm < eps);
+
+                // set macro regularity mask
+                this->_macro_mask[imacro] = (singular ? 0 : 1);
+
+                // skip singular local matrix
+                if(singular)
+                  continue;
+              }
+
+              // scatter local matrix
+              Intern::AmaVankaCore::scatter_add(this->_vanka, local, n, imacro, this->_macro_dofs,
                 Index(0), Index(0), Index(0), Index(0));
             }
           }
-          else // no singularity check
-          {
-            // invert local matrix
-            Math::invert_matrix(nrc.first, stride, local, pivot);
-
-            // scatter local matrix
-            Intern::AmaVankaCore::scatter_add(this->_vanka, local, stride, imacro, this->_macro_dofs,
-              Index(0), Index(0), Index(0), Index(0));
-          }
-
-          // reformat local matrix
-          for(Index i(0); i < nrc.first; ++i)
-            for(Index j(0); j < nrc.second; ++j)
-              local[i*stride+j] = DataType(0);
         }
 
         // scale rows of Vanka matrix
@@ -14,9 +14,12 @@
 #include <kernel/util/exception.hpp>
 #include <kernel/util/math.hpp>
 #include <kernel/util/property_map.hpp>
+#include <kernel/util/statistics.hpp>
 #include <kernel/util/string.hpp>
 
 // includes, system
+#include <array>
+#include <atomic>
 #include <memory>
 
 namespace FEAT
@@ -166,6 +169,61 @@ namespace FEAT
       }
     };
 
+    /// \cond internal
+    namespace Intern
+    {
+      /**
+       * \brief Cache of the interned Tracer names of the expressions of a solver
+       *
+       * The names are built and interned on first use only, so that recording solver expressions in
+       * the Tracer does not build any strings. Copies start with an empty cache.
+       */
+      class ExpressionTraceIds
+      {
+      private:
+        static constexpr std::uint32_t _none = ~std::uint32_t(0);
+        static constexpr std::size_t _num_types = std::size_t(ExpressionType::call_uzawa_a) + 1u;
+        std::array<std::atomic<std::uint32_t>, _num_types> _ids;
+
+        void _reset()
+        {
+          for(auto& id : _ids)
+            id.store(_none, std::memory_order_relaxed);
+        }
+
+      public:
+        ExpressionTraceIds()
+        {
+          _reset();
+        }
+
+        ExpressionTraceIds(const ExpressionTraceIds&)
+        {
+          _reset();
+        }
+
+        ExpressionTraceIds& operator=(const ExpressionTraceIds&)
+        {
+          _reset();
+          return *this;
+        }
+
+        template<typename NameFunc_>
+        std::uint32_t get(ExpressionType type, NameFunc_&& name_func)
+        {
+          std::atomic<std::uint32_t>& id = _ids.at(std::size_t(type));
+          std::uint32_t k = id.load(std::memory_order_relaxed);
+          if(k == _none)
+          {
+            k = Tracer::intern(Statistics::get_solver_trace_name(name_func(), type));
+            id.store(k, std::memory_order_relaxed);
+          }
+          return k;
+        }
+      };
+    } // namespace Intern
+    /// \endcond
+
     /**
      * \brief Polymorphic solver interface
      *
@@ -295,6 +353,22 @@ namespace FEAT
        */
       virtual String name() const = 0;
 
+      /**
+       * \brief Returns the Tracer name id of an expression of this solver.
+       *
+       * The name is built from name() and interned on the first call for each expression type,
+       * so name() must not change after the first solver expression has been traced.
+       *
+       * \param[in] type
+       * The type of the solver expression.
+       *
+       * \returns The interned Tracer name of the expression.
+       */
+      std::uint32_t get_trace_id(ExpressionType type) const
+      {
+        return _trace_ids.get(type, [this]() {return this->name();});
+      }
+
       /**
        * \brief Solver application method
        *
@@ -317,6 +391,10 @@ namespace FEAT
        * A Status code that represents the status of the solution step.
        */
       virtual Status apply(Vector_& vec_cor, const Vector_& vec_def) = 0;
+
+    private:
+      /// the cached Tracer names of the expressions of this solver
+      mutable Intern::ExpressionTraceIds _trace_ids;
     }; // class SolverBase<...>
 
     /**
@@ -393,7 +471,12 @@ namespace FEAT
     class IterationStats
     {
     private:
+      /// the solver name; only set if solver expressions are enabled
       const String _solver_name;
+      /// the Tracer name id of the timings expression; only valid if _traced is true
+      std::uint32_t _trace_id;
+      /// specifies whether the Tracer was enabled upon construction
+      const bool _traced;
       TimeStamp _at;
       double _mpi_execute_reduction_start;
       double _mpi_execute_reduction_stop;
@@ -425,7 +508,9 @@ namespace FEAT
        */
       template<typename Vector_>
       explicit IterationStats(const SolverBase<Vector_>& solver) :
-        _solver_name(solver.name()),
+        _solver_name(Statistics::enable_solver_expressions ? solver.name() : String()),
+        _trace_id(0u),
+        _traced(Tracer::enabled()),
         _destroyed(false)
       {
         _mpi_execute_reduction_start = Statistics::get_time_mpi_execute_reduction();
@@ -444,6 +529,8 @@ namespace FEAT
         _mpi_wait_stop_blas2    = _mpi_wait_start_blas2;
         _mpi_wait_stop_blas3    = _mpi_wait_start_blas3;
         _mpi_wait_stop_collective    = _mpi_wait_start_collective;
+        if(_traced)
+          _trace_id = solver.get_trace_id(ExpressionType::timings);
       }
 
       // delete copy-ctor and assign operator
@@ -475,15 +562,21 @@ namespace FEAT
         _mpi_wait_stop_blas2    = Statistics::get_time_mpi_wait_blas2();
         _mpi_wait_stop_blas3    = Statistics::get_time_mpi_wait_blas3();
         _mpi_wait_stop_collective    = Statistics::get_time_mpi_wait_collective();
-        Statistics::add_solver_expression(std::make_shared<ExpressionTimings>(_solver_name, _at.elapsed_now(),
-          _mpi_execute_reduction_stop - _mpi_execute_reduction_start,
-          _mpi_execute_blas2_stop - _mpi_execute_blas2_start,
-          _mpi_execute_blas3_stop - _mpi_execute_blas3_start,
-          _mpi_execute_collective_stop - _mpi_execute_collective_start,
-          _mpi_wait_stop_reduction - _mpi_wait_start_reduction,
-          _mpi_wait_stop_blas2 - _mpi_wait_start_blas2,
-          _mpi_wait_stop_blas3 - _mpi_wait_start_blas3,
-          _mpi_wait_stop_collective - _mpi_wait_start_collective));
+        // note: adding the expression object also records it in the Tracer
+        if(Statistics::enable_solver_expressions && !_solver_name.empty())
+        {
+          Statistics::add_solver_expression(std::make_shared<ExpressionTimings>(_solver_name, _at.elapsed_now(),
+            _mpi_execute_reduction_stop - _mpi_execute_reduction_start,
+            _mpi_execute_blas2_stop - _mpi_execute_blas2_start,
+            _mpi_execute_blas3_stop - _mpi_execute_blas3_start,
+            _mpi_execute_collective_stop - _mpi_execute_collective_start,
+            _mpi_wait_stop_reduction - _mpi_wait_start_reduction,
+            _mpi_wait_stop_blas2 - _mpi_wait_start_blas2,
+            _mpi_wait_stop_blas3 - _mpi_wait_start_blas3,
+            _mpi_wait_stop_collective - _mpi_wait_start_collective));
+        }
+        else if(_traced && Tracer::enabled())
+          Statistics::trace_solver_expression(ExpressionType::timings, _trace_id);
 
         _destroyed = true;
       }
@@ -16,6 +16,7 @@
 #include <kernel/solver/bicgstab.hpp>
 #include <kernel/solver/bicgstabl.hpp>
 #include <kernel/solver/fgmres.hpp>
+#include <kernel/solver/gcrodr.hpp>
 #include <kernel/solver/pcg.hpp>
 #include <kernel/solver/rgcr.hpp>
 #include <kernel/solver/pcr.hpp>
@@ -93,6 +94,56 @@ public:
       + stringify(ref_iters) + " +/- " + stringify(iter_tol));
   }
 
+  void test_recycling(const MatrixType& matrix, const FilterType& filter) const
+  {
+    const DataType tol = Math::pow(Math::eps<DataType>(), DataType(0.5));
+
+    // solve a sequence of systems with slightly shifted diagonals and varying right-hand-sides
+    // with FGMRES(10) and GCRODR(10,4) and compare the total number of iterations
+    MatrixType mat_seq = matrix.clone();
+    VectorType vec_sol(matrix.create_vector_r()), vec_rhs(matrix.create_vector_r()), vec_def(matrix.create_vector_r());
+
+    auto solver_0 = Solver::new_fgmres(mat_seq, filter, 10);
+    auto solver_1 = Solver::new_gcrodr(mat_seq, filter, 10, 4);
+    solver_0->set_max_iter(1000);
+    solver_1->set_max_iter(1000);
+    solver_0->init();
+    solver_1->init();
+
+    Index iters_0(0), iters_1(0);
+    for(Index k(0); k < 5; ++k)
+    {
+      // shift diagonal
+      const IndexType* row_ptr = mat_seq.row_ptr();
+      const IndexType* col_idx = mat_seq.col_ind();
+      DataType* val = mat_seq.val();
+      for(Index i(0); i < mat_seq.rows(); ++i)
+        for(IndexType j(row_ptr[i]); j < row_ptr[i+1]; ++j)
+          if(Index(col_idx[j]) == i)
+            val[j] += DataType(0.01) * DataType(k);
+
+      // create rhs
+      for(Index i(0); i < vec_rhs.size(); ++i)
+        vec_rhs(i, DataType(1) + Math::sin(DataType(i*(k+1)) / DataType(vec_rhs.size())));
+
+      TEST_CHECK(status_success(solver_0->apply(vec_sol, vec_rhs)));
+      iters_0 += solver_0->get_num_iter();
+
+      TEST_CHECK(status_success(solver_1->apply(vec_sol, vec_rhs)));
+      iters_1 += solver_1->get_num_iter();
+      TEST_CHECK(solver_1->get_num_recycle() > Index(0));
+
+      // check residual
+      mat_seq.apply(vec_def, vec_sol, vec_rhs, -DataType(1));
+      TEST_CHECK(vec_def.norm2() <= tol * vec_rhs.norm2());
+    }
+
+    solver_1->done();
+    solver_0->done();
+
+    TEST_CHECK(iters_1 < iters_0);
+  }
+
   virtual void run() const override
   {
     const Index m = 17;
@@ -138,6 +189,20 @@ public:
       test_solver("PCG-JAC", *solver, vec_sol, vec_ref, vec_rhs, 28);
     }
 
+    // test traced PCG-JAC: the solver events are recorded by the trace names cached in the solvers
+    {
+      auto precon = Solver::new_jacobi_precond(matrix, filter);
+      auto solver = Solver::new_pcg(matrix, filter, precon);
+      Tracer::clear();
+      Tracer::enable(1024u);
+      test_solver("PCG-JAC", *solver, vec_sol, vec_ref, vec_rhs, 28);
+      Tracer::disable();
+      TEST_CHECK(Tracer::size() > std::size_t(0));
+      TEST_CHECK_EQUAL(solver->get_trace_id(Solver::ExpressionType::start_solve), Tracer::intern(solver->name()));
+      TEST_CHECK_EQUAL(Tracer::get_name(solver->get_trace_id(Solver::ExpressionType::call_precond)), solver->name() + ":precond");
+      Tracer::clear();
+    }
+
     // test PCG-POLY(3)
     {
       auto precon = Solver::new_polynomial_precond(matrix, filter, 3);
@@ -237,6 +302,16 @@ public:
       test_solver("FGMRES(16)-JAC", *solver, vec_sol, vec_ref, vec_rhs, 48);
     }
 
+    // test GCRODR-JAC
+    {
+      auto precon = Solver::new_jacobi_precond(matrix, filter);
+      auto solver = Solver::new_gcrodr(matrix, filter, 16, 4, precon);
+      test_solver("GCRODR(16,4)-JAC", *solver, vec_sol, vec_ref, vec_rhs, 29);
+    }
+
+    // test GCRODR recycling over a sequence of systems
+    test_recycling(matrix, filter);
+
     // test PCG-jac-matrix
     /*{
       SparseMatrixCOO<:Main, DataType, IndexType> coo_jac(csr_mat.rows(), csr_mat.columns());
@@ -338,7 +338,7 @@ namespace FEAT
         Status _apply_intern(VectorType& vec_sol, const VectorType& DOXY(vec_rhs))
         {
           IterationStats pre_iter(*this);
-          Statistics::add_solver_expression(std::make_shared<ExpressionStartSolve>(this->name()));
+          Statistics::add_solver_expression<ExpressionStartSolve>(*this);
           VectorType& vec_p_tilde  (_vec_p_tilde);
           VectorType& vec_r        (_vec_r);
           VectorType& vec_r_tilde  (_vec_r_tilde);
@@ -354,8 +354,7 @@ namespace FEAT
           // Apply preconditioner to initial defect and save it to p_0
           if(!this->_apply_precond(vec_p_tilde, _vec_r, fil_sys))
           {
-            Statistics::add_solver_expression(
-              std::make_shared<ExpressionEndSolve>(this->name(), Status::aborted, this->get_num_iter()));
+            Statistics::add_solver_expression<ExpressionEndSolve>(*this, Status::aborted, this->get_num_iter());
             return Status::aborted;
           }
 
@@ -397,8 +396,7 @@ namespace FEAT
             if(!this->_apply_precond(vec_q_tilde, vec_q, fil_sys))
             {
               stat.destroy();
-              Statistics::add_solver_expression(
-                std::make_shared<ExpressionEndSolve>(this->name(), Status::aborted, this->get_num_iter()));
+              Statistics::add_solver_expression<ExpressionEndSolve>(*this, Status::aborted, this->get_num_iter());
               return Status::aborted;
             }
 
@@ -457,8 +455,7 @@ namespace FEAT
                   this->_plot_iter_line(this->_num_iter, this->_def_cur, def_old);
 
                 stat.destroy();
-                Statistics::add_solver_expression(
-                  std::make_shared<ExpressionEndSolve>(this->name(), status_half, this->get_num_iter()));
+                Statistics::add_solver_expression<ExpressionEndSolve>(*this, status_half, this->get_num_iter());
 
                 return status_half;
               }
@@ -476,8 +473,7 @@ namespace FEAT
             if(!this->_apply_precond(vec_t_tilde, vec_t, fil_sys))
             {
               stat.destroy();
-              Statistics::add_solver_expression(
-                std::make_shared<ExpressionEndSolve>(this->name(), Status::aborted, this->get_num_iter()));
+              Statistics::add_solver_expression<ExpressionEndSolve>(*this, Status::aborted, this->get_num_iter());
               return Status::aborted;
             }
 
@@ -498,8 +494,7 @@ namespace FEAT
               // This should not happen: BiCGStab breakdown
               status = Status::aborted;
               stat.destroy();
-              Statistics::add_solver_expression(
-                std::make_shared<ExpressionEndSolve>(this->name(), status, this->get_num_iter()));
+              Statistics::add_solver_expression<ExpressionEndSolve>(*this, status, this->get_num_iter());
               return status;
             }
 
@@ -517,8 +512,7 @@ namespace FEAT
             if(status != Status::progress)
             {
               stat.destroy();
-              Statistics::add_solver_expression(
-                std::make_shared<ExpressionEndSolve>(this->name(), status, this->get_num_iter()));
+              Statistics::add_solver_expression<ExpressionEndSolve>(*this, status, this->get_num_iter());
               return status;
             }
 
@@ -546,8 +540,7 @@ namespace FEAT
               // This should not happen: BiCGStab breakdown
               status = Status::aborted;
               stat.destroy();
-              Statistics::add_solver_expression(
-                std::make_shared<ExpressionEndSolve>(this->name(), status, this->get_num_iter()));
+              Statistics::add_solver_expression<ExpressionEndSolve>(*this, status, this->get_num_iter());
               return status;
             }
 
@@ -558,8 +551,7 @@ namespace FEAT
           }
 
           // we should never reach this point...
-          Statistics::add_solver_expression(
-            std::make_shared<ExpressionEndSolve>(this->name(), Status::undefined, this->get_num_iter()));
+          Statistics::add_solver_expression<ExpressionEndSolve>(*this, Status::undefined, this->get_num_iter());
           return Status::undefined;
         }
     }; // class BiCGStab<...>
@@ -321,7 +321,7 @@ namespace FEAT
         Status _apply_intern(VectorType& vec_sol, const VectorType& vec_rhs)
         {
           IterationStats pre_iter(*this);
-          Statistics::add_solver_expression(std::make_shared<ExpressionStartSolve>(this->name()));
+          Statistics::add_solver_expression<ExpressionStartSolve>(*this);
 
 
           int l (_l);
@@ -352,8 +352,7 @@ namespace FEAT
             _vec_pc.copy(_vec_rj_hat.at(0));
             if(!this->_apply_precond(_vec_rj_hat.at(0), _vec_pc, fil_sys))
             {
-              Statistics::add_solver_expression(
-                std::make_shared<ExpressionEndSolve>(this->name(), Status::aborted, this->get_num_iter()));
+              Statistics::add_solver_expression<ExpressionEndSolve>(*this, Status::aborted, this->get_num_iter());
               return Status::aborted;
             }
           }
@@ -384,8 +383,7 @@ namespace FEAT
                 fil_sys.filter_def(_vec_pc);
                 if(!this->_apply_precond(_vec_uj_hat.at( Index(j+1) ), _vec_pc, fil_sys))
                 {
-                  Statistics::add_solver_expression(
-                    std::make_shared<ExpressionEndSolve>(this->name(), Status::aborted, this->get_num_iter()));
+                  Statistics::add_solver_expression<ExpressionEndSolve>(*this, Status::aborted, this->get_num_iter());
                   return Status::aborted;
                 }
               }
@@ -393,8 +391,7 @@ namespace FEAT
               {
                 if(!this->_apply_precond(_vec_pc, _vec_uj_hat.at( Index(j) ), fil_sys))
                 {
-                  Statistics::add_solver_expression(
-                    std::make_shared<ExpressionEndSolve>(this->name(), Status::aborted, this->get_num_iter()));
+                  Statistics::add_solver_expression<ExpressionEndSolve>(*this, Status::aborted, this->get_num_iter());
                   return Status::aborted;
                 }
                 mat_sys.apply(_vec_uj_hat.at( Index(j+1) ), _vec_pc);
@@ -416,8 +413,7 @@ namespace FEAT
                 fil_sys.filter_def(_vec_pc);
                 if(!this->_apply_precond(_vec_rj_hat.at( Index(j+1) ) , _vec_pc, fil_sys))
                 {
-                  Statistics::add_solver_expression(
-                    std::make_shared<ExpressionEndSolve>(this->name(), Status::aborted, this->get_num_iter()));
+                  Statistics::add_solver_expression<ExpressionEndSolve>(*this, Status::aborted, this->get_num_iter());
                   return Status::aborted;
                 }
               }
@@ -425,8 +421,7 @@ namespace FEAT
               {
                 if(!this->_apply_precond(_vec_pc, _vec_rj_hat.at(Index(j)), fil_sys))
                 {
-                  Statistics::add_solver_expression(
-                    std::make_shared<ExpressionEndSolve>(this->name(), Status::aborted, this->get_num_iter()));
+                  Statistics::add_solver_expression<ExpressionEndSolve>(*this, Status::aborted, this->get_num_iter());
                   return Status::aborted;
                 }
                 mat_sys.apply(_vec_rj_hat.at(Index(j+1)), _vec_pc);
@@ -493,14 +488,12 @@ namespace FEAT
             if(status != Status::progress)
             {
               stat.destroy();
-              Statistics::add_solver_expression(
-                std::make_shared<ExpressionEndSolve>(this->name(), status, this->get_num_iter()));
+              Statistics::add_solver_expression<ExpressionEndSolve>(*this, status, this->get_num_iter());
               if (_precon_variant == BiCGStabLPreconVariant::right)
               {
                 if(!this->_apply_precond(_vec_pc, vec_sol, fil_sys))
                 {
-                  Statistics::add_solver_expression(
-                    std::make_shared<ExpressionEndSolve>(this->name(), Status::aborted, this->get_num_iter()));
+                  Statistics::add_solver_expression<ExpressionEndSolve>(*this, Status::aborted, this->get_num_iter());
                   return Status::aborted;
                 }
                 vec_sol.copy(_vec_pc);
@@ -510,8 +503,7 @@ namespace FEAT
 
           }
           // we should never reach this point...
-          Statistics::add_solver_expression(
-            std::make_shared<ExpressionEndSolve>(this->name(), Status::undefined, this->get_num_iter()));
+          Statistics::add_solver_expression<ExpressionEndSolve>(*this, Status::undefined, this->get_num_iter());
           return Status::undefined;
         }
     };
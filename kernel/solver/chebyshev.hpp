@@ -233,7 +233,7 @@ namespace FEAT
     protected:
       virtual Status _apply_intern(VectorType& vec_sol, const VectorType& vec_rhs)
       {
-        Statistics::add_solver_expression(std::make_shared<ExpressionStartSolve>(this->name()));
+        Statistics::add_solver_expression<ExpressionStartSolve>(*this);
 
         VectorType& vec_def(this->_vec_def);
         VectorType& vec_cor(this->_vec_cor);
@@ -280,7 +280,7 @@ namespace FEAT
         }
 
         // return our status
-        Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), status, this->get_num_iter()));
+        Statistics::add_solver_expression<ExpressionEndSolve>(*this, status, this->get_num_iter());
         return status;
       }
     }; // class Chebyshev<...>
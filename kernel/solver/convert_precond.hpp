@@ -99,22 +99,22 @@ namespace FEAT
 
       virtual Status apply(VectorTypeOuter& vec_cor, const VectorTypeOuter& vec_def) override
       {
-        Statistics::add_solver_expression(std::make_shared<ExpressionStartSolve>(this->name()));
+        Statistics::add_solver_expression<ExpressionStartSolve>(*this);
 
         VectorTypeInner vec_def_inner;
         vec_def_inner.convert(vec_def);
         VectorTypeInner vec_cor_inner(vec_def_inner.clone(LAFEM::CloneMode::Layout));
 
-        Statistics::add_solver_expression(std::make_shared<ExpressionCallPrecond>(this->name(), this->_inner_solver->name()));
+        Statistics::add_solver_expression<ExpressionCallPrecond>(*this, this->_inner_solver);
         Status status = _inner_solver->apply(vec_cor_inner, vec_def_inner);
         if(!status_success(status))
         {
-          Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), status, 0));
+          Statistics::add_solver_expression<ExpressionEndSolve>(*this, status, 0);
           return status;
         }
 
         vec_cor.convert(vec_cor_inner);
-        Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::success, 0));
+        Statistics::add_solver_expression<ExpressionEndSolve>(*this, Status::success, 0);
         return Status::success;
       }
     }; // class ConvertPrecond<...>
@@ -203,22 +203,22 @@ namespace FEAT
 
       virtual Status apply(VectorTypeOuter& vec_cor, const VectorTypeOuter& vec_def) override
       {
-        Statistics::add_solver_expression(std::make_shared<ExpressionStartSolve>(this->name()));
+        Statistics::add_solver_expression<ExpressionStartSolve>(*this);
 
         VectorTypeInner vec_def_inner;
         vec_def_inner.convert(vec_def_inner.get_gate(), vec_def);
         VectorTypeInner vec_cor_inner(vec_def_inner.clone(LAFEM::CloneMode::Layout));
 
-        Statistics::add_solver_expression(std::make_shared<ExpressionCallPrecond>(this->name(), this->_inner_solver->name()));
+        Statistics::add_solver_expression<ExpressionCallPrecond>(*this, this->_inner_solver);
         Status status = _inner_solver->apply(vec_cor_inner, vec_def_inner);
         if(!status_success(status))
         {
-          Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), status, 0));
+          Statistics::add_solver_expression<ExpressionEndSolve>(*this, status, 0);
           return status;
         }
 
         vec_cor.convert(vec_cor.get_gate(), vec_cor_inner);
-        Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::success, 0));
+        Statistics::add_solver_expression<ExpressionEndSolve>(*this, Status::success, 0);
         return Status::success;
       }
     }; // class ConvertPrecond<...>
@@ -89,6 +89,27 @@ namespace FEAT
         return os << "unknown";
       }
     }
+
+    namespace Intern
+    {
+      /// returns the name of a solver given as a string, by reference or by (smart) pointer
+      inline String expression_name(const String& name)
+      {
+        return name;
+      }
+
+      template<typename Solver_>
+      inline auto expression_name(const Solver_& solver) -> decltype(String(solver.name()))
+      {
+        return solver.name();
+      }
+
+      template<typename Solver_>
+      inline auto expression_name(const Solver_& solver) -> decltype(String(solver->name()))
+      {
+        return solver->name();
+      }
+    } // namespace Intern
     /// \endcond
 
     class ExpressionBase
@@ -111,6 +132,9 @@ namespace FEAT
     class ExpressionStartSolve : public ExpressionBase
     {
       public:
+        /// the type of this expression
+        static constexpr ExpressionType expression_type = ExpressionType::start_solve;
+
         explicit ExpressionStartSolve(String name) :
           ExpressionBase(name)
         {
@@ -129,6 +153,9 @@ namespace FEAT
     class ExpressionEndSolve : public ExpressionBase
     {
       public:
+        /// the type of this expression
+        static constexpr ExpressionType expression_type = ExpressionType::end_solve;
+
         /// the status result of the solver call
         Status status;
         /// the iteration count needed in this solve process
@@ -153,6 +180,9 @@ namespace FEAT
     class ExpressionCallPrecond : public ExpressionBase
     {
       public:
+        /// the type of this expression
+        static constexpr ExpressionType expression_type = ExpressionType::call_precond;
+
         String precond_name;
 
         explicit ExpressionCallPrecond(String name, String precond_name_in) :
@@ -161,6 +191,13 @@ namespace FEAT
         {
         }
 
+        /// creates the expression from the called solver object, whose name is only queried here
+        template<typename Solver_>
+        explicit ExpressionCallPrecond(String name, const Solver_& precond) :
+          ExpressionCallPrecond(name, Intern::expression_name(precond))
+        {
+        }
+
         virtual ~ExpressionCallPrecond()
         {
         }
@@ -174,6 +211,9 @@ namespace FEAT
     class ExpressionCallPrecondL : public ExpressionBase
     {
       public:
+        /// the type of this expression
+        static constexpr ExpressionType expression_type = ExpressionType::call_precond_l;
+
         String precond_name;
 
         explicit ExpressionCallPrecondL(String name, String precond_name_in) :
@@ -182,6 +222,13 @@ namespace FEAT
         {
         }
 
+        /// creates the expression from the called solver object, whose name is only queried here
+        template<typename Solver_>
+        explicit ExpressionCallPrecondL(String name, const Solver_& precond) :
+          ExpressionCallPrecondL(name, Intern::expression_name(precond))
+        {
+        }
+
         virtual ~ExpressionCallPrecondL()
         {
         }
@@ -195,6 +242,9 @@ namespace FEAT
     class ExpressionCallPrecondR : public ExpressionBase
     {
       public:
+        /// the type of this expression
+        static constexpr ExpressionType expression_type = ExpressionType::call_precond_r;
+
         String precond_name;
 
         explicit ExpressionCallPrecondR(String name, String precond_name_in) :
@@ -203,6 +253,13 @@ namespace FEAT
         {
         }
 
+        /// creates the expression from the called solver object, whose name is only queried here
+        template<typename Solver_>
+        explicit ExpressionCallPrecondR(String name, const Solver_& precond) :
+          ExpressionCallPrecondR(name, Intern::expression_name(precond))
+        {
+        }
+
         virtual ~ExpressionCallPrecondR()
         {
         }
@@ -216,6 +273,9 @@ namespace FEAT
     class ExpressionCallSmoother : public ExpressionBase
     {
       public:
+        /// the type of this expression
+        static constexpr ExpressionType expression_type = ExpressionType::call_smoother;
+
         String smoother_name;
 
         explicit ExpressionCallSmoother(String name, String smoother_name_in) :
@@ -224,6 +284,13 @@ namespace FEAT
         {
         }
 
+        /// creates the expression from the called solver object, whose name is only queried here
+        template<typename Solver_>
+        explicit ExpressionCallSmoother(String name, const Solver_& smoother) :
+          ExpressionCallSmoother(name, Intern::expression_name(smoother))
+        {
+        }
+
         virtual ~ExpressionCallSmoother()
         {
         }
@@ -237,6 +304,9 @@ namespace FEAT
     class ExpressionCallCoarseSolver : public ExpressionBase
     {
       public:
+        /// the type of this expression
+        static constexpr ExpressionType expression_type = ExpressionType::call_coarse_solver;
+
         String coarse_solver_name;
 
         explicit ExpressionCallCoarseSolver(String name, String coarse_solver_name_in) :
@@ -245,6 +315,13 @@ namespace FEAT
         {
         }
 
+        /// creates the expression from the called solver object, whose name is only queried here
+        template<typename Solver_>
+        explicit ExpressionCallCoarseSolver(String name, const Solver_& coarse_solver) :
+          ExpressionCallCoarseSolver(name, Intern::expression_name(coarse_solver))
+        {
+        }
+
         virtual ~ExpressionCallCoarseSolver()
         {
         }
@@ -258,6 +335,9 @@ namespace FEAT
     class ExpressionProlongation : public ExpressionBase
     {
       public:
+        /// the type of this expression
+        static constexpr ExpressionType expression_type = ExpressionType::prol;
+
         Index level;
 
         explicit ExpressionProlongation(String name, Index level_in) :
@@ -279,6 +359,9 @@ namespace FEAT
     class ExpressionRestriction : public ExpressionBase
     {
       public:
+        /// the type of this expression
+        static constexpr ExpressionType expression_type = ExpressionType::rest;
+
         Index level;
 
         explicit ExpressionRestriction(String name, Index level_in) :
@@ -300,6 +383,9 @@ namespace FEAT
     class ExpressionDefect : public ExpressionBase
     {
       public:
+        /// the type of this expression
+        static constexpr ExpressionType expression_type = ExpressionType::defect;
+
         double def;
         Index iter;
 
@@ -323,6 +409,9 @@ namespace FEAT
     class ExpressionTimings : public ExpressionBase
     {
       public:
+        /// the type of this expression
+        static constexpr ExpressionType expression_type = ExpressionType::timings;
+
         double solver_toe, mpi_execute_reduction, mpi_execute_blas2, mpi_execute_blas3, mpi_execute_collective, mpi_wait_reduction, mpi_wait_blas2, mpi_wait_blas3, mpi_wait_collective;
 
         explicit ExpressionTimings(String name, double solver_toe_in, double mpi_execute_reduction_in, double mpi_execute_blas2_in, double mpi_execute_blas3_in,
@@ -353,6 +442,9 @@ namespace FEAT
     class ExpressionLevelTimings : public ExpressionBase
     {
       public:
+        /// the type of this expression
+        static constexpr ExpressionType expression_type = ExpressionType::level_timings;
+
         Index level;
         double level_toe, mpi_execute_reduction, mpi_execute_blas2, mpi_execute_blas3, mpi_execute_collective, mpi_wait_reduction, mpi_wait_blas2, mpi_wait_blas3, mpi_wait_collective;
 
@@ -385,6 +477,9 @@ namespace FEAT
     class ExpressionCallUzawaS : public ExpressionBase
     {
       public:
+        /// the type of this expression
+        static constexpr ExpressionType expression_type = ExpressionType::call_uzawa_s;
+
         String solver_s_name;
 
         explicit ExpressionCallUzawaS(String name, String solver_s_name_in) :
@@ -393,6 +488,13 @@ namespace FEAT
         {
         }
 
+        /// creates the expression from the called solver object, whose name is only queried here
+        template<typename Solver_>
+        explicit ExpressionCallUzawaS(String name, const Solver_& solver_s) :
+          ExpressionCallUzawaS(name, Intern::expression_name(solver_s))
+        {
+        }
+
         virtual ~ExpressionCallUzawaS()
         {
         }
@@ -406,6 +508,9 @@ namespace FEAT
     class ExpressionCallUzawaA : public ExpressionBase
     {
       public:
+        /// the type of this expression
+        static constexpr ExpressionType expression_type = ExpressionType::call_uzawa_a;
+
         String solver_a_name;
 
         explicit ExpressionCallUzawaA(String name, String solver_a_name_in) :
@@ -414,6 +519,13 @@ namespace FEAT
         {
         }
 
+        /// creates the expression from the called solver object, whose name is only queried here
+        template<typename Solver_>
+        explicit ExpressionCallUzawaA(String name, const Solver_& solver_a) :
+          ExpressionCallUzawaA(name, Intern::expression_name(solver_a))
+        {
+        }
+
         virtual ~ExpressionCallUzawaA()
         {
         }
@@ -0,0 +1,456 @@
+// FEAT3: Finite Element Analysis Toolbox, Version 3
+// Copyright (C) 2010 - 2023 by Stefan Turek & the FEAT group
+// FEAT3 is released under the GNU General Public License version 3,
+// see the file 'copyright.txt' in the top level directory for details.
+
+#pragma once
+#ifndef KERNEL_SOLVER_GATHER_DIRECT_SOLVER_HPP
+#define KERNEL_SOLVER_GATHER_DIRECT_SOLVER_HPP 1
+
+// includes, FEAT
+#include <kernel/base_header.hpp>
+#include <kernel/solver/adp_solver_base.hpp>
+#include <kernel/lafem/sparse_matrix_csr.hpp>
+#include <kernel/lafem/dense_vector.hpp>
+#include <kernel/lafem/none_filter.hpp>
+#include <kernel/util/dist.hpp>
+
+#ifdef FEAT_HAVE_UMFPACK
+#include <kernel/solver/umfpack.hpp>
+#endif
+
+// includes, system
+#include <type_traits>
+#include <vector>
+
+namespace FEAT
+{
+  namespace Solver
+  {
+    /**
+     * \brief Agglomerating direct coarse-grid solver
+     *
+     * This class implements a direct solver for distributed global systems, which gathers the
+     * algebraic DOF partitioned system matrix onto a (small) subset of the processes, the so-called
+     * \e root processes, factorizes the gathered matrix on each root process by a local direct
+     * solver and scatters the solution back to all processes. This is the typical strategy for the
+     * coarse-grid solver of a parallel multigrid, where the coarse system is too small to be solved
+     * efficiently by all processes but too large to be solved redundantly by each process.
+     *
+     * The processes of the communicator are split into \e num_roots contiguous groups, where the
+     * first process of each group acts as its root process. In each apply() call, the defect vector
+     * is gathered by each group root, the group vectors are exchanged among all root processes,
+     * each root process solves the full system and finally scatters the solution within its group.
+     *
+     * The matrix structure is gathered in init_symbolic(), which also performs the symbolic
+     * factorization on the root processes, whereas init_numeric() only gathers the matrix values
+     * and performs the numeric factorization, so the symbolic factorization is reused as long as
+     * only the matrix values change.
+     *
+     * By default, the root processes use the Umfpack solver, which is only available if FEAT is
+     * configured and linked against the \c UMFPACK third-party library and if the data- and
+     * index-types are \c double and \c Index. Alternatively, any other root solver operating on the
+     * gathered matrix returned by get_root_matrix() can be set by the set_root_solver() function.
+     *
+     * \tparam Matrix_
+     * The global system matrix type; must be a Global::Matrix with a LAFEM::SparseMatrixCSR.
+     *
+     * \tparam Filter_
+     * The global system filter type.
+     */
+    template<typename Matrix_, typename Filter_>
+    class GatherDirectSolver :
+      public ADPSolverBase<Matrix_, Filter_>
+    {
+    public:
+      /// our base class
+      typedef ADPSolverBase<Matrix_, Filter_> BaseClass;
+      /// our vector type
+      typedef typename Matrix_::VectorTypeL VectorType;
+      /// our data type
+      typedef typename BaseClass::DataType DataType;
+      /// our index type
+      typedef typename BaseClass::IndexType IndexType;
+
+      /// the gathered matrix type on the root processes
+      typedef LAFEM::SparseMatrixCSR<DataType, IndexType> RootMatrixType;
+      /// the gathered vector type on the root processes
+      typedef LAFEM::DenseVector<DataType, IndexType> RootVectorType;
+      /// the filter type on the root processes
+      typedef LAFEM::NoneFilter<DataType, IndexType> RootFilterType;
+      /// the solver type on the root processes
+      typedef SolverBase<RootVectorType> RootSolverType;
+
+    protected:
+      /// the desired number of root processes
+      int _num_roots;
+      /// the communicator of our process group
+      Dist::Comm _comm_group;
+      /// the communicator of all root processes; null comm on non-root processes
+      Dist::Comm _comm_roots;
+      /// row counts and offsets of all group members; only used on group roots
+      std::vector<int> _group_row_counts, _group_row_displs;
+      /// non-zero counts and offsets of all group members; only used on group roots
+      std::vector<int> _group_nze_counts, _group_nze_displs;
+      /// row counts and offsets of all groups; only used on group roots
+      std::vector<int> _root_row_counts, _root_row_displs;
+      /// non-zero counts and offsets of all groups; only used on group roots
+      std::vector<int> _root_nze_counts, _root_nze_displs;
+      /// gathered group buffers for matrix values and vectors; only used on group roots
+      std::vector<DataType> _group_vals, _group_vec;
+      /// the gathered matrix; only used on group roots
+      RootMatrixType _root_matrix;
+      /// the gathered defect and correction vectors; only used on group roots
+      RootVectorType _root_vec_def, _root_vec_cor;
+      /// the root filter
+      RootFilterType _root_filter;
+      /// the root solver; only used on group roots
+      std::shared_ptr<RootSolverType> _root_solver;
+
+    public:
+      /**
+       * \brief Constructor
+       *
+       * \param[in] matrix
+       * The global system matrix.
+       *
+       * \param[in] filter
+       * The global system filter.
+       *
+       * \param[in] num_roots
+       * The desired number of root processes that solve the gathered system. Is truncated to the
+       * number of processes in the communicator. Must be > 0.
+       */
+      explicit GatherDirectSolver(const Matrix_& matrix, const Filter_& filter, int num_roots = 1) :
+        BaseClass(matrix, filter),
+        _num_roots(num_roots)
+      {
+        XASSERTM(num_roots > 0, "number of root processes must be > 0");
+      }
+
+      virtual String name() const override
+      {
+        return "GatherDirectSolver";
+      }
+
+      /**
+       * \brief Sets the solver for the gathered system on the root processes
+       *
+       * The root solver must operate on the matrix returned by get_root_matrix() and it must be
+       * set before init_symbolic() is called. If no root solver is set, a Umfpack solver is used.
+       * This function has no effect on processes which are not root processes after the symbolic
+       * initialization, so it is safe to call this function on all processes.
+       *
+       * \param[in] root_solver
+       * The solver for the gathered system.
+       */
+      void set_root_solver(std::shared_ptr<RootSolverType> root_solver)
+      {
+        _root_solver = root_solver;
+      }
+
+      /// \returns A reference to the gathered matrix; only meaningful on root processes
+      const RootMatrixType& get_root_matrix() const
+      {
+        return _root_matrix;
+      }
+
+      /// \returns A reference to the root filter
+      const RootFilterType& get_root_filter() const
+      {
+        return _root_filter;
+      }
+
+      /// \returns \c true, if this process is a root process, otherwise \c false
+      bool is_root() const
+      {
+        return _comm_group.rank() == 0;
+      }
+
+      virtual void init_symbolic() override
+      {
+        BaseClass::init_symbolic();
+
+        const Dist::Comm& comm = *this->_get_comm();
+        const int num_procs = comm.size();
+        const int my_rank = comm.rank();
+        const int num_roots = Math::min(_num_roots, num_procs);
+
+        // compute the ranks of all root processes; group g consists of ranks [root_ranks[g], root_ranks[g+1])
+        std::vector<int> root_ranks(std::size_t(num_roots+1));
+        for(int g(0); g <= num_roots; ++g)
+          root_ranks[std::size_t(g)] = (g * num_procs) / num_roots;
+
+        // find our group
+        int my_group(0);
+        while(root_ranks[std::size_t(my_group+1)] <= my_rank)
+          ++my_group;
+
+        // create group and root communicators
+        _comm_group = comm.comm_split(my_group, my_rank);
+        _comm_roots = comm.comm_create_incl(num_roots, root_ranks.data());
+
+        const Index num_owned_dofs = this->_get_num_owned_dofs();
+        const IndexType* row_ptr = this->_get_mat_row_ptr();
+        const IndexType* col_idx = this->_get_mat_col_idx();
+
+        // gather row and non-zero counts on group root
+        const int group_size = _comm_group.size();
+        int my_counts[2] = {int(num_owned_dofs), int(this->_get_mat_num_nze())};
+        std::vector<int> group_counts(is_root() ? std::size_t(2*group_size) : std::size_t(0));
+        _comm_group.gather(my_counts, std::size_t(2), group_counts.data(), std::size_t(2), 0);
+
+        // compute row lengths of our owned rows
+        std::vector<IndexType> row_len(num_owned_dofs);
+        for(Index i(0); i < num_owned_dofs; ++i)
+          row_len[i] = row_ptr[i+1] - row_ptr[i];
+
+        if(!is_root())
+        {
+          // send our structure to our group root
+          _comm_group.send(row_len.data(), row_len.size(), 0);
+          _comm_group.send(col_idx, std::size_t(my_counts[1]), 0);
+          _root_solver.reset();
+          return;
+        }
+
+        // compute group counts and displacements
+        _group_row_counts.resize(std::size_t(group_size));
+        _group_nze_counts.resize(std::size_t(group_size));
+        for(int i(0); i < group_size; ++i)
+        {
+          _group_row_counts[std::size_t(i)] = group_counts[std::size_t(2*i+0)];
+          _group_nze_counts[std::size_t(i)] = group_counts[std::size_t(2*i+1)];
+        }
+        const int group_rows = _build_displs(_group_row_displs, _group_row_counts);
+        const int group_nzes = _build_displs(_group_nze_displs, _group_nze_counts);
+
+        // gather group structure
+        std::vector<IndexType> group_row_len, group_col_idx;
+        group_row_len.resize(std::size_t(group_rows));
+        group_col_idx.resize(std::size_t(group_nzes));
+        _gather_group(row_len.data(), group_row_len.data(), _group_row_counts, _group_row_displs);
+        _gather_group(col_idx, group_col_idx.data(), _group_nze_counts, _group_nze_displs);
+
+        // exchange group counts among all roots
+        const int num_groups = _comm_roots.size();
+        int grp_counts[2] = {group_rows, group_nzes};
+        std::vector<int> root_counts(std::size_t(2*num_groups));
+        _comm_roots.allgather(grp_counts, std::size_t(2), root_counts.data(), std::size_t(2));
+        _root_row_counts.resize(std::size_t(num_groups));
+        _root_nze_counts.resize(std::size_t(num_groups));
+        for(int i(0); i < num_groups; ++i)
+        {
+          _root_row_counts[std::size_t(i)] = root_counts[std::size_t(2*i+0)];
+          _root_nze_counts[std::size_t(i)] = root_counts[std::size_t(2*i+1)];
+        }
+        const int total_rows = _build_displs(_root_row_displs, _root_row_counts);
+        const int total_nzes = _build_displs(_root_nze_displs, _root_nze_counts);
+        XASSERT(Index(total_rows) == this->_get_num_global_dofs());
+
+        // allocate root matrix and exchange structure among roots
+        _root_matrix = RootMatrixType(Index(total_rows), Index(total_rows), Index(total_nzes));
+        IndexType* root_row_ptr = _root_matrix.row_ptr();
+        _comm_roots.allgatherv(group_row_len.data(), group_row_len.size(), &root_row_ptr[1],
+          _root_row_counts.data(), _root_row_displs.data());
+        _comm_roots.allgatherv(group_col_idx.data(), group_col_idx.size(), _root_matrix.col_ind(),
+          _root_nze_counts.data(), _root_nze_displs.data());
+
+        // convert row lengths to row pointer
+        root_row_ptr[0] = IndexType(0);
+        for(int i(0); i < total_rows; ++i)
+          root_row_ptr[i+1] += root_row_ptr[i];
+        _root_matrix.format();
+
+        // allocate buffers
+        _group_vals.resize(std::size_t(group_nzes));
+        _group_vec.resize(std::size_t(group_rows));
+        _root_vec_def = _root_matrix.create_vector_r();
+        _root_vec_cor = _root_matrix.create_vector_r();
+
+        // create default root solver if necessary
+        if(!_root_solver)
+          _root_solver = _create_default_root_solver();
+
+        // perform symbolic factorization
+        _root_solver->init_symbolic();
+      }
+
+      virtual void done_symbolic() override
+      {
+        if(_root_solver && is_root())
+          _root_solver->done_symbolic();
+
+        _root_vec_cor.clear();
+        _root_vec_def.clear();
+        _root_matrix.clear();
+        _group_vec.clear();
+        _group_vals.clear();
+        _root_nze_displs.clear();
+        _root_nze_counts.clear();
+        _root_row_displs.clear();
+        _root_row_counts.clear();
+        _group_nze_displs.clear();
+        _group_nze_counts.clear();
+        _group_row_displs.clear();
+        _group_row_counts.clear();
+        {
+          // move the communicators out to free them, as a non-null comm must not be assigned to
+          Dist::Comm comm_roots(std::move(_comm_roots));
+          Dist::Comm comm_group(std::move(_comm_group));
+        }
+
+        BaseClass::done_symbolic();
+      }
+
+      virtual void init_numeric() override
+      {
+        BaseClass::init_numeric();
+
+        const DataType* vals = this->_get_mat_vals();
+
+        if(!is_root())
+        {
+          // send our matrix values to our group root
+          _comm_group.send(vals, std::size_t(this->_get_mat_num_nze()), 0);
+          return;
+        }
+
+        // gather group values and exchange among roots
+        _gather_group(vals, _group_vals.data(), _group_nze_counts, _group_nze_displs);
+        _comm_roots.allgatherv(_group_vals.data(), _group_vals.size(), _root_matrix.val(),
+          _root_nze_counts.data(), _root_nze_displs.data());
+
+        // perform numeric factorization
+        _root_solver->init_numeric();
+      }
+
+      virtual void done_numeric() override
+      {
+        if(_root_solver && is_root())
+          _root_solver->done_numeric();
+
+        BaseClass::done_numeric();
+      }
+
+      virtual Status apply(VectorType& vec_cor, const VectorType& vec_def) override
+      {
+        // upload defect vector
+        this->_upload_vec_def(vec_def);
+
+        const DataType* def_vals = this->_get_vec_def_vals(vec_def);
+        DataType* cor_vals = this->_get_vec_cor_vals(vec_cor);
+        const std::size_t num_owned_dofs = std::size_t(this->_get_num_owned_dofs());
+
+        Status status(Status::success);
+        if(!is_root())
+        {
+          // send defect to group root and receive correction
+          _comm_group.send(def_vals, num_owned_dofs, 0);
+          _comm_group.recv(cor_vals, num_owned_dofs, 0);
+        }
+        else
+        {
+          // gather defect and exchange among roots
+          _gather_group(def_vals, _group_vec.data(), _group_row_counts, _group_row_displs);
+          _comm_roots.allgatherv(_group_vec.data(), _group_vec.size(), _root_vec_def.elements(),
+            _root_row_counts.data(), _root_row_displs.data());
+
+          // solve gathered system
+          status = _root_solver->apply(_root_vec_cor, _root_vec_def);
+
+          // scatter correction within our group
+          const int group = _comm_roots.rank();
+          const DataType* root_cor = &_root_vec_cor.elements()[_root_row_displs[std::size_t(group)]];
+          _scatter_group(root_cor, cor_vals, _group_row_counts, _group_row_displs);
+        }
+
+        // all processes of a group must agree on the status
+        int istat = int(status);
+        _comm_group.bcast(&istat, std::size_t(1), 0);
+        status = Status(istat);
+
+        // download correction vector and apply filter
+        this->_download_vec_cor(vec_cor);
+        this->_system_filter.filter_cor(vec_cor);
+
+        return status;
+      }
+
+    protected:
+      /// creates the default root solver
+      std::shared_ptr<RootSolverType> _create_default_root_solver() const
+      {
+#ifdef FEAT_HAVE_UMFPACK
+        if constexpr(std::is_same<DataType, double>::value && std::is_same<IndexType, Index>::value)
+        {
+          return new_umfpack(_root_matrix);
+        }
+#endif
+        XABORTM("GatherDirectSolver: no root solver given and no default root solver available");
+        return nullptr;
+      }
+
+      /// computes the displacements of a count vector and returns the total count
+      static int _build_displs(std::vector<int>& displs, const std::vector<int>& counts)
+      {
+        displs.resize(counts.size());
+        int n(0);
+        for(std::size_t i(0); i < counts.size(); ++i)
+        {
+          displs[i] = n;
+          n += counts[i];
+        }
+        return n;
+      }
+
+      /// gathers an array on the group root; the other members use a matching send
+      template<typename T_>
+      void _gather_group(const T_* sbuf, T_* rbuf, const std::vector<int>& counts, const std::vector<int>& displs) const
+      {
+        Dist::RequestVector reqs;
+        for(std::size_t i(1); i < counts.size(); ++i)
+          reqs.push_back(_comm_group.irecv(&rbuf[displs[i]], std::size_t(counts[i]), int(i)));
+        for(int k(0); k < counts.front(); ++k)
+          rbuf[k] = sbuf[k];
+        reqs.wait_all();
+      }
+
+      /// scatters an array from the group root; the other members use a matching recv
+      template<typename T_>
+      void _scatter_group(const T_* sbuf, T_* rbuf, const std::vector<int>& counts, const std::vector<int>& displs) const
+      {
+        Dist::RequestVector reqs;
+        for(std::size_t i(1); i < counts.size(); ++i)
+          reqs.push_back(_comm_group.isend(&sbuf[displs[i]], std::size_t(counts[i]), int(i)));
+        for(int k(0); k < counts.front(); ++k)
+          rbuf[k] = sbuf[k];
+        reqs.wait_all();
+      }
+    }; // class GatherDirectSolver
+
+    /**
+     * \brief Creates a new GatherDirectSolver object
+     *
+     * \param[in] matrix
+     * The global system matrix
+     *
+     * \param[in] filter
+     * The global system filter
+     *
+     * \param[in] num_roots
+     * The desired number of root processes
+     *
+     * \returns
+     * A shared pointer to a new GatherDirectSolver object.
+     */
+    template<typename Matrix_, typename Filter_>
+    std::shared_ptr<GatherDirectSolver<Matrix_, Filter_>> new_gather_direct_solver(
+      const Matrix_& matrix, const Filter_& filter, int num_roots = 1)
+    {
+      return std::make_shared<GatherDirectSolver<Matrix_, Filter_>>(matrix, filter, num_roots);
+    }
+  } // namespace Solver
+} // namespace FEAT
+
+#endif // KERNEL_SOLVER_GATHER_DIRECT_SOLVER_HPP
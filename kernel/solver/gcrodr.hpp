@@ -0,0 +1,800 @@
+// FEAT3: Finite Element Analysis Toolbox, Version 3
+// Copyright (C) 2010 - 2023 by Stefan Turek & the FEAT group
+// FEAT3 is released under the GNU General Public License version 3,
+// see the file 'copyright.txt' in the top level directory for details.
+
+#pragma once
+#ifndef KERNEL_SOLVER_GCRODR_HPP
+#define KERNEL_SOLVER_GCRODR_HPP 1
+
+// includes, FEAT
+#include <kernel/solver/iterative.hpp>
+
+// includes, system
+#include <algorithm>
+#include <vector>
+
+namespace FEAT
+{
+  namespace Solver
+  {
+    /**
+     * \brief GCRO-DR(m,k) solver implementation
+     *
+     * This class implements the flexible Generalized Conjugate Residual method with inner
+     * Orthogonalization and Deflated Restarting (GCRO-DR(m,k)), which is a restarted minimal
+     * residual Krylov solver that carries a recycle subspace U of dimension k from one restart
+     * cycle to the next one and, most importantly, from one call of apply() or correct() to
+     * the next one. This makes the solver attractive for sequences of slowly varying linear
+     * systems, as they arise e.g. in the Newton or Picard iterations and time steps of
+     * nonlinear unsteady simulations.
+     *
+     * Each restart cycle performs the following steps:
+     * - orthogonalize the current defect against C := A*U and update the solution accordingly
+     * - perform m-k steps of flexible Arnoldi for the operator (I - C*C^T)*A*M^{-1}
+     * - update the solution by minimizing the defect over span(U) + span(M^{-1}*V)
+     * - replace the recycle subspace by k vectors of span(U) + span(M^{-1}*V), which approximate
+     *   the right singular vectors of A corresponding to the k smallest singular values
+     *
+     * The original algorithm by Parks et al. chooses the recycle space by harmonic Ritz vectors,
+     * which may be complex-valued for non-symmetric matrices. This implementation chooses the
+     * approximate singular vectors instead, which are always real and also deflate the slowly
+     * converging components for non-normal matrices, such as Oseen systems.
+     *
+     * Since the system matrix may have changed since the last call (e.g. in the next Newton
+     * step), the basis C := A*U is recomputed at the beginning of each apply() or correct()
+     * call, which requires k additional matrix-vector products. The recycle space can be
+     * discarded explicitly by calling reset_recycle(); it is also discarded by done_symbolic().
+     *
+     * \see
+     * M.L. Parks, E. de Sturler, G. Mackey, D.D. Johnson, S. Maiti: Recycling Krylov Subspaces
+     * for Sequences of Linear Systems; SIAM Journal on Scientific Computing, Volume 28 Issue 5,
+     * pp. 1651-1674, 2006
+     *
+     * \tparam Matrix_
+     * The matrix class to be used by the solver.
+     *
+     * \tparam Filter_
+     * The filter class to be used by the solver.
+     */
+    template<
+      typename Matrix_,
+      typename Filter_>
+    class GCRODR :
+      public PreconditionedIterativeSolver<typename Matrix_::VectorTypeR>
+    {
+    public:
+      typedef Matrix_ MatrixType;
+      typedef Filter_ FilterType;
+      typedef typename MatrixType::VectorTypeR VectorType;
+      typedef typename MatrixType::DataType DataType;
+      typedef PreconditionedIterativeSolver<VectorType> BaseClass;
+
+      typedef SolverBase<VectorType> PrecondType;
+
+    protected:
+      /// the matrix for the solver
+      const MatrixType& _system_matrix;
+      /// the filter for the solver
+      const FilterType& _system_filter;
+      /// krylov dimension m
+      Index _krylov_dim;
+      /// recycle dimension k
+      Index _recycle_dim;
+      /// current number of recycle vectors
+      Index _num_recycle;
+      /// krylov basis vectors
+      std::vector<VectorType> _vec_v, _vec_z;
+      /// recycle space vectors U and C = A*U and their temporary counterparts
+      std::vector<VectorType> _vec_u, _vec_c, _vec_u2, _vec_c2;
+      /// Givens rotation coefficients
+      std::vector<DataType> _c, _s, _q;
+      /// Hessenberg matrix (rotated and unrotated) and recycle projection matrix B = C^T*A*Z
+      std::vector<std::vector<DataType>> _h, _hr, _b;
+
+    public:
+      /**
+       * \brief Constructor
+       *
+       * \param[in] matrix
+       * A reference to the system matrix.
+       *
+       * \param[in] filter
+       * A reference to the system filter.
+       *
+       * \param[in] krylov_dim
+       * The maximum Krylov subspace dimension m including the recycle space. Must be > recycle_dim.
+       *
+       * \param[in] recycle_dim
+       * The dimension k of the recycle subspace. May be 0, in which case the solver
+       * degenerates to FGMRES(m).
+       *
+       * \param[in] precond
+       * A pointer to the preconditioner. May be \c nullptr.
+       */
+      explicit GCRODR(const MatrixType& matrix, const FilterType& filter, Index krylov_dim,
+        Index recycle_dim, std::shared_ptr<PrecondType> precond = nullptr) :
+        BaseClass("GCRODR(" + stringify(krylov_dim) + "," + stringify(recycle_dim) + ")", precond),
+        _system_matrix(matrix),
+        _system_filter(filter),
+        _krylov_dim(krylov_dim),
+        _recycle_dim(recycle_dim),
+        _num_recycle(0)
+      {
+        XASSERTM(recycle_dim < krylov_dim, "recycle dimension must be less than Krylov dimension");
+        // set communicator by system matrix
+        this->_set_comm_by_matrix(matrix);
+      }
+
+      explicit GCRODR(const String& section_name, PropertyMap* section,
+        const MatrixType& matrix, const FilterType& filter, std::shared_ptr<PrecondType> precond = nullptr) :
+        BaseClass("GCRODR", section_name, section, precond),
+        _system_matrix(matrix),
+        _system_filter(filter),
+        _num_recycle(0)
+      {
+        // set communicator by system matrix
+        this->_set_comm_by_matrix(matrix);
+
+        // Check if we have set _krylov_dim
+        auto krylov_dim_p = section->query("krylov_dim");
+        if(!krylov_dim_p.second)
+          throw ParseError("GCRODR config section is missing the mandatory krylov_dim!");
+
+        if(!krylov_dim_p.first.parse(this->_krylov_dim) || (this->_krylov_dim <= Index(0)))
+          throw ParseError(section_name + ".krylov_dim", krylov_dim_p.first, "a positive integer");
+
+        // Check if we have set _recycle_dim
+        auto recycle_dim_p = section->query("recycle_dim");
+        if(!recycle_dim_p.second)
+          throw ParseError("GCRODR config section is missing the mandatory recycle_dim!");
+
+        if(!recycle_dim_p.first.parse(this->_recycle_dim) || (this->_recycle_dim >= this->_krylov_dim))
+          throw ParseError(section_name + ".recycle_dim", recycle_dim_p.first, "a non-negative integer less than krylov_dim");
+
+        this->set_plot_name("GCRODR("+stringify(_krylov_dim)+","+stringify(_recycle_dim)+")");
+      }
+
+      /**
+       * \brief Empty virtual destructor
+       */
+      virtual ~GCRODR()
+      {
+      }
+
+      /// \copydoc BaseClass::name()
+      virtual String name() const override
+      {
+        return "GCRODR";
+      }
+
+      virtual void init_symbolic() override
+      {
+        BaseClass::init_symbolic();
+
+        _c.reserve(_krylov_dim);
+        _s.reserve(_krylov_dim);
+        _q.reserve(_krylov_dim+1);
+        _h.resize(_krylov_dim);
+        _hr.resize(_krylov_dim);
+        _b.resize(_recycle_dim);
+
+        for(Index i(0); i < _krylov_dim; ++i)
+        {
+          _h.at(i).resize(i+2);
+          _hr.at(i).resize(i+1);
+        }
+        for(Index i(0); i < _recycle_dim; ++i)
+        {
+          _b.at(i).resize(_krylov_dim);
+        }
+
+        _vec_v.push_back(this->_system_matrix.create_vector_r());
+        for(Index i(0); i < _krylov_dim; ++i)
+        {
+          _vec_v.push_back(this->_vec_v.front().clone(LAFEM::CloneMode::Layout));
+          _vec_z.push_back(this->_vec_v.front().clone(LAFEM::CloneMode::Layout));
+        }
+        for(Index i(0); i < _recycle_dim; ++i)
+        {
+          _vec_u.push_back(this->_vec_v.front().clone(LAFEM::CloneMode::Layout));
+          _vec_c.push_back(this->_vec_v.front().clone(LAFEM::CloneMode::Layout));
+          _vec_u2.push_back(this->_vec_v.front().clone(LAFEM::CloneMode::Layout));
+          _vec_c2.push_back(this->_vec_v.front().clone(LAFEM::CloneMode::Layout));
+        }
+        _num_recycle = Index(0);
+      }
+
+      virtual void done_symbolic() override
+      {
+        _num_recycle = Index(0);
+        _vec_c2.clear();
+        _vec_u2.clear();
+        _vec_c.clear();
+        _vec_u.clear();
+        _vec_z.clear();
+        _vec_v.clear();
+        BaseClass::done_symbolic();
+      }
+
+      /**
+       * \brief Discards the recycle subspace
+       *
+       * The next call of apply() or correct() will start without any recycled information.
+       */
+      void reset_recycle()
+      {
+        _num_recycle = Index(0);
+      }
+
+      /// \returns The current dimension of the recycle subspace
+      Index get_num_recycle() const
+      {
+        return _num_recycle;
+      }
+
+      /**
+       * \brief Sets the Krylov and recycle space dimensions
+       *
+       * \note This function must not be called between init_symbolic() and done_symbolic().
+       *
+       * \param[in] krylov_dim
+       * The maximum Krylov subspace dimension m including the recycle space.
+       *
+       * \param[in] recycle_dim
+       * The dimension k of the recycle subspace. Must be < krylov_dim.
+       */
+      virtual void set_dimensions(Index krylov_dim, Index recycle_dim)
+      {
+        XASSERT(_vec_v.empty());
+        XASSERTM(recycle_dim < krylov_dim, "recycle dimension must be less than Krylov dimension");
+        _krylov_dim = krylov_dim;
+        _recycle_dim = recycle_dim;
+      }
+
+      /// \copydoc IterativeSolver::apply()
+      virtual Status apply(VectorType& vec_sol, const VectorType& vec_rhs) override
+      {
+        // save input rhs vector as initial defect
+        this->_vec_v.at(0).copy(vec_rhs);
+
+        // clear solution vector
+        vec_sol.format();
+
+        // apply
+        this->_status = _apply_intern(vec_sol, vec_rhs);
+        this->plot_summary();
+        return this->_status;
+      }
+
+      /// \copydoc SolverBase::correct()
+      virtual Status correct(VectorType& vec_sol, const VectorType& vec_rhs) override
+      {
+        // compute initial defect
+        this->_system_matrix.apply(this->_vec_v.at(0), vec_sol, vec_rhs, -DataType(1));
+        this->_system_filter.filter_def(this->_vec_v.at(0));
+
+        // apply
+        this->_status = _apply_intern(vec_sol, vec_rhs);
+        this->plot_summary();
+        return this->_status;
+      }
+
+    protected:
+      virtual Status _apply_intern(VectorType& vec_sol, const VectorType& vec_rhs)
+      {
+        IterationStats pre_iter(*this);
+        Statistics::add_solver_expression<ExpressionStartSolve>(*this);
+        const MatrixType& matrix(this->_system_matrix);
+        const FilterType& filter(this->_system_filter);
+
+        // compute initial defect
+        Status status = this->_set_initial_defect(this->_vec_v.at(0), vec_sol);
+
+        // recompute C := A*U for the current matrix
+        if((status == Status::progress) && (_num_recycle > Index(0)))
+          _setup_recycle();
+
+        pre_iter.destroy();
+
+        // outer GCRO-DR loop
+        while(status == Status::progress)
+        {
+          IterationStats stat(*this);
+
+          const Index nr = _num_recycle;
+
+          // project defect onto complement of range(C): x += U*C^T*r, r -= C*C^T*r
+          if(nr > Index(0))
+          {
+            for(Index i(0); i < nr; ++i)
+            {
+              const DataType alpha = this->_vec_c.at(i).dot(this->_vec_v.at(0));
+              vec_sol.axpy(this->_vec_u.at(i), vec_sol, alpha);
+              this->_vec_v.at(0).axpy(this->_vec_c.at(i), this->_vec_v.at(0), -alpha);
+            }
+            this->_def_cur = this->_calc_def_norm(this->_vec_v.at(0), vec_sol);
+            status = this->_analyse_defect(this->_num_iter, this->_def_cur, this->_def_cur, false);
+            if(status != Status::progress)
+              break;
+          }
+
+          _q.clear();
+          _s.clear();
+          _c.clear();
+          _q.push_back(this->_def_cur);
+
+          // normalize v[0]
+          this->_vec_v.at(0).scale(this->_vec_v.at(0), DataType(1) / _q.back());
+
+          // inner Arnoldi loop
+          const Index ns = this->_krylov_dim - nr;
+          Status inner_status = Status::progress;
+          Index j(0);
+          while(j < ns)
+          {
+            // apply preconditioner
+            if(!this->_apply_precond(this->_vec_z.at(j), this->_vec_v.at(j), filter))
+            {
+              stat.destroy();
+              Statistics::add_solver_expression<ExpressionEndSolve>(*this, Status::aborted, this->get_num_iter());
+              return Status::aborted;
+            }
+
+            // v[j+1] := A*z[j]
+            VectorType& vec_w = this->_vec_v.at(j+1);
+            matrix.apply(vec_w, this->_vec_z.at(j));
+            filter.filter_def(vec_w);
+
+            // orthogonalize against the recycle space
+            for(Index i(0); i < nr; ++i)
+            {
+              this->_b.at(i).at(j) = vec_w.dot(this->_vec_c.at(i));
+              vec_w.axpy(this->_vec_c.at(i), vec_w, -this->_b.at(i).at(j));
+            }
+
+            // Gram-Schmidt process
+            for(Index k(0); k <= j; ++k)
+            {
+              this->_h.at(j).at(k) = vec_w.dot(this->_vec_v.at(k));
+              vec_w.axpy(this->_vec_v.at(k), vec_w, -this->_h.at(j).at(k));
+            }
+
+            // normalize v[j+1]
+            DataType alpha = vec_w.norm2();
+            this->_h.at(j).at(j+1) = alpha;
+            if(alpha > DataType(0))
+              vec_w.scale(vec_w, DataType(1) / alpha);
+
+            // apply Givens rotations to a copy of the Hessenberg column
+            for(Index k(0); k <= j; ++k)
+              this->_hr.at(j).at(k) = this->_h.at(j).at(k);
+            for(Index k(0); k < j; ++k)
+            {
+              DataType t(this->_hr.at(j).at(k));
+              this->_hr.at(j).at(k  ) = this->_c.at(k) * t + this->_s.at(k) * this->_hr.at(j).at(k+1);
+              this->_hr.at(j).at(k+1) = this->_s.at(k) * t - this->_c.at(k) * this->_hr.at(j).at(k+1);
+            }
+
+            // compute beta
+            DataType beta = Math::sqrt(Math::sqr(this->_hr.at(j).at(j)) + Math::sqr(alpha));
+
+            // compute next plane rotation
+            _s.push_back(alpha / beta);
+            _c.push_back(this->_hr.at(j).at(j) / beta);
+
+            this->_hr.at(j).at(j) = beta;
+            this->_q.push_back(this->_s.back() * this->_q.at(j));
+            this->_q.at(j) *= this->_c.back();
+
+            ++j;
+
+            // the pseudo defect is the real defect for right preconditioning
+            inner_status = this->_update_defect(Math::abs(this->_q.back()));
+            if(inner_status != Status::progress)
+              break;
+          }
+
+          const Index n = j;
+
+          // solve H*y = q
+          std::vector<DataType> vy(this->_q.begin(), this->_q.begin() + std::ptrdiff_t(n));
+          for(Index k(n); k > 0;)
+          {
+            --k;
+            vy.at(k) /= this->_hr.at(k).at(k);
+            for(Index i(k); i > 0;)
+            {
+              --i;
+              vy.at(i) -= this->_hr.at(k).at(i) * vy.at(k);
+            }
+          }
+
+          // update solution: x += (Z - U*B)*y
+          for(Index k(0); k < n; ++k)
+            vec_sol.axpy(this->_vec_z.at(k), vec_sol, vy.at(k));
+          for(Index i(0); i < nr; ++i)
+          {
+            DataType by(0);
+            for(Index k(0); k < n; ++k)
+              by += this->_b.at(i).at(k) * vy.at(k);
+            vec_sol.axpy(this->_vec_u.at(i), vec_sol, -by);
+          }
+
+          // update the recycle space; this requires the basis V, so it must be done before
+          // the real defect is computed
+          if(this->_recycle_dim > Index(0))
+            _update_recycle(n);
+
+          // compute "real" residual
+          matrix.apply(this->_vec_v.at(0), vec_sol, vec_rhs, -DataType(1));
+          filter.filter_def(this->_vec_v.at(0));
+
+          // analyse the real defect
+          this->_def_cur = this->_calc_def_norm(this->_vec_v.at(0), vec_sol);
+          status = this->_analyse_defect(this->_num_iter, this->_def_cur, this->_def_prev, false);
+          if((status == Status::progress) && (inner_status == Status::stagnated))
+            status = Status::stagnated;
+        }
+
+        // finished
+        Statistics::add_solver_expression<ExpressionEndSolve>(*this, status, this->get_num_iter());
+        return status;
+      }
+
+      /**
+       * \brief Orthonormalizes the columns of C and applies the same transformation to U
+       *
+       * Columns which are numerically linearly dependent are dropped.
+       *
+       * \param[in,out] vec_c, vec_u
+       * The basis vectors of C and U.
+       *
+       * \param[in] num
+       * The number of basis vectors.
+       *
+       * \returns The number of remaining basis vectors.
+       */
+      static Index _orthonormalize(std::vector<VectorType>& vec_c, std::vector<VectorType>& vec_u, Index num)
+      {
+        Index nk(0);
+        for(Index j(0); j < num; ++j)
+        {
+          DataType norm_0 = vec_c.at(j).norm2();
+          for(Index i(0); i < nk; ++i)
+          {
+            const DataType r = vec_c.at(j).dot(vec_c.at(i));
+            vec_c.at(j).axpy(vec_c.at(i), vec_c.at(j), -r);
+            vec_u.at(j).axpy(vec_u.at(i), vec_u.at(j), -r);
+          }
+          DataType norm_1 = vec_c.at(j).norm2();
+          if(!(norm_1 > Math::sqrt(Math::eps<DataType>()) * norm_0))
+            continue;
+          if(nk < j)
+          {
+            vec_c.at(nk).copy(vec_c.at(j));
+            vec_u.at(nk).copy(vec_u.at(j));
+          }
+          vec_c.at(nk).scale(vec_c.at(nk), DataType(1) / norm_1);
+          vec_u.at(nk).scale(vec_u.at(nk), DataType(1) / norm_1);
+          ++nk;
+        }
+        return nk;
+      }
+
+      /// recomputes C := A*U for the current matrix and re-orthonormalizes the recycle space
+      void _setup_recycle()
+      {
+        for(Index i(0); i < _num_recycle; ++i)
+        {
+          this->_system_matrix.apply(this->_vec_c.at(i), this->_vec_u.at(i));
+          this->_system_filter.filter_def(this->_vec_c.at(i));
+        }
+        _num_recycle = _orthonormalize(this->_vec_c, this->_vec_u, _num_recycle);
+      }
+
+      /**
+       * \brief Computes the eigenvalues and eigenvectors of a small dense symmetric matrix
+       *
+       * This function uses the cyclic Jacobi method.
+       *
+       * \param[in] n
+       * The dimension of the matrix.
+       *
+       * \param[in,out] a
+       * The row-major n x n matrix. On exit, its diagonal contains the eigenvalues.
+       *
+       * \param[out] q
+       * Receives the row-major n x n matrix whose columns are the eigenvectors.
+       */
+      static void _sym_eigen(Index n, std::vector<DataType>& a, std::vector<DataType>& q)
+      {
+        q.assign(n*n, DataType(0));
+        for(Index i(0); i < n; ++i)
+          q[i*n+i] = DataType(1);
+
+        const DataType eps = Math::eps<DataType>();
+        for(int sweep(0); sweep < 50; ++sweep)
+        {
+          // compute off-diagonal norm
+          DataType off(0), dia(0);
+          for(Index i(0); i < n; ++i)
+          {
+            dia += Math::sqr(a[i*n+i]);
+            for(Index j(i+1); j < n; ++j)
+              off += Math::sqr(a[i*n+j]);
+          }
+          if(off <= eps * eps * dia)
+            break;
+
+          for(Index p(0); p+1 < n; ++p)
+          {
+            for(Index r(p+1); r < n; ++r)
+            {
+              const DataType apr = a[p*n+r];
+              if(Math::abs(apr) <= eps * eps * Math::sqrt(dia))
+                continue;
+
+              // compute the Jacobi rotation which annihilates a[p][r]
+              const DataType theta = (a[r*n+r] - a[p*n+p]) / (DataType(2) * apr);
+              const DataType t = (theta >= DataType(0) ? DataType(1) : -DataType(1)) /
+                (Math::abs(theta) + Math::sqrt(theta*theta + DataType(1)));
+              const DataType c = DataType(1) / Math::sqrt(t*t + DataType(1));
+              const DataType s = t * c;
+
+              // apply rotation to rows and columns p and r
+              for(Index k(0); k < n; ++k)
+              {
+                const DataType akp = a[k*n+p], akr = a[k*n+r];
+                a[k*n+p] = c*akp - s*akr;
+                a[k*n+r] = s*akp + c*akr;
+              }
+              for(Index k(0); k < n; ++k)
+              {
+                const DataType apk = a[p*n+k], ark = a[r*n+k];
+                a[p*n+k] = c*apk - s*ark;
+                a[r*n+k] = s*apk + c*ark;
+              }
+              for(Index k(0); k < n; ++k)
+              {
+                const DataType qkp = q[k*n+p], qkr = q[k*n+r];
+                q[k*n+p] = c*qkp - s*qkr;
+                q[k*n+r] = s*qkp + c*qkr;
+              }
+            }
+          }
+        }
+      }
+
+      /**
+       * \brief Updates the recycle space after a restart cycle
+       *
+       * With W := [U, Z - U*B] and Q := [C, V] we have A*W = Q*G with G := diag(I, H), where H is the
+       * (n+1) x n Hessenberg matrix of the last cycle. The new recycle space is spanned by the k
+       * vectors W*p, which minimize the Rayleigh quotient |G*p|^2 / |W*p|^2, i.e. by the solutions
+       * of the generalized eigenvalue problem G^T*G*p = lambda*W^T*W*p for the k smallest eigenvalues.
+       *
+       * \param[in] n
+       * The number of Arnoldi steps performed in the last cycle.
+       */
+      void _update_recycle(const Index n)
+      {
+        const Index nr = _num_recycle;
+        const Index nw = nr + n;
+        if(n == Index(0))
+          return;
+
+        // compute Z := Z - U*B
+        for(Index j(0); j < n; ++j)
+          for(Index i(0); i < nr; ++i)
+            this->_vec_z.at(j).axpy(this->_vec_u.at(i), this->_vec_z.at(j), -this->_b.at(i).at(j));
+
+        auto vec_w = [&](Index i) -> const VectorType& {return (i < nr ? this->_vec_u.at(i) : this->_vec_z.at(i - nr));};
+
+        // compute mass matrix M := W^T*W
+        std::vector<DataType> mass(nw*nw);
+        for(Index i(0); i < nw; ++i)
+          for(Index j(0); j <= i; ++j)
+            mass[i*nw+j] = vec_w(i).dot(vec_w(j));
+
+        // compute stiffness matrix K := G^T*G = diag(I, H^T*H)
+        std::vector<DataType> stiff(nw*nw, DataType(0));
+        for(Index i(0); i < nr; ++i)
+          stiff[i*nw+i] = DataType(1);
+        for(Index i(0); i < n; ++i)
+        {
+          for(Index j(0); j <= i; ++j)
+          {
+            DataType t(0);
+            for(Index l(0); l <= j+1; ++l)
+              t += this->_h.at(i).at(l) * this->_h.at(j).at(l);
+            stiff[(nr+i)*nw + nr+j] = stiff[(nr+j)*nw + nr+i] = t;
+          }
+        }
+
+        // factorize M = L*L^T; bail out if W is numerically rank deficient
+        if(!Math::factorize_cholesky(nw, nw, mass.data()))
+          return;
+        for(Index i(0); i < nw; ++i)
+          if(!(mass[i*nw+i] > Math::sqrt(Math::eps<DataType>()) * Math::sqrt(vec_w(i).norm2sqr())))
+            return;
+
+        // compute S := L^{-1} * K * L^{-T}
+        // first step: X := L^{-1} * K by forward substitution on the columns of K
+        for(Index i(0); i < nw; ++i)
+        {
+          for(Index l(0); l < i; ++l)
+            for(Index j(0); j < nw; ++j)
+              stiff[i*nw+j] -= mass[i*nw+l] * stiff[l*nw+j];
+          for(Index j(0); j < nw; ++j)
+            stiff[i*nw+j] /= mass[i*nw+i];
+        }
+        // second step: S := L^{-1} * X^T by forward substitution on the columns of X^T
+        std::vector<DataType> sym(nw*nw);
+        for(Index i(0); i < nw; ++i)
+          for(Index j(0); j < nw; ++j)
+            sym[i*nw+j] = stiff[j*nw+i];
+        for(Index i(0); i < nw; ++i)
+        {
+          for(Index l(0); l < i; ++l)
+            for(Index j(0); j < nw; ++j)
+              sym[i*nw+j] -= mass[i*nw+l] * sym[l*nw+j];
+          for(Index j(0); j < nw; ++j)
+            sym[i*nw+j] /= mass[i*nw+i];
+        }
+        // symmetrize to remove round-off
+        for(Index i(0); i < nw; ++i)
+          for(Index j(0); j < i; ++j)
+            sym[i*nw+j] = sym[j*nw+i] = DataType(0.5) * (sym[i*nw+j] + sym[j*nw+i]);
+
+        // solve the symmetric eigenvalue problem
+        std::vector<DataType> evec;
+        _sym_eigen(nw, sym, evec);
+
+        // select the k smallest eigenvalues
+        const Index nk = Math::min(this->_recycle_dim, nw);
+        std::vector<Index> idx(nw);
+        for(Index i(0); i < nw; ++i)
+          idx[i] = i;
+        std::sort(idx.begin(), idx.end(), [&](Index a, Index b) {return sym[a*nw+a] < sym[b*nw+b];});
+
+        // compute P := L^{-T} * Q_k by backward substitution
+        std::vector<DataType> mat_p(nw*nk);
+        for(Index j(0); j < nk; ++j)
+        {
+          for(Index i(nw); i > 0;)
+          {
+            --i;
+            DataType t = evec[i*nw + idx[j]];
+            for(Index l(i+1); l < nw; ++l)
+              t -= mass[l*nw+i] * mat_p[l*nk+j];
+            mat_p[i*nk+j] = t / mass[i*nw+i];
+          }
+        }
+
+        // compute U_new := W*P and C_new := Q*G*P
+        for(Index j(0); j < nk; ++j)
+        {
+          VectorType& vu = this->_vec_u2.at(j);
+          VectorType& vc = this->_vec_c2.at(j);
+          vu.format();
+          vc.format();
+          for(Index i(0); i < nw; ++i)
+            vu.axpy(vec_w(i), vu, mat_p[i*nk+j]);
+          for(Index i(0); i < nr; ++i)
+            vc.axpy(this->_vec_c.at(i), vc, mat_p[i*nk+j]);
+          for(Index l(0); l <= n; ++l)
+          {
+            // (H*P)_lj = sum_i H_li * P_(nr+i)j, where H_li is nonzero only for l <= i+1
+            DataType t(0);
+            for(Index i(l > Index(0) ? l - Index(1) : Index(0)); i < n; ++i)
+              t += this->_h.at(i).at(l) * mat_p[(nr+i)*nk+j];
+            vc.axpy(this->_vec_v.at(l), vc, t);
+          }
+        }
+
+        // orthonormalize C_new and swap in the new recycle space
+        _num_recycle = _orthonormalize(this->_vec_c2, this->_vec_u2, nk);
+        this->_vec_u.swap(this->_vec_u2);
+        this->_vec_c.swap(this->_vec_c2);
+      }
+    }; // class GCRODR<...>
+
+    /**
+     * \brief Creates a new GCRODR solver object
+     *
+     * \param[in] matrix
+     * The system matrix.
+     *
+     * \param[in] filter
+     * The system filter.
+     *
+     * \param[in] krylov_dim
+     * The maximum Krylov subspace dimension. Must be > recycle_dim.
+     *
+     * \param[in] recycle_dim
+     * The dimension of the recycle subspace.
+     *
+     * \param[in] precond
+     * The preconditioner. May be \c nullptr.
+     *
+     * \returns
+     * A shared pointer to a new GCRODR object.
+     */
+     /// \compilerhack GCC < 4.9 fails to deduct shared_ptr
+#if defined(FEAT_COMPILER_GNU) && (FEAT_COMPILER_GNU < 40900)
+    template<typename Matrix_, typename Filter_>
+    inline std::shared_ptr<GCRODR<Matrix_, Filter_>> new_gcrodr(
+      const Matrix_& matrix, const Filter_& filter, Index krylov_dim, Index recycle_dim)
+    {
+      return std::make_shared<GCRODR<Matrix_, Filter_>>(matrix, filter, krylov_dim, recycle_dim);
+    }
+    template<typename Matrix_, typename Filter_, typename Precond_>
+    inline std::shared_ptr<GCRODR<Matrix_, Filter_>> new_gcrodr(
+      const Matrix_& matrix, const Filter_& filter, Index krylov_dim, Index recycle_dim,
+      std::shared_ptr<Precond_> precond)
+    {
+      return std::make_shared<GCRODR<Matrix_, Filter_>>(matrix, filter, krylov_dim, recycle_dim, precond);
+    }
+#else
+    template<typename Matrix_, typename Filter_>
+    inline std::shared_ptr<GCRODR<Matrix_, Filter_>> new_gcrodr(
+      const Matrix_& matrix, const Filter_& filter, Index krylov_dim, Index recycle_dim,
+      std::shared_ptr<SolverBase<typename Matrix_::VectorTypeL>> precond = nullptr)
+    {
+      return std::make_shared<GCRODR<Matrix_, Filter_>>(matrix, filter, krylov_dim, recycle_dim, precond);
+    }
+#endif
+
+    /**
+     * \brief Creates a new GCRODR solver object using a PropertyMap
+     *
+     * \param[in] section_name
+     * The name of the config section, which it does not know by itself
+     *
+     * \param[in] section
+     * A pointer to the PropertyMap section configuring this solver
+     *
+     * \param[in] matrix
+     * The system matrix.
+     *
+     * \param[in] filter
+     * The system filter.
+     *
+     * \param[in] precond
+     * The preconditioner. May be \c nullptr.
+     *
+     * \returns
+     * A shared pointer to a new GCRODR object.
+     */
+     /// \compilerhack GCC < 4.9 fails to deduct shared_ptr
+#if defined(FEAT_COMPILER_GNU) && (FEAT_COMPILER_GNU < 40900)
+    template<typename Matrix_, typename Filter_>
+    inline std::shared_ptr<GCRODR<Matrix_, Filter_>> new_gcrodr(
+      const String& section_name, PropertyMap* section,
+      const Matrix_& matrix, const Filter_& filter)
+    {
+      return std::make_shared<GCRODR<Matrix_, Filter_>>(section_name, section, matrix, filter);
+    }
+
+    template<typename Matrix_, typename Filter_, typename Precond_>
+    inline std::shared_ptr<GCRODR<Matrix_, Filter_>> new_gcrodr(
+      const String& section_name, PropertyMap* section,
+      const Matrix_& matrix, const Filter_& filter, std::shared_ptr<Precond_> precond)
+    {
+      return std::make_shared<GCRODR<Matrix_, Filter_>>(section_name, section, matrix, filter, precond);
+    }
+#else
+    template<typename Matrix_, typename Filter_>
+    inline std::shared_ptr<GCRODR<Matrix_, Filter_>> new_gcrodr(
+      const String& section_name, PropertyMap* section,
+      const Matrix_& matrix, const Filter_& filter,
+      std::shared_ptr<SolverBase<typename Matrix_::VectorTypeL>> precond = nullptr)
+    {
+      return std::make_shared<GCRODR<Matrix_, Filter_>>(section_name, section, matrix, filter, precond);
+    }
+#endif
+  } // namespace Solver
+} // namespace FEAT
+
+#endif // KERNEL_SOLVER_GCRODR_HPP
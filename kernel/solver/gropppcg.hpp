@@ -173,7 +173,7 @@ namespace FEAT
       virtual Status _apply_intern(VectorType& vec_sol, const VectorType& DOXY(vec_rhs))
       {
         IterationStats pre_iter(*this);
-        Statistics::add_solver_expression(std::make_shared<ExpressionStartSolve>(this->name()));
+        Statistics::add_solver_expression<ExpressionStartSolve>(*this);
 
         const MatrixType& matrix(this->_system_matrix);
         const FilterType& filter(this->_system_filter);
@@ -195,14 +195,14 @@ namespace FEAT
         if(status != Status::progress)
         {
           pre_iter.destroy();
-          Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), status, this->get_num_iter()));
+          Statistics::add_solver_expression<ExpressionEndSolve>(*this, status, this->get_num_iter());
           return status;
         }
 
         if(!this->_apply_precond(vec_z, vec_r, filter))
         {
           pre_iter.destroy();
-          Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::aborted, this->get_num_iter()));
+          Statistics::add_solver_expression<ExpressionEndSolve>(*this, Status::aborted, this->get_num_iter());
           return Status::aborted;
         }
 
@@ -224,7 +224,7 @@ namespace FEAT
           if(!this->_apply_precond(vec_S, vec_s, filter))
           {
             stat.destroy();
-            Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::aborted, this->get_num_iter()));
+            Statistics::add_solver_expression<ExpressionEndSolve>(*this, Status::aborted, this->get_num_iter());
             return Status::aborted;
           }
           t = dot_t.wait();
@@ -253,13 +253,13 @@ namespace FEAT
           if(status != Status::progress)
           {
             stat.destroy();
-            Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), status, this->get_num_iter()));
+            Statistics::add_solver_expression<ExpressionEndSolve>(*this, status, this->get_num_iter());
             return status;
           }
         }
 
         // we should never reach this point...
-        Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::undefined, this->get_num_iter()));
+        Statistics::add_solver_expression<ExpressionEndSolve>(*this, Status::undefined, this->get_num_iter());
         return Status::undefined;
       }
     }; // class GroppPCG<...>
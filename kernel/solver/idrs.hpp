@@ -281,7 +281,7 @@ namespace FEAT
       virtual Status _apply_intern(VectorType& vec_sol, const VectorType& DOXY(vec_rhs))
       {
         IterationStats pre_iter(*this);
-        Statistics::add_solver_expression(std::make_shared<ExpressionStartSolve>(this->name()));
+        Statistics::add_solver_expression<ExpressionStartSolve>(*this);
         const MatrixType& matrix(this->_system_matrix);
         const FilterType& filter(this->_system_filter);
 
@@ -291,7 +291,7 @@ namespace FEAT
         if(!this->_apply_precond(this->_vec_r, this->_vec_t, filter))
         {
           pre_iter.destroy();
-          Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::aborted, this->get_num_iter()));
+          Statistics::add_solver_expression<ExpressionEndSolve>(*this, Status::aborted, this->get_num_iter());
           return Status::aborted;
         }
         //select random vector set (shadow space)
@@ -312,7 +312,7 @@ namespace FEAT
           if(!this->_apply_precond(this->_vec_v, this->_vec_t, filter))
           {
             first_iter.destroy();
-            Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::aborted, this->get_num_iter()));
+            Statistics::add_solver_expression<ExpressionEndSolve>(*this, Status::aborted, this->get_num_iter());
             return Status::aborted;
           }
           om = _vec_v.dot(_vec_r) / _vec_v.dot(_vec_v);
@@ -328,7 +328,7 @@ namespace FEAT
           //check for early convergence
           if (status != Status::progress)
           {
-            Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), status, this->get_num_iter()));
+            Statistics::add_solver_expression<ExpressionEndSolve>(*this, status, this->get_num_iter());
             return status;
           }
           // update k-th column of M
@@ -368,7 +368,7 @@ namespace FEAT
               if(!this->_apply_precond(this->_vec_t, this->_vec_dR.at(oldest), filter))
               {
                 stat.destroy();
-                Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::aborted, this->get_num_iter()));
+                Statistics::add_solver_expression<ExpressionEndSolve>(*this, Status::aborted, this->get_num_iter());
                 return Status::aborted;
               }
               om = _vec_v.dot(_vec_t) / _vec_t.dot(_vec_t);
@@ -401,7 +401,7 @@ namespace FEAT
               if(!this->_apply_precond(this->_vec_dR.at(oldest), this->_vec_t, filter))
               {
                 stat.destroy();
-                Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::aborted, this->get_num_iter()));
+                Statistics::add_solver_expression<ExpressionEndSolve>(*this, Status::aborted, this->get_num_iter());
                 return Status::aborted;
               }
               _vec_dR.at(oldest).scale(_vec_dR.at(oldest), DataType(-1));
@@ -427,7 +427,7 @@ namespace FEAT
 
         } //end outer loop
         // finished
-        Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), status, this->get_num_iter()));
+        Statistics::add_solver_expression<ExpressionEndSolve>(*this, status, this->get_num_iter());
         return status;
       } //_apply_intern(...)
     }; // class IDRS<...>
@@ -751,7 +751,7 @@ namespace FEAT
         this->_def_init = this->_def_cur = this->_def_prev = this->_calc_def_norm(vec_def, vec_sol);
         this->_num_iter = Index(0);
         this->_num_stag_iter = Index(0);
-        Statistics::add_solver_expression(std::make_shared<ExpressionDefect>(this->name(), this->_def_init, this->get_num_iter()));
+        Statistics::add_solver_expression<ExpressionDefect>(*this, this->_def_init, this->get_num_iter());
 
         // plot iteration line?
         if(this->_plot_iter())
@@ -868,7 +868,7 @@ namespace FEAT
         if(calc_def)
         {
           this->_def_cur = this->_calc_def_norm(vec_def, vec_sol);
-          Statistics::add_solver_expression(std::make_shared<ExpressionDefect>(this->name(), this->_def_cur, this->get_num_iter()));
+          Statistics::add_solver_expression<ExpressionDefect>(*this, this->_def_cur, this->get_num_iter());
         }
 
         // analyse defect
@@ -906,7 +906,7 @@ namespace FEAT
 
         // update current defect
         this->_def_cur = def_cur_norm;
-        Statistics::add_solver_expression(std::make_shared<ExpressionDefect>(this->name(), this->_def_cur, this->get_num_iter()));
+        Statistics::add_solver_expression<ExpressionDefect>(*this, this->_def_cur, this->get_num_iter());
 
         // analyse defect
         Status status = this->_analyse_defect(this->_num_iter, this->_def_cur, this->_def_prev, true);
@@ -1068,7 +1068,7 @@ namespace FEAT
       {
         if(this->_precond)
         {
-          Statistics::add_solver_expression(std::make_shared<ExpressionCallPrecond>(this->name(), this->_precond->name()));
+          Statistics::add_solver_expression<ExpressionCallPrecond>(*this, this->_precond);
           return status_success(this->_precond->apply(vec_cor, vec_def));
         }
         else
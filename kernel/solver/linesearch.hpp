@@ -548,8 +548,7 @@ namespace FEAT
 
           this->_def_cur = Math::abs(df);
 
-          Statistics::add_solver_expression(
-            std::make_shared<ExpressionDefect>(this->name(), this->_def_cur, this->get_num_iter()));
+          Statistics::add_solver_expression<ExpressionDefect>(*this, this->_def_cur, this->get_num_iter());
 
           // plot?
           if(this->_plot_iter())
@@ -202,7 +202,7 @@ namespace FEAT
          */
         virtual Status _apply_intern(VectorType& vec_sol, const VectorType& vec_dir)
         {
-          Statistics::add_solver_expression(std::make_shared<ExpressionStartSolve>(this->name()));
+          Statistics::add_solver_expression<ExpressionStartSolve>(*this);
 
           static constexpr DataType extrapolation_width = DataType(4);
           Status status(Status::progress);
@@ -416,7 +416,7 @@ namespace FEAT
             this->_filter.filter_def(this->_vec_grad);
           }
 
-          Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), status, this->get_num_iter()));
+          Statistics::add_solver_expression<ExpressionEndSolve>(*this, status, this->get_num_iter());
           return status;
         }
 
@@ -0,0 +1,454 @@
+// FEAT3: Finite Element Analysis Toolbox, Version 3
+// Copyright (C) 2010 - 2023 by Stefan Turek & the FEAT group
+// FEAT3 is released under the GNU General Public License version 3,
+// see the file 'copyright.txt' in the top level directory for details.
+
+#pragma once
+#ifndef KERNEL_SOLVER_MULTI_FGMRES_HPP
+#define KERNEL_SOLVER_MULTI_FGMRES_HPP 1
+
+// includes, FEAT
+#include <kernel/solver/multi_iterative.hpp>
+
+namespace FEAT
+{
+  namespace Solver
+  {
+    /**
+     * \brief Multi-right-hand-side FGMRES(m) solver implementation
+     *
+     * This class implements a restarted flexible GMRES(m) solver, which solves a linear system
+     * for k right-hand-sides simultaneously. Each column builds its own Krylov space with its own
+     * Arnoldi process and Givens rotations, but the matrix-vector products of all k columns are
+     * performed by a single call of the matrix' \c apply_multi() function, so that the matrix has
+     * to be read from memory only once per Arnoldi step instead of k times.
+     *
+     * The defect norm that is monitored within the inner loop is the Euclidean norm of the k
+     * estimated GMRES residual norms, whereas the true defect is computed after each restart.
+     *
+     * \tparam Matrix_
+     * The matrix class to be used by the solver; must provide an \c apply_multi() function.
+     *
+     * \tparam Filter_
+     * The filter class to be used by the solver.
+     *
+     * \see FGMRES
+     */
+    template<typename Matrix_, typename Filter_>
+    class MultiFGMRES :
+      public MultiIterativeSolver<Matrix_, Filter_>
+    {
+    public:
+      typedef MultiIterativeSolver<Matrix_, Filter_> BaseClass;
+      typedef typename BaseClass::MatrixType MatrixType;
+      typedef typename BaseClass::FilterType FilterType;
+      typedef typename BaseClass::DataType DataType;
+      typedef typename BaseClass::MultiVectorType MultiVectorType;
+      typedef typename BaseClass::PrecondType PrecondType;
+
+    protected:
+      /// krylov dimension
+      Index _krylov_dim;
+      /// Krylov basis multi-vectors
+      std::vector<MultiVectorType> _mvec_v;
+      /// preconditioned Krylov basis multi-vectors
+      std::vector<MultiVectorType> _mvec_z;
+      /// column-wise Hessenberg matrix entries: _h[i][l*k+j] = h_j(l,i)
+      std::vector<std::vector<DataType>> _h;
+      /// column-wise Givens rotations and right-hand-sides: _c[i*k+j] etc.
+      std::vector<DataType> _c, _s, _q;
+      /// column-wise temporary scalars
+      std::vector<DataType> _temp;
+      /// column-wise estimated defect norms
+      std::vector<DataType> _def_est;
+
+    public:
+      /**
+       * \brief Constructor
+       *
+       * \param[in] matrix
+       * A reference to the system matrix.
+       *
+       * \param[in] filter
+       * A reference to the system filter.
+       *
+       * \param[in] krylov_dim
+       * The maximum Krylov subspace dimension. Must be > 0.
+       *
+       * \param[in] precond
+       * A pointer to the preconditioner. May be \c nullptr.
+       */
+      explicit MultiFGMRES(const MatrixType& matrix, const FilterType& filter, Index krylov_dim,
+        std::shared_ptr<PrecondType> precond = nullptr) :
+        BaseClass("MultiFGMRES(" + stringify(krylov_dim) + ")", matrix, filter, precond),
+        _krylov_dim(krylov_dim)
+      {
+        XASSERT(krylov_dim > Index(0));
+      }
+
+      /**
+       * \brief Constructor using a PropertyMap
+       *
+       * \param[in] section_name
+       * The name of the config section, which it does not know by itself
+       *
+       * \param[in] section
+       * A pointer to the PropertyMap section configuring this solver
+       *
+       * \param[in] matrix
+       * The system matrix.
+       *
+       * \param[in] filter
+       * The system filter.
+       *
+       * \param[in] precond
+       * The preconditioner. May be \c nullptr.
+       */
+      explicit MultiFGMRES(const String& section_name, PropertyMap* section,
+        const MatrixType& matrix, const FilterType& filter, std::shared_ptr<PrecondType> precond = nullptr) :
+        BaseClass("MultiFGMRES", section_name, section, matrix, filter, precond),
+        _krylov_dim(0)
+      {
+        // Check if we have set _krylov_vim
+        auto krylov_dim_p = section->query("krylov_dim");
+        if(!krylov_dim_p.second)
+          throw ParseError("MultiFGMRES config section is missing the mandatory krylov_dim!");
+
+        if(!krylov_dim_p.first.parse(this->_krylov_dim) || (this->_krylov_dim <= Index(0)))
+          throw ParseError(section_name + ".krylov_dim", krylov_dim_p.first, "a positive integer");
+
+        this->set_plot_name("MultiFGMRES("+stringify(_krylov_dim)+")");
+      }
+
+      /// \copydoc SolverBase::name()
+      virtual String name() const override
+      {
+        return "MultiFGMRES";
+      }
+
+      /// \copydoc SolverBase::done_symbolic()
+      virtual void done_symbolic() override
+      {
+        _mvec_v.clear();
+        _mvec_z.clear();
+        BaseClass::done_symbolic();
+      }
+
+      /**
+       * \brief Sets the inner Krylov space dimension
+       *
+       * \param[in] krylov_dim
+       * The m in MultiFGMRES(m)
+       */
+      virtual void set_krylov_dim(Index krylov_dim)
+      {
+        XASSERT(krylov_dim > Index(0));
+        _krylov_dim = krylov_dim;
+        _mvec_v.clear();
+        _mvec_z.clear();
+      }
+
+      /// \copydoc SolverBase::apply()
+      virtual Status apply(MultiVectorType& mvec_cor, const MultiVectorType& mvec_def) override
+      {
+        _alloc(mvec_def.columns());
+
+        // save input defect as initial defect
+        this->_mvec_v.front().copy(mvec_def);
+
+        // clear solution multi-vector
+        mvec_cor.format();
+
+        // apply
+        this->_status = _apply_intern(mvec_cor, mvec_def);
+        this->plot_summary();
+        return this->_status;
+      }
+
+      /// \copydoc IterativeSolver::correct()
+      virtual Status correct(MultiVectorType& mvec_sol, const MultiVectorType& mvec_rhs) override
+      {
+        _alloc(mvec_rhs.columns());
+
+        // compute initial defect
+        this->_system_matrix.apply_multi(this->_mvec_v.front(), mvec_sol, mvec_rhs, -DataType(1));
+        this->_filter_def(this->_mvec_v.front());
+
+        // apply
+        this->_status = _apply_intern(mvec_sol, mvec_rhs);
+        this->plot_summary();
+        return this->_status;
+      }
+
+    protected:
+      /// (re)allocates the temporary multi-vectors for a given number of columns
+      void _alloc(Index num_vecs)
+      {
+        if((this->_mvec_v.size() == std::size_t(_krylov_dim+1)) && (this->_mvec_v.front().columns() == num_vecs))
+          return;
+
+        _mvec_v.clear();
+        _mvec_z.clear();
+        for(Index i(0); i <= _krylov_dim; ++i)
+          _mvec_v.push_back(this->create_multi_vector(num_vecs));
+        for(Index i(0); i < _krylov_dim; ++i)
+          _mvec_z.push_back(this->create_multi_vector(num_vecs));
+
+        const std::size_t k = std::size_t(num_vecs);
+        _h.resize(_krylov_dim);
+        for(std::size_t i(0); i < _h.size(); ++i)
+          _h[i].resize((i+2) * k);
+        _c.resize(_krylov_dim * k);
+        _s.resize(_krylov_dim * k);
+        _q.resize((_krylov_dim + 1) * k);
+      }
+
+      virtual Status _apply_intern(MultiVectorType& mvec_sol, const MultiVectorType& mvec_rhs)
+      {
+        IterationStats pre_iter(*this);
+        Statistics::add_solver_expression<ExpressionStartSolve>(*this);
+        const MatrixType& matrix(this->_system_matrix);
+        const std::size_t k = std::size_t(mvec_rhs.columns());
+
+        // compute initial defect
+        Status status = this->_set_initial_defect(this->_mvec_v.front(), mvec_sol);
+
+        pre_iter.destroy();
+
+        // outer GMRES loop
+        while(status == Status::progress)
+        {
+          IterationStats stat(*this);
+
+          // q_j[0] := |v_j[0]|, normalize v_j[0]
+          this->_col_dot(_temp, this->_mvec_v.front(), this->_mvec_v.front());
+          for(std::size_t j(0); j < k; ++j)
+          {
+            _q[j] = Math::sqrt(_temp[j]);
+            _temp[j] = (_q[j] > DataType(0) ? DataType(1) / _q[j] : DataType(0));
+          }
+          this->_col_scale(this->_mvec_v.front(), _temp);
+
+          // inner GMRES loop
+          Status inner_status(Status::progress);
+          Index i(0);
+          while(i < this->_krylov_dim)
+          {
+            MultiVectorType& mvec_vi(this->_mvec_v.at(i));
+            MultiVectorType& mvec_zi(this->_mvec_z.at(i));
+            MultiVectorType& mvec_w(this->_mvec_v.at(i+1));
+            std::vector<DataType>& h(this->_h.at(i));
+
+            // apply preconditioner
+            if(!this->_apply_precond(mvec_zi, mvec_vi))
+            {
+              stat.destroy();
+              Statistics::add_solver_expression<ExpressionEndSolve>(*this, Status::aborted, this->get_num_iter());
+              return Status::aborted;
+            }
+
+            // V[i+1] := A*Z[i] for all columns at once
+            matrix.apply_multi(mvec_w, mvec_zi);
+            this->_filter_def(mvec_w);
+
+            // column-wise modified Gram-Schmidt process
+            for(Index l(0); l <= i; ++l)
+            {
+              this->_col_dot(_temp, mvec_w, this->_mvec_v.at(l));
+              for(std::size_t j(0); j < k; ++j)
+              {
+                h[l*k + j] = _temp[j];
+                _temp[j] = -_temp[j];
+              }
+              this->_col_axpy(mvec_w, this->_mvec_v.at(l), _temp);
+            }
+
+            // normalize v_j[i+1]
+            this->_col_dot(_temp, mvec_w, mvec_w);
+            for(std::size_t j(0); j < k; ++j)
+            {
+              const DataType alpha = Math::sqrt(_temp[j]);
+              h[(i+1)*k + j] = alpha;
+              _temp[j] = (alpha > DataType(0) ? DataType(1) / alpha : DataType(0));
+            }
+            this->_col_scale(mvec_w, _temp);
+
+            // apply Givens rotations and compute the next ones
+            _def_est.resize(k);
+            for(std::size_t j(0); j < k; ++j)
+            {
+              for(Index l(0); l < i; ++l)
+              {
+                const DataType c(_c[l*k + j]), s(_s[l*k + j]);
+                const DataType t(h[l*k + j]);
+                h[l*k + j]     = c * t + s * h[(l+1)*k + j];
+                h[(l+1)*k + j] = s * t - c * h[(l+1)*k + j];
+              }
+
+              const DataType hii(h[i*k + j]), alpha(h[(i+1)*k + j]);
+              const DataType beta = Math::sqrt(Math::sqr(hii) + Math::sqr(alpha));
+              if(beta > DataType(0))
+              {
+                _s[i*k + j] = alpha / beta;
+                _c[i*k + j] = hii / beta;
+              }
+              else
+              {
+                // this column has already converged
+                _s[i*k + j] = DataType(0);
+                _c[i*k + j] = DataType(1);
+              }
+              h[i*k + j] = beta;
+              _q[(i+1)*k + j] = _s[i*k + j] * _q[i*k + j];
+              _q[i*k + j] *= _c[i*k + j];
+              _def_est[j] = Math::abs(_q[(i+1)*k + j]);
+            }
+
+            // push our new estimated defect
+            if(++i < this->_krylov_dim)
+            {
+              inner_status = this->_update_col_defects(_def_est);
+              if(inner_status != Status::progress)
+                break;
+            }
+          }
+
+          // solve H_j*y_j = q_j for all columns by backward substitution
+          for(std::size_t j(0); j < k; ++j)
+          {
+            for(Index l(i); l > 0;)
+            {
+              --l;
+              const DataType hll(this->_h.at(l)[l*k + j]);
+              _q[l*k + j] = (Math::abs(hll) > DataType(0) ? _q[l*k + j] / hll : DataType(0));
+              for(Index r(l); r > 0;)
+              {
+                --r;
+                _q[r*k + j] -= this->_h.at(l)[r*k + j] * _q[l*k + j];
+              }
+            }
+          }
+
+          // update solution
+          for(Index l(0); l < i; ++l)
+          {
+            _temp.assign(_q.begin() + std::ptrdiff_t(l*k), _q.begin() + std::ptrdiff_t((l+1)*k));
+            this->_col_axpy(mvec_sol, this->_mvec_z.at(l), _temp);
+          }
+
+          // abort on divergence or stagnation of the inner loop
+          if((inner_status == Status::diverged) || (inner_status == Status::stagnated))
+          {
+            status = inner_status;
+            break;
+          }
+
+          // compute "real" residual
+          matrix.apply_multi(this->_mvec_v.front(), mvec_sol, mvec_rhs, -DataType(1));
+          this->_filter_def(this->_mvec_v.front());
+
+          // set the current defect
+          status = this->_set_new_defect(this->_mvec_v.front(), mvec_sol);
+        }
+
+        // finished
+        Statistics::add_solver_expression<ExpressionEndSolve>(*this, status, this->get_num_iter());
+        return status;
+      }
+    }; // class MultiFGMRES<...>
+
+    /**
+     * \brief Creates a new MultiFGMRES solver object
+     *
+     * \param[in] matrix
+     * The system matrix.
+     *
+     * \param[in] filter
+     * The system filter.
+     *
+     * \param[in] krylov_dim
+     * The maximum Krylov subspace dimension. Must be > 0.
+     *
+     * \param[in] precond
+     * The preconditioner. May be \c nullptr.
+     *
+     * \returns
+     * A shared pointer to a new MultiFGMRES object.
+     */
+     /// \compilerhack GCC < 4.9 fails to deduct shared_ptr
+#if defined(FEAT_COMPILER_GNU) && (FEAT_COMPILER_GNU < 40900)
+    template<typename Matrix_, typename Filter_>
+    inline std::shared_ptr<MultiFGMRES<Matrix_, Filter_>> new_multi_fgmres(
+      const Matrix_& matrix, const Filter_& filter, Index krylov_dim)
+    {
+      return std::make_shared<MultiFGMRES<Matrix_, Filter_>>(matrix, filter, krylov_dim, nullptr);
+    }
+    template<typename Matrix_, typename Filter_, typename Precond_>
+    inline std::shared_ptr<MultiFGMRES<Matrix_, Filter_>> new_multi_fgmres(
+      const Matrix_& matrix, const Filter_& filter, Index krylov_dim,
+      std::shared_ptr<Precond_> precond)
+    {
+      return std::make_shared<MultiFGMRES<Matrix_, Filter_>>(matrix, filter, krylov_dim, precond);
+    }
+#else
+    template<typename Matrix_, typename Filter_>
+    inline std::shared_ptr<MultiFGMRES<Matrix_, Filter_>> new_multi_fgmres(
+      const Matrix_& matrix, const Filter_& filter, Index krylov_dim,
+      std::shared_ptr<SolverBase<typename Matrix_::VectorTypeR>> precond = nullptr)
+    {
+      return std::make_shared<MultiFGMRES<Matrix_, Filter_>>(matrix, filter, krylov_dim, precond);
+    }
+#endif
+
+    /**
+     * \brief Creates a new MultiFGMRES solver object using a PropertyMap
+     *
+     * \param[in] section_name
+     * The name of the config section, which it does not know by itself
+     *
+     * \param[in] section
+     * A pointer to the PropertyMap section configuring this solver
+     *
+     * \param[in] matrix
+     * The system matrix.
+     *
+     * \param[in] filter
+     * The system filter.
+     *
+     * \param[in] precond
+     * The preconditioner. May be \c nullptr.
+     *
+     * \returns
+     * A shared pointer to a new MultiFGMRES object.
+     */
+     /// \compilerhack GCC < 4.9 fails to deduct shared_ptr
+#if defined(FEAT_COMPILER_GNU) && (FEAT_COMPILER_GNU < 40900)
+    template<typename Matrix_, typename Filter_>
+    inline std::shared_ptr<MultiFGMRES<Matrix_, Filter_>> new_multi_fgmres(
+      const String& section_name, PropertyMap* section,
+      const Matrix_& matrix, const Filter_& filter)
+    {
+      return std::make_shared<MultiFGMRES<Matrix_, Filter_>>(section_name, section, matrix, filter, nullptr);
+    }
+    template<typename Matrix_, typename Filter_, typename Precond_>
+    inline std::shared_ptr<MultiFGMRES<Matrix_, Filter_>> new_multi_fgmres(
+      const String& section_name, PropertyMap* section,
+      const Matrix_& matrix, const Filter_& filter,
+      std::shared_ptr<Precond_> precond)
+    {
+      return std::make_shared<MultiFGMRES<Matrix_, Filter_>>(section_name, section, matrix, filter, precond);
+    }
+#else
+    template<typename Matrix_, typename Filter_>
+    inline std::shared_ptr<MultiFGMRES<Matrix_, Filter_>> new_multi_fgmres(
+      const String& section_name, PropertyMap* section,
+      const Matrix_& matrix, const Filter_& filter,
+      std::shared_ptr<SolverBase<typename Matrix_::VectorTypeR>> precond = nullptr)
+    {
+      return std::make_shared<MultiFGMRES<Matrix_, Filter_>>(section_name, section, matrix, filter, precond);
+    }
+#endif
+  } // namespace Solver
+} // namespace FEAT
+
+#endif // KERNEL_SOLVER_MULTI_FGMRES_HPP
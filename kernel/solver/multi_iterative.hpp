@@ -0,0 +1,413 @@
+// FEAT3: Finite Element Analysis Toolbox, Version 3
+// Copyright (C) 2010 - 2023 by Stefan Turek & the FEAT group
+// FEAT3 is released under the GNU General Public License version 3,
+// see the file 'copyright.txt' in the top level directory for details.
+
+#pragma once
+#ifndef KERNEL_SOLVER_MULTI_ITERATIVE_HPP
+#define KERNEL_SOLVER_MULTI_ITERATIVE_HPP 1
+
+// includes, FEAT
+#include <kernel/solver/iterative.hpp>
+#include <kernel/lafem/dense_matrix.hpp>
+
+// includes, system
+#include <vector>
+
+namespace FEAT
+{
+  namespace Solver
+  {
+    /**
+     * \brief Abstract base-class for multi-right-hand-side iterative solvers
+     *
+     * This class is the base class for iterative solvers, which solve a linear system for k
+     * right-hand-sides simultaneously. The k solution and right-hand-side vectors are stored as
+     * the columns of a dense matrix, i.e. interleaved, so that the system matrix can be applied
+     * to all k vectors in a single sweep by its \c apply_multi() function, which is currently
+     * offered by LAFEM::SparseMatrixCSR and LAFEM::SparseMatrixBCSR. Each of the k systems is
+     * solved by its own Krylov iteration; only the memory traffic for the matrix is shared.
+     *
+     * The defect norm, which is plotted and used for the divergence and stagnation criterions, is
+     * the Frobenius norm of the defect matrix, i.e. the Euclidean norm of the vector of all k
+     * defect norms. In contrast, the convergence criterion is checked for each column separately
+     * with respect to the column's own initial defect, i.e. the solver only stops once every
+     * single column has fulfilled the absolute and relative tolerances.
+     *
+     * The preconditioner and the filter work on single vectors of the matrix' VectorTypeR type
+     * and are applied to each column separately.
+     *
+     * \tparam Matrix_
+     * The matrix class to be used by the solver.
+     *
+     * \tparam Filter_
+     * The filter class to be used by the solver.
+     */
+    template<typename Matrix_, typename Filter_>
+    class MultiIterativeSolver :
+      public IterativeSolver<LAFEM::DenseMatrix<typename Matrix_::DataType, typename Matrix_::IndexType>>
+    {
+    public:
+      typedef Matrix_ MatrixType;
+      typedef Filter_ FilterType;
+      typedef typename MatrixType::DataType DataType;
+      typedef typename MatrixType::IndexType IndexType;
+      /// the single vector type
+      typedef typename MatrixType::VectorTypeR VectorType;
+      /// the multi-vector type
+      typedef LAFEM::DenseMatrix<DataType, IndexType> MultiVectorType;
+      typedef IterativeSolver<MultiVectorType> BaseClass;
+
+      /// the interface for the preconditioner
+      typedef SolverBase<VectorType> PrecondType;
+
+    protected:
+      /// the matrix for the solver
+      const MatrixType& _system_matrix;
+      /// the filter for the solver
+      const FilterType& _system_filter;
+      /// the pointer to the preconditioner
+      std::shared_ptr<PrecondType> _precond;
+      /// temporary single vectors for the column-wise filter and preconditioner
+      VectorType _vec_col_def, _vec_col_cor;
+      /// the initial and current defect norms of the columns
+      std::vector<DataType> _def_init_cols, _def_cur_cols;
+
+      explicit MultiIterativeSolver(const String& plot_name, const MatrixType& matrix, const FilterType& filter,
+        std::shared_ptr<PrecondType> precond = nullptr) :
+        BaseClass(plot_name),
+        _system_matrix(matrix),
+        _system_filter(filter),
+        _precond(precond)
+      {
+        // set communicator by system matrix
+        this->_set_comm_by_matrix(matrix);
+      }
+
+      explicit MultiIterativeSolver(const String& plot_name, const String& section_name, PropertyMap* section,
+        const MatrixType& matrix, const FilterType& filter, std::shared_ptr<PrecondType> precond = nullptr) :
+        BaseClass(plot_name, section_name, section),
+        _system_matrix(matrix),
+        _system_filter(filter),
+        _precond(precond)
+      {
+        // set communicator by system matrix
+        this->_set_comm_by_matrix(matrix);
+      }
+
+    public:
+      /// virtual destructor
+      virtual ~MultiIterativeSolver()
+      {
+      }
+
+      /// \copydoc SolverBase::init_symbolic()
+      virtual void init_symbolic() override
+      {
+        BaseClass::init_symbolic();
+        if(_precond)
+          _precond->init_symbolic();
+        _vec_col_def = this->_system_matrix.create_vector_r();
+        _vec_col_cor = this->_system_matrix.create_vector_r();
+      }
+
+      /// \copydoc SolverBase::init_numeric()
+      virtual void init_numeric() override
+      {
+        BaseClass::init_numeric();
+        if(_precond)
+          _precond->init_numeric();
+      }
+
+      /// \copydoc SolverBase::done_numeric()
+      virtual void done_numeric() override
+      {
+        if(_precond)
+          _precond->done_numeric();
+        BaseClass::done_numeric();
+      }
+
+      /// \copydoc SolverBase::done_symbolic()
+      virtual void done_symbolic() override
+      {
+        _vec_col_cor.clear();
+        _vec_col_def.clear();
+        if(_precond)
+          _precond->done_symbolic();
+        BaseClass::done_symbolic();
+      }
+
+      /**
+       * \brief Creates a multi-vector for this solver
+       *
+       * \param[in] num_vecs
+       * The number of vectors, i.e. right-hand-sides.
+       *
+       * \returns A new (uninitialized) multi-vector with num_vecs columns.
+       */
+      MultiVectorType create_multi_vector(Index num_vecs) const
+      {
+        return MultiVectorType(this->_system_matrix.create_vector_r().template size<LAFEM::Perspective::pod>(), num_vecs);
+      }
+
+      /**
+       * \brief Copies a single vector into a column of a multi-vector
+       *
+       * \param[in,out] mvec
+       * The multi-vector that receives the column.
+       *
+       * \param[in] j
+       * The index of the column.
+       *
+       * \param[in] vec
+       * The vector to be copied.
+       */
+      static void set_column(MultiVectorType& mvec, Index j, const VectorType& vec)
+      {
+        const Index n = mvec.rows(), k = mvec.columns();
+        XASSERT(vec.template size<LAFEM::Perspective::pod>() == n);
+        XASSERT(j < k);
+        const DataType* v = vec.template elements<LAFEM::Perspective::pod>();
+        DataType* m = mvec.elements();
+        for(Index i(0); i < n; ++i)
+          m[i*k + j] = v[i];
+      }
+
+      /**
+       * \brief Copies a column of a multi-vector into a single vector
+       *
+       * \param[in,out] vec
+       * The vector that receives the column.
+       *
+       * \param[in] mvec
+       * The multi-vector that is to be copied from.
+       *
+       * \param[in] j
+       * The index of the column.
+       */
+      static void get_column(VectorType& vec, const MultiVectorType& mvec, Index j)
+      {
+        const Index n = mvec.rows(), k = mvec.columns();
+        XASSERT(vec.template size<LAFEM::Perspective::pod>() == n);
+        XASSERT(j < k);
+        DataType* v = vec.template elements<LAFEM::Perspective::pod>();
+        const DataType* m = mvec.elements();
+        for(Index i(0); i < n; ++i)
+          v[i] = m[i*k + j];
+      }
+
+      /**
+       * \brief Checks whether all columns fulfil the convergence criterion
+       *
+       * \returns
+       * \c true, if the defect norm of each column is smaller than the absolute tolerance and
+       * smaller than the relative tolerance times the column's initial defect norm (or smaller
+       * than the lower absolute tolerance), otherwise \c false.
+       */
+      bool is_converged_cols() const
+      {
+        for(std::size_t j(0); j < _def_cur_cols.size(); ++j)
+        {
+          const DataType def_cur = _def_cur_cols[j];
+          if(def_cur > this->_tol_abs)
+            return false;
+          if((def_cur > this->_tol_rel * _def_init_cols[j]) && (def_cur > this->_tol_abs_low))
+            return false;
+        }
+        return true;
+      }
+
+    protected:
+      /**
+       * \brief Computes the defect norm
+       *
+       * This function stores the column defect norms and returns their Euclidean norm, which is
+       * the Frobenius norm of the defect multi-vector.
+       */
+      virtual DataType _calc_def_norm(const MultiVectorType& mvec_def, const MultiVectorType& DOXY(mvec_sol)) override
+      {
+        _col_dot(_def_cur_cols, mvec_def, mvec_def);
+        DataType def_sqr(0);
+        for(auto& d : _def_cur_cols)
+        {
+          def_sqr += d;
+          d = Math::sqrt(d);
+        }
+        return Math::sqrt(def_sqr);
+      }
+
+      /// \copydoc IterativeSolver::_set_initial_defect()
+      virtual Status _set_initial_defect(const MultiVectorType& mvec_def, const MultiVectorType& mvec_sol) override
+      {
+        Status status = BaseClass::_set_initial_defect(mvec_def, mvec_sol);
+        _def_init_cols = _def_cur_cols;
+        return status;
+      }
+
+      /**
+       * \brief Internal function: sets the new (next) column defect norms
+       *
+       * This function is the column-wise counterpart of _update_defect() for solvers, which
+       * compute defect norm estimates rather than defect vectors.
+       *
+       * \param[in] def_cols
+       * The new (estimated) defect norms of the columns.
+       *
+       * \returns
+       * The updated Status code.
+       */
+      Status _update_col_defects(const std::vector<DataType>& def_cols)
+      {
+        XASSERT(def_cols.size() == _def_init_cols.size());
+        _def_cur_cols = def_cols;
+        DataType def_sqr(0);
+        for(const auto& d : _def_cur_cols)
+          def_sqr += Math::sqr(d);
+        return this->_update_defect(Math::sqrt(def_sqr));
+      }
+
+      /**
+       * \brief Internal function: analyse the current defect
+       *
+       * In contrast to IterativeSolver::_analyse_defect(), the convergence criterion is checked
+       * for each column by is_converged_cols() rather than for the Frobenius norm.
+       */
+      virtual Status _analyse_defect(Index num_iter, DataType def_cur, DataType def_prev, bool check_stag) override
+      {
+        // ensure that the defect is neither NaN nor infinity
+        if(!Math::isfinite(def_cur))
+          return Status::aborted;
+
+        // is diverged?
+        if(this->is_diverged(def_cur))
+          return Status::diverged;
+
+        // minimum number of iterations performed?
+        if(num_iter < this->_min_iter)
+          return Status::progress;
+
+        // are all columns converged?
+        if(this->is_converged_cols())
+          return Status::success;
+
+        // maximum number of iterations performed?
+        if(num_iter >= this->_max_iter)
+          return Status::max_iter;
+
+        // check for stagnation?
+        if(check_stag && (this->_min_stag_iter > Index(0)))
+        {
+          // did this iteration stagnate?
+          if(def_cur >= this->_stag_rate * def_prev)
+          {
+            // increment stagnation count
+            if(++this->_num_stag_iter >= this->_min_stag_iter)
+              return Status::stagnated;
+          }
+          else
+          {
+            // this iteration did not stagnate
+            this->_num_stag_iter = Index(0);
+          }
+        }
+
+        // continue iterating
+        return Status::progress;
+      }
+
+      /// computes the column-wise dot products d_j := <x_j, y_j>
+      static void _col_dot(std::vector<DataType>& d, const MultiVectorType& x, const MultiVectorType& y)
+      {
+        const Index n = x.rows(), k = x.columns();
+        const DataType* vx = x.elements();
+        const DataType* vy = y.elements();
+        d.assign(k, DataType(0));
+        for(Index i(0); i < n; ++i)
+          for(Index j(0); j < k; ++j)
+            d[j] += vx[i*k + j] * vy[i*k + j];
+      }
+
+      /// computes the column-wise axpy y_j := y_j + alpha_j * x_j
+      static void _col_axpy(MultiVectorType& y, const MultiVectorType& x, const std::vector<DataType>& alpha)
+      {
+        const Index n = x.rows(), k = x.columns();
+        const DataType* vx = x.elements();
+        DataType* vy = y.elements();
+        for(Index i(0); i < n; ++i)
+          for(Index j(0); j < k; ++j)
+            vy[i*k + j] += alpha[j] * vx[i*k + j];
+      }
+
+      /// computes the column-wise xpay y_j := x_j + alpha_j * y_j
+      static void _col_xpay(MultiVectorType& y, const MultiVectorType& x, const std::vector<DataType>& alpha)
+      {
+        const Index n = x.rows(), k = x.columns();
+        const DataType* vx = x.elements();
+        DataType* vy = y.elements();
+        for(Index i(0); i < n; ++i)
+          for(Index j(0); j < k; ++j)
+            vy[i*k + j] = vx[i*k + j] + alpha[j] * vy[i*k + j];
+      }
+
+      /// computes the column-wise scaling x_j := alpha_j * x_j
+      static void _col_scale(MultiVectorType& x, const std::vector<DataType>& alpha)
+      {
+        const Index n = x.rows(), k = x.columns();
+        DataType* vx = x.elements();
+        for(Index i(0); i < n; ++i)
+          for(Index j(0); j < k; ++j)
+            vx[i*k + j] *= alpha[j];
+      }
+
+      /// applies the defect filter to each column of a multi-vector
+      void _filter_def(MultiVectorType& mvec)
+      {
+        for(Index j(0); j < mvec.columns(); ++j)
+        {
+          get_column(this->_vec_col_def, mvec, j);
+          this->_system_filter.filter_def(this->_vec_col_def);
+          set_column(mvec, j, this->_vec_col_def);
+        }
+      }
+
+      /**
+       * \brief Applies the preconditioner onto each column of a defect multi-vector
+       *
+       * \note
+       * If no preconditioner is present, this function will simply copy the input multi-vector's
+       * contents into the output multi-vector and apply the correction filter.
+       *
+       * \param[in,out] mvec_cor
+       * A reference to the multi-vector that shall receive the preconditioned defects.
+       *
+       * \param[in] mvec_def
+       * A reference to the multi-vector that is to be preconditioned.
+       *
+       * \returns
+       * \c true, if all preconditioner applications were successful, otherwise \c false.
+       */
+      bool _apply_precond(MultiVectorType& mvec_cor, const MultiVectorType& mvec_def)
+      {
+        for(Index j(0); j < mvec_def.columns(); ++j)
+        {
+          get_column(this->_vec_col_def, mvec_def, j);
+          if(this->_precond)
+          {
+            Statistics::add_solver_expression<ExpressionCallPrecond>(*this, this->_precond);
+            if(!status_success(this->_precond->apply(this->_vec_col_cor, this->_vec_col_def)))
+              return false;
+          }
+          else
+          {
+            this->_vec_col_cor.copy(this->_vec_col_def);
+            this->_system_filter.filter_cor(this->_vec_col_cor);
+          }
+          set_column(mvec_cor, j, this->_vec_col_cor);
+        }
+        return true;
+      }
+    }; // class MultiIterativeSolver<...>
+  } // namespace Solver
+} // namespace FEAT
+
+#endif // KERNEL_SOLVER_MULTI_ITERATIVE_HPP
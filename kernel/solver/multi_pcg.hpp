@@ -0,0 +1,372 @@
+// FEAT3: Finite Element Analysis Toolbox, Version 3
+// Copyright (C) 2010 - 2023 by Stefan Turek & the FEAT group
+// FEAT3 is released under the GNU General Public License version 3,
+// see the file 'copyright.txt' in the top level directory for details.
+
+#pragma once
+#ifndef KERNEL_SOLVER_MULTI_PCG_HPP
+#define KERNEL_SOLVER_MULTI_PCG_HPP 1
+
+// includes, FEAT
+#include <kernel/solver/multi_iterative.hpp>
+
+namespace FEAT
+{
+  namespace Solver
+  {
+    /**
+     * \brief Multi-right-hand-side (preconditioned) Conjugate-Gradient solver implementation
+     *
+     * This class implements a PCG solver, which solves a symmetric positive definite system
+     * for k right-hand-sides simultaneously. Each column runs its own PCG iteration with its
+     * own step lengths, but the matrix-vector products of all k columns are performed by a
+     * single call of the matrix' \c apply_multi() function, so that the matrix has to be read
+     * from memory only once per iteration instead of k times.
+     *
+     * Columns, which have already converged exactly, i.e. whose defect has become zero, are
+     * simply carried along with zero step lengths.
+     *
+     * \tparam Matrix_
+     * The matrix class to be used by the solver; must provide an \c apply_multi() function.
+     *
+     * \tparam Filter_
+     * The filter class to be used by the solver.
+     *
+     * \see PCG
+     */
+    template<typename Matrix_, typename Filter_>
+    class MultiPCG :
+      public MultiIterativeSolver<Matrix_, Filter_>
+    {
+    public:
+      typedef MultiIterativeSolver<Matrix_, Filter_> BaseClass;
+      typedef typename BaseClass::MatrixType MatrixType;
+      typedef typename BaseClass::FilterType FilterType;
+      typedef typename BaseClass::DataType DataType;
+      typedef typename BaseClass::MultiVectorType MultiVectorType;
+      typedef typename BaseClass::PrecondType PrecondType;
+
+    protected:
+      /// the defect multi-vector
+      MultiVectorType _mvec_r;
+      /// the search direction multi-vector
+      MultiVectorType _mvec_p;
+      /// temporary multi-vector, used for A*p and the preconditioned defect
+      MultiVectorType _mvec_t;
+      /// column-wise scalars
+      std::vector<DataType> _gamma, _alpha, _beta, _temp;
+
+    public:
+      /**
+       * \brief Constructor
+       *
+       * \param[in] matrix
+       * A reference to the system matrix.
+       *
+       * \param[in] filter
+       * A reference to the system filter.
+       *
+       * \param[in] precond
+       * A pointer to the preconditioner. May be \c nullptr.
+       */
+      explicit MultiPCG(const MatrixType& matrix, const FilterType& filter,
+        std::shared_ptr<PrecondType> precond = nullptr) :
+        BaseClass("MultiPCG", matrix, filter, precond)
+      {
+      }
+
+      /**
+       * \brief Constructor using a PropertyMap
+       *
+       * \param[in] section_name
+       * The name of the config section, which it does not know by itself
+       *
+       * \param[in] section
+       * A pointer to the PropertyMap section configuring this solver
+       *
+       * \param[in] matrix
+       * The system matrix.
+       *
+       * \param[in] filter
+       * The system filter.
+       *
+       * \param[in] precond
+       * The preconditioner. May be \c nullptr.
+       */
+      explicit MultiPCG(const String& section_name, PropertyMap* section,
+        const MatrixType& matrix, const FilterType& filter, std::shared_ptr<PrecondType> precond = nullptr) :
+        BaseClass("MultiPCG", section_name, section, matrix, filter, precond)
+      {
+      }
+
+      /// \copydoc SolverBase::name()
+      virtual String name() const override
+      {
+        return "MultiPCG";
+      }
+
+      /// \copydoc SolverBase::done_symbolic()
+      virtual void done_symbolic() override
+      {
+        this->_mvec_t.clear();
+        this->_mvec_p.clear();
+        this->_mvec_r.clear();
+        BaseClass::done_symbolic();
+      }
+
+      /// \copydoc SolverBase::apply()
+      virtual Status apply(MultiVectorType& mvec_cor, const MultiVectorType& mvec_def) override
+      {
+        _alloc(mvec_def.columns());
+
+        // save defect
+        this->_mvec_r.copy(mvec_def);
+
+        // clear solution multi-vector
+        mvec_cor.format();
+
+        // apply solver
+        this->_status = _apply_intern(mvec_cor);
+
+        // plot summary
+        this->plot_summary();
+
+        // return status
+        return this->_status;
+      }
+
+      /// \copydoc IterativeSolver::correct()
+      virtual Status correct(MultiVectorType& mvec_sol, const MultiVectorType& mvec_rhs) override
+      {
+        _alloc(mvec_rhs.columns());
+
+        // compute defect
+        this->_system_matrix.apply_multi(this->_mvec_r, mvec_sol, mvec_rhs, -DataType(1));
+        this->_filter_def(this->_mvec_r);
+
+        // apply solver
+        this->_status = _apply_intern(mvec_sol);
+
+        // plot summary
+        this->plot_summary();
+
+        // return status
+        return this->_status;
+      }
+
+    protected:
+      /// (re)allocates the temporary multi-vectors for a given number of columns
+      void _alloc(Index num_vecs)
+      {
+        if(this->_mvec_r.columns() == num_vecs)
+          return;
+        this->_mvec_r = this->create_multi_vector(num_vecs);
+        this->_mvec_p = this->create_multi_vector(num_vecs);
+        this->_mvec_t = this->create_multi_vector(num_vecs);
+      }
+
+      /**
+       * \brief Internal function, applies the solver
+       *
+       * \param[in] mvec_sol
+       * The current solution multi-vector, gets overwritten
+       *
+       * \returns A status code.
+       */
+      virtual Status _apply_intern(MultiVectorType& mvec_sol)
+      {
+        IterationStats pre_iter(*this);
+        Statistics::add_solver_expression<ExpressionStartSolve>(*this);
+
+        const MatrixType& matrix(this->_system_matrix);
+        MultiVectorType& mvec_r(this->_mvec_r);
+        MultiVectorType& mvec_p(this->_mvec_p);
+        // Note: q and z are temporary multi-vectors whose usage does
+        // not overlap, so we use the same multi-vector for them
+        MultiVectorType& mvec_q(this->_mvec_t);
+        MultiVectorType& mvec_z(this->_mvec_t);
+        const std::size_t k = std::size_t(mvec_r.columns());
+
+        // set initial defect:
+        // R[0] := B - A*X[0]
+        Status status = this->_set_initial_defect(mvec_r, mvec_sol);
+        if(status != Status::progress)
+        {
+          pre_iter.destroy();
+          Statistics::add_solver_expression<ExpressionEndSolve>(*this, status, this->get_num_iter());
+          return status;
+        }
+
+        // apply preconditioner to defect columns
+        // P[0] := M^{-1} * R[0]
+        if(!this->_apply_precond(mvec_p, mvec_r))
+        {
+          pre_iter.destroy();
+          Statistics::add_solver_expression<ExpressionEndSolve>(*this, Status::aborted, this->get_num_iter());
+          return Status::aborted;
+        }
+
+        // compute initial gammas:
+        // gamma_j[0] := < r_j[0], p_j[0] >
+        this->_col_dot(_gamma, mvec_r, mvec_p);
+
+        pre_iter.destroy();
+
+        // start iterating
+        while(status == Status::progress)
+        {
+          IterationStats stat(*this);
+
+          // Q[k] := A*P[k] for all columns at once
+          matrix.apply_multi(mvec_q, mvec_p);
+          this->_filter_def(mvec_q);
+
+          // compute alphas:
+          // alpha_j[k] := gamma_j[k] / < q_j[k], p_j[k] >
+          this->_col_dot(_temp, mvec_q, mvec_p);
+          _alpha.resize(k);
+          for(std::size_t j(0); j < k; ++j)
+            _alpha[j] = (Math::abs(_temp[j]) > DataType(0) ? _gamma[j] / _temp[j] : DataType(0));
+
+          // update solution:
+          // x_j[k+1] := x_j[k] + alpha_j[k] * p_j[k]
+          this->_col_axpy(mvec_sol, mvec_p, _alpha);
+
+          // update defect:
+          // r_j[k+1] := r_j[k] - alpha_j[k] * q_j[k]
+          for(std::size_t j(0); j < k; ++j)
+            _alpha[j] = -_alpha[j];
+          this->_col_axpy(mvec_r, mvec_q, _alpha);
+
+          // compute defect norm
+          status = this->_set_new_defect(mvec_r, mvec_sol);
+          if(status != Status::progress)
+          {
+            stat.destroy();
+            Statistics::add_solver_expression<ExpressionEndSolve>(*this, status, this->get_num_iter());
+            return status;
+          }
+
+          // apply preconditioner
+          // Z[k+1] := M^{-1} * R[k+1]
+          if(!this->_apply_precond(mvec_z, mvec_r))
+          {
+            stat.destroy();
+            Statistics::add_solver_expression<ExpressionEndSolve>(*this, Status::aborted, this->get_num_iter());
+            return Status::aborted;
+          }
+
+          // compute new gammas and betas:
+          // gamma_j[k+1] := < r_j[k+1] , z_j[k+1] >
+          // beta_j[k] := gamma_j[k+1] / gamma_j[k]
+          this->_col_dot(_temp, mvec_r, mvec_z);
+          _beta.resize(k);
+          for(std::size_t j(0); j < k; ++j)
+          {
+            _beta[j] = (Math::abs(_gamma[j]) > DataType(0) ? _temp[j] / _gamma[j] : DataType(0));
+            _gamma[j] = _temp[j];
+          }
+
+          // update direction:
+          // p_j[k+1] := z_j[k+1] + beta_j[k] * p_j[k]
+          this->_col_xpay(mvec_p, mvec_z, _beta);
+        }
+
+        // we should never reach this point...
+        Statistics::add_solver_expression<ExpressionEndSolve>(*this, Status::undefined, this->get_num_iter());
+        return Status::undefined;
+      }
+    }; // class MultiPCG<...>
+
+    /**
+     * \brief Creates a new MultiPCG solver object
+     *
+     * \param[in] matrix
+     * The system matrix.
+     *
+     * \param[in] filter
+     * The system filter.
+     *
+     * \param[in] precond
+     * The preconditioner. May be \c nullptr.
+     *
+     * \returns
+     * A shared pointer to a new MultiPCG object.
+     */
+     /// \compilerhack GCC < 4.9 fails to deduct shared_ptr
+#if defined(FEAT_COMPILER_GNU) && (FEAT_COMPILER_GNU < 40900)
+    template<typename Matrix_, typename Filter_>
+    inline std::shared_ptr<MultiPCG<Matrix_, Filter_>> new_multi_pcg(
+      const Matrix_& matrix, const Filter_& filter)
+    {
+      return std::make_shared<MultiPCG<Matrix_, Filter_>>(matrix, filter, nullptr);
+    }
+    template<typename Matrix_, typename Filter_, typename Precond_>
+    inline std::shared_ptr<MultiPCG<Matrix_, Filter_>> new_multi_pcg(
+      const Matrix_& matrix, const Filter_& filter,
+      std::shared_ptr<Precond_> precond)
+    {
+      return std::make_shared<MultiPCG<Matrix_, Filter_>>(matrix, filter, precond);
+    }
+#else
+    template<typename Matrix_, typename Filter_>
+    inline std::shared_ptr<MultiPCG<Matrix_, Filter_>> new_multi_pcg(
+      const Matrix_& matrix, const Filter_& filter,
+      std::shared_ptr<SolverBase<typename Matrix_::VectorTypeR>> precond = nullptr)
+    {
+      return std::make_shared<MultiPCG<Matrix_, Filter_>>(matrix, filter, precond);
+    }
+#endif
+
+    /**
+     * \brief Creates a new MultiPCG solver object using a PropertyMap
+     *
+     * \param[in] section_name
+     * The name of the config section, which it does not know by itself
+     *
+     * \param[in] section
+     * A pointer to the PropertyMap section configuring this solver
+     *
+     * \param[in] matrix
+     * The system matrix.
+     *
+     * \param[in] filter
+     * The system filter.
+     *
+     * \param[in] precond
+     * The preconditioner. May be \c nullptr.
+     *
+     * \returns
+     * A shared pointer to a new MultiPCG object.
+     */
+     /// \compilerhack GCC < 4.9 fails to deduct shared_ptr
+#if defined(FEAT_COMPILER_GNU) && (FEAT_COMPILER_GNU < 40900)
+    template<typename Matrix_, typename Filter_>
+    inline std::shared_ptr<MultiPCG<Matrix_, Filter_>> new_multi_pcg(
+      const String& section_name, PropertyMap* section,
+      const Matrix_& matrix, const Filter_& filter)
+    {
+      return std::make_shared<MultiPCG<Matrix_, Filter_>>(section_name, section, matrix, filter, nullptr);
+    }
+    template<typename Matrix_, typename Filter_, typename Precond_>
+    inline std::shared_ptr<MultiPCG<Matrix_, Filter_>> new_multi_pcg(
+      const String& section_name, PropertyMap* section,
+      const Matrix_& matrix, const Filter_& filter,
+      std::shared_ptr<Precond_> precond)
+    {
+      return std::make_shared<MultiPCG<Matrix_, Filter_>>(section_name, section, matrix, filter, precond);
+    }
+#else
+    template<typename Matrix_, typename Filter_>
+    inline std::shared_ptr<MultiPCG<Matrix_, Filter_>> new_multi_pcg(
+      const String& section_name, PropertyMap* section,
+      const Matrix_& matrix, const Filter_& filter,
+      std::shared_ptr<SolverBase<typename Matrix_::VectorTypeR>> precond = nullptr)
+    {
+      return std::make_shared<MultiPCG<Matrix_, Filter_>>(section_name, section, matrix, filter, precond);
+    }
+#endif
+  } // namespace Solver
+} // namespace FEAT
+
+#endif // KERNEL_SOLVER_MULTI_PCG_HPP
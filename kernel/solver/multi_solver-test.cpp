@@ -0,0 +1,203 @@
+// FEAT3: Finite Element Analysis Toolbox, Version 3
+// Copyright (C) 2010 - 2023 by Stefan Turek & the FEAT group
+// FEAT3 is released under the GNU General Public License version 3,
+// see the file 'copyright.txt' in the top level directory for details.
+
+#include <kernel/base_header.hpp>
+#include <test_system/test_system.hpp>
+#include <kernel/adjacency/graph.hpp>
+#include <kernel/lafem/pointstar_factory.hpp>
+#include <kernel/lafem/sparse_matrix_csr.hpp>
+#include <kernel/lafem/sparse_matrix_bcsr.hpp>
+#include <kernel/lafem/dense_vector.hpp>
+#include <kernel/lafem/dense_vector_blocked.hpp>
+#include <kernel/lafem/none_filter.hpp>
+#include <kernel/solver/multi_pcg.hpp>
+#include <kernel/solver/multi_fgmres.hpp>
+#include <kernel/solver/jacobi_precond.hpp>
+
+using namespace FEAT;
+using namespace FEAT::LAFEM;
+using namespace FEAT::Solver;
+using namespace FEAT::TestSystem;
+
+/**
+ * \brief Test class for the multi-right-hand-side apply and the multi-vector solvers.
+ *
+ * \test Tests the apply_multi functions of SparseMatrixCSR and SparseMatrixBCSR against the
+ * single vector apply as well as the MultiPCG and MultiFGMRES solvers.
+ */
+template<typename DT_, typename IT_>
+class MultiSolverTest :
+  public UnitTest
+{
+public:
+  typedef SparseMatrixCSR<DT_, IT_> MatrixCSR;
+  typedef SparseMatrixBCSR<DT_, IT_, 2, 2> MatrixBCSR;
+  typedef DenseMatrix<DT_, IT_> MultiVectorType;
+
+  MultiSolverTest(PreferredBackend backend) :
+    UnitTest("MultiSolverTest", Type::Traits<DT_>::name(), Type::Traits<IT_>::name(), backend)
+  {
+  }
+
+  virtual ~MultiSolverTest()
+  {
+  }
+
+  /// creates the SPD block matrix A (x) S with S = [[2,1],[1,2]]
+  static MatrixBCSR create_bcsr(const MatrixCSR& csr)
+  {
+    Adjacency::Graph graph(Adjacency::RenderType::as_is, csr);
+    MatrixBCSR bcsr(graph);
+    const DT_* a = csr.val();
+    auto* b = bcsr.val();
+    for(Index i(0); i < csr.used_elements(); ++i)
+    {
+      b[i][0][0] = b[i][1][1] = DT_(2) * a[i];
+      b[i][0][1] = b[i][1][0] = a[i];
+    }
+    return bcsr;
+  }
+
+  /// fills a multi-vector with some non-trivial values
+  static void fill(MultiVectorType& mvec, DT_ shift)
+  {
+    for(Index i(0); i < mvec.rows(); ++i)
+      for(Index j(0); j < mvec.columns(); ++j)
+        mvec(i, j, Math::sin(DT_(i+1) * (DT_(j) + shift)) + DT_(j) / DT_(3));
+  }
+
+  template<typename Matrix_>
+  void test_apply_multi(const Matrix_& matrix, Index num_vecs) const
+  {
+    typedef typename Matrix_::VectorTypeL VectorTypeL;
+    typedef typename Matrix_::VectorTypeR VectorTypeR;
+    typedef MultiIterativeSolver<Matrix_, NoneFilter<DT_, IT_>> MultiHelper;
+    const DT_ tol = Math::pow(Math::eps<DT_>(), DT_(0.8));
+
+    VectorTypeR vec_x(matrix.create_vector_r());
+    VectorTypeL vec_y(matrix.create_vector_l()), vec_r(matrix.create_vector_l()), vec_ref(matrix.create_vector_l());
+    const Index n = vec_x.template size<Perspective::pod>();
+
+    MultiVectorType mx(n, num_vecs), my(n, num_vecs), mr(n, num_vecs);
+    fill(mx, DT_(0.3));
+    fill(my, DT_(1.7));
+
+    // r := A*x
+    matrix.apply_multi(mr, mx);
+    for(Index j(0); j < num_vecs; ++j)
+    {
+      MultiHelper::get_column(vec_x, mx, j);
+      matrix.apply(vec_ref, vec_x);
+      MultiHelper::get_column(vec_r, mr, j);
+      vec_r.axpy(vec_ref, vec_r, -DT_(1));
+      TEST_CHECK_EQUAL_WITHIN_EPS(vec_r.max_abs_element(), DT_(0), tol * DT_(10));
+    }
+
+    // r := y - 0.7*A*x
+    matrix.apply_multi(mr, mx, my, -DT_(0.7));
+    for(Index j(0); j < num_vecs; ++j)
+    {
+      MultiHelper::get_column(vec_x, mx, j);
+      MultiHelper::get_column(vec_y, my, j);
+      matrix.apply(vec_ref, vec_x, vec_y, -DT_(0.7));
+      MultiHelper::get_column(vec_r, mr, j);
+      vec_r.axpy(vec_ref, vec_r, -DT_(1));
+      TEST_CHECK_EQUAL_WITHIN_EPS(vec_r.max_abs_element(), DT_(0), tol * DT_(10));
+    }
+
+    // in-place: y := y + A*x
+    MultiVectorType my2(my.clone());
+    matrix.apply_multi(my2, mx, my2);
+    matrix.apply_multi(mr, mx, my);
+    my2.axpy(mr, my2, -DT_(1));
+    TEST_CHECK_EQUAL_WITHIN_EPS(my2.norm_frobenius(), DT_(0), tol);
+  }
+
+  template<typename Matrix_, typename Filter_>
+  void test_solver(std::shared_ptr<MultiIterativeSolver<Matrix_, Filter_>> solver, const Matrix_& matrix, Index num_vecs) const
+  {
+    const DT_ tol = Math::pow(Math::eps<DT_>(), DT_(0.6));
+
+    // create reference solutions and compute the right-hand-sides
+    MultiVectorType mref = solver->create_multi_vector(num_vecs);
+    MultiVectorType mrhs = solver->create_multi_vector(num_vecs);
+    MultiVectorType msol = solver->create_multi_vector(num_vecs);
+    fill(mref, DT_(0.1));
+    // make the last column identical zero to check the treatment of trivial systems
+    for(Index i(0); i < mref.rows(); ++i)
+      mref(i, num_vecs-1, DT_(0));
+    matrix.apply_multi(mrhs, mref);
+    const DT_ ref_norm = mref.norm_frobenius();
+
+    solver->set_tol_rel(Math::pow(Math::eps<DT_>(), DT_(0.8)));
+    solver->set_max_iter(1000);
+    solver->init();
+    msol.format();
+    Status status = solver->correct(msol, mrhs);
+    TEST_CHECK_MSG(status_success(status), solver->get_plot_name() + ": failed to converge");
+    msol.axpy(mref, msol, -DT_(1));
+    TEST_CHECK_EQUAL_WITHIN_EPS(msol.norm_frobenius() / ref_norm, DT_(0), tol);
+
+    // apply must yield the same solutions
+    Status status2 = solver->apply(msol, mrhs);
+    TEST_CHECK(status_success(status2));
+    msol.axpy(mref, msol, -DT_(1));
+    TEST_CHECK_EQUAL_WITHIN_EPS(msol.norm_frobenius() / ref_norm, DT_(0), tol);
+
+    // scale the columns very differently: the solver must not stop before each column has
+    // reached the relative tolerance with respect to its own initial defect
+    const DT_ tol_rel = Math::pow(Math::eps<DT_>(), DT_(0.5));
+    for(Index i(0); i < mrhs.rows(); ++i)
+      for(Index j(0); j < num_vecs; ++j)
+        mrhs(i, j, mrhs(i, j) * Math::pow(DT_(10), -DT_(3*j)));
+    solver->set_tol_rel(tol_rel);
+    msol.format();
+    Status status3 = solver->correct(msol, mrhs);
+    TEST_CHECK(status_success(status3));
+    MultiVectorType mdef = solver->create_multi_vector(num_vecs);
+    matrix.apply_multi(mdef, msol, mrhs, -DT_(1));
+    for(Index j(0); j < num_vecs; ++j)
+    {
+      DT_ def_sqr(0), rhs_sqr(0);
+      for(Index i(0); i < mrhs.rows(); ++i)
+      {
+        def_sqr += Math::sqr(mdef(i, j));
+        rhs_sqr += Math::sqr(mrhs(i, j));
+      }
+      TEST_CHECK(Math::sqrt(def_sqr) <= tol_rel * Math::sqrt(rhs_sqr) * DT_(1.01));
+    }
+    solver->done();
+  }
+
+  virtual void run() const override
+  {
+    PointstarFactoryFD<DT_, IT_> psf(Index(17), Index(2));
+    MatrixCSR csr = psf.matrix_csr();
+    MatrixBCSR bcsr = create_bcsr(csr);
+
+    // test the apply_multi functions, including RHS counts, which are not multiples of the chunk sizes
+    for(Index k(1); k <= Index(11); k += Index(5))
+    {
+      test_apply_multi(csr, k);
+      test_apply_multi(bcsr, k);
+    }
+
+    NoneFilter<DT_, IT_> filter;
+    NoneFilterBlocked<DT_, IT_, 2> filter_b;
+
+    // test solvers on CSR matrix
+    test_solver<MatrixCSR, NoneFilter<DT_, IT_>>(new_multi_pcg(csr, filter), csr, Index(5));
+    test_solver<MatrixCSR, NoneFilter<DT_, IT_>>(new_multi_pcg(csr, filter, new_jacobi_precond(csr, filter)), csr, Index(9));
+    test_solver<MatrixCSR, NoneFilter<DT_, IT_>>(new_multi_fgmres(csr, filter, Index(16)), csr, Index(3));
+    test_solver<MatrixCSR, NoneFilter<DT_, IT_>>(new_multi_fgmres(csr, filter, Index(16), new_jacobi_precond(csr, filter)), csr, Index(8));
+
+    // test solvers on BCSR matrix
+    test_solver<MatrixBCSR, NoneFilterBlocked<DT_, IT_, 2>>(new_multi_pcg(bcsr, filter_b), bcsr, Index(4));
+    test_solver<MatrixBCSR, NoneFilterBlocked<DT_, IT_, 2>>(new_multi_fgmres(bcsr, filter_b, Index(16)), bcsr, Index(5));
+  }
+};
+
+MultiSolverTest<double, std::uint32_t> multi_solver_test_double_uint32(PreferredBackend::generic);
+MultiSolverTest<double, std::uint64_t> multi_solver_test_double_uint64(PreferredBackend::generic);
@@ -1269,7 +1269,7 @@ namespace FEAT
        */
       virtual Status apply(VectorType& vec_cor, const VectorType& vec_def) override
       {
-        Statistics::add_solver_expression(std::make_shared<ExpressionStartSolve>(this->name()));
+        Statistics::add_solver_expression<ExpressionStartSolve>(*this);
 
         // reset statistics counters
         for(std::size_t i(0); i <  std::size_t(_hierarchy->size_virtual()); ++i)
@@ -1309,7 +1309,7 @@ namespace FEAT
 
         default:
           // whoops...
-          Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::aborted, 1));
+          Statistics::add_solver_expression<ExpressionEndSolve>(*this, Status::aborted, 1);
           status = Status::aborted;
           break;
         }
@@ -1320,13 +1320,13 @@ namespace FEAT
         // propagate solver statistics
         for(std::size_t i(0); i <  std::size_t(_hierarchy->size_virtual()); ++i)
         {
-          Statistics::add_solver_expression(std::make_shared<ExpressionLevelTimings>(this->name(), Index(i),
+          Statistics::add_solver_expression<ExpressionLevelTimings>(*this, Index(i),
             _toes.at(i), _mpi_execs_reduction.at(i), _mpi_execs_blas2.at(i), _mpi_execs_blas3.at(i), _mpi_execs_collective.at(i), _mpi_waits_reduction.at(i), _mpi_waits_blas2.at(i),
-            _mpi_waits_blas3.at(i), _mpi_waits_collective.at(i)));
+            _mpi_waits_blas3.at(i), _mpi_waits_collective.at(i));
         }
 
         // okay
-        Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::success, 1));
+        Statistics::add_solver_expression<ExpressionEndSolve>(*this, Status::success, 1);
         return status;
       }
 
@@ -1551,19 +1551,23 @@ namespace FEAT
 
         // if the have a coarse grid solver, apply it
         TimeStamp stamp_coarse;
-        if(coarse_solver)
         {
-          Statistics::add_solver_expression(std::make_shared<ExpressionCallCoarseSolver>(this->name(), coarse_solver->name()));
-          if(!status_success(coarse_solver->apply(lvl_crs.vec_sol, lvl_crs.vec_rhs)))
-            return Status::aborted;
-        }
-        else
-        {
-          // simply copy the RHS thus emulating an identity solver
-          lvl_crs.vec_sol.copy(lvl_crs.vec_rhs);
+          FEAT_TRACE_SCOPE_EX(TraceKind::multigrid, "MultiGrid::coarse", _crs_level, 0u);
+          FEAT_PERF_REGION_LEVEL("MultiGrid::coarse", _crs_level);
+          if(coarse_solver)
+          {
+            Statistics::add_solver_expression<ExpressionCallCoarseSolver>(*this, coarse_solver);
+            if(!status_success(coarse_solver->apply(lvl_crs.vec_sol, lvl_crs.vec_rhs)))
+              return Status::aborted;
+          }
+          else
+          {
+            // simply copy the RHS thus emulating an identity solver
+            lvl_crs.vec_sol.copy(lvl_crs.vec_rhs);
 
-          // apply the correction filter
-          system_filter.filter_cor(lvl_crs.vec_sol);
+            // apply the correction filter
+            system_filter.filter_cor(lvl_crs.vec_sol);
+          }
         }
         lvl_crs.time_coarse += stamp_coarse.elapsed_now();
 
@@ -1599,8 +1603,12 @@ namespace FEAT
 
         // apply peak-smoother
         TimeStamp stamp_smooth;
-        Statistics::add_solver_expression(std::make_shared<ExpressionCallSmoother>(this->name(), smoother.name()));
-        smoother.apply(lvl.vec_cor, lvl.vec_def);
+        Statistics::add_solver_expression<ExpressionCallSmoother>(*this, smoother);
+        {
+          FEAT_TRACE_SCOPE_EX(TraceKind::multigrid, "MultiGrid::smooth_peak", cur_lvl, 0u);
+          FEAT_PERF_REGION_LEVEL("MultiGrid::smooth_peak", cur_lvl);
+          smoother.apply(lvl.vec_cor, lvl.vec_def);
+        }
         //if(!status_success(smoother.apply(lvl.vec_cor, lvl.vec_def)))
           //return false;
         lvl.time_smooth += stamp_smooth.elapsed_now();
@@ -1749,8 +1757,12 @@ namespace FEAT
             {
               // apply pre-smoother
               TimeStamp stamp_smooth;
-              Statistics::add_solver_expression(std::make_shared<ExpressionCallSmoother>(this->name(), smoother->name()));
-              smoother->apply(lvl_f.vec_sol, lvl_f.vec_rhs);
+              Statistics::add_solver_expression<ExpressionCallSmoother>(*this, smoother);
+              {
+                FEAT_TRACE_SCOPE_EX(TraceKind::multigrid, "MultiGrid::smooth_pre", i, 0u);
+                FEAT_PERF_REGION_LEVEL("MultiGrid::smooth_pre", i);
+                smoother->apply(lvl_f.vec_sol, lvl_f.vec_rhs);
+              }
               //if(!status_success(smoother->apply(lvl_f.vec_sol, lvl_f.vec_rhs)))
                 //return Status::aborted;
               lvl_f.time_smooth += stamp_smooth.elapsed_now();
@@ -1785,7 +1797,11 @@ namespace FEAT
           {
             // send restriction to parent processes and return
             TimeStamp stamp_rest;
-            transfer_operator->rest_send(lvl_f.vec_def);
+            {
+              FEAT_TRACE_SCOPE_EX(TraceKind::multigrid, "MultiGrid::rest_send", i, 0u);
+              FEAT_PERF_REGION_LEVEL("MultiGrid::rest_send", i);
+              transfer_operator->rest_send(lvl_f.vec_def);
+            }
             lvl_f.time_transfer += stamp_rest.elapsed_now();
             break_loop = true;
           }
@@ -1796,9 +1812,13 @@ namespace FEAT
             const FilterType& system_filter_c = lvl_c.level->get_system_filter();
 
             // restrict onto coarse level
-            //Statistics::add_solver_expression(std::make_shared<ExpressionRestriction>(this->name(), i));
+            //Statistics::add_solver_expression<ExpressionRestriction>(*this, i);
             TimeStamp stamp_rest;
-            transfer_operator->rest(lvl_f.vec_def, lvl_c.vec_rhs);
+            {
+              FEAT_TRACE_SCOPE_EX(TraceKind::multigrid, "MultiGrid::rest", i, 0u);
+              FEAT_PERF_REGION_LEVEL("MultiGrid::rest", i);
+              transfer_operator->rest(lvl_f.vec_def, lvl_c.vec_rhs);
+            }
             lvl_f.time_transfer += stamp_rest.elapsed_now();
 
             // filter coarse defect
@@ -1872,7 +1892,11 @@ namespace FEAT
           {
             // receive prolongation
             TimeStamp stamp_prol;
-            transfer_operator->prol_recv(lvl_f.vec_cor);
+            {
+              FEAT_TRACE_SCOPE_EX(TraceKind::multigrid, "MultiGrid::prol_recv", i, 0u);
+              FEAT_PERF_REGION_LEVEL("MultiGrid::prol_recv", i);
+              transfer_operator->prol_recv(lvl_f.vec_cor);
+            }
             lvl_f.time_transfer += stamp_prol.elapsed_now();
           }
           else
@@ -1882,7 +1906,11 @@ namespace FEAT
 
             // prolongate
             TimeStamp stamp_prol;
-            transfer_operator->prol(lvl_f.vec_cor, lvl_c.vec_sol);
+            {
+              FEAT_TRACE_SCOPE_EX(TraceKind::multigrid, "MultiGrid::prol", i, 0u);
+              FEAT_PERF_REGION_LEVEL("MultiGrid::prol", i);
+              transfer_operator->prol(lvl_f.vec_cor, lvl_c.vec_sol);
+            }
             lvl_f.time_transfer += stamp_prol.elapsed_now();
           }
 
@@ -1966,9 +1994,13 @@ namespace FEAT
             }
 
             // apply post-smoother
-            Statistics::add_solver_expression(std::make_shared<ExpressionCallSmoother>(this->name(), smoother->name()));
+            Statistics::add_solver_expression<ExpressionCallSmoother>(*this, smoother);
             TimeStamp stamp_smooth;
-            smoother->apply(lvl_f.vec_cor, lvl_f.vec_def);
+            {
+              FEAT_TRACE_SCOPE_EX(TraceKind::multigrid, "MultiGrid::smooth_post", i, 0u);
+              FEAT_PERF_REGION_LEVEL("MultiGrid::smooth_post", i);
+              smoother->apply(lvl_f.vec_cor, lvl_f.vec_def);
+            }
             //if(!status_success(smoother->apply(lvl_f.vec_cor, lvl_f.vec_def)))
               //return Status::aborted;
             lvl_f.time_smooth += stamp_smooth.elapsed_now();
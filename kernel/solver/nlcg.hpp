@@ -423,7 +423,7 @@ namespace FEAT
         virtual Status _apply_intern(VectorType& vec_sol)
         {
           IterationStats pre_iter(*this);
-          Statistics::add_solver_expression(std::make_shared<ExpressionStartSolve>(this->name()));
+          Statistics::add_solver_expression<ExpressionStartSolve>(*this);
 
           // p[k+1] <- r[k+1] + _beta * p[k+1]
           DataType beta;
@@ -441,14 +441,14 @@ namespace FEAT
           Status status = this->_set_initial_defect(this->_vec_r, vec_sol);
           if(status != Status::progress)
           {
-            Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), status, this->get_num_iter()));
+            Statistics::add_solver_expression<ExpressionEndSolve>(*this, status, this->get_num_iter());
             return status;
           }
 
           // apply preconditioner to defect vector
           if(!this->_apply_precond(this->_vec_z, this->_vec_r, this->_filter))
           {
-            Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::aborted, this->get_num_iter()));
+            Statistics::add_solver_expression<ExpressionEndSolve>(*this, Status::aborted, this->get_num_iter());
             return Status::aborted;
           }
           //this->_vec_z.copy(this->_vec_r);
@@ -479,7 +479,7 @@ namespace FEAT
 
           if(this->_def_init <= this->_tol_rel)
           {
-            Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::success, this->get_num_iter()));
+            Statistics::add_solver_expression<ExpressionEndSolve>(*this, Status::success, this->get_num_iter());
             return Status::success;
           }
 
@@ -534,7 +534,7 @@ namespace FEAT
             if(status != Status::progress)
             {
               stat.destroy();
-              Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), status, this->get_num_iter()));
+              Statistics::add_solver_expression<ExpressionEndSolve>(*this, status, this->get_num_iter());
               return status;
             }
 
@@ -548,7 +548,7 @@ namespace FEAT
             if(!this->_apply_precond(_vec_z, _vec_r, this->_filter))
             {
               stat.destroy();
-              Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::aborted, this->get_num_iter()));
+              Statistics::add_solver_expression<ExpressionEndSolve>(*this, Status::aborted, this->get_num_iter());
               return Status::aborted;
             }
 
@@ -616,7 +616,7 @@ namespace FEAT
           }
 
           // We should never come to this point
-          Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::undefined, this->get_num_iter()));
+          Statistics::add_solver_expression<ExpressionEndSolve>(*this, Status::undefined, this->get_num_iter());
           return Status::undefined;
         }
 
@@ -167,12 +167,12 @@ namespace FEAT
         /// \copydoc BaseClass::apply()
         virtual Solver::Status apply(VectorType& vec_cor, const VectorType& vec_def) override
         {
-          Statistics::add_solver_expression(std::make_shared<ExpressionStartSolve>(this->name()));
-          Statistics::add_solver_expression(std::make_shared<ExpressionCallPrecond>(this->name(), _op.name()));
+          Statistics::add_solver_expression<ExpressionStartSolve>(*this);
+          Statistics::add_solver_expression<ExpressionCallPrecond>(*this, _op);
 
           Solver::Status st(_op.apply(vec_cor, vec_def));
 
-          Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), st, 1));
+          Statistics::add_solver_expression<ExpressionEndSolve>(*this, st, 1);
 
           return st;
         }
@@ -278,8 +278,7 @@ namespace FEAT
           _steplength = DataType(1);
           _ls_its = Index(0);
 
-          Statistics::add_solver_expression(
-            std::make_shared<ExpressionDefect>(this->name(), this->_def_init, this->get_num_iter()));
+          Statistics::add_solver_expression<ExpressionDefect>(*this, this->_def_init, this->get_num_iter());
 
           if(this->_plot_iter())
           {
@@ -339,8 +338,7 @@ namespace FEAT
           if(calc_def)
           {
             this->_def_cur = this->_calc_def_norm(vec_r, vec_sol);
-            Statistics::add_solver_expression(
-              std::make_shared<ExpressionDefect>(this->name(), this->_def_cur, this->get_num_iter()));
+            Statistics::add_solver_expression<ExpressionDefect>(*this, this->_def_cur, this->get_num_iter());
           }
 
           // plot?
@@ -263,7 +263,7 @@ namespace FEAT
          */
         virtual Status _apply_intern(VectorType& vec_sol)
         {
-          Statistics::add_solver_expression(std::make_shared<ExpressionStartSolve>(this->name()));
+          Statistics::add_solver_expression<ExpressionStartSolve>(*this);
 
           // Reset member variables in the LineSearch
           _linesearch->reset();
@@ -277,7 +277,7 @@ namespace FEAT
           Status status = this->_set_initial_defect(this->_vec_r, vec_sol);
           if(status != Status::progress)
           {
-            Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), status, this->get_num_iter()));
+            Statistics::add_solver_expression<ExpressionEndSolve>(*this, status, this->get_num_iter());
             return status;
           }
 
@@ -287,7 +287,7 @@ namespace FEAT
           // apply preconditioner to defect vector
           if(!this->_apply_precond(this->_vec_p, this->_vec_r, this->_filter))
           {
-            Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::aborted, this->get_num_iter()));
+            Statistics::add_solver_expression<ExpressionEndSolve>(*this, Status::aborted, this->get_num_iter());
             return Status::aborted;
           }
 
@@ -337,7 +337,7 @@ namespace FEAT
 
             if(status != Status::progress)
             {
-              Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), status, this->get_num_iter()));
+              Statistics::add_solver_expression<ExpressionEndSolve>(*this, status, this->get_num_iter());
               return status;
             }
 
@@ -350,7 +350,7 @@ namespace FEAT
             // apply preconditioner
             if(!this->_apply_precond(_vec_p, _vec_r, this->_filter))
             {
-              Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::aborted, this->get_num_iter()));
+              Statistics::add_solver_expression<ExpressionEndSolve>(*this, Status::aborted, this->get_num_iter());
               return Status::aborted;
             }
 
@@ -366,7 +366,7 @@ namespace FEAT
           }
 
           // We should never come to this point
-          Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::undefined, this->get_num_iter()));
+          Statistics::add_solver_expression<ExpressionEndSolve>(*this, Status::undefined, this->get_num_iter());
           return Status::undefined;
         }
 
@@ -227,7 +227,7 @@ namespace FEAT
          */
         virtual Status _apply_intern(VectorType& vec_sol, const VectorType& vec_rhs)
         {
-          Statistics::add_solver_expression(std::make_shared<ExpressionStartSolve>(this->name()));
+          Statistics::add_solver_expression<ExpressionStartSolve>(*this);
 
           const Index inner_iter_digits(Math::ilog10(_inner_solver->get_max_iter()));
 
@@ -246,7 +246,7 @@ namespace FEAT
             Status inner_st(_inner_solver->correct(vec_sol, vec_rhs));
             if(inner_st == Status::aborted)
             {
-              Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::aborted, this->get_num_iter()));
+              Statistics::add_solver_expression<ExpressionEndSolve>(*this, Status::aborted, this->get_num_iter());
               return Status::aborted;
             }
 
@@ -271,35 +271,35 @@ namespace FEAT
             // ensure that the defect is neither NaN nor infinity
             if(!Math::isfinite(this->_def_cur))
             {
-              Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::aborted, this->get_num_iter()));
+              Statistics::add_solver_expression<ExpressionEndSolve>(*this, Status::aborted, this->get_num_iter());
               return Status::aborted;
             }
 
             // is diverged?
             if(this->is_diverged())
             {
-              Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::diverged, this->get_num_iter()));
+              Statistics::add_solver_expression<ExpressionEndSolve>(*this, Status::diverged, this->get_num_iter());
               return Status::diverged;
             }
 
             // minimum number of iterations performed?
             if(this->_num_iter < this->_min_iter)
             {
-              Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::progress, this->get_num_iter()));
+              Statistics::add_solver_expression<ExpressionEndSolve>(*this, Status::progress, this->get_num_iter());
               return Status::progress;
             }
 
             // maximum number of iterations performed?
             if(this->_num_iter >= this->_max_iter)
             {
-              Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::max_iter, this->get_num_iter()));
+              Statistics::add_solver_expression<ExpressionEndSolve>(*this, Status::max_iter, this->get_num_iter());
               return Status::max_iter;
             }
 
             // Check for convergence
             if(this->is_converged())
             {
-              Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::success, this->get_num_iter()));
+              Statistics::add_solver_expression<ExpressionEndSolve>(*this, Status::success, this->get_num_iter());
               return Status::success;
             }
 
@@ -309,7 +309,7 @@ namespace FEAT
 
             if(penalty_param >= _tol_penalty)
             {
-              Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::stagnated, this->get_num_iter()));
+              Statistics::add_solver_expression<ExpressionEndSolve>(*this, Status::stagnated, this->get_num_iter());
               return Status::stagnated;
             }
 
@@ -317,7 +317,7 @@ namespace FEAT
           }
 
           // We should never come to this point
-          Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::undefined, this->get_num_iter()));
+          Statistics::add_solver_expression<ExpressionEndSolve>(*this, Status::undefined, this->get_num_iter());
           return Status::undefined;
         }
 
@@ -343,7 +343,7 @@ namespace FEAT
         //Statistics::add_solver_defect(this->_branch, double(this->_def_init));
         this->_num_iter = Index(0);
         this->_num_stag_iter = Index(0);
-        Statistics::add_solver_expression(std::make_shared<ExpressionDefect>(this->name(), this->_def_init, this->get_num_iter()));
+        Statistics::add_solver_expression<ExpressionDefect>(*this, this->_def_init, this->get_num_iter());
 
         // Plot?
         if(this->_plot_iter())
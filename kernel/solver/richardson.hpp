@@ -187,7 +187,7 @@ namespace FEAT
       virtual Status _apply_intern(VectorType& vec_sol, const VectorType& vec_rhs)
       {
         IterationStats pre_iter(*this);
-        Statistics::add_solver_expression(std::make_shared<ExpressionStartSolve>(this->name()));
+        Statistics::add_solver_expression<ExpressionStartSolve>(*this);
 
         VectorType& vec_def(this->_vec_def);
         VectorType& vec_cor(this->_vec_cor);
@@ -207,7 +207,7 @@ namespace FEAT
           // apply preconditioner
           if(!this->_apply_precond(vec_cor, vec_def, filter))
           {
-            Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), Status::aborted, this->get_num_iter()));
+            Statistics::add_solver_expression<ExpressionEndSolve>(*this, Status::aborted, this->get_num_iter());
             return Status::aborted;
           }
           //filter.filter_cor(vec_cor);
@@ -224,7 +224,7 @@ namespace FEAT
         }
 
         // return our status
-        Statistics::add_solver_expression(std::make_shared<ExpressionEndSolve>(this->name(), status, this->get_num_iter()));
+        Statistics::add_solver_expression<ExpressionEndSolve>(*this, status, this->get_num_iter());
         return status;
       }
     }; // class Richardson<...>
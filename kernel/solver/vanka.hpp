@@ -1510,47 +1510,83 @@ namespace FEAT
         // format block data
         ::memset(data, 0, sizeof(DataType) * _data.size());
 
-        // allocate pivot array
-        std::vector<IndexType> pivot(3*(dim*_degree_v + _degree_p));
-
-        // current block offset
-        IndexType block_offset = IndexType(0);
-
-        // loop over all blocks
+        // compute block data offsets
         const IndexType nblocks = IndexType(_block_v_ptr.size() - 1);
+        std::vector<IndexType> block_offset(nblocks + 1u, IndexType(0));
         for(IndexType iblock(0); iblock < nblocks; ++iblock)
         {
-          // get number of velocity and pressure dofs
-          const IndexType nv = vptr[iblock+1] - vptr[iblock];
-          const IndexType np = pptr[iblock+1] - pptr[iblock];
+          const IndexType n = dim*(vptr[iblock+1] - vptr[iblock]) + pptr[iblock+1] - pptr[iblock];
+          block_offset[iblock+1] = block_offset[iblock] + n*n;
+        }
 
-          // get our local indices
-          const IndexType* loc_vidx = &vidx[vptr[iblock]];
-          const IndexType* loc_pidx = &pidx[pptr[iblock]];
+        // the blocks are independent of each other, so they can be gathered in parallel
+        FEAT_PRAGMA_OMP(parallel)
+        {
+          // loop over all blocks
+          FEAT_PRAGMA_OMP(for schedule(dynamic, 64))
+          for(IndexType iblock = 0; iblock < nblocks; ++iblock)
+          {
+            // get number of velocity and pressure dofs
+            const IndexType nv = vptr[iblock+1] - vptr[iblock];
+            const IndexType np = pptr[iblock+1] - pptr[iblock];
 
-          // compute matrix stride
-          const IndexType n = dim*nv + np;
-          const IndexType block_size = n*n;
+            // get our local indices
+            const IndexType* loc_vidx = &vidx[vptr[iblock]];
+            const IndexType* loc_pidx = &pidx[pptr[iblock]];
 
-          // get our block data array pointer
-          DataType* block_data = &data[block_offset];
+            // compute matrix stride
+            const IndexType n = dim*nv + np;
 
-          // gather matrix a
-          std::pair<IndexType,IndexType> ao =
-            vanka_a.gather_full(block_data, loc_vidx, loc_vidx, nv, nv, n);
-          vanka_b.gather_full(block_data, loc_vidx, loc_pidx, nv, np, n, IndexType(0), ao.second);
-          vanka_d.gather_full(block_data, loc_pidx, loc_vidx, np, nv, n, ao.first, IndexType(0));
+            // get our block data array pointer
+            DataType* block_data = &data[block_offset[iblock]];
 
-          // invert local matrix block
-          /*DataType ret =*/ Math::invert_matrix(n, n, block_data, pivot.data());
-          //if(!Math::isnormal(ret))
-          //{
-            // Don't throw any exceptions, as this often leads to false alerts
-            //throw VankaFactorError();
-          //}
+            // gather matrix a
+            std::pair<IndexType,IndexType> ao =
+              vanka_a.gather_full(block_data, loc_vidx, loc_vidx, nv, nv, n);
+            vanka_b.gather_full(block_data, loc_vidx, loc_pidx, nv, np, n, IndexType(0), ao.second);
+            vanka_d.gather_full(block_data, loc_pidx, loc_vidx, np, nv, n, ao.first, IndexType(0));
+          }
+        }
 
-          // increment block data offset
-          block_offset += block_size;
+        // consecutive blocks of the same size are stored contiguously, so each long run of such blocks
+        // is inverted as one batch of identically sized matrices, whereas the blocks of all short runs
+        // are inverted individually in parallel
+        // Note: don't throw any exceptions for singular blocks, as this often leads to false alerts
+        const IndexType min_batch = IndexType(16);
+        std::vector<IndexType> single_blocks;
+        for(IndexType ibeg(0), iend(0); ibeg < nblocks; ibeg = iend)
+        {
+          const IndexType nn = block_offset[ibeg+1] - block_offset[ibeg];
+          for(iend = ibeg + 1u; iend < nblocks; ++iend)
+          {
+            if(block_offset[iend+1] - block_offset[iend] != nn)
+              break;
+          }
+
+          if(iend - ibeg < min_batch)
+          {
+            for(IndexType i(ibeg); i < iend; ++i)
+              single_blocks.push_back(i);
+            continue;
+          }
+
+          const IndexType n = dim*(vptr[ibeg+1] - vptr[ibeg]) + pptr[ibeg+1] - pptr[ibeg];
+          Math::invert_matrix_batched(iend - ibeg, n, n, &data[block_offset[ibeg]]);
+        }
+
+        const IndexType num_single = IndexType(single_blocks.size());
+        FEAT_PRAGMA_OMP(parallel if(num_single > min_batch))
+        {
+          // allocate pivot array
+          std::vector<IndexType> pivot(3*(dim*_degree_v + _degree_p));
+
+          FEAT_PRAGMA_OMP(for schedule(dynamic, 16))
+          for(IndexType k = 0; k < num_single; ++k)
+          {
+            const IndexType iblock = single_blocks[k];
+            const IndexType n = dim*(vptr[iblock+1] - vptr[iblock]) + pptr[iblock+1] - pptr[iblock];
+            Math::invert_matrix(n, n, &data[block_offset[iblock]], pivot.data());
+          }
         }
       }
 
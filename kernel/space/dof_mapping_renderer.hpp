@@ -22,6 +22,9 @@ namespace FEAT
     class DofMappingRenderer
     {
     public:
+      /// minimum number of cells for the parallel rendering
+      static constexpr Index min_parallel_cells = Index(4096);
+
       /**
        * \brief Renders the dof-mapping of a space into an adjacency graph.
        *
@@ -34,45 +37,52 @@ namespace FEAT
       template<typename Space_>
       static Adjacency::Graph render(const Space_& space)
       {
-        // create a dof-mapping
-        typename Space_::DofMappingType dof_map(space);
-
         // fetch the number of cells and dofs
         const Index num_cells(space.get_mesh().get_num_entities(Space_::shape_dim)); //num_cells
         const Index num_dofs(space.get_num_dofs()); //num_dofs
 
-        // loop over all cells and build the domain pointer array
+        // the domain pointer and image index arrays; the latter is allocated after counting
+        Adjacency::Graph::IndexVector dom_ptr(num_cells + 1u, Index(0));
+        Adjacency::Graph::IndexVector img_idx;
 
-        Index num_indices_image(0);
-        for(Index i(0); i < num_cells; ++i)
+        FEAT_PRAGMA_OMP(parallel if(num_cells >= min_parallel_cells))
         {
-          dof_map.prepare(i);
-          num_indices_image += Index(dof_map.get_num_local_dofs());
-          dof_map.finish();
-        }
-        // create an adjacency graph
-        Adjacency::Graph graph (num_cells, num_dofs, num_indices_image) ;
-        Index* dom_ptr = graph.get_domain_ptr();
-        Index* img_idx = graph.get_image_idx();
+          // create a dof-mapping for this thread
+          typename Space_::DofMappingType dof_map(space);
+
+          // loop over all cells and count the local dofs
+          FEAT_PRAGMA_OMP(for schedule(static))
+          for(Index i = 0; i < num_cells; ++i)
+          {
+            dof_map.prepare(i);
+            dom_ptr[i+1] = Index(dof_map.get_num_local_dofs());
+            dof_map.finish();
+          }
 
-        //build the domain pointer array
-        //loop over all cells and build the image index array
-        dom_ptr[0] = Index(0);
+          // build the domain pointer array
+          FEAT_PRAGMA_OMP(single)
+          {
+            for(Index i(0); i < num_cells; ++i)
+              dom_ptr[i+1] += dom_ptr[i];
+            img_idx.resize(dom_ptr[num_cells]);
+          }
 
-        for(Index i(0); i < num_cells; ++i)
-        {
-          Index l(dom_ptr[i]);
-          dof_map.prepare(i);
-          dom_ptr[i + 1] = l + Index(dof_map.get_num_local_dofs());
-          for(int j(0); j < dof_map.get_num_local_dofs(); ++j, ++l)
+          // loop over all cells and build the image index array
+          FEAT_PRAGMA_OMP(for schedule(static))
+          for(Index i = 0; i < num_cells; ++i)
           {
-            img_idx[l] = dof_map.get_index(j);
+            Index l(dom_ptr[i]);
+            dof_map.prepare(i);
+            for(int j(0); j < dof_map.get_num_local_dofs(); ++j, ++l)
+            {
+              img_idx[l] = dof_map.get_index(j);
+            }
+            dof_map.finish();
           }
-          dof_map.finish();
         }
 
         // create an adjacency graph
-        return graph;
+        return Adjacency::Graph(num_dofs, std::move(dom_ptr), std::move(img_idx));
       }
     }; // class DofMappingRenderer
   } // namespace Space
@@ -66,6 +66,15 @@ namespace FEAT
       /// maximum number of local DOFs
       static constexpr int max_local_dofs = SpaceEvalTraits::max_local_dofs;
 
+      /**
+       * \brief Specifies whether the reference basis data is independent of the current cell
+       *
+       * If this is \c true, then the reference basis values, gradients and hessians only depend on the
+       * point on the reference cell, so they can be tabulated once per cubature rule by the
+       * RefBasisTabulation class template instead of being re-evaluated on each cell.
+       */
+      static constexpr bool ref_data_cell_invariant = false;
+
       template<SpaceTags cfg_>
       struct ConfigTraits
       {
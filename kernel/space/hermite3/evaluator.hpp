@@ -141,6 +141,9 @@ namespace FEAT
         /// base-class typedef
         typedef ParametricEvaluator<Evaluator, TrafoEvaluator_, SpaceEvalTraits_, ref_caps> BaseClass;
 
+        /// reference basis data is not cell invariant, because the basis functions are scaled by the cell size
+        static constexpr bool ref_data_cell_invariant = false;
+
         /// space type
         typedef Space_ SpaceType;
 
@@ -302,6 +305,9 @@ namespace FEAT
         /// base-class typedef
         typedef ParametricEvaluator<Evaluator, TrafoEvaluator_, SpaceEvalTraits_, ref_caps> BaseClass;
 
+        /// reference basis data is not cell invariant, because the basis functions are scaled by the cell size
+        static constexpr bool ref_data_cell_invariant = false;
+
         /// space type
         typedef Space_ SpaceType;
 
@@ -679,6 +685,9 @@ namespace FEAT
         /// base-class typedef
         typedef ParametricEvaluator<Evaluator, TrafoEvaluator_, SpaceEvalTraits_, ref_caps> BaseClass;
 
+        /// reference basis data is not cell invariant, because the basis functions are scaled by the cell size
+        static constexpr bool ref_data_cell_invariant = false;
+
         /// space type
         typedef Space_ SpaceType;
 
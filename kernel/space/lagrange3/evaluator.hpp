@@ -151,6 +151,9 @@ namespace FEAT
         /// base-class typedef
         typedef ParametricEvaluator<Evaluator, TrafoEvaluator_, SpaceEvalTraits_, ref_caps> BaseClass;
 
+        /// reference basis data is not cell invariant, because the basis functions depend on the edge orientations
+        static constexpr bool ref_data_cell_invariant = false;
+
         /// space type
         typedef Space_ SpaceType;
 
@@ -357,6 +360,9 @@ namespace FEAT
         /// base-class typedef
         typedef ParametricEvaluator<Evaluator, TrafoEvaluator_, SpaceEvalTraits_, ref_caps_3d> BaseClass;
 
+        /// reference basis data is not cell invariant, because the basis functions depend on the edge orientations
+        static constexpr bool ref_data_cell_invariant = false;
+
         /// space type
         typedef Space_ SpaceType;
 
@@ -705,6 +711,9 @@ namespace FEAT
         /// base-class typedef
         typedef ParametricEvaluator<Evaluator, TrafoEvaluator_, SpaceEvalTraits_, ref_caps> BaseClass;
 
+        /// reference basis data is not cell invariant, because the basis functions depend on the edge orientations
+        static constexpr bool ref_data_cell_invariant = false;
+
         /// space type
         typedef Space_ SpaceType;
 
@@ -958,6 +967,9 @@ namespace FEAT
         /// base-class typedef
         typedef ParametricEvaluator<Evaluator, TrafoEvaluator_, SpaceEvalTraits_, ref_caps_3d> BaseClass;
 
+        /// reference basis data is not cell invariant, because the basis functions depend on the edge orientations
+        static constexpr bool ref_data_cell_invariant = false;
+
         /// space type
         typedef Space_ SpaceType;
 
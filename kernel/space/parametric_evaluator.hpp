@@ -95,6 +95,9 @@ namespace FEAT
       /// maximum number of local dofs
       static constexpr int max_local_dofs = SpaceEvalTraits::max_local_dofs;
 
+      /// reference basis data is cell invariant unless the derived class overrides this
+      static constexpr bool ref_data_cell_invariant = true;
+
       /**
        * \brief Space configuration traits class template.
        */
@@ -178,6 +181,41 @@ namespace FEAT
         // transform basis hessians
         Intern::ParamBasisEvalHelper<*(space_cfg_ & SpaceTags::hess)>::trans_hessians(space_data, trafo_data);
       }
+
+      /**
+       * \brief Space evaluation operator for tabulated reference data
+       *
+       * This function performs the same evaluation as the operator(), but it copies the reference
+       * basis data from a previously tabulated evaluation data object instead of re-evaluating it.
+       * This function must only be used if the derived class is reference cell invariant.
+       *
+       * \param[out] space_data
+       * A \transient reference to the space data that is to be computed.
+       *
+       * \param[in] trafo_data
+       * The \transient trafo evaluation data containing information about the evaluation point.
+       *
+       * \param[in] ref_data
+       * The \transient tabulated reference data for the evaluation point.
+       */
+      template<SpaceTags space_cfg_, TrafoTags trafo_cfg_>
+      void eval_tabulated(
+        EvalData<SpaceEvalTraits, space_cfg_>& space_data,
+        const Trafo::EvalData<TrafoEvalTraits, trafo_cfg_>& trafo_data,
+        const EvalData<SpaceEvalTraits, space_cfg_>& ref_data) const
+      {
+        // copy reference data
+        Intern::ParamBasisEvalHelper<*(space_cfg_ & SpaceTags::ref_value)>::copy_ref_values(space_data, ref_data);
+        Intern::ParamBasisEvalHelper<*(space_cfg_ & SpaceTags::ref_grad)>::copy_ref_gradients(space_data, ref_data);
+        Intern::ParamBasisEvalHelper<*(space_cfg_ & SpaceTags::ref_hess)>::copy_ref_hessians(space_data, ref_data);
+
+        // transform basis values
+        Intern::ParamBasisEvalHelper<*(space_cfg_ & SpaceTags::value)>::trans_values(space_data, trafo_data);
+        // transform basis gradients
+        Intern::ParamBasisEvalHelper<*(space_cfg_ & SpaceTags::grad)>::trans_gradients(space_data, trafo_data);
+        // transform basis hessians
+        Intern::ParamBasisEvalHelper<*(space_cfg_ & SpaceTags::hess)>::trans_hessians(space_data, trafo_data);
+      }
     }; // class EvaluatorParametric<...>
 
     /// \cond internal
@@ -195,6 +233,15 @@ namespace FEAT
         template<typename SpaceData_, typename Evaluator_, typename DomPoint_>
         static void eval_ref_hessians(SpaceData_&, const Evaluator_&, const DomPoint_&) {}
 
+        template<typename SpaceData_>
+        static void copy_ref_values(SpaceData_&, const SpaceData_&) {}
+
+        template<typename SpaceData_>
+        static void copy_ref_gradients(SpaceData_&, const SpaceData_&) {}
+
+        template<typename SpaceData_>
+        static void copy_ref_hessians(SpaceData_&, const SpaceData_&) {}
+
         template<typename SpaceData_, typename TrafoData_>
         static void trans_values(SpaceData_&, const TrafoData_&) {}
 
@@ -226,6 +273,27 @@ namespace FEAT
           evaluator.eval_ref_hessians(space_data, dom_point);
         }
 
+        template<typename SpaceData_>
+        static void copy_ref_values(SpaceData_& space_data, const SpaceData_& ref_data)
+        {
+          for(int i(0); i < SpaceData_::max_local_dofs; ++i)
+            space_data.phi[i].ref_value = ref_data.phi[i].ref_value;
+        }
+
+        template<typename SpaceData_>
+        static void copy_ref_gradients(SpaceData_& space_data, const SpaceData_& ref_data)
+        {
+          for(int i(0); i < SpaceData_::max_local_dofs; ++i)
+            space_data.phi[i].ref_grad = ref_data.phi[i].ref_grad;
+        }
+
+        template<typename SpaceData_>
+        static void copy_ref_hessians(SpaceData_& space_data, const SpaceData_& ref_data)
+        {
+          for(int i(0); i < SpaceData_::max_local_dofs; ++i)
+            space_data.phi[i].ref_hess = ref_data.phi[i].ref_hess;
+        }
+
         template<typename SpaceData_, typename TrafoData_>
         static void trans_values(SpaceData_& space_data, const TrafoData_&)
         {
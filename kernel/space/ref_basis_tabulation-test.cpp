@@ -0,0 +1,125 @@
+// FEAT3: Finite Element Analysis Toolbox, Version 3
+// Copyright (C) 2010 - 2023 by Stefan Turek & the FEAT group
+// FEAT3 is released under the GNU General Public License version 3,
+// see the file 'copyright.txt' in the top level directory for details.
+
+#include <test_system/test_system.hpp>
+#include <kernel/geometry/common_factories.hpp>
+#include <kernel/trafo/standard/mapping.hpp>
+#include <kernel/space/lagrange2/element.hpp>
+#include <kernel/space/lagrange3/element.hpp>
+#include <kernel/space/ref_basis_tabulation.hpp>
+#include <kernel/cubature/dynamic_factory.hpp>
+#include <kernel/util/math.hpp>
+
+using namespace FEAT;
+using namespace FEAT::TestSystem;
+
+/**
+ * \brief Reference basis tabulation test
+ *
+ * \test Tests that the evaluation with tabulated reference basis data yields the same results as
+ * the standard evaluation on a distorted mesh, both for a cell invariant element (Lagrange-2) and
+ * for an element with cell dependent reference data (Lagrange-3).
+ */
+template<typename DataType_, typename IndexType_>
+class RefBasisTabulationTest
+  : public UnitTest
+{
+  typedef Shape::Quadrilateral ShapeType;
+  typedef Geometry::ConformalMesh<ShapeType, 2, DataType_> QuadMesh;
+  typedef Trafo::Standard::Mapping<QuadMesh> QuadTrafo;
+
+  typedef Cubature::Rule<ShapeType, DataType_, DataType_, Tiny::Vector<DataType_, 2> > CubatureRule;
+
+  static constexpr TrafoTags trafo_config = TrafoTags::jac_det | TrafoTags::jac_inv;
+  static constexpr SpaceTags space_config = SpaceTags::value | SpaceTags::grad;
+
+public:
+  RefBasisTabulationTest(PreferredBackend backend) :
+    UnitTest("RefBasisTabulationTest", Type::Traits<DataType_>::name(), Type::Traits<IndexType_>::name(), backend)
+  {
+  }
+
+  virtual ~RefBasisTabulationTest()
+  {
+  }
+
+  template<typename Space_>
+  void test_space(const Space_& space, bool expect_enabled) const
+  {
+    const DataType_ eps = Math::pow(Math::eps<DataType_>(), DataType_(0.8));
+
+    typedef typename QuadTrafo::template Evaluator<ShapeType, DataType_>::Type TrafoEvaluator;
+    typedef typename Space_::template Evaluator<TrafoEvaluator>::Type SpaceEvaluator;
+    typedef typename TrafoEvaluator::template ConfigTraits<trafo_config>::EvalDataType TrafoEvalData;
+    typedef typename SpaceEvaluator::template ConfigTraits<space_config>::EvalDataType SpaceEvalData;
+
+    TrafoEvaluator trafo_eval(space.get_trafo());
+    SpaceEvaluator space_eval(space);
+    TrafoEvalData trafo_data;
+    SpaceEvalData space_data, tab_data;
+
+    CubatureRule cubature_rule(Cubature::ctor_factory, Cubature::DynamicFactory("gauss-legendre:4"));
+
+    // tabulate reference basis data
+    Space::RefBasisTabulation<SpaceEvaluator, SpaceEvalData> ref_tab;
+    TEST_CHECK_EQUAL(ref_tab.enabled, expect_enabled);
+    ref_tab.tabulate(space_eval, cubature_rule);
+    TEST_CHECK_EQUAL(ref_tab.empty(), !expect_enabled);
+
+    // loop over all cells
+    const Index num_cells = space.get_mesh().get_num_elements();
+    for(Index cell(0); cell < num_cells; ++cell)
+    {
+      trafo_eval.prepare(cell);
+      space_eval.prepare(trafo_eval);
+      const int num_loc_dofs = space_eval.get_num_local_dofs();
+
+      for(int k(0); k < cubature_rule.get_num_points(); ++k)
+      {
+        trafo_eval(trafo_data, cubature_rule.get_point(k));
+
+        // evaluate directly and by tabulation
+        space_eval(space_data, trafo_data);
+        ref_tab.eval(space_eval, tab_data, trafo_data, k);
+
+        for(int i(0); i < num_loc_dofs; ++i)
+        {
+          TEST_CHECK_EQUAL_WITHIN_EPS(tab_data.phi[i].value, space_data.phi[i].value, eps);
+          TEST_CHECK_EQUAL_WITHIN_EPS(tab_data.phi[i].grad[0], space_data.phi[i].grad[0], eps);
+          TEST_CHECK_EQUAL_WITHIN_EPS(tab_data.phi[i].grad[1], space_data.phi[i].grad[1], eps);
+        }
+      }
+
+      space_eval.finish();
+      trafo_eval.finish();
+    }
+  }
+
+  virtual void run() const override
+  {
+    // create a refined unit square mesh and distort it
+    Geometry::RefinedUnitCubeFactory<QuadMesh> mesh_factory(2);
+    QuadMesh mesh(mesh_factory);
+    auto& vtx = mesh.get_vertex_set();
+    for(Index i(0); i < vtx.get_num_vertices(); ++i)
+    {
+      const DataType_ x = vtx[i][0], y = vtx[i][1];
+      vtx[i][0] += DataType_(0.1) * Math::sin(DataType_(3) * x) * x * (DataType_(1) - x) * y;
+      vtx[i][1] += DataType_(0.1) * Math::cos(DataType_(2) * y) * y * (DataType_(1) - y) * x;
+    }
+
+    QuadTrafo trafo(mesh);
+
+    // Lagrange-2: reference data is cell invariant
+    Space::Lagrange2::Element<QuadTrafo> space_q2(trafo);
+    test_space(space_q2, true);
+
+    // Lagrange-3: reference data depends on edge orientations
+    Space::Lagrange3::Element<QuadTrafo> space_q3(trafo);
+    test_space(space_q3, false);
+  }
+};
+
+RefBasisTabulationTest<double, Index> ref_basis_tabulation_test_double_index(PreferredBackend::generic);
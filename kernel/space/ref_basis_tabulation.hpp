@@ -0,0 +1,150 @@
+// FEAT3: Finite Element Analysis Toolbox, Version 3
+// Copyright (C) 2010 - 2023 by Stefan Turek & the FEAT group
+// FEAT3 is released under the GNU General Public License version 3,
+// see the file 'copyright.txt' in the top level directory for details.
+
+#pragma once
+#ifndef KERNEL_SPACE_REF_BASIS_TABULATION_HPP
+#define KERNEL_SPACE_REF_BASIS_TABULATION_HPP 1
+
+// includes, FEAT
+#include <kernel/space/eval_data.hpp>
+
+// includes, system
+#include <vector>
+
+namespace FEAT
+{
+  namespace Space
+  {
+    /**
+     * \brief Reference basis tabulation class template
+     *
+     * This class tabulates the reference basis values, gradients and hessians of a space evaluator
+     * in all points of a cubature rule. For parametric elements, these reference data are identical
+     * for all cells of the mesh, so the tabulation has to be computed only once per cubature rule
+     * and each evaluation on a cell only has to apply the transformation to the real cell.
+     *
+     * If the reference basis data of the space evaluator depends on the current cell, e.g. due to
+     * edge orientations or cell-dependent scaling factors, which is indicated by the
+     * <c>SpaceEvaluator_::ref_data_cell_invariant</c> constant, then this class does not tabulate
+     * anything and the eval() function falls back to the standard evaluation operator.
+     *
+     * Typical usage in an assembly loop:
+     * \code{.cpp}
+       RefBasisTabulation<SpaceEvaluator, SpaceEvalData> ref_tab;
+       ref_tab.tabulate(space_eval, cubature_rule);
+       for(each cell)
+       {
+         trafo_eval.prepare(cell);
+         space_eval.prepare(trafo_eval);
+         for(int k(0); k < cubature_rule.get_num_points(); ++k)
+         {
+           trafo_eval(trafo_data, cubature_rule.get_point(k));
+           ref_tab.eval(space_eval, space_data, trafo_data, k);
+           ...
+         }
+       }
+     * \endcode
+     *
+     * \tparam SpaceEvaluator_
+     * The space evaluator class.
+     *
+     * \tparam SpaceEvalData_
+     * The space evaluation data class that is used for evaluation.
+     */
+    template<typename SpaceEvaluator_, typename SpaceEvalData_>
+    class RefBasisTabulation
+    {
+    public:
+      /// the space evaluator type
+      typedef SpaceEvaluator_ SpaceEvaluator;
+      /// the space evaluation data type
+      typedef SpaceEvalData_ SpaceEvalData;
+
+      /// specifies whether the reference data can be tabulated
+      static constexpr bool enabled = SpaceEvaluator::ref_data_cell_invariant;
+
+    protected:
+      /// the tabulated reference data for each cubature point
+      std::vector<SpaceEvalData> _ref_data;
+
+    public:
+      /**
+       * \brief Tabulates the reference basis data
+       *
+       * \param[in] space_eval
+       * A \transient reference to the space evaluator whose reference basis data is to be tabulated.
+       *
+       * \param[in] cubature_rule
+       * A \transient reference to the cubature rule in whose points the data is to be tabulated.
+       */
+      template<typename CubatureRule_>
+      void tabulate(const SpaceEvaluator& space_eval, const CubatureRule_& cubature_rule)
+      {
+        if constexpr(enabled)
+        {
+          const int num_points = cubature_rule.get_num_points();
+          _ref_data.resize(std::size_t(num_points));
+          for(int k(0); k < num_points; ++k)
+            space_eval.reference_eval(_ref_data[std::size_t(k)], cubature_rule.get_point(k));
+        }
+        else
+        {
+          (void)space_eval;
+          (void)cubature_rule;
+        }
+      }
+
+      /// \returns The number of tabulated points
+      int get_num_points() const
+      {
+        return int(_ref_data.size());
+      }
+
+      /// \returns \c true, if the tabulation is empty, otherwise \c false
+      bool empty() const
+      {
+        return _ref_data.empty();
+      }
+
+      /// releases the tabulation
+      void clear()
+      {
+        _ref_data.clear();
+      }
+
+      /**
+       * \brief Evaluates the space in a cubature point
+       *
+       * \param[in] space_eval
+       * A \transient reference to the space evaluator, which has been prepared for the current cell.
+       *
+       * \param[out] space_data
+       * A \transient reference to the space data that is to be computed.
+       *
+       * \param[in] trafo_data
+       * The \transient trafo evaluation data in the k-th cubature point.
+       *
+       * \param[in] k
+       * The index of the cubature point that the trafo data has been evaluated in.
+       */
+      template<typename TrafoEvalData_>
+      void eval(const SpaceEvaluator& space_eval, SpaceEvalData& space_data, const TrafoEvalData_& trafo_data, int k) const
+      {
+        if constexpr(enabled)
+        {
+          ASSERTM(k < int(_ref_data.size()), "invalid cubature point index; did you forget to call tabulate()?");
+          space_eval.eval_tabulated(space_data, trafo_data, _ref_data[std::size_t(k)]);
+        }
+        else
+        {
+          (void)k;
+          space_eval(space_data, trafo_data);
+        }
+      }
+    }; // class RefBasisTabulation<...>
+  } // namespace Space
+} // namespace FEAT
+
+#endif // KERNEL_SPACE_REF_BASIS_TABULATION_HPP
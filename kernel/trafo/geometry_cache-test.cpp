@@ -0,0 +1,280 @@
+// FEAT3: Finite Element Analysis Toolbox, Version 3
+// Copyright (C) 2010 - 2023 by Stefan Turek & the FEAT group
+// FEAT3 is released under the GNU General Public License version 3,
+// see the file 'copyright.txt' in the top level directory for details.
+
+#include <test_system/test_system.hpp>
+#include <kernel/geometry/common_factories.hpp>
+#include <kernel/geometry/boundary_factory.hpp>
+#include <kernel/geometry/atlas/circle.hpp>
+#include <kernel/trafo/standard/mapping.hpp>
+#include <kernel/trafo/isoparam/mapping.hpp>
+#include <kernel/trafo/geometry_cache.hpp>
+#include <kernel/space/lagrange2/element.hpp>
+#include <kernel/cubature/dynamic_factory.hpp>
+#include <kernel/analytic/common.hpp>
+#include <kernel/assembly/common_operators.hpp>
+#include <kernel/assembly/common_functionals.hpp>
+#include <kernel/assembly/symbolic_assembler.hpp>
+#include <kernel/assembly/interpolator.hpp>
+#include <kernel/assembly/domain_assembler.hpp>
+#include <kernel/assembly/basic_assembly_jobs.hpp>
+#include <kernel/assembly/function_integral_jobs.hpp>
+#include <kernel/lafem/sparse_matrix_csr.hpp>
+#include <kernel/lafem/dense_vector.hpp>
+
+using namespace FEAT;
+using namespace FEAT::TestSystem;
+
+/**
+ * \brief Test class for the trafo geometry cache.
+ *
+ * \test Tests the Trafo::GeometryCache class template as well as its use by the assembly jobs.
+ */
+template<typename DataType_, typename IndexType_>
+class GeometryCacheTest
+  : public UnitTest
+{
+  typedef Shape::Quadrilateral ShapeType;
+  typedef Geometry::ConformalMesh<ShapeType, 2, DataType_> MeshType;
+  typedef Trafo::Standard::Mapping<MeshType> TrafoType;
+  typedef Space::Lagrange2::Element<TrafoType> SpaceType;
+  typedef Trafo::GeometryCache<TrafoType, DataType_> CacheType;
+
+  typedef LAFEM::SparseMatrixCSR<DataType_, IndexType_> MatrixType;
+  typedef LAFEM::DenseVector<DataType_, IndexType_> VectorType;
+
+  typedef Cubature::Rule<ShapeType, DataType_, DataType_, Tiny::Vector<DataType_, 2> > CubatureRule;
+
+public:
+  GeometryCacheTest(PreferredBackend backend) :
+    UnitTest("GeometryCacheTest", Type::Traits<DataType_>::name(), Type::Traits<IndexType_>::name(), backend)
+  {
+  }
+
+  virtual ~GeometryCacheTest()
+  {
+  }
+
+  static void distort_mesh(MeshType& mesh, DataType_ s)
+  {
+    auto& vtx = mesh.get_vertex_set();
+    for(Index i(0); i < vtx.get_num_vertices(); ++i)
+    {
+      const DataType_ x = vtx[i][0], y = vtx[i][1];
+      vtx[i][0] += s * Math::sin(DataType_(3) * x) * x * (DataType_(1) - x) * y;
+      vtx[i][1] += s * Math::cos(DataType_(2) * y) * y * (DataType_(1) - y) * x;
+    }
+    mesh.touch_vertices();
+  }
+
+  template<typename Trafo_, typename Cache_>
+  void test_cache_data(const Trafo_& trafo, const Cache_& cache, const CubatureRule& cubature_rule) const
+  {
+    const DataType_ eps = Math::pow(Math::eps<DataType_>(), DataType_(0.9));
+
+    static constexpr TrafoTags trafo_config = TrafoTags::img_point | TrafoTags::jac_inv | TrafoTags::jac_det;
+    typedef typename Cache_::TrafoEvaluator TrafoEvaluator;
+    typedef typename TrafoEvaluator::template ConfigTraits<trafo_config>::EvalDataType TrafoEvalData;
+
+    TrafoEvaluator trafo_eval(trafo);
+    TrafoEvalData trafo_data, cache_data;
+
+    for(Index cell(0); cell < trafo.get_mesh().get_num_elements(); ++cell)
+    {
+      trafo_eval.prepare(cell);
+      for(int k(0); k < cubature_rule.get_num_points(); ++k)
+      {
+        trafo_eval(trafo_data, cubature_rule.get_point(k));
+        cache.eval(cache_data, cell, k);
+        TEST_CHECK_EQUAL_WITHIN_EPS(cache_data.jac_det, trafo_data.jac_det, eps);
+        TEST_CHECK_EQUAL_WITHIN_EPS(cache.get_weighted_det(cell, k), trafo_data.jac_det * cubature_rule.get_weight(k), eps);
+        for(int i(0); i < 2; ++i)
+        {
+          TEST_CHECK_EQUAL_WITHIN_EPS(cache_data.dom_point[i], trafo_data.dom_point[i], eps);
+          TEST_CHECK_EQUAL_WITHIN_EPS(cache_data.img_point[i], trafo_data.img_point[i], eps);
+          for(int j(0); j < 2; ++j)
+          {
+            TEST_CHECK_EQUAL_WITHIN_EPS(cache_data.jac_inv[i][j], trafo_data.jac_inv[i][j], eps);
+          }
+        }
+      }
+      trafo_eval.finish();
+    }
+  }
+
+  void test_versions() const
+  {
+    typedef Trafo::Isoparam::Mapping<MeshType, 2> IsoTrafoType;
+    typedef Trafo::GeometryCache<IsoTrafoType, DataType_> IsoCacheType;
+
+    Geometry::RefinedUnitCubeFactory<MeshType> mesh_factory(2);
+    MeshType mesh(mesh_factory);
+    Geometry::BoundaryFactory<MeshType> bnd_factory(mesh);
+    Geometry::MeshPart<MeshType> bnd_part(bnd_factory);
+    Geometry::Atlas::Circle<MeshType> chart(DataType_(0.5), DataType_(0.5), DataType_(0.75));
+
+    IsoTrafoType trafo(mesh);
+    CubatureRule cubature_rule(Cubature::ctor_factory, Cubature::DynamicFactory("gauss-legendre:2"));
+    IsoCacheType cache(trafo, cubature_rule);
+    TEST_CHECK(cache.is_valid());
+
+    // read-only access to the mesh does not invalidate the cache
+    const MeshType& cmesh = mesh;
+    TEST_CHECK(cmesh.get_vertex_set().get_num_vertices() > Index(0));
+    TEST_CHECK(mesh.get_vertex_set().get_num_vertices() > Index(0));
+    TEST_CHECK(cache.is_valid());
+
+    // adapting the mesh to a chart invalidates the cache
+    chart.adapt(mesh, bnd_part);
+    TEST_CHECK(!cache.is_valid());
+    TEST_CHECK(cache.update(trafo, cubature_rule));
+    TEST_CHECK(cache.is_valid());
+
+    // adding a chart invalidates the cache
+    trafo.add_meshpart_chart(bnd_part, chart);
+    TEST_CHECK(!cache.is_valid());
+    TEST_CHECK(cache.update(trafo, cubature_rule));
+    TEST_CHECK(cache.is_valid());
+    test_cache_data(trafo, cache, cubature_rule);
+
+    // modifying the chart invalidates the cache
+    typename Geometry::Atlas::Circle<MeshType>::WorldPoint origin, angles, offset;
+    origin = DataType_(0);
+    angles = DataType_(0);
+    offset = DataType_(0);
+    offset[0] = DataType_(0.1);
+    chart.transform(origin, angles, offset);
+    TEST_CHECK(!cache.is_valid());
+    TEST_CHECK(cache.update(trafo, cubature_rule));
+    test_cache_data(trafo, cache, cubature_rule);
+
+    // transforming the mesh invalidates the cache
+    mesh.transform(origin, angles, offset);
+    TEST_CHECK(!cache.is_valid());
+    TEST_CHECK(cache.update(trafo, cubature_rule));
+    TEST_CHECK(!cache.update(trafo, cubature_rule));
+
+    // clearing the modified chart must not restore an earlier version
+    const std::uint64_t version = trafo.get_geometry_version();
+    trafo.clear();
+    TEST_CHECK(trafo.get_geometry_version() > version);
+    TEST_CHECK(cache.update(trafo, cubature_rule));
+
+    // explicit invalidation
+    cache.invalidate();
+    TEST_CHECK(!cache.is_valid());
+    TEST_CHECK(cache.update(trafo, cubature_rule));
+    TEST_CHECK(cache.is_valid());
+  }
+
+  virtual void run() const override
+  {
+    test_versions();
+
+    const DataType_ tol = Math::pow(Math::eps<DataType_>(), DataType_(0.8));
+    const String cubature_name("gauss-legendre:3");
+
+    Geometry::RefinedUnitCubeFactory<MeshType> mesh_factory(2);
+    MeshType mesh(mesh_factory);
+    distort_mesh(mesh, DataType_(0.1));
+
+    TrafoType trafo(mesh);
+    SpaceType space(trafo);
+
+    CubatureRule cubature_rule(Cubature::ctor_factory, Cubature::DynamicFactory(cubature_name));
+    CubatureRule cubature_rule_2(Cubature::ctor_factory, Cubature::DynamicFactory("gauss-legendre:2"));
+
+    // build the cache and compare against the trafo evaluator
+    CacheType cache(trafo, cubature_rule);
+    TEST_CHECK(!cache.empty());
+    TEST_CHECK(cache.is_valid());
+    TEST_CHECK_EQUAL(cache.get_num_points(), cubature_rule.get_num_points());
+    TEST_CHECK_EQUAL(cache.get_num_cells(), mesh.get_num_elements());
+    test_cache_data(trafo, cache, cubature_rule);
+
+    // check compatibility
+    TEST_CHECK(cache.template is_compatible<TrafoTags::jac_det | TrafoTags::jac_inv>(cubature_rule));
+    TEST_CHECK(!cache.template is_compatible<TrafoTags::jac_det | TrafoTags::jac_inv>(cubature_rule_2));
+    TEST_CHECK(!cache.template is_compatible<TrafoTags::jac_det | TrafoTags::hess_inv>(cubature_rule));
+
+    // nothing changed, so update must not rebuild
+    TEST_CHECK(!cache.update(trafo, cubature_rule));
+
+    // assemble a Laplace matrix with and without cache
+    Assembly::DomainAssembler<TrafoType> dom_asm(trafo);
+    dom_asm.compile_all_elements();
+
+    MatrixType matrix_1, matrix_2;
+    Assembly::SymbolicAssembler::assemble_matrix_std1(matrix_1, space);
+    matrix_2 = matrix_1.clone(LAFEM::CloneMode::Weak);
+    matrix_1.format();
+    matrix_2.format();
+
+    Assembly::Common::LaplaceOperator laplace;
+    {
+      Assembly::BilinearOperatorMatrixAssemblyJob1<Assembly::Common::LaplaceOperator, MatrixType, SpaceType>
+        job(laplace, matrix_1, space, cubature_name);
+      dom_asm.assemble(job);
+    }
+    {
+      Assembly::BilinearOperatorMatrixAssemblyJob1<Assembly::Common::LaplaceOperator, MatrixType, SpaceType>
+        job(laplace, matrix_2, space, cubature_name);
+      job.set_geometry_cache(&cache);
+      dom_asm.assemble(job);
+    }
+    matrix_2.axpy(matrix_1, matrix_2, -DataType_(1));
+    TEST_CHECK_EQUAL_WITHIN_EPS(matrix_2.norm_frobenius(), DataType_(0), tol);
+
+    // assemble a right-hand-side vector with and without cache
+    VectorType vec_rhs_1(space.get_num_dofs(), DataType_(0));
+    VectorType vec_rhs_2(space.get_num_dofs(), DataType_(0));
+    VectorType vec_rhs_3(space.get_num_dofs(), DataType_(0));
+    Analytic::Common::SineBubbleFunction<2> sine_bubble_rhs;
+    Assembly::Common::ForceFunctional<decltype(sine_bubble_rhs)> force_func(sine_bubble_rhs);
+    {
+      Assembly::ForceFunctionalAssemblyJob<decltype(sine_bubble_rhs), VectorType, SpaceType>
+        job(sine_bubble_rhs, vec_rhs_1, space, cubature_name);
+      dom_asm.assemble(job);
+    }
+    {
+      Assembly::ForceFunctionalAssemblyJob<decltype(sine_bubble_rhs), VectorType, SpaceType>
+        job(sine_bubble_rhs, vec_rhs_2, space, cubature_name);
+      job.set_geometry_cache(&cache);
+      dom_asm.assemble(job);
+    }
+    {
+      Assembly::LinearFunctionalAssemblyJob<decltype(force_func), VectorType, SpaceType>
+        job(force_func, vec_rhs_3, space, cubature_name);
+      job.set_geometry_cache(&cache);
+      dom_asm.assemble(job);
+    }
+    vec_rhs_2.axpy(vec_rhs_1, vec_rhs_2, -DataType_(1));
+    vec_rhs_3.axpy(vec_rhs_1, vec_rhs_3, -DataType_(1));
+    TEST_CHECK_EQUAL_WITHIN_EPS(vec_rhs_2.norm2(), DataType_(0), tol);
+    TEST_CHECK_EQUAL_WITHIN_EPS(vec_rhs_3.norm2(), DataType_(0), tol);
+
+    // compute an error integral with and without cache
+    Analytic::Common::SineBubbleFunction<2> sine_bubble;
+    VectorType vector;
+    Assembly::Interpolator::project(vector, sine_bubble, space);
+    typedef Assembly::ErrorFunctionIntegralJob<decltype(sine_bubble), VectorType, SpaceType, 1> ErrorJobType;
+    ErrorJobType error_job_1(sine_bubble, vector, space, cubature_name);
+    dom_asm.assemble(error_job_1);
+    ErrorJobType error_job_2(sine_bubble, vector, space, cubature_name);
+    error_job_2.set_geometry_cache(&cache);
+    dom_asm.assemble(error_job_2);
+    TEST_CHECK_EQUAL_WITHIN_EPS(error_job_2.result().norm_h0_sqr, error_job_1.result().norm_h0_sqr, tol);
+    TEST_CHECK_EQUAL_WITHIN_EPS(error_job_2.result().norm_h1_sqr, error_job_1.result().norm_h1_sqr, tol);
+
+    // move the vertices; this invalidates the cache
+    distort_mesh(mesh, DataType_(0.05));
+    TEST_CHECK(!cache.is_valid());
+    TEST_CHECK(!cache.template is_compatible<TrafoTags::jac_det>(cubature_rule));
+    TEST_CHECK(cache.update(trafo, cubature_rule));
+    TEST_CHECK(cache.is_valid());
+    test_cache_data(trafo, cache, cubature_rule);
+  }
+};
+
+GeometryCacheTest<double, Index> geometry_cache_test_double_index(PreferredBackend::generic);
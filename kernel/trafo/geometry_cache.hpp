@@ -0,0 +1,427 @@
+// FEAT3: Finite Element Analysis Toolbox, Version 3
+// Copyright (C) 2010 - 2023 by Stefan Turek & the FEAT group
+// FEAT3 is released under the GNU General Public License version 3,
+// see the file 'copyright.txt' in the top level directory for details.
+
+#pragma once
+#ifndef KERNEL_TRAFO_GEOMETRY_CACHE_HPP
+#define KERNEL_TRAFO_GEOMETRY_CACHE_HPP 1
+
+// includes, FEAT
+#include <kernel/trafo/base.hpp>
+#include <kernel/trafo/eval_data.hpp>
+
+// includes, system
+#include <cstdint>
+#include <vector>
+
+namespace FEAT
+{
+  namespace Trafo
+  {
+    /**
+     * \brief Precomputed trafo geometry cache
+     *
+     * This class stores the image points, jacobian matrices, jacobian inverse matrices, jacobian
+     * determinants and the jacobian determinants multiplied by the cubature weights of a transformation
+     * in all points of a cubature rule on all cells of the underlying mesh. Each of these quantities
+     * is stored in a separate array, which is indexed by <c>cell * num_points + point</c>. The
+     * weighted determinants are the integration weights of the cubature points on the real cells,
+     * so the assembly jobs can use them directly instead of multiplying the jacobian determinant by
+     * the cubature weight in each point of each assembly pass.
+     *
+     * This cache is meant for expensive transformations, such as the isoparametric or the isosphere
+     * trafos, which would otherwise be re-evaluated in each assembly pass, although the mesh does
+     * not change between e.g. nonlinear iterations or time steps. Assembly jobs, which support this
+     * cache, can be given a pointer to a cache object, which is then used instead of the trafo
+     * evaluator as long as the cache is compatible with the cubature rule and trafo configuration
+     * of the job. For parametric spaces, these jobs do not even prepare the trafo evaluator on each
+     * cell, so the trafo-specific per-cell setup, e.g. the projection of the isoparametric
+     * coefficients onto the charts, is skipped as well.
+     *
+     * The cache stores the geometry version of the trafo at build time, which is derived from the
+     * vertex version of the mesh and, for the isoparametric trafo, the versions of its charts, see
+     * Trafo::MappingBase::get_geometry_version(). The is_valid() function compares this version in
+     * constant time and the update() function rebuilds the cache only if the version has changed.
+     * Modifications which are not tracked by these versions, e.g. a modification of the vertex set
+     * via a reference that was obtained before the cache was built, must be announced by calling
+     * the invalidate() function.
+     *
+     * \note
+     * This cache does not store hessian tensors, so any assembly that requires trafo hessians
+     * falls back to the standard trafo evaluation.
+     *
+     * \tparam Trafo_
+     * The transformation whose geometry is to be cached.
+     *
+     * \tparam DataType_
+     * The data type that is to be used for the trafo evaluation.
+     */
+    template<typename Trafo_, typename DataType_ = Real>
+    class GeometryCache
+    {
+    public:
+      /// the trafo type
+      typedef Trafo_ TrafoType;
+      /// the shape type
+      typedef typename TrafoType::ShapeType ShapeType;
+      /// the data type
+      typedef DataType_ DataType;
+      /// the trafo evaluator type
+      typedef typename TrafoType::template Evaluator<ShapeType, DataType>::Type TrafoEvaluator;
+      /// the trafo evaluation traits
+      typedef typename TrafoEvaluator::EvalTraits EvalTraits;
+
+      /// domain point type
+      typedef typename EvalTraits::DomainPointType DomainPointType;
+      /// image point type
+      typedef typename EvalTraits::ImagePointType ImagePointType;
+      /// jacobian matrix type
+      typedef typename EvalTraits::JacobianMatrixType JacobianMatrixType;
+      /// jacobian inverse matrix type
+      typedef typename EvalTraits::JacobianInverseType JacobianInverseType;
+      /// jacobian determinant type
+      typedef typename EvalTraits::JacobianDeterminantType JacobianDeterminantType;
+
+      /// the trafo configuration that this cache supplies
+      static constexpr TrafoTags cache_config = TrafoTags::dom_point | TrafoTags::img_point |
+        TrafoTags::jac_mat | TrafoTags::jac_inv | TrafoTags::jac_det;
+
+    protected:
+      /// the trafo that this cache was built for
+      const TrafoType* _trafo;
+      /// the number of cells
+      Index _num_cells;
+      /// the number of cubature points per cell
+      int _num_points;
+      /// the geometry version of the trafo at build time
+      std::uint64_t _version;
+      /// specifies whether the cache has been invalidated explicitly
+      bool _invalidated;
+      /// the cubature points and weights
+      std::vector<DomainPointType> _dom_points;
+      std::vector<DataType> _weights;
+      /// the image points
+      std::vector<ImagePointType> _img_points;
+      /// the jacobian matrices
+      std::vector<JacobianMatrixType> _jac_mats;
+      /// the jacobian inverse matrices
+      std::vector<JacobianInverseType> _jac_invs;
+      /// the jacobian determinants
+      std::vector<JacobianDeterminantType> _jac_dets;
+      /// the jacobian determinants multiplied by the cubature weights
+      std::vector<DataType> _wgt_dets;
+
+    public:
+      /// default constructor
+      GeometryCache() :
+        _trafo(nullptr),
+        _num_cells(0),
+        _num_points(0),
+        _version(0u),
+        _invalidated(false)
+      {
+      }
+
+      /**
+       * \brief Constructor
+       *
+       * \param[in] trafo
+       * A \resident reference to the trafo whose geometry is to be cached.
+       *
+       * \param[in] cubature_rule
+       * A \transient reference to the cubature rule in whose points the geometry is to be cached.
+       */
+      template<typename CubatureRule_>
+      explicit GeometryCache(const TrafoType& trafo, const CubatureRule_& cubature_rule) :
+        GeometryCache()
+      {
+        build(trafo, cubature_rule);
+      }
+
+      /// no copy, no problems
+      GeometryCache(const GeometryCache&) = delete;
+      /// no copy, no problems
+      GeometryCache& operator=(const GeometryCache&) = delete;
+
+      /// \returns \c true, if the cache is empty, otherwise \c false
+      bool empty() const
+      {
+        return _trafo == nullptr;
+      }
+
+      /// releases all cached data
+      void clear()
+      {
+        _trafo = nullptr;
+        _num_cells = Index(0);
+        _num_points = 0;
+        _version = 0u;
+        _invalidated = false;
+        _dom_points.clear();
+        _weights.clear();
+        _img_points.clear();
+        _jac_mats.clear();
+        _jac_invs.clear();
+        _jac_dets.clear();
+        _wgt_dets.clear();
+      }
+
+      /**
+       * \brief Builds the geometry cache
+       *
+       * This function evaluates the trafo in all cubature points of all cells; the cells are
+       * processed in parallel if FEAT was configured with OpenMP support.
+       *
+       * \param[in] trafo
+       * A \resident reference to the trafo whose geometry is to be cached.
+       *
+       * \param[in] cubature_rule
+       * A \transient reference to the cubature rule in whose points the geometry is to be cached.
+       */
+      template<typename CubatureRule_>
+      void build(const TrafoType& trafo, const CubatureRule_& cubature_rule)
+      {
+        typedef typename TrafoEvaluator::template ConfigTraits<cache_config>::EvalDataType TrafoEvalData;
+
+        _trafo = &trafo;
+        _num_cells = trafo.get_mesh().get_num_elements();
+        _num_points = cubature_rule.get_num_points();
+        _version = trafo.get_geometry_version();
+        _invalidated = false;
+
+        const std::size_t np = std::size_t(_num_points);
+        const std::size_t n = std::size_t(_num_cells) * np;
+
+        _dom_points.resize(np);
+        _weights.resize(np);
+        for(std::size_t k(0); k < np; ++k)
+        {
+          _dom_points[k] = cubature_rule.get_point(int(k));
+          _weights[k] = cubature_rule.get_weight(int(k));
+        }
+
+        _img_points.resize(n);
+        _jac_mats.resize(n);
+        _jac_invs.resize(n);
+        _jac_dets.resize(n);
+        _wgt_dets.resize(n);
+
+        FEAT_PRAGMA_OMP(parallel)
+        {
+          TrafoEvaluator trafo_eval(trafo);
+          TrafoEvalData trafo_data;
+
+          FEAT_PRAGMA_OMP(for schedule(static))
+          for(Index cell = 0; cell < _num_cells; ++cell)
+          {
+            trafo_eval.prepare(cell);
+            for(std::size_t k(0); k < np; ++k)
+            {
+              const std::size_t i = std::size_t(cell) * np + k;
+              trafo_eval(trafo_data, _dom_points[k]);
+              _img_points[i] = trafo_data.img_point;
+              _jac_mats[i] = trafo_data.jac_mat;
+              _jac_invs[i] = trafo_data.jac_inv;
+              _jac_dets[i] = trafo_data.jac_det;
+              _wgt_dets[i] = trafo_data.jac_det * _weights[k];
+            }
+            trafo_eval.finish();
+          }
+        }
+      }
+
+      /**
+       * \brief Marks the cache as invalid
+       *
+       * This function has to be called if the trafo geometry was modified in a way which is not
+       * tracked by the geometry version of the trafo; the next call of update() rebuilds the cache.
+       */
+      void invalidate()
+      {
+        _invalidated = true;
+      }
+
+      /**
+       * \brief Checks whether the cache is still valid
+       *
+       * \returns
+       * \c true, if the cache is not empty, has not been invalidated and the geometry version of the
+       * trafo has not changed since the cache was built, otherwise \c false.
+       */
+      bool is_valid() const
+      {
+        return (_trafo != nullptr) && !_invalidated && (_num_cells == _trafo->get_mesh().get_num_elements()) &&
+          (_version == _trafo->get_geometry_version());
+      }
+
+      /**
+       * \brief Rebuilds the cache if necessary
+       *
+       * \param[in] trafo
+       * A \resident reference to the trafo whose geometry is to be cached.
+       *
+       * \param[in] cubature_rule
+       * A \transient reference to the cubature rule in whose points the geometry is to be cached.
+       *
+       * \returns
+       * \c true, if the cache was rebuilt, or \c false, if the cache was still valid.
+       */
+      template<typename CubatureRule_>
+      bool update(const TrafoType& trafo, const CubatureRule_& cubature_rule)
+      {
+        if((_trafo == &trafo) && is_valid() && _is_same_rule(cubature_rule))
+          return false;
+        build(trafo, cubature_rule);
+        return true;
+      }
+
+      /**
+       * \brief Checks whether this cache can be used for a given trafo configuration and cubature rule
+       *
+       * \tparam cfg_
+       * The trafo configuration that is to be supplied.
+       *
+       * \param[in] cubature_rule
+       * The cubature rule that is to be used.
+       *
+       * \returns
+       * \c true, if the cache is valid and supplies all required trafo data in the points of the
+       * given cubature rule, otherwise \c false.
+       */
+      template<TrafoTags cfg_, typename CubatureRule_>
+      bool is_compatible(const CubatureRule_& cubature_rule) const
+      {
+        if constexpr(*(cfg_ & (TrafoTags::hess_ten | TrafoTags::hess_inv | TrafoTags::normal)))
+          return false;
+        else
+          return is_valid() && _is_same_rule(cubature_rule);
+      }
+
+      /**
+       * \brief Fetches the cached trafo data for a cubature point on a cell
+       *
+       * \param[out] trafo_data
+       * A \transient reference to the trafo data that is to be filled.
+       *
+       * \param[in] cell
+       * The index of the cell.
+       *
+       * \param[in] k
+       * The index of the cubature point.
+       */
+      template<TrafoTags cfg_>
+      void eval(Trafo::EvalData<EvalTraits, cfg_>& trafo_data, Index cell, int k) const
+      {
+        // assembly tasks instantiate this function for all their trafo configurations, but they only
+        // call it if is_compatible() returned true, which is never the case if hessians are required
+        if constexpr(*(cfg_ & (TrafoTags::hess_ten | TrafoTags::hess_inv)))
+          XABORTM("geometry cache does not supply hessians");
+        ASSERTM(cell < _num_cells, "invalid cell index");
+        ASSERTM(k < _num_points, "invalid cubature point index");
+        const std::size_t i = std::size_t(cell) * std::size_t(_num_points) + std::size_t(k);
+        if constexpr(*(cfg_ & TrafoTags::dom_point))
+          trafo_data.dom_point = _dom_points[std::size_t(k)];
+        if constexpr(*(cfg_ & TrafoTags::img_point))
+          trafo_data.img_point = _img_points[i];
+        if constexpr(*(cfg_ & TrafoTags::jac_mat))
+          trafo_data.jac_mat = _jac_mats[i];
+        if constexpr(*(cfg_ & TrafoTags::jac_inv))
+          trafo_data.jac_inv = _jac_invs[i];
+        if constexpr(*(cfg_ & TrafoTags::jac_det))
+          trafo_data.jac_det = _jac_dets[i];
+      }
+
+      /**
+       * \brief Returns the weighted jacobian determinant for a cubature point on a cell
+       *
+       * \param[in] cell
+       * The index of the cell.
+       *
+       * \param[in] k
+       * The index of the cubature point.
+       *
+       * \returns The jacobian determinant multiplied by the weight of the cubature point.
+       */
+      DataType get_weighted_det(Index cell, int k) const
+      {
+        ASSERTM(cell < _num_cells, "invalid cell index");
+        ASSERTM(k < _num_points, "invalid cubature point index");
+        return _wgt_dets[std::size_t(cell) * std::size_t(_num_points) + std::size_t(k)];
+      }
+
+      /// \returns The number of cached cells
+      Index get_num_cells() const
+      {
+        return _num_cells;
+      }
+
+      /// \returns The number of cubature points per cell
+      int get_num_points() const
+      {
+        return _num_points;
+      }
+
+      /// \returns A pointer to the image point array
+      const ImagePointType* get_img_points() const
+      {
+        return _img_points.data();
+      }
+
+      /// \returns A pointer to the jacobian matrix array
+      const JacobianMatrixType* get_jac_mats() const
+      {
+        return _jac_mats.data();
+      }
+
+      /// \returns A pointer to the jacobian inverse matrix array
+      const JacobianInverseType* get_jac_invs() const
+      {
+        return _jac_invs.data();
+      }
+
+      /// \returns A pointer to the jacobian determinant array
+      const JacobianDeterminantType* get_jac_dets() const
+      {
+        return _jac_dets.data();
+      }
+
+      /// \returns A pointer to the array of jacobian determinants multiplied by the cubature weights
+      const DataType* get_weighted_dets() const
+      {
+        return _wgt_dets.data();
+      }
+
+      /// \returns The total number of bytes allocated by this cache
+      std::size_t bytes() const
+      {
+        return _dom_points.size() * sizeof(DomainPointType) + _weights.size() * sizeof(DataType) +
+          _img_points.size() * sizeof(ImagePointType) + _jac_mats.size() * sizeof(JacobianMatrixType) +
+          _jac_invs.size() * sizeof(JacobianInverseType) + _jac_dets.size() * sizeof(JacobianDeterminantType) +
+          _wgt_dets.size() * sizeof(DataType);
+      }
+
+    protected:
+      /// checks whether a cubature rule coincides with the cached one
+      template<typename CubatureRule_>
+      bool _is_same_rule(const CubatureRule_& cubature_rule) const
+      {
+        if(cubature_rule.get_num_points() != _num_points)
+          return false;
+        for(int k(0); k < _num_points; ++k)
+        {
+          if(cubature_rule.get_weight(k) != _weights[std::size_t(k)])
+            return false;
+          for(int j(0); j < DomainPointType::n; ++j)
+          {
+            if(cubature_rule.get_point(k)[j] != _dom_points[std::size_t(k)][j])
+              return false;
+          }
+        }
+        return true;
+      }
+    }; // class GeometryCache<...>
+  } // namespace Trafo
+} // namespace FEAT
+
+#endif // KERNEL_TRAFO_GEOMETRY_CACHE_HPP
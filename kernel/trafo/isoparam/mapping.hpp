@@ -13,6 +13,9 @@
 #include <kernel/geometry/mesh_part.hpp>
 #include <kernel/geometry/atlas/chart.hpp>
 
+// includes, system
+#include <algorithm>
+
 namespace FEAT
 {
   namespace Trafo
@@ -109,6 +112,10 @@ namespace FEAT
       protected:
         // for each shape dimension, a vector of charts
         std::array<std::vector<const ChartType*>, shape_dim+1> _shape_charts;
+        /// the distinct charts which have been added to the trafo
+        std::vector<const ChartType*> _charts;
+        /// modification counter of the mesh-part/chart pairs; includes the versions of all removed charts
+        std::uint64_t _chart_version;
 
       public:
         /** \copydoc MappingBase::Evaluator */
@@ -134,7 +141,8 @@ namespace FEAT
          * A \resident reference to the mesh that this trafo mapping is to be defined on.
          */
         explicit Mapping(MeshType& mesh) :
-          BaseClass(mesh)
+          BaseClass(mesh),
+          _chart_version(0u)
         {
           // allocate chart vectors
           for(int dim(1); dim <= shape_dim; ++dim)
@@ -155,6 +163,9 @@ namespace FEAT
         void add_meshpart_chart(const Geometry::MeshPart<MeshType>& mesh_part, const Geometry::Atlas::ChartBase<MeshType>& chart)
         {
           Intern::PartChartHelper<ShapeType>::emplace(mesh_part.get_target_set_holder(), _shape_charts, chart);
+          if(std::find(_charts.begin(), _charts.end(), &chart) == _charts.end())
+            _charts.push_back(&chart);
+          ++_chart_version;
         }
 
         /**
@@ -167,6 +178,31 @@ namespace FEAT
             for(auto& x : _shape_charts.at(std::size_t(dim)))
               x = nullptr;
           }
+
+          // keep the versions of the removed charts, so that the geometry version never decreases
+          for(const ChartType* chart : _charts)
+            _chart_version += chart->get_version();
+          _charts.clear();
+          ++_chart_version;
+        }
+
+        /**
+         * \brief Returns the geometry version of this trafo.
+         *
+         * In contrast to the standard trafo, the geometry version of this trafo also changes if
+         * mesh-part/chart pairs are added or cleared or if any of the added charts is modified.
+         * The version is the sum of monotonic counters, which are never decremented, and clear()
+         * retains the versions of the removed charts, so each of these changes strictly increases
+         * the version and a version is never repeated.
+         *
+         * \returns The geometry version of this trafo.
+         */
+        std::uint64_t get_geometry_version() const
+        {
+          std::uint64_t version = this->_mesh.get_vertex_version() + _chart_version;
+          for(const ChartType* chart : _charts)
+            version += chart->get_version();
+          return version;
         }
 
         /**
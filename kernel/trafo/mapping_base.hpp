@@ -103,6 +103,19 @@ namespace FEAT
         return _mesh;
       }
 
+      /**
+       * \brief Returns the geometry version of this trafo.
+       *
+       * The geometry version changes whenever the geometry described by this trafo may have
+       * changed; for the standard trafo, this is the vertex version of the underlying mesh.
+       *
+       * \returns The geometry version of this trafo.
+       */
+      std::uint64_t get_geometry_version() const
+      {
+        return _mesh.get_vertex_version();
+      }
+
       /**
        * \brief Comparison operator
        *
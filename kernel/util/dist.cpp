@@ -8,8 +8,11 @@
 #include <kernel/util/math.hpp> // for ilog10
 
 // includes, system
+#include <cstdlib> // for malloc, free
 #include <cstring> // for strcpy, memcpy
 #include <cstdint>
+#include <algorithm>
+#include <utility>
 
 namespace FEAT
 {
@@ -102,6 +105,63 @@ namespace FEAT
     }
 #endif // FEAT_OVERRIDE_MPI_OPS
 
+    /// registry entry of a shared memory window
+    struct SharedWindowInfo
+    {
+      /// the window handle
+      MPI_Win win;
+      /// the group of the communicator that the window was allocated on
+      MPI_Group group;
+      /// specifies whether the window was released by its SharedWindow object
+      bool released;
+    };
+
+    // all shared memory windows in the order of their creation; the windows released by their
+    // SharedWindow objects are freed collectively by the next window allocation on the same
+    // process group or by finalize
+    static std::vector<SharedWindowInfo> shared_windows;
+
+    /// frees all windows of the group of comm, which have been released by all processes of comm
+    static void free_released_shared_windows(const MPI_Comm comm)
+    {
+      MPI_Group group;
+      MPI_Comm_group(comm, &group);
+
+      // all windows of the same group have been allocated collectively in the same order
+      std::vector<std::size_t> cands;
+      std::vector<int> flags;
+      for(std::size_t i(0); i < shared_windows.size(); ++i)
+      {
+        int result(MPI_UNEQUAL);
+        MPI_Group_compare(group, shared_windows[i].group, &result);
+        if(result == MPI_IDENT)
+        {
+          cands.push_back(i);
+          flags.push_back(shared_windows[i].released ? 1 : 0);
+        }
+      }
+      MPI_Group_free(&group);
+
+      int counts[2] = {int(cands.size()), -int(cands.size())};
+      MPI_Allreduce(MPI_IN_PLACE, counts, 2, MPI_INT, MPI_MAX, comm);
+      XASSERTM(counts[0] == -counts[1], "inconsistent shared window registries");
+      if(cands.empty())
+        return;
+
+      // free all windows that have been released by all processes in the order of their creation
+      MPI_Allreduce(MPI_IN_PLACE, flags.data(), int(flags.size()), MPI_INT, MPI_MIN, comm);
+      for(std::size_t k(0); k < cands.size(); ++k)
+      {
+        if(flags[k] == 0)
+          continue;
+        SharedWindowInfo& info = shared_windows[cands[k]];
+        MPI_Win_free(&info.win);
+        MPI_Group_free(&info.group);
+      }
+      shared_windows.erase(std::remove_if(shared_windows.begin(), shared_windows.end(),
+        [](const SharedWindowInfo& info) {return info.win == MPI_WIN_NULL;}), shared_windows.end());
+    }
+
     bool initialize(int& argc, char**& argv)
     {
       int already_initialized(0);
@@ -147,6 +207,15 @@ namespace FEAT
 
     void finalize()
     {
+      // free all released shared memory windows; the windows were created collectively, so freeing
+      // them in the order of their creation satisfies the collective semantics of MPI_Win_free
+      for(auto& info : shared_windows)
+      {
+        if(info.released)
+          MPI_Win_free(&info.win);
+        MPI_Group_free(&info.group);
+      }
+      shared_windows.clear();
 
 #ifdef FEAT_OVERRIDE_MPI_OPS
       Operation& my_op_sum = const_cast<Operation&>(Dist::op_sum);
@@ -526,6 +595,13 @@ namespace FEAT
       return Comm(newcomm);
     }
 
+    Comm Comm::comm_split_shared() const
+    {
+      MPI_Comm newcomm = MPI_COMM_NULL;
+      MPI_Comm_split_type(comm, MPI_COMM_TYPE_SHARED, _rank, MPI_INFO_NULL, &newcomm);
+      return Comm(newcomm);
+    }
+
     void Comm::barrier() const
     {
       MPI_Barrier(comm);
@@ -821,6 +897,93 @@ namespace FEAT
     /* ######################################################################################### */
     /* ######################################################################################### */
     /* ######################################################################################### */
+
+    SharedWindow::SharedWindow() :
+      _win(MPI_WIN_NULL),
+      _local(nullptr)
+    {
+    }
+
+    SharedWindow::SharedWindow(const Comm& comm, std::size_t bytes) :
+      _win(MPI_WIN_NULL),
+      _local(nullptr)
+    {
+      // this is collective, so free the windows released by all processes of the communicator first
+      free_released_shared_windows(comm.mpi_comm());
+
+      MPI_Win_allocate_shared(MPI_Aint(bytes), 1, MPI_INFO_NULL, comm.mpi_comm(), &_local, &_win);
+      SharedWindowInfo info;
+      info.win = _win;
+      info.released = false;
+      MPI_Comm_group(comm.mpi_comm(), &info.group);
+      shared_windows.push_back(info);
+      // open a passive target epoch for the lifetime of the window
+      MPI_Win_lock_all(MPI_MODE_NOCHECK, _win);
+    }
+
+    SharedWindow::SharedWindow(SharedWindow&& other) :
+      _win(other._win),
+      _local(other._local)
+    {
+      other._win = MPI_WIN_NULL;
+      other._local = nullptr;
+    }
+
+    SharedWindow& SharedWindow::operator=(SharedWindow&& other)
+    {
+      if(this == &other)
+        return *this;
+
+      XASSERTM(_win == MPI_WIN_NULL, "cannot move-assign to non-null window");
+
+      _win = other._win;
+      _local = other._local;
+      other._win = MPI_WIN_NULL;
+      other._local = nullptr;
+      return *this;
+    }
+
+    SharedWindow::~SharedWindow()
+    {
+      if(_win != MPI_WIN_NULL)
+      {
+        // close our access epoch, but defer the collective MPI_Win_free call
+        MPI_Win_unlock_all(_win);
+        for(auto& info : shared_windows)
+        {
+          if(info.win == _win)
+            info.released = true;
+        }
+      }
+    }
+
+    bool SharedWindow::is_null() const
+    {
+      return _win == MPI_WIN_NULL;
+    }
+
+    std::size_t SharedWindow::get_num_allocated()
+    {
+      return shared_windows.size();
+    }
+
+    void* SharedWindow::get_segment(int rank) const
+    {
+      MPI_Aint size(0);
+      int disp_unit(0);
+      void* ptr(nullptr);
+      MPI_Win_shared_query(_win, rank, &size, &disp_unit, &ptr);
+      return ptr;
+    }
+
+    void SharedWindow::sync() const
+    {
+      MPI_Win_sync(_win);
+    }
+
+    /* ######################################################################################### */
+    /* ######################################################################################### */
+    /* ######################################################################################### */
 #else // non-MPI build
     /* ######################################################################################### */
     /* ######################################################################################### */
@@ -1080,6 +1243,11 @@ namespace FEAT
       return Comm(1);
     }
 
+    Comm Comm::comm_split_shared() const
+    {
+      return Comm(1);
+    }
+
     void Comm::barrier() const
     {
       // nothing to do
@@ -1258,6 +1426,60 @@ namespace FEAT
     {
       os << msg << std::endl;
     }
+
+    SharedWindow::SharedWindow() :
+      _local(nullptr)
+    {
+    }
+
+    SharedWindow::SharedWindow(const Comm&, std::size_t bytes) :
+      _local(std::malloc(bytes > std::size_t(0) ? bytes : std::size_t(1)))
+    {
+    }
+
+    SharedWindow::SharedWindow(SharedWindow&& other) :
+      _local(other._local)
+    {
+      other._local = nullptr;
+    }
+
+    SharedWindow& SharedWindow::operator=(SharedWindow&& other)
+    {
+      if(this == &other)
+        return *this;
+
+      XASSERTM(_local == nullptr, "cannot move-assign to non-null window");
+
+      _local = other._local;
+      other._local = nullptr;
+      return *this;
+    }
+
+    SharedWindow::~SharedWindow()
+    {
+      if(_local != nullptr)
+        std::free(_local);
+    }
+
+    bool SharedWindow::is_null() const
+    {
+      return _local == nullptr;
+    }
+
+    std::size_t SharedWindow::get_num_allocated()
+    {
+      return std::size_t(0);
+    }
+
+    void* SharedWindow::get_segment(int rank) const
+    {
+      return (rank == 0 ? _local : nullptr);
+    }
+
+    void SharedWindow::sync() const
+    {
+      // nothing to do
+    }
 #endif // FEAT_HAVE_MPI
   } // namespace Dist
 } // namespace FEAT
@@ -59,7 +59,7 @@ namespace FEAT
      * This function is effectively a wrapper around the \c MPI_Init function.
      *
      * In addition, this function may perform further cleanup to release
-     * additionally defined datatype, operations, etc.
+     * additionally defined datatype, operations, released shared memory windows, etc.
      *
      * \see \cite MPI31 Section 8.7, page 357
      */
@@ -1591,6 +1591,21 @@ namespace FEAT
        */
       Comm comm_split(int color, int key) const;
 
+      /**
+       * \brief Creates a new sub-communicator for all processes that can share memory.
+       *
+       * This functions splits this communicator into disjoint sub-communicators by calling
+       * \c MPI_Comm_split_type with \c MPI_COMM_TYPE_SHARED, so that each sub-communicator
+       * contains all processes which reside on the same compute node. The processes in the
+       * new sub-communicator are ranked in the same order as in this communicator.
+       *
+       * \see \cite MPI31, Section 6.4.2, page 247
+       *
+       * \returns
+       * A new communicator for the set of processes which can share memory with this process.
+       */
+      Comm comm_split_shared() const;
+
       ///@}
 
       /**
@@ -3065,6 +3080,132 @@ namespace FEAT
       // end of extended comm group
       ///@}
     }; // class Comm
+
+    /**
+     * \brief Shared memory window class
+     *
+     * This class is a wrapper around a MPI-3 shared memory window, which is allocated by calling
+     * \c MPI_Win_allocate_shared on a communicator whose processes all reside on the same compute
+     * node, see Comm::comm_split_shared(). Each process owns one segment of the window, which can be
+     * accessed directly via load/store by all other processes of the communicator by using the
+     * pointer returned by get_segment(). The window is kept in a passive target access epoch for
+     * its entire lifetime, so the processes only have to call sync() to synchronize the public and
+     * private window copies and have to coordinate their accesses by other means, e.g. by sending
+     * zero-sized notification messages.
+     *
+     * \attention
+     * The allocation of a shared window object is a collective operation, i.e. it must be performed
+     * by all processes of the communicator at the same time. The destruction is not collective,
+     * because the window is only released by the destructor. The windows, which have been released
+     * by all processes of their communicator, are freed collectively by the next allocation of a
+     * shared window on a communicator with the same process group, and all remaining released
+     * windows are freed by Dist::finalize() in the order of their creation.
+     */
+    class SharedWindow
+    {
+#if defined(FEAT_HAVE_MPI) || defined(DOXYGEN)
+    protected:
+      /// our MPI window handle
+      MPI_Win _win;
+#endif // FEAT_HAVE_MPI
+    protected:
+      /// pointer to our own segment
+      void* _local;
+
+    public:
+      /**
+       * \brief Standard constructor
+       *
+       * This constructor creates a null window.
+       */
+      SharedWindow();
+
+      /**
+       * \brief Constructor
+       *
+       * This constructor allocates a new shared memory window.
+       *
+       * \param[in] comm
+       * The \transient communicator for the window. All processes of this communicator must
+       * reside on the same compute node.
+       *
+       * \param[in] bytes
+       * The size of the segment of this process in bytes; may be different on each process.
+       */
+      explicit SharedWindow(const Comm& comm, std::size_t bytes);
+
+      /// shared windows are non-copyable
+      SharedWindow(const SharedWindow&) = delete;
+      /// shared windows are non-copyable
+      SharedWindow& operator=(const SharedWindow&) = delete;
+
+      /// move constructor
+      SharedWindow(SharedWindow&& other);
+
+      /**
+       * \brief Move-assignment operator
+       *
+       * \attention
+       * The destination window represented by \p this must be a null window,
+       * as this operator will fire an assertion failure otherwise!
+       */
+      SharedWindow& operator=(SharedWindow&& other);
+
+      /**
+       * \brief virtual destructor
+       *
+       * This destructor releases the window, which is freed later by the next allocation of a
+       * window for the same process group or by Dist::finalize(), as \c MPI_Win_free is a
+       * collective operation.
+       */
+      virtual ~SharedWindow();
+
+      /**
+       * \brief Checks whether this window is a null window.
+       *
+       * \returns \c true, if this window represents \c MPI_WIN_NULL, otherwise \c false.
+       */
+      bool is_null() const;
+
+      /**
+       * \brief Returns the number of shared windows, which have been allocated but not freed yet.
+       *
+       * This includes all released windows whose collective \c MPI_Win_free is still pending.
+       */
+      static std::size_t get_num_allocated();
+
+      /**
+       * \brief Returns a pointer to the segment of this process.
+       */
+      void* get_local() const
+      {
+        return _local;
+      }
+
+      /**
+       * \brief Returns a pointer to the segment of another process.
+       *
+       * \param[in] rank
+       * The rank of the other process within the communicator of the window.
+       *
+       * \returns
+       * A pointer to the segment of the process, which can be accessed directly by this process.
+       *
+       * \see \cite MPI31, Section 11.2.3, page 409
+       */
+      void* get_segment(int rank) const;
+
+      /**
+       * \brief Synchronizes the public and private copies of the window.
+       *
+       * This function must be called after writing to the own segment and before notifying the
+       * other processes as well as after receiving a notification and before reading from the
+       * segment of another process.
+       *
+       * \see \cite MPI31, Section 11.5.4, page 443
+       */
+      void sync() const;
+    }; // class SharedWindow
   } // namespace Dist
 } // namespace FEAT
 
@@ -5,6 +5,7 @@
 
 #include <kernel/util/assertion.hpp>
 #include <kernel/util/dist_file_io.hpp>
+#include <kernel/util/trace.hpp>
 
 #include <iostream>
 #include <fstream>
@@ -35,6 +36,8 @@ namespace FEAT
 
   void DistFileIO::_read_file(std::stringstream& stream, const String& filename)
   {
+    FEAT_TRACE_SCOPE(TraceKind::io, "DistFileIO::_read_file");
+
     // open input file
     std::ifstream ifs(filename, std::ios_base::in);
     if(!ifs.is_open() || !ifs.good())
@@ -52,6 +55,8 @@ namespace FEAT
 
   void DistFileIO::_read_file(BinaryStream& stream, const String& filename)
   {
+    FEAT_TRACE_SCOPE(TraceKind::io, "DistFileIO::_read_file");
+
     // open input file
     std::ifstream ifs(filename, std::ios_base::in|std::ios_base::binary);
     if(!ifs.is_open() || !ifs.good())
@@ -69,6 +74,8 @@ namespace FEAT
 
   void DistFileIO::_write_file(std::stringstream& stream, const String& filename, bool truncate)
   {
+    FEAT_TRACE_SCOPE(TraceKind::io, "DistFileIO::_write_file");
+
     // determine output mode
     std::ios_base::openmode mode = std::ios_base::out;
     if(truncate)
@@ -88,6 +95,8 @@ namespace FEAT
 
   void DistFileIO::_write_file(BinaryStream& stream, const String& filename, bool truncate)
   {
+    FEAT_TRACE_SCOPE(TraceKind::io, "DistFileIO::_write_file");
+
     // determine output mode
     std::ios_base::openmode mode = std::ios_base::out|std::ios_base::binary;
     if(truncate)
@@ -226,6 +235,8 @@ namespace FEAT
 
   void DistFileIO::read_ordered(void* buffer, const std::size_t size, const String& filename, const Dist::Comm& comm)
   {
+    FEAT_TRACE_SCOPE_EX(TraceKind::io, "DistFileIO::read_ordered", -1, size);
+
     XASSERT((buffer != nullptr) || (size == std::size_t(0)));
 
     // open file
@@ -243,6 +254,8 @@ namespace FEAT
 
   void DistFileIO::write_ordered(const void* buffer, const std::size_t size, const String& filename, const Dist::Comm& comm, bool truncate)
   {
+    FEAT_TRACE_SCOPE_EX(TraceKind::io, "DistFileIO::write_ordered", -1, size);
+
     XASSERT((buffer != nullptr) || (size == std::size_t(0)));
 
     // select file access mode
@@ -443,6 +456,8 @@ namespace FEAT
 
   void DistFileIO::read_ordered(void* buffer, const std::size_t size, const String& filename, const Dist::Comm&)
   {
+    FEAT_TRACE_SCOPE_EX(TraceKind::io, "DistFileIO::read_ordered", -1, size);
+
     XASSERT((buffer != nullptr) || (size == std::size_t(0)));
 
     // determine output mode
@@ -465,6 +480,8 @@ namespace FEAT
 
   void DistFileIO::write_ordered(const void* buffer, const std::size_t size, const String& filename, const Dist::Comm&, bool truncate)
   {
+    FEAT_TRACE_SCOPE_EX(TraceKind::io, "DistFileIO::write_ordered", -1, size);
+
     XASSERT((buffer != nullptr) || (size == std::size_t(0)));
 
     // determine output mode
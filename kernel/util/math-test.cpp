@@ -7,6 +7,8 @@
 #include <kernel/util/math.hpp>
 #include <kernel/util/random.hpp>
 
+#include <vector>
+
 using namespace FEAT;
 using namespace FEAT::TestSystem;
 
@@ -421,3 +423,118 @@ MatrixInvertTest<double, std::uint32_t> matrix_invert_test_double_uint32;
 #ifdef FEAT_HAVE_QUADMATH
 MatrixInvertTest<__float128, int> matrix_invert_test_float128_int;
 #endif // FEAT_HAVE_QUADMATH
+
+/**
+ * \brief Test class for the dense factorization functions.
+ *
+ * \test Tests the LU and Cholesky factorizations with multiple right-hand-sides as well as the
+ * batched matrix inversion.
+ */
+template<typename DT_, typename IT_>
+class MatrixFactorizeTest :
+  public TestSystem::UnitTest
+{
+public:
+  MatrixFactorizeTest() :
+    TestSystem::UnitTest("MatrixFactorizeTest", Type::Traits<DT_>::name(), Type::Traits<IT_>::name())
+  {
+  }
+
+  virtual ~MatrixFactorizeTest()
+  {
+  }
+
+  // computes max_ij |A*X - B|
+  static DT_ calc_residual(const IT_ n, const IT_ s, const DT_* a, const IT_ m, const DT_* x, const DT_* b)
+  {
+    DT_ r(0);
+    for(IT_ i(0); i < n; ++i)
+    {
+      for(IT_ j(0); j < m; ++j)
+      {
+        DT_ t = -b[i*m + j];
+        for(IT_ l(0); l < n; ++l)
+          t += a[i*s + l] * x[l*m + j];
+        r = Math::max(r, Math::abs(t));
+      }
+    }
+    return r;
+  }
+
+  virtual void run() const override
+  {
+    const DT_ tol = Math::pow(Math::eps<DT_>(), DT_(0.7));
+
+    Random rng;
+
+    // test dimensions below and above the panel width
+    const IT_ dims[] = {1, 7, 32, 75};
+    for(IT_ n : dims)
+    {
+      const IT_ s = n + 3;
+      const IT_ m = 5;
+
+      // create a random symmetric and diagonally dominant matrix and a random rhs matrix
+      std::vector<DT_> a(std::size_t(n*s), DT_(0)), b(n*m);
+      for(IT_ i(0); i < n; ++i)
+      {
+        for(IT_ j(0); j < i; ++j)
+          a[i*s + j] = a[j*s + i] = rng(-DT_(1), DT_(1)) / DT_(n);
+        a[i*s + i] = DT_(2);
+      }
+      for(auto& x : b)
+        x = rng(-DT_(1), DT_(1));
+
+      // LU factorization with row swaps: scale the first row down to enforce pivoting
+      std::vector<DT_> alu(a);
+      for(IT_ j(0); j < n; ++j)
+        alu[j] *= DT_(1E-3);
+      std::vector<DT_> lu(alu), x(b);
+      std::vector<IT_> p(n);
+      const DT_ det_lu = Math::factorize_lu(n, s, lu.data(), p.data());
+      TEST_CHECK(Math::isnormal(det_lu));
+      Math::solve_lu(n, s, lu.data(), p.data(), m, x.data(), m);
+      TEST_CHECK_EQUAL_WITHIN_EPS(calc_residual(n, s, alu.data(), m, x.data(), b.data()), DT_(0), tol);
+
+      // compare determinant with invert_matrix
+      std::vector<DT_> ainv(alu);
+      const DT_ det_inv = Math::invert_matrix(n, s, ainv.data(), p.data());
+      TEST_CHECK_EQUAL_WITHIN_EPS(det_lu / det_inv, DT_(1), tol);
+
+      // Cholesky factorization
+      std::vector<DT_> ch(a);
+      x = b;
+      TEST_CHECK(Math::factorize_cholesky(n, s, ch.data()));
+      Math::solve_cholesky(n, s, ch.data(), m, x.data(), m);
+      TEST_CHECK_EQUAL_WITHIN_EPS(calc_residual(n, s, a.data(), m, x.data(), b.data()), DT_(0), tol);
+    }
+
+    // Cholesky must fail for an indefinite matrix
+    DT_ c[4] = {DT_(1), DT_(2), DT_(2), DT_(1)};
+    TEST_CHECK(!Math::factorize_cholesky(IT_(2), IT_(2), c));
+
+    // batched inversion of many small matrices
+    const IT_ count(100), n(5), s(6);
+    std::vector<DT_> mats(std::size_t(count*n*s)), invs, dets(count);
+    for(auto& x : mats)
+      x = rng(-DT_(1), DT_(1));
+    for(IT_ k(0); k < count; ++k)
+      for(IT_ i(0); i < n; ++i)
+        mats[k*n*s + i*s + i] += DT_(4);
+    invs = mats;
+    Math::invert_matrix_batched(count, n, s, invs.data(), dets.data());
+    for(IT_ k(0); k < count; ++k)
+    {
+      std::vector<DT_> ref(mats.begin() + std::ptrdiff_t(k*n*s), mats.begin() + std::ptrdiff_t((k+1)*n*s));
+      IT_ p[5];
+      const DT_ det = Math::invert_matrix(n, s, ref.data(), p);
+      TEST_CHECK_EQUAL_WITHIN_EPS(dets[k], det, tol * Math::abs(det));
+      for(IT_ i(0); i < n; ++i)
+        for(IT_ j(0); j < n; ++j)
+          TEST_CHECK_EQUAL_WITHIN_EPS(invs[k*n*s + i*s + j], ref[i*s + j], tol);
+    }
+  }
+};
+
+MatrixFactorizeTest<double, std::uint32_t> matrix_factorize_test_double_uint32;
+MatrixFactorizeTest<float, std::uint64_t> matrix_factorize_test_float_uint64;
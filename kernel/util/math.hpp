@@ -14,6 +14,7 @@
 // includes, system
 #include <cmath>
 #include <limits>
+#include <vector>
 
 #if defined(FEAT_HAVE_QUADMATH) && !defined(__CUDACC__)
 extern "C"
@@ -1273,6 +1274,376 @@ namespace FEAT
       return det;
     }
 
+    /**
+     * \brief Inverts a batch of small matrices of identical size in parallel.
+     *
+     * This function inverts \p count dense n x n matrices, which are stored consecutively in the
+     * array \p a, i.e. the k-th matrix starts at <c>a[k*n*stride]</c>, by calling invert_matrix
+     * for each matrix. The matrices are distributed over all available OpenMP threads and each
+     * thread uses its own temporary pivot array.
+     *
+     * \param[in] count
+     * The number of matrices to be inverted.
+     *
+     * \param[in] n
+     * The dimension of each matrix to be inverted. Must be > 0.
+     *
+     * \param[in] stride
+     * The stride of each matrix. Must be >= n.
+     *
+     * \param[in,out] a
+     * On entry, the matrices to be inverted. On exit, the inverse matrices.
+     *
+     * \param[out] det
+     * An array of length \p count that receives the determinants of the input matrices.
+     * May be \c nullptr if the determinants are not required.
+     */
+    template<typename DT_, typename IT_>
+    void invert_matrix_batched(const IT_ count, const IT_ n, const IT_ stride, DT_ a[], DT_ det[] = nullptr)
+    {
+      FEAT_PRAGMA_OMP(parallel if(count > IT_(16)))
+      {
+        std::vector<IT_> pivot(std::size_t(n > IT_(0) ? n : IT_(1)));
+
+        FEAT_PRAGMA_OMP(for schedule(static))
+        for(IT_ k = 0; k < count; ++k)
+        {
+          const DT_ d = invert_matrix(n, stride, &a[std::size_t(k)*std::size_t(n*stride)], pivot.data());
+          if(det != nullptr)
+            det[k] = d;
+        }
+      }
+    }
+
+    /**
+     * \brief Computes the LU factorization with partial pivoting of a dense matrix.
+     *
+     * This function computes the factorization \f$P\cdot A = L\cdot U\f$ of a dense n x n matrix
+     * in-situ, where \e L is a unit lower triangular matrix and \e U is an upper triangular matrix.
+     * In contrast to invert_matrix, this function physically swaps the rows of the matrix and it
+     * processes the matrix in column blocks: each column panel is factorized by the classical
+     * algorithm, whereas the trailing sub-matrix is updated only once per panel by a matrix-matrix
+     * product, which accesses all rows contiguously. The factorization can be used to solve systems
+     * with multiple right-hand-sides by the solve_lu function.
+     *
+     * \param[in] n
+     * The dimension of the matrix to be factorized. Must be > 0.
+     *
+     * \param[in] stride
+     * The stride of the matrix. Must be >= n.
+     *
+     * \param[in,out] a
+     * On entry, the matrix to be factorized. On exit, the strict lower triangular part contains
+     * the factor \e L and the upper triangular part contains the factor \e U.
+     *
+     * \param[out] p
+     * The pivot array of length at least <b>n</b>. On exit, the k-th row has been swapped with
+     * the p[k]-th row during the factorization.
+     *
+     * \returns
+     * The determinant of the input matrix \p a. If the determinant is zero, then the matrix is
+     * singular and the factorization must not be used.
+     */
+    template<typename DT_, typename IT_>
+    DT_ factorize_lu(const IT_ n, const IT_ stride, DT_ a[], IT_ p[])
+    {
+      // make sure that the parameters are valid
+      if((n <= IT_(0)) || (stride < n) || (a == nullptr) || (p == nullptr))
+        return DT_(0);
+
+      // panel width
+      static constexpr IT_ nb = IT_(32);
+
+      DT_ det = DT_(1);
+
+      for(IT_ kb(0); kb < n; kb += nb)
+      {
+        // end of current panel
+        const IT_ ke = (kb + nb < n ? kb + nb : n);
+
+        // step 1: factorize the panel columns kb,...,ke-1
+        for(IT_ k(kb); k < ke; ++k)
+        {
+          // find pivot row
+          IT_ piv = k;
+          DT_ pmax = Math::abs(a[k*stride + k]);
+          for(IT_ i(k+1); i < n; ++i)
+          {
+            const DT_ t = Math::abs(a[i*stride + k]);
+            if(t > pmax)
+            {
+              pmax = t;
+              piv = i;
+            }
+          }
+          p[k] = piv;
+
+          // swap the whole rows
+          if(piv != k)
+          {
+            for(IT_ j(0); j < n; ++j)
+            {
+              const DT_ t = a[k*stride + j];
+              a[k*stride + j] = a[piv*stride + j];
+              a[piv*stride + j] = t;
+            }
+            det = -det;
+          }
+
+          // update determinant
+          const DT_ pivot = a[k*stride + k];
+          det *= pivot;
+          if(pivot == DT_(0))
+            continue;
+
+          // eliminate column k within the panel
+          const DT_ pinv = DT_(1) / pivot;
+          for(IT_ i(k+1); i < n; ++i)
+          {
+            const DT_ f = (a[i*stride + k] *= pinv);
+            for(IT_ j(k+1); j < ke; ++j)
+              a[i*stride + j] -= f * a[k*stride + j];
+          }
+        }
+
+        // nothing left to update?
+        if(ke >= n)
+          break;
+
+        // step 2: compute the panel rows of U: U12 := L11^{-1} * A12
+        for(IT_ k(kb); k < ke; ++k)
+        {
+          for(IT_ i(k+1); i < ke; ++i)
+          {
+            const DT_ f = a[i*stride + k];
+            for(IT_ j(ke); j < n; ++j)
+              a[i*stride + j] -= f * a[k*stride + j];
+          }
+        }
+
+        // step 3: update the trailing sub-matrix: A22 := A22 - L21 * U12
+        for(IT_ i(ke); i < n; ++i)
+        {
+          for(IT_ k(kb); k < ke; ++k)
+          {
+            const DT_ f = a[i*stride + k];
+            for(IT_ j(ke); j < n; ++j)
+              a[i*stride + j] -= f * a[k*stride + j];
+          }
+        }
+      }
+
+      return det;
+    }
+
+    /**
+     * \brief Solves a linear system with multiple right-hand-sides by an LU factorization.
+     *
+     * \param[in] n
+     * The dimension of the factorized matrix.
+     *
+     * \param[in] stride
+     * The stride of the factorized matrix.
+     *
+     * \param[in] a, p
+     * The LU factorization and the pivot array as computed by factorize_lu.
+     *
+     * \param[in] m
+     * The number of right-hand-sides.
+     *
+     * \param[in,out] b
+     * On entry, the n x m right-hand-side matrix. On exit, the n x m solution matrix.
+     *
+     * \param[in] bstride
+     * The stride of the right-hand-side matrix. Must be >= m.
+     */
+    template<typename DT_, typename IT_>
+    void solve_lu(const IT_ n, const IT_ stride, const DT_ a[], const IT_ p[], const IT_ m, DT_ b[], const IT_ bstride)
+    {
+      // column block width for the right-hand-sides
+      static constexpr IT_ mb = IT_(256);
+
+      for(IT_ jb(0); jb < m; jb += mb)
+      {
+        const IT_ je = (jb + mb < m ? jb + mb : m);
+
+        // apply row swaps
+        for(IT_ k(0); k < n; ++k)
+        {
+          if(p[k] == k)
+            continue;
+          for(IT_ j(jb); j < je; ++j)
+          {
+            const DT_ t = b[k*bstride + j];
+            b[k*bstride + j] = b[p[k]*bstride + j];
+            b[p[k]*bstride + j] = t;
+          }
+        }
+
+        // forward substitution with unit lower triangular L
+        for(IT_ i(1); i < n; ++i)
+        {
+          for(IT_ k(0); k < i; ++k)
+          {
+            const DT_ f = a[i*stride + k];
+            for(IT_ j(jb); j < je; ++j)
+              b[i*bstride + j] -= f * b[k*bstride + j];
+          }
+        }
+
+        // backward substitution with upper triangular U
+        for(IT_ i(n); i > IT_(0); )
+        {
+          --i;
+          for(IT_ k(i+1); k < n; ++k)
+          {
+            const DT_ f = a[i*stride + k];
+            for(IT_ j(jb); j < je; ++j)
+              b[i*bstride + j] -= f * b[k*bstride + j];
+          }
+          const DT_ dinv = DT_(1) / a[i*stride + i];
+          for(IT_ j(jb); j < je; ++j)
+            b[i*bstride + j] *= dinv;
+        }
+      }
+    }
+
+    /**
+     * \brief Computes the Cholesky factorization of a symmetric positive definite dense matrix.
+     *
+     * This function computes the factorization \f$A = L\cdot L^\top\f$ in-situ, where only the
+     * lower triangular part of the matrix is accessed. As for factorize_lu, the matrix is processed
+     * in column panels and the trailing sub-matrix is updated once per panel by a product, which
+     * only accesses contiguous row segments.
+     *
+     * \param[in] n
+     * The dimension of the matrix to be factorized. Must be > 0.
+     *
+     * \param[in] stride
+     * The stride of the matrix. Must be >= n.
+     *
+     * \param[in,out] a
+     * On entry, the matrix to be factorized. On exit, the lower triangular part contains the factor \e L.
+     *
+     * \returns
+     * \c true, if the factorization was successful, or \c false, if the matrix is not positive definite.
+     */
+    template<typename DT_, typename IT_>
+    bool factorize_cholesky(const IT_ n, const IT_ stride, DT_ a[])
+    {
+      // make sure that the parameters are valid
+      if((n <= IT_(0)) || (stride < n) || (a == nullptr))
+        return false;
+
+      // panel width
+      static constexpr IT_ nb = IT_(32);
+
+      for(IT_ kb(0); kb < n; kb += nb)
+      {
+        const IT_ ke = (kb + nb < n ? kb + nb : n);
+
+        // step 1: factorize the panel columns kb,...,ke-1
+        for(IT_ k(kb); k < ke; ++k)
+        {
+          const DT_ d = a[k*stride + k];
+          if(!(d > DT_(0)))
+            return false;
+          const DT_ ld = Math::sqrt(d);
+          const DT_ linv = DT_(1) / ld;
+          a[k*stride + k] = ld;
+
+          // scale column k
+          for(IT_ i(k+1); i < n; ++i)
+            a[i*stride + k] *= linv;
+
+          // update the remaining panel columns
+          for(IT_ i(k+1); i < n; ++i)
+          {
+            const DT_ f = a[i*stride + k];
+            const IT_ je = (i < ke ? i+1 : ke);
+            for(IT_ j(k+1); j < je; ++j)
+              a[i*stride + j] -= f * a[j*stride + k];
+          }
+        }
+
+        // step 2: update the trailing sub-matrix: A22 := A22 - L21 * L21^T
+        for(IT_ i(ke); i < n; ++i)
+        {
+          for(IT_ j(ke); j <= i; ++j)
+          {
+            DT_ s(0);
+            for(IT_ k(kb); k < ke; ++k)
+              s += a[i*stride + k] * a[j*stride + k];
+            a[i*stride + j] -= s;
+          }
+        }
+      }
+
+      return true;
+    }
+
+    /**
+     * \brief Solves a linear system with multiple right-hand-sides by a Cholesky factorization.
+     *
+     * \param[in] n
+     * The dimension of the factorized matrix.
+     *
+     * \param[in] stride
+     * The stride of the factorized matrix.
+     *
+     * \param[in] a
+     * The Cholesky factorization as computed by factorize_cholesky.
+     *
+     * \param[in] m
+     * The number of right-hand-sides.
+     *
+     * \param[in,out] b
+     * On entry, the n x m right-hand-side matrix. On exit, the n x m solution matrix.
+     *
+     * \param[in] bstride
+     * The stride of the right-hand-side matrix. Must be >= m.
+     */
+    template<typename DT_, typename IT_>
+    void solve_cholesky(const IT_ n, const IT_ stride, const DT_ a[], const IT_ m, DT_ b[], const IT_ bstride)
+    {
+      // column block width for the right-hand-sides
+      static constexpr IT_ mb = IT_(256);
+
+      for(IT_ jb(0); jb < m; jb += mb)
+      {
+        const IT_ je = (jb + mb < m ? jb + mb : m);
+
+        // forward substitution with L
+        for(IT_ i(0); i < n; ++i)
+        {
+          for(IT_ k(0); k < i; ++k)
+          {
+            const DT_ f = a[i*stride + k];
+            for(IT_ j(jb); j < je; ++j)
+              b[i*bstride + j] -= f * b[k*bstride + j];
+          }
+          const DT_ dinv = DT_(1) / a[i*stride + i];
+          for(IT_ j(jb); j < je; ++j)
+            b[i*bstride + j] *= dinv;
+        }
+
+        // backward substitution with L^T
+        for(IT_ i(n); i > IT_(0); )
+        {
+          --i;
+          const DT_ dinv = DT_(1) / a[i*stride + i];
+          for(IT_ j(jb); j < je; ++j)
+            b[i*bstride + j] *= dinv;
+          for(IT_ k(0); k < i; ++k)
+          {
+            const DT_ f = a[i*stride + k];
+            for(IT_ j(jb); j < je; ++j)
+              b[k*bstride + j] -= f * b[i*bstride + j];
+          }
+        }
+      }
+    }
+
     /**
      * \brief Math Limits class template
      *
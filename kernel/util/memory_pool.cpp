@@ -7,3 +7,4 @@
 
 // static member initialization
 std::map<void*, FEAT::Util::Intern::MemoryInfo> FEAT::MemoryPool::_pool;
+std::map<void*, void*> FEAT::MemoryPool::_views;
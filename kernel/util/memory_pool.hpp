@@ -54,6 +54,18 @@ namespace FEAT
         /// Map of all memory chunks in use.
         static std::map<void*, Util::Intern::MemoryInfo> _pool;
 
+        /// Map of all registered views, which maps each view address onto the start address of its chunk.
+        static std::map<void*, void*> _views;
+
+        /// drops all views into the memory chunk \p it, which is about to be freed
+        static void _erase_views(std::map<void*, Util::Intern::MemoryInfo>::iterator it)
+        {
+          if(_views.empty())
+            return;
+          char* chunk_end = static_cast<char*>(it->first) + it->second.size;
+          _views.erase(_views.lower_bound(it->first), _views.lower_bound(static_cast<void*>(chunk_end)));
+        }
+
       public:
 
         /// Setup memory pools
@@ -115,6 +127,14 @@ namespace FEAT
             return;
           }
 
+          // views act on the reference counter of their chunk
+          std::map<void*, void*>::iterator jt(_views.find(address));
+          if (jt != _views.end())
+          {
+            increase_memory(jt->second);
+            return;
+          }
+
           XABORTM("MemoryPool::increase_memory: Memory address not found!");
         }
 
@@ -134,6 +154,7 @@ namespace FEAT
 #else
               ::free(address);
 #endif
+              _erase_views(it);
               _pool.erase(it);
             }
             else
@@ -143,9 +164,45 @@ namespace FEAT
             return;
           }
 
+          // views act on the reference counter of their chunk
+          std::map<void*, void*>::iterator jt(_views.find(address));
+          if (jt != _views.end())
+          {
+            release_memory(jt->second);
+            return;
+          }
+
           XABORTM("MemoryPool::release_memory: Memory address not found!");
         }
 
+        /**
+         * \brief Registers a view into a memory chunk
+         *
+         * A view is an address which points into the interior of a memory chunk, e.g. the first entry
+         * of a sub-vector of a contiguous meta-vector. Once registered, the view can be passed to
+         * increase_memory() and release_memory() just like the start address of the chunk; both
+         * then act on the reference counter of the chunk. The registration is dropped when the chunk
+         * is freed. This function does not change the reference counter of the chunk.
+         *
+         * \param[in] chunk The start address of the memory chunk, as returned by allocate_memory().
+         * \param[in] address The address of the view, which must point into the chunk.
+         *
+         * \returns \p address
+         */
+        template <typename DT_>
+        static DT_ * create_view(DT_ * chunk, DT_ * address)
+        {
+          std::map<void*, Util::Intern::MemoryInfo>::iterator it(_pool.find(chunk));
+          if (it == _pool.end())
+            XABORTM("MemoryPool::create_view: Memory address not found!");
+          XASSERTM((chunk <= address) && (reinterpret_cast<char*>(address) < reinterpret_cast<char*>(chunk) + it->second.size),
+            "view address outside of memory chunk");
+
+          if (address != chunk)
+            _views[address] = chunk;
+          return address;
+        }
+
         /// download memory chunk to host memory
         template <typename DT_>
         [[deprecated("no download necessary in unified memory environment.")]]
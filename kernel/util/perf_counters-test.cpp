@@ -0,0 +1,103 @@
+// FEAT3: Finite Element Analysis Toolbox, Version 3
+// Copyright (C) 2010 - 2023 by Stefan Turek & the FEAT group
+// FEAT3 is released under the GNU General Public License version 3,
+// see the file 'copyright.txt' in the top level directory for details.
+
+#include <test_system/test_system.hpp>
+#include <kernel/util/perf_counters.hpp>
+#include <kernel/util/dist.hpp>
+
+#include <thread>
+#include <vector>
+
+using namespace FEAT;
+using namespace FEAT::TestSystem;
+
+/**
+ * \brief Test class for the PerfCounters class.
+ *
+ * \test Tests the PerfCounters class and the performance counter regions.
+ *
+ * \note The hardware counters may be unavailable on the test system, so this test only checks
+ * the counter values if PerfCounters::available() returns true.
+ */
+class PerfCountersTest :
+  public TestSystem::UnitTest
+{
+public:
+  PerfCountersTest() :
+    TestSystem::UnitTest("PerfCountersTest")
+  {
+  }
+
+  virtual ~PerfCountersTest()
+  {
+  }
+
+  static double work(std::vector<double>& v)
+  {
+    double s(0.0);
+    for(std::size_t i(0); i < v.size(); ++i)
+      s += (v[i] = 0.5 * double(i) + s * 1E-9);
+    return s;
+  }
+
+  virtual void run() const override
+  {
+    std::vector<double> v(100000u);
+    PerfCounters::reset();
+
+    // disabled regions are not recorded
+    {
+      FEAT_PERF_REGION("test-region");
+      work(v);
+    }
+    TEST_CHECK_EQUAL(PerfCounters::get_region("test-region").calls, 0u);
+
+    // enabled regions are recorded
+    PerfCounters::enable();
+    for(int i(0); i < 3; ++i)
+    {
+      FEAT_PERF_REGION("test-region");
+      work(v);
+    }
+    {
+      FEAT_PERF_REGION("outer-region");
+      FEAT_PERF_REGION_LEVEL("test-region", 2);
+      work(v);
+    }
+
+    // regions of other threads are accumulated without locking
+    std::thread t1([&]() {FEAT_PERF_REGION("thread-region");}), t2([&]() {FEAT_PERF_REGION("thread-region");});
+    t1.join();
+    t2.join();
+    PerfCounters::disable();
+
+    PerfCounters::RegionStats stats = PerfCounters::get_region("test-region");
+    TEST_CHECK_EQUAL(stats.calls, 3u);
+    TEST_CHECK(stats.seconds > 0.0);
+    TEST_CHECK_EQUAL(stats.nested_calls, 0u);
+    TEST_CHECK_EQUAL(PerfCounters::get_region("test-region", 2).calls, 1u);
+    TEST_CHECK_EQUAL(PerfCounters::get_region("test-region", 2).nested_calls, 1u);
+    TEST_CHECK_EQUAL(PerfCounters::get_region("outer-region").nested_calls, 0u);
+    TEST_CHECK_EQUAL(PerfCounters::get_region("thread-region").calls, 2u);
+
+    if(PerfCounters::available())
+    {
+      // the loop executes at least one instruction per entry
+      TEST_CHECK_EQUAL(stats.valid_calls, 3u);
+      TEST_CHECK(stats.counts[1] >= 3u * v.size());
+    }
+    else
+    {
+      TEST_CHECK_EQUAL(stats.valid_calls, 0u);
+    }
+
+    // format the regions
+    String s = PerfCounters::get_formatted_regions(Dist::Comm::world());
+    TEST_CHECK(s.find("test-region [2] *") != s.npos);
+
+    PerfCounters::reset();
+    TEST_CHECK_EQUAL(PerfCounters::get_region("test-region").calls, 0u);
+  }
+} perf_counters_test;
@@ -0,0 +1,348 @@
+// FEAT3: Finite Element Analysis Toolbox, Version 3
+// Copyright (C) 2010 - 2023 by Stefan Turek & the FEAT group
+// FEAT3 is released under the GNU General Public License version 3,
+// see the file 'copyright.txt' in the top level directory for details.
+
+#include <kernel/util/perf_counters.hpp>
+#include <kernel/util/dist.hpp>
+
+#include <cstring>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <vector>
+
+#if defined(__linux__)
+#  define FEAT_HAVE_PERF_EVENT 1
+#  include <linux/perf_event.h>
+#  include <sys/ioctl.h>
+#  include <sys/syscall.h>
+#  include <unistd.h>
+#endif
+
+using namespace FEAT;
+
+namespace FEAT
+{
+  namespace Intern
+  {
+    /**
+     * \brief Counter group of a single thread
+     *
+     * The first successfully opened event is the group leader; all other events are opened as
+     * group members, so that all values can be read by a single read call on the leader.
+     */
+    struct PerfThreadGroup
+    {
+      /// has the group been opened yet?
+      bool opened = false;
+      /// the file descriptors of the events or -1
+      int fds[PerfCounters::num_events] = {-1, -1, -1, -1};
+      /// the index of each event in the group read buffer or -1
+      int slot[PerfCounters::num_events] = {-1, -1, -1, -1};
+      /// the number of events in the group
+      int num_open = 0;
+
+#ifdef FEAT_HAVE_PERF_EVENT
+      ~PerfThreadGroup()
+      {
+        for(std::size_t i(0); i < PerfCounters::num_events; ++i)
+        {
+          if(fds[i] >= 0)
+            ::close(fds[i]);
+        }
+      }
+
+      static int open_event(std::uint32_t type, std::uint64_t config, int group_fd)
+      {
+        struct perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = type;
+        attr.config = config;
+        attr.disabled = (group_fd < 0 ? 1 : 0);
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_GROUP;
+        return int(::syscall(__NR_perf_event_open, &attr, 0, -1, group_fd, 0ul));
+      }
+
+      void open()
+      {
+        opened = true;
+        const std::uint32_t types[PerfCounters::num_events] =
+        {
+          PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE
+        };
+        const std::uint64_t configs[PerfCounters::num_events] =
+        {
+          PERF_COUNT_HW_CPU_CYCLES,
+          PERF_COUNT_HW_INSTRUCTIONS,
+          PERF_COUNT_HW_CACHE_REFERENCES,
+          PERF_COUNT_HW_CACHE_MISSES
+        };
+        int leader = -1;
+        for(std::size_t i(0); i < PerfCounters::num_events; ++i)
+        {
+          fds[i] = open_event(types[i], configs[i], leader);
+          if(fds[i] < 0)
+            continue;
+          if(leader < 0)
+            leader = fds[i];
+          slot[i] = num_open++;
+        }
+        if(leader >= 0)
+        {
+          ::ioctl(leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+          ::ioctl(leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+        }
+      }
+
+      bool read(PerfCounters::ValueArray& values)
+      {
+        if(!opened)
+          open();
+        if(num_open <= 0)
+          return false;
+
+        // group read format: { u64 nr; u64 values[nr]; }
+        std::uint64_t buf[PerfCounters::num_events + 1u];
+        int leader = -1;
+        for(std::size_t i(0); (i < PerfCounters::num_events) && (leader < 0); ++i)
+          leader = fds[i];
+        const std::size_t bytes = sizeof(std::uint64_t) * std::size_t(num_open + 1);
+        if(::read(leader, buf, bytes) != ssize_t(bytes))
+          return false;
+        for(std::size_t i(0); i < PerfCounters::num_events; ++i)
+          values[i] = (slot[i] >= 0 ? buf[1 + slot[i]] : std::uint64_t(0));
+        return true;
+      }
+#else // no FEAT_HAVE_PERF_EVENT
+      bool read(PerfCounters::ValueArray&)
+      {
+        opened = true;
+        return false;
+      }
+#endif // FEAT_HAVE_PERF_EVENT
+    };
+
+    /// key of a region: static name pointer and level
+    typedef std::pair<const char*, int> PerfRegionKey;
+
+    /// region statistics of a single thread; only written by the owning thread
+    struct PerfThreadTable
+    {
+      std::map<PerfRegionKey, PerfCounters::RegionStats> regions;
+      /// current region nesting depth
+      int depth = 0;
+    };
+
+    /// global registry of all thread tables; the table list is protected by the mutex
+    struct PerfRegistry
+    {
+      std::mutex mutex;
+      std::vector<std::unique_ptr<PerfThreadTable>> tables;
+    };
+
+    static PerfRegistry& perf_registry()
+    {
+      // the tables are intentionally never freed before program exit, so that the statistics
+      // of threads which have already terminated are still available
+      static PerfRegistry registry;
+      return registry;
+    }
+
+    static thread_local PerfThreadGroup perf_thread_group;
+    static thread_local PerfThreadTable* perf_thread_table = nullptr;
+
+    /// returns the table of the calling thread and registers it if necessary
+    static PerfThreadTable& perf_get_thread_table()
+    {
+      if(perf_thread_table == nullptr)
+      {
+        PerfRegistry& reg = perf_registry();
+        std::lock_guard<std::mutex> lock(reg.mutex);
+        reg.tables.emplace_back(new PerfThreadTable());
+        perf_thread_table = reg.tables.back().get();
+      }
+      return *perf_thread_table;
+    }
+
+    /// accumulates b onto a
+    static void perf_accumulate(PerfCounters::RegionStats& a, const PerfCounters::RegionStats& b)
+    {
+      a.calls += b.calls;
+      a.valid_calls += b.valid_calls;
+      a.nested_calls += b.nested_calls;
+      a.seconds += b.seconds;
+      for(std::size_t i(0); i < PerfCounters::num_events; ++i)
+        a.counts[i] += b.counts[i];
+    }
+
+    /// merges all regions with the same name and level, which may have different name pointers
+    static std::map<std::pair<String, int>, PerfCounters::RegionStats> perf_merge_regions()
+    {
+      PerfRegistry& reg = perf_registry();
+      std::lock_guard<std::mutex> lock(reg.mutex);
+      std::map<std::pair<String, int>, PerfCounters::RegionStats> merged;
+      for(const auto& tab : reg.tables)
+      {
+        for(const auto& it : tab->regions)
+          perf_accumulate(merged[std::make_pair(String(it.first.first), it.first.second)], it.second);
+      }
+      return merged;
+    }
+  } // namespace Intern
+} // namespace FEAT
+
+std::atomic<bool> PerfCounters::_enabled(false);
+
+bool PerfCounters::available()
+{
+  ValueArray values;
+  return Intern::perf_thread_group.read(values);
+}
+
+bool PerfCounters::read(ValueArray& values)
+{
+  return Intern::perf_thread_group.read(values);
+}
+
+int PerfCounters::enter_region()
+{
+  return Intern::perf_get_thread_table().depth++;
+}
+
+void PerfCounters::add_region(const char* name, int level, double seconds, const ValueArray& deltas, bool valid, bool nested)
+{
+  Intern::PerfThreadTable& tab = Intern::perf_get_thread_table();
+  --tab.depth;
+  RegionStats& stats = tab.regions[std::make_pair(name, level)];
+  ++stats.calls;
+  if(nested)
+    ++stats.nested_calls;
+  stats.seconds += seconds;
+  if(valid)
+  {
+    ++stats.valid_calls;
+    for(std::size_t i(0); i < num_events; ++i)
+      stats.counts[i] += deltas[i];
+  }
+}
+
+PerfCounters::RegionStats PerfCounters::get_region(const String& name, int level)
+{
+  RegionStats stats;
+  Intern::PerfRegistry& reg = Intern::perf_registry();
+  std::lock_guard<std::mutex> lock(reg.mutex);
+  for(const auto& tab : reg.tables)
+  {
+    for(const auto& it : tab->regions)
+    {
+      if((it.first.second == level) && (name.compare(it.first.first) == 0))
+        Intern::perf_accumulate(stats, it.second);
+    }
+  }
+  return stats;
+}
+
+void PerfCounters::reset()
+{
+  Intern::PerfRegistry& reg = Intern::perf_registry();
+  std::lock_guard<std::mutex> lock(reg.mutex);
+  for(auto& tab : reg.tables)
+    tab->regions.clear();
+}
+
+String PerfCounters::get_formatted_regions(const Dist::Comm& comm)
+{
+  auto merged = Intern::perf_merge_regions();
+
+  // serialize our region keys as "level:name\n" strings
+  String my_keys;
+  for(const auto& it : merged)
+    my_keys += stringify(it.first.second) + ":" + it.first.first + "\n";
+
+  // gather the keys of all processes and build the union
+  const int nprocs = comm.size();
+  int my_len = int(my_keys.size());
+  std::vector<int> lens(std::size_t(nprocs), 0), displs(std::size_t(nprocs), 0);
+  comm.allgather(&my_len, std::size_t(1), lens.data(), std::size_t(1));
+  for(int i(1); i < nprocs; ++i)
+    displs[std::size_t(i)] = displs[std::size_t(i-1)] + lens[std::size_t(i-1)];
+  std::vector<char> all_keys(std::size_t(displs.back() + lens.back()) + 1u, '\0');
+  comm.allgatherv(my_keys.data(), my_keys.size(), all_keys.data(), lens.data(), displs.data());
+
+  std::set<std::pair<String, int>> keys;
+  {
+    std::deque<String> lines = String(all_keys.data()).split_by_charset("\n");
+    for(const auto& line : lines)
+    {
+      const std::size_t p = line.find(':');
+      if(p == line.npos)
+        continue;
+      int level(-1);
+      line.substr(0u, p).parse(level);
+      keys.insert(std::make_pair(line.substr(p+1u), level));
+    }
+  }
+
+  // fill the value arrays in union order: calls and counters are summed, times are maximized
+  const std::size_t n = keys.size();
+  const std::size_t m = 3u + num_events;
+  std::vector<std::uint64_t> sums(n*m, 0u), sums_all(n*m, 0u);
+  std::vector<double> times(n, 0.0), times_max(n, 0.0), times_sum(n, 0.0);
+  std::size_t k(0u);
+  for(const auto& key : keys)
+  {
+    auto it = merged.find(key);
+    if(it != merged.end())
+    {
+      sums[k*m + 0u] = it->second.calls;
+      sums[k*m + 1u] = it->second.valid_calls;
+      sums[k*m + 2u] = it->second.nested_calls;
+      for(std::size_t i(0); i < num_events; ++i)
+        sums[k*m + 3u + i] = it->second.counts[i];
+      times[k] = it->second.seconds;
+    }
+    ++k;
+  }
+  comm.allreduce(sums.data(), sums_all.data(), n*m, Dist::op_sum);
+  comm.allreduce(times.data(), times_max.data(), n, Dist::op_max);
+  comm.allreduce(times.data(), times_sum.data(), n, Dist::op_sum);
+
+  // format the table
+  String s;
+  s += String("Region").pad_back(40) + String("Calls").pad_front(10) + String("Time Max").pad_front(12);
+  s += String("IPC").pad_front(8) + String("LLC Miss").pad_front(10) + String("Mem [GB]").pad_front(12);
+  s += String("BW [GB/s]").pad_front(12) + "\n";
+  k = 0u;
+  for(const auto& key : keys)
+  {
+    const std::uint64_t* v = &sums_all[k*m];
+    String name = key.first;
+    if(key.second >= 0)
+      name += " [" + stringify(key.second) + "]";
+    if(v[2] > 0u)
+      name += " *";
+    s += name.pad_back(40) + stringify(v[0]).pad_front(10) + stringify_fp_fix(times_max[k], 6, 12);
+    if(v[1] > 0u)
+    {
+      const double cycles = double(v[3]), instrs = double(v[4]), refs = double(v[5]), misses = double(v[6]);
+      const double gbytes = 1E-9 * misses * double(cache_line_size);
+      s += stringify_fp_fix(cycles > 0.0 ? instrs / cycles : 0.0, 2, 8);
+      s += (stringify_fp_fix(refs > 0.0 ? 100.0 * misses / refs : 0.0, 1, 9) + "%");
+      s += stringify_fp_fix(gbytes, 3, 12);
+      // the average bandwidth per process multiplied by the number of processes
+      s += stringify_fp_fix(times_sum[k] > 0.0 ? gbytes * double(nprocs) / times_sum[k] : 0.0, 3, 12);
+    }
+    else
+      s += String("-").pad_front(8) + String("-").pad_front(10) + String("-").pad_front(12) + String("-").pad_front(12);
+    s += "\n";
+    ++k;
+  }
+  s += "All values are inclusive; regions marked by '*' were (also) entered within other regions.\n";
+  return s;
+}
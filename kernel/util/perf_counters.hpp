@@ -0,0 +1,273 @@
+// FEAT3: Finite Element Analysis Toolbox, Version 3
+// Copyright (C) 2010 - 2023 by Stefan Turek & the FEAT group
+// FEAT3 is released under the GNU General Public License version 3,
+// see the file 'copyright.txt' in the top level directory for details.
+
+#pragma once
+#ifndef KERNEL_UTIL_PERF_COUNTERS_HPP
+#define KERNEL_UTIL_PERF_COUNTERS_HPP 1
+
+// includes, FEAT
+#include <kernel/base_header.hpp>
+#include <kernel/util/string.hpp>
+
+// includes, system
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace FEAT
+{
+  // forward declaration
+  namespace Dist
+  {
+    class Comm;
+  } // namespace Dist
+
+  /**
+   * \brief Hardware performance counter regions
+   *
+   * This class implements an optional instrumentation layer, which measures hardware performance
+   * counters for named code regions by using the Linux \c perf_event_open interface. For each
+   * thread that enters a region, a single group of counters is opened, which measures the
+   * following events of the calling thread in user space:
+   * - CPU cycles
+   * - retired instructions
+   * - last level cache references
+   * - last level cache misses
+   *
+   * The counter values at the begin and end of each region are read by a single \c read call on
+   * the group leader and the differences are accumulated per (region name, level) pair along with
+   * the call count and the wall-clock time. The estimated memory traffic of a region is derived
+   * from the number of last level cache misses times the cache line size, since the integrated
+   * memory controller counters are not accessible without elevated privileges on most systems.
+   *
+   * Regions are created by the #FEAT_PERF_REGION and #FEAT_PERF_REGION_LEVEL macros. The counters
+   * are disabled by default, in which case entering a region only costs a single relaxed atomic
+   * load; they can be enabled by calling PerfCounters::enable(). While enabled, each region costs
+   * two \c read system calls, so regions should only be placed around coarse-grained operations
+   * like solver or multigrid level operations rather than around single BLAS kernels.
+   *
+   * The statistics are accumulated in thread-local tables without any locking; the only locked
+   * operation is the registration of a thread's table upon its first region. The times and counter
+   * values of a region are inclusive, i.e. they also contain the values of all regions nested within;
+   * regions which were entered within another region are marked as nested in the formatted output. If the counters cannot be opened,
+   * e.g. because the system's \c perf_event_paranoid setting forbids it or because FEAT is not
+   * running on Linux, only call counts and wall-clock times are recorded.
+   *
+   * The results of all processes can be aggregated and formatted by calling the collective
+   * function PerfCounters::get_formatted_regions(), which complements the solver statistics
+   * that are provided by Statistics::get_formatted_solver_tree(). If the counters are enabled,
+   * Control::Statistics::report() prints this table right after the solver tree.
+   *
+   * \note The functions get_region(), reset() and get_formatted_regions() must not be called
+   * while other threads are still inside a region.
+   */
+  class PerfCounters
+  {
+  public:
+    /// number of hardware events per counter group
+    static constexpr std::size_t num_events = 4u;
+    /// assumed cache line size in bytes for memory traffic estimation
+    static constexpr std::uint64_t cache_line_size = 64u;
+
+    /// the counter values of a counter group
+    typedef std::array<std::uint64_t, num_events> ValueArray;
+
+    /// accumulated statistics of a single region
+    struct RegionStats
+    {
+      /// number of calls
+      std::uint64_t calls = 0u;
+      /// number of calls with valid counter values
+      std::uint64_t valid_calls = 0u;
+      /// number of calls that were nested within another region of the same thread
+      std::uint64_t nested_calls = 0u;
+      /// accumulated wall-clock time in seconds
+      double seconds = 0.0;
+      /// accumulated counter values
+      ValueArray counts = {};
+    };
+
+  private:
+    /// specifies whether the counters are enabled
+    static std::atomic<bool> _enabled;
+
+  public:
+    /// Enables the performance counters.
+    static void enable()
+    {
+      _enabled.store(true, std::memory_order_relaxed);
+    }
+
+    /// Disables the performance counters; the accumulated statistics are kept.
+    static void disable()
+    {
+      _enabled.store(false, std::memory_order_relaxed);
+    }
+
+    /// Checks whether the performance counters are enabled.
+    static bool enabled()
+    {
+      return _enabled.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * \brief Checks whether hardware counters are available for the calling thread.
+     *
+     * This function tries to open the counter group of the calling thread if it has not been
+     * opened yet.
+     */
+    static bool available();
+
+    /**
+     * \brief Reads the current counter values of the calling thread.
+     *
+     * \param[out] values
+     * Receives the current counter values; events which are not supported are set to zero.
+     *
+     * \returns \c true, if the counters could be read, otherwise \c false.
+     */
+    static bool read(ValueArray& values);
+
+    /**
+     * \brief Enters a new region on the calling thread.
+     *
+     * \returns The nesting depth of the calling thread before entering the region.
+     */
+    static int enter_region();
+
+    /**
+     * \brief Adds a measurement to the statistics of a region and leaves the region.
+     *
+     * \param[in] name
+     * The name of the region; must have static storage duration.
+     *
+     * \param[in] level
+     * The level of the region or -1.
+     *
+     * \param[in] seconds
+     * The elapsed wall-clock time.
+     *
+     * \param[in] deltas
+     * The counter differences; only used if \p valid is \c true.
+     *
+     * \param[in] valid
+     * Specifies whether \p deltas contains valid counter values.
+     *
+     * \param[in] nested
+     * Specifies whether the region was entered within another region.
+     */
+    static void add_region(const char* name, int level, double seconds, const ValueArray& deltas, bool valid, bool nested);
+
+    /**
+     * \brief Returns the accumulated statistics of a region of this process.
+     *
+     * \note This function returns the sum over all regions with the same name and level.
+     */
+    static RegionStats get_region(const String& name, int level = -1);
+
+    /// Discards all accumulated region statistics.
+    static void reset();
+
+    /**
+     * \brief Returns a formatted table of all regions aggregated over all processes.
+     *
+     * \attention This function is a collective operation and must be called by all processes in the communicator.
+     *
+     * \param[in] comm
+     * The communicator whose processes are to be aggregated.
+     *
+     * \returns
+     * A formatted table, where the counters are summed up over all processes and the time is the
+     * maximum over all processes. Regions which were nested within other regions are marked by an
+     * asterisk, as their values are already contained in the inclusive values of their enclosing
+     * regions. The table is only valid on rank 0.
+     */
+    static String get_formatted_regions(const Dist::Comm& comm);
+  }; // class PerfCounters
+
+  /**
+   * \brief Performance counter region
+   *
+   * This class measures the performance counters for its lifetime, if the counters were enabled
+   * upon construction. Use the #FEAT_PERF_REGION macro rather than creating objects by hand.
+   */
+  class PerfRegion
+  {
+  private:
+    const char* _name;
+    int _level;
+    bool _active;
+    bool _valid;
+    bool _nested;
+    std::chrono::steady_clock::time_point _start;
+    PerfCounters::ValueArray _values;
+
+  public:
+    explicit PerfRegion(const char* name, int level = -1) :
+      _name(name),
+      _level(level),
+      _active(PerfCounters::enabled()),
+      _valid(false),
+      _nested(false),
+      _start(),
+      _values()
+    {
+      if(_active)
+      {
+        _nested = (PerfCounters::enter_region() > 0);
+        _valid = PerfCounters::read(_values);
+        _start = std::chrono::steady_clock::now();
+      }
+    }
+
+    PerfRegion(const PerfRegion&) = delete;
+    PerfRegion& operator=(const PerfRegion&) = delete;
+
+    ~PerfRegion()
+    {
+      if(!_active)
+        return;
+      const double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - _start).count();
+      PerfCounters::ValueArray values = {};
+      _valid = _valid && PerfCounters::read(values);
+      if(_valid)
+      {
+        for(std::size_t i(0); i < PerfCounters::num_events; ++i)
+          values[i] -= _values[i];
+      }
+      PerfCounters::add_region(_name, _level, secs, values, _valid, _nested);
+    }
+  }; // class PerfRegion
+} // namespace FEAT
+
+/// \cond internal
+#define FEAT_PERF_CONCAT_IMPL(a_, b_) a_##b_
+#define FEAT_PERF_CONCAT(a_, b_) FEAT_PERF_CONCAT_IMPL(a_, b_)
+/// \endcond
+
+#if defined(FEAT_NO_PERF_COUNTERS) && !defined(DOXYGEN)
+#define FEAT_PERF_REGION(name_) do {} while(false)
+#define FEAT_PERF_REGION_LEVEL(name_, level_) do {} while(false)
+#else
+/**
+ * \brief Measures the performance counters for the remainder of the enclosing scope.
+ *
+ * \param name_ A string literal naming the region.
+ */
+#define FEAT_PERF_REGION(name_) \
+  FEAT::PerfRegion FEAT_PERF_CONCAT(feat_perf_region_, __LINE__)(name_)
+
+/**
+ * \brief Measures the performance counters for the remainder of the enclosing scope.
+ *
+ * \param name_ A string literal naming the region.
+ * \param level_ The (multigrid) level of the region.
+ */
+#define FEAT_PERF_REGION_LEVEL(name_, level_) \
+  FEAT::PerfRegion FEAT_PERF_CONCAT(feat_perf_region_, __LINE__)(name_, int(level_))
+#endif // FEAT_NO_PERF_COUNTERS
+
+#endif // KERNEL_UTIL_PERF_COUNTERS_HPP
@@ -56,6 +56,19 @@ double Statistics::toe_partition;
 double Statistics::toe_assembly;
 double Statistics::toe_solve;
 
+void Statistics::_trace_solver_expression(Solver::ExpressionBase& expression)
+{
+  const Solver::ExpressionType type = expression.get_type();
+  trace_solver_expression(type, Tracer::intern(get_solver_trace_name(expression.solver_name, type)));
+}
+
+String Statistics::get_solver_trace_name(const String& solver_name, Solver::ExpressionType type)
+{
+  if((type == Solver::ExpressionType::start_solve) || (type == Solver::ExpressionType::end_solve))
+    return solver_name;
+  return solver_name + ":" + stringify(type);
+}
+
 String Statistics::_generate_formatted_solver_tree(String target)
 {
   std::list<String> names;
@@ -11,6 +11,8 @@
 #include <kernel/util/string.hpp>
 #include <kernel/util/exception.hpp>
 #include <kernel/util/kahan_summation.hpp>
+#include <kernel/util/perf_counters.hpp>
+#include <kernel/util/trace.hpp>
 #include <kernel/solver/expression.hpp>
 
 #include <list>
@@ -161,6 +163,9 @@ namespace FEAT
 
       static String _generate_formatted_solver_tree(String target);
 
+      /// records a solver expression as an event in the Tracer
+      static void _trace_solver_expression(Solver::ExpressionBase& expression);
+
     public:
 
       /// specifies whether collection of solver expressions is to be enabled
@@ -341,10 +346,79 @@ namespace FEAT
 
       inline static void add_solver_expression(std::shared_ptr<Solver::ExpressionBase> expression)
       {
+        if(Tracer::enabled())
+          _trace_solver_expression(*expression);
         if(enable_solver_expressions)
           _solver_expressions[expression_target].push_back(expression);
       }
 
+      /**
+       * \brief Creates and adds a new solver expression
+       *
+       * In contrast to the overload above, the expression object and the solver name are only
+       * created if solver expressions are enabled. The Tracer event is recorded by the trace name
+       * id cached in the solver, see Solver::SolverBase::get_trace_id(), so that this function
+       * neither allocates memory nor builds any strings unless solver expressions are enabled.
+       *
+       * \tparam Expression_
+       * The type of the expression that is to be created.
+       *
+       * \param[in] solver
+       * The solver that adds the expression.
+       *
+       * \param[in] args
+       * The remaining arguments for the constructor of the expression.
+       */
+      template<typename Expression_, typename Solver_, typename... Args_>
+      inline static void add_solver_expression(const Solver_& solver, Args_&&... args)
+      {
+        if(Tracer::enabled())
+          trace_solver_expression(Expression_::expression_type, solver.get_trace_id(Expression_::expression_type));
+        if(enable_solver_expressions)
+          _solver_expressions[expression_target].push_back(std::make_shared<Expression_>(solver.name(), std::forward<Args_>(args)...));
+      }
+
+      /**
+       * \brief Records a solver expression as an event in the Tracer
+       *
+       * \param[in] type
+       * The type of the solver expression.
+       *
+       * \param[in] trace_id
+       * The interned trace name of the expression, see Solver::SolverBase::get_trace_id().
+       */
+      inline static void trace_solver_expression(Solver::ExpressionType type, std::uint32_t trace_id)
+      {
+        switch(type)
+        {
+        case Solver::ExpressionType::start_solve:
+          Tracer::record_interned(TraceKind::solver, TracePhase::begin, trace_id);
+          break;
+
+        case Solver::ExpressionType::end_solve:
+          Tracer::record_interned(TraceKind::solver, TracePhase::end, trace_id);
+          break;
+
+        default:
+          Tracer::record_interned(TraceKind::solver, TracePhase::instant, trace_id);
+          break;
+        }
+      }
+
+      /**
+       * \brief Returns the name of a solver expression in the Tracer
+       *
+       * \param[in] solver_name
+       * The name of the solver that adds the expression.
+       *
+       * \param[in] type
+       * The type of the solver expression.
+       *
+       * \returns
+       * The solver name for start and end expressions, otherwise the solver name followed by the expression type.
+       */
+      static String get_solver_trace_name(const String& solver_name, Solver::ExpressionType type);
+
       static const std::list<std::shared_ptr<Solver::ExpressionBase>> & get_solver_expressions()
       {
         return _solver_expressions.at(expression_target);
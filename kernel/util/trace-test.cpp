@@ -0,0 +1,123 @@
+// FEAT3: Finite Element Analysis Toolbox, Version 3
+// Copyright (C) 2010 - 2023 by Stefan Turek & the FEAT group
+// FEAT3 is released under the GNU General Public License version 3,
+// see the file 'copyright.txt' in the top level directory for details.
+
+#include <test_system/test_system.hpp>
+#include <kernel/util/trace.hpp>
+
+#include <sstream>
+#include <thread>
+
+using namespace FEAT;
+using namespace FEAT::TestSystem;
+
+/**
+ * \brief Test class for the Tracer class.
+ *
+ * \test Tests the Tracer class and its Chrome trace export.
+ */
+class TraceTest :
+  public TestSystem::UnitTest
+{
+public:
+  TraceTest() :
+    TestSystem::UnitTest("TraceTest")
+  {
+  }
+
+  virtual ~TraceTest()
+  {
+  }
+
+  static std::size_t count_substr(const String& str, const String& sub)
+  {
+    std::size_t n(0u);
+    for(std::size_t p = str.find(sub); p != str.npos; p = str.find(sub, p + sub.size()))
+      ++n;
+    return n;
+  }
+
+  virtual void run() const override
+  {
+    // nothing is recorded while the tracer is disabled
+    Tracer::clear();
+    {
+      FEAT_TRACE_SCOPE(TraceKind::user, "disabled");
+    }
+    TEST_CHECK_EQUAL(Tracer::size(), std::size_t(0));
+
+    // record a few events in this thread
+    Tracer::enable(128u);
+    {
+      FEAT_TRACE_SCOPE(TraceKind::user, "outer");
+      FEAT_TRACE_SCOPE_EX(TraceKind::multigrid, "inner", 2, 1024u);
+      FEAT_TRACE_INSTANT(TraceKind::io, "instant");
+    }
+    std::uint32_t id = Tracer::intern("PCG");
+    TEST_CHECK_EQUAL(Tracer::intern("PCG"), id);
+    TEST_CHECK_EQUAL(Tracer::get_name(id), String("PCG"));
+    Tracer::record_interned(TraceKind::solver, TracePhase::begin, id);
+    Tracer::record_interned(TraceKind::solver, TracePhase::end, id);
+    TEST_CHECK_EQUAL(Tracer::size(), std::size_t(5));
+
+    // record events in two other threads
+    auto worker = []()
+    {
+      for(int i(0); i < 10; ++i)
+      {
+        FEAT_TRACE_SCOPE(TraceKind::assembly, "worker");
+      }
+    };
+    std::thread t1(worker), t2(worker);
+    t1.join();
+    t2.join();
+    TEST_CHECK_EQUAL(Tracer::size(), std::size_t(25));
+
+    // export as Chrome trace and check the contents
+    std::ostringstream oss;
+    Tracer::write_chrome_json(oss, 3);
+    String json(oss.str());
+    TEST_CHECK_EQUAL(json.substr(0u, 15u), String("{\"displayTimeUn"));
+    TEST_CHECK_EQUAL(count_substr(json, "\"ph\":\"X\""), std::size_t(22));
+    TEST_CHECK_EQUAL(count_substr(json, "\"ph\":\"i\""), std::size_t(1));
+    TEST_CHECK_EQUAL(count_substr(json, "\"ph\":\"B\""), std::size_t(1));
+    TEST_CHECK_EQUAL(count_substr(json, "\"ph\":\"E\""), std::size_t(1));
+    TEST_CHECK_EQUAL(count_substr(json, "\"name\":\"worker\""), std::size_t(20));
+    TEST_CHECK_EQUAL(count_substr(json, "\"name\":\"PCG\""), std::size_t(2));
+    TEST_CHECK_EQUAL(count_substr(json, "\"args\":{\"level\":2,\"bytes\":1024}"), std::size_t(1));
+    TEST_CHECK_EQUAL(count_substr(json, "\"pid\":3"), std::size_t(26));
+    TEST_CHECK_EQUAL(count_substr(json, "\"cat\":\"multigrid\""), std::size_t(1));
+    TEST_CHECK(json.ends_with("]}\n"));
+
+    // overflow the ring buffer of this thread: only the last 128 events are kept
+    for(int i(0); i < 200; ++i)
+    {
+      FEAT_TRACE_INSTANT(TraceKind::user, "overflow");
+    }
+    TEST_CHECK_EQUAL(Tracer::size(), std::size_t(20 + 128));
+    TEST_CHECK_EQUAL(Tracer::lost(), std::size_t(5 + 200 - 128));
+
+    Tracer::disable();
+    Tracer::clear();
+    TEST_CHECK_EQUAL(Tracer::size(), std::size_t(0));
+    TEST_CHECK_EQUAL(Tracer::lost(), std::size_t(0));
+
+    // record events concurrently after clearing the buffers
+    Tracer::enable(128u);
+    auto interner = []()
+    {
+      for(int i(0); i < 10; ++i)
+        Tracer::record_interned(TraceKind::user, TracePhase::instant, Tracer::intern("name" + stringify(i)));
+    };
+    std::thread t3(interner), t4(interner), t5(worker);
+    t3.join();
+    t4.join();
+    t5.join();
+    TEST_CHECK_EQUAL(Tracer::size(), std::size_t(30));
+    TEST_CHECK_EQUAL(Tracer::lost(), std::size_t(0));
+
+    Tracer::disable();
+    Tracer::clear();
+  }
+} trace_test;
@@ -0,0 +1,291 @@
+// FEAT3: Finite Element Analysis Toolbox, Version 3
+// Copyright (C) 2010 - 2023 by Stefan Turek & the FEAT group
+// FEAT3 is released under the GNU General Public License version 3,
+// see the file 'copyright.txt' in the top level directory for details.
+
+#include <kernel/util/trace.hpp>
+#include <kernel/util/dist.hpp>
+#include <kernel/util/dist_file_io.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+#include <vector>
+
+using namespace FEAT;
+
+namespace FEAT
+{
+  namespace Intern
+  {
+    /**
+     * \brief Ring buffer of a single thread
+     *
+     * Only the owning thread writes into the ring buffer; the head counter is published with
+     * release semantics so that the exporting thread sees all records written before.
+     */
+    struct TraceBuffer
+    {
+      /// the records; size is a power of two
+      std::vector<TraceRecord> records;
+      /// total number of records written so far; only written by the owning thread
+      std::atomic<std::uint64_t> head;
+      /// number of records discarded by Tracer::clear(); only written by the exporting thread
+      std::atomic<std::uint64_t> tail;
+      /// the id of the owning thread
+      int thread_id;
+
+      explicit TraceBuffer(std::size_t capacity, int tid) :
+        records(capacity),
+        head(0u),
+        tail(0u),
+        thread_id(tid)
+      {
+      }
+
+      /// returns the index of the first valid record for a given head
+      std::uint64_t first(std::uint64_t h) const
+      {
+        const std::uint64_t cap = std::uint64_t(records.size());
+        return std::max(tail.load(std::memory_order_acquire), (h > cap ? h - cap : std::uint64_t(0)));
+      }
+    };
+
+    /// global tracer state; all members are protected by the mutex
+    struct TraceRegistry
+    {
+      std::mutex mutex;
+      std::vector<std::unique_ptr<TraceBuffer>> buffers;
+      std::vector<String> names;
+      std::unordered_map<std::string, std::uint32_t> name_map;
+      std::chrono::steady_clock::time_point epoch = std::chrono::steady_clock::now();
+    };
+
+    static TraceRegistry& trace_registry()
+    {
+      // buffers are intentionally never freed before program exit, so that the records of
+      // threads which have already terminated can still be exported
+      static TraceRegistry registry;
+      return registry;
+    }
+
+    static thread_local TraceBuffer* trace_local_buffer = nullptr;
+    static thread_local std::unordered_map<std::string, std::uint32_t> trace_local_names;
+
+    static void trace_write_escaped(std::ostream& os, const char* s)
+    {
+      for(; *s != '\0'; ++s)
+      {
+        switch(*s)
+        {
+        case '"':
+          os << "\\\"";
+          break;
+        case '\\':
+          os << "\\\\";
+          break;
+        case '\n':
+          os << "\\n";
+          break;
+        default:
+          if((unsigned char)(*s) >= 0x20u)
+            os << *s;
+          break;
+        }
+      }
+    }
+  } // namespace Intern
+} // namespace FEAT
+
+std::atomic<bool> Tracer::_enabled(false);
+std::atomic<std::size_t> Tracer::_capacity(std::size_t(1) << 16);
+
+void Tracer::enable(std::size_t capacity)
+{
+  std::size_t cap(64u);
+  while(cap < capacity)
+    cap <<= 1;
+  _capacity.store(cap, std::memory_order_relaxed);
+  _enabled.store(true, std::memory_order_relaxed);
+}
+
+std::int64_t Tracer::now()
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+    std::chrono::steady_clock::now() - Intern::trace_registry().epoch).count();
+}
+
+std::uint32_t Tracer::intern(const String& name)
+{
+  // try the thread-local cache first
+  auto it = Intern::trace_local_names.find(name);
+  if(it != Intern::trace_local_names.end())
+    return it->second;
+
+  std::uint32_t id(0u);
+  {
+    Intern::TraceRegistry& reg = Intern::trace_registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    auto jt = reg.name_map.find(name);
+    if(jt != reg.name_map.end())
+      id = jt->second;
+    else
+    {
+      id = std::uint32_t(reg.names.size());
+      reg.names.push_back(name);
+      reg.name_map.emplace(name, id);
+    }
+  }
+  Intern::trace_local_names.emplace(name, id);
+  return id;
+}
+
+String Tracer::get_name(std::uint32_t name_id)
+{
+  Intern::TraceRegistry& reg = Intern::trace_registry();
+  std::lock_guard<std::mutex> lock(reg.mutex);
+  return (std::size_t(name_id) < reg.names.size()) ? reg.names.at(name_id) : String("?");
+}
+
+void Tracer::record(const TraceRecord& rec)
+{
+  Intern::TraceBuffer* buf = Intern::trace_local_buffer;
+  if(buf == nullptr)
+  {
+    // first event of this thread: create and register a new buffer
+    Intern::TraceRegistry& reg = Intern::trace_registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    reg.buffers.emplace_back(new Intern::TraceBuffer(_capacity.load(std::memory_order_relaxed), int(reg.buffers.size())));
+    buf = Intern::trace_local_buffer = reg.buffers.back().get();
+  }
+
+  const std::uint64_t h = buf->head.load(std::memory_order_relaxed);
+  buf->records[std::size_t(h) & (buf->records.size() - 1u)] = rec;
+  buf->head.store(h + 1u, std::memory_order_release);
+}
+
+std::size_t Tracer::size()
+{
+  Intern::TraceRegistry& reg = Intern::trace_registry();
+  std::lock_guard<std::mutex> lock(reg.mutex);
+  std::size_t n(0u);
+  for(const auto& b : reg.buffers)
+  {
+    const std::uint64_t h = b->head.load(std::memory_order_acquire);
+    n += std::size_t(h - std::min(h, b->first(h)));
+  }
+  return n;
+}
+
+std::size_t Tracer::lost()
+{
+  Intern::TraceRegistry& reg = Intern::trace_registry();
+  std::lock_guard<std::mutex> lock(reg.mutex);
+  std::size_t n(0u);
+  for(const auto& b : reg.buffers)
+  {
+    const std::uint64_t h = b->head.load(std::memory_order_acquire);
+    const std::uint64_t t = b->tail.load(std::memory_order_acquire);
+    const std::uint64_t cap = std::uint64_t(b->records.size());
+    if(h > t + cap)
+      n += std::size_t(h - t - cap);
+  }
+  return n;
+}
+
+void Tracer::clear()
+{
+  Intern::TraceRegistry& reg = Intern::trace_registry();
+  std::lock_guard<std::mutex> lock(reg.mutex);
+  // the head counters are owned by the recording threads, so only advance the read positions
+  for(auto& b : reg.buffers)
+    b->tail.store(b->head.load(std::memory_order_acquire), std::memory_order_release);
+}
+
+void Tracer::write_chrome_events(std::ostream& os, int pid, bool leading_comma)
+{
+  Intern::TraceRegistry& reg = Intern::trace_registry();
+  std::lock_guard<std::mutex> lock(reg.mutex);
+
+  const char* sep = leading_comma ? ",\n" : "";
+
+  // process name meta event
+  os << sep << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << pid
+     << ",\"tid\":0,\"args\":{\"name\":\"rank " << pid << "\"}}";
+  sep = ",\n";
+
+  std::ostringstream oss;
+  oss.precision(3);
+  oss << std::fixed;
+
+  for(const auto& b : reg.buffers)
+  {
+    const std::uint64_t h = b->head.load(std::memory_order_acquire);
+    const std::uint64_t cap = std::uint64_t(b->records.size());
+
+    for(std::uint64_t k(b->first(h)); k < h; ++k)
+    {
+      const TraceRecord& rec = b->records[std::size_t(k & (cap - 1u))];
+      os << sep << "{\"name\":\"";
+      if(rec.name != nullptr)
+        Intern::trace_write_escaped(os, rec.name);
+      else if(std::size_t(rec.name_id) < reg.names.size())
+        Intern::trace_write_escaped(os, reg.names[rec.name_id].c_str());
+      oss.str("");
+      oss << 1E-3 * double(rec.t_begin);
+      os << "\",\"cat\":\"" << rec.kind << "\",\"ts\":" << oss.str();
+      switch(rec.phase)
+      {
+      case TracePhase::complete:
+        oss.str("");
+        oss << 1E-3 * double(rec.t_end - rec.t_begin);
+        os << ",\"ph\":\"X\",\"dur\":" << oss.str();
+        break;
+      case TracePhase::begin:
+        os << ",\"ph\":\"B\"";
+        break;
+      case TracePhase::end:
+        os << ",\"ph\":\"E\"";
+        break;
+      case TracePhase::instant:
+        os << ",\"ph\":\"i\",\"s\":\"t\"";
+        break;
+      }
+      os << ",\"pid\":" << pid << ",\"tid\":" << b->thread_id;
+      if((rec.level >= 0) || (rec.bytes > 0u))
+      {
+        os << ",\"args\":{";
+        if(rec.level >= 0)
+          os << "\"level\":" << rec.level << (rec.bytes > 0u ? "," : "");
+        if(rec.bytes > 0u)
+          os << "\"bytes\":" << rec.bytes;
+        os << "}";
+      }
+      os << "}";
+    }
+  }
+}
+
+void Tracer::write_chrome_json(std::ostream& os, int pid)
+{
+  os << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n";
+  write_chrome_events(os, pid, false);
+  os << "\n]}\n";
+}
+
+void Tracer::write_chrome_json(const String& filename, const Dist::Comm& comm)
+{
+  const int rank = comm.rank();
+  std::ostringstream oss;
+  if(rank == 0)
+    oss << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n";
+  write_chrome_events(oss, rank, rank > 0);
+  if(rank + 1 == comm.size())
+    oss << "\n]}\n";
+
+  const std::string str = oss.str();
+  DistFileIO::write_ordered(str.data(), str.size(), filename, comm);
+}
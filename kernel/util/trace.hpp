@@ -0,0 +1,349 @@
+// FEAT3: Finite Element Analysis Toolbox, Version 3
+// Copyright (C) 2010 - 2023 by Stefan Turek & the FEAT group
+// FEAT3 is released under the GNU General Public License version 3,
+// see the file 'copyright.txt' in the top level directory for details.
+
+#pragma once
+#ifndef KERNEL_UTIL_TRACE_HPP
+#define KERNEL_UTIL_TRACE_HPP 1
+
+// includes, FEAT
+#include <kernel/base_header.hpp>
+#include <kernel/util/string.hpp>
+
+// includes, system
+#include <atomic>
+#include <cstdint>
+#include <iostream>
+
+namespace FEAT
+{
+  // forward declaration
+  namespace Dist
+  {
+    class Comm;
+  } // namespace Dist
+
+  /**
+   * \brief Trace event kind enumeration
+   *
+   * This enumeration is used to categorize the events recorded by the Tracer; the kind of an
+   * event is exported as the \c cat field of the Chrome trace event format.
+   */
+  enum class TraceKind : std::uint8_t
+  {
+    /// user-defined event
+    user = 0,
+    /// solver event (start/end of solve, preconditioner calls, defects, ...)
+    solver,
+    /// multigrid level operation (smoothing, transfer, coarse grid solve)
+    multigrid,
+    /// assembly job
+    assembly,
+    /// gate/mirror synchronization
+    sync,
+    /// file input/output
+    io,
+    /// mesh and domain setup
+    domain
+  };
+
+  /// \cond internal
+  inline std::ostream& operator<<(std::ostream& os, TraceKind kind)
+  {
+    switch(kind)
+    {
+    case TraceKind::user:
+      return os << "user";
+    case TraceKind::solver:
+      return os << "solver";
+    case TraceKind::multigrid:
+      return os << "multigrid";
+    case TraceKind::assembly:
+      return os << "assembly";
+    case TraceKind::sync:
+      return os << "sync";
+    case TraceKind::io:
+      return os << "io";
+    case TraceKind::domain:
+      return os << "domain";
+    default:
+      return os << "unknown";
+    }
+  }
+  /// \endcond
+
+  /**
+   * \brief Trace event phase enumeration
+   *
+   * The values correspond to the phases of the Chrome trace event format.
+   */
+  enum class TracePhase : std::uint8_t
+  {
+    /// complete event with begin and end time stamp
+    complete = 0,
+    /// begin of a nested duration event
+    begin,
+    /// end of a nested duration event
+    end,
+    /// instant event
+    instant
+  };
+
+  /**
+   * \brief Fixed-size trace event record
+   *
+   * This is the record type that is stored in the per-thread ring buffers of the Tracer.
+   * The record does not own any dynamic memory: the name of the event is either a pointer to
+   * a string with static storage duration or, if \p name is \c nullptr, the event refers to
+   * a name that has been registered by Tracer::intern() via its \p name_id.
+   */
+  struct TraceRecord
+  {
+    /// begin time stamp in nanoseconds since Tracer epoch
+    std::int64_t t_begin;
+    /// end time stamp in nanoseconds since Tracer epoch
+    std::int64_t t_end;
+    /// static event name or nullptr
+    const char* name;
+    /// number of bytes processed/transferred by the event
+    std::uint64_t bytes;
+    /// interned name id; only used if name is nullptr
+    std::uint32_t name_id;
+    /// multigrid level or -1
+    std::int16_t level;
+    /// event kind
+    TraceKind kind;
+    /// event phase
+    TracePhase phase;
+  }; // struct TraceRecord
+
+  /**
+   * \brief Low-overhead event tracer
+   *
+   * This class implements a lightweight event tracing facility, which records fixed-size
+   * TraceRecord objects into thread-local ring buffers. Recording an event neither allocates
+   * memory nor acquires a lock: each thread writes into its own ring buffer, which is created
+   * and registered (the only locked operation) upon the first event recorded by that thread.
+   * If a ring buffer overflows, the oldest events of that thread are overwritten.
+   *
+   * Tracing is disabled by default, in which case the cost of a trace point is a single relaxed
+   * atomic load. Tracing can be enabled at runtime by calling Tracer::enable(). Additionally, all
+   * trace points can be removed at compile time by defining the \c FEAT_NO_TRACE macro.
+   *
+   * The recorded events can be exported in the Chrome trace event JSON format, which can be
+   * viewed in \c chrome://tracing or in the Perfetto UI (https://ui.perfetto.dev). In an MPI
+   * application, the events of all processes can be written into a single common file, where
+   * each process is represented by its rank as the process id and each thread by its own id.
+   *
+   * Trace points are usually created by the following macros:
+   * - #FEAT_TRACE_SCOPE(kind, name) records a complete event for the current scope
+   * - #FEAT_TRACE_SCOPE_EX(kind, name, level, bytes) does the same with additional info
+   * - #FEAT_TRACE_INSTANT(kind, name) records an instant event
+   *
+   * All global state of the tracer is either atomic or protected by a mutex, so events may be
+   * recorded concurrently by any number of (OpenMP) threads. Each ring buffer is written only by
+   * its owning thread, whereas clear() merely advances an atomic read position of each buffer.
+   *
+   * \note The export functions must not be called while other threads are still recording events.
+   */
+  class Tracer
+  {
+  private:
+    /// specifies whether tracing is enabled
+    static std::atomic<bool> _enabled;
+    /// ring buffer capacity for newly created thread buffers
+    static std::atomic<std::size_t> _capacity;
+
+  public:
+    /**
+     * \brief Enables the tracer.
+     *
+     * \param[in] capacity
+     * The capacity of each per-thread ring buffer in records. Will be rounded up to the next
+     * power of two. Only affects threads that record their first event after this call.
+     */
+    static void enable(std::size_t capacity = std::size_t(1) << 16);
+
+    /// Disables the tracer; previously recorded events are kept.
+    static void disable()
+    {
+      _enabled.store(false, std::memory_order_relaxed);
+    }
+
+    /// Checks whether the tracer is enabled.
+    static bool enabled()
+    {
+      return _enabled.load(std::memory_order_relaxed);
+    }
+
+    /// Returns the current time stamp in nanoseconds since the tracer epoch.
+    static std::int64_t now();
+
+    /**
+     * \brief Registers a dynamic event name and returns its id.
+     *
+     * Each thread keeps a cache of the names it has interned before, so that only the first
+     * lookup of a name within a thread requires a lock.
+     */
+    static std::uint32_t intern(const String& name);
+
+    /// Returns a previously interned name.
+    static String get_name(std::uint32_t name_id);
+
+    /// Records a trace record into the calling thread's ring buffer.
+    static void record(const TraceRecord& rec);
+
+    /// Records a complete event with a static name.
+    static void record(TraceKind kind, const char* name, std::int64_t t_begin, std::int64_t t_end,
+      int level = -1, std::uint64_t bytes = 0u)
+    {
+      record(TraceRecord{t_begin, t_end, name, bytes, 0u, std::int16_t(level), kind, TracePhase::complete});
+    }
+
+    /// Records an event with an interned name.
+    static void record_interned(TraceKind kind, TracePhase phase, std::uint32_t name_id, int level = -1, std::uint64_t bytes = 0u)
+    {
+      const std::int64_t t = now();
+      record(TraceRecord{t, t, nullptr, bytes, name_id, std::int16_t(level), kind, phase});
+    }
+
+    /// Returns the total number of records currently stored in all ring buffers.
+    static std::size_t size();
+
+    /// Returns the total number of records that were overwritten due to ring buffer overflows.
+    static std::size_t lost();
+
+    /// Discards all recorded events.
+    static void clear();
+
+    /**
+     * \brief Writes all recorded events of this process as Chrome trace events.
+     *
+     * This function writes the events as a comma-separated list of JSON objects without the
+     * enclosing array, so that the output of several processes can be concatenated.
+     *
+     * \param[out] os
+     * The stream that the events are to be written to.
+     *
+     * \param[in] pid
+     * The process id to be used for the events, usually the rank of the process.
+     *
+     * \param[in] leading_comma
+     * Specifies whether the first event is to be preceded by a comma.
+     */
+    static void write_chrome_events(std::ostream& os, int pid, bool leading_comma);
+
+    /**
+     * \brief Writes all recorded events of this process as a Chrome trace JSON document.
+     *
+     * \param[out] os
+     * The stream that the trace is to be written to.
+     *
+     * \param[in] pid
+     * The process id to be used for the events.
+     */
+    static void write_chrome_json(std::ostream& os, int pid = 0);
+
+    /**
+     * \brief Writes the recorded events of all processes into a common Chrome trace JSON file.
+     *
+     * \attention This function is a collective operation and must be called by all processes in the communicator.
+     *
+     * \param[in] filename
+     * The name of the output file. The file can be loaded by chrome://tracing or the Perfetto UI.
+     *
+     * \param[in] comm
+     * The communicator of the processes whose events are to be written.
+     */
+    static void write_chrome_json(const String& filename, const Dist::Comm& comm);
+  }; // class Tracer
+
+  /**
+   * \brief Scoped trace event
+   *
+   * This class records a complete event spanning its lifetime, if the Tracer was enabled upon
+   * construction. Use the #FEAT_TRACE_SCOPE macro rather than creating objects by hand.
+   */
+  class TraceScope
+  {
+  private:
+    const char* _name;
+    std::int64_t _t_begin;
+    std::uint64_t _bytes;
+    std::int16_t _level;
+    TraceKind _kind;
+    bool _active;
+
+  public:
+    explicit TraceScope(TraceKind kind, const char* name, int level = -1, std::uint64_t bytes = 0u) :
+      _name(name),
+      _t_begin(0),
+      _bytes(bytes),
+      _level(std::int16_t(level)),
+      _kind(kind),
+      _active(Tracer::enabled())
+    {
+      if(_active)
+        _t_begin = Tracer::now();
+    }
+
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+
+    /// Sets the number of bytes processed within this scope.
+    void set_bytes(std::uint64_t bytes)
+    {
+      _bytes = bytes;
+    }
+
+    ~TraceScope()
+    {
+      if(_active)
+        Tracer::record(TraceRecord{_t_begin, Tracer::now(), _name, _bytes, 0u, _level, _kind, TracePhase::complete});
+    }
+  }; // class TraceScope
+} // namespace FEAT
+
+/// \cond internal
+#define FEAT_TRACE_CONCAT_IMPL(a_, b_) a_##b_
+#define FEAT_TRACE_CONCAT(a_, b_) FEAT_TRACE_CONCAT_IMPL(a_, b_)
+/// \endcond
+
+#if defined(FEAT_NO_TRACE) && !defined(DOXYGEN)
+#define FEAT_TRACE_SCOPE(kind_, name_) do {} while(false)
+#define FEAT_TRACE_SCOPE_EX(kind_, name_, level_, bytes_) do {} while(false)
+#define FEAT_TRACE_INSTANT(kind_, name_) do {} while(false)
+#else
+/**
+ * \brief Records a complete trace event for the remainder of the enclosing scope.
+ *
+ * \param kind_ The FEAT::TraceKind of the event.
+ * \param name_ A string literal naming the event.
+ */
+#define FEAT_TRACE_SCOPE(kind_, name_) \
+  FEAT::TraceScope FEAT_TRACE_CONCAT(feat_trace_scope_, __LINE__)(kind_, name_)
+
+/**
+ * \brief Records a complete trace event with level and byte count for the enclosing scope.
+ *
+ * \param kind_ The FEAT::TraceKind of the event.
+ * \param name_ A string literal naming the event.
+ * \param level_ The multigrid level or -1.
+ * \param bytes_ The number of bytes processed in the scope.
+ */
+#define FEAT_TRACE_SCOPE_EX(kind_, name_, level_, bytes_) \
+  FEAT::TraceScope FEAT_TRACE_CONCAT(feat_trace_scope_, __LINE__)(kind_, name_, int(level_), std::uint64_t(bytes_))
+
+/**
+ * \brief Records an instant trace event.
+ *
+ * \param kind_ The FEAT::TraceKind of the event.
+ * \param name_ A string literal naming the event.
+ */
+#define FEAT_TRACE_INSTANT(kind_, name_) \
+  do { if(FEAT::Tracer::enabled()) { const std::int64_t feat_trace_t_ = FEAT::Tracer::now(); \
+    FEAT::Tracer::record(FEAT::TraceRecord{feat_trace_t_, feat_trace_t_, name_, 0u, 0u, -1, kind_, FEAT::TracePhase::instant}); } } while(false)
+#endif // FEAT_NO_TRACE
+
+#endif // KERNEL_UTIL_TRACE_HPP